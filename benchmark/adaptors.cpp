@@ -0,0 +1,475 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    adaptors.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/batch.hpp>
+#include <boost/hof/compose.hpp>
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/fix.hpp>
+#include <boost/hof/fix_trampoline.hpp>
+#include <boost/hof/flow.hpp>
+#include <boost/hof/filter.hpp>
+#include <boost/hof/fold.hpp>
+#include <boost/hof/fold_into.hpp>
+#include <boost/hof/hash_of.hpp>
+#include <boost/hof/lazy.hpp>
+#include <boost/hof/lexicographic.hpp>
+#include <boost/hof/map.hpp>
+#include <boost/hof/partial.hpp>
+#include <boost/hof/pipable.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <boost/hof/proj.hpp>
+#include <boost/hof/repeat.hpp>
+#include <boost/hof/repeat_while.hpp>
+#include <boost/hof/result.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/unpack_n.hpp>
+#include <vector>
+#include <cstdint>
+#include <initializer_list>
+#include <tuple>
+#include "benchmark.hpp"
+
+namespace {
+
+struct increment
+{
+    std::size_t operator()(std::size_t x) const
+    {
+        return x + 1;
+    }
+};
+
+struct twice
+{
+    std::size_t operator()(std::size_t x) const
+    {
+        return 2 * x;
+    }
+};
+
+struct add
+{
+    std::size_t operator()(std::size_t x, std::size_t y) const
+    {
+        return x + y;
+    }
+};
+
+struct square_float
+{
+    float operator()(float x) const
+    {
+        return x * x;
+    }
+};
+
+struct add_float
+{
+    float operator()(float x, float y) const
+    {
+        return x + y;
+    }
+};
+
+struct negate_float
+{
+    float operator()(float x) const
+    {
+        return -x;
+    }
+};
+
+struct point
+{
+    std::size_t x;
+    std::size_t y;
+};
+
+struct get_x
+{
+    std::size_t operator()(const point& p) const
+    {
+        return p.x;
+    }
+};
+
+struct from_pointer
+{
+    std::size_t operator()(const std::size_t* p) const
+    {
+        return *p;
+    }
+};
+
+struct from_value
+{
+    std::size_t operator()(std::size_t x) const
+    {
+        return x + 3;
+    }
+};
+
+struct sum_all
+{
+    template<class... Ts>
+    std::size_t operator()(Ts... xs) const
+    {
+        std::size_t r = 0;
+        (void)std::initializer_list<int>{(r += xs, 0)...};
+        return r;
+    }
+};
+
+struct sum_to
+{
+    template<class Self>
+    std::size_t operator()(Self self, std::size_t x) const
+    {
+        return x == 0 ? 0 : x + self(x - 1);
+    }
+};
+
+struct less_than
+{
+    std::size_t n;
+    bool operator()(std::size_t x) const
+    {
+        return x < n;
+    }
+};
+
+struct sum_to_tail
+{
+    template<class Self>
+    auto operator()(Self self, std::size_t x, std::size_t acc) const -> decltype(self(x, acc))
+    {
+        return x == 0 ? acc : self(x - 1, acc + x);
+    }
+};
+
+std::size_t hand_sum_to(std::size_t x)
+{
+    return x == 0 ? 0 : x + hand_sum_to(x - 1);
+}
+
+}
+
+BOOST_HOF_BENCHMARK(compose)
+BOOST_HOF_BENCHMARK_HOF(compose)
+{
+    auto f = boost::hof::compose(increment(), twice(), increment());
+    return hof_benchmark::measure([&](std::size_t i) { return f(i); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(compose)
+{
+    return hof_benchmark::measure([](std::size_t i) { return increment()(twice()(increment()(i))); }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(flow)
+BOOST_HOF_BENCHMARK_HOF(flow)
+{
+    auto f = boost::hof::flow(increment(), twice(), increment());
+    return hof_benchmark::measure([&](std::size_t i) { return f(i); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(flow)
+{
+    return hof_benchmark::measure([](std::size_t i) { return increment()(twice()(increment()(i))); }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(pipable)
+BOOST_HOF_BENCHMARK_HOF(pipable)
+{
+    auto f = boost::hof::pipable(add());
+    return hof_benchmark::measure([&](std::size_t i) { return i | f(3); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(pipable)
+{
+    return hof_benchmark::measure([](std::size_t i) { return add()(i, 3); }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(partial)
+BOOST_HOF_BENCHMARK_HOF(partial)
+{
+    auto f = boost::hof::partial(add());
+    return hof_benchmark::measure([&](std::size_t i) { return f(i)(3); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(partial)
+{
+    return hof_benchmark::measure([](std::size_t i) { return add()(i, 3); }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(lazy)
+BOOST_HOF_BENCHMARK_HOF(lazy)
+{
+    using namespace boost::hof;
+    auto f = lazy(add())(_1, lazy(twice())(_1));
+    return hof_benchmark::measure([&](std::size_t i) { return f(i); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(lazy)
+{
+    return hof_benchmark::measure([](std::size_t i) { return add()(i, twice()(i)); }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(proj)
+BOOST_HOF_BENCHMARK_HOF(proj)
+{
+    auto f = boost::hof::proj(get_x(), add());
+    return hof_benchmark::measure([&](std::size_t i) { return f(point{i, 1}, point{3, i}); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(proj)
+{
+    return hof_benchmark::measure([](std::size_t i) { return add()(get_x()(point{i, 1}), get_x()(point{3, i})); }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(batch)
+BOOST_HOF_BENCHMARK_HOF(batch)
+{
+    std::vector<float> x(1024, 1), y(1024, 2), r(1024);
+    auto f = boost::hof::batch(boost::hof::flow(boost::hof::proj(square_float(), add_float()), negate_float()));
+    return hof_benchmark::measure([&](std::size_t i) {
+        x[i % 1024] = float(i);
+        f(r, x, y);
+        return r[(i + 1) % 1024];
+    }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(batch)
+{
+    std::vector<float> x(1024, 1), y(1024, 2), r(1024);
+    return hof_benchmark::measure([&](std::size_t i) {
+        x[i % 1024] = float(i);
+        for(std::size_t j = 0; j < r.size(); j++) r[j] = -(x[j] * x[j] + y[j] * y[j]);
+        return r[(i + 1) % 1024];
+    }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(fold)
+BOOST_HOF_BENCHMARK_HOF(fold)
+{
+    auto f = boost::hof::fold(add(), std::size_t(0));
+    return hof_benchmark::measure([&](std::size_t i) { return f(i, i, 1, 2, i, 3, 4, i); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(fold)
+{
+    return hof_benchmark::measure([](std::size_t i) { return i + i + 1 + 2 + i + 3 + 4 + i; }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(fold_into)
+BOOST_HOF_BENCHMARK_HOF(fold_into)
+{
+    std::vector<int> x(1024, 1);
+    return hof_benchmark::measure([&](std::size_t i) {
+        x[i % 1024] = int(i);
+        return x | boost::hof::map(boost::hof::_1 * boost::hof::_1) | boost::hof::filter(boost::hof::_ > 1) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0);
+    }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(fold_into)
+{
+    std::vector<int> x(1024, 1);
+    return hof_benchmark::measure([&](std::size_t i) {
+        x[i % 1024] = int(i);
+        int r = 0;
+        for(std::size_t j = 0; j < x.size(); j++)
+        {
+            int y = x[j] * x[j];
+            if (y > 1) r += y;
+        }
+        return r;
+    }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(first_of)
+BOOST_HOF_BENCHMARK_HOF(first_of)
+{
+    auto f = boost::hof::first_of(from_pointer(), from_value());
+    return hof_benchmark::measure([&](std::size_t i) { return f(i); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(first_of)
+{
+    return hof_benchmark::measure([](std::size_t i) { return from_value()(i); }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(unpack)
+BOOST_HOF_BENCHMARK_HOF(unpack)
+{
+    auto f = boost::hof::unpack(add());
+    return hof_benchmark::measure([&](std::size_t i) { return f(std::make_tuple(i, i + 3)); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(unpack)
+{
+    return hof_benchmark::measure([](std::size_t i) {
+        auto t = std::make_tuple(i, i + 3);
+        return add()(std::get<0>(t), std::get<1>(t));
+    }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(unpack_n)
+BOOST_HOF_BENCHMARK_HOF(unpack_n)
+{
+    std::vector<std::vector<std::size_t>> vs = { {}, {1}, {1, 2}, {1, 2, 3}, {1, 2, 3, 4} };
+    auto f = boost::hof::unpack_n<4>(sum_all());
+    return hof_benchmark::measure([&](std::size_t i) { return f(vs[i % 5]); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(unpack_n)
+{
+    std::vector<std::vector<std::size_t>> vs = { {}, {1}, {1, 2}, {1, 2, 3}, {1, 2, 3, 4} };
+    return hof_benchmark::measure([&](std::size_t i) {
+        const std::vector<std::size_t>& v = vs[i % 5];
+        switch(v.size())
+        {
+            case 0: return sum_all()();
+            case 1: return sum_all()(v[0]);
+            case 2: return sum_all()(v[0], v[1]);
+            case 3: return sum_all()(v[0], v[1], v[2]);
+            default: return sum_all()(v[0], v[1], v[2], v[3]);
+        }
+    }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(fix)
+BOOST_HOF_BENCHMARK_HOF(fix)
+{
+    auto f = boost::hof::fix(sum_to());
+    return hof_benchmark::measure([&](std::size_t i) { return f(i % 16); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(fix)
+{
+    return hof_benchmark::measure([](std::size_t i) { return hand_sum_to(i % 16); }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(fix_depth0)
+BOOST_HOF_BENCHMARK_HOF(fix_depth0)
+{
+    auto f = boost::hof::fix_depth<0>(boost::hof::result<std::size_t>(sum_to()));
+    return hof_benchmark::measure([&](std::size_t i) { return f(i % 16); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(fix_depth0)
+{
+    return hof_benchmark::measure([](std::size_t i) { return hand_sum_to(i % 16); }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(fix_trampoline)
+BOOST_HOF_BENCHMARK_HOF(fix_trampoline)
+{
+    auto f = boost::hof::fix_trampoline<std::size_t(std::size_t, std::size_t)>(sum_to_tail());
+    return hof_benchmark::measure([&](std::size_t i) { return f(i % 16, 0); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(fix_trampoline)
+{
+    return hof_benchmark::measure([](std::size_t i) {
+        std::size_t acc = 0;
+        for(std::size_t x = i % 16; x != 0; x--) acc += x;
+        return acc;
+    }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(repeat)
+BOOST_HOF_BENCHMARK_HOF(repeat)
+{
+    auto f = boost::hof::repeat(std::integral_constant<int, 8>())(increment());
+    return hof_benchmark::measure([&](std::size_t i) { return f(i); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(repeat)
+{
+    return hof_benchmark::measure([](std::size_t i) {
+        for(int n = 0; n < 8; n++) i = increment()(i);
+        return i;
+    }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(repeat_runtime)
+BOOST_HOF_BENCHMARK_HOF(repeat_runtime)
+{
+    auto f = boost::hof::repeat(hof_benchmark::opaque(8))(increment());
+    return hof_benchmark::measure([&](std::size_t i) { return f(i); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(repeat_runtime)
+{
+    int n = hof_benchmark::opaque(8);
+    return hof_benchmark::measure([&](std::size_t i) {
+        for(int k = 0; k < n; k++) i = increment()(i);
+        return i;
+    }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(repeat_while)
+BOOST_HOF_BENCHMARK_HOF(repeat_while)
+{
+    return hof_benchmark::measure([&](std::size_t i) {
+        return boost::hof::repeat_while(less_than{i % 16 + 8})(increment())(i % 16);
+    }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(repeat_while)
+{
+    return hof_benchmark::measure([](std::size_t i) {
+        std::size_t x = i % 16;
+        while(x < i % 16 + 8) x = increment()(x);
+        return x;
+    }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(repeat_while_d16)
+BOOST_HOF_BENCHMARK_HOF(repeat_while_d16)
+{
+    return hof_benchmark::measure([&](std::size_t i) {
+        return boost::hof::repeat_while_depth<16>(less_than{i % 16 + 8})(increment())(i % 16);
+    }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(repeat_while_d16)
+{
+    return hof_benchmark::measure([](std::size_t i) {
+        std::size_t x = i % 16;
+        while(x < i % 16 + 8) x = increment()(x);
+        return x;
+    }, iterations);
+}
+
+// The hand-written version is the usual chain of hash_combine calls
+BOOST_HOF_BENCHMARK(hash_of)
+BOOST_HOF_BENCHMARK_HOF(hash_of)
+{
+    return hof_benchmark::measure([](std::size_t i) {
+        return boost::hof::hash_of(i, i + 1, i + 2, i + 3, i + 4, i + 5, i + 6, i + 7);
+    }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(hash_of)
+{
+    return hof_benchmark::measure([](std::size_t i) {
+        std::size_t seed = 0;
+        for(std::size_t j = 0; j < 8; j++) seed ^= std::hash<std::size_t>()(i + j) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        return seed;
+    }, iterations);
+}
+
+// The unsigned fields are compared as one key, instead of the branches of
+// the tuple comparison, which the random fields make hard to predict
+BOOST_HOF_BENCHMARK(lexicographic)
+BOOST_HOF_BENCHMARK_HOF(lexicographic)
+{
+    return hof_benchmark::measure([](std::size_t i) {
+        std::uint64_t x = i * 0x9E3779B97F4A7C15ULL;
+        x ^= x >> 29;
+        x *= 0xBF58476D1CE4E5B9ULL;
+        auto a = std::make_tuple(std::uint32_t(x >> 63), std::uint16_t((x >> 62) & 1), std::uint8_t(x >> 8));
+        auto b = std::make_tuple(std::uint32_t((x >> 61) & 1), std::uint16_t((x >> 60) & 1), std::uint8_t(x >> 16));
+        return std::size_t(boost::hof::lexicographic()(a, b));
+    }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(lexicographic)
+{
+    return hof_benchmark::measure([](std::size_t i) {
+        std::uint64_t x = i * 0x9E3779B97F4A7C15ULL;
+        x ^= x >> 29;
+        x *= 0xBF58476D1CE4E5B9ULL;
+        auto a = std::make_tuple(std::uint32_t(x >> 63), std::uint16_t((x >> 62) & 1), std::uint8_t(x >> 8));
+        auto b = std::make_tuple(std::uint32_t((x >> 61) & 1), std::uint16_t((x >> 60) & 1), std::uint8_t(x >> 16));
+        return std::size_t(a < b);
+    }, iterations);
+}
+
+int main(int argc, char const* argv[])
+{
+    return hof_benchmark::run(argc, argv);
+}
@@ -0,0 +1,123 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    benchmark.hpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_BENCHMARK_HPP
+#define BOOST_HOF_GUARD_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace hof_benchmark {
+
+// Keeps the compiler from using the value of x at compile time, and from
+// removing the computation of x as dead code.
+template<class T>
+inline void do_not_optimize(T& x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : "+m"(x) : : "memory");
+#else
+    volatile T sink = x;
+    x = sink;
+#endif
+}
+
+template<class T>
+inline T opaque(T x)
+{
+    do_not_optimize(x);
+    return x;
+}
+
+struct benchmark
+{
+    const char* name;
+    double (*hof)(std::size_t);
+    double (*hand)(std::size_t);
+};
+
+inline std::vector<benchmark>& registry()
+{
+    static std::vector<benchmark> r;
+    return r;
+}
+
+struct registrar
+{
+    registrar(const char* name, double (*hof)(std::size_t), double (*hand)(std::size_t))
+    {
+        registry().push_back(benchmark{name, hof, hand});
+    }
+};
+
+// Returns the time in nanoseconds for each call of f(i)
+template<class F>
+double measure(F f, std::size_t iterations)
+{
+    typedef std::chrono::steady_clock clock;
+    for(std::size_t i = 0; i < iterations / 10 + 1; i++)
+    {
+        auto r = f(opaque(i));
+        do_not_optimize(r);
+    }
+    auto start = clock::now();
+    for(std::size_t i = 0; i < iterations; i++)
+    {
+        auto r = f(opaque(i));
+        do_not_optimize(r);
+    }
+    auto stop = clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / iterations;
+}
+
+inline int run(int argc, char const* argv[])
+{
+    std::size_t iterations = 10000000;
+    const char* filter = nullptr;
+    for(int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc) iterations = std::strtoul(argv[++i], nullptr, 10);
+        else filter = argv[i];
+    }
+#ifdef BOOST_HOF_BENCHMARK_LEVEL
+    std::printf("# optimization level: %s\n", BOOST_HOF_BENCHMARK_LEVEL);
+#endif
+    std::printf("# iterations: %lu\n", static_cast<unsigned long>(iterations));
+    std::printf("%-24s %12s %12s %8s\n", "benchmark", "hof ns/op", "hand ns/op", "ratio");
+    for(const benchmark& b:registry())
+    {
+        if (filter != nullptr && std::strstr(b.name, filter) == nullptr) continue;
+        double hof = b.hof(iterations);
+        double hand = b.hand(iterations);
+        std::printf("%-24s %12.3f %12.3f %8.2f\n", b.name, hof, hand, hand > 0 ? hof / hand : 0.0);
+    }
+    return 0;
+}
+
+} // namespace hof_benchmark
+
+#define BOOST_HOF_BENCHMARK_DETAIL_FN(name, kind) \
+    static double BOOST_HOF_BENCHMARK_DETAIL_ ## name ## _ ## kind(std::size_t iterations)
+
+// Declares a benchmark with a `hof` function that uses the adaptors, and a
+// `hand` function with the equivalent hand-written code. Each function is
+// given the number of iterations and returns the ns/op from `measure`.
+#define BOOST_HOF_BENCHMARK(name) \
+    BOOST_HOF_BENCHMARK_DETAIL_FN(name, hof); \
+    BOOST_HOF_BENCHMARK_DETAIL_FN(name, hand); \
+    static hof_benchmark::registrar BOOST_HOF_BENCHMARK_DETAIL_ ## name ## _registrar( \
+        #name, &BOOST_HOF_BENCHMARK_DETAIL_ ## name ## _hof, &BOOST_HOF_BENCHMARK_DETAIL_ ## name ## _hand \
+    );
+
+#define BOOST_HOF_BENCHMARK_HOF(name) BOOST_HOF_BENCHMARK_DETAIL_FN(name, hof)
+#define BOOST_HOF_BENCHMARK_HAND(name) BOOST_HOF_BENCHMARK_DETAIL_FN(name, hand)
+
+#endif
@@ -0,0 +1,472 @@
+#!/usr/bin/env python3
+#=============================================================================
+#    Copyright (c) 2017 Paul Fultz II
+#    compile_time.py
+#    Distributed under the Boost Software License, Version 1.0. (See accompanying
+#    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#==============================================================================
+"""Measures the compile-time cost of the adaptors as their size grows.
+
+For every scenario and every N, a translation unit is generated and compiled,
+and the wall time and peak RSS of the compiler are recorded. The results are
+written as csv along with an svg plot of the curves for each scenario. With
+clang the `-ftime-trace` json is kept for each translation unit, with gcc the
+`-ftime-report` output is kept, and with msvc the `/Bt+` output is kept.
+
+    compile_time.py --compiler clang++ --sizes 1,8,16,32,64 --output out
+"""
+
+import argparse
+import csv
+import os
+import shutil
+import subprocess
+import sys
+import time
+
+def seq(n, f, sep=', '):
+    return sep.join(f(i) for i in range(n))
+
+HEADER = '''
+#include <boost/hof.hpp>
+#include <type_traits>
+
+template<int I>
+struct tag
+{};
+
+struct increment
+{
+    template<class T>
+    constexpr T operator()(T x) const
+    {
+        return x + 1;
+    }
+};
+
+struct count_args
+{
+    template<class... Ts>
+    constexpr int operator()(Ts&&...) const
+    {
+        return sizeof...(Ts);
+    }
+};
+'''
+
+def overloads(n):
+    return seq(n, lambda i: '''
+struct f{0}
+{{
+    constexpr int operator()(tag<{0}>) const
+    {{
+        return {0};
+    }}
+}};'''.format(i), '\n')
+
+def baseline(n):
+    return 'int main() { return 0; }\n'
+
+def pack(n):
+    return '''
+int main()
+{{
+    auto p = boost::hof::pack({0});
+    return p(count_args());
+}}
+'''.format(seq(n, str))
+
+# The pack of empty functions is built with the layout used on each compiler,
+# and with the `pack_holder_base` layout used before VS 2019, and checks that
+# both of them are empty.
+def pack_empty(holder_base):
+    def generate(n):
+        return '#define BOOST_HOF_PACK_USE_HOLDER_BASE {0}\n'.format(int(holder_base)) + HEADER + overloads(n) + '''
+int main()
+{{
+    auto p = boost::hof::pack({0});
+    static_assert(sizeof(p) == 1, "The pack of empty functions is not empty");
+    return p(count_args());
+}}
+'''.format(seq(n, lambda i: 'f{}()'.format(i)))
+    generate.header = False
+    return generate
+
+def unpack(n):
+    return '''
+#include <tuple>
+
+static_assert(boost::hof::unpack(count_args())(std::make_tuple({0})) == {1}, "");
+
+int main()
+{{
+    return boost::hof::unpack(count_args())(std::make_tuple({0}));
+}}
+'''.format(seq(n, str), n)
+
+def unpack_pack(n):
+    return '''
+static_assert(boost::hof::unpack(count_args())(boost::hof::pack({0})) == {1}, "");
+
+int main()
+{{
+    return boost::hof::unpack(count_args())(boost::hof::pack({0}));
+}}
+'''.format(seq(n, str), n)
+
+def fold(n):
+    return '''
+struct plus
+{{
+    template<class T, class U>
+    constexpr T operator()(T x, U y) const
+    {{
+        return x + y;
+    }}
+}};
+
+static_assert(boost::hof::fold(plus())({0}) == {1}, "");
+
+int main()
+{{
+    return boost::hof::fold(plus())({0});
+}}
+'''.format(seq(n, str), n * (n - 1) // 2)
+
+def combine(n):
+    return '''
+static_assert(boost::hof::combine(count_args(), {0})({1}) == {2}, "");
+
+int main()
+{{
+    return boost::hof::combine(count_args(), {0})({1});
+}}
+'''.format(seq(n, lambda i: 'increment()'), seq(n, str), n)
+
+def overload_set(adaptor):
+    def generate(n):
+        return overloads(n) + '''
+int main()
+{{
+    auto f = boost::hof::{0}({1});
+    return f(tag<{2}>());
+}}
+'''.format(adaptor, seq(n, lambda i: 'f{}()'.format(i)), n - 1)
+    return generate
+
+# The same overload set is called from N functions, half of them with the
+# same argument types, which should only select the overload once for each
+def overload_calls(adaptor):
+    def generate(n):
+        return overloads(8) + '''
+static constexpr auto f = boost::hof::{0}({1});
+{2}
+int main()
+{{
+    return {3};
+}}
+'''.format(adaptor, seq(8, lambda i: 'f{}()'.format(i)),
+            seq(n, lambda i: 'int call{0}() {{ return f(tag<{1}>()); }}'.format(i, 7 if i % 2 else i % 8), '\n'),
+            seq(n, lambda i: 'call{}()'.format(i), ' + '))
+    return generate
+
+def chain(adaptor):
+    def generate(n):
+        return '''
+int main()
+{{
+    auto f = boost::hof::{0}({1});
+    return f(0);
+}}
+'''.format(adaptor, seq(n, lambda i: 'increment()'))
+    return generate
+
+def pipeline(adaptor):
+    def generate(n):
+        return '''
+struct add
+{{
+    template<class T, class U>
+    constexpr T operator()(T x, U) const
+    {{
+        return x + U::value;
+    }}
+}};
+
+int main()
+{{
+    auto f = boost::hof::{0}(add());
+    return 0 {1};
+}}
+'''.format(adaptor, seq(n, lambda i: '| f(std::integral_constant<int, {}>())'.format(i), ' '))
+    return generate
+
+def fix(n):
+    return '''
+struct countdown
+{{
+    template<class Self, int I>
+    constexpr int operator()(Self self, std::integral_constant<int, I>) const
+    {{
+        return self(std::integral_constant<int, I-1>());
+    }}
+
+    template<class Self>
+    constexpr int operator()(Self, std::integral_constant<int, 0>) const
+    {{
+        return 0;
+    }}
+}};
+
+int main()
+{{
+    return boost::hof::fix(countdown())(std::integral_constant<int, {0}>());
+}}
+'''.format(n)
+
+def repeat(n):
+    return '''
+int main()
+{{
+    return boost::hof::repeat(std::integral_constant<int, {0}>())(increment())(0);
+}}
+'''.format(n)
+
+def fix_depth(n):
+    return '''
+struct sum_to
+{{
+    template<class Self>
+    constexpr int operator()(Self self, int x) const
+    {{
+        return x == 0 ? 0 : x + self(x - 1);
+    }}
+}};
+
+int main(int argc, char const*[])
+{{
+    return boost::hof::fix_depth<{0}>(boost::hof::result<int>(sum_to()))(argc);
+}}
+'''.format(n)
+
+def repeat_while_depth(n):
+    return '''
+struct less_than_argc
+{{
+    int n;
+    constexpr bool operator()(int x) const
+    {{
+        return x < n;
+    }}
+}};
+
+int main(int argc, char const*[])
+{{
+    return boost::hof::repeat_while_depth<{0}>(less_than_argc{{argc}})(increment())(0);
+}}
+'''.format(n)
+
+# The same calls are made with an adaptor and with the facility of the
+# standard library it is compared with, from N functions that each bind a
+# different type. Both sides of a comparison are compiled with the standard
+# that the library facility needs.
+STD_HEADER = '''
+#include <functional>
+#include <tuple>
+
+struct add
+{
+    template<class T, class U>
+    constexpr int operator()(T x, U y) const
+    {
+        return int(x) + int(y);
+    }
+};
+'''
+
+def std_calls(std, call):
+    def generate(n):
+        return STD_HEADER + '''
+{0}
+int main()
+{{
+    return {1};
+}}
+'''.format(seq(n, lambda i: 'int call{0}() {{ return {1}; }}'.format(i, call.format('std::integral_constant<int, {}>()'.format(i))), '\n'),
+            seq(n, lambda i: 'call{}()'.format(i), ' + '))
+    generate.std = std
+    return generate
+
+# The branches of the `if constexpr` chain are the overloads of `first_of_calls`
+def if_constexpr_calls(n):
+    return overloads(8) + '''
+static constexpr auto f = [](auto x)
+{{
+    {1}
+}};
+{0}
+int main()
+{{
+    return {2};
+}}
+'''.format(seq(n, lambda i: 'int call{0}() {{ return f(tag<{1}>()); }}'.format(i, 7 if i % 2 else i % 8), '\n'),
+            seq(8, lambda i: 'if constexpr (std::is_same<decltype(x), tag<{0}>>::value) return f{0}()(x);'.format(i), '\n    else '),
+            seq(n, lambda i: 'call{}()'.format(i), ' + '))
+if_constexpr_calls.std = 'c++17'
+
+def first_of_calls_17(n):
+    return overload_calls('first_of')(n)
+first_of_calls_17.std = 'c++17'
+
+SCENARIOS = {
+    'baseline': baseline,
+    'pack': pack,
+    'pack_empty': pack_empty(False),
+    'pack_empty_holder_base': pack_empty(True),
+    'unpack': unpack,
+    'unpack_pack': unpack_pack,
+    'fold': fold,
+    'first_of': overload_set('first_of'),
+    'match': overload_set('match'),
+    'first_of_calls': overload_calls('first_of'),
+    'compose': chain('compose'),
+    'flow': chain('flow'),
+    'combine': combine,
+    'pipable': pipeline('pipable'),
+    'pipable_c': pipeline('pipable_c<2>'),
+    'fix': fix,
+    'repeat': repeat,
+    'fix_depth': fix_depth,
+    'repeat_while_depth': repeat_while_depth,
+    'partial_calls': std_calls('c++20', 'boost::hof::partial(add())({})(1)'),
+    'std_bind_front_calls': std_calls('c++20', 'std::bind_front(add(), {})(1)'),
+    'lazy_calls': std_calls('c++17', 'boost::hof::lazy(add())(boost::hof::_1, {})(1)'),
+    'std_bind_calls': std_calls('c++17', 'std::bind(add(), std::placeholders::_1, {})(1)'),
+    'unpack_calls': std_calls('c++17', 'boost::hof::unpack(add())(std::make_tuple(1, {}))'),
+    'std_apply_calls': std_calls('c++17', 'std::apply(add(), std::make_tuple(1, {}))'),
+    'apply_calls': std_calls('c++17', 'boost::hof::apply(add(), 1, {})'),
+    'std_invoke_calls': std_calls('c++17', 'std::invoke(add(), 1, {})'),
+    'first_of_calls_17': first_of_calls_17,
+    'if_constexpr_calls': if_constexpr_calls,
+}
+
+def compiler_family(compiler):
+    name = os.path.basename(compiler).lower()
+    if name.startswith('cl') and not name.startswith('clang'): return 'msvc'
+    try:
+        out = subprocess.run([compiler, '--version'], stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True).stdout
+    except OSError:
+        sys.exit('Unable to run compiler: {}'.format(compiler))
+    if 'clang' in out: return 'clang'
+    return 'gcc'
+
+def compile_command(family, args, source, obj, std):
+    if family == 'msvc':
+        cmd = [args.compiler, '/nologo', '/c', '/EHsc', '/std:' + std, '/I' + args.include, '/Bt+', source, '/Fo' + obj]
+    else:
+        cmd = [args.compiler, '-c', '-std=' + std, '-I' + args.include, source, '-o', obj]
+        if family == 'clang': cmd += ['-ftime-trace', '-ftime-trace-granularity=100']
+        if family == 'gcc': cmd += ['-ftime-report']
+    return cmd + args.flags
+
+def run(cmd):
+    start = time.time()
+    p = subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    rss = None
+    if hasattr(os, 'wait4'):
+        output = p.stdout.read()
+        _, status, usage = os.wait4(p.pid, 0)
+        p.returncode = os.waitstatus_to_exitcode(status) if hasattr(os, 'waitstatus_to_exitcode') else (status >> 8)
+        # ru_maxrss is in bytes on macOS and in kilobytes elsewhere
+        rss = usage.ru_maxrss / (1024.0 * 1024.0) if sys.platform == 'darwin' else usage.ru_maxrss / 1024.0
+    else:
+        output, _ = p.communicate()
+    return time.time() - start, rss, p.returncode, output
+
+def measure(family, args, name, n):
+    work = os.path.join(args.output, 'tu')
+    traces = os.path.join(args.output, 'traces')
+    source = os.path.join(work, '{}_{}.cpp'.format(name, n))
+    obj = os.path.join(work, '{}_{}.o'.format(name, n))
+    generate = SCENARIOS[name]
+    with open(source, 'w') as f: f.write((HEADER if getattr(generate, 'header', True) else '') + generate(n))
+    best = None
+    for _ in range(args.repeat):
+        wall, rss, code, output = run(compile_command(family, args, source, obj, getattr(generate, 'std', args.std)))
+        if code != 0:
+            sys.stderr.write(output)
+            sys.exit('Failed to compile {}'.format(source))
+        if best is None or wall < best[0]: best = (wall, rss, output)
+    if family == 'clang':
+        trace = os.path.splitext(obj)[0] + '.json'
+        if os.path.exists(trace): shutil.move(trace, os.path.join(traces, '{}_{}.json'.format(name, n)))
+    else:
+        with open(os.path.join(traces, '{}_{}.txt'.format(name, n)), 'w') as f: f.write(best[2])
+    return best[0], best[1]
+
+def plot(path, title, points, label):
+    width, height, margin = 640, 400, 60
+    xs = [x for x, _ in points]
+    ys = [y for _, y in points]
+    xmax = max(xs) or 1
+    ymax = max(ys) or 1
+    def px(x): return margin + (width - 2 * margin) * x / float(xmax)
+    def py(y): return height - margin - (height - 2 * margin) * y / float(ymax)
+    line = ' '.join('{:.1f},{:.1f}'.format(px(x), py(y)) for x, y in points)
+    with open(path, 'w') as f:
+        f.write('<svg xmlns="http://www.w3.org/2000/svg" width="{0}" height="{1}" font-family="sans-serif" font-size="12">\n'.format(width, height))
+        f.write('<text x="{0}" y="20" text-anchor="middle">{1}</text>\n'.format(width / 2, title))
+        f.write('<line x1="{0}" y1="{1}" x2="{2}" y2="{1}" stroke="black"/>\n'.format(margin, height - margin, width - margin))
+        f.write('<line x1="{0}" y1="{1}" x2="{0}" y2="{2}" stroke="black"/>\n'.format(margin, height - margin, margin))
+        f.write('<text x="{0}" y="{1}" text-anchor="middle">N (max {2})</text>\n'.format(width / 2, height - 20, xmax))
+        f.write('<text x="15" y="{0}" transform="rotate(-90 15 {0})" text-anchor="middle">{1} (max {2:.3g})</text>\n'.format(height / 2, label, ymax))
+        f.write('<polyline fill="none" stroke="steelblue" stroke-width="2" points="{}"/>\n'.format(line))
+        for x, y in points:
+            f.write('<circle cx="{:.1f}" cy="{:.1f}" r="3" fill="steelblue"/>\n'.format(px(x), py(y)))
+        f.write('</svg>\n')
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description='Measure the compile-time cost of the adaptors.')
+    parser.add_argument('--compiler', default=os.environ.get('CXX', 'c++'))
+    parser.add_argument('--std', default='c++14')
+    parser.add_argument('--include', default=os.path.join(here, '..', '..', 'include'))
+    parser.add_argument('--sizes', default='1,2,4,8,16,32,64')
+    parser.add_argument('--scenarios', default=','.join(SCENARIOS))
+    parser.add_argument('--repeat', type=int, default=1, help='Keep the fastest of this many compiles')
+    parser.add_argument('--output', default='compile_time')
+    parser.add_argument('flags', nargs='*', help='Extra flags passed to the compiler')
+    args = parser.parse_args()
+
+    sizes = [int(n) for n in args.sizes.split(',')]
+    scenarios = args.scenarios.split(',')
+    for name in scenarios:
+        if name not in SCENARIOS: sys.exit('Unknown scenario: {}'.format(name))
+    for d in ['tu', 'traces', 'plots']:
+        path = os.path.join(args.output, d)
+        if not os.path.isdir(path): os.makedirs(path)
+    family = compiler_family(args.compiler)
+
+    results = []
+    print('{:<24} {:>6} {:>10} {:>10}'.format('scenario', 'N', 'time (s)', 'rss (MB)'))
+    for name in scenarios:
+        for n in sizes:
+            wall, rss = measure(family, args, name, n)
+            results.append((name, n, wall, rss))
+            print('{:<24} {:>6} {:>10.3f} {:>10}'.format(name, n, wall, '-' if rss is None else '{:.1f}'.format(rss)))
+            sys.stdout.flush()
+
+    with open(os.path.join(args.output, 'results.csv'), 'w') as f:
+        w = csv.writer(f)
+        w.writerow(['compiler', 'scenario', 'n', 'seconds', 'peak_rss_mb'])
+        for name, n, wall, rss in results:
+            w.writerow([family, name, n, '{:.4f}'.format(wall), '' if rss is None else '{:.1f}'.format(rss)])
+
+    for name in scenarios:
+        rows = [r for r in results if r[0] == name]
+        plot(os.path.join(args.output, 'plots', name + '_time.svg'), name + ' (' + family + ')', [(r[1], r[2]) for r in rows], 'seconds')
+        if all(r[3] is not None for r in rows):
+            plot(os.path.join(args.output, 'plots', name + '_rss.svg'), name + ' (' + family + ')', [(r[1], r[3]) for r in rows], 'peak RSS (MB)')
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+#=============================================================================
+#    Copyright (c) 2017 Paul Fultz II
+#    constexpr_steps.py
+#    Distributed under the Boost Software License, Version 1.0. (See accompanying
+#    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#==============================================================================
+"""Measures the constexpr evaluation steps used by the adaptors.
+
+For every scenario, a translation unit is generated that calls the adaptor in
+a `constexpr` loop, and the smallest step limit that still compiles it is
+found by a binary search over `-fconstexpr-steps` for clang,
+`-fconstexpr-ops-limit` for gcc, or `/constexpr:steps` for msvc. The steps of
+the loop alone are measured the same way and subtracted, so the results are
+the steps for each call of the adaptor.
+
+    constexpr_steps.py --compiler clang++ --scenarios compose,flow
+"""
+
+import argparse
+import csv
+import os
+import subprocess
+import sys
+
+HEADER = '''
+#include <boost/hof.hpp>
+
+struct increment
+{
+    template<class T>
+    constexpr T operator()(T x) const
+    {
+        return x + 1;
+    }
+};
+
+struct plus
+{
+    template<class T, class U>
+    constexpr T operator()(T x, U y) const
+    {
+        return x + y;
+    }
+};
+
+struct is_int
+{
+    constexpr int operator()(int x) const
+    {
+        return x;
+    }
+};
+
+struct is_char
+{
+    constexpr int operator()(char x) const
+    {
+        return x;
+    }
+};
+
+constexpr int run()
+{
+    int r = 0;
+    for(int i = 0; i < ITERATIONS; i++) r += CALL;
+    return r;
+}
+
+static_assert(run() >= 0, "");
+'''
+
+SCENARIOS = {
+    'baseline': 'i',
+    'always': 'boost::hof::always(i)()',
+    'compose': 'boost::hof::compose(increment(), increment(), increment())(i)',
+    'flow': 'boost::hof::flow(increment(), increment(), increment())(i)',
+    'first_of': 'boost::hof::first_of(is_char(), is_int())(i)',
+    'combine': 'boost::hof::combine(plus(), increment(), increment())(i, i)',
+    'partial': 'boost::hof::partial(plus())(i)(i)',
+    'pipable': '(i | boost::hof::pipable(plus())(i))',
+    'flip': 'boost::hof::flip(plus())(i, i)',
+    'fold': 'boost::hof::fold(plus())(i, i, i, i)',
+    'pack': 'boost::hof::pack(i, i, i)(boost::hof::fold(plus()))',
+    'unpack': 'boost::hof::unpack(plus())(boost::hof::pack(i, i))',
+    'proj': 'boost::hof::proj(increment(), plus())(i, i)',
+    'capture': 'boost::hof::capture(i)(plus())(i)',
+    'repeat': 'boost::hof::repeat(std::integral_constant<int, 4>())(increment())(i)',
+    'lazy': 'boost::hof::lazy(plus())(boost::hof::_1, boost::hof::_2)(i, i)',
+}
+
+def compiler_family(compiler):
+    name = os.path.basename(compiler).lower()
+    if name.startswith('cl') and not name.startswith('clang'): return 'msvc'
+    try:
+        out = subprocess.run([compiler, '--version'], stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True).stdout
+    except OSError:
+        sys.exit('Unable to run compiler: {}'.format(compiler))
+    if 'clang' in out: return 'clang'
+    return 'gcc'
+
+def compiles(family, args, source, limit):
+    if family == 'msvc':
+        cmd = [args.compiler, '/nologo', '/Zs', '/std:' + args.std, '/I' + args.include, '/constexpr:steps{}'.format(limit), source]
+    else:
+        flag = '-fconstexpr-steps=' if family == 'clang' else '-fconstexpr-ops-limit='
+        cmd = [args.compiler, '-fsyntax-only', '-std=' + args.std, '-I' + args.include, flag + str(limit), source]
+    p = subprocess.run(cmd + args.flags, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    return p.returncode == 0
+
+def steps(family, args, name):
+    source = os.path.join(args.output, '{}.cpp'.format(name))
+    with open(source, 'w') as f:
+        f.write('#define ITERATIONS {}\n#define CALL ({})\n'.format(args.iterations, SCENARIOS[name]) + HEADER)
+    hi = 1
+    while not compiles(family, args, source, hi):
+        hi *= 2
+        if hi > (1 << 31): sys.exit('Failed to compile {}'.format(source))
+    lo = hi // 2
+    while lo + 1 < hi:
+        mid = (lo + hi) // 2
+        if compiles(family, args, source, mid): hi = mid
+        else: lo = mid
+    return hi
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description='Measure the constexpr evaluation steps of the adaptors.')
+    parser.add_argument('--compiler', default=os.environ.get('CXX', 'c++'))
+    parser.add_argument('--std', default='c++14')
+    parser.add_argument('--include', default=os.path.join(here, '..', '..', 'include'))
+    parser.add_argument('--iterations', type=int, default=100)
+    parser.add_argument('--scenarios', default=','.join(s for s in SCENARIOS if s != 'baseline'))
+    parser.add_argument('--output', default='constexpr_steps')
+    parser.add_argument('flags', nargs='*', help='Extra flags passed to the compiler')
+    args = parser.parse_args()
+
+    scenarios = args.scenarios.split(',')
+    for name in scenarios:
+        if name not in SCENARIOS: sys.exit('Unknown scenario: {}'.format(name))
+    if not os.path.isdir(args.output): os.makedirs(args.output)
+    family = compiler_family(args.compiler)
+
+    baseline = steps(family, args, 'baseline')
+    results = []
+    print('{:<12} {:>12} {:>10}'.format('scenario', 'steps', 'per call'))
+    for name in scenarios:
+        total = steps(family, args, name)
+        per_call = max(total - baseline, 0) / float(args.iterations)
+        results.append((name, total, per_call))
+        print('{:<12} {:>12} {:>10.1f}'.format(name, total, per_call))
+        sys.stdout.flush()
+
+    with open(os.path.join(args.output, 'results.csv'), 'w') as f:
+        w = csv.writer(f)
+        w.writerow(['compiler', 'scenario', 'steps', 'steps_per_call'])
+        for name, total, per_call in results:
+            w.writerow([family, name, total, '{:.1f}'.format(per_call)])
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+#=============================================================================
+#    Copyright (c) 2017 Paul Fultz II
+#    instantiation_stats.py
+#    Distributed under the Boost Software License, Version 1.0. (See accompanying
+#    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#==============================================================================
+"""Reports the template instantiations of each adaptor in a translation unit.
+
+With `BOOST_HOF_INSTANTIATION_STATS` defined to 1, every call operator of an
+adaptor instantiates `boost::hof::markers::calls::<adaptor>` with the types
+of its arguments, and every adaptor built by its factory is completed under
+`boost::hof::markers::<adaptor>`. The `-ftime-trace` json of clang records
+these instantiations, and since each one is only instantiated once in a
+translation unit, the calls are the distinct instantiations of the call
+operators of each adaptor. The time spent completing the adaptor types is
+reported as well.
+
+The sources are compiled with clang when they are given, otherwise the json
+traces that are given are read, such as the traces kept by compile_time.py
+when it is run with `-DBOOST_HOF_INSTANTIATION_STATS=1`:
+
+    instantiation_stats.py --compiler clang++ --flag=-Itest test/compose.cpp test/flow.cpp
+    instantiation_stats.py --traces compile_time/traces/*.json
+"""
+
+import argparse
+import collections
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+CALLS = re.compile(r'boost::hof::markers::calls::(\w+)<')
+FRAMES = re.compile(r'boost::hof::markers::(\w+)<')
+
+class Stats(object):
+    def __init__(self):
+        self.calls = 0
+        self.adaptors = 0
+        self.time = 0
+
+def events(trace):
+    with open(trace) as f:
+        data = json.load(f)
+    if isinstance(data, dict): data = data.get('traceEvents', [])
+    for e in data:
+        if e.get('ph') != 'X': continue
+        if not e.get('name', '').startswith('Instantiate'): continue
+        yield e.get('args', {}).get('detail', ''), e.get('dur', 0)
+
+def collect(traces):
+    stats = collections.defaultdict(Stats)
+    for trace in traces:
+        for detail, dur in events(trace):
+            m = CALLS.match(detail)
+            if m:
+                s = stats[m.group(1)]
+                s.calls += 1
+                continue
+            m = FRAMES.match(detail)
+            if m:
+                s = stats[m.group(1)]
+                s.adaptors += 1
+                s.time += dur
+    return stats
+
+def compile_traces(args, output):
+    traces = []
+    for source in args.sources:
+        obj = os.path.join(output, os.path.splitext(os.path.basename(source))[0] + '.o')
+        cmd = [
+            args.compiler, '-c', '-std=' + args.std, '-I' + args.include,
+            '-DBOOST_HOF_INSTANTIATION_STATS=1',
+            '-ftime-trace', '-ftime-trace-granularity=0',
+            source, '-o', obj
+        ]
+        p = subprocess.run(cmd + args.flags, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+        if p.returncode != 0:
+            sys.stderr.write(p.stdout)
+            sys.exit('Failed to compile {}'.format(source))
+        trace = os.path.splitext(obj)[0] + '.json'
+        if not os.path.exists(trace): sys.exit('No time trace was written for {}, the compiler must be clang'.format(source))
+        traces.append(trace)
+    return traces
+
+def report(stats, out=sys.stdout):
+    out.write('{:<14} {:>8} {:>9} {:>10}\n'.format('adaptor', 'calls', 'adaptors', 'time (ms)'))
+    for name, s in sorted(stats.items(), key=lambda x: (-x[1].calls, x[0])):
+        out.write('{:<14} {:>8} {:>9} {:>10.1f}\n'.format(name, s.calls, s.adaptors, s.time / 1000.0))
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description='Report the template instantiations of each adaptor.')
+    parser.add_argument('--compiler', default=os.environ.get('CXX', 'clang++'))
+    parser.add_argument('--std', default='c++14')
+    parser.add_argument('--include', default=os.path.join(here, '..', '..', 'include'))
+    parser.add_argument('--traces', nargs='*', default=[], help='Time trace json files to read instead of compiling')
+    parser.add_argument('--flag', action='append', default=[], dest='flags', help='Extra flag passed to the compiler, such as --flag=-Itest')
+    parser.add_argument('sources', nargs='*', help='Sources to compile')
+    args = parser.parse_args()
+
+    if not args.traces and not args.sources: parser.error('Either sources or traces must be given')
+    traces = list(args.traces)
+    if args.sources:
+        output = tempfile.mkdtemp(prefix='instantiation_stats')
+        traces += compile_traces(args, output)
+    report(collect(traces))
+
+if __name__ == '__main__':
+    main()
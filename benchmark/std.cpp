@@ -0,0 +1,135 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    std.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/apply.hpp>
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/lazy.hpp>
+#include <boost/hof/partial.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <boost/hof/unpack.hpp>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include "benchmark.hpp"
+
+// The adaptors are compared with the equivalent facilities of the standard
+// library, which are measured in the `hand` column. The ones that need a
+// newer standard are only registered when it is available.
+
+namespace {
+
+struct add
+{
+    std::size_t operator()(std::size_t x, std::size_t y) const
+    {
+        return x + y;
+    }
+};
+
+struct add3
+{
+    std::size_t operator()(std::size_t x, std::size_t y, std::size_t z) const
+    {
+        return x + y * z;
+    }
+};
+
+struct from_pointer
+{
+    template<class T>
+    std::size_t operator()(const T* p) const
+    {
+        return *p;
+    }
+};
+
+struct from_floating
+{
+    template<class T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+    std::size_t operator()(T x) const
+    {
+        return std::size_t(x * 2);
+    }
+};
+
+struct from_other
+{
+    template<class T>
+    std::size_t operator()(T x) const
+    {
+        return x + 1;
+    }
+};
+
+}
+
+#if defined(__cpp_lib_bind_front)
+BOOST_HOF_BENCHMARK(partial_bind_front)
+BOOST_HOF_BENCHMARK_HOF(partial_bind_front)
+{
+    return hof_benchmark::measure([](std::size_t i) { return boost::hof::partial(add3())(i, 3)(4); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(partial_bind_front)
+{
+    return hof_benchmark::measure([](std::size_t i) { return std::bind_front(add3(), i, 3)(4); }, iterations);
+}
+#endif
+
+BOOST_HOF_BENCHMARK(lazy_bind)
+BOOST_HOF_BENCHMARK_HOF(lazy_bind)
+{
+    using namespace boost::hof;
+    return hof_benchmark::measure([](std::size_t i) { return lazy(add())(_1, i)(3); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(lazy_bind)
+{
+    return hof_benchmark::measure([](std::size_t i) { return std::bind(add(), std::placeholders::_1, i)(3); }, iterations);
+}
+
+#if BOOST_HOF_HAS_STD_17
+BOOST_HOF_BENCHMARK(unpack_apply)
+BOOST_HOF_BENCHMARK_HOF(unpack_apply)
+{
+    return hof_benchmark::measure([](std::size_t i) { return boost::hof::unpack(add3())(std::make_tuple(i, i, 3)); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(unpack_apply)
+{
+    return hof_benchmark::measure([](std::size_t i) { return std::apply(add3(), std::make_tuple(i, i, 3)); }, iterations);
+}
+
+BOOST_HOF_BENCHMARK(apply_invoke)
+BOOST_HOF_BENCHMARK_HOF(apply_invoke)
+{
+    return hof_benchmark::measure([](std::size_t i) { return boost::hof::apply(add(), i, 3); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(apply_invoke)
+{
+    return hof_benchmark::measure([](std::size_t i) { return std::invoke(add(), i, 3); }, iterations);
+}
+
+// Each call selects a different overload
+BOOST_HOF_BENCHMARK(first_of_if_constexpr)
+BOOST_HOF_BENCHMARK_HOF(first_of_if_constexpr)
+{
+    auto f = boost::hof::first_of(from_pointer(), from_floating(), from_other());
+    return hof_benchmark::measure([&](std::size_t i) { return f(&i) + f(double(i)) + f(i); }, iterations);
+}
+BOOST_HOF_BENCHMARK_HAND(first_of_if_constexpr)
+{
+    auto f = [](auto x) -> std::size_t
+    {
+        if constexpr (std::is_pointer<decltype(x)>::value) return *x;
+        else if constexpr (std::is_floating_point<decltype(x)>::value) return std::size_t(x * 2);
+        else return x + 1;
+    };
+    return hof_benchmark::measure([&](std::size_t i) { return f(&i) + f(double(i)) + f(i); }, iterations);
+}
+#endif
+
+int main(int argc, char const* argv[])
+{
+    return hof_benchmark::run(argc, argv);
+}
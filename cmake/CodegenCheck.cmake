@@ -0,0 +1,64 @@
+# Checks the code generated for the `hof_<name>` functions in a library
+# against the `hand_<name>` functions. Each hof function must not reference
+# any symbol from `boost::hof`, which would be a call that was not inlined,
+# and it must not be larger than the hand-written function by more than
+# THRESHOLD bytes.
+#
+#     cmake -DNM=nm -DOBJDUMP=objdump -DLIBRARY=lib.a -DTHRESHOLD=16 -P CodegenCheck.cmake
+
+if(NOT THRESHOLD)
+    set(THRESHOLD 0)
+endif()
+
+execute_process(COMMAND ${NM} -C ${LIBRARY} OUTPUT_VARIABLE ALL_SYMBOLS RESULT_VARIABLE NM_RESULT)
+if(NOT NM_RESULT EQUAL 0)
+    message(FATAL_ERROR "Failed to run ${NM} on ${LIBRARY}")
+endif()
+execute_process(COMMAND ${NM} -S -t d --defined-only ${LIBRARY} OUTPUT_VARIABLE SIZED_SYMBOLS)
+
+string(REPLACE "\n" ";" ALL_SYMBOLS "${ALL_SYMBOLS}")
+string(REPLACE "\n" ";" SIZED_SYMBOLS "${SIZED_SYMBOLS}")
+
+set(FAILED Off)
+foreach(LINE ${ALL_SYMBOLS})
+    if(LINE MATCHES "boost::hof::")
+        message(SEND_ERROR "Residual reference to the library: ${LINE}")
+        set(FAILED On)
+    endif()
+endforeach()
+
+set(NAMES)
+foreach(LINE ${SIZED_SYMBOLS})
+    if(LINE MATCHES "^[0-9]+ ([0-9]+) [A-Za-z] _?(hof|hand)_([A-Za-z0-9_]+)$")
+        set(KIND ${CMAKE_MATCH_2})
+        set(NAME ${CMAKE_MATCH_3})
+        # Strip leading zeros so the size is not read as octal
+        string(REGEX REPLACE "^0+([0-9])" "\\1" SIZE_${KIND}_${NAME} "${CMAKE_MATCH_1}")
+        if(KIND STREQUAL "hof")
+            list(APPEND NAMES ${NAME})
+        endif()
+    endif()
+endforeach()
+
+if(NOT NAMES)
+    message(FATAL_ERROR "No hof_ functions found in ${LIBRARY}")
+endif()
+
+foreach(NAME ${NAMES})
+    if(NOT DEFINED SIZE_hand_${NAME})
+        message(SEND_ERROR "Missing hand_${NAME} for hof_${NAME}")
+        set(FAILED On)
+    else()
+        math(EXPR LIMIT "${SIZE_hand_${NAME}} + ${THRESHOLD}")
+        message(STATUS "${NAME}: hof ${SIZE_hof_${NAME}} bytes, hand ${SIZE_hand_${NAME}} bytes")
+        if(SIZE_hof_${NAME} GREATER LIMIT)
+            message(SEND_ERROR "hof_${NAME} is ${SIZE_hof_${NAME}} bytes, which is larger than hand_${NAME} (${SIZE_hand_${NAME}} bytes) by more than ${THRESHOLD} bytes")
+            set(FAILED On)
+        endif()
+    endif()
+endforeach()
+
+if(FAILED AND OBJDUMP)
+    execute_process(COMMAND ${OBJDUMP} -d -C ${LIBRARY} OUTPUT_VARIABLE DISASSEMBLY)
+    message("${DISASSEMBLY}")
+endif()
@@ -0,0 +1,25 @@
+# Builds and runs a program that calls the adaptors in a kernel, with a CUDA
+# or HIP compiler. The compiler is called directly, so the test doesn't need
+# the CUDA language support of cmake, and it needs a device to run.
+#
+#     cmake -DDEVICE_CXX=nvcc -DINCLUDE=include -DSOURCE=device.cpp -DBINARY_DIR=device -P DeviceCheck.cmake
+
+file(MAKE_DIRECTORY ${BINARY_DIR})
+
+get_filename_component(DEVICE_CXX_NAME ${DEVICE_CXX} NAME_WE)
+if(DEVICE_CXX_NAME STREQUAL "nvcc")
+    set(FLAGS -std=c++14 -x cu -I${INCLUDE})
+else()
+    set(FLAGS -std=c++14 -I${INCLUDE})
+endif()
+
+execute_process(COMMAND ${DEVICE_CXX} ${FLAGS} ${SOURCE} -o device
+    WORKING_DIRECTORY ${BINARY_DIR} RESULT_VARIABLE RESULT)
+if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "Failed to build ${SOURCE} with ${DEVICE_CXX}")
+endif()
+
+execute_process(COMMAND ${BINARY_DIR}/device RESULT_VARIABLE RESULT)
+if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "The adaptors called in device code didn't match the host")
+endif()
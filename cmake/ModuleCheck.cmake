@@ -0,0 +1,30 @@
+# Builds the module interface for `boost.hof`, and then builds and runs a
+# program that imports it. The compiler is called directly, since modules
+# can't be built by the minimum version of cmake, so only gcc is supported.
+#
+#     cmake -DCXX=g++ -DCXX_ID=GNU -DINCLUDE=include -DINTERFACE=hof.cppm -DSOURCE=module.cpp -DBINARY_DIR=module -P ModuleCheck.cmake
+
+file(MAKE_DIRECTORY ${BINARY_DIR})
+
+if(NOT CXX_ID STREQUAL "GNU")
+    message(FATAL_ERROR "The module can only be checked with gcc")
+endif()
+
+set(FLAGS -std=c++20 -fmodules-ts -fcoroutines -I${INCLUDE})
+
+execute_process(COMMAND ${CXX} ${FLAGS} -c -x c++ ${INTERFACE} -o hof.o
+    WORKING_DIRECTORY ${BINARY_DIR} RESULT_VARIABLE RESULT)
+if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "Failed to build the module interface ${INTERFACE}")
+endif()
+
+execute_process(COMMAND ${CXX} ${FLAGS} ${SOURCE} hof.o -o module
+    WORKING_DIRECTORY ${BINARY_DIR} RESULT_VARIABLE RESULT)
+if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "Failed to import the module in ${SOURCE}")
+endif()
+
+execute_process(COMMAND ${BINARY_DIR}/module RESULT_VARIABLE RESULT)
+if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "The program importing the module failed")
+endif()
@@ -31,6 +31,17 @@ void decrement_kindof(T& value)
     ));
 }
 
+// The same with static_if, which only instantiates the chosen lambda
+template<typename T>
+void increment_kindof(T& value)
+{
+    eval(static_if(std::is_same<std::string, T>())([&](auto id){
+        id(value).push_back('!');
+    })([&](auto id){
+        ++id(value);
+    }));
+}
+
 int main()
 {
     std::string s = "hello!";
@@ -40,4 +51,9 @@ int main()
     int i = 4;
     decrement_kindof(i);
     assert(i == 3);
+
+    increment_kindof(s);
+    assert(s == "hello!");
+    increment_kindof(i);
+    assert(i == 4);
 }
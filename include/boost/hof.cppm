@@ -0,0 +1,162 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    boost/hof.cppm
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+// The module interface for `import boost.hof;`. The standard headers are
+// included in the global module fragment first, so only the declarations
+// from the library are exported. The configuration macros must be the same
+// when building the module as when using it, and the macros, such as
+// BOOST_HOF_STATIC_FUNCTION and BOOST_HOF_RETURNS, are not exported.
+
+module;
+
+#include <boost/hof/config.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#if BOOST_HOF_HAS_COROUTINES
+#include <coroutine>
+#endif
+#if BOOST_HOF_HAS_STD_SPAN
+#include <span>
+#endif
+#if BOOST_HOF_HAS_STD_STRING_VIEW
+#include <string_view>
+#endif
+#if BOOST_HOF_HAS_STD_VARIANT
+#include <variant>
+#endif
+
+// gcc 12 crashes when writing the thread blocks used by traced, profiled
+// and per_thread, the current worker of work_stealing_executor and
+// numa_executor, and the last type of type_switch, to the module
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 13
+#define BOOST_HOF_DETAIL_MODULE_THREAD_BLOCKS 0
+#else
+#define BOOST_HOF_DETAIL_MODULE_THREAD_BLOCKS 1
+#endif
+
+export module boost.hof;
+
+export extern "C++" {
+
+#include <boost/hof/core.hpp>
+#include <boost/hof/adaptive_first_of.hpp>
+#include <boost/hof/async.hpp>
+#include <boost/hof/batch.hpp>
+#include <boost/hof/batched.hpp>
+#include <boost/hof/borrow.hpp>
+#include <boost/hof/capture.hpp>
+#include <boost/hof/co_compose.hpp>
+#include <boost/hof/co_flow.hpp>
+#include <boost/hof/co_task.hpp>
+#include <boost/hof/cold.hpp>
+#include <boost/hof/compose_optional.hpp>
+#include <boost/hof/contains.hpp>
+#include <boost/hof/counted_first_of.hpp>
+#include <boost/hof/cpu_dispatch.hpp>
+#include <boost/hof/describe.hpp>
+#include <boost/hof/erase_at.hpp>
+#include <boost/hof/executor.hpp>
+#include <boost/hof/fix_trampoline.hpp>
+#include <boost/hof/fixed_string.hpp>
+#include <boost/hof/flow_expected.hpp>
+#include <boost/hof/format_to.hpp>
+#include <boost/hof/function_ref.hpp>
+#include <boost/hof/fuse.hpp>
+#include <boost/hof/hash_of.hpp>
+#include <boost/hof/hedged.hpp>
+#include <boost/hof/indirect_hot_swap.hpp>
+#include <boost/hof/inplace_function.hpp>
+#include <boost/hof/keyed_sort.hpp>
+#include <boost/hof/lazy.hpp>
+#include <boost/hof/lazy_eager.hpp>
+#include <boost/hof/lexicographic.hpp>
+#include <boost/hof/make_table.hpp>
+#include <boost/hof/match_value.hpp>
+#include <boost/hof/memoize.hpp>
+#include <boost/hof/minmax.hpp>
+#include <boost/hof/pack_algorithm.hpp>
+#include <boost/hof/parallel_apply.hpp>
+#include <boost/hof/parallel_by.hpp>
+#include <boost/hof/parallel_combine.hpp>
+#include <boost/hof/parallel_fold.hpp>
+#include <boost/hof/partial_at.hpp>
+#include <boost/hof/pipeline.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <boost/hof/pool_allocator.hpp>
+#include <boost/hof/power.hpp>
+#include <boost/hof/proj_lazy.hpp>
+#include <boost/hof/record_view.hpp>
+#include <boost/hof/retry.hpp>
+#include <boost/hof/select_by_cost.hpp>
+#include <boost/hof/serialize.hpp>
+#include <boost/hof/signal.hpp>
+#include <boost/hof/state_machine.hpp>
+#include <boost/hof/std_sequences.hpp>
+#include <boost/hof/string_switch.hpp>
+#include <boost/hof/swappable.hpp>
+#include <boost/hof/synchronized.hpp>
+#include <boost/hof/tap_async.hpp>
+#include <boost/hof/thread_local.hpp>
+#include <boost/hof/thunk.hpp>
+#include <boost/hof/throttle.hpp>
+#include <boost/hof/to_function_pointer.hpp>
+#include <boost/hof/transducer.hpp>
+#include <boost/hof/static_if.hpp>
+#include <boost/hof/static_lazy.hpp>
+#include <boost/hof/static_vector.hpp>
+#include <boost/hof/tuple_filter.hpp>
+#include <boost/hof/tuple_for_each.hpp>
+#include <boost/hof/tuple_for_each_fused.hpp>
+#include <boost/hof/tuple_join.hpp>
+#include <boost/hof/tuple_transform.hpp>
+#include <boost/hof/tuple_zip_with.hpp>
+#include <boost/hof/unfold.hpp>
+#include <boost/hof/unpack_n.hpp>
+#include <boost/hof/visit.hpp>
+#include <boost/hof/zip_with.hpp>
+#if BOOST_HOF_DETAIL_MODULE_THREAD_BLOCKS || !BOOST_HOF_PROFILING
+#include <boost/hof/profiled.hpp>
+#endif
+#if BOOST_HOF_DETAIL_MODULE_THREAD_BLOCKS
+#include <boost/hof/traced.hpp>
+#include <boost/hof/per_thread.hpp>
+#include <boost/hof/type_switch.hpp>
+#include <boost/hof/work_stealing_executor.hpp>
+#include <boost/hof/numa_executor.hpp>
+#endif
+
+}
@@ -8,52 +8,145 @@
 #ifndef BOOST_HOF_GUARD_BOOST_HOF_HPP
 #define BOOST_HOF_GUARD_BOOST_HOF_HPP
 
+#include <boost/hof/adaptive_first_of.hpp>
 #include <boost/hof/alias.hpp>
 #include <boost/hof/always.hpp>
 #include <boost/hof/apply_eval.hpp>
 #include <boost/hof/apply.hpp>
 #include <boost/hof/arg.hpp>
+#include <boost/hof/async.hpp>
+#include <boost/hof/batch.hpp>
+#include <boost/hof/batched.hpp>
+#include <boost/hof/borrow.hpp>
 #include <boost/hof/proj.hpp>
+#include <boost/hof/proj_lazy.hpp>
 #include <boost/hof/capture.hpp>
+#include <boost/hof/co_compose.hpp>
+#include <boost/hof/co_flow.hpp>
+#include <boost/hof/co_task.hpp>
+#include <boost/hof/cold.hpp>
 #include <boost/hof/combine.hpp>
 #include <boost/hof/compose.hpp>
+#include <boost/hof/compose_optional.hpp>
 #include <boost/hof/fold.hpp>
 #include <boost/hof/first_of.hpp>
 #include <boost/hof/construct.hpp>
+#include <boost/hof/contains.hpp>
+#include <boost/hof/counted_first_of.hpp>
+#include <boost/hof/cpu_dispatch.hpp>
 #include <boost/hof/decay.hpp>
 #include <boost/hof/decorate.hpp>
+#include <boost/hof/describe.hpp>
+#include <boost/hof/dispatch_index.hpp>
+#include <boost/hof/drop.hpp>
+#include <boost/hof/erase_at.hpp>
 #include <boost/hof/eval.hpp>
+#include <boost/hof/executor.hpp>
+#include <boost/hof/extern_function.hpp>
+#include <boost/hof/filter.hpp>
 #include <boost/hof/fix.hpp>
+#include <boost/hof/fix_trampoline.hpp>
+#include <boost/hof/fixed_string.hpp>
+#include <boost/hof/fixed_view.hpp>
 #include <boost/hof/flip.hpp>
 #include <boost/hof/flow.hpp>
+#include <boost/hof/flow_expected.hpp>
+#include <boost/hof/fold_into.hpp>
+#include <boost/hof/format_to.hpp>
 #include <boost/hof/function.hpp>
+#include <boost/hof/function_ref.hpp>
+#include <boost/hof/fuse.hpp>
+#include <boost/hof/hash_of.hpp>
+#include <boost/hof/hedged.hpp>
 #include <boost/hof/identity.hpp>
 #include <boost/hof/if.hpp>
 #include <boost/hof/implicit.hpp>
 #include <boost/hof/indirect.hpp>
+#include <boost/hof/indirect_hot_swap.hpp>
+#include <boost/hof/inplace_function.hpp>
 #include <boost/hof/infix.hpp>
+#include <boost/hof/is_associative.hpp>
+#include <boost/hof/is_commutative.hpp>
 #include <boost/hof/is_invocable.hpp>
+#include <boost/hof/is_trivially_relocatable.hpp>
+#include <boost/hof/keyed_sort.hpp>
 #include <boost/hof/lambda.hpp>
 #include <boost/hof/lazy.hpp>
+#include <boost/hof/lazy_eager.hpp>
+#include <boost/hof/lexicographic.hpp>
 #include <boost/hof/lift.hpp>
 #include <boost/hof/limit.hpp>
+#include <boost/hof/make_table.hpp>
+#include <boost/hof/map.hpp>
 #include <boost/hof/match.hpp>
+#include <boost/hof/match_value.hpp>
+#include <boost/hof/memoize.hpp>
+#include <boost/hof/minmax.hpp>
 #include <boost/hof/mutable.hpp>
+#include <boost/hof/numa_executor.hpp>
 #include <boost/hof/pack.hpp>
+#include <boost/hof/pack_algorithm.hpp>
+#include <boost/hof/parallel_apply.hpp>
+#include <boost/hof/parallel_by.hpp>
+#include <boost/hof/parallel_combine.hpp>
+#include <boost/hof/parallel_fold.hpp>
 #include <boost/hof/partial.hpp>
+#include <boost/hof/partial_at.hpp>
+#include <boost/hof/per_thread.hpp>
+#include <boost/hof/permute.hpp>
+#include <boost/hof/pipeline.hpp>
 #include <boost/hof/pipable.hpp>
 #include <boost/hof/placeholders.hpp>
+#include <boost/hof/pool_allocator.hpp>
+#include <boost/hof/power.hpp>
+#include <boost/hof/profiled.hpp>
 #include <boost/hof/protect.hpp>
+#include <boost/hof/record_view.hpp>
 #include <boost/hof/repeat.hpp>
 #include <boost/hof/repeat_while.hpp>
+#include <boost/hof/repeat_while_step.hpp>
 #include <boost/hof/result.hpp>
+#include <boost/hof/retry.hpp>
+#include <boost/hof/type_switch.hpp>
+#include <boost/hof/typed.hpp>
 #include <boost/hof/returns.hpp>
 #include <boost/hof/reveal.hpp>
 #include <boost/hof/reverse_fold.hpp>
 #include <boost/hof/rotate.hpp>
+#include <boost/hof/select.hpp>
+#include <boost/hof/select_by_cost.hpp>
+#include <boost/hof/serialize.hpp>
+#include <boost/hof/signal.hpp>
+#include <boost/hof/state_machine.hpp>
 #include <boost/hof/static.hpp>
+#include <boost/hof/static_if.hpp>
+#include <boost/hof/static_lazy.hpp>
+#include <boost/hof/static_vector.hpp>
+#include <boost/hof/std_sequences.hpp>
+#include <boost/hof/string_switch.hpp>
+#include <boost/hof/swappable.hpp>
+#include <boost/hof/synchronized.hpp>
 #include <boost/hof/tap.hpp>
+#include <boost/hof/tap_async.hpp>
+#include <boost/hof/thread_local.hpp>
+#include <boost/hof/thunk.hpp>
+#include <boost/hof/throttle.hpp>
+#include <boost/hof/to_function_pointer.hpp>
+#include <boost/hof/traced.hpp>
+#include <boost/hof/transducer.hpp>
+#include <boost/hof/tree_fold.hpp>
+#include <boost/hof/tuple_filter.hpp>
+#include <boost/hof/tuple_for_each.hpp>
+#include <boost/hof/tuple_for_each_fused.hpp>
+#include <boost/hof/tuple_join.hpp>
+#include <boost/hof/tuple_transform.hpp>
+#include <boost/hof/tuple_zip_with.hpp>
+#include <boost/hof/unfold.hpp>
 #include <boost/hof/unpack.hpp>
+#include <boost/hof/unpack_n.hpp>
+#include <boost/hof/visit.hpp>
+#include <boost/hof/work_stealing_executor.hpp>
+#include <boost/hof/zip_with.hpp>
 
 
 namespace boost { namespace hof {
@@ -0,0 +1,329 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    adaptive_first_of.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_ADAPTIVE_FIRST_OF_H
+#define BOOST_HOF_GUARD_ADAPTIVE_FIRST_OF_H
+
+/// adaptive_first_of
+/// =================
+///
+/// Description
+/// -----------
+///
+/// The `adaptive_first_of` function adaptor chooses a function by predicates
+/// that are checked at runtime, such as the rules of a packet classifier.
+/// Each alternative is a `probe`, which pairs a predicate with the function
+/// that is called when the predicate is true for the arguments, and the last
+/// function is called when none of the predicates are true.
+///
+/// The probes are tried in an order that is kept by the adaptor, and each
+/// probe counts the calls where it matched. Every `period` calls, which is
+/// 1024 by default, the order is sorted by the counts, so the probes that
+/// match the most are tried first, and then the counts are halved, so the
+/// order follows a change in the distribution of the arguments. The order
+/// is a permutation of at most 16 probes that is packed in a single atomic
+/// word, so a call loads it once, and the counts are relaxed atomic
+/// increments, so the adaptor can be called from several threads. The
+/// counts and the calls are split in shards, each on its own cache line, so
+/// the threads that call the adaptor at the same time mostly increment
+/// different cache lines. The calls are counted for each shard, so with
+/// several threads the order is sorted every `period` calls of a shard.
+///
+/// Since the order changes, the predicates should not be true for the same
+/// arguments, otherwise the function that is called can change. When the
+/// period is set to 0, the order is only sorted when `reorder` is called,
+/// so the calls are deterministic, which is useful for testing.
+///
+/// Synopsis
+/// --------
+///
+///     template<class P, class F>
+///     constexpr probe_adaptor<P, F> probe(P p, F f);
+///
+///     template<class... Fs>
+///     adaptive_first_of_adaptor<Fs...> adaptive_first_of(Fs... fs);
+///
+///     template<class... Fs>
+///     struct adaptive_first_of_adaptor
+///     {
+///         void reorder() const;
+///         void set_period(std::size_t n) const;
+///         std::array<std::size_t, sizeof...(Fs) - 1> order() const;
+///         std::array<std::size_t, sizeof...(Fs) - 1> hits() const;
+///     };
+///
+/// Semantics
+/// ---------
+///
+///     assert(adaptive_first_of(probe(p, f), g)(xs...) == (p(xs...) ? f(xs...) : g(xs...)));
+///
+/// Requirements
+/// ------------
+///
+/// P must be:
+///
+/// * [ConstInvocable](ConstInvocable) returning a value that converts to `bool`
+/// * MoveConstructible
+///
+/// Fs must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int main() {
+///         auto classify = boost::hof::adaptive_first_of(
+///             boost::hof::probe(boost::hof::_ == 6, [](int) { return 1; }),
+///             boost::hof::probe(boost::hof::_ == 17, [](int) { return 2; }),
+///             [](int) { return 0; }
+///         );
+///         classify.set_period(0);
+///         for (int i = 0; i < 10; i++) classify(17);
+///         classify.reorder();
+///         assert(classify.order()[0] == 1);
+///         assert(classify(6) == 1);
+///         assert(classify(1) == 0);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [first_of](first_of)
+/// * [counted_first_of](counted_first_of)
+/// * [dispatch_index](dispatch_index)
+///
+
+#include <boost/hof/dispatch_index.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/sharded_counter.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/detail/type_at.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+template<class P, class F>
+struct probe_adaptor
+: detail::compressed_pair<detail::callable_base<P>, detail::callable_base<F>>
+{
+    typedef detail::compressed_pair<detail::callable_base<P>, detail::callable_base<F>> base_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(probe_adaptor, base_type)
+
+    template<class... Ts>
+    constexpr bool test(Ts&&... xs) const
+    {
+        return bool(this->first(xs...)(xs...));
+    }
+
+    template<class... Ts>
+    constexpr auto operator()(Ts&&... xs) const
+    -> decltype(std::declval<const detail::callable_base<F>&>()(BOOST_HOF_FORWARD(Ts)(xs)...))
+    {
+        return this->second(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+template<class P, class F>
+constexpr probe_adaptor<P, F> probe(P p, F f)
+{
+    return probe_adaptor<P, F>(static_cast<P&&>(p), static_cast<F&&>(f));
+}
+
+namespace detail {
+
+template<class P, class F, class... Ts>
+bool adaptive_probe_test(const probe_adaptor<P, F>& p, Ts&... xs)
+{
+    return p.test(xs...);
+}
+
+// A function that isn't a probe always matches
+template<class F, class... Ts>
+bool adaptive_probe_test(const F&, Ts&...)
+{
+    return true;
+}
+
+// The order of the probes, with 4 bits for each probe
+template<std::size_t N>
+struct adaptive_order
+{
+    static_assert(N <= 16, "At most 16 probes can be reordered");
+
+    static constexpr std::uint64_t identity(std::size_t i=0)
+    {
+        return i == N ? 0 : (std::uint64_t(i) << (4 * i)) | identity(i + 1);
+    }
+
+    static std::size_t at(std::uint64_t order, std::size_t i) noexcept
+    {
+        return std::size_t((order >> (4 * i)) & 0xF);
+    }
+};
+
+template<class S, class... Fs>
+struct adaptive_first_of_adaptor_base;
+
+template<std::size_t... Ns, class... Fs>
+struct adaptive_first_of_adaptor_base<seq<Ns...>, Fs...>
+: pack_base<seq<Ns...>, callable_base<Fs>...>
+{
+    typedef pack_base<seq<Ns...>, callable_base<Fs>...> base_type;
+    // The last function is the fallback
+    static const std::size_t probes = sizeof...(Fs) - 1;
+    typedef adaptive_order<probes> order_type;
+    typedef std::array<std::size_t, probes> stats_type;
+
+    mutable std::atomic<std::uint64_t> order_word;
+    mutable detail::sharded_counter<probes> counters;
+    mutable detail::sharded_counter<1> calls;
+    // Only written by set_period, so it is shared without contention
+    mutable std::atomic<std::uint32_t> period;
+
+    constexpr adaptive_first_of_adaptor_base(Fs... fs)
+    : base_type(static_cast<Fs&&>(fs)...), order_word(order_type::identity()), counters(), calls(), period(1024)
+    {}
+
+    // A copy starts with the order and the counts it was copied from
+    adaptive_first_of_adaptor_base(const adaptive_first_of_adaptor_base& rhs)
+    : base_type(static_cast<const base_type&>(rhs)), order_word(rhs.order_word.load(std::memory_order_relaxed)), counters(rhs.counters),
+      calls(), period(rhs.period.load(std::memory_order_relaxed))
+    {}
+
+    template<std::size_t I, class... Ts>
+    constexpr const callable_base<typename type_at<I, Fs...>::type>& get(Ts&&... xs) const noexcept
+    {
+        return boost::hof::alias_value<pack_tag<seq<I>, callable_base<Fs>...>, callable_base<typename type_at<I, Fs...>::type>>(*this, xs...);
+    }
+
+    template<std::size_t I, class... Ts>
+    static bool test(const adaptive_first_of_adaptor_base& self, Ts&... xs)
+    {
+        return detail::adaptive_probe_test(self.template get<I>(xs...), xs...);
+    }
+
+    template<std::size_t I, class R, class... Ts>
+    static R call(const adaptive_first_of_adaptor_base& self, Ts&&... xs)
+    {
+        return self.template get<I>(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+
+    void tick() const
+    {
+        std::uint32_t p = period.load(std::memory_order_relaxed);
+        if (p != 0 && calls.add(0) % p == 0) this->reorder();
+    }
+
+    // Sorts the probes by their counts, keeping the current order of the
+    // probes with the same count, and then halves the counts
+    void reorder() const
+    {
+        std::uint64_t current = order_word.load(std::memory_order_relaxed);
+        std::size_t index[probes == 0 ? 1 : probes];
+        std::uint64_t hit[probes == 0 ? 1 : probes];
+        for (std::size_t i = 0; i < probes; i++)
+        {
+            index[i] = order_type::at(current, i);
+            hit[i] = counters.load(index[i]);
+        }
+        for (std::size_t i = 1; i < probes; i++)
+        {
+            std::size_t x = index[i];
+            std::uint64_t h = hit[i];
+            std::size_t j = i;
+            for (; j > 0 && hit[j - 1] < h; j--)
+            {
+                index[j] = index[j - 1];
+                hit[j] = hit[j - 1];
+            }
+            index[j] = x;
+            hit[j] = h;
+        }
+        std::uint64_t next = 0;
+        for (std::size_t i = 0; i < probes; i++) next |= std::uint64_t(index[i]) << (4 * i);
+        order_word.store(next, std::memory_order_relaxed);
+        counters.halve();
+    }
+
+    void set_period(std::size_t n) const noexcept
+    {
+        period.store(std::uint32_t(n), std::memory_order_relaxed);
+    }
+
+    stats_type order() const noexcept
+    {
+        std::uint64_t current = order_word.load(std::memory_order_relaxed);
+        stats_type r;
+        for (std::size_t i = 0; i < probes; i++) r[i] = order_type::at(current, i);
+        return r;
+    }
+
+    stats_type hits() const noexcept
+    {
+        stats_type r;
+        for (std::size_t i = 0; i < probes; i++) r[i] = std::size_t(counters.load(i));
+        return r;
+    }
+
+    template<class... Ts, class R=typename dispatch_index_result<
+        decltype(std::declval<const callable_base<Fs>&>()(std::declval<Ts>()...))...
+    >::type>
+    R operator()(Ts&&... xs) const
+    {
+        typedef bool (*test_type)(const adaptive_first_of_adaptor_base&, Ts&...);
+        typedef R (*call_type)(const adaptive_first_of_adaptor_base&, Ts&&...);
+        static constexpr test_type tests[] = { &adaptive_first_of_adaptor_base::template test<Ns, Ts...>... };
+        static constexpr call_type entries[] = { &adaptive_first_of_adaptor_base::template call<Ns, R, Ts...>... };
+        std::uint64_t current = order_word.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < probes; i++)
+        {
+            std::size_t k = order_type::at(current, i);
+            if (tests[k](*this, xs...))
+            {
+                counters.add(k);
+                this->tick();
+                return entries[k](*this, BOOST_HOF_FORWARD(Ts)(xs)...);
+            }
+        }
+        this->tick();
+        return entries[probes](*this, BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+}
+
+template<class... Fs>
+struct adaptive_first_of_adaptor
+: detail::adaptive_first_of_adaptor_base<typename detail::gens<sizeof...(Fs)>::type, Fs...>
+{
+    static_assert(sizeof...(Fs) > 0, "The fallback function is required");
+
+    typedef detail::adaptive_first_of_adaptor_base<typename detail::gens<sizeof...(Fs)>::type, Fs...> base_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(adaptive_first_of_adaptor, base_type)
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(adaptive_first_of, detail::make<adaptive_first_of_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
@@ -79,13 +79,13 @@ struct has_tag<T, Tag, typename detail::holder<
 namespace detail {
 
 template<class T>
-constexpr T& lvalue(T& x) noexcept
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INTRINSIC constexpr T& lvalue(T& x) noexcept
 {
     return x;
 }
 
 template<class T>
-constexpr const T& lvalue(const T& x) noexcept
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INTRINSIC constexpr const T& lvalue(const T& x) noexcept
 {
     return x;
 }
@@ -100,13 +100,13 @@ constexpr const T& lvalue(const T& x) noexcept
 template<class T, class Tag=void>
 struct alias
 {
-    T value;
+    BOOST_HOF_NO_UNIQUE_ADDRESS T value;
     BOOST_HOF_DELEGATE_CONSTRUCTOR(alias, T, value)
 };
 
 #define BOOST_HOF_DETAIL_ALIAS_GET_VALUE(ref, move) \
 template<class Tag, class T, class... Ts> \
-constexpr auto alias_value(alias<T, Tag> ref a, Ts&&...) BOOST_HOF_RETURNS(move(a.value))
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto alias_value(alias<T, Tag> ref a, Ts&&...) BOOST_HOF_RETURNS(move(a.value))
 BOOST_HOF_UNARY_PERFECT_FOREACH(BOOST_HOF_DETAIL_ALIAS_GET_VALUE)
 
 template<class T, class Tag>
@@ -127,7 +127,7 @@ struct alias_inherit
 
 #define BOOST_HOF_DETAIL_ALIAS_INHERIT_GET_VALUE(ref, move) \
 template<class Tag, class T, class... Ts, class=typename std::enable_if<(BOOST_HOF_IS_CLASS(T))>::type> \
-constexpr T ref alias_value(alias_inherit<T, Tag> ref a, Ts&&...) BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(move(a)) \
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr T ref alias_value(alias_inherit<T, Tag> ref a, Ts&&...) BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(move(a)) \
 { \
     return move(a); \
 }
@@ -163,12 +163,12 @@ template<class T, class Tag=void>
 struct alias_static
 {
     template<class... Ts, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(T, Ts...)>
-    constexpr alias_static(Ts&&...) noexcept
+    BOOST_HOF_HOST_DEVICE constexpr alias_static(Ts&&...) noexcept
     {}
 };
 
 template<class Tag, class T, class... Ts>
-constexpr const T& alias_value(const alias_static<T, Tag>&, Ts&&...) noexcept
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr const T& alias_value(const alias_static<T, Tag>&, Ts&&...) noexcept
 {
     return detail::alias_static_storage<T, Tag>::value;
 }
@@ -187,21 +187,40 @@ struct alias_try_inherit
 >
 {};
 
-#if BOOST_HOF_HAS_EBO
+template<class T>
+struct is_static_alias
+: std::integral_constant<bool, (
+    BOOST_HOF_IS_EMPTY(T) && 
+    BOOST_HOF_IS_LITERAL(T) && 
+    BOOST_HOF_IS_DEFAULT_CONSTRUCTIBLE(T)
+)>
+{};
+
+// An empty function that is stored statically isn't a base, so it can't
+// collide with the same function nested in another member, and it needs no
+// adjustment of `this` to be called
+template<class T, class Tag>
+struct alias_try_static
+: std::conditional<(is_static_alias<T>::value), 
+    alias_static<T, Tag>, 
+    typename alias_try_inherit<T, Tag>::type
+>
+{};
+
+// With no_unique_address, the empty types that can't be stored statically
+// are members that take no space, so they aren't inherited either
+#if BOOST_HOF_HAS_EBO && !BOOST_HOF_HAS_NO_UNIQUE_ADDRESS
 template<class T, class Tag>
 struct alias_empty
 : std::conditional<(BOOST_HOF_IS_EMPTY(T)), 
-    typename alias_try_inherit<T, Tag>::type, 
+    typename alias_try_static<T, Tag>::type, 
     alias<T, Tag>
 >
 {};
 #else
 template<class T, class Tag>
 struct alias_empty
-: std::conditional<
-        BOOST_HOF_IS_EMPTY(T) && 
-        BOOST_HOF_IS_LITERAL(T) && 
-        BOOST_HOF_IS_DEFAULT_CONSTRUCTIBLE(T),
+: std::conditional<(is_static_alias<T>::value),
     alias_static<T, Tag>,
     alias<T, Tag>
 >
@@ -25,6 +25,14 @@
 /// `void`, a private empty type is returned instead. This return type is
 /// specified as `BOOST_HOF_ALWAYS_VOID_RETURN`.
 /// 
+/// The value is copied every time the function object is called. To avoid
+/// the copies, `always_ref` returns a reference to an lvalue that the caller
+/// keeps alive, and `always_shared` stores the value once and returns a
+/// `const` reference to it, which lives as long as the function object.
+/// Finally, `always_static` returns a reference to an object with static
+/// storage, so it can be used in constant expressions when the object is
+/// `constexpr`.
+/// 
 /// Synopsis
 /// --------
 /// 
@@ -34,11 +42,23 @@
 ///     template<class T>
 ///     constexpr auto always(void);
 /// 
+///     template<class T>
+///     constexpr auto always_ref(T& value);
+/// 
+///     template<class T>
+///     constexpr auto always_shared(T value);
+/// 
+///     template<class T, const T& Value>
+///     constexpr auto always_static;
+/// 
 /// 
 /// Semantics
 /// ---------
 /// 
 ///     assert(always(x)(xs...) == x);
+///     assert(&always_ref(x)(xs...) == &x);
+///     assert(always_shared(x)(xs...) == x);
+///     assert(&always_static<T, value>(xs...) == &value);
 /// 
 /// Requirements
 /// ------------
@@ -47,6 +67,8 @@
 /// 
 /// * CopyConstructible
 /// 
+/// For `always_shared`, T must only be MoveConstructible.
+/// 
 /// Example
 /// -------
 /// 
@@ -89,7 +111,7 @@ struct always_base
     typedef typename detail::unwrap_reference<T>::type result_type;
 
     template<class... As>
-    constexpr result_type
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr result_type
     operator()(As&&...) const
     noexcept(std::is_reference<result_type>::value || BOOST_HOF_IS_NOTHROW_COPY_CONSTRUCTIBLE(result_type))
     {
@@ -102,14 +124,14 @@ struct always_base<T, typename std::enable_if<!BOOST_HOF_IS_EMPTY(T)>::type>
 {
     T x;
 
-    constexpr always_base(T xp) noexcept(BOOST_HOF_IS_NOTHROW_COPY_CONSTRUCTIBLE(T))
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr always_base(T xp) noexcept(BOOST_HOF_IS_NOTHROW_COPY_CONSTRUCTIBLE(T))
     : x(xp)
     {}
 
     typedef typename detail::unwrap_reference<T>::type result_type;
 
     template<class... As>
-    constexpr result_type 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr result_type 
     operator()(As&&...) const 
     noexcept(std::is_reference<result_type>::value || BOOST_HOF_IS_NOTHROW_COPY_CONSTRUCTIBLE(result_type))
     {
@@ -127,13 +149,13 @@ template<>
 struct always_base<void>
 {
     
-    constexpr always_base() noexcept
+    BOOST_HOF_HOST_DEVICE constexpr always_base() noexcept
     {}
 
     struct void_ {};
 
     template<class... As>
-    constexpr BOOST_HOF_ALWAYS_VOID_RETURN 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_ALWAYS_VOID_RETURN 
     operator()(As&&...) const noexcept
     {
 #if BOOST_HOF_NO_CONSTEXPR_VOID
@@ -142,15 +164,50 @@ struct always_base<void>
     }
 };
 
+template<class T>
+struct always_shared_base
+{
+    T x;
+
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr always_shared_base(T&& xp) noexcept(BOOST_HOF_IS_NOTHROW_MOVE_CONSTRUCTIBLE(T))
+    : x(static_cast<T&&>(xp))
+    {}
+
+    typedef const T& result_type;
+
+    template<class... As>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr result_type
+    operator()(As&&...) const noexcept
+    {
+        return this->x;
+    }
+};
+
+template<class T, const T& Value>
+struct always_static_base
+{
+    BOOST_HOF_HOST_DEVICE constexpr always_static_base() noexcept
+    {}
+
+    typedef const T& result_type;
+
+    template<class... As>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr result_type
+    operator()(As&&...) const noexcept
+    {
+        return Value;
+    }
+};
+
 struct always_f
 {
     template<class T>
-    constexpr always_detail::always_base<T> operator()(T x) const noexcept(BOOST_HOF_IS_NOTHROW_COPY_CONSTRUCTIBLE(T))
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr always_detail::always_base<T> operator()(T x) const noexcept(BOOST_HOF_IS_NOTHROW_COPY_CONSTRUCTIBLE(T))
     {
         return always_detail::always_base<T>(x);
     }
 
-    constexpr always_detail::always_base<void> operator()() const noexcept
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr always_detail::always_base<void> operator()() const noexcept
     {
         return always_detail::always_base<void>();
     }
@@ -159,15 +216,44 @@ struct always_f
 struct always_ref_f
 {
     template<class T>
-    constexpr always_detail::always_base<T&> operator()(T& x) const noexcept
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr always_detail::always_base<T&> operator()(T& x) const noexcept
     {
         return always_detail::always_base<T&>(x);
     }
 };
 
+struct always_shared_f
+{
+    template<class T>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr always_detail::always_shared_base<T> operator()(T x) const noexcept(BOOST_HOF_IS_NOTHROW_MOVE_CONSTRUCTIBLE(T))
+    {
+        return always_detail::always_shared_base<T>(static_cast<T&&>(x));
+    }
+};
+
 }
 BOOST_HOF_DECLARE_STATIC_VAR(always, always_detail::always_f);
 BOOST_HOF_DECLARE_STATIC_VAR(always_ref, always_detail::always_ref_f);
+BOOST_HOF_DECLARE_STATIC_VAR(always_shared, always_detail::always_shared_f);
+
+// The reference to `*this` returned by the getters for the base classes,
+// where the parameters are only used to make it dependent
+#if BOOST_HOF_HAS_DIRECT_BASE_ACCESS
+#define BOOST_HOF_DETAIL_THIS_REF(xs) (static_cast<void>(sizeof...(xs)), *this)
+#else
+#define BOOST_HOF_DETAIL_THIS_REF(xs) BOOST_HOF_DETAIL_THIS_REF(xs)
+#endif
+
+#if BOOST_HOF_HAS_VARIABLE_TEMPLATES
+template<class T, const T& Value>
+BOOST_HOF_STATIC_CONSTEXPR always_detail::always_static_base<T, Value> always_static = {};
+#else
+template<class T, const T& Value, class... Ts>
+BOOST_HOF_HOST_DEVICE constexpr const T& always_static(Ts&&...) noexcept
+{
+    return Value;
+}
+#endif
 
 }} // namespace boost::hof
 
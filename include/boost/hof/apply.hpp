@@ -57,6 +57,7 @@
 
 #include <boost/hof/detail/result_of.hpp>
 #include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/reference_wrapper.hpp>
 #include <boost/hof/detail/static_const_var.hpp>
 
 #ifdef _MSC_VER
@@ -108,7 +109,7 @@ struct apply_mem_fn
         is_compatible<Derived, cv Base>, \
         is_convertible_args<convertible_args<Us...>, convertible_args<Ts...>> \
     >::value>::type> \
-    constexpr R operator()(R (Base::*mf)(Ts...) cv, Derived&& ref, Us &&... xs) const \
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr R operator()(R (Base::*mf)(Ts...) cv, Derived&& ref, Us &&... xs) const \
     BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT((BOOST_HOF_FORWARD(Derived)(ref).*mf)(BOOST_HOF_FORWARD(Us)(xs)...)) \
     { \
         return (BOOST_HOF_FORWARD(Derived)(ref).*mf)(BOOST_HOF_FORWARD(Us)(xs)...); \
@@ -134,7 +135,7 @@ struct apply_mem_data
     template <class Base, class R, class Derived, class=typename std::enable_if<(
         std::is_base_of<Base, typename std::decay<Derived>::type>::value
     )>::type>
-    constexpr typename match_qualifier<Derived, R>::type 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr typename match_qualifier<Derived, R>::type 
     operator()(R Base::*pmd, Derived&& ref) const noexcept
     {
         return BOOST_HOF_FORWARD(Derived)(ref).*pmd;
@@ -153,7 +154,7 @@ struct apply_f
     template<class F, class T, class... Ts, class=typename std::enable_if<(
         std::is_member_function_pointer<typename std::decay<F>::type>::value
     )>::type>
-    constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(apply_mem_fn, id_<F>, id_<T>, id_<Ts>...) 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(apply_mem_fn, id_<F>, id_<T>, id_<Ts>...) 
     operator()(F&& f, T&& obj, Ts&&... xs) const BOOST_HOF_SFINAE_MANUAL_RETURNS
     (
         apply_mem_fn()(f, BOOST_HOF_FORWARD(T)(obj), BOOST_HOF_FORWARD(Ts)(xs)...)
@@ -162,7 +163,7 @@ struct apply_f
     template<class F, class T, class... Ts, class U=typename apply_deref<T>::type, class=typename std::enable_if<(
         std::is_member_function_pointer<typename std::decay<F>::type>::value
     )>::type>
-    constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(apply_mem_fn, id_<F>, id_<U>, id_<Ts>...) 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(apply_mem_fn, id_<F>, id_<U>, id_<Ts>...) 
     operator()(F&& f, T&& obj, Ts&&... xs) const BOOST_HOF_SFINAE_MANUAL_RETURNS
     (
         apply_mem_fn()(f, *BOOST_HOF_FORWARD(T)(obj), BOOST_HOF_FORWARD(Ts)(xs)...)
@@ -171,7 +172,7 @@ struct apply_f
     template<class F, class T, class... Ts, class=typename std::enable_if<(
         std::is_member_function_pointer<typename std::decay<F>::type>::value
     )>::type>
-    constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(apply_mem_fn, id_<F>, id_<T&>, id_<Ts>...) 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(apply_mem_fn, id_<F>, id_<T&>, id_<Ts>...) 
     operator()(F&& f, const std::reference_wrapper<T>& ref, Ts&&... xs) const BOOST_HOF_SFINAE_MANUAL_RETURNS
     (
         apply_mem_fn()(f, ref.get(), BOOST_HOF_FORWARD(Ts)(xs)...)
@@ -180,7 +181,7 @@ struct apply_f
     template<class F, class T, class=typename std::enable_if<(
         std::is_member_object_pointer<typename std::decay<F>::type>::value
     )>::type>
-    constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(apply_mem_data, id_<F>, id_<T>) 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(apply_mem_data, id_<F>, id_<T>) 
     operator()(F&& f, T&& obj) const BOOST_HOF_SFINAE_MANUAL_RETURNS
     (
         apply_mem_data()(f, BOOST_HOF_FORWARD(T)(obj))
@@ -189,7 +190,7 @@ struct apply_f
     template<class F, class T, class U=typename apply_deref<T>::type, class=typename std::enable_if<(
         std::is_member_object_pointer<typename std::decay<F>::type>::value
     )>::type>
-    constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(apply_mem_data, id_<F>, id_<U>) 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(apply_mem_data, id_<F>, id_<U>) 
     operator()(F&& f, T&& obj) const BOOST_HOF_SFINAE_MANUAL_RETURNS
     (
         apply_mem_data()(f, *BOOST_HOF_FORWARD(T)(obj))
@@ -198,7 +199,7 @@ struct apply_f
     template<class F, class T, class=typename std::enable_if<(
         std::is_member_object_pointer<typename std::decay<F>::type>::value
     )>::type>
-    constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(apply_mem_data, id_<F>, id_<T&>) 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(apply_mem_data, id_<F>, id_<T&>) 
     operator()(F&& f, const std::reference_wrapper<T>& ref) const BOOST_HOF_SFINAE_MANUAL_RETURNS
     (
         apply_mem_data()(f, ref.get())
@@ -207,32 +208,32 @@ struct apply_f
 #else
 
     template <class Base, class T, class Derived>
-    constexpr auto operator()(T Base::*pmd, Derived&& ref) const
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(T Base::*pmd, Derived&& ref) const
     BOOST_HOF_RETURNS(BOOST_HOF_FORWARD(Derived)(ref).*pmd);
      
     template <class PMD, class Pointer>
-    constexpr auto operator()(PMD&& pmd, Pointer&& ptr) const
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(PMD&& pmd, Pointer&& ptr) const
     BOOST_HOF_RETURNS((*BOOST_HOF_FORWARD(Pointer)(ptr)).*BOOST_HOF_FORWARD(PMD)(pmd));
 
     template <class Base, class T, class Derived>
-    constexpr auto operator()(T Base::*pmd, const std::reference_wrapper<Derived>& ref) const
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(T Base::*pmd, const std::reference_wrapper<Derived>& ref) const
     BOOST_HOF_RETURNS(ref.get().*pmd);
      
     template <class Base, class T, class Derived, class... Args>
-    constexpr auto operator()(T Base::*pmf, Derived&& ref, Args&&... args) const
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(T Base::*pmf, Derived&& ref, Args&&... args) const
     BOOST_HOF_RETURNS((BOOST_HOF_FORWARD(Derived)(ref).*pmf)(BOOST_HOF_FORWARD(Args)(args)...));
      
     template <class PMF, class Pointer, class... Args>
-    constexpr auto operator()(PMF&& pmf, Pointer&& ptr, Args&&... args) const
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(PMF&& pmf, Pointer&& ptr, Args&&... args) const
     BOOST_HOF_RETURNS(((*BOOST_HOF_FORWARD(Pointer)(ptr)).*BOOST_HOF_FORWARD(PMF)(pmf))(BOOST_HOF_FORWARD(Args)(args)...));
 
     template <class Base, class T, class Derived, class... Args>
-    constexpr auto operator()(T Base::*pmf, const std::reference_wrapper<Derived>& ref, Args&&... args) const
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(T Base::*pmf, const std::reference_wrapper<Derived>& ref, Args&&... args) const
     BOOST_HOF_RETURNS((ref.get().*pmf)(BOOST_HOF_FORWARD(Args)(args)...));
 
 #endif
     template<class F, class... Ts>
-    constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(F, id_<Ts>...) 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(F, id_<Ts>...) 
     operator()(F&& f, Ts&&... xs) const BOOST_HOF_SFINAE_MANUAL_RETURNS
     (
         f(BOOST_HOF_FORWARD(Ts)(xs)...)
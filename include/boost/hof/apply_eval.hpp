@@ -67,8 +67,9 @@
 #include <boost/hof/apply.hpp>
 #include <boost/hof/eval.hpp>
 
-#if BOOST_HOF_NO_ORDERED_BRACE_INIT
 #include <boost/hof/pack.hpp>
+
+#if BOOST_HOF_NO_ORDERED_BRACE_INIT
 #include <boost/hof/capture.hpp>
 #endif
 
@@ -78,34 +79,37 @@ namespace detail {
 
 #if BOOST_HOF_NO_ORDERED_BRACE_INIT
 template<class R, class F, class Pack>
-constexpr R eval_ordered(const F& f, Pack&& p)
+BOOST_HOF_HOST_DEVICE constexpr R eval_ordered(const F& f, Pack&& p)
 {
     return p(f);
 }
 
 template<class R, class F, class Pack, class T, class... Ts>
-constexpr R eval_ordered(const F& f, Pack&& p, T&& x, Ts&&... xs)
+BOOST_HOF_HOST_DEVICE constexpr R eval_ordered(const F& f, Pack&& p, T&& x, Ts&&... xs)
 {
     return boost::hof::detail::eval_ordered<R>(f, boost::hof::pack_join(BOOST_HOF_FORWARD(Pack)(p), boost::hof::pack_forward(boost::hof::eval(x))), BOOST_HOF_FORWARD(Ts)(xs)...);
 }
 #else
-template<class R>
-struct eval_helper
+template<class F>
+struct eval_apply
 {
-    R result;
+    const F& f;
 
-    template<class F, class... Ts>
-    constexpr eval_helper(const F& f, Ts&&... xs) : result(boost::hof::apply(f, BOOST_HOF_FORWARD(Ts)(xs)...))
-    {}
+    template<class... Ts>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        boost::hof::apply(f, BOOST_HOF_FORWARD(Ts)(xs)...)
+    );
 };
 
-template<>
-struct eval_helper<void>
+// The arguments are evaluated in order by the braced initialization of a pack
+// that refers to them. The function is then called from the pack, so its
+// result is returned directly, instead of being stored in a helper and moved
+// out of it, and with guaranteed copy elision it isn't moved at all.
+template<class... Ts>
+struct eval_args
 {
-    int x;
-    template<class F, class... Ts>
-    constexpr eval_helper(const F& f, Ts&&... xs) : x((boost::hof::apply(f, BOOST_HOF_FORWARD(Ts)(xs)...), 0))
-    {}
+    typedef decltype(boost::hof::pack_forward(boost::hof::eval(std::declval<Ts>())...)) type;
 };
 #endif
 
@@ -116,15 +120,15 @@ struct apply_eval_f
     ),
     class=typename std::enable_if<(!std::is_void<R>::value)>::type 
     >
-    constexpr R operator()(const F& f, Ts&&... xs) const BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(boost::hof::apply(f, boost::hof::eval(BOOST_HOF_FORWARD(Ts)(xs))...))
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr R operator()(const F& f, Ts&&... xs) const BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(boost::hof::apply(f, boost::hof::eval(BOOST_HOF_FORWARD(Ts)(xs))...))
     {
         return
 #if BOOST_HOF_NO_ORDERED_BRACE_INIT
         boost::hof::detail::eval_ordered<R>
             (f, boost::hof::pack(), BOOST_HOF_FORWARD(Ts)(xs)...);
 #else
-        boost::hof::detail::eval_helper<R>
-            {f, boost::hof::eval(BOOST_HOF_FORWARD(Ts)(xs))...}.result;
+        typename boost::hof::detail::eval_args<Ts...>::type
+            {boost::hof::eval(BOOST_HOF_FORWARD(Ts)(xs))...}(boost::hof::detail::eval_apply<F>{f});
 #endif
     }
 
@@ -133,7 +137,7 @@ struct apply_eval_f
     ),
     class=typename std::enable_if<(std::is_void<R>::value)>::type 
     >
-    constexpr typename detail::holder<Ts...>::type 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr typename detail::holder<Ts...>::type 
     operator()(const F& f, Ts&&... xs) const BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(boost::hof::apply(f, boost::hof::eval(BOOST_HOF_FORWARD(Ts)(xs))...))
     {
         return (typename detail::holder<Ts...>::type)
@@ -141,8 +145,8 @@ struct apply_eval_f
         boost::hof::detail::eval_ordered<R>
             (f, boost::hof::pack(), BOOST_HOF_FORWARD(Ts)(xs)...);
 #else
-        boost::hof::detail::eval_helper<R>
-            {f, boost::hof::eval(BOOST_HOF_FORWARD(Ts)(xs))...};
+        typename boost::hof::detail::eval_args<Ts...>::type
+            {boost::hof::eval(BOOST_HOF_FORWARD(Ts)(xs))...}(boost::hof::detail::eval_apply<F>{f});
 #endif
     }
 };
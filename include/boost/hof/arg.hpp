@@ -55,7 +55,7 @@ struct perfect_ref
     typedef T type;
     typedef typename std::remove_reference<T>::type value_type;
     T&& value;
-    constexpr perfect_ref(value_type& x) noexcept
+    BOOST_HOF_HOST_DEVICE constexpr perfect_ref(value_type& x) noexcept
     : value(BOOST_HOF_FORWARD(T)(x))
     {}
 };
@@ -64,7 +64,7 @@ template<std::size_t N>
 struct ignore
 {
     template<class T>
-    constexpr ignore(T&&...) noexcept
+    BOOST_HOF_HOST_DEVICE constexpr ignore(T&&...) noexcept
     {}
 };
 
@@ -72,27 +72,62 @@ template<std::size_t... N>
 struct args_at
 {
     template<class T, class... Ts>
-    constexpr auto operator()(ignore<N>..., T x, Ts...) const 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(ignore<N>..., T x, Ts...) const 
     BOOST_HOF_RETURNS(BOOST_HOF_FORWARD(typename T::type)(x.value));
+
+    // Used when the type of the argument is already known, so it doesn't
+    // need to be deduced through a wrapper
+    template<class T, class... Ts>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE static constexpr T&& get(ignore<N>..., T&& x, Ts&&...) noexcept
+    {
+        return BOOST_HOF_FORWARD(T)(x);
+    }
 };
 
 template<std::size_t... N>
-constexpr args_at<N...> make_args_at(seq<N...>) noexcept
+BOOST_HOF_HOST_DEVICE constexpr args_at<N...> make_args_at(seq<N...>) noexcept
 {
     return {};
 }
 
+#if BOOST_HOF_HAS_PACK_INDEXING
+
+template<std::size_t N, class... Ts, class=typename std::enable_if<(N > 0 && N <= sizeof...(Ts))>::type>
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr Ts...[N-1]&& get_args(Ts&&... xs) noexcept
+{
+    return BOOST_HOF_FORWARD(Ts...[N-1])(xs...[N-1]);
+}
+
+#elif BOOST_HOF_HAS_TYPE_PACK_ELEMENT
+
+// The builtin is wrapped in a class so it doesn't appear in the signature
+template<std::size_t N, class... Ts>
+struct arg_type
+{
+    typedef __type_pack_element<N, Ts...> type;
+};
+
+template<std::size_t N, class... Ts, class=typename std::enable_if<(N > 0 && N <= sizeof...(Ts))>::type>
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr typename arg_type<N-1, Ts...>::type&& get_args(Ts&&... xs) noexcept
+{
+    return boost::hof::detail::make_args_at(typename gens<N-1>::type()).get(BOOST_HOF_FORWARD(Ts)(xs)...);
+}
+
+#else
+
 template<std::size_t N, class... Ts>
-constexpr auto get_args(Ts&&... xs) BOOST_HOF_RETURNS
+BOOST_HOF_HOST_DEVICE constexpr auto get_args(Ts&&... xs) BOOST_HOF_RETURNS
 (
     boost::hof::detail::make_args_at(typename gens<N>::type())(nullptr, BOOST_HOF_RETURNS_CONSTRUCT(perfect_ref<Ts>)(xs)...)
 );
 
+#endif
+
 template<class T, T N>
 struct make_args_f
 {
     template<class... Ts, class=typename std::enable_if<(N <= sizeof...(Ts))>::type>
-    constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
     (
         boost::hof::detail::get_args<N>(BOOST_HOF_FORWARD(Ts)(xs)...)
     );
@@ -101,7 +136,7 @@ struct make_args_f
 struct arg_f
 {
     template<class IntegralConstant>
-    constexpr make_args_f<std::size_t, IntegralConstant::value> operator()(IntegralConstant) const noexcept
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr make_args_f<std::size_t, IntegralConstant::value> operator()(IntegralConstant) const noexcept
     {
         return make_args_f<std::size_t, IntegralConstant::value>();
     }
@@ -113,7 +148,7 @@ template<std::size_t N>
 BOOST_HOF_STATIC_CONSTEXPR detail::make_args_f<std::size_t, N> arg_c = {};
 #else
 template<std::size_t N, class... Ts>
-constexpr auto arg_c(Ts&&... xs) BOOST_HOF_RETURNS
+BOOST_HOF_HOST_DEVICE constexpr auto arg_c(Ts&&... xs) BOOST_HOF_RETURNS
 (
     boost::hof::detail::get_args<N>(BOOST_HOF_FORWARD(Ts)(xs)...)
 );
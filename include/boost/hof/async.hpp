@@ -0,0 +1,662 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    async.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_ASYNC_H
+#define BOOST_HOF_GUARD_ASYNC_H
+
+/// async
+/// =====
+///
+/// Description
+/// -----------
+///
+/// The `async` function adaptor calls the function on an
+/// [executor](executor), and returns an `async_future` for the result
+/// immediately. The arguments are decayed and copied, so they can be safely
+/// used after the call returns. By default, the `thread_executor` is used.
+///
+/// If any of the arguments are an `async_future`, then the function is not
+/// called until all of them are ready, and it is called with their values
+/// instead. Nothing blocks while waiting for them, so composing asynchronous
+/// functions with [`flow`](flow) or [`compose`](compose) chains each stage
+/// as a continuation of the previous one.
+///
+/// The `async_future` is a shared handle to the result. It provides `get`,
+/// which waits for the result and returns it or rethrows the exception the
+/// function threw, `ready`, and `then`, which calls a function with the
+/// result on the thread that completes it and returns an `async_future` for
+/// the result of the continuation. The `then` function adaptor does the same
+/// for a future passed to it, so it can be used directly in `flow`.
+///
+/// The `when_all` function returns an `async_future` of a `std::tuple` of
+/// the results, which is ready once all of the futures are ready.
+///
+/// The shared state, the result and the continuations of each call are
+/// allocated with `BOOST_HOF_STATE_ALLOCATOR`, which is the
+/// [`pool_allocator`](pool_allocator) by default, so a thread that keeps
+/// calling an asynchronous function reuses the memory of the calls that
+/// have finished.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F, class Executor>
+///     async_adaptor<F, Executor> async(F f, Executor e);
+///
+///     template<class F>
+///     async_adaptor<F> async(F f);
+///
+///     template<class F>
+///     then_adaptor<F> then(F f);
+///
+///     template<class... Ts>
+///     async_future<std::tuple<Ts...>> when_all(async_future<Ts>... fs);
+///
+/// Semantics
+/// ---------
+///
+///     assert(async(f)(xs...).get() == f(xs...));
+///     assert(async(g)(async(f)(xs...)).get() == g(f(xs...)));
+///     assert(then(g)(async(f)(xs...)).get() == g(f(xs...)));
+///     assert(when_all(async(f)(xs)...).get() == std::make_tuple(f(xs)...));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * CopyConstructible
+///
+/// Executor must be:
+///
+/// * [Executor](executor) with an `execute` function
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct increment
+///     {
+///         int operator()(int x) const
+///         {
+///             return x + 1;
+///         }
+///     };
+///
+///     int main() {
+///         auto f = boost::hof::flow(boost::hof::async(increment()), boost::hof::async(increment()));
+///         assert(f(1).get() == 3);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [executor](executor)
+/// * [flow](flow)
+///
+
+#include <boost/hof/always.hpp>
+#include <boost/hof/executor.hpp>
+#include <boost/hof/pool_allocator.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/detail/and.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace hof {
+
+template<class T>
+struct async_future;
+
+namespace detail {
+
+struct async_void
+{};
+
+template<class T>
+struct async_stored
+{ typedef T type; };
+
+template<>
+struct async_stored<void>
+{ typedef async_void type; };
+
+// The state of each call, its value and its continuations, are allocated
+// with BOOST_HOF_STATE_ALLOCATOR
+template<class T, class... Ts>
+std::shared_ptr<T> async_make_shared(Ts&&... xs)
+{
+    return std::allocate_shared<T>(BOOST_HOF_STATE_ALLOCATOR<T>(), BOOST_HOF_FORWARD(Ts)(xs)...);
+}
+
+template<class T>
+struct async_value_delete
+{
+    void operator()(T* p) const noexcept
+    {
+        p->~T();
+        BOOST_HOF_STATE_ALLOCATOR<T>().deallocate(p, 1);
+    }
+};
+
+template<class T>
+struct async_value_ptr
+{
+    typedef std::unique_ptr<T, async_value_delete<T>> type;
+};
+
+// Frees the memory when the constructor throws
+template<class T>
+struct async_value_guard
+{
+    T* p;
+
+    async_value_guard() : p(BOOST_HOF_STATE_ALLOCATOR<T>().allocate(1))
+    {}
+
+    async_value_guard(const async_value_guard&)=delete;
+    async_value_guard& operator=(const async_value_guard&)=delete;
+
+    ~async_value_guard()
+    {
+        if (p != nullptr) BOOST_HOF_STATE_ALLOCATOR<T>().deallocate(p, 1);
+    }
+
+    typename async_value_ptr<T>::type release() noexcept
+    {
+        T* r = p;
+        p = nullptr;
+        return typename async_value_ptr<T>::type(r);
+    }
+};
+
+template<class T, class... Ts>
+typename async_value_ptr<T>::type async_new_value(Ts&&... xs)
+{
+    async_value_guard<T> g;
+    ::new(static_cast<void*>(g.p)) T(BOOST_HOF_FORWARD(Ts)(xs)...);
+    return g.release();
+}
+
+struct async_callback_base
+{
+    virtual void run()=0;
+    virtual ~async_callback_base()
+    {}
+
+    static void* operator new(std::size_t n)
+    {
+        return BOOST_HOF_STATE_ALLOCATOR<char>().allocate(n);
+    }
+
+    // The virtual destructor passes the size of the derived callback
+    static void operator delete(void* p, std::size_t n) noexcept
+    {
+        BOOST_HOF_STATE_ALLOCATOR<char>().deallocate(static_cast<char*>(p), n);
+    }
+};
+
+template<class F>
+struct async_callback : async_callback_base
+{
+    F f;
+    async_callback(F x) : f(std::move(x))
+    {}
+
+    virtual void run()
+    {
+        f();
+    }
+};
+
+template<class T>
+struct async_state
+{
+    std::mutex m;
+    std::condition_variable cv;
+    typedef typename async_value_ptr<T>::type value_ptr;
+    bool done;
+    value_ptr value;
+    std::exception_ptr error;
+    std::vector<std::unique_ptr<async_callback_base>> callbacks;
+
+    async_state() : done(false)
+    {}
+
+    void set_value(value_ptr p)
+    {
+        std::unique_lock<std::mutex> lock(m);
+        value = std::move(p);
+        this->finish(lock);
+    }
+
+    void set_error(std::exception_ptr e)
+    {
+        std::unique_lock<std::mutex> lock(m);
+        error = e;
+        this->finish(lock);
+    }
+
+    // The callbacks run on the thread that completes the state, after the
+    // lock is released
+    void finish(std::unique_lock<std::mutex>& lock)
+    {
+        done = true;
+        std::vector<std::unique_ptr<async_callback_base>> cs;
+        cs.swap(callbacks);
+        lock.unlock();
+        cv.notify_all();
+        for (auto& c : cs) c->run();
+    }
+
+    template<class F>
+    void on_ready(F f)
+    {
+        std::unique_ptr<async_callback_base> c(new async_callback<F>(std::move(f)));
+        std::unique_lock<std::mutex> lock(m);
+        if (done)
+        {
+            lock.unlock();
+            c->run();
+        }
+        else callbacks.push_back(std::move(c));
+    }
+
+    bool ready()
+    {
+        std::lock_guard<std::mutex> lock(m);
+        return done;
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m);
+        while (!done) cv.wait(lock);
+    }
+
+    // Returns whether the state is done before the time is up
+    template<class Rep, class Period>
+    bool wait_for(const std::chrono::duration<Rep, Period>& d)
+    {
+        std::unique_lock<std::mutex> lock(m);
+        return cv.wait_for(lock, d, [this] { return done; });
+    }
+};
+
+template<class T, class F>
+typename async_value_ptr<T>::type async_make_value(F& f, std::true_type)
+{
+    f();
+    return detail::async_new_value<T>();
+}
+
+// The result is constructed in place, so it isn't moved
+template<class T, class F>
+typename async_value_ptr<T>::type async_make_value(F& f, std::false_type)
+{
+    async_value_guard<T> g;
+    ::new(static_cast<void*>(g.p)) T(f());
+    return g.release();
+}
+
+// Only the function is guarded, so an exception thrown by a continuation
+// does not complete the state a second time
+template<class R, class T, class F>
+void async_fulfill(async_state<T>& s, F&& f)
+{
+    typename async_value_ptr<T>::type p;
+    try
+    {
+        p = detail::async_make_value<T>(f, std::is_void<R>());
+    }
+    catch(...)
+    {
+        s.set_error(std::current_exception());
+        return;
+    }
+    s.set_value(std::move(p));
+}
+
+template<class F, class T>
+struct async_then_result
+: std::decay<decltype(std::declval<const F&>()(std::declval<const T&>()))>
+{};
+
+template<class F>
+struct async_then_result<F, async_void>
+: std::decay<decltype(std::declval<const F&>()())>
+{};
+
+template<class R, class T, class F>
+struct async_then_apply
+{
+    const F& f;
+    const T& x;
+
+    BOOST_HOF_INLINE R operator()() const
+    {
+        return f(x);
+    }
+};
+
+template<class R, class F>
+struct async_then_apply<R, async_void, F>
+{
+    const F& f;
+    const async_void& x;
+
+    BOOST_HOF_INLINE R operator()() const
+    {
+        return f();
+    }
+};
+
+template<class R, class T, class F>
+struct async_then_callback
+{
+    std::shared_ptr<async_state<T>> input;
+    std::shared_ptr<async_state<typename async_stored<R>::type>> output;
+    F f;
+
+    BOOST_HOF_INLINE void operator()()
+    {
+        if (input->error) output->set_error(input->error);
+        else detail::async_fulfill<R>(*output, async_then_apply<R, T, F>{f, *input->value});
+    }
+};
+
+}
+
+template<class T>
+struct async_future
+{
+    typedef typename detail::async_stored<T>::type stored_type;
+    typedef detail::async_state<stored_type> state_type;
+    typedef typename std::conditional<std::is_void<T>::value, void, const stored_type&>::type get_type;
+    std::shared_ptr<state_type> state;
+
+    async_future()
+    {}
+
+    explicit async_future(std::shared_ptr<state_type> s) : state(std::move(s))
+    {}
+
+    bool valid() const noexcept
+    {
+        return state != nullptr;
+    }
+
+    bool ready() const
+    {
+        return state->ready();
+    }
+
+    void wait() const
+    {
+        state->wait();
+    }
+
+    get_type get() const
+    {
+        state->wait();
+        if (state->error) std::rethrow_exception(state->error);
+        return static_cast<get_type>(*state->value);
+    }
+
+    template<class F, class R=typename detail::async_then_result<F, stored_type>::type>
+    async_future<R> then(F f) const
+    {
+        auto out = detail::async_make_shared<typename async_future<R>::state_type>();
+        state->on_ready(detail::async_then_callback<R, stored_type, F>{state, out, std::move(f)});
+        return async_future<R>(out);
+    }
+};
+
+namespace detail {
+
+template<class T>
+struct is_async_future
+: std::false_type
+{};
+
+template<class T>
+struct is_async_future<async_future<T>>
+: std::true_type
+{};
+
+template<class T>
+struct async_arg
+{ typedef T type; };
+
+template<class T>
+struct async_arg<async_future<T>>
+{ typedef typename async_stored<T>::type type; };
+
+template<class T>
+async_future<T> as_async_future(const async_future<T>& x)
+{
+    return x;
+}
+
+template<class T, class U=typename std::decay<T>::type,
+    class=typename std::enable_if<!is_async_future<U>::value>::type>
+async_future<U> as_async_future(T&& x)
+{
+    auto s = detail::async_make_shared<async_state<U>>();
+    s->set_value(detail::async_new_value<U>(BOOST_HOF_FORWARD(T)(x)));
+    return async_future<U>(s);
+}
+
+template<class Seq, class... Ts>
+struct when_all_state;
+
+template<std::size_t... Ns, class... Ts>
+struct when_all_state<seq<Ns...>, Ts...>
+{
+    typedef std::tuple<typename async_stored<Ts>::type...> tuple_type;
+    std::shared_ptr<async_state<tuple_type>> output;
+    std::tuple<async_future<Ts>...> inputs;
+    std::atomic<std::size_t> remaining;
+
+    when_all_state(const async_future<Ts>&... xs)
+    : output(detail::async_make_shared<async_state<tuple_type>>()), inputs(xs...), remaining(sizeof...(Ts))
+    {}
+
+    void complete()
+    {
+        std::exception_ptr errors[] = {std::get<Ns>(inputs).state->error..., nullptr};
+        for (auto&& e : errors)
+        {
+            if (e)
+            {
+                output->set_error(e);
+                return;
+            }
+        }
+        detail::async_fulfill<tuple_type>(*output, *this);
+    }
+
+    BOOST_HOF_INLINE tuple_type operator()() const
+    {
+        return tuple_type(*std::get<Ns>(inputs).state->value...);
+    }
+};
+
+template<class State>
+struct when_all_callback
+{
+    std::shared_ptr<State> state;
+
+    BOOST_HOF_INLINE void operator()() const
+    {
+        if (--state->remaining == 0) state->complete();
+    }
+};
+
+struct when_all_f
+{
+    template<class... Ts>
+    BOOST_HOF_INLINE async_future<std::tuple<typename async_stored<Ts>::type...>> operator()(const async_future<Ts>&... xs) const
+    {
+        typedef when_all_state<typename gens<sizeof...(Ts)>::type, Ts...> state_type;
+        auto s = detail::async_make_shared<state_type>(xs...);
+        auto output = s->output;
+        if (sizeof...(Ts) == 0) s->complete();
+        (void)std::initializer_list<int>{(xs.state->on_ready(when_all_callback<state_type>{s}), 0)...};
+        return async_future<std::tuple<typename async_stored<Ts>::type...>>(output);
+    }
+};
+
+template<class R, class F, class Tuple>
+struct async_apply
+{
+    const F& f;
+    Tuple& args;
+
+    BOOST_HOF_INLINE R operator()() const
+    {
+        return boost::hof::unpack(f)(std::move(args));
+    }
+};
+
+template<class R, class F, class Tuple>
+struct async_task
+{
+    std::shared_ptr<async_state<typename async_stored<R>::type>> output;
+    F f;
+    Tuple args;
+
+    BOOST_HOF_INLINE void operator()()
+    {
+        detail::async_fulfill<R>(*output, async_apply<R, F, Tuple>{f, args});
+    }
+};
+
+// Runs the function on the executor once all of the arguments are ready.
+// This is the only consumer of the joined arguments, so they are moved into
+// the task.
+template<class R, class F, class Executor, class Tuple>
+struct async_chain
+{
+    std::shared_ptr<async_state<Tuple>> input;
+    std::shared_ptr<async_state<typename async_stored<R>::type>> output;
+    F f;
+    Executor e;
+
+    BOOST_HOF_INLINE void operator()()
+    {
+        if (input->error) output->set_error(input->error);
+        else e.execute(async_task<R, F, Tuple>{output, f, std::move(*input->value)});
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(when_all, detail::when_all_f);
+
+template<class F, class Executor=thread_executor>
+struct async_adaptor : detail::compressed_pair<detail::callable_base<F>, Executor>
+{
+    typedef detail::compressed_pair<detail::callable_base<F>, Executor> base_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(async_adaptor, base_type)
+
+    template<class X, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(detail::callable_base<F>, X&&)>
+    constexpr async_adaptor(X&& x)
+    : base_type(BOOST_HOF_FORWARD(X)(x), Executor())
+    {}
+
+    template<class... Ts>
+    BOOST_HOF_INLINE const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    template<class... Ts>
+    const Executor& get_executor(Ts&&... xs) const noexcept
+    {
+        return this->second(xs...);
+    }
+
+    template<class... Ts, class=typename std::enable_if<
+        BOOST_HOF_AND_UNPACK(!detail::is_async_future<typename std::decay<Ts>::type>::value)
+    >::type, class R=typename std::decay<decltype(
+        std::declval<const detail::callable_base<F>&>()(std::declval<typename std::decay<Ts>::type>()...)
+    )>::type>
+    BOOST_HOF_INLINE async_future<R> operator()(Ts&&... xs) const
+    {
+        typedef std::tuple<typename std::decay<Ts>::type...> tuple_type;
+        auto output = detail::async_make_shared<typename async_future<R>::state_type>();
+        this->get_executor(xs...).execute(detail::async_task<R, detail::callable_base<F>, tuple_type>{
+            output, this->base_function(xs...), tuple_type(BOOST_HOF_FORWARD(Ts)(xs)...)
+        });
+        return async_future<R>(output);
+    }
+
+    template<class... Ts, class=typename std::enable_if<
+        !BOOST_HOF_AND_UNPACK(!detail::is_async_future<typename std::decay<Ts>::type>::value)
+    >::type, class R=typename std::decay<decltype(
+        std::declval<const detail::callable_base<F>&>()(std::declval<typename detail::async_arg<typename std::decay<Ts>::type>::type>()...)
+    )>::type, class=void>
+    BOOST_HOF_INLINE async_future<R> operator()(Ts&&... xs) const
+    {
+        auto args = boost::hof::when_all(detail::as_async_future(BOOST_HOF_FORWARD(Ts)(xs))...);
+        typedef typename decltype(args)::stored_type tuple_type;
+        auto output = detail::async_make_shared<typename async_future<R>::state_type>();
+        args.state->on_ready(detail::async_chain<R, detail::callable_base<F>, Executor, tuple_type>{
+            args.state, output, this->base_function(xs...), this->get_executor(xs...)
+        });
+        return async_future<R>(output);
+    }
+};
+
+template<class F>
+struct then_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(then_adaptor, detail::callable_base<F>)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class T, class R=typename detail::async_then_result<detail::callable_base<F>, typename async_future<T>::stored_type>::type>
+    BOOST_HOF_INLINE async_future<R> operator()(const async_future<T>& x) const
+    {
+        return x.then(this->base_function(x));
+    }
+};
+
+BOOST_HOF_DETAIL_COMPILE_MARKER(async, async_adaptor)
+
+BOOST_HOF_DECLARE_STATIC_VAR(async, detail::make<async_adaptor>);
+
+BOOST_HOF_DETAIL_COMPILE_MARKER(then, then_adaptor)
+
+BOOST_HOF_DECLARE_STATIC_VAR(then, detail::make<then_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,154 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    batch.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_BATCH_H
+#define BOOST_HOF_GUARD_BATCH_H
+
+/// batch
+/// =====
+///
+/// Description
+/// -----------
+///
+/// The `batch` function adaptor calls a function lane-wise over columns of
+/// data, that is, a structure of arrays. The first column is the output, and
+/// for each lane `i` it is assigned the result of calling the function with
+/// the element `i` of each of the other columns.
+///
+/// The loop is written so the optimizer can vectorize it. The columns are
+/// accessed through `BOOST_HOF_RESTRICT` pointers, and the function is copied
+/// before the loop, so that the stores to the output can't alias the state of
+/// the function, such as the functions stored by [`flow`](flow) or
+/// [`proj`](proj). The main loop calls `BOOST_HOF_BATCH_WIDTH` lanes at a
+/// time, and the lanes that are left are called in a tail loop.
+///
+/// All the columns must have the same size, otherwise `std::invalid_argument`
+/// is thrown.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F>
+///     constexpr batch_adaptor<F> batch(F f);
+///
+/// Semantics
+/// ---------
+///
+///     batch(f)(out, xs...);
+///     for(std::size_t i = 0; i < out.size(); i++) assert(out[i] == f(xs[i]...));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * CopyConstructible
+///
+/// The columns must have `data()` and `size()` member functions, and their
+/// elements must be stored contiguously, such as `std::vector`, `std::array`
+/// or [`fixed_view`](fixed_view). The output must not overlap any of the
+/// other columns.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <vector>
+///
+///     int main() {
+///         std::vector<float> x = { 1, 2, 3 };
+///         std::vector<float> y = { 4, 5, 6 };
+///         std::vector<float> r(3);
+///         boost::hof::batch(boost::hof::_ * boost::hof::_)(r, x, y);
+///         assert(r[2] == 18);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [proj](proj)
+/// * [flow](flow)
+/// * [tuple_zip_with](tuple_zip_with)
+///
+
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/always.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <boost/hof/config.hpp>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class T>
+struct batch_element
+{
+    typedef decltype(*std::declval<T&>().data()) type;
+};
+
+constexpr bool batch_same_size(std::size_t)
+{
+    return true;
+}
+
+template<class... Ts>
+constexpr bool batch_same_size(std::size_t n, std::size_t m, Ts... ms)
+{
+    return n == m && batch_same_size(n, ms...);
+}
+
+// The function is taken by value, so it is local to the loop
+template<class F, class T, class... Ts>
+void batch_loop(F f, std::size_t n, T* BOOST_HOF_RESTRICT out, Ts* BOOST_HOF_RESTRICT... xs)
+{
+    std::size_t i = 0;
+    for(; i + BOOST_HOF_BATCH_WIDTH <= n; i += BOOST_HOF_BATCH_WIDTH)
+    {
+        for(std::size_t j = 0; j < BOOST_HOF_BATCH_WIDTH; j++) out[i + j] = f(xs[i + j]...);
+    }
+    for(; i < n; i++) out[i] = f(xs[i]...);
+}
+
+}
+
+template<class F>
+struct batch_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(batch_adaptor, detail::callable_base<F>)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class Out, class... Ranges, class=typename std::enable_if<
+        boost::hof::is_invocable<detail::callable_base<F>, typename detail::batch_element<Ranges>::type...>::value
+    >::type>
+    void operator()(Out&& out, Ranges&&... xs) const
+    {
+        if (!detail::batch_same_size(out.size(), xs.size()...)) throw std::invalid_argument("batch: the columns must have the same size");
+        detail::batch_loop(this->base_function(out, xs...), out.size(), out.data(), xs.data()...);
+    }
+};
+
+BOOST_HOF_DETAIL_COMPILE_MARKER(batch, batch_adaptor)
+
+BOOST_HOF_DECLARE_STATIC_VAR(batch, detail::make<batch_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,290 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    batched.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_BATCHED_H
+#define BOOST_HOF_GUARD_BATCHED_H
+
+/// batched
+/// =======
+///
+/// Description
+/// -----------
+///
+/// The `batched` function adaptor turns a function that takes a batch of
+/// calls into a function that is called once for each item, such as to write
+/// the items to a database, or pass them to a kernel, that is faster for
+/// larger batches. Each call stores its arguments as a [`pack`](pack) in a
+/// buffer of `N` packs, that is allocated in the adaptor, and when the buffer
+/// is full, the function is called with a `batched_view` of the packs, and
+/// then the buffer is emptied. The packs that are left are passed when
+/// `flush` is called, or when the adaptor is destroyed.
+///
+/// The types of the arguments are given with `N`, so the type of the pack is
+/// known before the first call. The arguments are converted to these types,
+/// and stored by value.
+///
+/// If the function throws, the packs are kept in the buffer, and they are
+/// passed again by the next flush, or the next call. The exceptions thrown
+/// when the adaptor is destroyed call `std::terminate`, so `flush` should be
+/// called first when the function can throw. A copy of the adaptor starts
+/// with an empty buffer, so the calls aren't passed twice, and it is not safe
+/// to call the adaptor from several threads at the same time.
+///
+/// Synopsis
+/// --------
+///
+///     template<std::size_t N, class... Ts, class F>
+///     batched_adaptor<N, F, Ts...> batched(F f);
+///
+///     template<std::size_t N, class F, class... Ts>
+///     struct batched_adaptor
+///     {
+///         void operator()(Ts... xs) const;
+///         void flush() const;
+///         std::size_t pending() const noexcept;
+///     };
+///
+///     template<class T>
+///     class batched_view
+///     {
+///         T* data() const noexcept;
+///         std::size_t size() const noexcept;
+///         T* begin() const noexcept;
+///         T* end() const noexcept;
+///         T& operator[](std::size_t i) const noexcept;
+///     };
+///
+/// Semantics
+/// ---------
+///
+///     auto g = batched<2, Ts...>(f);
+///     g(xs...);
+///     g(ys...);
+///     // Calls
+///     f(batched_view{ pack(xs...), pack(ys...) });
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [UnaryInvocable](UnaryInvocable) with a `batched_view`
+/// * MoveConstructible
+///
+/// Ts must be:
+///
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <vector>
+///
+///     std::vector<int> sums;
+///
+///     struct write_sums
+///     {
+///         template<class View>
+///         void operator()(View v) const
+///         {
+///             for(auto&& p : v) sums.push_back(boost::hof::unpack(boost::hof::_ + boost::hof::_)(p));
+///         }
+///     };
+///
+///     int main() {
+///         auto f = boost::hof::batched<2, int, int>(write_sums());
+///         f(1, 2);
+///         assert(sums.empty());
+///         f(3, 4);
+///         assert(sums.size() == 2);
+///         f(5, 6);
+///         f.flush();
+///         assert(sums.size() == 3 && sums[2] == 11);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [pack](pack)
+/// * [batch](batch)
+///
+
+#include <boost/hof/pack.hpp>
+#include <boost/hof/always.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+template<class T>
+class batched_view
+{
+    T* p;
+    std::size_t n;
+public:
+    typedef T element_type;
+    typedef T* iterator;
+
+    batched_view(T* x, std::size_t size) noexcept
+    : p(x), n(size)
+    {}
+
+    std::size_t size() const noexcept
+    {
+        return n;
+    }
+
+    bool empty() const noexcept
+    {
+        return n == 0;
+    }
+
+    T* data() const noexcept
+    {
+        return p;
+    }
+
+    T& operator[](std::size_t i) const noexcept
+    {
+        return p[i];
+    }
+
+    T* begin() const noexcept
+    {
+        return p;
+    }
+
+    T* end() const noexcept
+    {
+        return p + n;
+    }
+};
+
+namespace detail {
+
+template<class T, std::size_t N>
+struct batched_buffer
+{
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage[N];
+    std::size_t n;
+
+    batched_buffer() noexcept : n(0)
+    {}
+
+    batched_buffer(batched_buffer&& rhs) : n(0)
+    {
+        for (std::size_t i = 0; i < rhs.n; i++) this->emplace(std::move(rhs.data()[i]));
+        rhs.clear();
+    }
+
+    batched_buffer& operator=(const batched_buffer&)=delete;
+
+    ~batched_buffer()
+    {
+        this->clear();
+    }
+
+    T* data() noexcept
+    {
+        return reinterpret_cast<T*>(storage);
+    }
+
+    bool full() const noexcept
+    {
+        return n == N;
+    }
+
+    template<class X>
+    void emplace(X&& x)
+    {
+        ::new(static_cast<void*>(storage + n)) T(BOOST_HOF_FORWARD(X)(x));
+        n++;
+    }
+
+    void clear() noexcept
+    {
+        for (std::size_t i = 0; i < n; i++) this->data()[i].~T();
+        n = 0;
+    }
+};
+
+}
+
+template<std::size_t N, class F, class... Ts>
+struct batched_adaptor : detail::callable_base<F>
+{
+    static_assert(N > 0, "The batch must hold at least one call");
+
+    typedef decltype(boost::hof::pack(std::declval<Ts>()...)) value_type;
+    typedef batched_view<value_type> view_type;
+
+    mutable detail::batched_buffer<value_type, N> buffer;
+
+    template<class X, class=typename std::enable_if<std::is_constructible<F, X&&>::value>::type>
+    explicit batched_adaptor(X&& x)
+    : detail::callable_base<F>(BOOST_HOF_FORWARD(X)(x))
+    {}
+
+    // The calls in the buffer are only passed by the original, so a copy
+    // starts with an empty buffer
+    batched_adaptor(const batched_adaptor& rhs)
+    : detail::callable_base<F>(rhs.base_function())
+    {}
+
+    batched_adaptor(batched_adaptor&& rhs)
+    : detail::callable_base<F>(static_cast<detail::callable_base<F>&&>(rhs)), buffer(std::move(rhs.buffer))
+    {}
+
+    ~batched_adaptor()
+    {
+        this->flush();
+    }
+
+    template<class... Us>
+    constexpr const detail::callable_base<F>& base_function(Us&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    std::size_t pending() const noexcept
+    {
+        return buffer.n;
+    }
+
+    void flush() const
+    {
+        if (buffer.n == 0) return;
+        this->base_function()(view_type(buffer.data(), buffer.n));
+        buffer.clear();
+    }
+
+    template<class... Us, class=decltype(boost::hof::pack(static_cast<Ts>(std::declval<Us>())...))>
+    void operator()(Us&&... xs) const
+    {
+        // The buffer is still full when the last flush threw
+        if (buffer.full()) this->flush();
+        buffer.emplace(boost::hof::pack(static_cast<Ts>(BOOST_HOF_FORWARD(Us)(xs))...));
+        if (buffer.full()) this->flush();
+    }
+};
+
+template<std::size_t N, class... Ts, class F>
+batched_adaptor<N, F, Ts...> batched(F f)
+{
+    return batched_adaptor<N, F, Ts...>(static_cast<F&&>(f));
+}
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,205 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    borrow.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_BORROW_H
+#define BOOST_HOF_GUARD_BORROW_H
+
+/// borrow
+/// ======
+///
+/// Description
+/// -----------
+///
+/// The `borrow` function marks an lvalue that outlives the function object
+/// it is captured by, so [`decay`](decay) stores a view of it instead of a
+/// copy. As with `std::ref`, this applies to every adaptor that decays its
+/// values, such as [`capture`](capture), [`partial`](partial) and
+/// [`pack`](pack). A `std::string` is stored as a `std::string_view` when
+/// `BOOST_HOF_HAS_STD_STRING_VIEW` is enabled, and a contiguous container,
+/// which has a `data()` pointer and a `size()`, is stored as a
+/// `std::span` of const elements when `BOOST_HOF_HAS_STD_SPAN` is enabled.
+/// Otherwise, the value is stored by const reference.
+///
+/// The view that is stored for a type can be chosen by specializing
+/// `borrow_traits`, which has the `type` of the view and a static `view`
+/// function that returns it for a value. The value must outlive every
+/// function object that holds the view.
+///
+/// Synopsis
+/// --------
+///
+///     template<class T>
+///     borrowed<T> borrow(const T& x) noexcept;
+///
+///     template<class T, class=void>
+///     struct borrow_traits
+///     {
+///         typedef const T& type;
+///         static constexpr type view(const T& x) noexcept;
+///     };
+///
+/// Semantics
+/// ---------
+///
+///     assert(decay(borrow(x)) == borrow_traits<T>::view(x));
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <string>
+///
+///     struct starts_with
+///     {
+///         template<class Prefix, class String>
+///         bool operator()(const Prefix& prefix, const String& s) const
+///         {
+///             return s.compare(0, prefix.size(), prefix) == 0;
+///         }
+///     };
+///
+///     int main() {
+///         std::string prefix(100, 'a');
+///         auto f = boost::hof::partial(starts_with())(boost::hof::borrow(prefix));
+///         assert(f(std::string(200, 'a')));
+///         assert(!f(std::string(200, 'b')));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [decay](decay)
+/// * [capture](capture)
+/// * [partial](partial)
+///
+
+#include <boost/hof/decay.hpp>
+#include <boost/hof/detail/holder.hpp>
+#include <memory>
+#include <string>
+#if BOOST_HOF_HAS_STD_STRING_VIEW
+#include <string_view>
+#endif
+#if BOOST_HOF_HAS_STD_SPAN
+#include <span>
+#endif
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class T>
+struct is_basic_string
+: std::false_type
+{};
+
+template<class C, class Traits, class Alloc>
+struct is_basic_string<std::basic_string<C, Traits, Alloc>>
+: std::true_type
+{};
+
+template<class T, class=void>
+struct borrow_data
+{
+    typedef void type;
+};
+
+template<class T>
+struct borrow_data<T, typename holder<
+    decltype(std::declval<const T&>().data()),
+    decltype(std::declval<const T&>().size())
+>::type>
+{
+    typedef decltype(std::declval<const T&>().data()) type;
+};
+
+template<class T>
+struct is_borrowed_contiguous
+: std::integral_constant<bool,
+    std::is_pointer<typename borrow_data<T>::type>::value && !is_basic_string<T>::value
+>
+{};
+
+}
+
+template<class T, class>
+struct borrow_traits
+{
+    typedef const T& type;
+
+    static constexpr type view(const T& x) noexcept
+    {
+        return x;
+    }
+};
+
+#if BOOST_HOF_HAS_STD_STRING_VIEW
+template<class C, class Traits, class Alloc>
+struct borrow_traits<std::basic_string<C, Traits, Alloc>>
+{
+    typedef std::basic_string_view<C, Traits> type;
+
+    static type view(const std::basic_string<C, Traits, Alloc>& x) noexcept
+    {
+        return type(x.data(), x.size());
+    }
+};
+#endif
+
+#if BOOST_HOF_HAS_STD_SPAN
+template<class T>
+struct borrow_traits<T, typename std::enable_if<detail::is_borrowed_contiguous<T>::value>::type>
+{
+    typedef std::span<typename std::remove_pointer<typename detail::borrow_data<T>::type>::type> type;
+
+    static constexpr type view(const T& x) noexcept
+    {
+        return type(x.data(), x.size());
+    }
+};
+#endif
+
+template<class T>
+class borrowed
+{
+    const T* p;
+public:
+    typedef typename borrow_traits<T>::type type;
+
+    constexpr explicit borrowed(const T& x) noexcept : p(std::addressof(x))
+    {}
+
+    constexpr const T& get() const noexcept
+    {
+        return *p;
+    }
+
+    constexpr operator type() const noexcept
+    {
+        return borrow_traits<T>::view(*p);
+    }
+};
+
+namespace detail {
+
+struct borrow_f
+{
+    template<class T>
+    constexpr borrowed<typename std::remove_const<T>::type> operator()(T& x) const noexcept
+    {
+        return borrowed<typename std::remove_const<T>::type>(x);
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(borrow, detail::borrow_f);
+
+}} // namespace boost::hof
+
+#endif
@@ -15,6 +15,14 @@
 #include <boost/hof/always.hpp>
 #include <boost/hof/detail/move.hpp>
 #include <boost/hof/detail/result_type.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/alias.hpp>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
 
 /// capture
 /// =======
@@ -26,7 +34,8 @@
 /// It provides more flexibility in capturing than the lambda capture list in
 /// C++. It provides a way to do move and perfect capturing. The values
 /// captured are prepended to the argument list of the function that will be
-/// called.
+/// called. Calling an rvalue capture moves the captured values and the
+/// function, so move-only values can be passed by value.
 /// 
 /// Synopsis
 /// --------
@@ -43,10 +52,63 @@
 ///     template<class... Ts>
 ///     constexpr auto capture_basic(Ts&&... xs);
 /// 
+///     // Capture by decaying each value into storage from the allocator
+///     template<class Allocator, class... Ts>
+///     auto capture_alloc(const Allocator& a, Ts&&... xs);
+/// 
+///     // Capture by decaying each value into one reference-counted block
+///     template<class... Ts>
+///     auto capture_shared(Ts&&... xs);
+/// 
+///     // The same, except the count is not atomic
+///     template<class... Ts>
+///     auto capture_shared(single_thread_t, Ts&&... xs);
+/// 
+///     // Capture the values marked with cold_value in one shared block, and
+///     // the others by decaying each value
+///     template<class... Ts>
+///     auto cold_capture(Ts&&... xs);
+/// 
+///     template<class T>
+///     constexpr auto cold_value(T&& x);
+/// 
+/// The `capture_alloc` function captures the values like `capture`, except
+/// when the function is given, the captured values are stored in memory from
+/// the allocator, and the function object only holds a pointer to them along
+/// with the allocator. This keeps the function object small, so it can be
+/// stored in a type-erased wrapper without allocating from the heap. When
+/// the captured values are trivially destructible, no destructor is called
+/// before the memory is given back to the allocator, so an arena allocator
+/// can release a whole batch of function objects at once.
+/// 
+/// The `capture_shared` function captures the values like `capture`, except
+/// they are stored once in a block with a reference count, which every copy
+/// of the function object shares, so a copy only increments the count no
+/// matter how large the values are. The captured values are passed to the
+/// function as const lvalues, so they are never copied on a call either. The
+/// count is atomic, unless `single_thread` is passed first, in which case the
+/// copies must all be used from the same thread. The `update` member
+/// function calls a function with the captured values as lvalues it can
+/// modify, after the block is copied if it is shared, so the other copies
+/// still see the old values. The `use_count` member function returns the
+/// number of function objects that share the block.
+/// 
+/// The `cold_capture` function captures the values like `capture`, except
+/// the values marked with `cold_value`, such as the messages and the
+/// fallback settings that are only used when a call fails, are stored in one
+/// block that every copy shares, like `capture_shared`. So the function
+/// object only holds the other values and a pointer, and stays small when it
+/// is stored in a table. The values are still passed in the order they were
+/// given, and the cold values are passed as const references into the block,
+/// so it is only read when the function reads them.
+/// 
 /// Semantics
 /// ---------
 /// 
 ///     assert(capture(xs...)(f)(ys...) == f(xs..., ys...));
+///     assert(capture_alloc(a, xs...)(f)(ys...) == f(xs..., ys...));
+///     assert(capture_shared(xs...)(f)(ys...) == f(xs..., ys...));
+///     assert(cold_capture(x, cold_value(y))(f)(zs...) == f(x, y, zs...));
 /// 
 /// 
 /// Example
@@ -72,8 +134,21 @@
 
 namespace boost { namespace hof {
 
+struct single_thread_t
+{};
+
 namespace detail {
 
+template<class... Ts>
+struct is_single_thread_first
+: std::false_type
+{};
+
+template<class T, class... Ts>
+struct is_single_thread_first<T, Ts...>
+: std::is_same<T, single_thread_t>
+{};
+
 template<class F, class Pack>
 struct capture_invoke : detail::compressed_pair<detail::callable_base<F>, Pack>, detail::function_result_type<F>
 {
@@ -81,7 +156,7 @@ struct capture_invoke : detail::compressed_pair<detail::callable_base<F>, Pack>,
     typedef detail::compressed_pair<detail::callable_base<F>, Pack> base;
     BOOST_HOF_INHERIT_CONSTRUCTOR(capture_invoke, base)
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
     {
         return this->first(xs...);
     }
@@ -121,7 +196,7 @@ struct capture_invoke : detail::compressed_pair<detail::callable_base<F>, Pack>,
     BOOST_HOF_RETURNS_CLASS(capture_invoke);
 
     template<class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT
     (
         typename result_of<decltype(boost::hof::pack_join), 
             id_<const Pack&>, 
@@ -129,7 +204,7 @@ struct capture_invoke : detail::compressed_pair<detail::callable_base<F>, Pack>,
         >::type,
         id_<detail::callable_base<F>&&>
     ) 
-    operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
+    operator()(Ts&&... xs) BOOST_HOF_DETAIL_PACK_CONST_REF BOOST_HOF_SFINAE_RETURNS
     (
         boost::hof::pack_join
         (
@@ -138,6 +213,20 @@ struct capture_invoke : detail::compressed_pair<detail::callable_base<F>, Pack>,
         )
         (BOOST_HOF_RETURNS_C_CAST(detail::callable_base<F>&&)(BOOST_HOF_CONST_THIS->base_function(xs...)))
     );
+
+#if BOOST_HOF_DETAIL_PACK_HAS_RVALUE_CALL
+    // The captured values and the function are moved into the call, so the
+    // values don't have to be copyable
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) && BOOST_HOF_RETURNS
+    (
+        boost::hof::alias_value(BOOST_HOF_RETURNS_STATIC_CAST(typename base::second_base&&)(*BOOST_HOF_THIS), xs...)
+        (boost::hof::detail::make_pack_append_invoke(
+            boost::hof::alias_value(BOOST_HOF_RETURNS_STATIC_CAST(typename base::first_base&&)(*BOOST_HOF_THIS), xs...), 
+            boost::hof::pack_forward(BOOST_HOF_FORWARD(Ts)(xs)...)
+        ))
+    );
+#endif
 };
 
 template<class Pack>
@@ -149,7 +238,7 @@ struct capture_pack : Pack
 
     // TODO: Should use rvalue ref qualifier
     template<class F>
-    constexpr auto operator()(F f) const BOOST_HOF_SFINAE_RETURNS
+    BOOST_HOF_INLINE constexpr auto operator()(F f) const BOOST_HOF_SFINAE_RETURNS
     (
         capture_invoke<F, Pack>(BOOST_HOF_RETURNS_STATIC_CAST(F&&)(f), 
             BOOST_HOF_RETURNS_C_CAST(Pack&&)(
@@ -162,18 +251,598 @@ struct capture_pack : Pack
 struct make_capture_pack_f
 {
     template<class Pack>
-    constexpr capture_pack<Pack> operator()(Pack p) const
+    BOOST_HOF_INLINE constexpr capture_pack<Pack> operator()(Pack p) const
     BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(capture_pack<Pack>, Pack&&)
     {
         return capture_pack<Pack>(static_cast<Pack&&>(p));
     }
 };
 
+template<class Pack, class Alloc>
+struct alloc_pack_tag
+{};
+
+// Owns a pack that is stored in memory from the allocator. The allocator is
+// inherited when possible, so an empty allocator takes no space.
+template<class Pack, class Alloc>
+struct alloc_pack
+: detail::alias_try_inherit<
+    typename std::allocator_traits<Alloc>::template rebind_alloc<Pack>,
+    alloc_pack_tag<Pack, Alloc>
+>::type
+{
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Pack> allocator_type;
+    typedef typename detail::alias_try_inherit<allocator_type, alloc_pack_tag<Pack, Alloc>>::type alloc_base;
+    typedef std::allocator_traits<allocator_type> traits;
+    typedef typename traits::pointer pointer;
+
+    pointer p;
+
+    template<class... Xs>
+    static pointer create(allocator_type& a, Xs&&... xs)
+    {
+        pointer r = traits::allocate(a, 1);
+        try
+        {
+            traits::construct(a, std::addressof(*r), BOOST_HOF_FORWARD(Xs)(xs)...);
+        }
+        catch(...)
+        {
+            traits::deallocate(a, r, 1);
+            throw;
+        }
+        return r;
+    }
+
+    allocator_type& get_allocator() noexcept
+    {
+        return boost::hof::alias_value(static_cast<alloc_base&>(*this));
+    }
+
+    const allocator_type& get_allocator() const noexcept
+    {
+        return boost::hof::alias_value(static_cast<const alloc_base&>(*this));
+    }
+
+    template<class X>
+    alloc_pack(const Alloc& a, X&& x)
+    : alloc_base(allocator_type(a)), p(create(this->get_allocator(), BOOST_HOF_FORWARD(X)(x)))
+    {}
+
+    alloc_pack(const alloc_pack& rhs)
+    : alloc_base(traits::select_on_container_copy_construction(rhs.get_allocator())),
+      p(create(this->get_allocator(), *rhs.p))
+    {}
+
+    alloc_pack(alloc_pack&& rhs) noexcept
+    : alloc_base(static_cast<alloc_base&&>(rhs)), p(rhs.p)
+    {
+        rhs.p = nullptr;
+    }
+
+    alloc_pack& operator=(const alloc_pack&) = delete;
+
+    void destroy(std::true_type)
+    {}
+
+    void destroy(std::false_type)
+    {
+        traits::destroy(this->get_allocator(), std::addressof(*p));
+    }
+
+    ~alloc_pack()
+    {
+        if (p == nullptr) return;
+        this->destroy(std::is_trivially_destructible<Pack>());
+        traits::deallocate(this->get_allocator(), p, 1);
+    }
+
+    const Pack& get() const noexcept
+    {
+        return *p;
+    }
+};
+
+// Calls the function with the captured values followed by the arguments.
+// The captured values are passed the same way as calling the pack, so they
+// don't have to be copyable.
+template<class F, class Ys>
+struct capture_alloc_append
+{
+    const F& f;
+    const Ys& ys;
+
+    template<class... Xs>
+    BOOST_HOF_INLINE auto operator()(Xs&&... xs) const -> decltype(
+        boost::hof::pack_join(boost::hof::pack_forward(std::declval<Xs>()...), std::declval<const Ys&>())
+        (std::declval<const F&>())
+    )
+    {
+        return boost::hof::pack_join(boost::hof::pack_forward(BOOST_HOF_FORWARD(Xs)(xs)...), ys)(f);
+    }
+};
+
+template<class F, class Pack, class Alloc>
+struct capture_alloc_invoke
+: detail::compressed_pair<detail::callable_base<F>, alloc_pack<Pack, Alloc>>
+{
+    typedef detail::compressed_pair<detail::callable_base<F>, alloc_pack<Pack, Alloc>> base;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(capture_alloc_invoke, base)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    template<class... Ts>
+    const Pack& get_pack(Ts&&... xs) const noexcept
+    {
+        return this->second(xs...).get();
+    }
+
+    template<class... Ts, class Ys=decltype(boost::hof::pack_forward(std::declval<Ts>()...))>
+    BOOST_HOF_INLINE auto operator()(Ts&&... xs) const -> decltype(
+        std::declval<const Pack&>()(std::declval<capture_alloc_append<detail::callable_base<F>, Ys>>())
+    )
+    {
+        return this->get_pack(xs...)(capture_alloc_append<detail::callable_base<F>, Ys>{
+            this->base_function(xs...), boost::hof::pack_forward(BOOST_HOF_FORWARD(Ts)(xs)...)
+        });
+    }
+};
+
+template<class Pack, class Alloc>
+struct capture_alloc_pack
+{
+    Alloc alloc;
+    Pack pack;
+
+    template<class X>
+    capture_alloc_pack(const Alloc& a, X&& x)
+    : alloc(a), pack(BOOST_HOF_FORWARD(X)(x))
+    {}
+
+#if BOOST_HOF_NO_REF_QUALIFIERS
+    template<class F>
+    BOOST_HOF_INLINE capture_alloc_invoke<F, Pack, Alloc> operator()(F f) const
+    {
+        return capture_alloc_invoke<F, Pack, Alloc>(static_cast<F&&>(f), alloc_pack<Pack, Alloc>(alloc, pack));
+    }
+#else
+    template<class F>
+    BOOST_HOF_INLINE capture_alloc_invoke<F, Pack, Alloc> operator()(F f) const&
+    {
+        return capture_alloc_invoke<F, Pack, Alloc>(static_cast<F&&>(f), alloc_pack<Pack, Alloc>(alloc, pack));
+    }
+
+    // The captured values are moved into the allocated storage
+    template<class F>
+    BOOST_HOF_INLINE capture_alloc_invoke<F, Pack, Alloc> operator()(F f) &&
+    {
+        return capture_alloc_invoke<F, Pack, Alloc>(static_cast<F&&>(f), alloc_pack<Pack, Alloc>(alloc, static_cast<Pack&&>(pack)));
+    }
+#endif
+};
+
+struct capture_alloc_f
+{
+    template<class Alloc, class... Ts>
+    BOOST_HOF_INLINE capture_alloc_pack<decltype(boost::hof::pack(std::declval<Ts>()...)), Alloc>
+    operator()(const Alloc& a, Ts&&... xs) const
+    {
+        return capture_alloc_pack<decltype(boost::hof::pack(std::declval<Ts>()...)), Alloc>(
+            a, boost::hof::pack(BOOST_HOF_FORWARD(Ts)(xs)...)
+        );
+    }
+};
+
+inline void shared_capture_acquire(std::size_t& n) noexcept
+{
+    n++;
+}
+
+inline void shared_capture_acquire(std::atomic<std::size_t>& n) noexcept
+{
+    n.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline bool shared_capture_release(std::size_t& n) noexcept
+{
+    return --n == 0;
+}
+
+inline bool shared_capture_release(std::atomic<std::size_t>& n) noexcept
+{
+    return n.fetch_sub(1, std::memory_order_acq_rel) == 1;
+}
+
+inline std::size_t shared_capture_count(const std::size_t& n) noexcept
+{
+    return n;
+}
+
+inline std::size_t shared_capture_count(const std::atomic<std::size_t>& n) noexcept
+{
+    return n.load(std::memory_order_acquire);
+}
+
+template<class Count, class... Ts>
+struct shared_capture_block
+{
+    Count count;
+    std::tuple<Ts...> values;
+
+    template<class... Xs>
+    explicit shared_capture_block(Xs&&... xs)
+    : count(1), values(BOOST_HOF_FORWARD(Xs)(xs)...)
+    {}
+
+    shared_capture_block(const shared_capture_block& rhs)
+    : count(1), values(rhs.values)
+    {}
+};
+
+// Owns a reference to a block of captured values, which is only copied
+// when it is shared and the values are about to be modified
+template<class Count, class... Ts>
+struct shared_capture_ptr
+{
+    typedef shared_capture_block<Count, Ts...> block_type;
+    block_type* p;
+
+    template<class... Xs>
+    explicit shared_capture_ptr(int, Xs&&... xs)
+    : p(new block_type(BOOST_HOF_FORWARD(Xs)(xs)...))
+    {}
+
+    shared_capture_ptr(const shared_capture_ptr& rhs) noexcept
+    : p(rhs.p)
+    {
+        detail::shared_capture_acquire(p->count);
+    }
+
+    shared_capture_ptr(shared_capture_ptr&& rhs) noexcept
+    : p(rhs.p)
+    {
+        rhs.p = nullptr;
+    }
+
+    shared_capture_ptr& operator=(const shared_capture_ptr&) = delete;
+
+    ~shared_capture_ptr()
+    {
+        if (p != nullptr && detail::shared_capture_release(p->count)) delete p;
+    }
+
+    const std::tuple<Ts...>& get() const noexcept
+    {
+        return p->values;
+    }
+
+    std::tuple<Ts...>& get_unique()
+    {
+        if (this->use_count() != 1)
+        {
+            block_type* q = new block_type(static_cast<const block_type&>(*p));
+            if (detail::shared_capture_release(p->count)) delete p;
+            p = q;
+        }
+        return p->values;
+    }
+
+    std::size_t use_count() const noexcept
+    {
+        return detail::shared_capture_count(p->count);
+    }
+};
+
+template<class F, class Tuple, std::size_t... Ns, class... Xs>
+BOOST_HOF_INLINE auto shared_capture_apply(seq<Ns...>, F&& f, Tuple&& t, Xs&&... xs)
+BOOST_HOF_RETURNS(f(std::get<Ns>(t)..., BOOST_HOF_FORWARD(Xs)(xs)...));
+
+template<class F, class Count, class... Ts>
+struct capture_shared_invoke
+: detail::compressed_pair<detail::callable_base<F>, shared_capture_ptr<Count, Ts...>>
+{
+    typedef detail::compressed_pair<detail::callable_base<F>, shared_capture_ptr<Count, Ts...>> base;
+    typedef typename gens<sizeof...(Ts)>::type seq_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(capture_shared_invoke, base)
+
+    template<class... Xs>
+    BOOST_HOF_INLINE const detail::callable_base<F>& base_function(Xs&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    std::size_t use_count() const noexcept
+    {
+        return this->second().use_count();
+    }
+
+    template<class G>
+    auto update(G&& g) -> decltype(
+        detail::shared_capture_apply(seq_type(), g, std::declval<std::tuple<Ts...>&>())
+    )
+    {
+        return detail::shared_capture_apply(seq_type(), g, 
+            boost::hof::alias_value(static_cast<typename base::second_base&>(*this)).get_unique());
+    }
+
+    template<class... Xs>
+    BOOST_HOF_INLINE auto operator()(Xs&&... xs) const -> decltype(
+        detail::shared_capture_apply(seq_type(), std::declval<const detail::callable_base<F>&>(), 
+            std::declval<const std::tuple<Ts...>&>(), std::declval<Xs>()...)
+    )
+    {
+        return detail::shared_capture_apply(seq_type(), this->base_function(xs...), 
+            this->second(xs...).get(), BOOST_HOF_FORWARD(Xs)(xs)...);
+    }
+};
+
+template<class Count, class... Ts>
+struct capture_shared_pack
+{
+    shared_capture_ptr<Count, Ts...> ptr;
+
+    template<class... Xs>
+    explicit capture_shared_pack(int, Xs&&... xs)
+    : ptr(0, BOOST_HOF_FORWARD(Xs)(xs)...)
+    {}
+
+    std::size_t use_count() const noexcept
+    {
+        return ptr.use_count();
+    }
+
+    // Every function shares the same block of values
+    template<class F>
+    BOOST_HOF_INLINE capture_shared_invoke<F, Count, Ts...> operator()(F f) const
+    {
+        return capture_shared_invoke<F, Count, Ts...>(static_cast<F&&>(f), ptr);
+    }
+};
+
+struct capture_shared_f
+{
+    template<class... Ts, class=typename std::enable_if<(!is_single_thread_first<typename std::decay<Ts>::type...>::value)>::type>
+    capture_shared_pack<std::atomic<std::size_t>, typename std::decay<Ts>::type...>
+    operator()(Ts&&... xs) const
+    {
+        return capture_shared_pack<std::atomic<std::size_t>, typename std::decay<Ts>::type...>(0, BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+
+    template<class Tag, class... Ts, class=typename std::enable_if<(is_single_thread_first<typename std::decay<Tag>::type>::value)>::type>
+    capture_shared_pack<std::size_t, typename std::decay<Ts>::type...>
+    operator()(Tag&&, Ts&&... xs) const
+    {
+        return capture_shared_pack<std::size_t, typename std::decay<Ts>::type...>(0, BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+template<class T>
+struct cold_value_t
+{
+    T&& value;
+};
+
+struct cold_value_f
+{
+    template<class T>
+    constexpr cold_value_t<T> operator()(T&& x) const noexcept
+    {
+        return cold_value_t<T>{BOOST_HOF_FORWARD(T)(x)};
+    }
+};
+
+template<class... Ts>
+struct cold_capture_types
+{};
+
+// Reads a captured value from the inline values or the cold block
+template<bool Cold, std::size_t I>
+struct cold_capture_index;
+
+template<std::size_t I>
+struct cold_capture_index<false, I>
+{
+    template<class Hot, class Cold>
+    static constexpr auto get(const Hot& hot, const Cold&) BOOST_HOF_RETURNS
+    (std::get<I>(hot));
+};
+
+template<std::size_t I>
+struct cold_capture_index<true, I>
+{
+    template<class Hot, class Cold>
+    static constexpr auto get(const Hot&, const Cold& cold) BOOST_HOF_RETURNS
+    (std::get<I>(cold));
+};
+
+template<class T>
+struct cold_capture_cold
+: std::false_type
+{};
+
+template<class T>
+struct cold_capture_cold<cold_value_t<T>>
+: std::true_type
+{};
+
+template<class T>
+struct cold_capture_decay
+: std::decay<T>
+{};
+
+template<class T>
+struct cold_capture_decay<cold_value_t<T>>
+: std::decay<T>
+{};
+
+template<class T>
+BOOST_HOF_INLINE constexpr T&& cold_capture_value(T&& x) noexcept
+{
+    return BOOST_HOF_FORWARD(T)(x);
+}
+
+template<class T>
+BOOST_HOF_INLINE constexpr T&& cold_capture_value(cold_value_t<T> x) noexcept
+{
+    return BOOST_HOF_FORWARD(T)(x.value);
+}
+
+// Splits the values into the hot and cold values, along with where each
+// value is read from, in the order they were given
+template<class Hot, class Cold, class Index, class... Ts>
+struct cold_capture_split;
+
+template<class... Hs, class... Cs, class... Is>
+struct cold_capture_split<cold_capture_types<Hs...>, cold_capture_types<Cs...>, cold_capture_types<Is...>>
+{
+    typedef cold_capture_types<Hs...> hot;
+    typedef cold_capture_types<Cs...> cold;
+    typedef cold_capture_types<Is...> index;
+};
+
+template<class... Hs, class... Cs, class... Is, class T, class... Ts>
+struct cold_capture_split<cold_capture_types<Hs...>, cold_capture_types<Cs...>, cold_capture_types<Is...>, T, Ts...>
+: std::conditional<cold_capture_cold<T>::value,
+    cold_capture_split<
+        cold_capture_types<Hs...>,
+        cold_capture_types<Cs..., typename cold_capture_decay<T>::type>,
+        cold_capture_types<Is..., cold_capture_index<true, sizeof...(Cs)>>,
+        Ts...
+    >,
+    cold_capture_split<
+        cold_capture_types<Hs..., typename cold_capture_decay<T>::type>,
+        cold_capture_types<Cs...>,
+        cold_capture_types<Is..., cold_capture_index<false, sizeof...(Hs)>>,
+        Ts...
+    >
+>::type
+{};
+
+template<class... Ts>
+struct cold_capture_layout
+: cold_capture_split<cold_capture_types<>, cold_capture_types<>, cold_capture_types<>, typename std::decay<Ts>::type...>
+{};
+
+// The hot values are stored inline, and the cold values in one block that
+// every copy shares, since they are never modified
+template<class Hot, class Cold>
+struct cold_capture_storage;
+
+template<class... Hs, class... Cs>
+struct cold_capture_storage<cold_capture_types<Hs...>, cold_capture_types<Cs...>>
+{
+    std::tuple<Hs...> hot;
+    shared_capture_ptr<std::atomic<std::size_t>, Cs...> cold;
+
+    template<class Tuple>
+    cold_capture_storage(Tuple&& h, shared_capture_ptr<std::atomic<std::size_t>, Cs...> c)
+    : hot(BOOST_HOF_FORWARD(Tuple)(h)), cold(static_cast<shared_capture_ptr<std::atomic<std::size_t>, Cs...>&&>(c))
+    {}
+
+    const std::tuple<Cs...>& get_cold() const noexcept
+    {
+        return cold.get();
+    }
+};
+
+template<class F, class Storage, class Index>
+struct cold_capture_invoke;
+
+template<class F, class Storage, class... Is>
+struct cold_capture_invoke<F, Storage, cold_capture_types<Is...>>
+: detail::compressed_pair<detail::callable_base<F>, Storage>
+{
+    typedef detail::compressed_pair<detail::callable_base<F>, Storage> base;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(cold_capture_invoke, base)
+
+    template<class... Xs>
+    BOOST_HOF_INLINE const detail::callable_base<F>& base_function(Xs&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    template<class... Xs>
+    const Storage& get_storage(Xs&&... xs) const noexcept
+    {
+        return this->second(xs...);
+    }
+
+    // The cold values are passed as references into the block, so it is
+    // only read when the function reads them
+    template<class... Xs>
+    BOOST_HOF_INLINE auto operator()(Xs&&... xs) const -> decltype(
+        std::declval<const detail::callable_base<F>&>()(
+            Is::get(std::declval<const Storage&>().hot, std::declval<const Storage&>().get_cold())...,
+            std::declval<Xs>()...
+        )
+    )
+    {
+        return this->base_function(xs...)(
+            Is::get(this->get_storage(xs...).hot, this->get_storage(xs...).get_cold())...,
+            BOOST_HOF_FORWARD(Xs)(xs)...
+        );
+    }
+};
+
+template<class Layout, class Hot=typename Layout::hot, class Cold=typename Layout::cold>
+struct cold_capture_pack;
+
+template<class Layout, class... Hs, class... Cs>
+struct cold_capture_pack<Layout, cold_capture_types<Hs...>, cold_capture_types<Cs...>>
+{
+    typedef cold_capture_storage<cold_capture_types<Hs...>, cold_capture_types<Cs...>> storage_type;
+    std::tuple<Hs...> hot;
+    shared_capture_ptr<std::atomic<std::size_t>, Cs...> cold;
+
+    template<class HotTuple, class ColdTuple, std::size_t... Ns>
+    cold_capture_pack(seq<Ns...>, HotTuple&& h, ColdTuple&& c)
+    : hot(BOOST_HOF_FORWARD(HotTuple)(h)), cold(0, std::get<Ns>(BOOST_HOF_FORWARD(ColdTuple)(c))...)
+    {}
+
+    template<class F>
+    BOOST_HOF_INLINE cold_capture_invoke<F, storage_type, typename Layout::index> operator()(F f) const
+    {
+        return cold_capture_invoke<F, storage_type, typename Layout::index>(static_cast<F&&>(f), storage_type(hot, cold));
+    }
+};
+
+// Collects the values of each kind as a tuple of references
+template<bool Cold>
+struct cold_capture_select
+{
+    template<class T, typename std::enable_if<(cold_capture_cold<typename std::decay<T>::type>::value == Cold), int>::type = 0>
+    BOOST_HOF_INLINE auto operator()(T&& x) const BOOST_HOF_RETURNS
+    (std::forward_as_tuple(detail::cold_capture_value(BOOST_HOF_FORWARD(T)(x))));
+
+    template<class T, typename std::enable_if<(cold_capture_cold<typename std::decay<T>::type>::value != Cold), int>::type = 0>
+    BOOST_HOF_INLINE std::tuple<> operator()(T&&) const noexcept
+    {
+        return std::tuple<>();
+    }
+};
+
+struct cold_capture_f
+{
+    template<class... Ts, class Layout=cold_capture_layout<Ts...>>
+    cold_capture_pack<Layout> operator()(Ts&&... xs) const
+    {
+        return cold_capture_pack<Layout>(
+            typename gens<std::tuple_size<decltype(std::tuple_cat(cold_capture_select<true>()(BOOST_HOF_FORWARD(Ts)(xs))...))>::value>::type(),
+            std::tuple_cat(cold_capture_select<false>()(BOOST_HOF_FORWARD(Ts)(xs))...),
+            std::tuple_cat(cold_capture_select<true>()(BOOST_HOF_FORWARD(Ts)(xs))...)
+        );
+    }
+};
+
 template<class F>
 struct capture_f
 {
     template<class... Ts>
-    constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
     (
         BOOST_HOF_RETURNS_CONSTRUCT(make_capture_pack_f)()(BOOST_HOF_RETURNS_CONSTRUCT(F)()(BOOST_HOF_FORWARD(Ts)(xs)...))
     );
@@ -183,6 +852,11 @@ struct capture_f
 BOOST_HOF_DECLARE_STATIC_VAR(capture_basic, detail::capture_f<detail::pack_basic_f>);
 BOOST_HOF_DECLARE_STATIC_VAR(capture_forward, detail::capture_f<detail::pack_forward_f>);
 BOOST_HOF_DECLARE_STATIC_VAR(capture, detail::capture_f<detail::pack_f>);
+BOOST_HOF_DECLARE_STATIC_VAR(capture_alloc, detail::capture_alloc_f);
+BOOST_HOF_DECLARE_STATIC_VAR(capture_shared, detail::capture_shared_f);
+BOOST_HOF_DECLARE_STATIC_VAR(single_thread, single_thread_t);
+BOOST_HOF_DECLARE_STATIC_VAR(cold_capture, detail::cold_capture_f);
+BOOST_HOF_DECLARE_STATIC_VAR(cold_value, detail::cold_value_f);
 
 }} // namespace boost::hof
 
@@ -0,0 +1,112 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    co_compose.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_CO_COMPOSE_H
+#define BOOST_HOF_GUARD_CO_COMPOSE_H
+
+/// co_compose
+/// ==========
+///
+/// Description
+/// -----------
+///
+/// The `co_compose` function adaptor works like [`compose`](compose), except
+/// a function can return an awaitable, such as a [`co_task`](co_task). It is
+/// the same as [`co_flow`](co_flow) with the evaluation order reversed. So,
+/// `co_compose(f, g)(0)` awaits `g(0)` if it is awaitable, and then passes
+/// the result to `f`.
+///
+/// This is only available when `BOOST_HOF_HAS_COROUTINES` is enabled.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Fs>
+///     co_compose_adaptor<Fs...> co_compose(Fs... fs);
+///
+/// Semantics
+/// ---------
+///
+///     assert(co_compose(f, g)(xs...).get() == f(co_await g(xs...)));
+///
+/// Requirements
+/// ------------
+///
+/// Fs must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * CopyConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int main() {
+///         auto f = boost::hof::co_compose(
+///             [](int x) { return x * 2; },
+///             [](int x) -> boost::hof::co_task<int> { co_return x + 1; }
+///         );
+///         assert(f(1).get() == 4);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [compose](compose)
+/// * [co_flow](co_flow)
+/// * [co_task](co_task)
+///
+
+#include <boost/hof/detail/co_flow_kernel.hpp>
+
+#if BOOST_HOF_HAS_COROUTINES
+
+#include <boost/hof/detail/join.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+
+namespace boost { namespace hof {
+
+template<class F, class... Fs>
+struct co_compose_adaptor : detail::co_flow_kernel<BOOST_HOF_JOIN(co_compose_adaptor, Fs...), F>
+{
+    typedef BOOST_HOF_JOIN(co_compose_adaptor, Fs...) tail;
+    typedef detail::co_flow_kernel<tail, F> base_type;
+
+    BOOST_HOF_INHERIT_DEFAULT(co_compose_adaptor, base_type)
+
+    template<class X, class... Xs,
+        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(detail::callable_base<F>, X),
+        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(tail, Xs...)
+    >
+    constexpr co_compose_adaptor(X&& f1, Xs&& ... fs)
+    : base_type(tail(BOOST_HOF_FORWARD(Xs)(fs)...), BOOST_HOF_FORWARD(X)(f1))
+    {}
+};
+
+template<class F>
+struct co_compose_adaptor<F> : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_DEFAULT(co_compose_adaptor, detail::callable_base<F>)
+
+    template<class X, BOOST_HOF_ENABLE_IF_CONVERTIBLE(X, detail::callable_base<F>)>
+    constexpr co_compose_adaptor(X&& f1)
+    : detail::callable_base<F>(BOOST_HOF_FORWARD(X)(f1))
+    {}
+};
+
+BOOST_HOF_DETAIL_COMPILE_MARKER(co_compose, co_compose_adaptor)
+
+BOOST_HOF_DECLARE_STATIC_VAR(co_compose, detail::make<co_compose_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
+
+#endif
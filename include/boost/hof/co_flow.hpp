@@ -0,0 +1,128 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    co_flow.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_CO_FLOW_H
+#define BOOST_HOF_GUARD_CO_FLOW_H
+
+/// co_flow
+/// =======
+///
+/// Description
+/// -----------
+///
+/// The `co_flow` function adaptor works like [`flow`](flow), except a stage
+/// can return an awaitable, such as a [`co_task`](co_task). When a stage
+/// returns an awaitable, the rest of the stages are run in a coroutine after
+/// the awaitable has finished, and a `co_task` of the final result is
+/// returned. Stages that do not return an awaitable are called directly, so
+/// only one coroutine frame is created for each awaitable stage. If no stage
+/// returns an awaitable, then it is the same as `flow`.
+///
+/// Each coroutine takes a copy of the next function, so the task can be
+/// awaited after the adaptor is gone. The arguments to the first stage are
+/// not copied, so they must outlive the task if the first stage refers to
+/// them.
+///
+/// This is only available when `BOOST_HOF_HAS_COROUTINES` is enabled.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Fs>
+///     co_flow_adaptor<Fs...> co_flow(Fs... fs);
+///
+/// Semantics
+/// ---------
+///
+///     assert(co_flow(f, g)(xs...).get() == g(co_await f(xs...)));
+///
+/// Requirements
+/// ------------
+///
+/// Fs must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * CopyConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int main() {
+///         auto f = boost::hof::co_flow(
+///             [](int x) -> boost::hof::co_task<int> { co_return x + 1; },
+///             [](int x) { return x * 2; }
+///         );
+///         assert(f(1).get() == 4);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [flow](flow)
+/// * [co_compose](co_compose)
+/// * [co_task](co_task)
+///
+
+#include <boost/hof/detail/co_flow_kernel.hpp>
+
+#if BOOST_HOF_HAS_COROUTINES
+
+#include <boost/hof/detail/join.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+
+namespace boost { namespace hof {
+
+template<class F, class... Fs>
+struct co_flow_adaptor : detail::co_flow_kernel<F, BOOST_HOF_JOIN(co_flow_adaptor, Fs...)>
+{
+    typedef BOOST_HOF_JOIN(co_flow_adaptor, Fs...) tail;
+    typedef detail::co_flow_kernel<F, tail> base_type;
+
+    BOOST_HOF_INHERIT_DEFAULT(co_flow_adaptor, base_type)
+
+    template<class X, class... Xs,
+        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(detail::callable_base<F>, X),
+        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(tail, Xs...)
+    >
+    constexpr co_flow_adaptor(X&& f1, Xs&& ... fs)
+    : base_type(BOOST_HOF_FORWARD(X)(f1), tail(BOOST_HOF_FORWARD(Xs)(fs)...))
+    {}
+};
+
+template<class F>
+struct co_flow_adaptor<F> : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_DEFAULT(co_flow_adaptor, detail::callable_base<F>)
+
+    template<class X, BOOST_HOF_ENABLE_IF_CONVERTIBLE(X, detail::callable_base<F>)>
+    constexpr co_flow_adaptor(X&& f1)
+    : detail::callable_base<F>(BOOST_HOF_FORWARD(X)(f1))
+    {}
+};
+
+template<class F1, class F2>
+struct co_flow_adaptor<F1, F2>
+: detail::co_flow_kernel<F1, F2>
+{
+    typedef detail::co_flow_kernel<F1, F2> base_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(co_flow_adaptor, base_type)
+};
+
+BOOST_HOF_DETAIL_COMPILE_MARKER(co_flow, co_flow_adaptor)
+
+BOOST_HOF_DECLARE_STATIC_VAR(co_flow, detail::make<co_flow_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
+
+#endif
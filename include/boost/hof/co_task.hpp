@@ -0,0 +1,429 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    co_task.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_CO_TASK_H
+#define BOOST_HOF_GUARD_CO_TASK_H
+
+/// co_task
+/// =======
+///
+/// Description
+/// -----------
+///
+/// The `co_task` class is a lazy coroutine type. The coroutine does not
+/// start until the task is awaited, or until `get` is called, which runs the
+/// coroutine and waits for it to finish. When the coroutine finishes, it
+/// resumes the awaiting coroutine directly by symmetric transfer, so there is
+/// no scheduling between the stages of a chain of tasks.
+///
+/// This is the type returned by [`co_flow`](co_flow) and
+/// [`co_compose`](co_compose) when one of the stages is awaitable. The
+/// `is_co_awaitable` trait can be used to check if a type can be awaited.
+///
+/// This is only available when `BOOST_HOF_HAS_COROUTINES` is enabled.
+///
+/// Synopsis
+/// --------
+///
+///     template<class T>
+///     struct co_task
+///     {
+///         bool valid() const noexcept;
+///         awaiter operator co_await() const noexcept;
+///         T get();
+///     };
+///
+///     template<class T>
+///     struct is_co_awaitable;
+///
+/// Requirements
+/// ------------
+///
+/// T must be:
+///
+/// * MoveConstructible
+/// * Or void
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     boost::hof::co_task<int> three()
+///     {
+///         co_return 3;
+///     }
+///
+///     boost::hof::co_task<int> add_one()
+///     {
+///         co_return (co_await three()) + 1;
+///     }
+///
+///     int main() {
+///         assert(add_one().get() == 4);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [co_flow](co_flow)
+/// * [co_compose](co_compose)
+///
+
+#include <boost/hof/config.hpp>
+
+#if BOOST_HOF_HAS_COROUTINES
+
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/holder.hpp>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+template<class T>
+struct co_task;
+
+namespace detail {
+
+template<class T>
+auto co_get_awaiter(T&& x, int) -> decltype(static_cast<T&&>(x).operator co_await())
+{
+    return static_cast<T&&>(x).operator co_await();
+}
+
+template<class T>
+auto co_get_awaiter(T&& x, long) -> decltype(operator co_await(static_cast<T&&>(x)))
+{
+    return operator co_await(static_cast<T&&>(x));
+}
+
+template<class T>
+T&& co_get_awaiter(T&& x, ...)
+{
+    return static_cast<T&&>(x);
+}
+
+template<class T, class=void>
+struct is_co_awaitable_impl
+: std::false_type
+{};
+
+template<class T>
+struct is_co_awaitable_impl<T, typename holder<
+    decltype(co_get_awaiter(std::declval<T>(), 0).await_ready()),
+    decltype(co_get_awaiter(std::declval<T>(), 0).await_resume())
+>::type>
+: std::true_type
+{};
+
+}
+
+template<class T>
+struct is_co_awaitable
+: detail::is_co_awaitable_impl<T>
+{};
+
+namespace detail {
+
+template<class T>
+struct co_await_result
+{
+    typedef decltype(co_get_awaiter(std::declval<T>(), 0).await_resume()) type;
+};
+
+struct co_promise_base
+{
+    std::coroutine_handle<> continuation = std::noop_coroutine();
+    std::exception_ptr error;
+
+    struct final_awaiter
+    {
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template<class Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) const noexcept
+        {
+            return h.promise().continuation;
+        }
+
+        void await_resume() const noexcept
+        {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    final_awaiter final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    void unhandled_exception() noexcept
+    {
+        error = std::current_exception();
+    }
+
+    void check() const
+    {
+        if (error) std::rethrow_exception(error);
+    }
+};
+
+template<class T>
+struct co_promise : co_promise_base
+{
+    std::optional<T> value;
+
+    co_task<T> get_return_object() noexcept;
+
+    template<class X>
+    void return_value(X&& x)
+    {
+        value.emplace(BOOST_HOF_FORWARD(X)(x));
+    }
+
+    T result()
+    {
+        this->check();
+        return std::move(*value);
+    }
+};
+
+template<>
+struct co_promise<void> : co_promise_base
+{
+    co_task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept
+    {}
+
+    void result() const
+    {
+        this->check();
+    }
+};
+
+// Awaits for the task to finish without taking its result
+struct co_ready_awaiter
+{
+    std::coroutine_handle<> h;
+    co_promise_base* p;
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> c) const noexcept
+    {
+        p->continuation = c;
+        return h;
+    }
+
+    void await_resume() const noexcept
+    {}
+};
+
+// The task may finish on another thread, so the waiting thread is notified
+// after the waiting coroutine has suspended for the last time.
+struct co_wait_state
+{
+    std::mutex m;
+    std::condition_variable cv;
+    bool done = false;
+
+    void set()
+    {
+        std::lock_guard<std::mutex> lock(m);
+        done = true;
+        cv.notify_all();
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m);
+        cv.wait(lock, [this] { return done; });
+    }
+};
+
+struct co_wait_task
+{
+    struct promise_type
+    {
+        co_wait_state* state = nullptr;
+
+        struct final_awaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<promise_type> h) const noexcept
+            {
+                h.promise().state->set();
+            }
+
+            void await_resume() const noexcept
+            {}
+        };
+
+        co_wait_task get_return_object() noexcept
+        {
+            return co_wait_task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        final_awaiter final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void return_void() const noexcept
+        {}
+
+        void unhandled_exception() const noexcept
+        {}
+    };
+
+    std::coroutine_handle<promise_type> h;
+
+    explicit co_wait_task(std::coroutine_handle<promise_type> x) noexcept
+    : h(x)
+    {}
+
+    co_wait_task(const co_wait_task&) = delete;
+    co_wait_task& operator=(const co_wait_task&) = delete;
+
+    ~co_wait_task()
+    {
+        h.destroy();
+    }
+};
+
+inline co_wait_task co_wait_for(co_ready_awaiter a)
+{
+    co_await a;
+}
+
+inline void co_run(std::coroutine_handle<> h, co_promise_base& p)
+{
+    co_wait_state state;
+    co_wait_task w = co_wait_for(co_ready_awaiter{h, &p});
+    w.h.promise().state = &state;
+    w.h.resume();
+    state.wait();
+}
+
+}
+
+template<class T>
+struct co_task
+{
+    typedef detail::co_promise<T> promise_type;
+    typedef std::coroutine_handle<promise_type> handle_type;
+
+    struct awaiter
+    {
+        handle_type h;
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> c) const noexcept
+        {
+            h.promise().continuation = c;
+            return h;
+        }
+
+        T await_resume() const
+        {
+            return h.promise().result();
+        }
+    };
+
+    co_task() noexcept : h()
+    {}
+
+    explicit co_task(handle_type x) noexcept : h(x)
+    {}
+
+    co_task(co_task&& rhs) noexcept : h(std::exchange(rhs.h, {}))
+    {}
+
+    co_task& operator=(co_task&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            if (h) h.destroy();
+            h = std::exchange(rhs.h, {});
+        }
+        return *this;
+    }
+
+    ~co_task()
+    {
+        if (h) h.destroy();
+    }
+
+    bool valid() const noexcept
+    {
+        return static_cast<bool>(h);
+    }
+
+    awaiter operator co_await() const noexcept
+    {
+        return awaiter{h};
+    }
+
+    T get()
+    {
+        if (!h.done()) detail::co_run(h, h.promise());
+        return h.promise().result();
+    }
+private:
+    handle_type h;
+};
+
+namespace detail {
+
+template<class T>
+co_task<T> co_promise<T>::get_return_object() noexcept
+{
+    return co_task<T>(std::coroutine_handle<co_promise>::from_promise(*this));
+}
+
+inline co_task<void> co_promise<void>::get_return_object() noexcept
+{
+    return co_task<void>(std::coroutine_handle<co_promise>::from_promise(*this));
+}
+
+}
+
+}} // namespace boost::hof
+
+#endif
+
+#endif
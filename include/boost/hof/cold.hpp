@@ -0,0 +1,171 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    cold.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_COLD_H
+#define BOOST_HOF_GUARD_COLD_H
+
+/// cold
+/// ====
+///
+/// Description
+/// -----------
+///
+/// The `cold` function adaptor marks a function that is rarely called, such
+/// as an error handler, or the fallback of [`first_of`](first_of). Its call
+/// operator is never inlined and is placed with the other cold code, using
+/// `BOOST_HOF_COLD`, so the code of the function stays out of the hot
+/// instruction stream of the callers. Calls to a cold function are also
+/// predicted as not taken by the compiler.
+///
+/// The `likely_` and `unlikely_` adaptors are for predicates that are used in
+/// a branch, such as the predicate of [`repeat_while`](repeat_while). They
+/// return the result of the predicate as a `bool`, with a hint of which way
+/// the branch usually goes, using `BOOST_HOF_LIKELY` and `BOOST_HOF_UNLIKELY`.
+/// The hints only have an effect where the predicate is inlined into the
+/// branch.
+///
+/// The choice made by [`if_`](if) and `first_of` happens at compile time, so
+/// they have no branch to hint, but the function that is chosen can still be
+/// `cold`.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F>
+///     constexpr cold_adaptor<F> cold(F f);
+///
+///     template<class F>
+///     constexpr likely_adaptor<F> likely_(F f);
+///
+///     template<class F>
+///     constexpr unlikely_adaptor<F> unlikely_(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(cold(f)(xs...) == f(xs...));
+///     assert(likely_(p)(xs...) == bool(p(xs...)));
+///     assert(unlikely_(p)(xs...) == bool(p(xs...)));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <string>
+///
+///     struct fast_path
+///     {
+///         int operator()(int x) const
+///         {
+///             return x;
+///         }
+///     };
+///
+///     struct slow_fallback
+///     {
+///         template<class T>
+///         int operator()(const T& x) const
+///         {
+///             return std::stoi(x);
+///         }
+///     };
+///
+///     int main() {
+///         auto to_int = boost::hof::first_of(fast_path(), boost::hof::cold(slow_fallback()));
+///         assert(to_int(1) == 1);
+///         assert(to_int(std::string("2")) == 2);
+///         assert(boost::hof::unlikely_([](int x) { return x < 0; })(-1));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [first_of](first_of)
+/// * [Configurations](Configurations)
+///
+
+#include <boost/hof/config.hpp>
+#include <boost/hof/always.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <utility>
+
+namespace boost { namespace hof {
+
+template<class F>
+struct cold_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(cold_adaptor, detail::callable_base<F>)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class... Ts, class R=decltype(std::declval<const detail::callable_base<F>&>()(std::declval<Ts>()...))>
+    BOOST_HOF_COLD constexpr R operator()(Ts&&... xs) const
+    {
+        return this->base_function(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+template<class F>
+struct likely_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(likely_adaptor, detail::callable_base<F>)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class... Ts, class=decltype(bool(std::declval<const detail::callable_base<F>&>()(std::declval<Ts>()...)))>
+    BOOST_HOF_INLINE constexpr bool operator()(Ts&&... xs) const
+    {
+        return BOOST_HOF_LIKELY(this->base_function(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...));
+    }
+};
+
+template<class F>
+struct unlikely_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(unlikely_adaptor, detail::callable_base<F>)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class... Ts, class=decltype(bool(std::declval<const detail::callable_base<F>&>()(std::declval<Ts>()...)))>
+    BOOST_HOF_INLINE constexpr bool operator()(Ts&&... xs) const
+    {
+        return BOOST_HOF_UNLIKELY(this->base_function(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...));
+    }
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(cold, detail::make<cold_adaptor>);
+BOOST_HOF_DECLARE_STATIC_VAR(likely_, detail::make<likely_adaptor>);
+BOOST_HOF_DECLARE_STATIC_VAR(unlikely_, detail::make<unlikely_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
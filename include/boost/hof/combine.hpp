@@ -61,29 +61,44 @@
 
 namespace boost { namespace hof { namespace detail {
 
+// The functions are stored in one pack, with `F` as the first element, so
+// each of them is compressed the same way, and `F` can be the same type as
+// one of the `Gs`. This is shared with `parallel_combine`.
 template<class S, class F, class... Gs>
-struct combine_adaptor_base;
+struct combine_storage;
 
 template<std::size_t... Ns, class F, class... Gs>
-struct combine_adaptor_base<seq<Ns...>, F, Gs...>
-: F, pack_base<seq<Ns...>, Gs...>
+struct combine_storage<seq<Ns...>, F, Gs...>
+: pack_base<seq<0, (Ns+1)...>, F, Gs...>
 {
-    typedef pack_base<seq<Ns...>, Gs...> base_type;
+    typedef pack_base<seq<0, (Ns+1)...>, F, Gs...> base_type;
 
-    BOOST_HOF_INHERIT_DEFAULT(combine_adaptor_base, base_type, F)
+    BOOST_HOF_INHERIT_DEFAULT(combine_storage, base_type)
 
     template<class X, class... Xs, 
         BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(F, X),
-        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(base_type, Xs...)>
-    constexpr combine_adaptor_base(X&& x, Xs&&... xs) 
-    : F(BOOST_HOF_FORWARD(X)(x)), base_type(BOOST_HOF_FORWARD(Xs)(xs)...)
+        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(base_type, X, Xs...)>
+    constexpr combine_storage(X&& x, Xs&&... xs) 
+    BOOST_HOF_NOEXCEPT(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(base_type, X&&, Xs&&...))
+    : base_type(BOOST_HOF_FORWARD(X)(x), BOOST_HOF_FORWARD(Xs)(xs)...)
     {}
 
     template<class... Ts>
-    constexpr const F& base_function(Ts&&... xs) const
+    BOOST_HOF_INLINE constexpr const F& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return boost::hof::alias_value<pack_tag<seq<0>, F, Gs...>, F>(*this, xs...);
     }
+};
+
+template<class S, class F, class... Gs>
+struct combine_adaptor_base;
+
+template<std::size_t... Ns, class F, class... Gs>
+struct combine_adaptor_base<seq<Ns...>, F, Gs...>
+: combine_storage<seq<Ns...>, F, Gs...>
+{
+    typedef combine_storage<seq<Ns...>, F, Gs...> base_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(combine_adaptor_base, base_type)
 
     BOOST_HOF_RETURNS_CLASS(combine_adaptor_base);
 
@@ -96,16 +111,16 @@ struct combine_adaptor_base<seq<Ns...>, F, Gs...>
     {};
 #endif
 
-    template<class... Ts>
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(combine, Ts...)>
 #if BOOST_HOF_NO_EXPRESSION_SFINAE || BOOST_HOF_HAS_MANUAL_DEDUCTION
-    constexpr typename combine_result<Ts...>::type
+    BOOST_HOF_INLINE constexpr typename combine_result<Ts...>::type
 #else
-    constexpr auto
+    BOOST_HOF_INLINE constexpr auto
 #endif
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_MANUAL_RETURNS
     (
         (BOOST_HOF_MANGLE_CAST(const F&)(BOOST_HOF_CONST_THIS->base_function(xs...)))
-            (boost::hof::alias_value<pack_tag<seq<Ns>, Gs...>, Gs>(*BOOST_HOF_CONST_THIS, xs)(BOOST_HOF_FORWARD(Ts)(xs))...)
+            (boost::hof::alias_value<pack_tag<seq<Ns+1>, F, Gs...>, Gs>(*BOOST_HOF_CONST_THIS, xs)(BOOST_HOF_FORWARD(Ts)(xs))...)
     );
 };
 
@@ -119,6 +134,8 @@ struct combine_adaptor
     BOOST_HOF_INHERIT_CONSTRUCTOR(combine_adaptor, base_type)
 };
 
+BOOST_HOF_DETAIL_COMPILE_MARKER(combine, combine_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(combine, detail::make<combine_adaptor>);
 
 }} // namespace boost::hof
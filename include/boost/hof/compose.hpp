@@ -19,6 +19,12 @@
 /// function becomes the input of the second function. So, `compose(f, g)(0)`
 /// is equivalent to `f(g(0))`.
 /// 
+/// When the last function is also a `compose` adaptor, its functions are
+/// added to the result, so `compose(f, compose(g, h))` is the same type as
+/// `compose(f, g, h)`. This is free, since the nested adaptor is already the
+/// tail of the functions. A nested adaptor anywhere else is kept as one
+/// function.
+/// 
 /// 
 /// Synopsis
 /// --------
@@ -81,15 +87,16 @@
 #include <boost/hof/detail/delegate.hpp>
 #include <boost/hof/detail/compressed_pair.hpp>
 #include <boost/hof/detail/join.hpp>
-#include <tuple>
 #include <boost/hof/detail/move.hpp>
-#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/flatten.hpp>
+#include <boost/hof/detail/pass_through.hpp>
 #include <boost/hof/detail/result_type.hpp>
 #include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/is_invocable.hpp>
 
 namespace boost { namespace hof { namespace detail {
 
-template<class F1, class F2>
+template<class F1, class F2, class=void>
 struct compose_kernel : detail::compressed_pair<F1, F2>, compose_function_result_type<F1, F2>
 {
     typedef detail::compressed_pair<F1, F2> base_type;
@@ -98,8 +105,8 @@ struct compose_kernel : detail::compressed_pair<F1, F2>, compose_function_result
 
     BOOST_HOF_RETURNS_CLASS(compose_kernel);
 
-    template<class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(const F1&, result_of<const F2&, id_<Ts>...>) 
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(compose, Ts...)>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(const F1&, result_of<const F2&, id_<Ts>...>) 
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         BOOST_HOF_MANGLE_CAST(const F1&)(BOOST_HOF_CONST_THIS->first(xs...))(
@@ -107,15 +114,42 @@ struct compose_kernel : detail::compressed_pair<F1, F2>, compose_function_result
         )
     );
 };
+
+// When the inner function declares its result type, the return type is
+// known without deducing the return type of each function in the chain, so
+// only the inner function is checked for the arguments
+template<class F1, class F2>
+struct compose_kernel<F1, F2, typename holder<
+    decltype(std::declval<const F1&>()(std::declval<typename F2::result_type>()))
+>::type>
+: detail::compressed_pair<F1, F2>
+{
+    typedef detail::compressed_pair<F1, F2> base_type;
+    typedef decltype(std::declval<const F1&>()(std::declval<typename F2::result_type>())) result_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(compose_kernel, base_type)
+
+    template<class... Ts, class=typename std::enable_if<(boost::hof::is_invocable<const F2&, Ts...>::value)>::type BOOST_HOF_DETAIL_CALL_MARKER(compose, Ts...)>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr result_type operator()(Ts&&... xs) const
+    {
+        return this->first(xs...)(this->second(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...));
+    }
+};
+
+// The result of the rest is returned as it is, instead of a reference to it
+template<class F1, class F2>
+struct compose_kernel_type
+: std::conditional<is_pass_through<F1>::value, pass_through_kernel<F1, F2, false>, compose_kernel<F1, F2>>
+{};
 }
 
 template<class F, class... Fs>
 struct compose_adaptor 
-: detail::compose_kernel<detail::callable_base<F>, BOOST_HOF_JOIN(compose_adaptor, detail::callable_base<Fs>...)>
+: detail::compose_kernel_type<detail::callable_base<F>, BOOST_HOF_JOIN(compose_adaptor, detail::callable_base<Fs>...)>::type
 {
     typedef compose_adaptor fit_rewritable_tag;
     typedef BOOST_HOF_JOIN(compose_adaptor, detail::callable_base<Fs>...) tail;
-    typedef detail::compose_kernel<detail::callable_base<F>, tail> base_type;
+    typedef typename detail::compose_kernel_type<detail::callable_base<F>, tail>::type base_type;
 
     BOOST_HOF_INHERIT_DEFAULT(compose_adaptor, base_type)
 
@@ -123,7 +157,7 @@ struct compose_adaptor
         BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(detail::callable_base<F>, X), 
         BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(tail, Xs...)
     >
-    constexpr compose_adaptor(X&& f1, Xs&& ... fs)
+    BOOST_HOF_HOST_DEVICE constexpr compose_adaptor(X&& f1, Xs&& ... fs)
     BOOST_HOF_NOEXCEPT(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(base_type, X&&, tail) && BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(tail, Xs&&...))
     : base_type(BOOST_HOF_FORWARD(X)(f1), tail(BOOST_HOF_FORWARD(Xs)(fs)...))
     {}
@@ -131,7 +165,7 @@ struct compose_adaptor
     template<class X,
         BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(detail::callable_base<F>, X)
     >
-    constexpr compose_adaptor(X&& f1) 
+    BOOST_HOF_HOST_DEVICE constexpr compose_adaptor(X&& f1) 
     BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(base_type, X&&)
     : base_type(BOOST_HOF_FORWARD(X)(f1))
     {}
@@ -145,7 +179,7 @@ struct compose_adaptor<F> : detail::callable_base<F>
     BOOST_HOF_INHERIT_DEFAULT(compose_adaptor, detail::callable_base<F>)
 
     template<class X, BOOST_HOF_ENABLE_IF_CONVERTIBLE(X, detail::callable_base<F>)>
-    constexpr compose_adaptor(X&& f1) 
+    BOOST_HOF_HOST_DEVICE constexpr compose_adaptor(X&& f1) 
     BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(detail::callable_base<F>, X&&)
     : detail::callable_base<F>(BOOST_HOF_FORWARD(X)(f1))
     {}
@@ -154,15 +188,17 @@ struct compose_adaptor<F> : detail::callable_base<F>
 
 template<class F1, class F2>
 struct compose_adaptor<F1, F2>
-: detail::compose_kernel<detail::callable_base<F1>, detail::callable_base<F2>>
+: detail::compose_kernel_type<detail::callable_base<F1>, detail::callable_base<F2>>::type
 {
     typedef compose_adaptor fit_rewritable_tag;
-    typedef detail::compose_kernel<detail::callable_base<F1>, detail::callable_base<F2>> base_type;
+    typedef typename detail::compose_kernel_type<detail::callable_base<F1>, detail::callable_base<F2>>::type base_type;
 
     BOOST_HOF_INHERIT_CONSTRUCTOR(compose_adaptor, base_type)
 };
 
-BOOST_HOF_DECLARE_STATIC_VAR(compose, detail::make<compose_adaptor>);
+BOOST_HOF_DETAIL_COMPILE_MARKER(compose, compose_adaptor)
+
+BOOST_HOF_DECLARE_STATIC_VAR(compose, detail::make_flatten<compose_adaptor>);
 
 }} // namespace boost::hof
 
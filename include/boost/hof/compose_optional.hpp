@@ -0,0 +1,128 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    compose_optional.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_COMPOSE_OPTIONAL_H
+#define BOOST_HOF_GUARD_COMPOSE_OPTIONAL_H
+
+/// compose_optional
+/// ================
+///
+/// Description
+/// -----------
+///
+/// The `compose_optional` function adaptor works like
+/// [`flow_expected`](flow_expected), except the functions are called from
+/// the last to the first, like [`compose`](compose). Each function returns
+/// an optional-like value, such as `std::optional` or `std::expected`, and
+/// the next function is called with the value inside it, so
+/// `compose_optional(f, g)(x)` calls `f(*g(x))` only when `g(x)` has a
+/// value, and returns the failure otherwise.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Fs>
+///     constexpr compose_optional_adaptor<Fs...> compose_optional(Fs... fs);
+///
+/// Semantics
+/// ---------
+///
+///     assert(compose_optional(f, g)(xs...) == flow_expected(g, f)(xs...));
+///
+/// Requirements
+/// ------------
+///
+/// Fs must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// The result of each function but the first must be contextually
+/// convertible to `bool`, and have the value with `operator*`.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <optional>
+///
+///     struct reciprocal
+///     {
+///         std::optional<double> operator()(double x) const
+///         {
+///             if (x == 0) return std::nullopt;
+///             return 1 / x;
+///         }
+///     };
+///
+///     struct decrement
+///     {
+///         std::optional<double> operator()(double x) const
+///         {
+///             return x - 1;
+///         }
+///     };
+///
+///     int main() {
+///         auto f = boost::hof::compose_optional(reciprocal(), decrement());
+///         assert(*f(3.0) == 0.5);
+///         assert(!f(1.0));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [compose](compose)
+/// * [flow_expected](flow_expected)
+///
+
+#include <boost/hof/detail/and_then_kernel.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/join.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+
+namespace boost { namespace hof {
+
+template<class F, class... Fs>
+struct compose_optional_adaptor : detail::and_then_kernel<BOOST_HOF_JOIN(compose_optional_adaptor, Fs...), F>
+{
+    typedef BOOST_HOF_JOIN(compose_optional_adaptor, Fs...) tail;
+    typedef detail::and_then_kernel<tail, F> base_type;
+
+    BOOST_HOF_INHERIT_DEFAULT(compose_optional_adaptor, base_type)
+
+    template<class X, class... Xs,
+        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(detail::callable_base<F>, X),
+        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(tail, Xs...)
+    >
+    constexpr compose_optional_adaptor(X&& f1, Xs&& ... fs)
+    BOOST_HOF_NOEXCEPT(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(base_type, tail, X&&) && BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(tail, Xs&&...))
+    : base_type(tail(BOOST_HOF_FORWARD(Xs)(fs)...), BOOST_HOF_FORWARD(X)(f1))
+    {}
+};
+
+template<class F>
+struct compose_optional_adaptor<F> : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_DEFAULT(compose_optional_adaptor, detail::callable_base<F>)
+
+    template<class X, BOOST_HOF_ENABLE_IF_CONVERTIBLE(X, detail::callable_base<F>)>
+    constexpr compose_optional_adaptor(X&& f1)
+    BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(detail::callable_base<F>, X&&)
+    : detail::callable_base<F>(BOOST_HOF_FORWARD(X)(f1))
+    {}
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(compose_optional, detail::make<compose_optional_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
@@ -8,6 +8,14 @@
 #ifndef BOOST_HOF_GUARD_CONFIG_HPP
 #define BOOST_HOF_GUARD_CONFIG_HPP
 
+// A `static_` function whose default constructor can't be evaluated at
+// compile time is constructed on its first call, which needs a guard on
+// every call. When this is enabled, such a function is an error instead, so
+// every static function is constant-initialized. This is disabled by default.
+#ifndef BOOST_HOF_REQUIRE_CONSTANT_INIT
+#define BOOST_HOF_REQUIRE_CONSTANT_INIT 0
+#endif
+
 // Unpack has extra checks to ensure that the function will be invoked with
 // the sequence. This extra check can help improve error reporting but it can
 // slow down compilation. This is enabled by default.
@@ -15,6 +23,23 @@
 #define BOOST_HOF_CHECK_UNPACK_SEQUENCE 1
 #endif
 
+// Static functions are wrapped in reveal, so a call that fails reports why
+// each of the overloads can't be called. This instantiates the failures
+// of every static function, which slows down compilation, so it can be
+// disabled by setting it to 0.
+#ifndef BOOST_HOF_REVEAL_STATIC_FUNCTIONS
+#define BOOST_HOF_REVEAL_STATIC_FUNCTIONS 1
+#endif
+
+// A `std::array` and a `std::span` can be unpacked by every header that can
+// unpack a sequence, which includes <tuple>, <array> and <span> along with
+// them. When this is disabled, they can only be unpacked after including
+// <boost/hof/std_sequences.hpp>, while a `std::tuple` and a `std::pair` can
+// always be unpacked. This is enabled by default.
+#ifndef BOOST_HOF_UNPACK_STD_SEQUENCES
+#define BOOST_HOF_UNPACK_STD_SEQUENCES 1
+#endif
+
 // Check for std version
 #if __cplusplus >= 201606
 #define BOOST_HOF_HAS_STD_17 1
@@ -47,6 +72,60 @@
 #endif
 #endif
 
+// This determines if the empty functions are stored as members with
+// `[[no_unique_address]]`, instead of by inheritance. This gives empty
+// classes no size, even when they are final, and doesn't need the
+// workarounds for EBO. MSVC ignores the standard attribute, so the
+// `[[msvc::no_unique_address]]` spelling is used there instead, which is
+// available from VS 2019 16.10.
+#ifndef BOOST_HOF_HAS_NO_UNIQUE_ADDRESS
+#if defined(_MSC_VER) && !defined(__clang__)
+#if _MSC_VER >= 1929
+#define BOOST_HOF_HAS_NO_UNIQUE_ADDRESS 1
+#else
+#define BOOST_HOF_HAS_NO_UNIQUE_ADDRESS 0
+#endif
+#elif defined(__has_cpp_attribute) && !defined(_MSC_VER) && __cplusplus > 201703L
+#if __has_cpp_attribute(no_unique_address)
+#define BOOST_HOF_HAS_NO_UNIQUE_ADDRESS 1
+#else
+#define BOOST_HOF_HAS_NO_UNIQUE_ADDRESS 0
+#endif
+#else
+#define BOOST_HOF_HAS_NO_UNIQUE_ADDRESS 0
+#endif
+#endif
+
+#if BOOST_HOF_HAS_NO_UNIQUE_ADDRESS && defined(_MSC_VER) && !defined(__clang__)
+#define BOOST_HOF_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#elif BOOST_HOF_HAS_NO_UNIQUE_ADDRESS
+#define BOOST_HOF_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#else
+#define BOOST_HOF_NO_UNIQUE_ADDRESS
+#endif
+
+// MSVC only applies the empty base optimization to the first base class,
+// unless the class is marked with `__declspec(empty_bases)`, which is
+// available from VS 2015 Update 2.
+#ifndef BOOST_HOF_EMPTY_BASES
+#if defined(_MSC_VER) && defined(_MSC_FULL_VER) && _MSC_FULL_VER >= 190023918
+#define BOOST_HOF_EMPTY_BASES __declspec(empty_bases)
+#else
+#define BOOST_HOF_EMPTY_BASES
+#endif
+#endif
+
+// This configures `pack` to build its elements through a separate
+// `pack_holder_base`, which is needed by compilers that can't expand the
+// constructor of each base directly. The same layout is used otherwise.
+#ifndef BOOST_HOF_PACK_USE_HOLDER_BASE
+#if (defined(__GNUC__) && !defined (__clang__) && __GNUC__ == 4 && __GNUC_MINOR__ < 7) || (defined(_MSC_VER) && _MSC_VER < 1920)
+#define BOOST_HOF_PACK_USE_HOLDER_BASE 1
+#else
+#define BOOST_HOF_PACK_USE_HOLDER_BASE 0
+#endif
+#endif
+
 // This configures the library whether expression sfinae can be used to detect
 // callability of a function.
 #ifndef BOOST_HOF_NO_EXPRESSION_SFINAE
@@ -57,6 +136,28 @@
 #endif
 #endif
 
+// Whether the compiler supports C++20 concepts, which are then used to check
+// if a function can be called, instead of expression sfinae.
+#ifndef BOOST_HOF_HAS_CONCEPTS
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
+#define BOOST_HOF_HAS_CONCEPTS 1
+#else
+#define BOOST_HOF_HAS_CONCEPTS 0
+#endif
+#endif
+
+// This configures the library to constrain the adaptors with a requires
+// clause and deduce the result with `decltype(auto)`, instead of computing the
+// result with the nested `result_of` metafunctions when expression sfinae
+// can't be used.
+#ifndef BOOST_HOF_HAS_REQUIRES_SFINAE
+#if BOOST_HOF_NO_EXPRESSION_SFINAE && BOOST_HOF_HAS_CONCEPTS
+#define BOOST_HOF_HAS_REQUIRES_SFINAE 1
+#else
+#define BOOST_HOF_HAS_REQUIRES_SFINAE 0
+#endif
+#endif
+
 // This configures the library to use manual type deduction in a few places
 // where it problematic on a few platforms.
 #ifndef BOOST_HOF_HAS_MANUAL_DEDUCTION
@@ -67,6 +168,79 @@
 #endif
 #endif
 
+// Whether the compiler provides the `__make_integer_seq` builtin for
+// generating integer sequences.
+#ifndef BOOST_HOF_HAS_MAKE_INTEGER_SEQ
+#if defined(__clang__) && defined(__has_builtin)
+#if __has_builtin(__make_integer_seq)
+#define BOOST_HOF_HAS_MAKE_INTEGER_SEQ 1
+#else
+#define BOOST_HOF_HAS_MAKE_INTEGER_SEQ 0
+#endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1910
+#define BOOST_HOF_HAS_MAKE_INTEGER_SEQ 1
+#else
+#define BOOST_HOF_HAS_MAKE_INTEGER_SEQ 0
+#endif
+#endif
+
+// Whether the compiler provides the `__integer_pack` builtin for generating
+// integer sequences.
+#ifndef BOOST_HOF_HAS_INTEGER_PACK
+#if defined(__GNUC__) && !defined (__clang__) && __GNUC__ >= 8
+#define BOOST_HOF_HAS_INTEGER_PACK 1
+#else
+#define BOOST_HOF_HAS_INTEGER_PACK 0
+#endif
+#endif
+
+// Whether to build index sequences from `std::make_index_sequence` when no
+// compiler builtin is available.
+#ifndef BOOST_HOF_HAS_STD_INDEX_SEQUENCE
+#if defined(__cpp_lib_integer_sequence)
+#define BOOST_HOF_HAS_STD_INDEX_SEQUENCE 1
+#else
+#define BOOST_HOF_HAS_STD_INDEX_SEQUENCE BOOST_HOF_HAS_STD_14
+#endif
+#endif
+
+// Whether the compiler supports indexing a pack with `Ts...[N]`.
+#ifndef BOOST_HOF_HAS_PACK_INDEXING
+#if defined(__cpp_pack_indexing) && __cpp_pack_indexing >= 202311L
+#define BOOST_HOF_HAS_PACK_INDEXING 1
+#else
+#define BOOST_HOF_HAS_PACK_INDEXING 0
+#endif
+#endif
+
+// Whether the compiler provides the `__type_pack_element` builtin for
+// selecting a type from a pack.
+#ifndef BOOST_HOF_HAS_TYPE_PACK_ELEMENT
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define BOOST_HOF_HAS_TYPE_PACK_ELEMENT 1
+#else
+#define BOOST_HOF_HAS_TYPE_PACK_ELEMENT 0
+#endif
+#else
+#define BOOST_HOF_HAS_TYPE_PACK_ELEMENT 0
+#endif
+#endif
+
+// Whether the compiler provides a builtin to detect types that can be
+// relocated with `memcpy`.
+#ifndef BOOST_HOF_HAS_TRIVIAL_RELOCATION
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_cpp_trivially_relocatable) || (defined(__clang__) && __has_builtin(__is_trivially_relocatable))
+#define BOOST_HOF_HAS_TRIVIAL_RELOCATION 1
+#else
+#define BOOST_HOF_HAS_TRIVIAL_RELOCATION 0
+#endif
+#else
+#define BOOST_HOF_HAS_TRIVIAL_RELOCATION 0
+#endif
+#endif
+
 // Whether the compiler has relaxed constexpr.
 #ifndef BOOST_HOF_HAS_RELAXED_CONSTEXPR
 #ifdef __cpp_constexpr
@@ -107,11 +281,29 @@
 #endif
 #endif
 
-// Whether inline variables defined with lambdas have external linkage.
-// Currently, no compiler supports this yet.
+// Whether the compiler supports template parameters declared with `auto`
+#ifndef BOOST_HOF_HAS_AUTO_TEMPLATE_PARAMETER
+#if defined(__cpp_nontype_template_parameter_auto) && __cpp_nontype_template_parameter_auto >= 201606L
+#define BOOST_HOF_HAS_AUTO_TEMPLATE_PARAMETER 1
+#else
+#define BOOST_HOF_HAS_AUTO_TEMPLATE_PARAMETER 0
+#endif
+#endif
+
+// Whether inline variables defined with lambdas have external linkage, so
+// the closure type is the same in every translation unit. Gcc 9 and clang 6
+// mangle the closure with the name of the variable, while MSVC does not.
 #ifndef BOOST_HOF_HAS_INLINE_LAMBDAS
+#if !BOOST_HOF_HAS_INLINE_VARIABLES || !BOOST_HOF_HAS_CONSTEXPR_LAMBDA || defined(_MSC_VER)
+#define BOOST_HOF_HAS_INLINE_LAMBDAS 0
+#elif defined(__clang__) && __clang_major__ >= 6
+#define BOOST_HOF_HAS_INLINE_LAMBDAS 1
+#elif defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9
+#define BOOST_HOF_HAS_INLINE_LAMBDAS 1
+#else
 #define BOOST_HOF_HAS_INLINE_LAMBDAS 0
 #endif
+#endif
 
 // Whether the compiler supports variable templates
 #ifndef BOOST_HOF_HAS_VARIABLE_TEMPLATES
@@ -142,6 +334,18 @@
 #endif
 #endif
 
+// Whether the getters for the base classes of an adaptor convert `*this`
+// directly, instead of delaying it through `always_ref` with the parameters
+// of the getter. This saves three calls for each access when the adaptor is
+// evaluated in a `constexpr` context.
+#ifndef BOOST_HOF_HAS_DIRECT_BASE_ACCESS
+#if (defined(__GNUC__) && !defined (__clang__) && __GNUC__ == 4 && __GNUC_MINOR__ < 9) || defined(_MSC_VER)
+#define BOOST_HOF_HAS_DIRECT_BASE_ACCESS 0
+#else
+#define BOOST_HOF_HAS_DIRECT_BASE_ACCESS 1
+#endif
+#endif
+
 // Whether evaluations of function in brace initialization is ordered from
 // left-to-right.
 #ifndef BOOST_HOF_NO_ORDERED_BRACE_INIT
@@ -198,4 +402,296 @@
 #endif
 #endif
 
+// Whether member functions can be ref-qualified, which is not supported
+// before gcc 4.8.1
+#ifndef BOOST_HOF_NO_REF_QUALIFIERS
+#if defined(__GNUC__) && !defined (__clang__) && __GNUC__ == 4 && __GNUC_MINOR__ < 8
+#define BOOST_HOF_NO_REF_QUALIFIERS 1
+#else
+#define BOOST_HOF_NO_REF_QUALIFIERS 0
+#endif
+#endif
+
+// Whether the compiler supports C++20 coroutines
+#ifndef BOOST_HOF_HAS_COROUTINES
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __cpp_impl_coroutine >= 201902 && __has_include(<coroutine>)
+#define BOOST_HOF_HAS_COROUTINES 1
+#else
+#define BOOST_HOF_HAS_COROUTINES 0
+#endif
+#else
+#define BOOST_HOF_HAS_COROUTINES 0
+#endif
+#endif
+
+// Whether to collapse the forwarding layers in debug builds, so the helpers
+// that forward to the base function are always inlined
+#ifndef BOOST_HOF_DEBUG_PERF
+#define BOOST_HOF_DEBUG_PERF 0
+#endif
+
+// Whether the call operators of the adaptors and the helpers they forward
+// through are always inlined. This is enabled in release builds so deep
+// chains of adaptors are not left out of line by the inliner's growth
+// limits, and in debug builds with BOOST_HOF_DEBUG_PERF.
+#ifndef BOOST_HOF_HAS_ALWAYS_INLINE
+#if BOOST_HOF_DEBUG_PERF || defined(__OPTIMIZE__) || defined(NDEBUG)
+#define BOOST_HOF_HAS_ALWAYS_INLINE 1
+#else
+#define BOOST_HOF_HAS_ALWAYS_INLINE 0
+#endif
+#endif
+
+#ifndef BOOST_HOF_INLINE
+#if BOOST_HOF_HAS_ALWAYS_INLINE && defined(_MSC_VER) && !defined(__clang__)
+#define BOOST_HOF_INLINE __forceinline
+#elif BOOST_HOF_HAS_ALWAYS_INLINE && defined(__GNUC__)
+#define BOOST_HOF_INLINE __attribute__((always_inline))
+#else
+#define BOOST_HOF_INLINE
+#endif
+#endif
+
+// Whether the headers are compiled by a CUDA or HIP compiler, so the
+// functions are annotated to be callable from device code, and whether it is
+// the device side of the compilation
+#ifndef BOOST_HOF_HAS_DEVICE_CODE
+#if defined(__CUDACC__) || defined(__HIPCC__)
+#define BOOST_HOF_HAS_DEVICE_CODE 1
+#else
+#define BOOST_HOF_HAS_DEVICE_CODE 0
+#endif
+#endif
+
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+#define BOOST_HOF_DEVICE_COMPILE 1
+#else
+#define BOOST_HOF_DEVICE_COMPILE 0
+#endif
+
+// The functions of the adaptors can be called from host and device code.
+// SYCL compiles the same functions for the device without an annotation.
+#ifndef BOOST_HOF_HOST_DEVICE
+#if BOOST_HOF_HAS_DEVICE_CODE
+#define BOOST_HOF_HOST_DEVICE __host__ __device__
+#else
+#define BOOST_HOF_HOST_DEVICE
+#endif
+#endif
+
+// A function that is rarely called, such as an error or a fallback path, is
+// kept out of line and placed with the other cold code, so it doesn't take
+// space in the hot instruction stream of its callers
+#ifndef BOOST_HOF_COLD
+#if defined(__GNUC__)
+#define BOOST_HOF_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define BOOST_HOF_COLD __declspec(noinline)
+#else
+#define BOOST_HOF_COLD
+#endif
+#endif
+
+// A function that is kept out of line, so its body is emitted once instead
+// of in each of its callers
+#ifndef BOOST_HOF_NOINLINE
+#if defined(__GNUC__)
+#define BOOST_HOF_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define BOOST_HOF_NOINLINE __declspec(noinline)
+#else
+#define BOOST_HOF_NOINLINE
+#endif
+#endif
+
+// Hints for the branch that a condition takes
+#ifndef BOOST_HOF_LIKELY
+#if defined(__GNUC__)
+#define BOOST_HOF_LIKELY(...) __builtin_expect(!!(__VA_ARGS__), 1)
+#define BOOST_HOF_UNLIKELY(...) __builtin_expect(!!(__VA_ARGS__), 0)
+#else
+#define BOOST_HOF_LIKELY(...) (!!(__VA_ARGS__))
+#define BOOST_HOF_UNLIKELY(...) (!!(__VA_ARGS__))
+#endif
+#endif
+
+// Casting functions, such as forward, are treated as a cast by msvc so no
+// call is generated at all
+#ifndef BOOST_HOF_INTRINSIC
+#if BOOST_HOF_HAS_ALWAYS_INLINE && defined(_MSC_VER) && !defined(__clang__) && _MSC_VER >= 1935
+#define BOOST_HOF_INTRINSIC [[msvc::intrinsic]]
+#else
+#define BOOST_HOF_INTRINSIC BOOST_HOF_INLINE
+#endif
+#endif
+
+// Whether std::string_view is available
+#ifndef BOOST_HOF_HAS_STD_STRING_VIEW
+#if BOOST_HOF_HAS_STD_17 && defined(__has_include)
+#if __has_include(<string_view>)
+#define BOOST_HOF_HAS_STD_STRING_VIEW 1
+#else
+#define BOOST_HOF_HAS_STD_STRING_VIEW 0
+#endif
+#else
+#define BOOST_HOF_HAS_STD_STRING_VIEW 0
+#endif
+#endif
+
+// Whether `if constexpr` can be used
+#ifndef BOOST_HOF_HAS_IF_CONSTEXPR
+#if defined(__cpp_if_constexpr) && __cpp_if_constexpr >= 201606
+#define BOOST_HOF_HAS_IF_CONSTEXPR 1
+#else
+#define BOOST_HOF_HAS_IF_CONSTEXPR 0
+#endif
+#endif
+
+// Whether std::to_chars is available
+#ifndef BOOST_HOF_HAS_STD_CHARCONV
+#if BOOST_HOF_HAS_STD_17 && defined(__has_include)
+#if __has_include(<charconv>)
+#define BOOST_HOF_HAS_STD_CHARCONV 1
+#else
+#define BOOST_HOF_HAS_STD_CHARCONV 0
+#endif
+#else
+#define BOOST_HOF_HAS_STD_CHARCONV 0
+#endif
+#endif
+
+// Whether std::variant is available
+#ifndef BOOST_HOF_HAS_STD_VARIANT
+#if BOOST_HOF_HAS_STD_17 && defined(__has_include)
+#if __has_include(<variant>)
+#define BOOST_HOF_HAS_STD_VARIANT 1
+#else
+#define BOOST_HOF_HAS_STD_VARIANT 0
+#endif
+#else
+#define BOOST_HOF_HAS_STD_VARIANT 0
+#endif
+#endif
+
+// Whether std::span is available
+#ifndef BOOST_HOF_HAS_STD_SPAN
+#if defined(__has_include) && defined(__cplusplus) && (__cplusplus > 201703L || (defined(_MSVC_LANG) && _MSVC_LANG > 201703L))
+#if __has_include(<span>)
+#define BOOST_HOF_HAS_STD_SPAN 1
+#else
+#define BOOST_HOF_HAS_STD_SPAN 0
+#endif
+#else
+#define BOOST_HOF_HAS_STD_SPAN 0
+#endif
+#endif
+
+// Whether std::reference_wrapper can be included without the rest of
+// <functional>, which is much larger
+#ifndef BOOST_HOF_HAS_STD_REFWRAP_HEADER
+#if defined(__has_include)
+#if __has_include(<bits/refwrap.h>)
+#define BOOST_HOF_HAS_STD_REFWRAP_HEADER 1
+#else
+#define BOOST_HOF_HAS_STD_REFWRAP_HEADER 0
+#endif
+#else
+#define BOOST_HOF_HAS_STD_REFWRAP_HEADER 0
+#endif
+#endif
+
+// Whether std::uses_allocator and std::allocator_arg can be included without
+// the rest of <memory>
+#ifndef BOOST_HOF_HAS_STD_USES_ALLOC_HEADER
+#if defined(__has_include)
+#if __has_include(<bits/uses_allocator.h>)
+#define BOOST_HOF_HAS_STD_USES_ALLOC_HEADER 1
+#else
+#define BOOST_HOF_HAS_STD_USES_ALLOC_HEADER 0
+#endif
+#else
+#define BOOST_HOF_HAS_STD_USES_ALLOC_HEADER 0
+#endif
+#endif
+
+// The qualifier for pointers that don't alias any other pointer
+#ifndef BOOST_HOF_RESTRICT
+#if defined(__GNUC__) || defined(__clang__)
+#define BOOST_HOF_RESTRICT __restrict__
+#elif defined(_MSC_VER)
+#define BOOST_HOF_RESTRICT __restrict
+#else
+#define BOOST_HOF_RESTRICT
+#endif
+#endif
+
+// The number of lanes batch calls in each step of its main loop
+#ifndef BOOST_HOF_BATCH_WIDTH
+#define BOOST_HOF_BATCH_WIDTH 8
+#endif
+
+// Whether to check at compile time that the closures built by pipable only
+// hold references, so building them in a pipeline never allocates
+#ifndef BOOST_HOF_PIPABLE_ALLOC_FREE
+#define BOOST_HOF_PIPABLE_ALLOC_FREE 0
+#endif
+
+// Whether the closures of pipable derive from `std::ranges::range_adaptor_closure`,
+// so they compose with the views of the standard library
+#ifndef BOOST_HOF_HAS_RANGE_ADAPTOR_CLOSURE
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 202202L
+#define BOOST_HOF_HAS_RANGE_ADAPTOR_CLOSURE 1
+#else
+#define BOOST_HOF_HAS_RANGE_ADAPTOR_CLOSURE 0
+#endif
+#endif
+
+// The number of shards that the counters of the instrumented adaptors are
+// split in, so the threads that count at the same time mostly write to
+// different cache lines
+#ifndef BOOST_HOF_COUNTER_SHARDS
+#define BOOST_HOF_COUNTER_SHARDS 8
+#endif
+
+// Whether profiled records the calls of the functions it decorates
+#ifndef BOOST_HOF_PROFILING
+#define BOOST_HOF_PROFILING 0
+#endif
+
+// The number of names each thread can record calls for with profiled
+#ifndef BOOST_HOF_PROFILING_SITES
+#define BOOST_HOF_PROFILING_SITES 64
+#endif
+
+// The number of events each thread can buffer for traced until they are
+// drained
+#ifndef BOOST_HOF_TRACE_BUFFER_SIZE
+#define BOOST_HOF_TRACE_BUFFER_SIZE 1024
+#endif
+
+// Whether a flow of at least three functions, where each one returns the
+// type it is passed, is evaluated by assigning each result to one value
+// instead of nesting the calls. This needs relaxed constexpr.
+#ifndef BOOST_HOF_ITERATE_UNIFORM_CHAINS
+#define BOOST_HOF_ITERATE_UNIFORM_CHAINS BOOST_HOF_HAS_RELAXED_CONSTEXPR
+#endif
+
+// Instantiate a marker named after the adaptor from each call operator, so
+// the instantiations of each adaptor can be counted from a time trace
+#ifndef BOOST_HOF_INSTANTIATION_STATS
+#define BOOST_HOF_INSTANTIATION_STATS 0
+#endif
+
+// Instantiate each adaptor built by its factory through a marker named after
+// the adaptor, to attribute compile time in a time trace
+#ifndef BOOST_HOF_COMPILE_MARKERS
+#define BOOST_HOF_COMPILE_MARKERS BOOST_HOF_INSTANTIATION_STATS
+#endif
+
 #endif
@@ -50,6 +50,18 @@
 ///     template<template<class...> class MetafunctionTemplate>
 ///     constexpr auto construct_meta();
 /// 
+///     // Construct in place in the storage that `p` points to
+///     template<class T>
+///     constexpr auto construct_at(void* p);
+/// 
+///     // Construct at the end of the container with `emplace_back`
+///     template<class Container>
+///     constexpr auto emplace_into(Container& c);
+/// 
+///     // Construct with uses-allocator construction
+///     template<class T, class Alloc>
+///     constexpr auto construct_alloc(const Alloc& a);
+/// 
 /// Semantics
 /// ---------
 /// 
@@ -57,6 +69,16 @@
 ///     assert(construct<Template>()(xs...) == Template<decltype(xs)...>(xs...));
 ///     assert(construct_meta<MetafunctionClass>()(xs...) == MetafunctionClass::apply<decltype(xs)...>(xs...));
 ///     assert(construct_meta<MetafunctionTemplate>()(xs...) == MetafunctionTemplate<decltype(xs)...>::type(xs...));
+///     assert(*construct_at<T>(p)(xs...) == T(xs...));
+/// 
+/// Calling `emplace_into(c)(xs...)` is the same as `c.emplace_back(xs...)`, and
+/// it returns what `emplace_back` returns.
+/// /// The object from `construct_alloc<T>(a)(xs...)` is constructed with
+/// `T(std::allocator_arg, a, xs...)` or `T(xs..., a)` when
+/// `std::uses_allocator<T, Alloc>` is true, and with `T(xs...)` otherwise.
+/// Unlike `std::make_obj_using_allocator`, a `std::pair` isn't constructed
+/// piecewise. The objects that `construct_at` constructs must be destroyed by
+/// the caller.
 /// 
 /// Requirements
 /// ------------
@@ -94,7 +116,15 @@
 #include <boost/hof/detail/remove_rvalue_reference.hpp>
 #include <boost/hof/decay.hpp>
 
+#include <boost/hof/returns.hpp>
+
 #include <initializer_list>
+#include <new>
+#if BOOST_HOF_HAS_STD_USES_ALLOC_HEADER
+#include <bits/uses_allocator.h>
+#else
+#include <memory>
+#endif
 
 namespace boost { namespace hof { 
 
@@ -125,7 +155,7 @@ struct construct_f
     constexpr construct_f() noexcept
     {}
     template<class... Ts, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(T, Ts...)>
-    T operator()(Ts&&... xs) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(T, Ts&&...)
+    BOOST_HOF_INLINE T operator()(Ts&&... xs) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(T, Ts&&...)
     {
         storage buffer{};
         new(&buffer) T(BOOST_HOF_FORWARD(Ts)(xs)...);
@@ -134,7 +164,7 @@ struct construct_f
     }
 
     template<class X, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(T, std::initializer_list<X>&&)>
-    T operator()(std::initializer_list<X>&& x) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(T, std::initializer_list<X>&&)
+    BOOST_HOF_INLINE T operator()(std::initializer_list<X>&& x) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(T, std::initializer_list<X>&&)
     {
         storage buffer{};
         new(&buffer) T(static_cast<std::initializer_list<X>&&>(x));
@@ -143,7 +173,7 @@ struct construct_f
     }
 
     template<class X, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(T, std::initializer_list<X>&)>
-    T operator()(std::initializer_list<X>& x) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(T, std::initializer_list<X>&)
+    BOOST_HOF_INLINE T operator()(std::initializer_list<X>& x) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(T, std::initializer_list<X>&)
     {
         storage buffer{};
         new(&buffer) T(x);
@@ -152,7 +182,7 @@ struct construct_f
     }
 
     template<class X, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(T, const std::initializer_list<X>&)>
-    T operator()(const std::initializer_list<X>& x) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(T, const std::initializer_list<X>&)
+    BOOST_HOF_INLINE T operator()(const std::initializer_list<X>& x) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(T, const std::initializer_list<X>&)
     {
         storage buffer{};
         new(&buffer) T(x);
@@ -167,25 +197,25 @@ struct construct_f<T, typename std::enable_if<BOOST_HOF_IS_LITERAL(T)>::type>
     constexpr construct_f() noexcept
     {}
     template<class... Ts, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(T, Ts...)>
-    constexpr T operator()(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr T operator()(Ts&&... xs) const noexcept
     {
         return T(BOOST_HOF_FORWARD(Ts)(xs)...);
     }
 
     template<class X, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(T, std::initializer_list<X>&&)>
-    constexpr T operator()(std::initializer_list<X>&& x) const noexcept
+    BOOST_HOF_INLINE constexpr T operator()(std::initializer_list<X>&& x) const noexcept
     {
         return T(static_cast<std::initializer_list<X>&&>(x));
     }
 
     template<class X, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(T, std::initializer_list<X>&)>
-    constexpr T operator()(std::initializer_list<X>& x) const noexcept
+    BOOST_HOF_INLINE constexpr T operator()(std::initializer_list<X>& x) const noexcept
     {
         return T(x);
     }
 
     template<class X, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(T, const std::initializer_list<X>&)>
-    constexpr T operator()(const std::initializer_list<X>& x) const noexcept
+    BOOST_HOF_INLINE constexpr T operator()(const std::initializer_list<X>& x) const noexcept
     {
         return T(x);
     }
@@ -198,7 +228,7 @@ struct construct_template_f
     {}
     template<class... Ts, class Result=BOOST_HOF_JOIN(Template, typename D<Ts>::type...), 
         BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(Result, Ts...)>
-    constexpr Result operator()(Ts&&... xs) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Result, Ts&&...)
+    BOOST_HOF_INLINE constexpr Result operator()(Ts&&... xs) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Result, Ts&&...)
     {
         return construct_f<Result>()(BOOST_HOF_FORWARD(Ts)(xs)...);
     }
@@ -219,7 +249,7 @@ struct construct_meta_f
         class Metafunction=BOOST_HOF_JOIN(apply, Ts...), 
         class Result=typename Metafunction::type, 
         BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(Result, Ts...)>
-    constexpr Result operator()(Ts&&... xs) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Result, Ts&&...)
+    BOOST_HOF_INLINE constexpr Result operator()(Ts&&... xs) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Result, Ts&&...)
     {
         return construct_f<Result>()(BOOST_HOF_FORWARD(Ts)(xs)...);
     }
@@ -234,13 +264,100 @@ struct construct_meta_template_f
         class Metafunction=BOOST_HOF_JOIN(MetafunctionTemplate, Ts...), 
         class Result=typename Metafunction::type, 
         BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(Result, Ts...)>
-    constexpr Result operator()(Ts&&... xs) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Result, Ts&&...)
+    BOOST_HOF_INLINE constexpr Result operator()(Ts&&... xs) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Result, Ts&&...)
     {
         return construct_f<Result>()(BOOST_HOF_FORWARD(Ts)(xs)...);
     }
 };
 
 
+template<class T>
+struct construct_at_f
+{
+    void * p;
+
+    constexpr construct_at_f(void* x) noexcept : p(x)
+    {}
+
+    template<class... Ts, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(T, Ts...)>
+    BOOST_HOF_INLINE T* operator()(Ts&&... xs) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(T, Ts&&...)
+    {
+        return ::new(this->p) T(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+
+    template<class X, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(T, std::initializer_list<X>&)>
+    BOOST_HOF_INLINE T* operator()(std::initializer_list<X> x) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(T, std::initializer_list<X>&)
+    {
+        return ::new(this->p) T(x);
+    }
+};
+
+template<class Container>
+struct emplace_into_f
+{
+    Container * c;
+
+    constexpr emplace_into_f(Container& x) noexcept : c(&x)
+    {}
+
+    BOOST_HOF_RETURNS_CLASS(emplace_into_f);
+
+    template<class... Ts>
+    BOOST_HOF_INLINE auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        BOOST_HOF_CONST_THIS->c->emplace_back(BOOST_HOF_FORWARD(Ts)(xs)...)
+    );
+};
+
+// How the object is constructed with uses-allocator construction: not at
+// all, without the allocator, with a leading `std::allocator_arg`, or with a
+// trailing allocator
+template<class T, class Alloc, class... Ts>
+struct uses_alloc_kind
+: std::integral_constant<int, 
+    !std::uses_allocator<T, Alloc>::value ? (BOOST_HOF_IS_CONSTRUCTIBLE(T, Ts...) ? 1 : 0) :
+    BOOST_HOF_IS_CONSTRUCTIBLE(T, std::allocator_arg_t, const Alloc&, Ts...) ? 2 :
+    BOOST_HOF_IS_CONSTRUCTIBLE(T, Ts..., const Alloc&) ? 3 : 0
+>
+{};
+
+template<class T, class Alloc>
+struct construct_alloc_f
+{
+    BOOST_HOF_NO_UNIQUE_ADDRESS Alloc a;
+
+    constexpr construct_alloc_f(const Alloc& x) BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Alloc, const Alloc&) : a(x)
+    {}
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr T construct(std::integral_constant<int, 1>, Ts&&... xs) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(T, Ts&&...)
+    {
+        return T(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr T construct(std::integral_constant<int, 2>, Ts&&... xs) const 
+    BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(T, std::allocator_arg_t, const Alloc&, Ts&&...)
+    {
+        return T(std::allocator_arg, this->a, BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr T construct(std::integral_constant<int, 3>, Ts&&... xs) const 
+    BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(T, Ts&&..., const Alloc&)
+    {
+        return T(BOOST_HOF_FORWARD(Ts)(xs)..., this->a);
+    }
+
+    template<class... Ts, class Kind=uses_alloc_kind<T, Alloc, Ts&&...>, 
+        class=typename std::enable_if<(Kind::value > 0)>::type>
+    BOOST_HOF_INLINE constexpr T operator()(Ts&&... xs) const 
+    noexcept(noexcept(std::declval<const construct_alloc_f&>().construct(Kind(), std::declval<Ts>()...)))
+    {
+        return this->construct(Kind(), BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
 template<class T>
 struct construct_id
 {
@@ -297,6 +414,24 @@ constexpr detail::construct_meta_template_f<Template> construct_meta() noexcept
     return {};
 }
 
+template<class T>
+constexpr detail::construct_at_f<T> construct_at(void* p) noexcept
+{
+    return detail::construct_at_f<T>(p);
+}
+
+template<class Container>
+constexpr detail::emplace_into_f<Container> emplace_into(Container& c) noexcept
+{
+    return detail::emplace_into_f<Container>(c);
+}
+
+template<class T, class Alloc>
+constexpr detail::construct_alloc_f<T, Alloc> construct_alloc(const Alloc& a) BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Alloc, const Alloc&)
+{
+    return detail::construct_alloc_f<T, Alloc>(a);
+}
+
 }} // namespace boost::hof
 
 #endif
@@ -0,0 +1,247 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    contains.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_CONTAINS_H
+#define BOOST_HOF_GUARD_CONTAINS_H
+
+/// contains
+/// ========
+///
+/// Description
+/// -----------
+///
+/// The `contains` function checks whether a range contains an element, using
+/// the fastest search the range supports. The search is chosen with
+/// [`first_of`](first_of), so it is picked at compile time, in this order:
+///
+/// * A range that is marked with `sorted` is searched with
+///   `std::binary_search`, using the comparison given to `sorted`.
+/// * A range with a `contains` member function, such as the associative
+///   containers in C++20, uses it.
+/// * A contiguous range of `char`, such as a `std::string` or a
+///   `std::vector<char>`, is searched for a `char` with `std::memchr`.
+/// * A range with a `find` member function, such as a `std::map` or a
+///   `std::string`, uses it. For a string, this also finds a substring.
+/// * Any other range is searched with `std::find`.
+///
+/// The `sorted` function marks a range as sorted, without copying it. When
+/// no comparison is given, the range must be sorted by `operator<`.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Range, class T>
+///     bool contains(const Range& r, const T& x);
+///
+///     template<class Range>
+///     sorted_range<Range> sorted(Range&& r);
+///
+///     template<class Range, class Compare>
+///     sorted_range<Range, Compare> sorted(Range&& r, Compare c);
+///
+/// Semantics
+/// ---------
+///
+///     assert(contains(r, x) == (std::find(begin(r), end(r), x) != end(r)));
+///
+/// Requirements
+/// ------------
+///
+/// Range must be:
+///
+/// * A range whose elements are EqualityComparable with T
+///
+/// Compare must be:
+///
+/// * [BinaryInvocable](BinaryInvocable), that is the strict weak ordering
+///   the range is sorted by
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <map>
+///     #include <string>
+///     #include <vector>
+///
+///     int main() {
+///         std::vector<int> numbers = { 1, 2, 3, 4, 5 };
+///         std::map<int, int> m = { { 1, 2 } };
+///         assert(boost::hof::contains(numbers, 5));
+///         assert(boost::hof::contains(boost::hof::sorted(numbers), 3));
+///         assert(boost::hof::contains(std::string("hello world"), "world"));
+///         assert(boost::hof::contains(m, 1));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [first_of](first_of)
+/// * [infix](infix)
+///
+
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/returns.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/holder.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+struct sorted_less
+{
+    template<class T, class U>
+    constexpr auto operator()(const T& x, const U& y) const BOOST_HOF_RETURNS(x < y);
+};
+
+}
+
+template<class Range, class Compare=detail::sorted_less>
+struct sorted_range
+{
+    Range range;
+    Compare compare;
+};
+
+namespace detail {
+
+namespace contains_adl {
+
+using std::begin;
+using std::end;
+
+template<class R>
+auto adl_begin(const R& r) BOOST_HOF_RETURNS(begin(r));
+template<class R>
+auto adl_end(const R& r) BOOST_HOF_RETURNS(end(r));
+
+}
+
+template<class T>
+struct is_sorted_range
+: std::false_type
+{};
+
+template<class Range, class Compare>
+struct is_sorted_range<sorted_range<Range, Compare>>
+: std::true_type
+{};
+
+// A contiguous range of characters, that can be searched for one character
+// with memchr
+template<class R, class T, class=void>
+struct is_char_search
+: std::false_type
+{};
+
+template<class R, class T>
+struct is_char_search<R, T, typename std::enable_if<(
+    std::is_same<T, char>::value &&
+    std::is_same<typename std::remove_cv<typename std::remove_pointer<
+        decltype(std::declval<const R&>().data())
+    >::type>::type, char>::value &&
+    std::is_convertible<decltype(std::declval<const R&>().size()), std::size_t>::value
+)>::type>
+: std::true_type
+{};
+
+struct sorted_contains
+{
+    template<class R, class T, typename std::enable_if<(is_sorted_range<R>::value), int>::type = 0>
+    auto operator()(const R& r, const T& x) const BOOST_HOF_RETURNS
+    (
+        std::binary_search(contains_adl::adl_begin(r.range), contains_adl::adl_end(r.range), x, r.compare)
+    );
+};
+
+struct member_contains
+{
+    template<class R, class T>
+    auto operator()(const R& r, const T& x) const BOOST_HOF_RETURNS
+    (
+        static_cast<bool>(r.contains(x))
+    );
+};
+
+struct char_contains
+{
+    template<class R, class T, typename std::enable_if<(is_char_search<R, T>::value), int>::type = 0>
+    bool operator()(const R& r, const T& x) const noexcept
+    {
+        std::size_t n = r.size();
+        return n > 0 && std::memchr(r.data(), static_cast<unsigned char>(x), n) != nullptr;
+    }
+};
+
+// The find of a string returns an index, that is npos when the element
+// isn't found
+struct index_find_contains
+{
+    template<class R, class T>
+    auto operator()(const R& r, const T& x) const BOOST_HOF_RETURNS
+    (
+        r.find(x) != R::npos
+    );
+};
+
+struct member_find_contains
+{
+    template<class R, class T>
+    auto operator()(const R& r, const T& x) const BOOST_HOF_RETURNS
+    (
+        r.find(x) != r.end()
+    );
+};
+
+struct range_find_contains
+{
+    template<class R, class T>
+    auto operator()(const R& r, const T& x) const BOOST_HOF_RETURNS
+    (
+        std::find(contains_adl::adl_begin(r), contains_adl::adl_end(r), x) != contains_adl::adl_end(r)
+    );
+};
+
+struct make_sorted
+{
+    template<class Range>
+    constexpr sorted_range<Range> operator()(Range&& r) const
+    {
+        return sorted_range<Range>{BOOST_HOF_FORWARD(Range)(r), sorted_less()};
+    }
+
+    template<class Range, class Compare>
+    constexpr sorted_range<Range, Compare> operator()(Range&& r, Compare c) const
+    {
+        return sorted_range<Range, Compare>{BOOST_HOF_FORWARD(Range)(r), static_cast<Compare&&>(c)};
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(contains, boost::hof::first_of_adaptor<
+    detail::sorted_contains,
+    detail::member_contains,
+    detail::char_contains,
+    detail::index_find_contains,
+    detail::member_find_contains,
+    detail::range_find_contains
+>);
+
+BOOST_HOF_DECLARE_STATIC_VAR(sorted, detail::make_sorted);
+
+}} // namespace boost::hof
+
+#endif
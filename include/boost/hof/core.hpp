@@ -0,0 +1,75 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    boost/hof/core.hpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_CORE_HPP
+#define BOOST_HOF_GUARD_CORE_HPP
+
+// The adaptors and functions that only need <type_traits>, <utility> and
+// std::reference_wrapper from the standard library. The headers that need
+// threads, allocators, containers, <functional> or <variant> are left out,
+// and with BOOST_HOF_UNPACK_STD_SEQUENCES set to 0, <tuple> and <array> are
+// not included either.
+
+#include <boost/hof/alias.hpp>
+#include <boost/hof/always.hpp>
+#include <boost/hof/apply_eval.hpp>
+#include <boost/hof/apply.hpp>
+#include <boost/hof/arg.hpp>
+#include <boost/hof/proj.hpp>
+#include <boost/hof/combine.hpp>
+#include <boost/hof/compose.hpp>
+#include <boost/hof/fold.hpp>
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/construct.hpp>
+#include <boost/hof/decay.hpp>
+#include <boost/hof/decorate.hpp>
+#include <boost/hof/dispatch_index.hpp>
+#include <boost/hof/drop.hpp>
+#include <boost/hof/eval.hpp>
+#include <boost/hof/filter.hpp>
+#include <boost/hof/fix.hpp>
+#include <boost/hof/fixed_view.hpp>
+#include <boost/hof/flip.hpp>
+#include <boost/hof/flow.hpp>
+#include <boost/hof/fold_into.hpp>
+#include <boost/hof/function.hpp>
+#include <boost/hof/identity.hpp>
+#include <boost/hof/if.hpp>
+#include <boost/hof/implicit.hpp>
+#include <boost/hof/indirect.hpp>
+#include <boost/hof/infix.hpp>
+#include <boost/hof/is_associative.hpp>
+#include <boost/hof/is_commutative.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <boost/hof/is_trivially_relocatable.hpp>
+#include <boost/hof/lambda.hpp>
+#include <boost/hof/lift.hpp>
+#include <boost/hof/limit.hpp>
+#include <boost/hof/map.hpp>
+#include <boost/hof/match.hpp>
+#include <boost/hof/mutable.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/partial.hpp>
+#include <boost/hof/permute.hpp>
+#include <boost/hof/pipable.hpp>
+#include <boost/hof/protect.hpp>
+#include <boost/hof/repeat.hpp>
+#include <boost/hof/repeat_while.hpp>
+#include <boost/hof/repeat_while_step.hpp>
+#include <boost/hof/result.hpp>
+#include <boost/hof/returns.hpp>
+#include <boost/hof/reveal.hpp>
+#include <boost/hof/reverse_fold.hpp>
+#include <boost/hof/rotate.hpp>
+#include <boost/hof/select.hpp>
+#include <boost/hof/static.hpp>
+#include <boost/hof/tap.hpp>
+#include <boost/hof/tree_fold.hpp>
+#include <boost/hof/typed.hpp>
+#include <boost/hof/unpack.hpp>
+
+#endif
@@ -0,0 +1,150 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    counted_first_of.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_COUNTED_FIRST_OF_H
+#define BOOST_HOF_GUARD_COUNTED_FIRST_OF_H
+
+/// counted_first_of
+/// ================
+///
+/// Description
+/// -----------
+///
+/// The `counted_first_of` function adaptor is the same as
+/// [`first_of`](first_of), except it counts how many times each function
+/// was selected. The counts are read with `stats`, which returns a snapshot
+/// of them in the same order as the functions, and are cleared with
+/// `reset`.
+///
+/// This can be used to tune the order of the functions, since the functions
+/// that are called most often can be moved first, and the cold fallbacks can
+/// be moved to the end. The function that is selected is known at compile
+/// time, so the only cost of each call is a relaxed atomic increment. The
+/// counts are split in shards, each on its own cache line, so the threads
+/// that call the function at the same time mostly increment different cache
+/// lines, and the shards are summed by `stats`. A copy starts with the counts
+/// it was copied from.
+///
+/// Since the counters are updated on every call, the adaptor can't be used
+/// to define a [`BOOST_HOF_STATIC_FUNCTION`](function). The functions of a
+/// [`match`](match) are chosen by overload resolution, which depends on the
+/// parameters of each function and can't be observed, so there is no
+/// counted version of `match`. The order of the functions also doesn't
+/// matter for `match`.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Fs>
+///     counted_first_of_adaptor<Fs...> counted_first_of(Fs... fs);
+///
+///     std::array<std::size_t, sizeof...(Fs)> counted_first_of_adaptor<Fs...>::stats() const;
+///
+///     void counted_first_of_adaptor<Fs...>::reset() const;
+///
+/// Semantics
+/// ---------
+///
+///     assert(counted_first_of(fs...)(xs...) == first_of(fs...)(xs...));
+///
+/// Requirements
+/// ------------
+///
+/// Fs must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct for_ints
+///     {
+///         int operator()(int) const
+///         {
+///             return 1;
+///         }
+///     };
+///
+///     struct for_pointers
+///     {
+///         int operator()(void*) const
+///         {
+///             return 2;
+///         }
+///     };
+///
+///     int main() {
+///         auto f = boost::hof::counted_first_of(for_ints(), for_pointers());
+///         f(1);
+///         f(nullptr);
+///         f(nullptr);
+///         assert(f.stats()[0] == 1);
+///         assert(f.stats()[1] == 2);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [first_of](first_of)
+/// * [profiled](profiled)
+///
+
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <boost/hof/detail/sharded_counter.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace boost { namespace hof {
+
+template<class... Fs>
+struct counted_first_of_adaptor : first_of_adaptor<Fs...>
+{
+    typedef first_of_adaptor<Fs...> base;
+    typedef std::array<std::size_t, sizeof...(Fs)> stats_type;
+
+    mutable detail::sharded_counter<sizeof...(Fs)> counters;
+
+    constexpr counted_first_of_adaptor(Fs... fs)
+    : base(boost::hof::move(fs)...), counters()
+    {}
+
+    template<class... Ts, class I=detail::first_of_select<0, sizeof...(Fs), detail::first_of_args<Fs...>, detail::first_of_args<Ts...>>>
+    BOOST_HOF_INLINE auto operator()(Ts&&... xs) const
+    -> decltype(std::declval<const base&>()(BOOST_HOF_FORWARD(Ts)(xs)...))
+    {
+        counters.add(I::value);
+        return base::operator()(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+
+    stats_type stats() const noexcept
+    {
+        stats_type r;
+        for (std::size_t i = 0; i < sizeof...(Fs); i++) r[i] = std::size_t(counters.load(i));
+        return r;
+    }
+
+    void reset() const noexcept
+    {
+        counters.reset();
+    }
+};
+
+BOOST_HOF_DETAIL_COMPILE_MARKER(counted_first_of, counted_first_of_adaptor)
+
+BOOST_HOF_DECLARE_STATIC_VAR(counted_first_of, detail::make<counted_first_of_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
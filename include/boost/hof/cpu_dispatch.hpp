@@ -0,0 +1,293 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    cpu_dispatch.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_CPU_DISPATCH_H
+#define BOOST_HOF_GUARD_CPU_DISPATCH_H
+
+/// cpu_dispatch
+/// ============
+///
+/// Description
+/// -----------
+///
+/// The `cpu_dispatch` function adaptor calls the first function that is
+/// supported by the processor, like [`first_of`](first_of) does for the
+/// functions that are callable. A function is marked with the instruction set
+/// that it needs with `cpu_target`, and the functions that aren't marked are
+/// always supported, so the last function must not be marked, to be the
+/// fallback.
+///
+/// The processor is only checked once, by the first call, and the choice is
+/// kept for the type of the adaptor, so the later calls go through the same
+/// table of function pointers as [`dispatch_index`](dispatch_index), without
+/// checking the processor again. Since the adaptor is still constexpr
+/// constructible, it can be declared with
+/// [`BOOST_HOF_STATIC_FUNCTION`](function).
+///
+/// The instruction sets are checked with `__builtin_cpu_supports` when
+/// compiling for x86 with gcc or clang. Otherwise, an instruction set is only
+/// supported when the compiler already targets it, such as `__AVX2__` for
+/// `cpu_avx2`. Other instruction sets can be used as a class with a static
+/// `supported` function that returns whether the processor supports it.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Fs>
+///     constexpr cpu_dispatch_adaptor<Fs...> cpu_dispatch(Fs... fs);
+///
+///     template<class Feature, class F>
+///     constexpr cpu_target_adaptor<Feature, F> cpu_target(F f);
+///
+///     struct cpu_sse2;
+///     struct cpu_sse4_2;
+///     struct cpu_avx;
+///     struct cpu_avx2;
+///     struct cpu_avx512f;
+///     struct cpu_neon;
+///
+/// Semantics
+/// ---------
+///
+///     assert(cpu_dispatch(cpu_target<Feature>(f), gs...)(xs...) == (Feature::supported() ? f(xs...) : cpu_dispatch(gs...)(xs...)));
+///     assert(cpu_dispatch(f, gs...)(xs...) == f(xs...));
+///
+/// Requirements
+/// ------------
+///
+/// Fs must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct avx2_sum
+///     {
+///         int operator()(int x, int y) const
+///         {
+///             return x + y;
+///         }
+///     };
+///
+///     struct scalar_sum
+///     {
+///         int operator()(int x, int y) const
+///         {
+///             return x + y;
+///         }
+///     };
+///
+///     BOOST_HOF_STATIC_FUNCTION(sum) = boost::hof::cpu_dispatch(
+///         boost::hof::cpu_target<boost::hof::cpu_avx2>(avx2_sum()),
+///         scalar_sum()
+///     );
+///
+///     int main() {
+///         assert(sum(1, 2) == 3);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [dispatch_index](dispatch_index)
+/// * [first_of](first_of)
+///
+
+#include <boost/hof/dispatch_index.hpp>
+#include <boost/hof/always.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/detail/type_at.hpp>
+#include <cstddef>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define BOOST_HOF_DETAIL_HAS_CPU_SUPPORTS 1
+#else
+#define BOOST_HOF_DETAIL_HAS_CPU_SUPPORTS 0
+#endif
+
+#if BOOST_HOF_DETAIL_HAS_CPU_SUPPORTS
+#define BOOST_HOF_DETAIL_CPU_FEATURE(name, feature, enabled) \
+struct name \
+{ \
+    static bool supported() noexcept \
+    { \
+        __builtin_cpu_init(); \
+        return __builtin_cpu_supports(feature); \
+    } \
+};
+#else
+#define BOOST_HOF_DETAIL_CPU_FEATURE(name, feature, enabled) \
+struct name \
+{ \
+    static bool supported() noexcept \
+    { \
+        return enabled; \
+    } \
+};
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BOOST_HOF_DETAIL_CPU_SSE2 true
+#else
+#define BOOST_HOF_DETAIL_CPU_SSE2 false
+#endif
+
+#if defined(__SSE4_2__) || defined(__AVX__)
+#define BOOST_HOF_DETAIL_CPU_SSE4_2 true
+#else
+#define BOOST_HOF_DETAIL_CPU_SSE4_2 false
+#endif
+
+#ifdef __AVX__
+#define BOOST_HOF_DETAIL_CPU_AVX true
+#else
+#define BOOST_HOF_DETAIL_CPU_AVX false
+#endif
+
+#ifdef __AVX2__
+#define BOOST_HOF_DETAIL_CPU_AVX2 true
+#else
+#define BOOST_HOF_DETAIL_CPU_AVX2 false
+#endif
+
+#ifdef __AVX512F__
+#define BOOST_HOF_DETAIL_CPU_AVX512F true
+#else
+#define BOOST_HOF_DETAIL_CPU_AVX512F false
+#endif
+
+namespace boost { namespace hof {
+
+BOOST_HOF_DETAIL_CPU_FEATURE(cpu_sse2, "sse2", BOOST_HOF_DETAIL_CPU_SSE2)
+BOOST_HOF_DETAIL_CPU_FEATURE(cpu_sse4_2, "sse4.2", BOOST_HOF_DETAIL_CPU_SSE4_2)
+BOOST_HOF_DETAIL_CPU_FEATURE(cpu_avx, "avx", BOOST_HOF_DETAIL_CPU_AVX)
+BOOST_HOF_DETAIL_CPU_FEATURE(cpu_avx2, "avx2", BOOST_HOF_DETAIL_CPU_AVX2)
+BOOST_HOF_DETAIL_CPU_FEATURE(cpu_avx512f, "avx512f", BOOST_HOF_DETAIL_CPU_AVX512F)
+
+// Neon isn't optional for 64-bit arm
+struct cpu_neon
+{
+    static bool supported() noexcept
+    {
+#if defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
+        return true;
+#else
+        return false;
+#endif
+    }
+};
+
+template<class Feature, class F>
+struct cpu_target_adaptor : detail::callable_base<F>
+{
+    typedef Feature feature;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(cpu_target_adaptor, detail::callable_base<F>)
+
+    template<class... Ts>
+    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class... Ts, class R=decltype(std::declval<const detail::callable_base<F>&>()(std::declval<Ts>()...))>
+    R operator()(Ts&&... xs) const
+    {
+        return this->base_function(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+template<class Feature, class F>
+constexpr cpu_target_adaptor<Feature, F> cpu_target(F f)
+{
+    return cpu_target_adaptor<Feature, F>(static_cast<F&&>(f));
+}
+
+namespace detail {
+
+template<class F>
+struct cpu_target_supported
+{
+    static bool call() noexcept
+    {
+        return true;
+    }
+};
+
+template<class Feature, class F>
+struct cpu_target_supported<cpu_target_adaptor<Feature, F>>
+{
+    static bool call() noexcept
+    {
+        return Feature::supported();
+    }
+};
+
+template<class F>
+struct is_cpu_target
+: std::false_type
+{};
+
+template<class Feature, class F>
+struct is_cpu_target<cpu_target_adaptor<Feature, F>>
+: std::true_type
+{};
+
+inline std::size_t cpu_dispatch_select(std::size_t i) noexcept
+{
+    return i;
+}
+
+template<class... Bs>
+std::size_t cpu_dispatch_select(std::size_t i, bool b, Bs... bs) noexcept
+{
+    return b ? i : detail::cpu_dispatch_select(i + 1, bs...);
+}
+
+}
+
+template<class... Fs>
+struct cpu_dispatch_adaptor
+: dispatch_index_adaptor<Fs...>
+{
+    static_assert(sizeof...(Fs) > 0, "cpu_dispatch needs a function");
+    static_assert(!detail::is_cpu_target<typename detail::type_at<sizeof...(Fs) - 1, Fs...>::type>::value,
+        "The last function of cpu_dispatch must not need an instruction set");
+
+    typedef dispatch_index_adaptor<Fs...> base_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(cpu_dispatch_adaptor, base_type)
+
+    // The last function is always supported, so it isn't checked
+    static std::size_t index() noexcept
+    {
+        static const std::size_t i = detail::cpu_dispatch_select(0, detail::cpu_target_supported<Fs>::call()...);
+        return i;
+    }
+
+    template<class... Ts, class R=decltype(std::declval<const base_type&>()(std::size_t(), std::declval<Ts>()...))>
+    BOOST_HOF_INLINE R operator()(Ts&&... xs) const
+    {
+        return base_type::operator()(index(), BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+BOOST_HOF_DETAIL_COMPILE_MARKER(cpu_dispatch, cpu_dispatch_adaptor)
+
+BOOST_HOF_DECLARE_STATIC_VAR(cpu_dispatch, detail::make<cpu_dispatch_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
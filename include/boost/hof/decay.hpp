@@ -15,6 +15,9 @@
 /// -----------
 /// 
 /// The `decay` function is a unary function object that returns whats given to it after decaying its type.
+/// A `std::reference_wrapper` is unwrapped to a reference, and a value marked
+/// with [`borrow`](borrow) is returned as a view of the value, such as a
+/// `std::string_view` for a `std::string`.
 /// 
 /// Synopsis
 /// --------
@@ -31,6 +34,7 @@
 /// References
 /// ----------
 /// 
+/// * [borrow](borrow)
 /// * [n3255](http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2011/n3255.html) - Proposal for `decay_copy`
 /// 
 
@@ -53,7 +57,7 @@ struct decay_f
         class Result=typename unwrap_reference<typename std::decay<T>::type>::type, 
         class=typename std::enable_if<(BOOST_HOF_IS_CONSTRUCTIBLE(Result, T))>::type
     >
-    constexpr Result operator()(T&& x) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Result, T&&)
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr Result operator()(T&& x) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Result, T&&)
     {
         return BOOST_HOF_FORWARD(T)(x);
     }
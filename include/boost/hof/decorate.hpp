@@ -108,7 +108,7 @@ struct decorator_invoke
     }
 
     template<class... Ts>
-    constexpr const F& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr const F& base_function(Ts&&... xs) const noexcept
     {
         return this->second(xs...);
     }
@@ -144,7 +144,7 @@ struct decorator_invoke
     {};
 
     template<class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(const D&, id_<const T&>, id_<const F&>, id_<Ts>...) 
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(const D&, id_<const T&>, id_<const F&>, id_<Ts>...) 
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         BOOST_HOF_MANGLE_CAST(const D&)(BOOST_HOF_CONST_THIS->get_decorator(xs...))(
@@ -175,7 +175,7 @@ struct decoration
     }
 
     template<class F>
-    constexpr decorator_invoke<D, T, detail::callable_base<F>> operator()(F f) const
+    BOOST_HOF_INLINE constexpr decorator_invoke<D, T, detail::callable_base<F>> operator()(F f) const
     BOOST_HOF_NOEXCEPT(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(decorator_invoke<D, T, detail::callable_base<F>>, compressed_pair<D, T>, detail::callable_base<F>&&))
     {
         return decorator_invoke<D, T, detail::callable_base<F>>(
@@ -194,15 +194,15 @@ struct decorate_adaptor : detail::callable_base<F>
     BOOST_HOF_INHERIT_CONSTRUCTOR(decorate_adaptor, detail::callable_base<F>)
 
     template<class... Ts>
-    constexpr const base& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr const base& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     // TODO: Add predicate for constraints
 
     template<class T>
-    constexpr detail::decoration<base, T> operator()(T x) const 
+    BOOST_HOF_INLINE constexpr detail::decoration<base, T> operator()(T x) const 
     BOOST_HOF_NOEXCEPT(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(base, const base&) && BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(T, T&&))
     {
         return detail::decoration<base, T>(this->base_function(x), static_cast<T&&>(x));
@@ -210,6 +210,8 @@ struct decorate_adaptor : detail::callable_base<F>
 
 };
 
+BOOST_HOF_DETAIL_COMPILE_MARKER(decorate, decorate_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(decorate, detail::make<decorate_adaptor>);
 
 }} // namespace boost::hof
@@ -0,0 +1,202 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    describe.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DESCRIBE_H
+#define BOOST_HOF_GUARD_DESCRIBE_H
+
+/// describe
+/// ========
+///
+/// Description
+/// -----------
+///
+/// The `describe` function renders the tree of adaptors of a function object
+/// type, with one line for each adaptor and each function it is built from.
+/// Each line has the name of the type, its size, and whether it is empty. An
+/// empty function takes no space in the adaptor that stores it, so a
+/// function that isn't empty, such as a lambda with captures, stands out.
+/// The size of the first line is the size of the whole function object.
+///
+/// The adaptors are the class templates of the `boost::hof` namespace, and
+/// the functions they are built from are their type parameters, which are
+/// described the same way. The other types are only described by their
+/// name, which is the name given by the compiler, so it is only meant to be
+/// read. The name and the size of each type are known at compile time, but
+/// the result is a `std::string`, since it is built when it is called.
+///
+/// The size of a closure can also be checked when it is built, with
+/// `BOOST_HOF_ASSERT_CLOSURE_SIZE`, which fails the build when the function
+/// object of the expression is bigger than the given number of bytes, and
+/// with `BOOST_HOF_ASSERT_TRIVIAL`, which fails the build when it isn't
+/// trivially copyable, so it can't be copied into a table as bytes. The
+/// expression isn't evaluated. When an assertion fails, `describe` shows
+/// which function made the closure grow.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F>
+///     std::string describe();
+///
+///     #define BOOST_HOF_ASSERT_CLOSURE_SIZE(expression, bytes)
+///
+///     #define BOOST_HOF_ASSERT_TRIVIAL(expression)
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <iostream>
+///
+///     struct increment
+///     {
+///         int operator()(int x) const
+///         {
+///             return x + 1;
+///         }
+///     };
+///
+///     int main() {
+///         int n = 2;
+///         auto f = boost::hof::flow(increment(), [n](int x) { return x * n; });
+///         std::string s = boost::hof::describe<decltype(f)>();
+///         assert(s.find("flow_adaptor") == 0);
+///         std::cout << s;
+///         BOOST_HOF_ASSERT_CLOSURE_SIZE(f, 64);
+///         BOOST_HOF_ASSERT_TRIVIAL(f);
+///     }
+///
+
+#include <boost/hof/config.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+
+// The function is outside of the namespace, since gcc leaves out the
+// namespaces of the function from the names of the types in its signature
+template<class T>
+const char* boost_hof_describe_signature() noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+// The name of the type is found in the signature of the function that is
+// instantiated for it
+template<class T>
+std::string describe_name()
+{
+    std::string s = boost_hof_describe_signature<T>();
+#if defined(_MSC_VER) && !defined(__clang__)
+    std::size_t first = s.find("boost_hof_describe_signature<") + 29;
+    std::size_t last = s.rfind(">(void)");
+#else
+    std::size_t first = s.find("T = ") + 4;
+    std::size_t last = s.rfind(']');
+#endif
+    s = s.substr(first, last - first);
+    for (const char* prefix : { "struct ", "class " })
+    {
+        std::string p = prefix;
+        if (s.compare(0, p.size(), p) == 0) s = s.substr(p.size());
+    }
+    return s;
+}
+
+inline void describe_line(std::string& out, std::size_t depth, const std::string& name, std::size_t size, bool empty)
+{
+    out.append(2 * depth, ' ');
+    out += name;
+    out += " size=";
+    out += std::to_string(size);
+    if (empty) out += " empty";
+    out += '\n';
+}
+
+template<class T, class=void>
+struct describe_node
+{
+    static void write(std::string& out, std::size_t depth)
+    {
+        detail::describe_line(out, depth, detail::describe_name<T>(), sizeof(T), std::is_empty<T>::value);
+    }
+};
+
+// A parameter that isn't a function, such as the state of a fold
+template<class T>
+struct describe_node<T, typename std::enable_if<std::is_void<T>::value>::type>
+{
+    static void write(std::string&, std::size_t)
+    {}
+};
+
+template<class... Ts>
+struct describe_children;
+
+template<>
+struct describe_children<>
+{
+    static void write(std::string&, std::size_t)
+    {}
+};
+
+template<class T, class... Ts>
+struct describe_children<T, Ts...>
+{
+    static void write(std::string& out, std::size_t depth)
+    {
+        describe_node<T>::write(out, depth);
+        describe_children<Ts...>::write(out, depth);
+    }
+};
+
+template<template<class...> class Adaptor, class... Ts>
+struct describe_node<Adaptor<Ts...>>
+{
+    static void write(std::string& out, std::size_t depth)
+    {
+        std::string name = detail::describe_name<Adaptor<Ts...>>();
+        std::string ns = "boost::hof::";
+        if (name.compare(0, ns.size(), ns) != 0)
+        {
+            detail::describe_line(out, depth, name, sizeof(Adaptor<Ts...>), std::is_empty<Adaptor<Ts...>>::value);
+            return;
+        }
+        detail::describe_line(out, depth, name.substr(ns.size(), name.find('<') - ns.size()), sizeof(Adaptor<Ts...>), std::is_empty<Adaptor<Ts...>>::value);
+        describe_children<Ts...>::write(out, depth + 1);
+    }
+};
+
+}
+
+template<class F>
+std::string describe()
+{
+    std::string out;
+    detail::describe_node<typename std::remove_cv<typename std::remove_reference<F>::type>::type>::write(out, 0);
+    return out;
+}
+
+}} // namespace boost::hof
+
+#define BOOST_HOF_ASSERT_CLOSURE_SIZE(expression, bytes) \
+    static_assert(sizeof(expression) <= (bytes), "The closure of " #expression " is bigger than " #bytes " bytes")
+
+#define BOOST_HOF_ASSERT_TRIVIAL(...) \
+    static_assert(std::is_trivially_copyable<typename std::decay<decltype(__VA_ARGS__)>::type>::value, \
+        "The closure of " #__VA_ARGS__ " isn't trivially copyable")
+
+#endif
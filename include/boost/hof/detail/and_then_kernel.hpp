@@ -0,0 +1,81 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    and_then_kernel.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_AND_THEN_KERNEL_H
+#define BOOST_HOF_GUARD_DETAIL_AND_THEN_KERNEL_H
+
+#include <boost/hof/config.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof { namespace detail {
+
+template<int N>
+struct and_then_rank : and_then_rank<N-1>
+{};
+
+template<>
+struct and_then_rank<0>
+{};
+
+// The failure is already the type of the result
+template<class R, class T, class=typename std::enable_if<
+    std::is_same<R, typename std::decay<T>::type>::value
+>::type>
+BOOST_HOF_COLD constexpr R and_then_fail(T&& r, and_then_rank<2>)
+{
+    return BOOST_HOF_FORWARD(T)(r);
+}
+
+// The error of an expected is moved into the expected of the result
+template<class R, class T>
+BOOST_HOF_COLD constexpr auto and_then_fail(T&& r, and_then_rank<1>)
+-> decltype(R(typename R::unexpected_type(BOOST_HOF_FORWARD(T)(r).error())))
+{
+    return R(typename R::unexpected_type(BOOST_HOF_FORWARD(T)(r).error()));
+}
+
+// An empty optional
+template<class R, class T>
+BOOST_HOF_COLD constexpr R and_then_fail(T&&, and_then_rank<0>)
+{
+    return R();
+}
+
+template<class R, class T, class G>
+BOOST_HOF_INLINE constexpr R and_then_bind(T&& r, const G& g)
+{
+    return BOOST_HOF_LIKELY(bool(r)) ?
+        R(g(*BOOST_HOF_FORWARD(T)(r))) :
+        detail::and_then_fail<R>(BOOST_HOF_FORWARD(T)(r), and_then_rank<2>());
+}
+
+// Calls the first function, and then the second function with the value
+// of the result, unless the result has no value
+template<class F1, class F2>
+struct and_then_kernel : compressed_pair<callable_base<F1>, callable_base<F2>>
+{
+    typedef compressed_pair<callable_base<F1>, callable_base<F2>> base_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(and_then_kernel, base_type)
+
+    template<class... Ts,
+        class T=decltype(std::declval<const callable_base<F1>&>()(std::declval<Ts>()...)),
+        class R=decltype(std::declval<const callable_base<F2>&>()(*std::declval<T>()))>
+    BOOST_HOF_INLINE constexpr R operator()(Ts&&... xs) const
+    {
+        return detail::and_then_bind<R>(this->first(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...), this->second(xs...));
+    }
+};
+
+}}} // namespace boost::hof
+
+#endif
@@ -25,11 +25,53 @@ namespace boost { namespace hof { namespace detail {
 template<class F>
 struct non_class_function
 {
-    F f;
+    BOOST_HOF_NO_UNIQUE_ADDRESS F f;
     BOOST_HOF_DELEGATE_CONSTRUCTOR(non_class_function, F, f)
 
     template<class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(apply_f, id_<F>, id_<Ts>...) 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(apply_f, id_<F>, id_<Ts>...) 
+    operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
+    (
+        boost::hof::apply(f, BOOST_HOF_FORWARD(Ts)(xs)...)
+    );
+};
+
+template<class F>
+struct member_data_class;
+
+template<class R, class C>
+struct member_data_class<R C::*>
+{
+    typedef C type;
+};
+
+template<class F, class... Ts>
+struct is_member_data_direct
+: std::false_type
+{};
+
+template<class F, class T>
+struct is_member_data_direct<F, T>
+: std::is_base_of<typename member_data_class<F>::type, typename std::decay<T>::type>
+{};
+
+// A member data pointer, such as a projection, reads the member of an
+// object directly, instead of selecting the overload of apply for it
+template<class F>
+struct member_data_function
+{
+    F f;
+    BOOST_HOF_DELEGATE_CONSTRUCTOR(member_data_function, F, f)
+
+    template<class T, class=typename std::enable_if<(is_member_data_direct<F, T>::value)>::type>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(T&& x) const noexcept
+    -> decltype(std::declval<T>().*std::declval<const F&>())
+    {
+        return BOOST_HOF_FORWARD(T)(x).*f;
+    }
+
+    template<class... Ts, class=typename std::enable_if<(!is_member_data_direct<F, Ts...>::value)>::type>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(apply_f, id_<F>, id_<Ts>...) 
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         boost::hof::apply(f, BOOST_HOF_FORWARD(Ts)(xs)...)
@@ -38,7 +80,9 @@ struct non_class_function
 
 template<class F>
 struct callable_base_type
-: std::conditional<(BOOST_HOF_IS_CLASS(F) && !BOOST_HOF_IS_FINAL(F) && !BOOST_HOF_IS_POLYMORPHIC(F)), F, non_class_function<F>>
+: std::conditional<(BOOST_HOF_IS_CLASS(F) && !BOOST_HOF_IS_FINAL(F) && !BOOST_HOF_IS_POLYMORPHIC(F)), F, 
+    typename std::conditional<std::is_member_object_pointer<F>::value, member_data_function<F>, non_class_function<F>>::type
+>
 {};
 
 #if BOOST_HOF_CALLABLE_BASE_USE_TEMPLATE_ALIAS
@@ -12,10 +12,24 @@
 #include <boost/hof/detail/and.hpp>
 #include <boost/hof/detail/holder.hpp>
 #include <boost/hof/detail/using.hpp>
+#include <type_traits>
 
 namespace boost { namespace hof { namespace detail {
 
-#if BOOST_HOF_NO_EXPRESSION_SFINAE
+#if BOOST_HOF_HAS_CONCEPTS
+
+// The satisfaction of the concept is cached by the compiler, and a failure
+// is reported as the unsatisfied call instead of a failed specialization
+template<class F, class... Ts>
+concept callable_with = requires(F&& f, Ts&&... xs)
+{
+    static_cast<F&&>(f)(static_cast<Ts&&>(xs)...);
+};
+
+template<class F, class... Ts>
+BOOST_HOF_USING(can_be_called, std::integral_constant<bool, callable_with<F&&, Ts&&...>>);
+
+#elif BOOST_HOF_NO_EXPRESSION_SFINAE
 struct dont_care
 {
     dont_care(...);
@@ -37,7 +51,7 @@ template<class F>
 struct is_callable_wrapper_fallback
 {
     template<class... Ts>
-    auto operator()(Ts&&...) const 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE auto operator()(Ts&&...) const 
     -> decltype(std::declval<F>()(std::declval<Ts>()...));
 };
 
@@ -111,8 +125,11 @@ struct can_be_called_impl<F, callable_args<Args...>, typename detail::holder<
 : std::true_type
 {};
 
+// The check is keyed on the reference types that are called, since a value
+// and an rvalue reference are called the same way, so the same check is
+// shared by all the adaptors
 template<class F, class... Ts>
-BOOST_HOF_USING(can_be_called, can_be_called_impl<F, detail::callable_args<Ts...>>);
+BOOST_HOF_USING(can_be_called, can_be_called_impl<F&&, detail::callable_args<Ts&&...>>);
 
 #endif
 
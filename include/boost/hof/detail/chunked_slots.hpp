@@ -0,0 +1,101 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    chunked_slots.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_CHUNKED_SLOTS_H
+#define BOOST_HOF_GUARD_DETAIL_CHUNKED_SLOTS_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+namespace boost { namespace hof { namespace detail {
+
+// A slot for each index, which owns the object it points to. The objects
+// are found without locking, and the lock is only taken to create a missing
+// object. Chunk `i` holds `2^i` slots, so a chunk never has to be moved
+// once it is published.
+template<class T>
+struct chunked_slots
+{
+    typedef std::atomic<T*> slot_type;
+    std::mutex m;
+    std::array<std::atomic<slot_type*>, sizeof(std::size_t) * 8> chunks;
+
+    chunked_slots()
+    {
+        for (auto& chunk : chunks) chunk.store(nullptr, std::memory_order_relaxed);
+    }
+
+    chunked_slots(const chunked_slots&)=delete;
+    chunked_slots& operator=(const chunked_slots&)=delete;
+
+    ~chunked_slots()
+    {
+        for (std::size_t i = 0; i < chunks.size(); i++)
+        {
+            slot_type* chunk = chunks[i].load(std::memory_order_relaxed);
+            if (chunk == nullptr) continue;
+            for (std::size_t j = 0; j < (std::size_t(1) << i); j++)
+                delete chunk[j].load(std::memory_order_relaxed);
+            delete[] chunk;
+        }
+    }
+
+    // The object is created with `make`, which returns a pointer from a new
+    // expression, when the slot is empty
+    template<class Make>
+    T& get(std::size_t index, Make make)
+    {
+        std::size_t id = index + 1;
+        std::size_t i = 0;
+        while ((id >> (i + 1)) != 0) i++;
+        std::size_t j = id - (std::size_t(1) << i);
+        slot_type* chunk = chunks[i].load(std::memory_order_acquire);
+        T* p = chunk == nullptr ? nullptr : chunk[j].load(std::memory_order_acquire);
+        if (p == nullptr) p = this->create(i, j, make);
+        return *p;
+    }
+
+    template<class Make>
+    T* create(std::size_t i, std::size_t j, Make& make)
+    {
+        std::lock_guard<std::mutex> lock(m);
+        slot_type* chunk = chunks[i].load(std::memory_order_relaxed);
+        if (chunk == nullptr)
+        {
+            chunk = new slot_type[std::size_t(1) << i]();
+            chunks[i].store(chunk, std::memory_order_release);
+        }
+        T* p = chunk[j].load(std::memory_order_relaxed);
+        if (p == nullptr)
+        {
+            p = make();
+            chunk[j].store(p, std::memory_order_release);
+        }
+        return p;
+    }
+
+    template<class G>
+    void for_each(const G& g) const
+    {
+        for (std::size_t i = 0; i < chunks.size(); i++)
+        {
+            slot_type* chunk = chunks[i].load(std::memory_order_acquire);
+            if (chunk == nullptr) continue;
+            for (std::size_t j = 0; j < (std::size_t(1) << i); j++)
+            {
+                const T* p = chunk[j].load(std::memory_order_acquire);
+                if (p != nullptr) g(*p);
+            }
+        }
+    }
+};
+
+}}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,108 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    co_flow_kernel.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_CO_FLOW_KERNEL_H
+#define BOOST_HOF_GUARD_DETAIL_CO_FLOW_KERNEL_H
+
+#include <boost/hof/co_task.hpp>
+
+#if BOOST_HOF_HAS_COROUTINES
+
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/delegate.hpp>
+
+namespace boost { namespace hof { namespace detail {
+
+template<class F, class A, bool=std::is_void<typename co_await_result<A>::type>::value>
+struct co_next_result
+{
+    typedef decltype(std::declval<const F&>()(std::declval<typename co_await_result<A>::type>())) type;
+};
+
+template<class F, class A>
+struct co_next_result<F, A, true>
+{
+    typedef decltype(std::declval<const F&>()()) type;
+};
+
+template<class T, bool=is_co_awaitable<T>::value>
+struct co_unwrap
+{
+    typedef T type;
+};
+
+template<class T>
+struct co_unwrap<T, true>
+{
+    typedef typename co_await_result<T>::type type;
+};
+
+template<class F, class A>
+struct co_flow_result
+{
+    typedef co_task<typename std::decay<
+        typename co_unwrap<typename co_next_result<F, A>::type>::type
+    >::type> type;
+};
+
+// The next function and the awaitable are stored in the coroutine frame, so
+// the task can be awaited after the adaptor is gone.
+template<class R, class F, class A>
+R co_flow_then(F f, A a)
+{
+    typedef typename co_next_result<F, A>::type next_type;
+    if constexpr (std::is_void<typename co_await_result<A>::type>::value)
+    {
+        co_await std::move(a);
+        if constexpr (is_co_awaitable<next_type>::value) co_return co_await f();
+        else co_return f();
+    }
+    else
+    {
+        if constexpr (is_co_awaitable<next_type>::value) co_return co_await f(co_await std::move(a));
+        else co_return f(co_await std::move(a));
+    }
+}
+
+template<class F, class A, typename std::enable_if<(is_co_awaitable<A>::value), int>::type = 0>
+typename co_flow_result<F, A>::type co_flow_step(const F& f, A&& a)
+{
+    return co_flow_then<typename co_flow_result<F, A>::type, F, typename std::decay<A>::type>(f, BOOST_HOF_FORWARD(A)(a));
+}
+
+template<class F, class A, typename std::enable_if<(!is_co_awaitable<A>::value), int>::type = 0>
+auto co_flow_step(const F& f, A&& a) -> decltype(f(BOOST_HOF_FORWARD(A)(a)))
+{
+    return f(BOOST_HOF_FORWARD(A)(a));
+}
+
+// Calls F1 and then passes the result to F2. A coroutine is only created
+// when the result of F1 is awaitable, so stages that are not awaitable are
+// called directly.
+template<class F1, class F2>
+struct co_flow_kernel : compressed_pair<callable_base<F1>, callable_base<F2>>
+{
+    typedef compressed_pair<callable_base<F1>, callable_base<F2>> base_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(co_flow_kernel, base_type)
+
+    template<class... Ts>
+    auto operator()(Ts&&... xs) const -> decltype(detail::co_flow_step(
+        std::declval<const callable_base<F2>&>(),
+        std::declval<const callable_base<F1>&>()(std::declval<Ts>()...)
+    ))
+    {
+        return detail::co_flow_step(this->second(xs...), this->first(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...));
+    }
+};
+
+}}} // namespace boost::hof
+
+#endif
+
+#endif
@@ -0,0 +1,100 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    compile_marker.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_COMPILE_MARKER_H
+#define BOOST_HOF_GUARD_DETAIL_COMPILE_MARKER_H
+
+#include <boost/hof/config.hpp>
+#include <boost/hof/detail/join.hpp>
+
+#if BOOST_HOF_COMPILE_MARKERS
+namespace boost { namespace hof { namespace detail {
+
+// The adaptor is completed while the marker is instantiated, so in a
+// compile time trace the cost of the adaptor and everything it instantiates
+// is nested under the marker
+template<class Adaptor>
+struct compile_frame
+{
+    typedef Adaptor type;
+    static_assert(sizeof(Adaptor) > 0, "The adaptor must be complete");
+};
+
+// Finds the marker that make instantiates for an adaptor
+template<template<class...> class Adaptor>
+struct compile_marker_of
+{
+    template<class... Fs>
+    using apply = compile_frame<BOOST_HOF_JOIN(Adaptor, Fs...)>;
+};
+
+}}} // namespace boost::hof
+
+#define BOOST_HOF_DETAIL_MAKE_RESULT(adaptor, ...) \
+typename boost::hof::detail::compile_marker_of<adaptor>::template apply<__VA_ARGS__>::type
+
+// Defines the marker for an adaptor, which has the short name of the
+// adaptor in the markers namespace
+#define BOOST_HOF_DETAIL_COMPILE_MARKER(name, adaptor) \
+namespace markers { \
+template<class... Fs> \
+struct name : boost::hof::detail::compile_frame<BOOST_HOF_JOIN(adaptor, Fs...)> \
+{}; \
+} \
+namespace detail { \
+template<> \
+struct compile_marker_of<adaptor> \
+{ \
+    template<class... Fs> \
+    using apply = markers::name<Fs...>; \
+}; \
+}
+#else
+#define BOOST_HOF_DETAIL_MAKE_RESULT(adaptor, ...) BOOST_HOF_JOIN(adaptor, __VA_ARGS__)
+#define BOOST_HOF_DETAIL_COMPILE_MARKER(name, adaptor)
+#endif
+
+#if BOOST_HOF_INSTANTIATION_STATS
+namespace boost { namespace hof { namespace markers { namespace calls {
+
+// Each call operator instantiates the marker of its adaptor with the types
+// of the arguments, so there is one instantiation of the marker for every
+// instantiation of the call operator
+#define BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(name) \
+template<class... Ts> \
+struct name \
+{ \
+    typedef void type; \
+};
+
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(combine)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(compose)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(first_of)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(flip)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(flow)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(fold)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(infix)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(lazy)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(mutable_)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(partial)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(pipable)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(proj)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(reverse_fold)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(rotate)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(tree_fold)
+BOOST_HOF_DETAIL_DECLARE_CALL_MARKER(unpack)
+
+}}}} // namespace boost::hof
+
+// Added to the end of the template parameters of a call operator
+#define BOOST_HOF_DETAIL_CALL_MARKER(name, ...) \
+, class=typename boost::hof::markers::calls::name<__VA_ARGS__>::type
+#else
+#define BOOST_HOF_DETAIL_CALL_MARKER(name, ...)
+#endif
+
+#endif
@@ -28,7 +28,13 @@ template<int I, class T, class U>
 struct pair_tag
 {};
 
-#if BOOST_HOF_COMPRESSED_PAIR_USE_EBO_WORKAROUND
+#if BOOST_HOF_HAS_NO_UNIQUE_ADDRESS
+// Neither value is inherited, so the types can't be related bases
+template<int I, class T, class U>
+struct pair_holder
+: detail::alias_empty<T, pair_tag<I, T, U>>
+{};
+#elif BOOST_HOF_COMPRESSED_PAIR_USE_EBO_WORKAROUND
 
 template<class T, class U>
 struct is_same_template
@@ -66,22 +72,21 @@ struct pair_holder
 : std::conditional<(
     is_related<T, U>::value), 
     detail::alias_empty<T, pair_tag<I, T, U>>,
-    detail::alias_try_inherit<T, pair_tag<I, T, U>>
+    detail::alias_try_static<T, pair_tag<I, T, U>>
 >::type
 {};
 #else
 template<int I, class T, class U>
 struct pair_holder
-: detail::alias_try_inherit<T, pair_tag<I, T, U>>
+: detail::alias_try_static<T, pair_tag<I, T, U>>
 {};
 #endif
 
-// TODO: Empty optimizations for MSVC
 template<
     class First, 
     class Second
 >
-struct compressed_pair<First, Second>
+struct BOOST_HOF_EMPTY_BASES compressed_pair<First, Second>
 : pair_holder<0, First, Second>::type, pair_holder<1, Second, First>::type
 {
     typedef typename pair_holder<0, First, Second>::type first_base;
@@ -90,35 +95,29 @@ struct compressed_pair<First, Second>
         BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(First, X&&), 
         BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(Second, Y&&)
     >
-    constexpr compressed_pair(X&& x, Y&& y) 
+    BOOST_HOF_HOST_DEVICE constexpr compressed_pair(X&& x, Y&& y) 
     noexcept(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(first_base, X&&) && BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(second_base, Y&&))
     : first_base(BOOST_HOF_FORWARD(X)(x)), second_base(BOOST_HOF_FORWARD(Y)(y))
     {}
 
     BOOST_HOF_INHERIT_DEFAULT(compressed_pair, first_base, second_base)
 
-    template<class Base, class... Xs>
-    constexpr const Base& get_alias_base(Xs&&... xs) const noexcept
-    {
-        return boost::hof::always_ref(*this)(xs...);
-    }
-
     template<class... Xs>
-    constexpr const First& first(Xs&&... xs) const noexcept
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr const First& first(Xs&&... xs) const noexcept
     {
-        return boost::hof::alias_value(this->get_alias_base<first_base>(xs...), xs...);
+        return boost::hof::alias_value(static_cast<const first_base&>(BOOST_HOF_DETAIL_THIS_REF(xs)), xs...);
     }
 
     template<class... Xs>
-    constexpr const Second& second(Xs&&... xs) const noexcept
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr const Second& second(Xs&&... xs) const noexcept
     {
-        return boost::hof::alias_value(this->get_alias_base<second_base>(xs...), xs...);
+        return boost::hof::alias_value(static_cast<const second_base&>(BOOST_HOF_DETAIL_THIS_REF(xs)), xs...);
     }
 
 };
 
 template<class T, class U>
-constexpr compressed_pair<T, U> make_compressed_pair(T x, U y)
+BOOST_HOF_HOST_DEVICE constexpr compressed_pair<T, U> make_compressed_pair(T x, U y)
 noexcept(BOOST_HOF_IS_NOTHROW_MOVE_CONSTRUCTIBLE(T) && BOOST_HOF_IS_NOTHROW_MOVE_CONSTRUCTIBLE(U))
 {
     return {static_cast<T&&>(x), static_cast<U&&>(y)};
@@ -37,14 +37,14 @@
 #define BOOST_HOF_INHERIT_DEFAULT(C, ...) \
     template<bool FitPrivateEnableBool_##__LINE__=true, \
     class=typename std::enable_if<FitPrivateEnableBool_##__LINE__ && boost::hof::detail::is_default_constructible_c<__VA_ARGS__>()>::type> \
-    constexpr C() BOOST_HOF_NOEXCEPT(boost::hof::detail::is_nothrow_default_constructible_c<__VA_ARGS__>()) {}
+    BOOST_HOF_HOST_DEVICE constexpr C() BOOST_HOF_NOEXCEPT(boost::hof::detail::is_nothrow_default_constructible_c<__VA_ARGS__>()) {}
 
 #define BOOST_HOF_INHERIT_DEFAULT_EMPTY(C, ...) \
     template<bool FitPrivateEnableBool_##__LINE__=true, \
     class=typename std::enable_if<FitPrivateEnableBool_##__LINE__ && \
         boost::hof::detail::is_default_constructible_c<__VA_ARGS__>() && BOOST_HOF_IS_EMPTY(__VA_ARGS__) \
     >::type> \
-    constexpr C() BOOST_HOF_NOEXCEPT(boost::hof::detail::is_nothrow_default_constructible_c<__VA_ARGS__>()) {}
+    BOOST_HOF_HOST_DEVICE constexpr C() BOOST_HOF_NOEXCEPT(boost::hof::detail::is_nothrow_default_constructible_c<__VA_ARGS__>()) {}
 
 #if BOOST_HOF_NO_TYPE_PACK_EXPANSION_IN_TEMPLATE
 
@@ -63,7 +63,7 @@
 
 #endif
 
-#define BOOST_HOF_DELEGATE_CONSTRUCTOR(C, T, var) BOOST_HOF_DELGATE_PRIMITIVE_CONSTRUCTOR(constexpr, C, T, var)
+#define BOOST_HOF_DELEGATE_CONSTRUCTOR(C, T, var) BOOST_HOF_DELGATE_PRIMITIVE_CONSTRUCTOR(BOOST_HOF_HOST_DEVICE constexpr, C, T, var)
 
 // Currently its faster to use `BOOST_HOF_DELEGATE_CONSTRUCTOR` than `using
 // Base::Base;`
@@ -75,7 +75,7 @@
     using fit_inherit_base::fit_inherit_base; \
     Derived()=default; \
     template<class FitX, BOOST_HOF_ENABLE_IF_CONVERTIBLE(FitX, Base)> \
-    constexpr Derived(FitX&& fit_x) : Base(BOOST_HOF_FORWARD(FitX)(fit_x)) {}
+    BOOST_HOF_HOST_DEVICE constexpr Derived(FitX&& fit_x) : Base(BOOST_HOF_FORWARD(FitX)(fit_x)) {}
 #endif
 
 namespace boost { namespace hof {
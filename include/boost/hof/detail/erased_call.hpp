@@ -0,0 +1,57 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    erased_call.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_ERASED_CALL_H
+#define BOOST_HOF_GUARD_DETAIL_ERASED_CALL_H
+
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/holder.hpp>
+#include <boost/hof/detail/intrinsics.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof { namespace detail {
+
+template<class F, class Sig, class=void>
+struct is_erased_callable
+: std::false_type
+{};
+
+template<class F, class R, class... Args>
+struct is_erased_callable<F, R(Args...), typename holder<
+    decltype(std::declval<F>()(std::declval<Args>()...))
+>::type>
+: std::integral_constant<bool, (
+    std::is_void<R>::value ||
+    BOOST_HOF_IS_CONVERTIBLE(decltype(std::declval<F>()(std::declval<Args>()...)), R)
+)>
+{};
+
+// The result is discarded when the signature returns void
+template<class R>
+struct erased_invoke
+{
+    template<class F, class... Ts>
+    static R call(F&& f, Ts&&... xs)
+    {
+        return BOOST_HOF_FORWARD(F)(f)(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+template<>
+struct erased_invoke<void>
+{
+    template<class F, class... Ts>
+    static void call(F&& f, Ts&&... xs)
+    {
+        BOOST_HOF_FORWARD(F)(f)(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+}}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,63 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    flatten.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_FLATTEN_H
+#define BOOST_HOF_GUARD_DETAIL_FLATTEN_H
+
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/join.hpp>
+
+namespace boost { namespace hof { namespace detail {
+
+// The adaptors that are flattened store their functions as a list, where
+// `Adaptor<F, Fs...>` holds `F` and `Adaptor<Fs...>`. So when the last
+// function is the same adaptor, it is already the tail of the list, and its
+// functions are spliced into the result without rebuilding it. A nested
+// adaptor anywhere else is kept as one function, since splicing it would
+// rebuild the whole list every time an adaptor is extended.
+template<template<class...> class Adaptor, class Args, class... Fs>
+struct flatten_result;
+
+template<template<class...> class Adaptor, class... Ts, class F, class F2, class... Fs>
+struct flatten_result<Adaptor, join_args<Ts...>, F, F2, Fs...>
+: flatten_result<Adaptor, join_args<Ts..., F>, F2, Fs...>
+{};
+
+template<template<class...> class Adaptor, class... Ts, class F>
+struct flatten_result<Adaptor, join_args<Ts...>, F>
+{
+    typedef BOOST_HOF_DETAIL_MAKE_RESULT(Adaptor, Ts..., F) type;
+};
+
+// Without the template alias, the tail of compose is an adaptor of the
+// callable bases, which is a different type, so it isn't spliced
+#if BOOST_HOF_CALLABLE_BASE_USE_TEMPLATE_ALIAS
+template<template<class...> class Adaptor, class... Ts, class... Gs>
+struct flatten_result<Adaptor, join_args<Ts...>, Adaptor<Gs...>>
+{
+    typedef BOOST_HOF_DETAIL_MAKE_RESULT(Adaptor, Ts..., Gs...) type;
+};
+#endif
+
+// Like make, except an adaptor that is the last function is spliced into
+// the result, which is then constructed from its tail
+template<template<class...> class Adaptor>
+struct make_flatten
+{
+    BOOST_HOF_HOST_DEVICE constexpr make_flatten() noexcept
+    {}
+    template<class... Fs, class Result=typename flatten_result<Adaptor, join_args<>, Fs...>::type>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr Result operator()(Fs... fs) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Result, Fs&&...)
+    {
+        return Result(static_cast<Fs&&>(fs)...);
+    }
+};
+
+}}} // namespace boost::hof
+
+#endif
@@ -8,6 +8,7 @@
 #ifndef BOOST_HOF_GUARD_FORWARD_H
 #define BOOST_HOF_GUARD_FORWARD_H
 
+#include <boost/hof/config.hpp>
 #include <utility>
 
 namespace boost { namespace hof {
@@ -15,12 +16,12 @@ namespace boost { namespace hof {
 // contexpr-friendly forwarding
 
 template<typename T>
-constexpr T&& forward(typename std::remove_reference<T>::type& t) noexcept
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INTRINSIC constexpr T&& forward(typename std::remove_reference<T>::type& t) noexcept
 { return static_cast<T&&>(t); }
 
 
 template<typename T>
-constexpr T&& forward(typename std::remove_reference<T>::type&& t) noexcept
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INTRINSIC constexpr T&& forward(typename std::remove_reference<T>::type&& t) noexcept
 {
   static_assert(!std::is_lvalue_reference<T>::value, "T must not be an lvalue reference type");
   return static_cast<T&&>(t);
@@ -0,0 +1,35 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    index_count.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_INDEX_COUNT_H
+#define BOOST_HOF_GUARD_DETAIL_INDEX_COUNT_H
+
+#include <cstddef>
+#include <type_traits>
+
+namespace boost { namespace hof { namespace detail {
+
+constexpr std::size_t index_sum()
+{
+    return 0;
+}
+
+template<class... Ts>
+constexpr std::size_t index_sum(std::size_t x, Ts... xs)
+{
+    return x + index_sum(xs...);
+}
+
+// How many times the index I appears in the indices
+template<std::size_t I, std::size_t... Is>
+struct index_count
+: std::integral_constant<std::size_t, index_sum((I == Is ? 1 : 0)...)>
+{};
+
+}}} // namespace boost::hof
+
+#endif
@@ -76,6 +76,18 @@
 #define BOOST_HOF_IS_DEFAULT_CONSTRUCTIBLE BOOST_HOF_IS_CONSTRUCTIBLE
 #endif
 
+#if BOOST_HOF_HAS_TRIVIAL_RELOCATION
+#if __has_builtin(__builtin_is_cpp_trivially_relocatable)
+#define BOOST_HOF_IS_TRIVIALLY_RELOCATABLE(...) __builtin_is_cpp_trivially_relocatable(__VA_ARGS__)
+#else
+#define BOOST_HOF_IS_TRIVIALLY_RELOCATABLE(...) __is_trivially_relocatable(__VA_ARGS__)
+#endif
+#elif defined(__GNUC__) && !defined (__clang__) && __GNUC__ < 5
+#define BOOST_HOF_IS_TRIVIALLY_RELOCATABLE(...) (__has_trivial_copy(__VA_ARGS__) && __has_trivial_destructor(__VA_ARGS__))
+#else
+#define BOOST_HOF_IS_TRIVIALLY_RELOCATABLE(...) std::is_trivially_copyable<__VA_ARGS__>::value
+#endif
+
 #define BOOST_HOF_IS_NOTHROW_MOVE_CONSTRUCTIBLE(...) BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(__VA_ARGS__, __VA_ARGS__ &&)
 
 namespace boost { namespace hof { namespace detail {
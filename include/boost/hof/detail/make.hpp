@@ -9,7 +9,7 @@
 #define BOOST_HOF_GUARD_MAKE_H
 
 #include <boost/hof/detail/move.hpp>
-#include <boost/hof/detail/join.hpp>
+#include <boost/hof/detail/compile_marker.hpp>
 #include <boost/hof/detail/delegate.hpp>
 
 namespace boost { namespace hof { namespace detail {
@@ -17,10 +17,10 @@ namespace boost { namespace hof { namespace detail {
 template<template<class...> class Adaptor>
 struct make
 {
-    constexpr make() noexcept
+    BOOST_HOF_HOST_DEVICE constexpr make() noexcept
     {}
-    template<class... Fs, class Result=BOOST_HOF_JOIN(Adaptor, Fs...)>
-    constexpr Result operator()(Fs... fs) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Result, Fs&&...)
+    template<class... Fs, class Result=BOOST_HOF_DETAIL_MAKE_RESULT(Adaptor, Fs...)>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr Result operator()(Fs... fs) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Result, Fs&&...)
     {
         return Result(static_cast<Fs&&>(fs)...);
     }
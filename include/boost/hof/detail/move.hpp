@@ -8,12 +8,13 @@
 #ifndef BOOST_HOF_GUARD_MOVE_H
 #define BOOST_HOF_GUARD_MOVE_H
 
+#include <boost/hof/config.hpp>
 #include <utility>
 
 namespace boost { namespace hof {
 
 template<typename T>
-constexpr typename std::remove_reference<T>::type&&
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INTRINSIC constexpr typename std::remove_reference<T>::type&&
 move(T&& x) noexcept
 { 
     return static_cast<typename std::remove_reference<T>::type&&>(x); 
@@ -0,0 +1,115 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    parallel_eval.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_PARALLEL_EVAL_H
+#define BOOST_HOF_GUARD_DETAIL_PARALLEL_EVAL_H
+
+#include <boost/hof/executor.hpp>
+#include <boost/hof/detail/remove_rvalue_reference.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+
+namespace boost { namespace hof { namespace detail {
+
+template<class G, class T>
+struct parallel_task_result
+: remove_rvalue_reference<decltype(std::declval<const G&>()(std::declval<T>()))>
+{};
+
+// The task only refers to the function and the argument, which outlive the
+// task since all tasks are joined before the call returns.
+template<class G, class T>
+struct parallel_task
+{
+    typedef typename parallel_task_result<G, T>::type result_type;
+    const G* g;
+    typename std::remove_reference<T>::type* x;
+
+    BOOST_HOF_INLINE result_type operator()() const
+    {
+        return (*g)(BOOST_HOF_FORWARD(T)(*x));
+    }
+};
+
+template<class G, class T>
+parallel_task<G, T> make_parallel_task(const G& g, T&& x)
+{
+    return parallel_task<G, T>{&g, &x};
+}
+
+template<class R, class F, class... Hs>
+R parallel_join(const F& f, Hs... hs)
+{
+    return f(hs.get()...);
+}
+
+template<class... Hs>
+void parallel_join_void(Hs... hs)
+{
+    (void)std::initializer_list<int>{((void)hs.get(), 0)...};
+}
+
+// The first task runs on the calling thread while the others are running on
+// the executor, where each node of the executor runs a block of the tasks
+template<class R, class Executor, class F, class T, class... Ts, std::size_t... Ns>
+R parallel_submit_on(seq<Ns...>, const Executor& e, std::size_t nodes, const F& f, T t, Ts... ts)
+{
+    return parallel_join<R>(f, inline_executor().submit(t),
+        detail::submit_on(e, detail::executor_node(Ns + 1, sizeof...(Ts) + 1, nodes), ts)...);
+}
+
+template<class R, class Executor, class F, class T, class... Ts>
+R parallel_submit(std::true_type, const Executor& e, const F& f, T t, Ts... ts)
+{
+    return parallel_submit_on<R>(typename gens<sizeof...(Ts)>::type(), e, detail::executor_nodes(e), f, t, ts...);
+}
+
+template<class R, class Executor, class F, class... Ts>
+R parallel_submit(std::false_type, const Executor&, const F& f, Ts... ts)
+{
+    return f(ts()...);
+}
+
+template<class R, class Executor, class F, class... Ts>
+R parallel_eval(const parallel_policy<Executor>& p, const F& f, Ts... ts)
+{
+    return sizeof...(Ts) < p.threshold ?
+        f(ts()...) :
+        parallel_submit<R>(std::integral_constant<bool, (sizeof...(Ts) > 1)>(), p.executor, f, ts...);
+}
+
+template<class Executor, class T, class... Ts, std::size_t... Ns>
+void parallel_eval_void_on(seq<Ns...>, const Executor& e, std::size_t nodes, T t, Ts... ts)
+{
+    parallel_join_void(inline_executor().submit(t),
+        detail::submit_on(e, detail::executor_node(Ns + 1, sizeof...(Ts) + 1, nodes), ts)...);
+}
+
+template<class Executor, class T, class... Ts>
+void parallel_eval_void(std::true_type, const Executor& e, T t, Ts... ts)
+{
+    parallel_eval_void_on(typename gens<sizeof...(Ts)>::type(), e, detail::executor_nodes(e), t, ts...);
+}
+
+template<class Executor, class... Ts>
+void parallel_eval_void(std::false_type, const Executor&, Ts... ts)
+{
+    (void)std::initializer_list<int>{((void)ts(), 0)...};
+}
+
+template<class Executor, class... Ts>
+void parallel_eval_void(const parallel_policy<Executor>& p, Ts... ts)
+{
+    if (sizeof...(Ts) < p.threshold) parallel_eval_void(std::false_type(), p.executor, ts...);
+    else parallel_eval_void(std::integral_constant<bool, (sizeof...(Ts) > 1)>(), p.executor, ts...);
+}
+
+}}} // namespace boost::hof
+
+#endif
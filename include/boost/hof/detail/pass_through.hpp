@@ -0,0 +1,63 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    pass_through.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_PASS_THROUGH_H
+#define BOOST_HOF_GUARD_DETAIL_PASS_THROUGH_H
+
+#include <boost/hof/identity.hpp>
+#include <boost/hof/returns.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <type_traits>
+
+namespace boost { namespace hof { namespace detail {
+
+// A function that returns a reference to its argument, so when it is the
+// last function to be applied, the reference would refer to the result of
+// the previous function, which is a temporary of the composition
+template<class F>
+struct is_pass_through
+: std::integral_constant<bool, (
+    std::is_same<F, identity_detail::identity_ref_base>::value ||
+    std::is_same<F, callable_base<identity_detail::identity_ref_base>>::value
+)>
+{};
+
+// Only the other function is called, so its result is returned as it is
+template<class F1, class F2, bool CallFirst>
+struct pass_through_kernel : detail::compressed_pair<F1, F2>
+{
+    typedef detail::compressed_pair<F1, F2> base_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(pass_through_kernel, base_type)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const F1& pass_through_function(std::true_type, Ts&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const F2& pass_through_function(std::false_type, Ts&&... xs) const noexcept
+    {
+        return this->second(xs...);
+    }
+
+    BOOST_HOF_RETURNS_CLASS(pass_through_kernel);
+
+    template<class... Ts>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        BOOST_HOF_CONST_THIS->pass_through_function(std::integral_constant<bool, CallFirst>(), xs...)(BOOST_HOF_FORWARD(Ts)(xs)...)
+    );
+};
+
+}}} // namespace boost::hof
+
+#endif
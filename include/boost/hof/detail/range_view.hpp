@@ -0,0 +1,80 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    range_view.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_RANGE_VIEW_H
+#define BOOST_HOF_GUARD_DETAIL_RANGE_VIEW_H
+
+#include <boost/hof/config.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/intrinsics.hpp>
+#include <type_traits>
+
+namespace boost { namespace hof { namespace detail {
+
+// A view pushes each of its elements into a sink with for_each, so a chain
+// of views is evaluated as one loop over the source range, with the sinks
+// of each stage inlined into the body of the loop
+struct range_view_base
+{};
+
+template<class Range>
+struct is_range_view
+: std::integral_constant<bool, BOOST_HOF_IS_BASE_OF(range_view_base, typename std::decay<Range>::type)>
+{};
+
+template<class Range, class Sink, typename std::enable_if<(!is_range_view<Range>::value), int>::type = 0>
+BOOST_HOF_INLINE inline void range_for_each(Range&& r, Sink&& sink)
+{
+    for(auto&& x:r) sink(BOOST_HOF_FORWARD(decltype(x))(x));
+}
+
+template<class Range, class Sink, typename std::enable_if<(is_range_view<Range>::value), int>::type = 0>
+BOOST_HOF_INLINE inline void range_for_each(Range&& r, Sink&& sink)
+{
+    r.for_each(sink);
+}
+
+// An lvalue range is referred to, but an rvalue range is moved into the
+// view so the view can be returned from a pipeline
+template<class Range>
+struct range_source : range_view_base
+{
+    Range range;
+
+    template<class X>
+    constexpr explicit range_source(X&& x)
+    : range(BOOST_HOF_FORWARD(X)(x))
+    {}
+
+    template<class Sink>
+    BOOST_HOF_INLINE void for_each(Sink&& sink) const
+    {
+        detail::range_for_each(range, sink);
+    }
+};
+
+template<class Range, class=void>
+struct range_view_of
+{
+    typedef range_source<Range> type;
+};
+
+template<class Range>
+struct range_view_of<Range, typename std::enable_if<is_range_view<Range>::value>::type>
+{
+    typedef typename std::decay<Range>::type type;
+};
+
+template<class Range>
+constexpr typename range_view_of<Range>::type as_range_view(Range&& r)
+{
+    return typename range_view_of<Range>::type(BOOST_HOF_FORWARD(Range)(r));
+}
+
+}}} // namespace boost::hof
+
+#endif
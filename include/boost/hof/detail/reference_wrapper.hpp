@@ -0,0 +1,21 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    reference_wrapper.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_REFERENCE_WRAPPER_H
+#define BOOST_HOF_GUARD_DETAIL_REFERENCE_WRAPPER_H
+
+#include <boost/hof/config.hpp>
+
+// Only std::reference_wrapper is needed, which is in a much smaller header
+// than <functional> on libstdc++
+#if BOOST_HOF_HAS_STD_REFWRAP_HEADER
+#include <bits/refwrap.h>
+#else
+#include <functional>
+#endif
+
+#endif
@@ -51,7 +51,20 @@ struct result_of
 }} // namespace boost::hof
 #endif
 
-#if BOOST_HOF_NO_EXPRESSION_SFINAE
+#if BOOST_HOF_HAS_REQUIRES_SFINAE
+
+// The result is only deduced once, when the expression is returned, so it
+// isn't computed again for each nested adaptor
+#define BOOST_HOF_SFINAE_RESULT(...) auto
+#if BOOST_HOF_HAS_COMPLETE_DECLTYPE && BOOST_HOF_HAS_MANGLE_OVERLOAD
+#define BOOST_HOF_SFINAE_RETURNS(...) BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(__VA_ARGS__) \
+-> decltype(auto) requires requires { __VA_ARGS__; } { return (__VA_ARGS__); }
+#else
+#define BOOST_HOF_SFINAE_RETURNS(...) BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(__VA_ARGS__) \
+-> decltype(auto) requires requires { BOOST_HOF_RETURNS_DECLTYPE_CONTEXT(__VA_ARGS__); } { BOOST_HOF_RETURNS_RETURN(__VA_ARGS__); }
+#endif
+
+#elif BOOST_HOF_NO_EXPRESSION_SFINAE
 
 #define BOOST_HOF_SFINAE_RESULT(...) typename boost::hof::result_of<__VA_ARGS__>::type
 #define BOOST_HOF_SFINAE_RETURNS(...) BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(__VA_ARGS__) { return __VA_ARGS__; }
@@ -9,6 +9,10 @@
 #define BOOST_HOF_GUARD_FUNCTION_DETAIL_SEQ_H
 
 #include <cstdlib>
+#include <boost/hof/config.hpp>
+#if !BOOST_HOF_HAS_MAKE_INTEGER_SEQ && !BOOST_HOF_HAS_INTEGER_PACK && BOOST_HOF_HAS_STD_INDEX_SEQUENCE
+#include <utility>
+#endif
 
 namespace boost { namespace hof { 
 
@@ -20,6 +24,42 @@ struct seq
     typedef seq type;
 };
 
+#if BOOST_HOF_HAS_MAKE_INTEGER_SEQ
+
+template<class T, T... Ns>
+struct seq_from_integer
+: seq<Ns...>
+{};
+
+template<std::size_t N>
+struct gens
+: __make_integer_seq<seq_from_integer, std::size_t, N>
+{};
+
+#elif BOOST_HOF_HAS_INTEGER_PACK
+
+template<std::size_t N>
+struct gens
+: seq<__integer_pack(N)...>
+{};
+
+#elif BOOST_HOF_HAS_STD_INDEX_SEQUENCE
+
+template<class Sequence>
+struct seq_from_index_sequence;
+
+template<std::size_t... Ns>
+struct seq_from_index_sequence<std::index_sequence<Ns...>>
+: seq<Ns...>
+{};
+
+template<std::size_t N>
+struct gens
+: seq_from_index_sequence<std::make_index_sequence<N>>
+{};
+
+#else
+
 template <class, class>
 struct merge_seq;
 
@@ -39,6 +79,8 @@ struct gens
 template<> struct gens<0> : seq<> {}; 
 template<> struct gens<1> : seq<0> {}; 
 
+#endif
+
 
 }
 }} // namespace boost::hof
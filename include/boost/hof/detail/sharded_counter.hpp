@@ -0,0 +1,97 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    sharded_counter.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_SHARDED_COUNTER_H
+#define BOOST_HOF_GUARD_DETAIL_SHARDED_COUNTER_H
+
+#include <boost/hof/config.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace hof { namespace detail {
+
+// Each thread is given the next shard the first time it counts, so the
+// threads that count at the same time mostly write to different shards
+inline std::size_t this_thread_counter_shard() noexcept
+{
+    static std::atomic<std::size_t> next(0);
+    static thread_local std::size_t shard = next.fetch_add(1, std::memory_order_relaxed) % BOOST_HOF_COUNTER_SHARDS;
+    return shard;
+}
+
+// N counters, with a copy of them in each shard. The shards are on separate
+// cache lines, so a thread only adds to the cache line of its shard, and the
+// shards are summed when a count is read.
+template<std::size_t N>
+struct sharded_counter
+{
+    static constexpr std::size_t shards = BOOST_HOF_COUNTER_SHARDS;
+
+    struct alignas(64) shard
+    {
+        std::atomic<std::uint64_t> counts[N == 0 ? 1 : N];
+    };
+
+    shard data[shards];
+
+    constexpr sharded_counter() noexcept : data()
+    {}
+
+    // A copy starts with the counts it was copied from
+    sharded_counter(const sharded_counter& rhs) noexcept : data()
+    {
+        this->assign(rhs);
+    }
+
+    sharded_counter& operator=(const sharded_counter& rhs) noexcept
+    {
+        this->assign(rhs);
+        return *this;
+    }
+
+    // Returns the count of the shard of the thread after it is added to
+    std::uint64_t add(std::size_t i, std::uint64_t n=1) noexcept
+    {
+        return data[detail::this_thread_counter_shard()].counts[i].fetch_add(n, std::memory_order_relaxed) + n;
+    }
+
+    std::uint64_t load(std::size_t i) const noexcept
+    {
+        std::uint64_t r = 0;
+        for (const auto& s : data) r += s.counts[i].load(std::memory_order_relaxed);
+        return r;
+    }
+
+    void reset() noexcept
+    {
+        for (auto& s : data)
+            for (auto& c : s.counts) c.store(0, std::memory_order_relaxed);
+    }
+
+    // Halves each shard, so the sum is halved, rounded down in each shard
+    void halve() noexcept
+    {
+        for (auto& s : data)
+            for (auto& c : s.counts) c.store(c.load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+    }
+
+    void assign(const sharded_counter& rhs) noexcept
+    {
+        if (this == &rhs) return;
+        for (std::size_t i = 0; i < N; i++)
+        {
+            std::uint64_t x = rhs.load(i);
+            for (std::size_t k = 1; k < shards; k++) data[k].counts[i].store(0, std::memory_order_relaxed);
+            data[0].counts[i].store(x, std::memory_order_relaxed);
+        }
+    }
+};
+
+}}} // namespace boost::hof
+
+#endif
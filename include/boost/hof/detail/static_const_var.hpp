@@ -8,10 +8,24 @@
 #ifndef BOOST_HOF_GUARD_STATIC_CONST_H
 #define BOOST_HOF_GUARD_STATIC_CONST_H
 
+#include <boost/hof/config.hpp>
 #include <boost/hof/detail/intrinsics.hpp>
 
 namespace boost { namespace hof { namespace detail {
 
+// Whether T can be default constructed in a constant expression, so it can
+// be stored in static_const_storage without a dynamic initializer
+template<class T, class=std::integral_constant<bool, ((void)T(), true)>>
+std::true_type is_constant_default_constructible_check(int);
+
+template<class T>
+std::false_type is_constant_default_constructible_check(...);
+
+template<class T>
+struct is_constant_default_constructible
+: decltype(is_constant_default_constructible_check<T>(0))
+{};
+
 template<class T>
 struct static_const_storage
 {
@@ -23,7 +37,7 @@ constexpr T static_const_storage<T>::value;
 
 struct static_const_var_factory
 {
-    constexpr static_const_var_factory()
+    BOOST_HOF_HOST_DEVICE constexpr static_const_var_factory()
     {}
 
     template<class T>
@@ -36,7 +50,7 @@ struct static_const_var_factory
 }
 
 template<class T>
-constexpr const T& static_const_var()
+BOOST_HOF_HOST_DEVICE constexpr const T& static_const_var()
 {
     return detail::static_const_storage<T>::value;
 }
@@ -59,10 +73,18 @@ constexpr const T& static_const_var()
 // On gcc 4.6 use weak variables
 #if defined(__GNUC__) && !defined (__clang__) && __GNUC__ == 4 && __GNUC_MINOR__ < 7
 #define BOOST_HOF_STATIC_CONST_VAR(name) extern __attribute__((weak)) constexpr auto name
+#elif BOOST_HOF_HAS_INLINE_VARIABLES
+#define BOOST_HOF_STATIC_CONST_VAR(name) inline constexpr auto& name = boost::hof::detail::static_const_var_factory()
 #else
 #define BOOST_HOF_STATIC_CONST_VAR(name) static constexpr auto& name = boost::hof::detail::static_const_var_factory()
 #endif
 
+// Device code can't refer to a variable of the host, so the device side of
+// a CUDA or HIP compilation declares a constant of its own for each function
+#if BOOST_HOF_DEVICE_COMPILE
+#define BOOST_HOF_DECLARE_STATIC_VAR(name, ...) static const __device__ __VA_ARGS__ name = {}
+#else
 #define BOOST_HOF_DECLARE_STATIC_VAR(name, ...) BOOST_HOF_STATIC_CONST_VAR(name) = __VA_ARGS__{}
+#endif
 
 #endif
@@ -0,0 +1,65 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    thread_block.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_THREAD_BLOCK_H
+#define BOOST_HOF_GUARD_DETAIL_THREAD_BLOCK_H
+
+#include <atomic>
+
+namespace boost { namespace hof { namespace detail {
+
+// Each thread owns a Block, which only it writes to, while the other
+// threads read the blocks through the list. The blocks are never freed, and
+// a block is reused by a new thread once its thread has exited, so what an
+// exited thread recorded is kept. The Block must have an atomic `in_use`
+// flag, which is true once it is constructed, and a `next` pointer.
+template<class Block>
+struct thread_block
+{
+    static std::atomic<Block*>& head() noexcept
+    {
+        static std::atomic<Block*> h(nullptr);
+        return h;
+    }
+
+    static Block* acquire()
+    {
+        for (Block* b = head().load(std::memory_order_acquire); b != nullptr; b = b->next)
+        {
+            bool expected = false;
+            if (b->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) return b;
+        }
+        Block* b = new Block();
+        b->next = head().load(std::memory_order_relaxed);
+        while (!head().compare_exchange_weak(b->next, b, std::memory_order_release, std::memory_order_relaxed))
+        {}
+        return b;
+    }
+
+    struct owner
+    {
+        Block * block;
+
+        owner() : block(acquire())
+        {}
+
+        ~owner()
+        {
+            block->in_use.store(false, std::memory_order_release);
+        }
+    };
+
+    static Block& this_thread()
+    {
+        static thread_local owner o;
+        return *o.block;
+    }
+};
+
+}}} // namespace boost::hof
+
+#endif
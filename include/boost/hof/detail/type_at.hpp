@@ -0,0 +1,44 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    type_at.hpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_TYPE_AT_HPP
+#define BOOST_HOF_GUARD_DETAIL_TYPE_AT_HPP
+
+#include <utility>
+#include <boost/hof/detail/seq.hpp>
+
+namespace boost { namespace hof { namespace detail {
+
+template<std::size_t I, class T>
+struct indexed_type
+{
+    typedef T type;
+};
+
+template<class Seq, class... Ts>
+struct indexed_types;
+
+template<std::size_t... Ns, class... Ts>
+struct indexed_types<seq<Ns...>, Ts...>
+: indexed_type<Ns, Ts>...
+{};
+
+template<std::size_t I, class T>
+indexed_type<I, T> select_indexed_type(const indexed_type<I, T>&);
+
+// Selects the type by overload resolution against the indexed bases, so
+// looking up any index is a constant number of instantiations.
+template<std::size_t I, class... Ts>
+struct type_at
+: decltype(boost::hof::detail::select_indexed_type<I>(
+    std::declval<indexed_types<typename gens<sizeof...(Ts)>::type, Ts...>>()
+))
+{};
+
+}}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,87 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    uniform_chain.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DETAIL_UNIFORM_CHAIN_H
+#define BOOST_HOF_GUARD_DETAIL_UNIFORM_CHAIN_H
+
+#include <boost/hof/config.hpp>
+#include <boost/hof/detail/and.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/holder.hpp>
+#include <type_traits>
+#include <utility>
+
+// Without the template alias, the tail of a chain is a callable base of the
+// adaptor, so it isn't recognized as a chain
+#if BOOST_HOF_ITERATE_UNIFORM_CHAINS && BOOST_HOF_CALLABLE_BASE_USE_TEMPLATE_ALIAS
+#define BOOST_HOF_DETAIL_ITERATE_UNIFORM_CHAINS 1
+#else
+#define BOOST_HOF_DETAIL_ITERATE_UNIFORM_CHAINS 0
+#endif
+
+namespace boost { namespace hof { namespace detail {
+
+// The result of calling the function, or void when it can't be called
+template<class F, class Args, class=void>
+struct chain_call_result
+{
+    typedef void type;
+};
+
+template<class F, class... Ts>
+struct chain_call_result<F, holder<Ts...>, typename holder<
+    decltype(std::declval<const F&>()(std::declval<Ts>()...))
+>::type>
+{
+    typedef decltype(std::declval<const F&>()(std::declval<Ts>()...)) type;
+};
+
+// The value that is passed through the chain is held in one variable, so
+// it can't be a reference
+template<class R>
+struct is_chain_value
+: std::integral_constant<bool, (
+    std::is_object<R>::value &&
+    std::is_same<R, typename std::remove_cv<R>::type>::value &&
+    std::is_move_constructible<R>::value &&
+    std::is_move_assignable<R>::value
+)>
+{};
+
+// Whether each function returns the same type it is passed
+template<class R, class... Fs>
+struct is_uniform_chain
+: std::true_type
+{};
+
+template<class R, class F, class... Fs>
+struct is_uniform_chain<R, F, Fs...>
+: std::conditional<
+    std::is_same<R, typename chain_call_result<callable_base<F>, holder<R>>::type>::value,
+    is_uniform_chain<R, Fs...>,
+    std::false_type
+>::type
+{};
+
+// The chain is only evaluated in place when the first result can be held,
+// and then each function returns that type
+template<class R, class... Fs>
+struct is_iterable_chain
+: std::conditional<is_chain_value<R>::value, is_uniform_chain<R, Fs...>, std::false_type>::type
+{};
+
+template<class R, class... Fs>
+struct is_nothrow_chain
+: std::integral_constant<bool, (
+    std::is_nothrow_move_assignable<R>::value &&
+    BOOST_HOF_AND_UNPACK(noexcept(std::declval<const callable_base<Fs>&>()(std::declval<R>())))
+)>
+{};
+
+}}} // namespace boost::hof
+
+#endif
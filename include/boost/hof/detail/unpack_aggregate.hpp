@@ -0,0 +1,280 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    unpack_aggregate.hpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_UNPACK_AGGREGATE_HPP
+#define BOOST_HOF_GUARD_UNPACK_AGGREGATE_HPP
+
+#include <boost/hof/config.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <cstddef>
+#include <type_traits>
+
+#ifndef BOOST_HOF_UNPACK_AGGREGATES
+#if BOOST_HOF_HAS_STD_17 && defined(__cpp_structured_bindings) && defined(__cpp_lib_is_aggregate)
+#define BOOST_HOF_UNPACK_AGGREGATES 1
+#else
+#define BOOST_HOF_UNPACK_AGGREGATES 0
+#endif
+#endif
+
+#ifndef BOOST_HOF_HAS_STRUCTURED_BINDING_PACKS
+#if defined(__cpp_structured_bindings) && __cpp_structured_bindings >= 202411L
+#define BOOST_HOF_HAS_STRUCTURED_BINDING_PACKS 1
+#else
+#define BOOST_HOF_HAS_STRUCTURED_BINDING_PACKS 0
+#endif
+#endif
+
+namespace boost { namespace hof { namespace detail {
+
+template<class Sequence, class=void>
+struct unpack_aggregate
+{
+    typedef void not_unpackable;
+};
+
+#if BOOST_HOF_UNPACK_AGGREGATES
+
+// Converts to any field, so the number of fields is the largest number of
+// these that the aggregate can be initialized with
+struct aggregate_any
+{
+    template<class T>
+    BOOST_HOF_HOST_DEVICE constexpr operator T() const noexcept;
+};
+
+template<class T, class Seq, class=void>
+struct is_aggregate_initializable
+: std::false_type
+{};
+
+template<class T, std::size_t... Ns>
+struct is_aggregate_initializable<T, seq<Ns...>, decltype(void(T{(void(Ns), aggregate_any())...}))>
+: std::true_type
+{};
+
+// Only converts to a base class of the aggregate, so the aggregate can be
+// initialized with it when its first initializer is a base class
+template<class T>
+struct aggregate_base_any
+{
+    template<class U, class=typename std::enable_if<(
+        std::is_base_of<U, T>::value && !std::is_same<U, T>::value
+    )>::type>
+    BOOST_HOF_HOST_DEVICE constexpr operator U() const noexcept;
+};
+
+template<class T, class=void>
+struct has_aggregate_base
+: std::false_type
+{};
+
+template<class T>
+struct has_aggregate_base<T, decltype(void(T{aggregate_base_any<T>()}))>
+: std::true_type
+{};
+
+template<class T, std::size_t N>
+struct aggregate_field_count
+: std::conditional<is_aggregate_initializable<T, typename gens<N>::type>::value,
+    std::integral_constant<std::size_t, N>,
+    aggregate_field_count<T, N-1>
+>::type
+{};
+
+template<class T>
+struct aggregate_field_count<T, 0>
+: std::integral_constant<std::size_t, 0>
+{};
+
+// The fields of an rvalue aggregate are forwarded as rvalues
+template<class Sequence, class Field>
+struct aggregate_field_ref
+: std::conditional<std::is_lvalue_reference<Sequence>::value,
+    typename std::remove_reference<Field>::type&,
+    Field&&
+>
+{};
+
+#define BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x) \
+    static_cast<typename boost::hof::detail::aggregate_field_ref<S&&, decltype(x)>::type>(x)
+
+#if BOOST_HOF_HAS_STRUCTURED_BINDING_PACKS
+
+template<class T>
+struct is_unpackable_aggregate
+: std::integral_constant<bool, (
+    std::is_aggregate<T>::value &&
+    !std::is_union<T>::value &&
+    is_aggregate_initializable<T, seq<0>>::value &&
+    !has_aggregate_base<T>::value
+)>
+{};
+
+struct unpack_aggregate_apply
+{
+    template<class F, class S>
+    BOOST_HOF_HOST_DEVICE constexpr static decltype(auto) apply(F&& f, S&& s)
+    {
+        auto&& [...xs] = BOOST_HOF_FORWARD(S)(s);
+        return f(BOOST_HOF_DETAIL_AGGREGATE_FORWARD(xs)...);
+    }
+};
+
+template<class T>
+struct unpack_aggregate<T, typename std::enable_if<(
+    std::conjunction<std::is_class<T>, is_unpackable_aggregate<T>>::value
+)>::type>
+: unpack_aggregate_apply
+{};
+
+#else
+
+#define BOOST_HOF_UNPACK_AGGREGATE_MAX_FIELDS 32
+
+// The initializers of an array field are counted as separate fields. A
+// braced initializer initializes a whole field, so when the field at the
+// position of the braced initializer is an array, the aggregate doesn't
+// take the initializers after it.
+template<class T, class Before, class After, class=void>
+struct is_aggregate_field_value_initializable
+: std::false_type
+{};
+
+template<class T, std::size_t... Is, std::size_t... Js>
+struct is_aggregate_field_value_initializable<T, seq<Is...>, seq<Js...>, 
+    decltype(void(T{(void(Is), aggregate_any())..., {}, (void(Js), aggregate_any())...}))
+>
+: std::true_type
+{};
+
+template<class T, class Before, class After, class=void>
+struct is_aggregate_field_list_initializable
+: std::false_type
+{};
+
+template<class T, std::size_t... Is, std::size_t... Js>
+struct is_aggregate_field_list_initializable<T, seq<Is...>, seq<Js...>, 
+    decltype(void(T{(void(Is), aggregate_any())..., {aggregate_any()}, (void(Js), aggregate_any())...}))
+>
+: std::true_type
+{};
+
+template<class T, std::size_t I, std::size_t N>
+struct is_aggregate_single_field
+: std::integral_constant<bool, (
+    is_aggregate_field_value_initializable<T, typename gens<I>::type, typename gens<N-I-1>::type>::value ||
+    is_aggregate_field_list_initializable<T, typename gens<I>::type, typename gens<N-I-1>::type>::value
+)>
+{};
+
+template<class T, class Seq>
+struct has_aggregate_array_field;
+
+template<class T, std::size_t... Is>
+struct has_aggregate_array_field<T, seq<Is...>>
+: std::integral_constant<bool, (
+    !std::conjunction<is_aggregate_single_field<T, Is, sizeof...(Is)>...>::value
+)>
+{};
+
+template<class T>
+struct is_counted_aggregate
+: std::integral_constant<bool, (
+    is_aggregate_initializable<T, seq<0>>::value &&
+    !is_aggregate_initializable<T, typename gens<BOOST_HOF_UNPACK_AGGREGATE_MAX_FIELDS + 1>::type>::value
+)>
+{};
+
+// The fields are counted only when the aggregate has no base classes, since
+// each base class is counted as a field
+template<class T, bool=(is_counted_aggregate<T>::value && !has_aggregate_base<T>::value)>
+struct is_unpackable_counted_aggregate
+: std::integral_constant<bool, (
+    !has_aggregate_array_field<T, typename gens<aggregate_field_count<T, BOOST_HOF_UNPACK_AGGREGATE_MAX_FIELDS>::value>::type>::value
+)>
+{};
+
+template<class T>
+struct is_unpackable_counted_aggregate<T, false>
+: std::false_type
+{};
+
+template<class T>
+struct is_unpackable_aggregate
+: std::conjunction<std::is_aggregate<T>, std::negation<std::is_union<T>>, is_unpackable_counted_aggregate<T>>
+{};
+
+template<std::size_t N>
+struct unpack_aggregate_apply;
+
+#define BOOST_HOF_DETAIL_UNPACK_AGGREGATE_EXPAND(...) __VA_ARGS__
+#define BOOST_HOF_DETAIL_UNPACK_AGGREGATE(n, names, fields) \
+template<> \
+struct unpack_aggregate_apply<n> \
+{ \
+    template<class F, class S> \
+    BOOST_HOF_HOST_DEVICE constexpr static decltype(auto) apply(F&& f, S&& s) \
+    { \
+        auto&& [BOOST_HOF_DETAIL_UNPACK_AGGREGATE_EXPAND names] = BOOST_HOF_FORWARD(S)(s); \
+        return f(BOOST_HOF_DETAIL_UNPACK_AGGREGATE_EXPAND fields); \
+    } \
+};
+
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(1, (x0), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(2, (x0, x1), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(3, (x0, x1, x2), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(4, (x0, x1, x2, x3), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(5, (x0, x1, x2, x3, x4), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(6, (x0, x1, x2, x3, x4, x5), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(7, (x0, x1, x2, x3, x4, x5, x6), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(8, (x0, x1, x2, x3, x4, x5, x6, x7), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(9, (x0, x1, x2, x3, x4, x5, x6, x7, x8), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(10, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(11, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(12, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(13, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(14, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(15, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(16, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(17, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(18, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(19, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x18)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(20, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x18), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x19)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(21, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x18), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x19), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x20)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(22, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x18), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x19), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x20), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x21)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(23, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x18), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x19), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x20), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x21), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x22)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(24, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x18), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x19), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x20), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x21), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x22), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x23)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(25, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x18), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x19), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x20), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x21), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x22), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x23), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x24)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(26, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x18), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x19), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x20), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x21), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x22), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x23), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x24), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x25)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(27, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x18), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x19), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x20), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x21), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x22), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x23), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x24), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x25), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x26)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(28, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x18), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x19), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x20), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x21), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x22), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x23), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x24), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x25), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x26), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x27)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(29, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x18), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x19), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x20), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x21), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x22), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x23), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x24), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x25), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x26), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x27), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x28)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(30, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x18), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x19), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x20), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x21), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x22), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x23), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x24), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x25), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x26), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x27), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x28), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x29)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(31, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x18), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x19), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x20), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x21), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x22), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x23), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x24), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x25), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x26), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x27), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x28), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x29), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x30)))
+BOOST_HOF_DETAIL_UNPACK_AGGREGATE(32, (x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31), (BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x0), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x1), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x2), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x3), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x4), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x5), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x6), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x7), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x8), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x9), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x10), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x11), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x12), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x13), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x14), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x15), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x16), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x17), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x18), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x19), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x20), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x21), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x22), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x23), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x24), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x25), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x26), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x27), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x28), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x29), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x30), BOOST_HOF_DETAIL_AGGREGATE_FORWARD(x31)))
+
+#undef BOOST_HOF_DETAIL_UNPACK_AGGREGATE
+#undef BOOST_HOF_DETAIL_UNPACK_AGGREGATE_EXPAND
+
+template<class T>
+struct unpack_aggregate<T, typename std::enable_if<(
+    std::conjunction<std::is_class<T>, is_unpackable_aggregate<T>>::value
+)>::type>
+: unpack_aggregate_apply<aggregate_field_count<T, BOOST_HOF_UNPACK_AGGREGATE_MAX_FIELDS>::value>
+{};
+
+#endif
+
+#undef BOOST_HOF_DETAIL_AGGREGATE_FORWARD
+
+#endif
+
+}}} // namespace boost::hof
+
+#endif
@@ -12,8 +12,9 @@
 #include <boost/hof/returns.hpp>
 #include <boost/hof/detail/forward.hpp>
 #include <boost/hof/detail/seq.hpp>
-#include <tuple>
-#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 
 namespace boost { namespace hof {
 
@@ -26,6 +27,64 @@ make_tuple_gens(const Sequence&)
     return {};
 }
 
+BOOST_HOF_HOST_DEVICE constexpr std::size_t concat_tuple_index(std::size_t)
+{
+    return 0;
+}
+
+template<class... Ts>
+BOOST_HOF_HOST_DEVICE constexpr std::size_t concat_tuple_index(std::size_t p, std::size_t n, Ts... ns)
+{
+    return p < n ? 0 : 1 + concat_tuple_index(p - n, ns...);
+}
+
+BOOST_HOF_HOST_DEVICE constexpr std::size_t concat_element_index(std::size_t p)
+{
+    return p;
+}
+
+template<class... Ts>
+BOOST_HOF_HOST_DEVICE constexpr std::size_t concat_element_index(std::size_t p, std::size_t n, Ts... ns)
+{
+    return p < n ? p : concat_element_index(p - n, ns...);
+}
+
+// The tuples that are unpacked together are held by reference, where each
+// one is found by its index without recursion
+template<std::size_t I, class T>
+struct concat_ref
+{
+    T&& x;
+
+    BOOST_HOF_HOST_DEVICE constexpr concat_ref(T&& xp) noexcept : x(BOOST_HOF_FORWARD(T)(xp))
+    {}
+};
+
+template<class Seq, class... Ts>
+struct concat_refs;
+
+template<std::size_t... Is, class... Ts>
+struct concat_refs<seq<Is...>, Ts...>
+: concat_ref<Is, Ts>...
+{
+    BOOST_HOF_HOST_DEVICE constexpr concat_refs(Ts&&... xs) noexcept
+    : concat_ref<Is, Ts>(BOOST_HOF_FORWARD(Ts)(xs))...
+    {}
+};
+
+template<std::size_t I, class T>
+BOOST_HOF_HOST_DEVICE constexpr T&& concat_get(const concat_ref<I, T>& r) noexcept
+{
+    return BOOST_HOF_FORWARD(T)(r.x);
+}
+
+// The elements are found with `get` by argument-dependent lookup, so the
+// overloads of `std::get` for `std::tuple` and `std::array` don't need to
+// be declared before this
+namespace unpack_get {
+
+using std::get;
+
 #if (defined(__GNUC__) && !defined (__clang__) && __GNUC__ == 4 && __GNUC_MINOR__ < 7)
 
 template<std::size_t I, class Tuple>
@@ -51,33 +110,93 @@ struct tuple_element_return<I, const Tuple>
 template< std::size_t I, class Tuple, class R = typename tuple_element_return<I, Tuple&&>::type >
 R tuple_get( Tuple&& t ) 
 { 
-    return (R&&)(std::get<I>(boost::hof::forward<Tuple>(t))); 
+    return (R&&)(get<I>(boost::hof::forward<Tuple>(t))); 
 }
-#define BOOST_HOF_UNPACK_TUPLE_GET boost::hof::detail::tuple_get
+#define BOOST_HOF_UNPACK_TUPLE_GET boost::hof::detail::unpack_get::tuple_get
 #else
-#define BOOST_HOF_UNPACK_TUPLE_GET std::get
+#define BOOST_HOF_UNPACK_TUPLE_GET get
 
 #endif
 
 template<class F, class T, std::size_t ...N>
-constexpr auto unpack_tuple(F&& f, T&& t, seq<N...>) BOOST_HOF_RETURNS
+BOOST_HOF_HOST_DEVICE constexpr auto unpack_tuple(F&& f, T&& t, seq<N...>) BOOST_HOF_RETURNS
 (
     f(
         BOOST_HOF_AUTO_FORWARD(BOOST_HOF_UNPACK_TUPLE_GET<N>(BOOST_HOF_AUTO_FORWARD(t)))...
     )
 );
 
+// Unpacks several tuples at once, where the flattened index `P` is mapped
+// to the tuple and the element of the tuple from `Ns`, the tuple sizes
+template<std::size_t... Ns, class F, class Tuples, std::size_t... Ps>
+BOOST_HOF_HOST_DEVICE constexpr auto unpack_tuple_concat(F&& f, const Tuples& ts, seq<Ps...>) BOOST_HOF_RETURNS
+(
+    f(
+        BOOST_HOF_AUTO_FORWARD(BOOST_HOF_UNPACK_TUPLE_GET<concat_element_index(Ps, Ns...)>(
+            concat_get<concat_tuple_index(Ps, Ns...)>(ts)
+        ))...
+    )
+);
+
+}
+
 struct unpack_tuple_apply
 {
     template<class F, class S>
-    constexpr static auto apply(F&& f, S&& t) BOOST_HOF_RETURNS
+    BOOST_HOF_HOST_DEVICE constexpr static auto apply(F&& f, S&& t) BOOST_HOF_RETURNS
     (
-        boost::hof::detail::unpack_tuple(BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(S)(t), boost::hof::detail::make_tuple_gens(t))
+        boost::hof::detail::unpack_get::unpack_tuple(BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(S)(t), boost::hof::detail::make_tuple_gens(t))
+    );
+};
+
+// The elements of an rvalue array are forwarded as rvalues
+template<class Array, class T>
+struct array_element_ref
+: std::conditional<std::is_lvalue_reference<Array>::value, T&, T&&>
+{};
+
+template<class F, class T, std::size_t ...N>
+BOOST_HOF_HOST_DEVICE constexpr auto unpack_array(F&& f, T&& a, seq<N...>) BOOST_HOF_RETURNS
+(
+    f(
+        static_cast<typename array_element_ref<T&&, typename std::remove_reference<decltype(a[0])>::type>::type>(a[N])...
+    )
+);
+
+template<std::size_t Size>
+struct unpack_array_apply
+{
+    template<class F, class S>
+    BOOST_HOF_HOST_DEVICE constexpr static auto apply(F&& f, S&& a) BOOST_HOF_RETURNS
+    (
+        boost::hof::detail::unpack_array(BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(S)(a), typename gens<Size>::type())
+    );
+};
+
+// Views refer to elements they don't own, so the elements are always lvalues
+template<class F, class T, std::size_t ...N>
+BOOST_HOF_HOST_DEVICE constexpr auto unpack_view(F&& f, const T& v, seq<N...>) BOOST_HOF_RETURNS
+(
+    f(v[N]...)
+);
+
+template<std::size_t Size>
+struct unpack_view_apply
+{
+    template<class F, class S>
+    BOOST_HOF_HOST_DEVICE constexpr static auto apply(F&& f, S&& v) BOOST_HOF_RETURNS
+    (
+        boost::hof::detail::unpack_view(BOOST_HOF_FORWARD(F)(f), v, typename gens<Size>::type())
     );
 };
 
 }
 
+template<class T, std::size_t N>
+struct unpack_sequence<T[N]>
+: detail::unpack_array_apply<N>
+{};
+
 template<class... Ts>
 struct unpack_sequence<std::tuple<Ts...>>
 : detail::unpack_tuple_apply
@@ -88,11 +207,10 @@ struct unpack_sequence<std::pair<T, U>>
 : detail::unpack_tuple_apply
 {};
 
-template<class T, std::size_t N>
-struct unpack_sequence<std::array<T, N>>
-: detail::unpack_tuple_apply
-{};
-
 }} // namespace boost::hof
 
+#if BOOST_HOF_UNPACK_STD_SEQUENCES
+#include <boost/hof/std_sequences.hpp>
+#endif
+
 #endif
@@ -9,9 +9,18 @@
 #define BOOST_HOF_GUARD_UNWRAP_H
 
 #include <type_traits>
-#include <functional>
+#include <boost/hof/detail/reference_wrapper.hpp>
 
-namespace boost { namespace hof { namespace detail {
+namespace boost { namespace hof {
+
+// These are defined by borrow.hpp, which is needed to borrow a value
+template<class T, class=void>
+struct borrow_traits;
+
+template<class T>
+class borrowed;
+
+namespace detail {
 
 template <class T>
 struct unwrap_reference
@@ -23,6 +32,11 @@ struct unwrap_reference<std::reference_wrapper<T>>
 {
     typedef T& type;
 };
+template <class T>
+struct unwrap_reference<borrowed<T>>
+{
+    typedef typename borrow_traits<T>::type type;
+};
 
 }}} // namespace boost::hof
 
@@ -0,0 +1,150 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    dispatch_index.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DISPATCH_INDEX_H
+#define BOOST_HOF_GUARD_DISPATCH_INDEX_H
+
+/// dispatch_index
+/// ==============
+///
+/// Description
+/// -----------
+///
+/// The `dispatch_index` function adaptor selects a function by a runtime
+/// index, which is passed as the first parameter, and then calls it with the
+/// rest of the parameters. The function is looked up in a table of function
+/// pointers that is built at compile time, so the selection takes constant
+/// time no matter how many functions there are, rather than a chain of
+/// comparisons. Each entry of the table calls its function directly, so the
+/// body of each function can be inlined into its entry.
+///
+/// If all the functions return the same type, then that is the result type.
+/// Otherwise, the results are converted to their `std::common_type`.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Fs>
+///     constexpr dispatch_index_adaptor<Fs...> dispatch_index(Fs... fs);
+///
+/// Semantics
+/// ---------
+///
+///     assert(dispatch_index(fs...)(i, xs...) == fs[i](xs...));
+///
+/// Requirements
+/// ------------
+///
+/// Fs must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// The index must be less than the number of functions.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct add
+///     {
+///         int operator()(int x, int y) const
+///         {
+///             return x + y;
+///         }
+///     };
+///
+///     struct subtract
+///     {
+///         int operator()(int x, int y) const
+///         {
+///             return x - y;
+///         }
+///     };
+///
+///     int main() {
+///         auto f = boost::hof::dispatch_index(add(), subtract());
+///         assert(f(0, 3, 2) == 5);
+///         assert(f(1, 3, 2) == 1);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [first_of](first_of)
+/// * [match](match)
+///
+
+#include <boost/hof/pack.hpp>
+#include <boost/hof/detail/and.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/detail/type_at.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace boost { namespace hof { namespace detail {
+
+template<class R, class... Rs>
+struct dispatch_index_result
+: std::conditional<BOOST_HOF_AND_UNPACK((std::is_same<R, Rs>::value)),
+    std::enable_if<true, R>,
+    std::common_type<R, Rs...>
+>::type
+{};
+
+template<class S, class... Fs>
+struct dispatch_index_adaptor_base;
+
+template<std::size_t... Ns, class... Fs>
+struct dispatch_index_adaptor_base<seq<Ns...>, Fs...>
+: pack_base<seq<Ns...>, Fs...>
+{
+    typedef pack_base<seq<Ns...>, Fs...> base_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(dispatch_index_adaptor_base, base_type)
+
+    template<std::size_t I, class R, class... Ts>
+    static R call(const dispatch_index_adaptor_base& self, Ts&&... xs)
+    {
+        return boost::hof::alias_value<pack_tag<seq<I>, Fs...>, typename type_at<I, Fs...>::type>(self, xs...)(
+            BOOST_HOF_FORWARD(Ts)(xs)...
+        );
+    }
+
+    template<class... Ts, class R=typename dispatch_index_result<
+        decltype(std::declval<const Fs&>()(std::declval<Ts>()...))...
+    >::type>
+    BOOST_HOF_INLINE R operator()(std::size_t i, Ts&&... xs) const
+    {
+        typedef R (*entry_type)(const dispatch_index_adaptor_base&, Ts&&...);
+        static constexpr entry_type table[] = { &dispatch_index_adaptor_base::template call<Ns, R, Ts...>... };
+        return table[i](*this, BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+}
+
+template<class... Fs>
+struct dispatch_index_adaptor
+: detail::dispatch_index_adaptor_base<typename detail::gens<sizeof...(Fs)>::type, detail::callable_base<Fs>...>
+{
+    typedef detail::dispatch_index_adaptor_base<typename detail::gens<sizeof...(Fs)>::type, detail::callable_base<Fs>...> base_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(dispatch_index_adaptor, base_type)
+};
+
+BOOST_HOF_DETAIL_COMPILE_MARKER(dispatch_index, dispatch_index_adaptor)
+
+BOOST_HOF_DECLARE_STATIC_VAR(dispatch_index, detail::make<dispatch_index_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
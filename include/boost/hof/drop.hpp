@@ -0,0 +1,121 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    drop.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_DROP_H
+#define BOOST_HOF_GUARD_DROP_H
+
+/// drop
+/// ====
+///
+/// Description
+/// -----------
+///
+/// The `drop` function adaptor calls the function without the arguments at
+/// the zero-based indices. The rest of the arguments are forwarded in the
+/// same order, in one expansion.
+///
+/// Synopsis
+/// --------
+///
+///     template<std::size_t... Is, class F>
+///     constexpr drop_adaptor<F, Is...> drop(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(drop<1>(f)(x, y, zs...) == f(x, zs...));
+///
+/// Requirements
+/// ------------
+///
+/// The indices `Is...` must be unique, and each index must be less than the
+/// number of arguments.
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int main() {
+///         auto f = [](int x, int y) { return x - y; };
+///         assert(boost::hof::drop<1>(f)(5, 0, 2) == 3);
+///     }
+///
+
+#include <boost/hof/arg.hpp>
+#include <boost/hof/always.hpp>
+#include <boost/hof/detail/and.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/index_count.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <boost/hof/detail/seq.hpp>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<std::size_t... Is>
+struct drop_index
+{
+    // The index of the Kth argument that is kept, starting from I
+    static constexpr std::size_t at(std::size_t k, std::size_t i=0)
+    {
+        return index_sum((i == Is ? 1 : 0)...) > 0 ? at(k, i+1) : (k == 0 ? i : at(k-1, i+1));
+    }
+};
+
+}
+
+template<class F, std::size_t... Is>
+struct drop_adaptor : detail::callable_base<F>
+{
+    static_assert(BOOST_HOF_AND_UNPACK((detail::index_count<Is, Is...>::value == 1)), "The indices must be unique");
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(drop_adaptor, detail::callable_base<F>);
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    BOOST_HOF_RETURNS_CLASS(drop_adaptor);
+
+    template<std::size_t... Ns, class... Ts>
+    BOOST_HOF_INLINE constexpr auto drop_call(detail::seq<Ns...>, Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        (BOOST_HOF_MANGLE_CAST(const detail::callable_base<F>&)(BOOST_HOF_CONST_THIS->base_function(xs...)))
+        (
+            boost::hof::detail::get_args<detail::drop_index<Is...>::at(Ns)+1>(BOOST_HOF_FORWARD(Ts)(xs)...)...
+        )
+    );
+
+    template<class... Ts, class=typename std::enable_if<
+        BOOST_HOF_AND_UNPACK((Is < sizeof...(Ts)))
+    >::type>
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        BOOST_HOF_CONST_THIS->drop_call(typename detail::gens<sizeof...(Ts)-sizeof...(Is)>::type(), BOOST_HOF_FORWARD(Ts)(xs)...)
+    );
+};
+
+template<std::size_t... Is, class F>
+constexpr drop_adaptor<F, Is...> drop(F f)
+BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(drop_adaptor<F, Is...>, F&&)
+{
+    return drop_adaptor<F, Is...>(boost::hof::move(f));
+}
+
+}} // namespace boost::hof
+
+#endif
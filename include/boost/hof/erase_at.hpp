@@ -0,0 +1,142 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    erase_at.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_ERASE_AT_H
+#define BOOST_HOF_GUARD_ERASE_AT_H
+
+/// erase_at
+/// ========
+///
+/// Description
+/// -----------
+///
+/// The `erase_at` function adaptor puts a boundary with the signature `Sig`
+/// in front of a function. Like [`typed`](typed), its call operator is not
+/// a template, and the arguments are converted to the parameter types of
+/// the signature, so the function is only instantiated with them, however
+/// many argument types the callers have. Unlike `typed`, the function is
+/// called through a static function that is never inlined, so the body of a
+/// generic composition is emitted once for the signature, instead of in
+/// every caller. The callers only convert the arguments and make one call.
+///
+/// This can be passed as a [`function_ref`](function_ref), which then
+/// calls this single instantiation through its pointer.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Sig, class F>
+///     constexpr erase_at_adaptor<Sig, F> erase_at(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(erase_at<R(Args...)>(f)(xs...) == static_cast<R>(f(static_cast<Args>(xs)...)));
+///
+/// Requirements
+/// ------------
+///
+/// Sig must be a function type `R(Args...)`.
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <string>
+///
+///     struct length
+///     {
+///         template<class T>
+///         std::size_t operator()(const T& x) const
+///         {
+///             return x.size();
+///         }
+///     };
+///
+///     int main() {
+///         auto f = boost::hof::erase_at<std::size_t(const std::string&)>(length());
+///         assert(f("abc") == 3);
+///         assert(f(std::string("ab")) == 2);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [typed](typed)
+/// * [function_ref](function_ref)
+/// * [Configurations](Configurations)
+///
+
+#include <boost/hof/config.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/erased_call.hpp>
+#include <boost/hof/detail/move.hpp>
+
+namespace boost { namespace hof {
+
+template<class Sig, class F>
+struct erase_at_adaptor;
+
+template<class R, class... Args, class F>
+struct erase_at_adaptor<R(Args...), F> : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(erase_at_adaptor, detail::callable_base<F>)
+
+    typedef R result_type;
+
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function() const noexcept
+    {
+        return *this;
+    }
+
+    // The only instantiation of the function for the signature
+    BOOST_HOF_NOINLINE static R invoke(const detail::callable_base<F>& f, Args&&... xs)
+    {
+        return detail::erased_invoke<R>::call(f, BOOST_HOF_FORWARD(Args)(xs)...);
+    }
+
+    BOOST_HOF_INLINE R operator()(Args... xs) const
+    {
+        return erase_at_adaptor::invoke(this->base_function(), BOOST_HOF_FORWARD(Args)(xs)...);
+    }
+};
+
+#if BOOST_HOF_HAS_VARIABLE_TEMPLATES
+namespace erase_at_detail {
+template<class Sig>
+struct erase_at_f
+{
+    template<class F>
+    BOOST_HOF_INLINE constexpr erase_at_adaptor<Sig, F> operator()(F f) const
+    {
+        return erase_at_adaptor<Sig, F>(boost::hof::move(f));
+    }
+};
+
+}
+
+template<class Sig>
+static constexpr auto erase_at = erase_at_detail::erase_at_f<Sig>{};
+#else
+template<class Sig, class F>
+constexpr erase_at_adaptor<Sig, F> erase_at(F f)
+BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(erase_at_adaptor<Sig, F>, F&&)
+{
+    return erase_at_adaptor<Sig, F>(boost::hof::move(f));
+}
+#endif
+
+}} // namespace boost::hof
+
+#endif
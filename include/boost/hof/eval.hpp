@@ -64,7 +64,7 @@ namespace detail {
 struct simple_eval
 {
     template<class F, class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(F) 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(F) 
     operator()(F&& f, Ts&&...xs) const BOOST_HOF_SFINAE_RETURNS
     (boost::hof::always_ref(f)(xs...)());
 };
@@ -72,7 +72,7 @@ struct simple_eval
 struct id_eval
 {
     template<class F, class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(F, id_<decltype(boost::hof::identity)>) 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(F, id_<decltype(boost::hof::identity)>) 
     operator()(F&& f, Ts&&...xs) const BOOST_HOF_SFINAE_RETURNS
     (boost::hof::always_ref(f)(xs...)(boost::hof::identity));
 };
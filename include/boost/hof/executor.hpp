@@ -0,0 +1,237 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    executor.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_EXECUTOR_H
+#define BOOST_HOF_GUARD_EXECUTOR_H
+
+/// executor
+/// ========
+///
+/// Description
+/// -----------
+///
+/// An executor runs tasks for the adaptors that evaluate functions
+/// concurrently, such as [`parallel_combine`](parallel_combine) and
+/// [`parallel_by`](parallel_by). The executor's `submit` function takes a
+/// nullary function object and returns a handle, whose `get` function waits
+/// for the task and returns its result.
+///
+/// The executor's `execute` function runs a nullary function object without
+/// returning a handle, which is used by [`async`](async) to run a stage once
+/// its inputs are ready.
+///
+/// The `thread_executor` runs each task asynchronously on its own thread
+/// with `std::async`, or on a detached thread for `execute`. The
+/// `inline_executor` runs the task on the calling thread when its result is
+/// requested, or immediately for `execute`. For many small tasks, the
+/// [`work_stealing_executor`](work_stealing_executor) runs them on a pool of
+/// threads instead.
+///
+/// The `parallel_on` function creates a policy to use an executor with the
+/// parallel adaptors. If there are fewer tasks than the threshold, the
+/// adaptor calls the functions on the calling thread instead of submitting
+/// them to the executor.
+///
+/// An executor can also run tasks on several NUMA nodes, such as the
+/// [`numa_executor`](numa_executor). Its `nodes` function returns the number
+/// of nodes, and `submit_on(node, f)` and `execute_on(node, f)` run the task
+/// on a worker of a node. The parallel adaptors then split the tasks into a
+/// contiguous block for each node, in order, so the chunks of a range that
+/// are next to each other are on the same node, and the results of a node
+/// are only combined with the other nodes at the end. The executors that
+/// don't have these functions are a single node.
+///
+/// Synopsis
+/// --------
+///
+///     struct inline_executor;
+///
+///     struct thread_executor;
+///
+///     template<class Executor>
+///     constexpr parallel_policy<Executor> parallel_on(Executor e, std::size_t threshold=2);
+///
+/// Requirements
+/// ------------
+///
+/// Executor must be:
+///
+/// * CopyConstructible
+/// * Have a const member function `submit(f)` that takes a nullary function
+///   object `f` and returns a handle `h` such that `h.get()` returns `f()`.
+///   The task must have finished before the handle is destroyed.
+/// * Have a const member function `execute(f)` that runs the nullary function
+///   object `f`, which may only be MoveConstructible, for use with
+///   [`async`](async).
+///
+/// An executor may also:
+///
+/// * Have a const member function `nodes()` that returns the number of nodes.
+/// * Have const member functions `submit_on(node, f)` and `execute_on(node, f)`,
+///   that are like `submit` and `execute`, except the task runs on the node,
+///   for a node less than `nodes()`.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int main() {
+///         auto h = boost::hof::thread_executor().submit([]{ return 3; });
+///         assert(h.get() == 3);
+///     }
+///
+
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <utility>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class F>
+struct deferred_handle
+{
+    F f;
+
+    decltype(std::declval<F&>()()) get()
+    {
+        return f();
+    }
+};
+
+}
+
+struct inline_executor
+{
+    template<class F>
+    constexpr detail::deferred_handle<F> submit(F f) const
+    {
+        return detail::deferred_handle<F>{static_cast<F&&>(f)};
+    }
+
+    template<class F>
+    void execute(F f) const
+    {
+        f();
+    }
+};
+
+struct thread_executor
+{
+    template<class F>
+    std::future<decltype(std::declval<F&>()())> submit(F f) const
+    {
+        return std::async(std::launch::async, std::move(f));
+    }
+
+    template<class F>
+    void execute(F f) const
+    {
+        std::thread(std::move(f)).detach();
+    }
+};
+
+namespace detail {
+
+template<class Executor>
+auto executor_nodes(const Executor& e, int) -> decltype(std::size_t(e.nodes()))
+{
+    return e.nodes();
+}
+
+template<class Executor>
+std::size_t executor_nodes(const Executor&, long)
+{
+    return 1;
+}
+
+// The number of nodes of the executor, which is at least 1
+template<class Executor>
+std::size_t executor_nodes(const Executor& e)
+{
+    std::size_t n = detail::executor_nodes(e, 0);
+    return n == 0 ? 1 : n;
+}
+
+// The node of the task i of n, so each node runs a contiguous block
+constexpr std::size_t executor_node(std::size_t i, std::size_t n, std::size_t nodes)
+{
+    return n == 0 ? 0 : i * nodes / n;
+}
+
+template<class Executor, class F>
+auto submit_on(const Executor& e, std::size_t node, F f, int)
+-> decltype(e.submit_on(node, static_cast<F&&>(f)))
+{
+    return e.submit_on(node, static_cast<F&&>(f));
+}
+
+template<class Executor, class F>
+auto submit_on(const Executor& e, std::size_t, F f, long)
+-> decltype(e.submit(static_cast<F&&>(f)))
+{
+    return e.submit(static_cast<F&&>(f));
+}
+
+template<class Executor, class F>
+auto submit_on(const Executor& e, std::size_t node, F f)
+-> decltype(detail::submit_on(e, node, static_cast<F&&>(f), 0))
+{
+    return detail::submit_on(e, node, static_cast<F&&>(f), 0);
+}
+
+template<class Executor, class F>
+auto execute_on(const Executor& e, std::size_t node, F f, int)
+-> decltype(e.execute_on(node, static_cast<F&&>(f)))
+{
+    e.execute_on(node, static_cast<F&&>(f));
+}
+
+template<class Executor, class F>
+void execute_on(const Executor& e, std::size_t, F f, long)
+{
+    e.execute(static_cast<F&&>(f));
+}
+
+template<class Executor, class F>
+void execute_on(const Executor& e, std::size_t node, F f)
+{
+    detail::execute_on(e, node, static_cast<F&&>(f), 0);
+}
+
+}
+
+template<class Executor>
+struct parallel_policy
+{
+    Executor executor;
+    std::size_t threshold;
+
+    template<class X, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(Executor, X&&)>
+    constexpr parallel_policy(X&& e, std::size_t n=2)
+    : executor(BOOST_HOF_FORWARD(X)(e)), threshold(n)
+    {}
+
+    constexpr parallel_policy() : executor(), threshold(2)
+    {}
+};
+
+template<class Executor>
+constexpr parallel_policy<Executor> parallel_on(Executor e, std::size_t threshold=2)
+{
+    return parallel_policy<Executor>(static_cast<Executor&&>(e), threshold);
+}
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,102 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    extern_function.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_EXTERN_FUNCTION_H
+#define BOOST_HOF_GUARD_EXTERN_FUNCTION_H
+
+/// BOOST_HOF_DECLARE_EXTERN_FUNCTION
+/// =================================
+///
+/// Description
+/// -----------
+///
+/// The `BOOST_HOF_DECLARE_EXTERN_FUNCTION` macro declares a function object
+/// with a fixed signature, whose definition is a composition of adaptors
+/// that is only compiled in one translation unit, which uses the
+/// `BOOST_HOF_DEFINE_EXTERN_FUNCTION` macro. So a composition, such as a
+/// [`first_of`](first_of) of [`flow`](flow)s, that is called from many
+/// translation units, is instantiated once instead of in each of them.
+///
+/// Calling the function object is a direct call of its static `call`
+/// function, which is an `extern template` in the translation units that
+/// only see the declaration, and is explicitly instantiated by the
+/// definition. The call can still be inlined with link
+/// time optimization.
+///
+/// Both macros must be used in the same namespace, and the definition must
+/// see the declaration. The expression of the definition initializes a
+/// variable with internal linkage of the defining translation unit, so it
+/// shouldn't need dynamic initialization if the function is called while
+/// other translation units are initialized.
+///
+/// Synopsis
+/// --------
+///
+///     #define BOOST_HOF_DECLARE_EXTERN_FUNCTION(name, Sig)
+///
+///     #define BOOST_HOF_DEFINE_EXTERN_FUNCTION(name, expression)
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     // In a header
+///     BOOST_HOF_DECLARE_EXTERN_FUNCTION(scale, long(long));
+///
+///     // In one source file
+///     BOOST_HOF_DEFINE_EXTERN_FUNCTION(scale, boost::hof::flow(
+///         [](long x) { return x * 2; },
+///         [](long x) { return x + 1; }
+///     ));
+///
+///     int main() {
+///         assert(scale(5L) == 11);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [BOOST_HOF_STATIC_FUNCTION](function)
+///
+
+#include <boost/hof/config.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+
+// The class template is declared in the namespace of the function, since it
+// is explicitly instantiated there. Its call function is only defined by
+// `BOOST_HOF_DEFINE_EXTERN_FUNCTION`.
+#define BOOST_HOF_DECLARE_EXTERN_FUNCTION(name, ...) \
+    struct name ## _hof_extern_signature { using type = __VA_ARGS__; }; \
+    template<class Sig> \
+    struct name ## _hof_extern_function; \
+    template<class R, class... Ts> \
+    struct name ## _hof_extern_function<R(Ts...)> \
+    { \
+        typedef R result_type; \
+        constexpr name ## _hof_extern_function() noexcept \
+        {} \
+        static R call(Ts... xs); \
+        BOOST_HOF_INLINE R operator()(Ts... xs) const \
+        { \
+            return name ## _hof_extern_function::call(static_cast<Ts&&>(xs)...); \
+        } \
+    }; \
+    extern template struct name ## _hof_extern_function<name ## _hof_extern_signature::type>; \
+    BOOST_HOF_DECLARE_STATIC_VAR(name, name ## _hof_extern_function<name ## _hof_extern_signature::type>)
+
+#define BOOST_HOF_DEFINE_EXTERN_FUNCTION(name, ...) \
+    static const auto name ## _hof_extern_definition = __VA_ARGS__; \
+    template<class R, class... Ts> \
+    R name ## _hof_extern_function<R(Ts...)>::call(Ts... xs) \
+    { \
+        return name ## _hof_extern_definition(static_cast<Ts&&>(xs)...); \
+    } \
+    template struct name ## _hof_extern_function<name ## _hof_extern_signature::type>
+
+#endif
@@ -0,0 +1,128 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    filter.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FILTER_H
+#define BOOST_HOF_GUARD_FILTER_H
+
+/// filter
+/// ======
+///
+/// Description
+/// -----------
+///
+/// The `filter` function returns a lazy view of a range, with only the
+/// elements for which the predicate returns true. Like [`map`](map), nothing
+/// is evaluated until the view is consumed, and the predicate is then called
+/// in the same loop as the other stages of the pipeline, so no intermediate
+/// container is created.
+///
+/// The function is [pipable](pipable), so the range can be piped into it.
+/// An lvalue range is referred to by the view, and an rvalue range is moved
+/// into it.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Range, class Predicate>
+///     constexpr auto filter(Range&& r, Predicate p);
+///
+/// Semantics
+/// ---------
+///
+///     assert(fold_into(filter(r, p), g, init) == std::accumulate(r.begin(), r.end(), init, [](auto s, auto x) { return p(x) ? g(s, x) : s; }));
+///
+/// Requirements
+/// ------------
+///
+/// Range must be:
+///
+/// * A range that can be iterated with a range-based `for` loop, or another view
+///
+/// Predicate must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <vector>
+///
+///     int main() {
+///         std::vector<int> v = { 1, 2, 3, 4 };
+///         int r = v | boost::hof::filter(boost::hof::_ > 2) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0);
+///         assert(r == 7);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [map](map)
+/// * [fold_into](fold_into)
+/// * [pipable](pipable)
+///
+
+#include <boost/hof/pipable.hpp>
+#include <boost/hof/detail/range_view.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class P, class Sink>
+struct filter_sink
+{
+    const P& p;
+    Sink& sink;
+
+    template<class X>
+    BOOST_HOF_INLINE void operator()(X&& x) const
+    {
+        if (p(x)) sink(BOOST_HOF_FORWARD(X)(x));
+    }
+};
+
+template<class View, class P>
+struct filter_view : range_view_base
+{
+    View view;
+    P p;
+
+    template<class V, class Q>
+    constexpr filter_view(V&& v, Q&& q)
+    : view(BOOST_HOF_FORWARD(V)(v)), p(BOOST_HOF_FORWARD(Q)(q))
+    {}
+
+    template<class Sink>
+    BOOST_HOF_INLINE void for_each(Sink&& sink) const
+    {
+        view.for_each(filter_sink<P, typename std::remove_reference<Sink>::type>{p, sink});
+    }
+};
+
+struct filter_f
+{
+    template<class Range, class P>
+    constexpr filter_view<typename range_view_of<Range>::type, P> operator()(Range&& r, P p) const
+    {
+        return filter_view<typename range_view_of<Range>::type, P>(
+            detail::as_range_view(BOOST_HOF_FORWARD(Range)(r)), static_cast<P&&>(p)
+        );
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(filter, pipable_adaptor<detail::filter_f>);
+
+}} // namespace boost::hof
+
+#endif
@@ -82,11 +82,13 @@
 /// 
 
 #include <boost/hof/reveal.hpp>
+#include <boost/hof/alias.hpp>
 #include <boost/hof/detail/compressed_pair.hpp>
 #include <boost/hof/detail/callable_base.hpp>
 #include <boost/hof/detail/delegate.hpp>
 #include <boost/hof/detail/join.hpp>
 #include <boost/hof/detail/seq.hpp>
+#include <boost/hof/detail/type_at.hpp>
 #include <boost/hof/detail/make.hpp>
 #include <boost/hof/detail/static_const_var.hpp>
 
@@ -102,7 +104,7 @@ struct basic_first_of_adaptor : F1, F2
     template<class A, class B,
         BOOST_HOF_ENABLE_IF_CONVERTIBLE(A, F1),
         BOOST_HOF_ENABLE_IF_CONVERTIBLE(B, F2)>
-    constexpr basic_first_of_adaptor(A&& f1, B&& f2)
+    BOOST_HOF_HOST_DEVICE constexpr basic_first_of_adaptor(A&& f1, B&& f2)
     noexcept(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(F1, A&&) && BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(F2, B&&))
     : F1(BOOST_HOF_FORWARD(A)(f1)), F2(BOOST_HOF_FORWARD(B)(f2))
     {}
@@ -112,7 +114,7 @@ struct basic_first_of_adaptor : F1, F2
         BOOST_HOF_IS_CONVERTIBLE(X, F1) && 
         BOOST_HOF_IS_DEFAULT_CONSTRUCTIBLE(F2)
     >::type>
-    constexpr basic_first_of_adaptor(X&& x) 
+    BOOST_HOF_HOST_DEVICE constexpr basic_first_of_adaptor(X&& x) 
     BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(F1, X&&)
     : F1(BOOST_HOF_FORWARD(X)(x))
     {} 
@@ -130,7 +132,7 @@ struct basic_first_of_adaptor : F1, F2
     BOOST_HOF_RETURNS_CLASS(basic_first_of_adaptor);
 
     template<class... Ts, class F=typename select<Ts...>::type>
-    constexpr BOOST_HOF_SFINAE_RESULT(typename select<Ts...>::type, id_<Ts>...) 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(typename select<Ts...>::type, id_<Ts>...) 
     operator()(Ts && ... xs) const
     BOOST_HOF_SFINAE_RETURNS
     (
@@ -138,46 +140,98 @@ struct basic_first_of_adaptor : F1, F2
     );
 };
 
-template <class F1, class F2>
-constexpr const F1& which(std::true_type, const F1& f1, const F2&) noexcept
-{ 
-    return f1; 
-}
+template<std::size_t I, class... Fs>
+struct first_of_tag
+{};
 
-template <class F1, class F2>
-constexpr const F2& which(std::false_type, const F1&, const F2& f2) noexcept
-{ 
-    return f2; 
-}
+#if BOOST_HOF_HAS_NO_UNIQUE_ADDRESS
+template<std::size_t I, class T, class Seq, class... Fs>
+struct first_of_holder
+: detail::alias_empty<T, first_of_tag<I, Fs...>>
+{};
+#elif BOOST_HOF_COMPRESSED_PAIR_USE_EBO_WORKAROUND
+template<std::size_t I, class T, class Seq, class... Fs>
+struct first_of_holder;
 
-template<class F1, class F2>
-struct conditional_kernel : compressed_pair<F1, F2>
+template<std::size_t I, class T, std::size_t... Ns, class... Fs>
+struct first_of_holder<I, T, seq<Ns...>, Fs...>
+: std::conditional<
+    BOOST_HOF_AND_UNPACK((Ns == I || !is_related<T, Fs>::value)), 
+    detail::alias_try_static<T, first_of_tag<I, Fs...>>,
+    detail::alias_empty<T, first_of_tag<I, Fs...>>
+>::type
+{};
+#else
+template<std::size_t I, class T, class Seq, class... Fs>
+struct first_of_holder
+: detail::alias_try_static<T, first_of_tag<I, Fs...>>
+{};
+#endif
+
+template<class... Ts>
+struct first_of_args
+{};
+
+template<std::size_t I, class F>
+struct first_of_selected
+: std::integral_constant<std::size_t, I>
 {
-    typedef compressed_pair<F1, F2> base;
-    BOOST_HOF_INHERIT_CONSTRUCTOR(conditional_kernel, base)
+    typedef F function_type;
+};
 
-    template<class... Ts>
-    struct select
-    : std::conditional
-    <
-        is_invocable<F1, Ts...>::value, 
-        F1,
-        F2
-    >
-    {};
+// Finds the index of the first invocable function, along with its type. This
+// only checks each function once, and stops at the first one that is
+// invocable, so the functions after it are never instantiated. It only
+// depends on the types of the functions and the arguments, so every call with
+// the same argument types, from any adaptor with the same functions, reuses
+// the same specialization.
+template<std::size_t I, std::size_t N, class Functions, class Args, bool=(I < N)>
+struct first_of_select
+{};
+
+template<std::size_t I, std::size_t N, class... Fs, class... Ts>
+struct first_of_select<I, N, first_of_args<Fs...>, first_of_args<Ts...>, true>
+: std::conditional
+<
+    is_invocable<typename type_at<I, Fs...>::type, Ts...>::value,
+    first_of_selected<I, typename type_at<I, Fs...>::type>,
+    first_of_select<I+1, N, first_of_args<Fs...>, first_of_args<Ts...>>
+>::type
+{};
+
+template<class Seq, class... Fs>
+struct first_of_kernel;
 
-    BOOST_HOF_RETURNS_CLASS(conditional_kernel);
+template<std::size_t... Ns, class... Fs>
+struct first_of_kernel<seq<Ns...>, Fs...>
+: first_of_holder<Ns, Fs, seq<Ns...>, Fs...>::type...
+{
+    BOOST_HOF_INHERIT_DEFAULT(first_of_kernel, typename first_of_holder<Ns, Fs, seq<Ns...>, Fs...>::type...)
+
+    template<class... Xs, BOOST_HOF_ENABLE_IF_CONVERTIBLE_UNPACK(Xs&&, typename first_of_holder<Ns, Fs, seq<Ns...>, Fs...>::type)>
+    BOOST_HOF_HOST_DEVICE constexpr first_of_kernel(Xs&&... xs) 
+    BOOST_HOF_NOEXCEPT(BOOST_HOF_AND_UNPACK(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(typename first_of_holder<Ns, Fs, seq<Ns...>, Fs...>::type, Xs&&)))
+    : first_of_holder<Ns, Fs, seq<Ns...>, Fs...>::type(BOOST_HOF_FORWARD(Xs)(xs))...
+    {}
+
+    template<std::size_t I, class... Ts>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr const typename type_at<I, Fs...>::type& get_function(Ts&&... xs) const noexcept
+    {
+        return boost::hof::alias_value<first_of_tag<I, Fs...>, typename type_at<I, Fs...>::type>(*this, xs...);
+    }
+
+    BOOST_HOF_RETURNS_CLASS(first_of_kernel);
 
-    template<class... Ts, class PickFirst=is_invocable<F1, Ts...>>
-    constexpr BOOST_HOF_SFINAE_RESULT(typename select<Ts...>::type, id_<Ts>...) 
+    template<class... Ts, 
+        class Select=first_of_select<0, sizeof...(Fs), first_of_args<Fs...>, first_of_args<Ts...>>, 
+        std::size_t I=Select::value, 
+        class F=typename Select::function_type
+        BOOST_HOF_DETAIL_CALL_MARKER(first_of, Ts...)>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(const F&, id_<Ts>...) 
     operator()(Ts && ... xs) const
     BOOST_HOF_SFINAE_RETURNS
     (
-        boost::hof::detail::which(
-            BOOST_HOF_RETURNS_CONSTRUCT(PickFirst)(),
-            BOOST_HOF_MANGLE_CAST(const F1&)(BOOST_HOF_CONST_THIS->first(xs...)),
-            BOOST_HOF_MANGLE_CAST(const F2&)(BOOST_HOF_CONST_THIS->second(xs...))
-        )
+        BOOST_HOF_MANGLE_CAST(const F&)(BOOST_HOF_CONST_THIS->template get_function<I>(xs...))
         (BOOST_HOF_FORWARD(Ts)(xs)...)
     );
 };
@@ -185,28 +239,12 @@ struct conditional_kernel : compressed_pair<F1, F2>
 
 template<class F, class... Fs>
 struct first_of_adaptor 
-: detail::conditional_kernel<F, BOOST_HOF_JOIN(first_of_adaptor, Fs...) >
+: detail::first_of_kernel<typename detail::gens<sizeof...(Fs)+1>::type, F, Fs...>
 {
     typedef first_of_adaptor fit_rewritable_tag;
-    typedef BOOST_HOF_JOIN(first_of_adaptor, Fs...) kernel_base;
-    typedef detail::conditional_kernel<F, kernel_base > base;
+    typedef detail::first_of_kernel<typename detail::gens<sizeof...(Fs)+1>::type, F, Fs...> base;
 
-    BOOST_HOF_INHERIT_DEFAULT(first_of_adaptor, base)
-
-    template<class X, class... Xs, 
-        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(base, X, kernel_base), 
-        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(kernel_base, Xs...)>
-    constexpr first_of_adaptor(X&& f1, Xs&& ... fs) 
-    noexcept(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(base, X&&, kernel_base) && BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(kernel_base, Xs&&...))
-    : base(BOOST_HOF_FORWARD(X)(f1), kernel_base(BOOST_HOF_FORWARD(Xs)(fs)...))
-    {}
-
-    template<class X, class... Xs, 
-        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(base, X)>
-    constexpr first_of_adaptor(X&& f1) 
-    BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(base, X&&)
-    : base(BOOST_HOF_FORWARD(X)(f1))
-    {}
+    BOOST_HOF_INHERIT_CONSTRUCTOR(first_of_adaptor, base);
 
     struct failure
     : failure_for<F, Fs...>
@@ -224,18 +262,7 @@ struct first_of_adaptor<F> : F
     {};
 };
 
-template<class F1, class F2>
-struct first_of_adaptor<F1, F2> 
-: detail::conditional_kernel<F1, F2>
-{
-    typedef detail::conditional_kernel<F1, F2> base;
-    typedef first_of_adaptor fit_rewritable_tag;
-    BOOST_HOF_INHERIT_CONSTRUCTOR(first_of_adaptor, base);
-
-    struct failure
-    : failure_for<F1, F2>
-    {};
-};
+BOOST_HOF_DETAIL_COMPILE_MARKER(first_of, first_of_adaptor)
 
 BOOST_HOF_DECLARE_STATIC_VAR(first_of, detail::make<first_of_adaptor>);
 
@@ -27,12 +27,23 @@
 /// 
 ///     int r = boost::hof::result<int>(factorial)(5);
 /// 
+/// The depth can be set for one function with `fix_depth`. Each level of the
+/// depth is instantiated for every call, so a lower depth compiles faster. A
+/// depth of 0 doesn't unroll any calls, and the function can still recurse in
+/// a `constexpr` context, but the result type of the function must then be
+/// known without calling the self-reference, such as by using
+/// [`boost::hof::result`](/include/boost/hof/result), and `noexcept` is not
+/// deduced.
+/// 
 /// Synopsis
 /// --------
 /// 
 ///     template<class F>
 ///     constexpr fix_adaptor<F> fix(F f);
 /// 
+///     template<int Depth, class F>
+///     constexpr fix_adaptor<F, Depth> fix_depth(F f);
+/// 
 /// Semantics
 /// ---------
 /// 
@@ -74,7 +85,6 @@
 #include <boost/hof/reveal.hpp>
 #include <boost/hof/detail/delegate.hpp>
 #include <boost/hof/detail/move.hpp>
-#include <boost/hof/detail/make.hpp>
 #include <boost/hof/detail/static_const_var.hpp>
 #include <boost/hof/indirect.hpp>
 #include <boost/hof/result.hpp>
@@ -138,13 +148,13 @@ struct fix_adaptor_base : F
 
 
     template<class... Ts>
-    constexpr const F& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr const F& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     template<class... Ts>
-    constexpr derived derived_function(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr derived derived_function(Ts&&... xs) const noexcept
     {
         return derived(boost::hof::detail::make_indirect_ref(this->base_function(xs...)));
     }
@@ -186,7 +196,7 @@ struct fix_adaptor_base<F, Result, 0> : F
     BOOST_HOF_INHERIT_CONSTRUCTOR(fix_adaptor_base, F);
 
     template<class... Ts>
-    const F& base_function(Ts&&...) const noexcept
+    BOOST_HOF_INLINE constexpr const F& base_function(Ts&&...) const noexcept
     {
         return *this;
     }
@@ -211,7 +221,7 @@ struct fix_adaptor_base<F, Result, 0> : F
     BOOST_HOF_RETURNS_CLASS(fix_adaptor_base);
 
     template<class... Ts>
-    typename Result::template apply<fix_adaptor_base, Ts...>::type
+    constexpr typename Result::template apply<fix_adaptor_base, Ts...>::type
     operator()(Ts&&... xs) const
     {
         return this->base_function(xs...)(*this, BOOST_HOF_FORWARD(Ts)(xs)...);
@@ -219,23 +229,51 @@ struct fix_adaptor_base<F, Result, 0> : F
 };
 }
 
-template<class F>
-struct fix_adaptor : detail::fix_adaptor_base<F, detail::fix_result<F>, BOOST_HOF_RECURSIVE_CONSTEXPR_DEPTH>
+template<class F, int Depth=BOOST_HOF_RECURSIVE_CONSTEXPR_DEPTH>
+struct fix_adaptor : detail::fix_adaptor_base<F, detail::fix_result<F>, Depth>
 {
     typedef fix_adaptor fit_rewritable1_tag;
-    typedef detail::fix_adaptor_base<F, detail::fix_result<F>, BOOST_HOF_RECURSIVE_CONSTEXPR_DEPTH> base;
+    typedef detail::fix_adaptor_base<F, detail::fix_result<F>, Depth> base;
     BOOST_HOF_INHERIT_CONSTRUCTOR(fix_adaptor, base);
 };
 
-template<class Result, class F>
-struct result_adaptor<Result, fix_adaptor<F>>
-: fix_adaptor<result_adaptor<Result, F>>
+template<class Result, class F, int Depth>
+struct result_adaptor<Result, fix_adaptor<F, Depth>>
+: fix_adaptor<result_adaptor<Result, F>, Depth>
 {
-    typedef fix_adaptor<result_adaptor<Result, F>> base;
+    typedef fix_adaptor<result_adaptor<Result, F>, Depth> base;
     BOOST_HOF_INHERIT_CONSTRUCTOR(result_adaptor, base)
 };
 
-BOOST_HOF_DECLARE_STATIC_VAR(fix, detail::make<fix_adaptor>);
+namespace detail {
+
+template<int Depth>
+struct fix_depth_f
+{
+    constexpr fix_depth_f() noexcept
+    {}
+    template<class F>
+    BOOST_HOF_INLINE constexpr fix_adaptor<F, Depth> operator()(F f) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(fix_adaptor<F, Depth>, F&&)
+    {
+        return fix_adaptor<F, Depth>(static_cast<F&&>(f));
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(fix, detail::fix_depth_f<BOOST_HOF_RECURSIVE_CONSTEXPR_DEPTH>);
+
+#if BOOST_HOF_HAS_VARIABLE_TEMPLATES
+template<int Depth>
+static constexpr detail::fix_depth_f<Depth> fix_depth = {};
+#else
+template<int Depth, class F>
+constexpr fix_adaptor<F, Depth> fix_depth(F f)
+BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(fix_adaptor<F, Depth>, F&&)
+{
+    return fix_adaptor<F, Depth>(boost::hof::move(f));
+}
+#endif
 
 }} // namespace boost::hof
 
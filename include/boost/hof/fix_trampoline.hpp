@@ -0,0 +1,298 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    fix_trampoline.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FUNCTION_FIX_TRAMPOLINE_H
+#define BOOST_HOF_GUARD_FUNCTION_FIX_TRAMPOLINE_H
+
+/// fix_trampoline
+/// ==============
+///
+/// Description
+/// -----------
+///
+/// The `fix_trampoline` function adaptor is a fixed-point combinator, like
+/// [`fix`](fix), that recurses with a constant stack depth. Calling the
+/// self-reference doesn't call the function, instead it returns a
+/// `trampoline` that holds the arguments for the next call. The adaptor then
+/// calls the function in a loop until it returns a value instead of a
+/// `trampoline`. So the recursion depth is only limited by the time it takes,
+/// not by the size of the stack.
+///
+/// Since the call is deferred, the self-reference can only be called in tail
+/// position, that is, the `trampoline` it returns must be returned by the
+/// function. A recursion that uses the result of the recursive call can be
+/// written with an accumulator, or with an explicit stack of the work left
+/// to do, which is passed along as an argument.
+///
+/// The signature `R(Args...)` of the recursion must be given explicitly. The
+/// arguments are stored between the calls by their decayed types, and the
+/// function is called with them as rvalues. The function can return a value
+/// convertible to `R` or the `trampoline<R, std::decay_t<Args>...>` returned
+/// by the self-reference, so both can be returned from the same conditional
+/// expression.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Sig, class F>
+///     fix_trampoline_adaptor<Sig, F> fix_trampoline(F f);
+///
+///     template<class R, class... Ts>
+///     class trampoline;
+///
+/// Semantics
+/// ---------
+///
+///     assert(fix_trampoline<R(Args...)>(f)(xs...) == R(f(self, xs...)));
+///
+/// Where `self(ys...)` returns a `trampoline` that continues with
+/// `f(self, ys...)`.
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// R must be:
+///
+/// * MoveConstructible
+/// * Not `void`
+///
+/// The decayed `Args` must be:
+///
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int main() {
+///         auto sum = boost::hof::fix_trampoline<long long(long long, long long)>(
+///             [](auto self, long long n, long long acc) {
+///                 return n == 0 ? acc : self(n - 1, acc + n);
+///             }
+///         );
+///         assert(sum(1000000, 0) == 500000500000);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [Trampoline](https://en.wikipedia.org/wiki/Trampoline_(computing))
+/// * [fix](fix)
+///
+
+#include <boost/hof/always.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <new>
+#include <tuple>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+struct trampoline_call_tag
+{};
+
+}
+
+template<class R, class... Ts>
+class trampoline
+{
+    typedef std::tuple<Ts...> arguments_type;
+
+    union
+    {
+        R value;
+        arguments_type args;
+    };
+    bool done;
+
+    void construct(trampoline&& rhs)
+    {
+        if (rhs.done) new (&value) R(boost::hof::move(rhs.value));
+        else new (&args) arguments_type(boost::hof::move(rhs.args));
+        done = rhs.done;
+    }
+
+    void construct(const trampoline& rhs)
+    {
+        if (rhs.done) new (&value) R(rhs.value);
+        else new (&args) arguments_type(rhs.args);
+        done = rhs.done;
+    }
+
+    void destroy() noexcept
+    {
+        if (done) value.~R();
+        else args.~arguments_type();
+    }
+public:
+    typedef R result_type;
+
+    template<class X, typename std::enable_if<(
+        std::is_convertible<X, R>::value &&
+        !std::is_same<typename std::decay<X>::type, trampoline>::value
+    ), int>::type = 0>
+    trampoline(X&& x) : done(true)
+    {
+        new (&value) R(BOOST_HOF_FORWARD(X)(x));
+    }
+
+    template<class... Xs>
+    explicit trampoline(detail::trampoline_call_tag, Xs&&... xs) : done(false)
+    {
+        new (&args) arguments_type(BOOST_HOF_FORWARD(Xs)(xs)...);
+    }
+
+    trampoline(trampoline&& rhs)
+    {
+        this->construct(boost::hof::move(rhs));
+    }
+
+    trampoline(const trampoline& rhs)
+    {
+        this->construct(rhs);
+    }
+
+    trampoline& operator=(trampoline&& rhs)
+    {
+        if (this != &rhs)
+        {
+            this->destroy();
+            this->construct(boost::hof::move(rhs));
+        }
+        return *this;
+    }
+
+    trampoline& operator=(const trampoline& rhs)
+    {
+        if (this != &rhs)
+        {
+            this->destroy();
+            this->construct(rhs);
+        }
+        return *this;
+    }
+
+    ~trampoline()
+    {
+        this->destroy();
+    }
+
+    // Returns true when this holds the result instead of the arguments of
+    // the next call
+    bool is_done() const noexcept
+    {
+        return done;
+    }
+
+    R& get() noexcept
+    {
+        return value;
+    }
+
+    arguments_type& arguments() noexcept
+    {
+        return args;
+    }
+};
+
+namespace detail {
+
+template<class R, class... Ts>
+struct trampoline_self
+{
+    template<class... Xs>
+    BOOST_HOF_INLINE trampoline<R, Ts...> operator()(Xs&&... xs) const
+    {
+        static_assert(sizeof...(Xs) == sizeof...(Ts), "The self-reference must be called with the arguments of the signature");
+        return trampoline<R, Ts...>(trampoline_call_tag(), BOOST_HOF_FORWARD(Xs)(xs)...);
+    }
+};
+
+template<class State, class F, class Self, class Tuple, std::size_t... Ns>
+State trampoline_step(const F& f, const Self& self, Tuple& args, seq<Ns...>)
+{
+    return State(f(self, boost::hof::move(std::get<Ns>(args))...));
+}
+
+}
+
+template<class Sig, class F>
+struct fix_trampoline_adaptor;
+
+template<class R, class... Args, class F>
+struct fix_trampoline_adaptor<R(Args...), F> : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(fix_trampoline_adaptor, detail::callable_base<F>)
+
+    typedef R result_type;
+    typedef trampoline<R, typename std::decay<Args>::type...> trampoline_type;
+    typedef detail::trampoline_self<R, typename std::decay<Args>::type...> self_type;
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class... Ts, class=typename std::enable_if<(
+        sizeof...(Ts) == sizeof...(Args) &&
+        boost::hof::is_invocable<detail::callable_base<F>, self_type, typename std::decay<Args>::type...>::value
+    )>::type>
+    R operator()(Ts&&... xs) const
+    {
+        typedef typename detail::gens<sizeof...(Args)>::type indices;
+        self_type self;
+        trampoline_type state(detail::trampoline_call_tag(), BOOST_HOF_FORWARD(Ts)(xs)...);
+        while(!state.is_done())
+        {
+            state = detail::trampoline_step<trampoline_type>(this->base_function(xs...), self, state.arguments(), indices());
+        }
+        return boost::hof::move(state.get());
+    }
+};
+
+#if BOOST_HOF_HAS_VARIABLE_TEMPLATES
+namespace fix_trampoline_detail {
+template<class Sig>
+struct fix_trampoline_f
+{
+    template<class F>
+    BOOST_HOF_INLINE constexpr fix_trampoline_adaptor<Sig, F> operator()(F f) const
+    {
+        return fix_trampoline_adaptor<Sig, F>(boost::hof::move(f));
+    }
+};
+
+}
+
+template<class Sig>
+static constexpr auto fix_trampoline = fix_trampoline_detail::fix_trampoline_f<Sig>{};
+#else
+template<class Sig, class F>
+constexpr fix_trampoline_adaptor<Sig, F> fix_trampoline(F f)
+BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(fix_trampoline_adaptor<Sig, F>, F&&)
+{
+    return fix_trampoline_adaptor<Sig, F>(boost::hof::move(f));
+}
+#endif
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,139 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    fixed_string.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FIXED_STRING_H
+#define BOOST_HOF_GUARD_FIXED_STRING_H
+
+/// fixed_string
+/// ============
+///
+/// Description
+/// -----------
+///
+/// The `fixed_string` class holds a string of `N` characters, where `N` is
+/// known at compile-time, and is built from a string literal in a constant
+/// expression. It can be unpacked with [`unpack`](unpack), which calls the
+/// function with each character, without the null terminator that a string
+/// literal unpacked as an array would have. The `make_fixed_string` function
+/// deduces the size from a string literal, and so does the constructor in
+/// C++17. Since its members are public, a `fixed_string` can also be a
+/// template parameter in C++20.
+///
+/// Synopsis
+/// --------
+///
+///     template<std::size_t N>
+///     struct fixed_string;
+///
+///     template<std::size_t N>
+///     constexpr fixed_string<N-1> make_fixed_string(const char (&s)[N]) noexcept;
+///
+/// Semantics
+/// ---------
+///
+///     assert(unpack(f)(make_fixed_string("ab")) == f('a', 'b'));
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct hash
+///     {
+///         template<class... Ts>
+///         constexpr unsigned operator()(Ts... cs) const
+///         {
+///             return boost::hof::fold(boost::hof::_1 * 31u + boost::hof::_2, 0u)(cs...);
+///         }
+///     };
+///
+///     int main() {
+///         constexpr auto s = boost::hof::make_fixed_string("get");
+///         static_assert(s.size() == 3, "");
+///         assert(boost::hof::unpack(hash())(s) == hash()('g', 'e', 't'));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [unpack](unpack)
+/// * [unpack_sequence](unpack_sequence)
+/// * [static_vector](static_vector)
+///
+
+#include <boost/hof/unpack_sequence.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <boost/hof/detail/unpack_tuple.hpp>
+#include <cstddef>
+
+namespace boost { namespace hof {
+
+template<std::size_t N>
+struct fixed_string
+{
+    char chars[N+1];
+
+    constexpr fixed_string(const char (&s)[N+1]) noexcept
+    : fixed_string(s, typename detail::gens<N>::type())
+    {}
+
+    template<std::size_t... Is>
+    constexpr fixed_string(const char (&s)[N+1], detail::seq<Is...>) noexcept
+    : chars{s[Is]..., '\0'}
+    {}
+
+    static constexpr std::size_t size() noexcept
+    {
+        return N;
+    }
+
+    constexpr const char& operator[](std::size_t i) const noexcept
+    {
+        return chars[i];
+    }
+
+    constexpr const char* data() const noexcept
+    {
+        return chars;
+    }
+
+    constexpr const char* c_str() const noexcept
+    {
+        return chars;
+    }
+
+    constexpr const char* begin() const noexcept
+    {
+        return chars;
+    }
+
+    constexpr const char* end() const noexcept
+    {
+        return chars + N;
+    }
+};
+
+#if BOOST_HOF_HAS_STD_17
+template<std::size_t N>
+fixed_string(const char (&)[N]) -> fixed_string<N-1>;
+#endif
+
+template<std::size_t N>
+constexpr fixed_string<N-1> make_fixed_string(const char (&s)[N]) noexcept
+{
+    return fixed_string<N-1>(s);
+}
+
+template<std::size_t N>
+struct unpack_sequence<fixed_string<N>>
+: detail::unpack_view_apply<N>
+{};
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,131 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    fixed_view.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FIXED_VIEW_H
+#define BOOST_HOF_GUARD_FIXED_VIEW_H
+
+/// fixed_view
+/// ==========
+///
+/// Description
+/// -----------
+///
+/// The `fixed_view` class is a view over `N` contiguous elements, where `N`
+/// is known at compile-time. It can be unpacked with [`unpack`](unpack), which
+/// calls the function with a reference to each element, so a buffer can be
+/// unpacked in place without copying it into a `std::array` first. The
+/// `make_fixed_view` function creates a view from a pointer to the first
+/// element.
+///
+/// Raw arrays, and `std::span` with a static extent when
+/// `BOOST_HOF_HAS_STD_SPAN` is enabled, can be unpacked directly as well.
+///
+/// Synopsis
+/// --------
+///
+///     template<class T, std::size_t N>
+///     class fixed_view;
+///
+///     template<std::size_t N, class T>
+///     constexpr fixed_view<T, N> make_fixed_view(T* p) noexcept;
+///
+/// Semantics
+/// ---------
+///
+///     assert(unpack(f)(make_fixed_view<N>(p)) == f(p[0], ..., p[N-1]));
+///
+/// Requirements
+/// ------------
+///
+/// The pointer must point to at least `N` elements, which must outlive the
+/// view.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct sum
+///     {
+///         template<class... Ts>
+///         int operator()(Ts... xs) const
+///         {
+///             return boost::hof::fold(boost::hof::_ + boost::hof::_, 0)(xs...);
+///         }
+///     };
+///
+///     int main() {
+///         unsigned char frame[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+///         assert(boost::hof::unpack(sum())(boost::hof::make_fixed_view<4>(frame + 2)) == 3 + 4 + 5 + 6);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [unpack](unpack)
+/// * [unpack_sequence](unpack_sequence)
+///
+
+#include <boost/hof/unpack_sequence.hpp>
+#include <boost/hof/detail/unpack_tuple.hpp>
+#include <cstddef>
+
+namespace boost { namespace hof {
+
+template<class T, std::size_t N>
+class fixed_view
+{
+    T* p;
+public:
+    typedef T element_type;
+    typedef T* iterator;
+
+    constexpr explicit fixed_view(T* x) noexcept
+    : p(x)
+    {}
+
+    static constexpr std::size_t size() noexcept
+    {
+        return N;
+    }
+
+    constexpr T* data() const noexcept
+    {
+        return p;
+    }
+
+    constexpr T& operator[](std::size_t i) const noexcept
+    {
+        return p[i];
+    }
+
+    constexpr T* begin() const noexcept
+    {
+        return p;
+    }
+
+    constexpr T* end() const noexcept
+    {
+        return p + N;
+    }
+};
+
+template<std::size_t N, class T>
+constexpr fixed_view<T, N> make_fixed_view(T* p) noexcept
+{
+    return fixed_view<T, N>(p);
+}
+
+template<class T, std::size_t N>
+struct unpack_sequence<fixed_view<T, N>>
+: detail::unpack_view_apply<N>
+{};
+
+}} // namespace boost::hof
+
+#endif
@@ -68,9 +68,9 @@ struct flip_adaptor : detail::callable_base<F>
     BOOST_HOF_INHERIT_CONSTRUCTOR(flip_adaptor, detail::callable_base<F>);
 
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     struct flip_failure
@@ -91,8 +91,8 @@ struct flip_adaptor : detail::callable_base<F>
 
     BOOST_HOF_RETURNS_CLASS(flip_adaptor);
 
-    template<class T, class U, class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(const detail::callable_base<F>&, id_<U>, id_<T>, id_<Ts>...) 
+    template<class T, class U, class... Ts BOOST_HOF_DETAIL_CALL_MARKER(flip, T, U, Ts...)>
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(const detail::callable_base<F>&, id_<U>, id_<T>, id_<Ts>...) 
     operator()(T&& x, U&& y, Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         (BOOST_HOF_MANGLE_CAST(const detail::callable_base<F>&)(BOOST_HOF_CONST_THIS->base_function(xs...)))
@@ -100,6 +100,8 @@ struct flip_adaptor : detail::callable_base<F>
     );
 };
 
+BOOST_HOF_DETAIL_COMPILE_MARKER(flip, flip_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(flip, detail::make<flip_adaptor>);
 
 }} // namespace boost::hof
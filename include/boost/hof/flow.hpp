@@ -19,6 +19,20 @@
 /// similiar to [`compose`](compose.md) except the evaluation order is
 /// reversed. So, `flow(f, g)(0)` is equivalent to `g(f(0))`.
 /// 
+/// When the last function is also a `flow` adaptor, its functions are
+/// added to the result, so `flow(f, flow(g, h))` is the same type as
+/// `flow(f, g, h)`. This is free, since the nested adaptor is already the
+/// tail of the functions. A nested adaptor anywhere else is kept as one
+/// function.
+/// 
+/// When there are at least three functions, and each function returns the
+/// same type it is passed, such as a pipeline of transformations of one
+/// value, the result of each function is assigned to one value instead of
+/// the calls being nested. The result type is then not deduced through each
+/// function, and the calls of a long pipeline can be sibling calls. This
+/// needs relaxed `constexpr`, and is controlled by
+/// `BOOST_HOF_ITERATE_UNIFORM_CHAINS`.
+/// 
 /// 
 /// Synopsis
 /// --------
@@ -80,15 +94,46 @@
 #include <boost/hof/detail/delegate.hpp>
 #include <boost/hof/detail/compressed_pair.hpp>
 #include <boost/hof/detail/join.hpp>
-#include <tuple>
 #include <boost/hof/detail/move.hpp>
-#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/flatten.hpp>
+#include <boost/hof/detail/pass_through.hpp>
 #include <boost/hof/detail/result_type.hpp>
 #include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/detail/uniform_chain.hpp>
+#include <boost/hof/is_invocable.hpp>
 
-namespace boost { namespace hof { namespace detail {
+namespace boost { namespace hof {
 
-template<class F1, class F2>
+template<class F, class... Fs>
+struct flow_adaptor;
+
+namespace detail {
+
+// When the second function is a flow of at least two functions and each
+// function returns the type of the first result, the functions are applied
+// in place to one value, so the calls are not nested and the result type is
+// not deduced through each function
+template<class F1, class F2, class Args>
+struct flow_iterates
+: std::false_type
+{};
+
+#if BOOST_HOF_DETAIL_ITERATE_UNIFORM_CHAINS
+template<class F1, class G1, class G2, class... Gs, class... Ts>
+struct flow_iterates<F1, flow_adaptor<G1, G2, Gs...>, holder<Ts...>>
+: is_iterable_chain<typename chain_call_result<callable_base<F1>, holder<Ts...>>::type, G1, G2, Gs...>
+{};
+
+template<class R, class F>
+struct flow_chain_nothrow;
+
+template<class R, class... Gs>
+struct flow_chain_nothrow<R, flow_adaptor<Gs...>>
+: is_nothrow_chain<R, Gs...>
+{};
+#endif
+
+template<class F1, class F2, class=void>
 struct flow_kernel : detail::compressed_pair<detail::callable_base<F1>, detail::callable_base<F2>>, compose_function_result_type<F2, F1>
 {
     typedef detail::compressed_pair<detail::callable_base<F1>, detail::callable_base<F2>> base_type;
@@ -97,15 +142,64 @@ struct flow_kernel : detail::compressed_pair<detail::callable_base<F1>, detail::
 
     BOOST_HOF_RETURNS_CLASS(flow_kernel);
 
-    template<class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(const detail::callable_base<F2>&, result_of<const detail::callable_base<F1>&, id_<Ts>...>) 
+    template<class... Ts, 
+        class=typename std::enable_if<(!flow_iterates<F1, F2, holder<Ts...>>::value)>::type 
+        BOOST_HOF_DETAIL_CALL_MARKER(flow, Ts...)>
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(const detail::callable_base<F2>&, result_of<const detail::callable_base<F1>&, id_<Ts>...>) 
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         BOOST_HOF_MANGLE_CAST(const detail::callable_base<F2>&)(BOOST_HOF_CONST_THIS->second(xs...))(
             BOOST_HOF_MANGLE_CAST(const detail::callable_base<F1>&)(BOOST_HOF_CONST_THIS->first(xs...))(BOOST_HOF_FORWARD(Ts)(xs)...)
         )
     );
+
+#if BOOST_HOF_DETAIL_ITERATE_UNIFORM_CHAINS
+    // The rest of the chain is applied in place, and each link calls the
+    // next one last, so the calls don't keep a frame for each function
+    template<class... Ts, 
+        class=typename std::enable_if<(flow_iterates<F1, F2, holder<Ts...>>::value)>::type, 
+        class R=typename chain_call_result<detail::callable_base<F1>, holder<Ts...>>::type 
+        BOOST_HOF_DETAIL_CALL_MARKER(flow, Ts...)>
+    BOOST_HOF_INLINE constexpr R operator()(Ts&&... xs) const
+    noexcept(noexcept(R(std::declval<const detail::callable_base<F1>&>()(std::declval<Ts>()...))) && flow_chain_nothrow<R, F2>::value)
+    {
+        R r = this->first(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...);
+        this->second(xs...).flow_apply(r);
+        return r;
+    }
+#endif
+};
+
+// When the first function declares its result type, the return type is
+// known without deducing the return type of each function in the chain, so
+// only the first function is checked for the arguments
+template<class F1, class F2>
+struct flow_kernel<F1, F2, typename holder<
+    decltype(std::declval<const detail::callable_base<F2>&>()(std::declval<typename F1::result_type>()))
+>::type>
+: detail::compressed_pair<detail::callable_base<F1>, detail::callable_base<F2>>
+{
+    typedef detail::compressed_pair<detail::callable_base<F1>, detail::callable_base<F2>> base_type;
+    typedef decltype(std::declval<const detail::callable_base<F2>&>()(std::declval<typename F1::result_type>())) result_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(flow_kernel, base_type)
+
+    template<class... Ts, class=typename std::enable_if<(boost::hof::is_invocable<const detail::callable_base<F1>&, Ts...>::value)>::type>
+    BOOST_HOF_INLINE constexpr result_type operator()(Ts&&... xs) const
+    {
+        return this->second(xs...)(this->first(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...));
+    }
 };
+
+// The result of the first function is returned as it is, instead of a
+// reference to it
+template<class F1, class F2>
+struct flow_kernel_type
+: std::conditional<is_pass_through<F2>::value, 
+    pass_through_kernel<detail::callable_base<F1>, detail::callable_base<F2>, true>, 
+    flow_kernel<F1, F2>
+>
+{};
 }
 
 template<class F, class... Fs>
@@ -133,6 +227,15 @@ struct flow_adaptor : detail::flow_kernel<F, BOOST_HOF_JOIN(flow_adaptor, Fs...)
     BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(base_type, X&&)
     : base_type(BOOST_HOF_FORWARD(X)(f1))
     {}
+
+#if BOOST_HOF_DETAIL_ITERATE_UNIFORM_CHAINS
+    template<class R>
+    BOOST_HOF_INLINE constexpr void flow_apply(R& r) const
+    {
+        r = this->first(r)(static_cast<R&&>(r));
+        this->second(r).flow_apply(r);
+    }
+#endif
 };
 
 template<class F>
@@ -151,15 +254,26 @@ struct flow_adaptor<F> : detail::callable_base<F>
 
 template<class F1, class F2>
 struct flow_adaptor<F1, F2>
-: detail::flow_kernel<detail::callable_base<F1>, detail::callable_base<F2>>
+: detail::flow_kernel_type<detail::callable_base<F1>, detail::callable_base<F2>>::type
 {
     typedef flow_adaptor fit_rewritable_tag;
-    typedef detail::flow_kernel<detail::callable_base<F1>, detail::callable_base<F2>> base_type;
+    typedef typename detail::flow_kernel_type<detail::callable_base<F1>, detail::callable_base<F2>>::type base_type;
 
     BOOST_HOF_INHERIT_CONSTRUCTOR(flow_adaptor, base_type)
+
+#if BOOST_HOF_DETAIL_ITERATE_UNIFORM_CHAINS
+    template<class R>
+    BOOST_HOF_INLINE constexpr void flow_apply(R& r) const
+    {
+        r = this->first(r)(static_cast<R&&>(r));
+        r = this->second(r)(static_cast<R&&>(r));
+    }
+#endif
 };
 
-BOOST_HOF_DECLARE_STATIC_VAR(flow, detail::make<flow_adaptor>);
+BOOST_HOF_DETAIL_COMPILE_MARKER(flow, flow_adaptor)
+
+BOOST_HOF_DECLARE_STATIC_VAR(flow, detail::make_flatten<flow_adaptor>);
 
 }} // namespace boost::hof
 
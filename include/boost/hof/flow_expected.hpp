@@ -0,0 +1,139 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    flow_expected.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FLOW_EXPECTED_H
+#define BOOST_HOF_GUARD_FLOW_EXPECTED_H
+
+/// flow_expected
+/// =============
+///
+/// Description
+/// -----------
+///
+/// The `flow_expected` function adaptor works like [`flow`](flow), except
+/// each stage returns an optional-like value, such as `std::optional` or
+/// `std::expected`, and the next stage is called with the value inside it,
+/// like chaining `and_then`. When a stage returns no value, the rest of the
+/// stages are skipped and the failure is returned, so there is one branch
+/// for each stage and no exceptions are needed.
+///
+/// The failure is converted to the result type of the last stage. When it
+/// is already that type, it is returned as it is. Otherwise, when the result
+/// has an `unexpected_type`, as `std::expected` does, the `error()` is moved
+/// into it, and for anything else, such as a `std::optional`, the result is
+/// default constructed. The branch is marked as likely to have a value, and
+/// the conversion of the failure is a [cold](cold) function, so the error
+/// path is kept out of the hot code.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Fs>
+///     constexpr flow_expected_adaptor<Fs...> flow_expected(Fs... fs);
+///
+/// Semantics
+/// ---------
+///
+///     assert(flow_expected(f, g)(xs...) == (f(xs...) ? g(*f(xs...)) : decltype(g(*f(xs...)))()));
+///
+/// Requirements
+/// ------------
+///
+/// Fs must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// The result of each stage but the last must be contextually convertible
+/// to `bool`, and have the value with `operator*`.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <optional>
+///     #include <string>
+///
+///     struct parse
+///     {
+///         std::optional<int> operator()(const std::string& s) const
+///         {
+///             if (s.empty() || s[0] < '0' || s[0] > '9') return std::nullopt;
+///             return s[0] - '0';
+///         }
+///     };
+///
+///     struct halve
+///     {
+///         std::optional<int> operator()(int x) const
+///         {
+///             if (x % 2 != 0) return std::nullopt;
+///             return x / 2;
+///         }
+///     };
+///
+///     int main() {
+///         auto f = boost::hof::flow_expected(parse(), halve());
+///         assert(*f("8") == 4);
+///         assert(!f("7"));
+///         assert(!f("x"));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [flow](flow)
+/// * [compose_optional](compose_optional)
+/// * [cold](cold)
+///
+
+#include <boost/hof/detail/and_then_kernel.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/join.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+
+namespace boost { namespace hof {
+
+template<class F, class... Fs>
+struct flow_expected_adaptor : detail::and_then_kernel<F, BOOST_HOF_JOIN(flow_expected_adaptor, Fs...)>
+{
+    typedef BOOST_HOF_JOIN(flow_expected_adaptor, Fs...) tail;
+    typedef detail::and_then_kernel<F, tail> base_type;
+
+    BOOST_HOF_INHERIT_DEFAULT(flow_expected_adaptor, base_type)
+
+    template<class X, class... Xs,
+        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(detail::callable_base<F>, X),
+        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(tail, Xs...)
+    >
+    constexpr flow_expected_adaptor(X&& f1, Xs&& ... fs)
+    BOOST_HOF_NOEXCEPT(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(base_type, X&&, tail) && BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(tail, Xs&&...))
+    : base_type(BOOST_HOF_FORWARD(X)(f1), tail(BOOST_HOF_FORWARD(Xs)(fs)...))
+    {}
+};
+
+template<class F>
+struct flow_expected_adaptor<F> : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_DEFAULT(flow_expected_adaptor, detail::callable_base<F>)
+
+    template<class X, BOOST_HOF_ENABLE_IF_CONVERTIBLE(X, detail::callable_base<F>)>
+    constexpr flow_expected_adaptor(X&& f1)
+    BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(detail::callable_base<F>, X&&)
+    : detail::callable_base<F>(BOOST_HOF_FORWARD(X)(f1))
+    {}
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(flow_expected, detail::make<flow_expected_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
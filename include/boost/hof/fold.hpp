@@ -23,6 +23,16 @@
 /// The arguments to the binary function, take first the state and then the
 /// argument.
 /// 
+/// When all of the arguments and the state are unsigned integers of the
+/// same type, and the function is marked with
+/// [`is_associative`](is_associative), such as `_ + _` or `std::plus<>`,
+/// the arguments are reduced in a balanced tree, like
+/// [`tree_fold`](tree_fold), since the result is the same. Instead of each
+/// call depending on the previous one, the independent partial results can
+/// be computed in parallel by the processor. Signed integers are only
+/// reduced in a tree by the bitwise operators, such as `_ | _`, since a sum
+/// or a product can overflow in one grouping and not in another.
+/// 
 /// Synopsis
 /// --------
 /// 
@@ -75,6 +85,7 @@
 /// 
 /// * [Fold](https://en.wikipedia.org/wiki/Fold_(higher-order_function))
 /// * [Variadic sum](<Variadic sum>)
+/// * [is_associative](is_associative)
 /// 
 
 #include <boost/hof/detail/callable_base.hpp>
@@ -83,21 +94,64 @@
 #include <boost/hof/detail/move.hpp>
 #include <boost/hof/detail/make.hpp>
 #include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/detail/and.hpp>
+#include <boost/hof/is_associative.hpp>
+#include <boost/hof/tree_fold.hpp>
 
 namespace boost { namespace hof { namespace detail {
 
+// Reducing the arguments in a tree breaks the dependency of each call on
+// the previous one, so the calls can be done in parallel by the processor.
+// This is only done when the result is the same, which is for associative
+// functions of integers that return the same type. A signed sum can
+// overflow in one grouping and not in another, so the signed integers are
+// only regrouped when the function can't overflow, such as `_ | _`.
+template<class F, class T, class... Ts>
+struct is_fold_reassociable
+: std::integral_constant<bool, (
+    sizeof...(Ts) >= 3 &&
+    is_associative<F>::value &&
+    std::is_integral<typename std::decay<T>::type>::value &&
+    (std::is_unsigned<typename std::decay<T>::type>::value || is_overflow_free<F>::value) &&
+    BOOST_HOF_AND_UNPACK((std::is_same<typename std::decay<T>::type, typename std::decay<Ts>::type>::value))
+)>
+{};
+
+template<class F, class T>
+struct is_fold_reassociable_result
+: std::is_same<typename std::decay<T>::type, decltype(std::declval<const F&>()(std::declval<T>(), std::declval<T>()))>
+{};
+
+template<class F, class T, class... Ts>
+struct fold_reassociates
+: std::integral_constant<bool, (
+    is_fold_reassociable<F, T, Ts...>::value &&
+    std::conditional<is_fold_reassociable<F, T, Ts...>::value, is_fold_reassociable_result<F, T>, std::false_type>::type::value
+)>
+{};
+
 struct v_fold
 {
     BOOST_HOF_RETURNS_CLASS(v_fold);
-    template<class F, class State, class T, class... Ts>
-    constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(const v_fold&, id_<const F&>, result_of<const F&, id_<State>, id_<T>>, id_<Ts>...)
+    template<class F, class State, class T, class... Ts, typename std::enable_if<(
+        detail::fold_reassociates<F, State, T, Ts...>::value
+    ), int>::type = 0>
+    BOOST_HOF_INLINE constexpr auto operator()(const F& f, State&& state, T&& x, Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        detail::v_tree_fold()(f, BOOST_HOF_FORWARD(State)(state), BOOST_HOF_FORWARD(T)(x), BOOST_HOF_FORWARD(Ts)(xs)...)
+    );
+
+    template<class F, class State, class T, class... Ts, typename std::enable_if<(
+        !detail::fold_reassociates<F, State, T, Ts...>::value
+    ), int>::type = 0>
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(const v_fold&, id_<const F&>, result_of<const F&, id_<State>, id_<T>>, id_<Ts>...)
     operator()(const F& f, State&& state, T&& x, Ts&&... xs) const BOOST_HOF_SFINAE_MANUAL_RETURNS
     (
         (*BOOST_HOF_CONST_THIS)(f, f(BOOST_HOF_FORWARD(State)(state), BOOST_HOF_FORWARD(T)(x)), BOOST_HOF_FORWARD(Ts)(xs)...)
     );
 
     template<class F, class State>
-    constexpr State operator()(const F&, State&& state) const noexcept
+    BOOST_HOF_INLINE constexpr State operator()(const F&, State&& state) const noexcept
     {
         return BOOST_HOF_FORWARD(State)(state);
     }
@@ -113,7 +167,7 @@ struct fold_adaptor
     BOOST_HOF_INHERIT_CONSTRUCTOR(fold_adaptor, base_type)
 
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
     {
         return this->first(xs...);
     }
@@ -126,8 +180,8 @@ struct fold_adaptor
 
     BOOST_HOF_RETURNS_CLASS(fold_adaptor);
 
-    template<class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(detail::v_fold, id_<const detail::callable_base<F>&>, id_<State>, id_<Ts>...)
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(fold, Ts...)>
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(detail::v_fold, id_<const detail::callable_base<F>&>, id_<State>, id_<Ts>...)
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         detail::v_fold()(
@@ -146,15 +200,15 @@ struct fold_adaptor<F, void>
     BOOST_HOF_INHERIT_CONSTRUCTOR(fold_adaptor, detail::callable_base<F>)
 
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     BOOST_HOF_RETURNS_CLASS(fold_adaptor);
 
-    template<class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(detail::v_fold, id_<const detail::callable_base<F>&>, id_<Ts>...)
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(fold, Ts...)>
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(detail::v_fold, id_<const detail::callable_base<F>&>, id_<Ts>...)
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         detail::v_fold()(
@@ -164,6 +218,8 @@ struct fold_adaptor<F, void>
     )
 };
 
+BOOST_HOF_DETAIL_COMPILE_MARKER(fold, fold_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(fold, detail::make<fold_adaptor>);
 
 }} // namespace boost::hof
@@ -0,0 +1,116 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    fold_into.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FOLD_INTO_H
+#define BOOST_HOF_GUARD_FOLD_INTO_H
+
+/// fold_into
+/// =========
+///
+/// Description
+/// -----------
+///
+/// The `fold_into` function consumes a range or a view, such as the ones
+/// returned by [`map`](map) and [`filter`](filter), by calling a binary
+/// function with the state and each element, in order, starting with the
+/// initial state. Like [`fold`](fold), the binary function takes first the
+/// state and then the element, and it returns the new state.
+///
+/// All the stages of the pipeline are evaluated in a single loop over the
+/// range, so no intermediate container is created, and the loop can be
+/// vectorized by the optimizer when the stages are simple enough.
+///
+/// The function is [pipable](pipable), so the range can be piped into it.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Range, class F, class State>
+///     constexpr State fold_into(Range&& r, F f, State init);
+///
+/// Semantics
+/// ---------
+///
+///     assert(fold_into(r, f, init) == std::accumulate(r.begin(), r.end(), init, f));
+///
+/// Requirements
+/// ------------
+///
+/// Range must be:
+///
+/// * A range that can be iterated with a range-based `for` loop, or a view
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// State must be:
+///
+/// * MoveConstructible
+/// * MoveAssignable
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <vector>
+///
+///     int main() {
+///         std::vector<int> v = { 1, 2, 3, 4 };
+///         int r = v | boost::hof::map(boost::hof::_1 * boost::hof::_1) | boost::hof::filter(boost::hof::_ > 1) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0);
+///         assert(r == 29);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [map](map)
+/// * [filter](filter)
+/// * [fold](fold)
+/// * [pipable](pipable)
+///
+
+#include <boost/hof/pipable.hpp>
+#include <boost/hof/detail/range_view.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class F, class State>
+struct fold_into_sink
+{
+    const F& f;
+    State& state;
+
+    template<class X>
+    BOOST_HOF_INLINE void operator()(X&& x) const
+    {
+        state = f(static_cast<State&&>(state), BOOST_HOF_FORWARD(X)(x));
+    }
+};
+
+struct fold_into_f
+{
+    template<class Range, class F, class State>
+    State operator()(Range&& r, F f, State init) const
+    {
+        detail::range_for_each(r, fold_into_sink<F, State>{f, init});
+        return init;
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(fold_into, pipable_adaptor<detail::fold_into_f>);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,436 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    format_to.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FORMAT_TO_H
+#define BOOST_HOF_GUARD_FORMAT_TO_H
+
+/// format_to
+/// =========
+///
+/// Description
+/// -----------
+///
+/// The `format_to` function returns a function that writes its arguments as
+/// text to the front of a buffer, one after the other, and returns the number
+/// of characters of the text. Nothing is allocated or flushed, so it can be
+/// used to dump large structures for diagnostics. When the text doesn't fit,
+/// it is cut off at the end of the buffer, and the returned number is larger
+/// than the size of the buffer. No null terminator is written.
+///
+/// Each argument is written depending on its type:
+///
+/// * Integers, floating point numbers and enums are written with
+///   `std::to_chars` when it is available. Floating point numbers are
+///   written with `snprintf` when `std::to_chars` doesn't support them.
+/// * A `bool` is written as `true` or `false`, and a `char` as itself.
+/// * Strings, such as a `const char*`, a `char` array, `std::string` or
+///   `std::string_view`, are written as they are.
+/// * Ranges are written as `[x, y, z]`, with each element written
+///   recursively.
+/// * Sequences that can be unpacked with [`unpack`](unpack), such as a
+///   `std::tuple`, or an aggregate in C++17, are written as `{x, y, z}`,
+///   with each element written recursively.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Buffer>
+///     formatter<Buffer> format_to(Buffer&& b);
+///
+/// Requirements
+/// ------------
+///
+/// Buffer must have:
+///
+/// * A `data()` member function that returns a `char*`
+/// * A `size()` member function that returns the number of characters
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <array>
+///     #include <cassert>
+///     #include <string>
+///     #include <tuple>
+///     #include <vector>
+///
+///     int main() {
+///         std::array<char, 64> buffer;
+///         std::vector<int> v = { 1, 2, 3 };
+///         std::size_t n = boost::hof::format_to(buffer)("v = ", v, ", t = ", std::make_tuple(4, 'x'));
+///         assert(std::string(buffer.data(), n) == "v = [1, 2, 3], t = {4, x}");
+///     }
+///
+/// References
+/// ----------
+///
+/// * [unpack](unpack)
+/// * [Print function](<Print function>)
+///
+
+#include <boost/hof/is_unpackable.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#if BOOST_HOF_HAS_STD_CHARCONV
+#include <charconv>
+#endif
+
+#if BOOST_HOF_HAS_STD_CHARCONV && defined(__cpp_lib_to_chars)
+#define BOOST_HOF_DETAIL_FORMAT_FLOAT_TO_CHARS 1
+#else
+#define BOOST_HOF_DETAIL_FORMAT_FLOAT_TO_CHARS 0
+#endif
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+// Keeps the part of the buffer that is left, and counts all the characters
+// even after the buffer is full
+struct format_sink
+{
+    char* first;
+    char* last;
+    std::size_t count;
+
+    void write(const char* s, std::size_t n) noexcept
+    {
+        std::size_t left = static_cast<std::size_t>(last - first);
+        std::size_t m = n < left ? n : left;
+        if (m > 0) std::memcpy(first, s, m);
+        first += m;
+        count += n;
+    }
+
+    void put(char c) noexcept
+    {
+        if (first != last) *first++ = c;
+        count++;
+    }
+};
+
+// Large enough for any integer, or a floating point number with the digits
+// to read it back
+static constexpr std::size_t format_number_size = 64;
+
+#if BOOST_HOF_HAS_STD_CHARCONV
+template<class T>
+void format_chars(format_sink& s, T x) noexcept
+{
+    // Most numbers fit in what is left of the buffer, so they are written in
+    // place, and they are only written to the stack around the end of it
+    std::to_chars_result r = std::to_chars(s.first, s.last, x);
+    if (r.ec == std::errc())
+    {
+        s.count += static_cast<std::size_t>(r.ptr - s.first);
+        s.first = r.ptr;
+        return;
+    }
+    char buffer[format_number_size];
+    r = std::to_chars(buffer, buffer + format_number_size, x);
+    s.write(buffer, static_cast<std::size_t>(r.ptr - buffer));
+}
+
+template<class T>
+void format_integer(format_sink& s, T x) noexcept
+{
+    detail::format_chars(s, x);
+}
+#else
+template<class T>
+void format_integer(format_sink& s, T x) noexcept
+{
+    char buffer[format_number_size];
+    char* p = buffer + format_number_size;
+    // The digits of a negative number are found from the negative value, so
+    // the smallest value doesn't overflow
+    bool negative = x < 0;
+    do
+    {
+        int d = static_cast<int>(x % 10);
+        *--p = static_cast<char>('0' + (d < 0 ? -d : d));
+        x /= 10;
+    } while (x != 0);
+    if (negative) *--p = '-';
+    s.write(p, static_cast<std::size_t>(buffer + format_number_size - p));
+}
+#endif
+
+#if BOOST_HOF_DETAIL_FORMAT_FLOAT_TO_CHARS
+template<class T>
+void format_floating(format_sink& s, T x) noexcept
+{
+    detail::format_chars(s, x);
+}
+#else
+inline void format_floating(format_sink& s, long double x) noexcept
+{
+    char buffer[format_number_size];
+    int n = std::snprintf(buffer, format_number_size, "%.*Lg", std::numeric_limits<long double>::max_digits10, x);
+    if (n > 0) s.write(buffer, static_cast<std::size_t>(n) < format_number_size ? static_cast<std::size_t>(n) : format_number_size - 1);
+}
+
+inline void format_floating(format_sink& s, double x) noexcept
+{
+    char buffer[format_number_size];
+    int n = std::snprintf(buffer, format_number_size, "%.*g", std::numeric_limits<double>::max_digits10, x);
+    if (n > 0) s.write(buffer, static_cast<std::size_t>(n) < format_number_size ? static_cast<std::size_t>(n) : format_number_size - 1);
+}
+
+inline void format_floating(format_sink& s, float x) noexcept
+{
+    char buffer[format_number_size];
+    int n = std::snprintf(buffer, format_number_size, "%.*g", std::numeric_limits<float>::max_digits10, static_cast<double>(x));
+    if (n > 0) s.write(buffer, static_cast<std::size_t>(n) < format_number_size ? static_cast<std::size_t>(n) : format_number_size - 1);
+}
+#endif
+
+namespace format_adl {
+
+using std::begin;
+using std::end;
+
+template<class R>
+auto adl_begin(const R& r) BOOST_HOF_RETURNS(begin(r));
+template<class R>
+auto adl_end(const R& r) BOOST_HOF_RETURNS(end(r));
+
+}
+
+// What an argument is written as, where the first matching kind is used
+template<int N>
+struct format_kind
+: std::integral_constant<int, N>
+{};
+
+typedef format_kind<0> format_number;
+typedef format_kind<1> format_string;
+typedef format_kind<2> format_range;
+typedef format_kind<3> format_sequence;
+typedef format_kind<4> format_none;
+
+template<class T, class=void>
+struct is_format_string
+: std::false_type
+{};
+
+template<class T>
+struct is_format_string<T, typename std::enable_if<(
+    std::is_same<typename T::traits_type::char_type, char>::value &&
+    std::is_convertible<decltype(std::declval<const T&>().data()), const char*>::value &&
+    std::is_convertible<decltype(std::declval<const T&>().size()), std::size_t>::value
+)>::type>
+: std::true_type
+{};
+
+template<class T, class=void>
+struct is_format_range
+: std::false_type
+{};
+
+template<class T>
+struct is_format_range<T, typename holder<
+    decltype(format_adl::adl_begin(std::declval<const T&>()) != format_adl::adl_end(std::declval<const T&>())),
+    decltype(*format_adl::adl_begin(std::declval<const T&>()))
+>::type>
+: std::true_type
+{};
+
+template<class T>
+struct format_kind_of
+: std::conditional<(std::is_arithmetic<T>::value || std::is_enum<T>::value), format_number,
+    typename std::conditional<is_format_string<T>::value, format_string,
+        typename std::conditional<is_format_range<T>::value, format_range,
+            typename std::conditional<is_unpackable<T>::value, format_sequence,
+                format_none
+            >::type
+        >::type
+    >::type
+>::type
+{};
+
+template<class T>
+struct is_formattable
+: std::integral_constant<bool, (format_kind_of<T>::value != format_none::value)>
+{};
+
+// The array is part of the argument, so only its characters up to the
+// first null character are written
+template<std::size_t N>
+struct is_formattable<char[N]>
+: std::true_type
+{};
+
+template<>
+struct is_formattable<const char*>
+: std::true_type
+{};
+
+template<>
+struct is_formattable<char*>
+: std::true_type
+{};
+
+struct format_value_f;
+
+struct format_elements
+{
+    const format_value_f& f;
+    format_sink& s;
+
+    template<class... Ts>
+    void operator()(const Ts&... xs) const;
+};
+
+struct format_value_f
+{
+    void operator()(format_sink& s, bool x) const noexcept
+    {
+        if (x) s.write("true", 4);
+        else s.write("false", 5);
+    }
+
+    void operator()(format_sink& s, char x) const noexcept
+    {
+        s.put(x);
+    }
+
+    void operator()(format_sink& s, const char* x) const noexcept
+    {
+        if (x != nullptr) s.write(x, std::strlen(x));
+    }
+
+    template<std::size_t N>
+    void operator()(format_sink& s, const char (&x)[N]) const noexcept
+    {
+        const void* end = std::memchr(x, 0, N);
+        s.write(x, end == nullptr ? N : static_cast<std::size_t>(static_cast<const char*>(end) - x));
+    }
+
+    template<class T, typename std::enable_if<(
+        std::is_integral<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value
+    ), int>::type = 0>
+    void operator()(format_sink& s, T x) const noexcept
+    {
+        typedef typename std::conditional<std::is_signed<T>::value, long long, unsigned long long>::type integer;
+        detail::format_integer(s, static_cast<integer>(x));
+    }
+
+    template<class T, typename std::enable_if<(std::is_floating_point<T>::value), int>::type = 0>
+    void operator()(format_sink& s, T x) const noexcept
+    {
+        detail::format_floating(s, x);
+    }
+
+    template<class T, typename std::enable_if<(std::is_enum<T>::value), int>::type = 0>
+    void operator()(format_sink& s, T x) const noexcept
+    {
+        (*this)(s, static_cast<typename std::underlying_type<T>::type>(x));
+    }
+
+    template<class T, typename std::enable_if<(
+        format_kind_of<T>::value == format_string::value && !std::is_array<T>::value
+    ), int>::type = 0>
+    void operator()(format_sink& s, const T& x) const noexcept
+    {
+        s.write(x.data(), static_cast<std::size_t>(x.size()));
+    }
+
+    template<class T, typename std::enable_if<(
+        format_kind_of<T>::value == format_range::value && !std::is_array<T>::value
+    ), int>::type = 0>
+    void operator()(format_sink& s, const T& x) const
+    {
+        s.put('[');
+        bool first = true;
+        for (const auto& y:x)
+        {
+            if (!first) s.write(", ", 2);
+            first = false;
+            (*this)(s, y);
+        }
+        s.put(']');
+    }
+
+    // Arrays of anything other than characters are ranges
+    template<class T, std::size_t N, typename std::enable_if<(!std::is_same<T, char>::value), int>::type = 0>
+    void operator()(format_sink& s, const T (&x)[N]) const
+    {
+        s.put('[');
+        for (std::size_t i = 0; i < N; i++)
+        {
+            if (i > 0) s.write(", ", 2);
+            (*this)(s, x[i]);
+        }
+        s.put(']');
+    }
+
+    template<class T, typename std::enable_if<(
+        format_kind_of<T>::value == format_sequence::value
+    ), int>::type = 0>
+    void operator()(format_sink& s, const T& x) const
+    {
+        s.put('{');
+        boost::hof::unpack(format_elements{*this, s})(x);
+        s.put('}');
+    }
+};
+
+template<class... Ts>
+void format_elements::operator()(const Ts&... xs) const
+{
+    std::size_t i = 0;
+    (void)std::initializer_list<int>{((i++ > 0 ? s.write(", ", 2) : void()), f(s, xs), 0)...};
+}
+
+}
+
+template<class Buffer>
+struct formatter
+{
+    Buffer buffer;
+
+    template<class... Ts, typename std::enable_if<(
+        BOOST_HOF_AND_UNPACK(detail::is_formattable<typename std::decay<Ts>::type>::value || std::is_array<Ts>::value)
+    ), int>::type = 0>
+    std::size_t operator()(const Ts&... xs) const
+    {
+        char* first = buffer.data();
+        detail::format_sink s = { first, first + buffer.size(), 0 };
+        (void)std::initializer_list<int>{(detail::format_value_f()(s, xs), 0)...};
+        return s.count;
+    }
+};
+
+namespace detail {
+
+struct format_to_f
+{
+    template<class Buffer>
+    formatter<Buffer> operator()(Buffer&& b) const
+    {
+        return formatter<Buffer>{BOOST_HOF_FORWARD(Buffer)(b)};
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(format_to, detail::format_to_f);
+
+}} // namespace boost::hof
+
+#endif
@@ -30,7 +30,12 @@
 /// is always default constructed regardless of the expression.
 /// 
 /// By default, all functions defined with `BOOST_HOF_STATIC_FUNCTION` use the
-/// [`boost::hof::reveal`](/include/boost/hof/reveal) adaptor to improve error messages.
+/// [`boost::hof::reveal`](/include/boost/hof/reveal) adaptor to improve error
+/// messages. Since this slows down compilation, it can be disabled by
+/// defining `BOOST_HOF_REVEAL_STATIC_FUNCTIONS` to 0, and then the type of
+/// the function is the type of the expression instead of a `reveal_adaptor`.
+/// Code that names the type as a `reveal_adaptor`, or that relies on its
+/// error messages, must then use `boost::hof::reveal` explicitly.
 /// 
 /// Example
 /// -------
@@ -70,13 +75,13 @@ struct reveal_static_const_factory
     constexpr reveal_static_const_factory()
     {}
     template<class F>
-    constexpr reveal_adaptor<F> operator=(const F& f) const
+    constexpr typename reveal_static<F>::type operator=(const F& f) const
     {
 #if BOOST_HOF_HAS_INLINE_VARIABLES
 #else
         static_assert(BOOST_HOF_IS_DEFAULT_CONSTRUCTIBLE(F), "Static functions must be default constructible");
 #endif
-        return reveal_adaptor<F>(f);
+        return typename reveal_static<F>::type(f);
     }
 };
 }}} // namespace boost::hof
@@ -0,0 +1,154 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    function_ref.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FUNCTION_REF_H
+#define BOOST_HOF_GUARD_FUNCTION_REF_H
+
+/// function_ref
+/// ============
+///
+/// Description
+/// -----------
+///
+/// The `function_ref` class is a non-owning reference to a function object
+/// that can be called with the signature `Sig`. It holds only a pointer to
+/// the function object and a pointer to a function that calls it, so it
+/// never allocates. This can be used to pass the function objects produced
+/// by the adaptors, whose types are all different, through an interface
+/// with a single type.
+///
+/// The function object is called as the same const-qualified lvalue it was
+/// referred to with. The function object must outlive the `function_ref`,
+/// except for function pointers, which are stored by value.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Sig>
+///     class function_ref;
+///
+///     template<class R, class... Args>
+///     class function_ref<R(Args...)>
+///     {
+///         template<class F>
+///         function_ref(F&& f) noexcept;
+///
+///         R operator()(Args... xs) const;
+///     };
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * Callable with `Args...`, and the result convertible to `R`, unless `R`
+///   is void
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int apply_twice(boost::hof::function_ref<int(int)> f, int x)
+///     {
+///         return f(f(x));
+///     }
+///
+///     int main() {
+///         auto increment = boost::hof::_ + 1;
+///         assert(apply_twice(increment, 1) == 3);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [inplace_function](inplace_function)
+/// * [indirect](indirect)
+///
+
+#include <boost/hof/detail/erased_call.hpp>
+#include <memory>
+
+namespace boost { namespace hof {
+
+template<class Sig>
+class function_ref;
+
+template<class R, class... Args>
+class function_ref<R(Args...)>
+{
+    // Function pointers can't be stored in a void pointer portably
+    union storage
+    {
+        const void* object;
+        void (*function)();
+    };
+
+    storage s;
+    R (*invoke)(storage, Args&&...);
+
+    template<class F>
+    static R invoke_object(storage x, Args&&... xs)
+    {
+        return detail::erased_invoke<R>::call(*static_cast<F*>(const_cast<void*>(x.object)), BOOST_HOF_FORWARD(Args)(xs)...);
+    }
+
+    template<class F>
+    static R invoke_function(storage x, Args&&... xs)
+    {
+        return detail::erased_invoke<R>::call(reinterpret_cast<F*>(x.function), BOOST_HOF_FORWARD(Args)(xs)...);
+    }
+
+    template<class F>
+    struct function_of
+    : std::remove_pointer<typename std::remove_cv<F>::type>
+    {};
+
+    template<class F>
+    struct is_function_pointer
+    : std::integral_constant<bool, (
+        std::is_function<F>::value || std::is_function<typename function_of<F>::type>::value
+    )>
+    {};
+
+    template<class F>
+    void assign(F& f, std::false_type) noexcept
+    {
+        s.object = std::addressof(f);
+        invoke = &function_ref::invoke_object<F>;
+    }
+
+    // Function pointers are stored by value, so a function_ref can be made
+    // from a temporary pointer
+    template<class F>
+    void assign(F& f, std::true_type) noexcept
+    {
+        typedef typename function_of<F>::type* pointer;
+        s.function = reinterpret_cast<void(*)()>(static_cast<pointer>(f));
+        invoke = &function_ref::invoke_function<typename function_of<F>::type>;
+    }
+public:
+    template<class F, typename std::enable_if<(
+        !std::is_same<typename std::decay<F>::type, function_ref>::value &&
+        detail::is_erased_callable<typename std::remove_reference<F>::type&, R(Args...)>::value
+    ), int>::type = 0>
+    function_ref(F&& f) noexcept
+    {
+        typedef typename std::remove_reference<F>::type type;
+        this->assign(f, is_function_pointer<type>());
+    }
+
+    BOOST_HOF_INLINE R operator()(Args... xs) const
+    {
+        return invoke(s, BOOST_HOF_FORWARD(Args)(xs)...);
+    }
+};
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,364 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    fuse.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FUSE_H
+#define BOOST_HOF_GUARD_FUSE_H
+
+/// fuse
+/// ====
+///
+/// Description
+/// -----------
+///
+/// The `elementwise` function adaptor applies a function to each element of
+/// an object, such as a container or a string, and returns the object with
+/// the results. The object is taken by value, so an rvalue is changed in
+/// place, and each element is replaced with the result of calling the
+/// function with the element.
+///
+/// The `fuse` function adaptor evaluates a [`flow`](flow) like the flow
+/// does, except each run of stages that are element-wise is evaluated in a
+/// single pass over the object, calling the functions of the stages one
+/// after the other for each element. So the object is only read and written
+/// once for the run, instead of once for each stage, and no intermediate
+/// object is created between the stages.
+///
+/// A stage is element-wise when `is_elementwise` is true for it, which is
+/// the case for `elementwise`. It can be specialized for other stages, which
+/// must then provide an `element_function()` member function that returns
+/// the function that is applied to each element.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F>
+///     constexpr elementwise_adaptor<F> elementwise(F f);
+///
+///     template<class... Fs>
+///     constexpr fuse_adaptor<flow_adaptor<Fs...>> fuse(flow_adaptor<Fs...> f);
+///
+///     template<class F>
+///     struct is_elementwise;
+///
+/// Semantics
+/// ---------
+///
+///     assert(elementwise(f)(x) == transform of each element of x with f);
+///     assert(fuse(flow(fs...))(xs...) == flow(fs...)(xs...));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [UnaryInvocable](UnaryInvocable) with an element
+/// * MoveConstructible
+///
+/// The object must be a range with mutable elements, that can be iterated
+/// with a range-based `for` loop, and the result of the function must be
+/// assignable to the element.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <string>
+///     #include <vector>
+///
+///     int main() {
+///         auto f = boost::hof::fuse(boost::hof::flow(
+///             boost::hof::elementwise(boost::hof::_ + 1),
+///             boost::hof::elementwise(boost::hof::_ * 2),
+///             [](const std::vector<int>& v) { return v.back(); }
+///         ));
+///         assert(f(std::vector<int>{ 1, 2, 3 }) == 8);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [flow](flow)
+/// * [map](map)
+///
+
+#include <boost/hof/always.hpp>
+#include <boost/hof/flow.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+template<class F>
+struct elementwise_adaptor;
+
+template<class F>
+struct is_elementwise
+: std::false_type
+{};
+
+template<class F>
+struct is_elementwise<elementwise_adaptor<F>>
+: std::true_type
+{};
+
+namespace detail {
+
+template<class X>
+struct elementwise_element
+{
+    typedef decltype(*std::begin(std::declval<X&>())) type;
+};
+
+template<class X, class F>
+BOOST_HOF_INLINE X elementwise_apply(X x, const F& f)
+{
+    for (auto&& e : x) e = f(std::move(e));
+    return x;
+}
+
+}
+
+template<class F>
+struct elementwise_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(elementwise_adaptor, detail::callable_base<F>)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& element_function() const noexcept
+    {
+        return this->base_function();
+    }
+
+    template<class X, class R=typename std::decay<X>::type,
+        class=decltype(std::declval<typename detail::elementwise_element<R>::type>() =
+            std::declval<const detail::callable_base<F>&>()(std::move(std::declval<typename detail::elementwise_element<R>::type>())))>
+    BOOST_HOF_INLINE R operator()(X&& x) const
+    {
+        return detail::elementwise_apply<R>(BOOST_HOF_FORWARD(X)(x), this->base_function());
+    }
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(elementwise, detail::make<elementwise_adaptor>);
+
+namespace detail {
+
+// The stage I of a flow, where the stages after the first two are nested in
+// the second function of the flow
+template<std::size_t I, class Flow>
+struct flow_stage;
+
+template<class F>
+struct flow_stage<0, flow_adaptor<F>>
+{
+    typedef callable_base<F> type;
+    static const type& get(const flow_adaptor<F>& f) noexcept
+    {
+        return f;
+    }
+};
+
+template<class F1, class F2>
+struct flow_stage<0, flow_adaptor<F1, F2>>
+{
+    typedef callable_base<F1> type;
+    static const type& get(const flow_adaptor<F1, F2>& f) noexcept
+    {
+        return f.first();
+    }
+};
+
+template<class F1, class F2>
+struct flow_stage<1, flow_adaptor<F1, F2>>
+{
+    typedef callable_base<F2> type;
+    static const type& get(const flow_adaptor<F1, F2>& f) noexcept
+    {
+        return f.second();
+    }
+};
+
+template<class F1, class F2, class F3, class... Fs>
+struct flow_stage<0, flow_adaptor<F1, F2, F3, Fs...>>
+{
+    typedef callable_base<F1> type;
+    static const type& get(const flow_adaptor<F1, F2, F3, Fs...>& f) noexcept
+    {
+        return f.first();
+    }
+};
+
+template<std::size_t I, class F1, class F2, class F3, class... Fs>
+struct flow_stage<I, flow_adaptor<F1, F2, F3, Fs...>>
+{
+    typedef flow_stage<I - 1, flow_adaptor<F2, F3, Fs...>> next;
+    typedef typename next::type type;
+    static const type& get(const flow_adaptor<F1, F2, F3, Fs...>& f) noexcept
+    {
+        return next::get(f.second());
+    }
+};
+
+template<class Flow>
+struct flow_size;
+
+template<class... Fs>
+struct flow_size<flow_adaptor<Fs...>>
+: std::integral_constant<std::size_t, sizeof...(Fs)>
+{};
+
+template<std::size_t I, class Flow, bool=(I < flow_size<Flow>::value)>
+struct fuse_is_elementwise
+: is_elementwise<typename flow_stage<I, Flow>::type>
+{};
+
+template<std::size_t I, class Flow>
+struct fuse_is_elementwise<I, Flow, false>
+: std::false_type
+{};
+
+// The end of the run of element-wise stages that starts at I
+template<std::size_t I, class Flow, bool=fuse_is_elementwise<I, Flow>::value>
+struct fuse_run_end
+: fuse_run_end<I + 1, Flow>
+{};
+
+template<std::size_t I, class Flow>
+struct fuse_run_end<I, Flow, false>
+: std::integral_constant<std::size_t, I>
+{};
+
+// Calls the element functions of the stages from I to J with an element
+template<std::size_t I, std::size_t J, class Flow>
+struct fuse_elements
+{
+    typedef fuse_elements<I + 1, J, Flow> next;
+
+    template<class T>
+    static auto apply(const Flow& f, T&& x)
+    -> decltype(next::apply(f, flow_stage<I, Flow>::get(f).element_function()(BOOST_HOF_FORWARD(T)(x))))
+    {
+        return next::apply(f, flow_stage<I, Flow>::get(f).element_function()(BOOST_HOF_FORWARD(T)(x)));
+    }
+};
+
+template<std::size_t J, class Flow>
+struct fuse_elements<J, J, Flow>
+{
+    // A temporary is returned by value, since it is destroyed at the end of
+    // the stage that returned it
+    template<class T>
+    static T apply(const Flow&, T&& x)
+    {
+        return BOOST_HOF_FORWARD(T)(x);
+    }
+};
+
+template<std::size_t I, std::size_t J, class Flow>
+struct fuse_element_function
+{
+    const Flow& f;
+
+    template<class T>
+    BOOST_HOF_INLINE auto operator()(T&& x) const
+    -> decltype(fuse_elements<I, J, Flow>::apply(f, BOOST_HOF_FORWARD(T)(x)))
+    {
+        return fuse_elements<I, J, Flow>::apply(f, BOOST_HOF_FORWARD(T)(x));
+    }
+};
+
+template<std::size_t I, class Flow, int Kind=
+    (I == flow_size<Flow>::value) ? 0 : (fuse_is_elementwise<I, Flow>::value ? 1 : 2)>
+struct fuse_eval;
+
+template<std::size_t I, class Flow>
+struct fuse_eval<I, Flow, 0>
+{
+    // A temporary is returned by value, since it is destroyed at the end of
+    // the stage that returned it
+    template<class T>
+    static T apply(const Flow&, T&& x)
+    {
+        return BOOST_HOF_FORWARD(T)(x);
+    }
+};
+
+// A run of element-wise stages is a single pass over the object
+template<std::size_t I, class Flow>
+struct fuse_eval<I, Flow, 1>
+{
+    static const std::size_t end = fuse_run_end<I, Flow>::value;
+    typedef fuse_eval<end, Flow> next;
+
+    template<class T, class R=typename std::decay<T>::type>
+    static auto apply(const Flow& f, T&& x)
+    -> decltype(next::apply(f, std::declval<R>()))
+    {
+        return next::apply(f, detail::elementwise_apply<R>(BOOST_HOF_FORWARD(T)(x), fuse_element_function<I, end, Flow>{f}));
+    }
+};
+
+template<std::size_t I, class Flow>
+struct fuse_eval<I, Flow, 2>
+{
+    typedef fuse_eval<I + 1, Flow> next;
+
+    template<class... Ts>
+    static auto apply(const Flow& f, Ts&&... xs)
+    -> decltype(next::apply(f, flow_stage<I, Flow>::get(f)(BOOST_HOF_FORWARD(Ts)(xs)...)))
+    {
+        return next::apply(f, flow_stage<I, Flow>::get(f)(BOOST_HOF_FORWARD(Ts)(xs)...));
+    }
+};
+
+}
+
+template<class Flow>
+struct fuse_adaptor;
+
+template<class... Fs>
+struct fuse_adaptor<flow_adaptor<Fs...>> : flow_adaptor<Fs...>
+{
+    typedef flow_adaptor<Fs...> base;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(fuse_adaptor, base)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const base& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    // The result is always a value, since the element-wise stages return a
+    // copy of the object
+    template<class... Ts, class R=typename std::decay<decltype(detail::fuse_eval<0, base>::apply(std::declval<const base&>(), std::declval<Ts>()...))>::type>
+    R operator()(Ts&&... xs) const
+    {
+        return detail::fuse_eval<0, base>::apply(this->base_function(xs...), BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+template<class... Fs>
+constexpr fuse_adaptor<flow_adaptor<Fs...>> fuse(flow_adaptor<Fs...> f)
+{
+    return fuse_adaptor<flow_adaptor<Fs...>>(static_cast<flow_adaptor<Fs...>&&>(f));
+}
+
+}} // namespace boost::hof
+
+#endif
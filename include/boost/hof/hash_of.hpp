@@ -0,0 +1,184 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    hash_of.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_HASH_OF_H
+#define BOOST_HOF_GUARD_HASH_OF_H
+
+/// hash_of
+/// =======
+///
+/// Description
+/// -----------
+///
+/// The `hash_of` function hashes its arguments together. Each argument is
+/// hashed with `std::hash` when it can be. Otherwise, when it is a sequence
+/// that can be [unpacked](unpack_sequence), such as a `std::tuple`, a
+/// [`pack`](pack) or an aggregate in C++17, its elements are hashed with
+/// `hash_of`. The `hash_with` function returns the same function, except
+/// it hashes the values with the given hasher instead of `std::hash`.
+///
+/// The hashes of the arguments are mixed into four independent lanes. Each
+/// argument goes to the next lane in turn, so mixing the arguments in
+/// different lanes doesn't wait for the previous argument. The lanes are
+/// then merged and mixed so that every bit of the result depends on every
+/// argument. This is faster than a chain of `hash_combine` calls, where
+/// each call depends on the last one, and spreads the bits better, so the
+/// result can be used with a power of two number of buckets. The result is
+/// not the `std::hash` of a single argument, and it can change between
+/// versions of the library, so it shouldn't be stored.
+///
+/// The function object can be used as the hasher of an unordered container
+/// with a key such as a tuple, which has no `std::hash`.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Ts>
+///     std::size_t hash_of(const Ts&... xs);
+///
+///     template<class Hasher>
+///     constexpr hash_of_adaptor<Hasher> hash_with(Hasher h);
+///
+/// Requirements
+/// ------------
+///
+/// Hasher must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Each argument must be hashable with the hasher, or a sequence of values
+/// that are.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <string>
+///     #include <tuple>
+///     #include <type_traits>
+///     #include <unordered_map>
+///
+///     int main() {
+///         typedef std::tuple<int, std::string> key;
+///         typedef std::decay<decltype(boost::hof::hash_of)>::type hasher;
+///         std::unordered_map<key, int, hasher> m;
+///         m[key(1, "a")] = 2;
+///         assert(m.at(key(1, "a")) == 2);
+///         assert(boost::hof::hash_of(1, std::string("a")) == boost::hof::hash_of(1, std::string("a")));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [unpack](unpack)
+/// * [unpack_sequence](unpack_sequence)
+///
+
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <boost/hof/is_unpackable.hpp>
+#include <boost/hof/returns.hpp>
+#include <boost/hof/unpack.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+inline std::uint64_t hash_rotl(std::uint64_t x, int r) noexcept
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+// The round of a lane and the final mix use the constants of xxhash64
+inline std::uint64_t hash_round(std::uint64_t lane, std::uint64_t h) noexcept
+{
+    return hash_rotl(lane + h * 0xC2B2AE3D27D4EB4FULL, 31) * 0x9E3779B185EBCA87ULL;
+}
+
+inline std::size_t hash_lanes(const std::uint64_t* h, std::size_t n) noexcept
+{
+    std::uint64_t a = 0x60EA27EEADC0B5D6ULL;
+    std::uint64_t b = 0xC2B2AE3D27D4EB4FULL;
+    std::uint64_t c = 0;
+    std::uint64_t d = 0x61C8864E7A143579ULL;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        a = hash_round(a, h[i]);
+        b = hash_round(b, h[i + 1]);
+        c = hash_round(c, h[i + 2]);
+        d = hash_round(d, h[i + 3]);
+    }
+    if (i < n) a = hash_round(a, h[i++]);
+    if (i < n) b = hash_round(b, h[i++]);
+    if (i < n) c = hash_round(c, h[i++]);
+    std::uint64_t r = hash_rotl(a, 1) + hash_rotl(b, 7) + hash_rotl(c, 12) + hash_rotl(d, 18) + n;
+    r ^= r >> 33;
+    r *= 0xC2B2AE3D27D4EB4FULL;
+    r ^= r >> 29;
+    r *= 0x165667B19E3779F9ULL;
+    r ^= r >> 32;
+    return static_cast<std::size_t>(r);
+}
+
+struct std_hash_f
+{
+    template<class T>
+    auto operator()(const T& x) const BOOST_HOF_RETURNS
+    (std::hash<T>()(x));
+};
+
+}
+
+template<class F>
+struct hash_of_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(hash_of_adaptor, detail::callable_base<F>);
+
+    constexpr const detail::callable_base<F>& base_function() const noexcept
+    {
+        return *this;
+    }
+
+    template<class T>
+    std::uint64_t element(const T& x, std::true_type) const
+    {
+        return this->base_function()(x);
+    }
+
+    template<class T>
+    std::uint64_t element(const T& x, std::false_type) const
+    {
+        return boost::hof::unpack(*this)(x);
+    }
+
+    template<class... Ts>
+    std::size_t operator()(const Ts&... xs) const
+    {
+        // The first hash is only there so the array isn't empty
+        const std::uint64_t h[] = { 0, this->element(xs, std::integral_constant<bool,
+            is_invocable<const detail::callable_base<F>&, const Ts&>::value || !is_unpackable<Ts>::value
+        >())... };
+        return detail::hash_lanes(h + 1, sizeof...(Ts));
+    }
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(hash_of, hash_of_adaptor<detail::std_hash_f>);
+BOOST_HOF_DECLARE_STATIC_VAR(hash_with, detail::make<hash_of_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,199 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    hedged.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_HEDGED_H
+#define BOOST_HOF_GUARD_HEDGED_H
+
+/// hedged
+/// ======
+///
+/// Description
+/// -----------
+///
+/// The `hedged` function decorator sends a hedged request, such as to a
+/// replicated service, where a slow reply is more likely to come from a slow
+/// replica than from a slow request. The first attempt runs on the
+/// executor, and when it hasn't finished after the delay, another attempt
+/// is started, until `n` attempts are running. The result of the first
+/// attempt that succeeds is returned, and the results of the other attempts
+/// are discarded when they finish. When all the attempts throw, the last
+/// exception is rethrown.
+///
+/// The function and the arguments are copied into a state that is shared by
+/// the attempts, which is the same state used by [`async`](async), so the
+/// attempts that are still running when the call returns don't refer to the
+/// caller. Unlike [`retry`](retry), each call allocates the state, so it is
+/// meant for calls that take much longer than an allocation. The executor
+/// must run the attempts concurrently, such as the
+/// [`thread_executor`](executor), which is the default.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Executor=thread_executor>
+///     auto hedged(std::size_t n, std::chrono::nanoseconds delay, Executor e=Executor());
+///
+/// Semantics
+/// ---------
+///
+///     assert(hedged(n, delay)(f)(xs...) == f(xs...));
+///
+/// Requirements
+/// ------------
+///
+/// Executor must be:
+///
+/// * [Executor](executor)
+/// * CopyConstructible
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * CopyConstructible
+///
+/// The result of F must be MoveConstructible.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <chrono>
+///
+///     struct replica
+///     {
+///         int operator()(int x) const
+///         {
+///             return x + 1;
+///         }
+///     };
+///
+///     int main() {
+///         auto f = boost::hof::hedged(2, std::chrono::milliseconds(10))(replica());
+///         assert(f(1) == 2);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [retry](retry)
+/// * [async](async)
+/// * [executor](executor)
+///
+
+#include <boost/hof/async.hpp>
+#include <boost/hof/decorate.hpp>
+#include <boost/hof/executor.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+template<class Executor>
+struct hedge_policy
+{
+    std::size_t attempts;
+    std::chrono::nanoseconds delay;
+    Executor executor;
+};
+
+namespace detail {
+
+template<class R, class F, class Pack>
+struct hedged_state
+{
+    typedef typename async_stored<R>::type stored_type;
+
+    async_state<stored_type> result;
+    F f;
+    Pack args;
+    std::size_t attempts;
+    std::atomic<std::size_t> failures;
+    std::atomic<bool> won;
+
+    template<class X, class P>
+    hedged_state(X&& x, P&& p, std::size_t n)
+    : f(BOOST_HOF_FORWARD(X)(x)), args(BOOST_HOF_FORWARD(P)(p)), attempts(n), failures(0), won(false)
+    {}
+
+    R call() const
+    {
+        return boost::hof::unpack(f)(args);
+    }
+
+    // Only the first attempt that succeeds, or the last one that fails,
+    // completes the result
+    void run()
+    {
+        typename async_value_ptr<stored_type>::type p;
+        try
+        {
+            auto g = [this]() -> R { return this->call(); };
+            p = detail::async_make_value<stored_type>(g, std::is_void<R>());
+        }
+        catch(...)
+        {
+            if (failures.fetch_add(1) + 1 == attempts) result.set_error(std::current_exception());
+            return;
+        }
+        if (!won.exchange(true)) result.set_value(std::move(p));
+    }
+};
+
+template<class State>
+struct hedged_attempt
+{
+    std::shared_ptr<State> state;
+
+    void operator()() const
+    {
+        state->run();
+    }
+};
+
+struct hedged_f
+{
+    template<class Executor, class F, class... Ts,
+        class Pack=decltype(boost::hof::pack(std::declval<Ts>()...)),
+        class R=typename std::decay<decltype(boost::hof::unpack(std::declval<const F&>())(std::declval<const Pack&>()))>::type>
+    R operator()(const hedge_policy<Executor>& p, const F& f, Ts&&... xs) const
+    {
+        typedef hedged_state<R, F, Pack> state_type;
+        // The first attempt always runs
+        std::size_t n = p.attempts > 0 ? p.attempts : 1;
+        auto s = detail::async_make_shared<state_type>(f, boost::hof::pack(BOOST_HOF_FORWARD(Ts)(xs)...), n);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            if (i > 0 && s->result.wait_for(p.delay)) break;
+            p.executor.execute(hedged_attempt<state_type>{s});
+        }
+        s->result.wait();
+        if (s->result.error) std::rethrow_exception(s->result.error);
+        return static_cast<R>(std::move(*s->result.value));
+    }
+};
+
+}
+
+template<class Executor=thread_executor>
+auto hedged(std::size_t n, std::chrono::nanoseconds delay, Executor e=Executor())
+-> decltype(decorate_adaptor<detail::hedged_f>()(std::declval<hedge_policy<Executor>>()))
+{
+    return decorate_adaptor<detail::hedged_f>()(hedge_policy<Executor>{n, delay, e});
+}
+
+}} // namespace boost::hof
+
+#endif
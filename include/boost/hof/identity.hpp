@@ -16,10 +16,19 @@
 /// 
 /// The `identity` function is an unary function object that returns whats given to it. 
 /// 
+/// The `identity_ref` function returns a reference to what is given to it,
+/// like `std::forward`, so an rvalue isn't moved into a new object. When it
+/// is the last function of a [`flow`](flow), or the first function of a
+/// [`compose`](compose), it isn't called, and the result of the previous
+/// function is returned as it is, so a temporary made by that function is
+/// returned by value instead of as a dangling reference.
+/// 
 /// Semantics
 /// ---------
 /// 
 ///     assert(identity(x) == x);
+///     assert(&identity_ref(x) == &x);
+///     assert(flow(f, identity_ref)(xs...) == f(xs...));
 /// 
 /// Synopsis
 /// --------
@@ -27,6 +36,9 @@
 ///     template<class T>
 ///     constexpr T identity(T&& x);
 /// 
+///     template<class T>
+///     constexpr T&& identity_ref(T&& x);
+/// 
 
 #include <utility>
 #include <initializer_list>
@@ -38,34 +50,44 @@ namespace boost { namespace hof { namespace identity_detail {
 struct identity_base
 {
     template<class T>
-    constexpr T operator()(T&& x) const 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr T operator()(T&& x) const 
     noexcept(std::is_reference<T>::value || BOOST_HOF_IS_NOTHROW_MOVE_CONSTRUCTIBLE(T))
     {
         return BOOST_HOF_FORWARD(T)(x);
     }
 
     template<class T>
-    constexpr std::initializer_list<T>& operator()(std::initializer_list<T>& x) const noexcept
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr std::initializer_list<T>& operator()(std::initializer_list<T>& x) const noexcept
     {
         return x;
     }
 
     template<class T>
-    constexpr const std::initializer_list<T>& operator()(const std::initializer_list<T>& x) const noexcept
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr const std::initializer_list<T>& operator()(const std::initializer_list<T>& x) const noexcept
     {
         return x;
     }
 
     template<class T>
-    constexpr std::initializer_list<T> operator()(std::initializer_list<T>&& x) const noexcept(noexcept(std::initializer_list<T>(std::move(x))))
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr std::initializer_list<T> operator()(std::initializer_list<T>&& x) const noexcept(noexcept(std::initializer_list<T>(std::move(x))))
     {
         return BOOST_HOF_FORWARD(std::initializer_list<T>)(x);
     }
 };
 
+struct identity_ref_base
+{
+    template<class T>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr T&& operator()(T&& x) const noexcept
+    {
+        return BOOST_HOF_FORWARD(T)(x);
+    }
+};
+
 }
 
 BOOST_HOF_DECLARE_STATIC_VAR(identity, identity_detail::identity_base);
+BOOST_HOF_DECLARE_STATIC_VAR(identity_ref, identity_detail::identity_ref_base);
 
 }} // namespace boost::hof
 
@@ -107,7 +107,7 @@ struct make_if_f
     constexpr make_if_f() noexcept
     {}
     template<class F>
-    constexpr if_adaptor<Cond, F> operator()(F f) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(F, F&&)
+    BOOST_HOF_INLINE constexpr if_adaptor<Cond, F> operator()(F f) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(F, F&&)
     {
         return if_adaptor<Cond, F>(static_cast<F&&>(f));
     }
@@ -118,7 +118,7 @@ struct if_f
     constexpr if_f()
     {}
     template<class Cond, bool B=Cond::type::value>
-    constexpr make_if_f<B> operator()(Cond) const noexcept
+    BOOST_HOF_INLINE constexpr make_if_f<B> operator()(Cond) const noexcept
     {
         return {};
     }
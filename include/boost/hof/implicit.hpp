@@ -21,16 +21,29 @@
 /// Since it is a static function adaptor, the function must be default
 /// constructible.
 /// 
+/// The `implicit_cached` adaptor calls the function only once for each of
+/// the target types `Ts...`, and stores the result inline in the returned
+/// object, so converting it again to the same type returns a copy of the
+/// stored result. This is useful when the function is costly, such as
+/// parsing a string. The returned object can be moved, so it can be stored
+/// and converted several times. A conversion to a type that isn't in `Ts...`
+/// calls the function each time, like `implicit`. The stored results are not
+/// safe to convert to concurrently.
+/// 
 /// Synopsis
 /// --------
 /// 
 ///     template<template <class...> class F>
 ///     class implicit<F>;
 /// 
+///     template<template <class...> class F, class... Ts>
+///     class implicit_cached<F, Ts...>;
+/// 
 /// Semantics
 /// ---------
 /// 
 ///     assert(T(implicit<F>()(xs...)) == F<T>()(xs...));
+///     assert(T(implicit_cached<F, Ts...>()(xs...)) == F<T>()(xs...));
 /// 
 /// Requirements
 /// ------------
@@ -40,6 +53,9 @@
 /// * [ConstFunctionObject](ConstFunctionObject)
 /// * DefaultConstructible
 /// 
+/// For `implicit_cached`, the types `Ts...` must be distinct and
+/// CopyConstructible.
+/// 
 /// Example
 /// -------
 /// 
@@ -74,9 +90,38 @@
 ///         assert(1 == x.i);
 ///     }
 /// 
+/// The result of `implicit_cached` is computed once for each type:
+/// 
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <string>
+///     using namespace boost::hof;
+/// 
+///     template<class T>
+///     struct parser;
+/// 
+///     template<>
+///     struct parser<int>
+///     {
+///         int operator()(const std::string& s) const
+///         {
+///             return std::stoi(s);
+///         }
+///     };
+/// 
+///     static constexpr implicit_cached<parser, int> parse = {};
+/// 
+///     int main() {
+///         auto r = parse(std::string("42"));
+///         int x = r;
+///         int y = r;
+///         assert(x == 42 && y == 42);
+///     }
+/// 
 
 #include <boost/hof/pack.hpp>
 #include <boost/hof/detail/result_of.hpp>
+#include <new>
 
 namespace boost { namespace hof { namespace detail {
 
@@ -101,6 +146,53 @@ struct is_implicit_callable<F, Pack, X, typename std::enable_if<
 {};
 #endif
 
+// The inline storage for the result of one target type, which is
+// constructed the first time the result is converted to the type
+template<class T>
+class implicit_slot
+{
+    typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    mutable storage buffer;
+    mutable bool ready;
+
+    T* value() const noexcept
+    {
+        return reinterpret_cast<T*>(&buffer);
+    }
+public:
+    implicit_slot() noexcept : ready(false)
+    {}
+
+    implicit_slot(implicit_slot&& rhs) BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(T, T&&)
+    : ready(rhs.ready)
+    {
+        if (ready) ::new(static_cast<void*>(value())) T(static_cast<T&&>(*rhs.value()));
+    }
+
+    implicit_slot& operator=(const implicit_slot&)=delete;
+
+    ~implicit_slot()
+    {
+        if (ready) value()->~T();
+    }
+
+    template<class G>
+    const T& get(const G& g) const
+    {
+        if (!ready)
+        {
+            ::new(static_cast<void*>(value())) T(g());
+            ready = true;
+        }
+        return *value();
+    }
+};
+
+template<class... Ts>
+struct implicit_slots
+: implicit_slot<Ts>...
+{};
+
 }
 
 
@@ -135,7 +227,7 @@ struct implicit
     struct make_invoker
     {
         template<class Pack>
-        constexpr invoker<Pack> operator()(Pack p) const BOOST_HOF_NOEXCEPT(noexcept(invoker<Pack>(boost::hof::move(p))))
+        BOOST_HOF_INLINE constexpr invoker<Pack> operator()(Pack p) const BOOST_HOF_NOEXCEPT(noexcept(invoker<Pack>(boost::hof::move(p))))
         {
             return invoker<Pack>(boost::hof::move(p));
         }
@@ -143,13 +235,68 @@ struct implicit
     };
 
     template<class... Ts>
-    constexpr auto operator()(Ts&&... xs) const 
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const 
     BOOST_HOF_RETURNS
     (
         BOOST_HOF_RETURNS_CONSTRUCT(make_invoker)()(boost::hof::pack_basic(BOOST_HOF_FORWARD(Ts)(xs)...))
     );
 };
 
+template<template <class...> class F, class... Targets>
+struct implicit_cached
+{
+    template<class Pack>
+    class invoker
+    {
+        typedef detail::implicit_slots<Targets...> slots;
+        Pack p;
+        slots results;
+
+        template<class X>
+        struct call
+        {
+            const Pack& p;
+
+            X operator()() const
+            {
+                return p(F<X>());
+            }
+        };
+
+        template<class X>
+        X convert(std::false_type) const
+        {
+            return p(F<X>());
+        }
+
+        template<class X>
+        X convert(std::true_type) const
+        {
+            return static_cast<const detail::implicit_slot<X>&>(results).get(call<X>{p});
+        }
+    public:
+        explicit invoker(Pack pp) BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Pack, Pack&&)
+        : p(boost::hof::move(pp))
+        {}
+
+        invoker(invoker&&)=default;
+        invoker(const invoker&)=delete;
+        invoker& operator=(const invoker&)=delete;
+
+        template<class X, class=typename std::enable_if<detail::is_implicit_callable<F<X>, Pack, X>::value>::type>
+        operator X() const
+        {
+            return this->convert<X>(std::integral_constant<bool, BOOST_HOF_IS_BASE_OF(detail::implicit_slot<X>, slots)>());
+        }
+    };
+
+    template<class... Ts>
+    invoker<decltype(boost::hof::pack_basic(std::declval<Ts>()...))> operator()(Ts&&... xs) const
+    {
+        return invoker<decltype(boost::hof::pack_basic(std::declval<Ts>()...))>(boost::hof::pack_basic(BOOST_HOF_FORWARD(Ts)(xs)...));
+    }
+};
+
 }} // namespace boost::hof
 
 #endif
@@ -16,16 +16,25 @@
 /// 
 /// The `indirect` function adaptor dereferences the object before calling it.
 /// 
+/// The `indirect_borrow` function dereferences the object once, and returns
+/// an adaptor that only holds a pointer to the function, so copying it
+/// doesn't touch the reference count of a `std::shared_ptr`. It doesn't own
+/// the function, so the object must outlive the adaptor.
+/// 
 /// Synopsis
 /// --------
 /// 
 ///     template<class F>
 ///     constexpr indirect_adaptor<F> indirect(F f);
 /// 
+///     template<class P>
+///     constexpr indirect_adaptor<std::remove_reference_t<decltype(*p)>*> indirect_borrow(const P& p);
+/// 
 /// Semantics
 /// ---------
 /// 
 ///     assert(indirect(f)(xs...) == (*f)(xs...));
+///     assert(indirect_borrow(f)(xs...) == (*f)(xs...));
 /// 
 /// Requirements
 /// ------------
@@ -75,9 +84,9 @@ struct indirect_adaptor : F
     BOOST_HOF_INHERIT_CONSTRUCTOR(indirect_adaptor, F);
 
     template<class... Ts>
-    constexpr const F& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr const F& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     struct failure
@@ -87,7 +96,7 @@ struct indirect_adaptor : F
     BOOST_HOF_RETURNS_CLASS(indirect_adaptor);
 
     template<class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(decltype(*std::declval<F>()), id_<Ts>...) 
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(decltype(*std::declval<F>()), id_<Ts>...) 
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         (*BOOST_HOF_MANGLE_CAST(const F&)(BOOST_HOF_CONST_THIS->base_function(xs...)))(BOOST_HOF_FORWARD(Ts)(xs)...)
@@ -107,7 +116,7 @@ struct indirect_adaptor<F*>
     {}
 
     template<class... Ts>
-    constexpr F& base_function(Ts&&...) const noexcept
+    BOOST_HOF_INLINE constexpr F& base_function(Ts&&...) const noexcept
     {
         return *f;
     }
@@ -119,15 +128,33 @@ struct indirect_adaptor<F*>
     BOOST_HOF_RETURNS_CLASS(indirect_adaptor);
 
     template<class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(F, id_<Ts>...) 
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(F, id_<Ts>...) 
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         (BOOST_HOF_MANGLE_CAST(F&)(BOOST_HOF_CONST_THIS->base_function(xs...)))(BOOST_HOF_FORWARD(Ts)(xs)...)
     );
 };
 
+BOOST_HOF_DETAIL_COMPILE_MARKER(indirect, indirect_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(indirect, detail::make<indirect_adaptor>);
 
+namespace detail {
+
+struct indirect_borrow_f
+{
+    template<class P, class F=typename std::remove_reference<decltype(*std::declval<const P&>())>::type>
+    constexpr indirect_adaptor<F*> operator()(const P& p) const
+    BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(*p)
+    {
+        return indirect_adaptor<F*>(&*p);
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(indirect_borrow, detail::indirect_borrow_f);
+
 }} // namespace boost::hof
 
 #endif
@@ -0,0 +1,181 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    indirect_hot_swap.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FUNCTION_INDIRECT_HOT_SWAP_H
+#define BOOST_HOF_GUARD_FUNCTION_INDIRECT_HOT_SWAP_H
+
+/// indirect_hot_swap
+/// =================
+///
+/// Description
+/// -----------
+///
+/// The `indirect_hot_swap` function adaptor calls the function held by a
+/// `std::shared_ptr`, which can be replaced with `store` while other threads
+/// are calling it. Each call loads the current function atomically and keeps
+/// it alive until the call returns, so the callers never take a lock of
+/// their own, and a replaced function is destroyed once its last call
+/// finishes.
+///
+/// Copies of the adaptor share the function, so a function stored through
+/// one copy is called by all of them. Where the standard library provides
+/// `std::atomic<std::shared_ptr<F>>`, it is used, otherwise the atomic free
+/// functions for `std::shared_ptr` are used, which might use a lock
+/// internally.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F>
+///     indirect_hot_swap_adaptor<F> indirect_hot_swap(std::shared_ptr<F> f);
+///
+///     template<class F>
+///     std::shared_ptr<F> indirect_hot_swap_adaptor<F>::load() const;
+///
+///     template<class F>
+///     void indirect_hot_swap_adaptor<F>::store(std::shared_ptr<F> f) const;
+///
+/// Semantics
+/// ---------
+///
+///     assert(indirect_hot_swap(f)(xs...) == (*f)(xs...));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <memory>
+///
+///     struct scale
+///     {
+///         int factor;
+///         int operator()(int x) const
+///         {
+///             return x*factor;
+///         }
+///     };
+///
+///     int main() {
+///         auto f = boost::hof::indirect_hot_swap(std::make_shared<scale>(scale{2}));
+///         assert(f(3) == 6);
+///         f.store(std::make_shared<scale>(scale{3}));
+///         assert(f(3) == 9);
+///     }
+///
+
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <atomic>
+#include <memory>
+
+#ifndef BOOST_HOF_HAS_ATOMIC_SHARED_PTR
+#if defined(__cpp_lib_atomic_shared_ptr) && __cpp_lib_atomic_shared_ptr >= 201711L
+#define BOOST_HOF_HAS_ATOMIC_SHARED_PTR 1
+#else
+#define BOOST_HOF_HAS_ATOMIC_SHARED_PTR 0
+#endif
+#endif
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+#if BOOST_HOF_HAS_ATOMIC_SHARED_PTR
+template<class F>
+struct hot_swap_slot
+{
+    std::atomic<std::shared_ptr<F>> f;
+
+    hot_swap_slot(std::shared_ptr<F> x) : f(std::move(x))
+    {}
+
+    std::shared_ptr<F> load() const noexcept
+    {
+        return f.load(std::memory_order_acquire);
+    }
+
+    void store(std::shared_ptr<F> x) noexcept
+    {
+        f.store(std::move(x), std::memory_order_release);
+    }
+};
+#else
+template<class F>
+struct hot_swap_slot
+{
+    std::shared_ptr<F> f;
+
+    hot_swap_slot(std::shared_ptr<F> x) : f(std::move(x))
+    {}
+
+    std::shared_ptr<F> load() const noexcept
+    {
+        return std::atomic_load_explicit(&f, std::memory_order_acquire);
+    }
+
+    void store(std::shared_ptr<F> x) noexcept
+    {
+        std::atomic_store_explicit(&f, std::move(x), std::memory_order_release);
+    }
+};
+#endif
+
+}
+
+template<class F>
+struct indirect_hot_swap_adaptor
+{
+    std::shared_ptr<detail::hot_swap_slot<F>> slot;
+
+    explicit indirect_hot_swap_adaptor(std::shared_ptr<F> f)
+    : slot(std::make_shared<detail::hot_swap_slot<F>>(std::move(f)))
+    {}
+
+    std::shared_ptr<F> load() const noexcept
+    {
+        return slot->load();
+    }
+
+    void store(std::shared_ptr<F> f) const noexcept
+    {
+        slot->store(std::move(f));
+    }
+
+    template<class... Ts, class R=decltype(std::declval<const F&>()(std::declval<Ts>()...))>
+    R operator()(Ts&&... xs) const
+    {
+        std::shared_ptr<F> f = this->load();
+        return static_cast<const F&>(*f)(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+namespace detail {
+
+struct indirect_hot_swap_f
+{
+    template<class F>
+    indirect_hot_swap_adaptor<F> operator()(std::shared_ptr<F> f) const
+    {
+        return indirect_hot_swap_adaptor<F>(std::move(f));
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(indirect_hot_swap, detail::indirect_hot_swap_f);
+
+}} // namespace boost::hof
+
+#endif
@@ -55,6 +55,11 @@
 /// 
 ///     assert(x <infix(f)> y <infix(g)> z == ((x <infix(f)> y) <infix(g)> z));
 /// 
+/// The left operand and the function are held by reference until the right
+/// operand is given, and an empty function is copied instead, so an infix
+/// expression doesn't copy its operands. Therefore, the result of `x <f`
+/// must be used in the same full expression.
+/// 
 /// Example
 /// -------
 /// 
@@ -82,49 +87,96 @@
 #include <boost/hof/detail/callable_base.hpp>
 #include <boost/hof/always.hpp>
 #include <boost/hof/reveal.hpp>
-#include <boost/hof/detail/move.hpp>
 #include <boost/hof/detail/make.hpp>
 #include <boost/hof/detail/static_const_var.hpp>
 
 namespace boost { namespace hof {
  
 namespace detail{
+// An empty function is copied, since the copy is free, otherwise the
+// function is borrowed from the infix operator
+template<class F>
+struct postfix_storage
+: std::conditional<BOOST_HOF_IS_EMPTY(F), F, const F&>
+{};
+
+template<class F>
+struct postfix_function : F
+{
+    template<class X>
+    constexpr postfix_function(X&& fp)
+    BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(F, X&&)
+    : F(BOOST_HOF_FORWARD(X)(fp))
+    {}
+
+    constexpr const F& get_function() const noexcept
+    {
+        return *this;
+    }
+};
+
+template<class F>
+struct postfix_function<const F&>
+{
+    const F& f;
+
+    constexpr postfix_function(const F& fp) noexcept
+    : f(fp)
+    {}
+
+    constexpr const F& get_function() const noexcept
+    {
+        return f;
+    }
+};
+
+// The left operand and the function are only used before the end of the
+// full expression, so the operand is always held by reference
 template<class T, class F>
-struct postfix_adaptor : F
+struct postfix_adaptor : postfix_function<F>
 {
-    T x;
+    typedef typename std::remove_cv<typename std::remove_reference<F>::type>::type function_type;
+    T&& x;
 
-    template<class X, class XF>
-    constexpr postfix_adaptor(X&& xp, XF&& fp)
-    BOOST_HOF_NOEXCEPT(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(F, XF&&) && BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(T, X&&)) 
-    : F(BOOST_HOF_FORWARD(XF)(fp)), x(BOOST_HOF_FORWARD(X)(xp))
+    template<class XF>
+    constexpr postfix_adaptor(T&& xp, XF&& fp)
+    BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(postfix_function<F>, XF&&)
+    : postfix_function<F>(BOOST_HOF_FORWARD(XF)(fp)), x(BOOST_HOF_FORWARD(T)(xp))
     {}
 
     template<class... Ts>
-    constexpr const F& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr const function_type& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs).get_function();
     }
 
     BOOST_HOF_RETURNS_CLASS(postfix_adaptor);
 
-    template<class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(const F&, id_<T&&>, id_<Ts>...)
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(infix, Ts...)>
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(const function_type&, id_<T&&>, id_<Ts>...)
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
-        (BOOST_HOF_MANGLE_CAST(const F&)(BOOST_HOF_CONST_THIS->base_function(xs...)))(BOOST_HOF_RETURNS_C_CAST(T&&)(BOOST_HOF_CONST_THIS->x), BOOST_HOF_FORWARD(Ts)(xs)...)
+        (BOOST_HOF_MANGLE_CAST(const function_type&)(BOOST_HOF_CONST_THIS->base_function(xs...)))(BOOST_HOF_RETURNS_C_CAST(T&&)(BOOST_HOF_CONST_THIS->x), BOOST_HOF_FORWARD(Ts)(xs)...)
     );
 
     template<class A>
-    constexpr BOOST_HOF_SFINAE_RESULT(const F&, id_<T&&>, id_<A>)
+    constexpr BOOST_HOF_SFINAE_RESULT(const function_type&, id_<T&&>, id_<A>)
     operator>(A&& a) const BOOST_HOF_SFINAE_RETURNS
     (
-        (BOOST_HOF_MANGLE_CAST(const F&)(BOOST_HOF_CONST_THIS->base_function(a)))(BOOST_HOF_RETURNS_C_CAST(T&&)(BOOST_HOF_CONST_THIS->x), BOOST_HOF_FORWARD(A)(a))
+        (BOOST_HOF_MANGLE_CAST(const function_type&)(BOOST_HOF_CONST_THIS->base_function(a)))(BOOST_HOF_RETURNS_C_CAST(T&&)(BOOST_HOF_CONST_THIS->x), BOOST_HOF_FORWARD(A)(a))
     );
 };
 
 template<class T, class F>
-constexpr postfix_adaptor<T, F> make_postfix_adaptor(T&& x, F f)
+constexpr postfix_adaptor<T, typename postfix_storage<F>::type> make_postfix_adaptor(T&& x, const F& f)
+BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(postfix_adaptor<T, typename postfix_storage<F>::type>, T&&, const F&)
+{
+    return postfix_adaptor<T, typename postfix_storage<F>::type>(BOOST_HOF_FORWARD(T)(x), f);
+}
+
+// Used when the function is a temporary, so it is held by value
+template<class T, class F>
+constexpr postfix_adaptor<T, F> make_owning_postfix_adaptor(T&& x, F f)
 BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(postfix_adaptor<T, F>, T&&, F&&)
 {
     return postfix_adaptor<T, F>(BOOST_HOF_FORWARD(T)(x), static_cast<F&&>(f));
@@ -138,21 +190,21 @@ struct infix_adaptor : detail::callable_base<F>
     BOOST_HOF_INHERIT_CONSTRUCTOR(infix_adaptor, detail::callable_base<F>);
 
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     template<class... Ts>
-    constexpr const detail::callable_base<F>& infix_base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& infix_base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     BOOST_HOF_RETURNS_CLASS(infix_adaptor);
 
-    template<class... Ts>
-    constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(infix, Ts...)>
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
     (
         (BOOST_HOF_MANGLE_CAST(const detail::callable_base<F>&)(BOOST_HOF_CONST_THIS->base_function(xs...)))(BOOST_HOF_FORWARD(Ts)(xs)...)
     );
@@ -160,7 +212,7 @@ struct infix_adaptor : detail::callable_base<F>
 
 template<class T, class F>
 constexpr auto operator<(T&& x, const infix_adaptor<F>& i) BOOST_HOF_RETURNS
-(detail::make_postfix_adaptor(BOOST_HOF_FORWARD(T)(x), boost::hof::move(i.base_function(x))));
+(detail::make_postfix_adaptor(BOOST_HOF_FORWARD(T)(x), i.base_function(x)));
 
 // TODO: Operators for static_
 
@@ -173,7 +225,7 @@ struct static_function_wrapper;
 template<class T, class F>
 auto operator<(T&& x, const boost::hof::detail::static_function_wrapper<F>& f) BOOST_HOF_RETURNS
 (
-    detail::make_postfix_adaptor(BOOST_HOF_FORWARD(T)(x), boost::hof::move(f.base_function().infix_base_function()))
+    detail::make_postfix_adaptor(BOOST_HOF_FORWARD(T)(x), f.base_function().infix_base_function())
 );
 
 template<class F>
@@ -183,7 +235,7 @@ struct static_default_function;
 template<class T, class F>
 auto operator<(T&& x, const boost::hof::detail::static_default_function<F>&) BOOST_HOF_RETURNS
 (
-    detail::make_postfix_adaptor(BOOST_HOF_FORWARD(T)(x), boost::hof::move(F().infix_base_function()))
+    detail::make_owning_postfix_adaptor(BOOST_HOF_FORWARD(T)(x), F().infix_base_function())
 );
 }
 // This overload is needed for gcc
@@ -193,6 +245,8 @@ constexpr auto operator<(T&& x, const boost::hof::reveal_adaptor<F>& f) BOOST_HO
     detail::make_postfix_adaptor(BOOST_HOF_FORWARD(T)(x), f.infix_base_function())
 );
 
+BOOST_HOF_DETAIL_COMPILE_MARKER(infix, infix_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(infix, detail::make<infix_adaptor>);
 
 }} // namespace boost::hof
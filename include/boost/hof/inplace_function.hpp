@@ -0,0 +1,213 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    inplace_function.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_INPLACE_FUNCTION_H
+#define BOOST_HOF_GUARD_INPLACE_FUNCTION_H
+
+/// inplace_function
+/// ================
+///
+/// Description
+/// -----------
+///
+/// The `inplace_function` class is an owning function wrapper, like
+/// `std::function`, except the function object is always stored in a buffer
+/// of `N` bytes inside the wrapper, so it never allocates. It is a compile
+/// error to store a function object that does not fit in the buffer, or that
+/// needs a stricter alignment than `Align`.
+///
+/// Calling an empty `inplace_function` throws `std::bad_function_call`.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Sig, std::size_t N=4*sizeof(void*), std::size_t Align=alignof(std::max_align_t)>
+///     class inplace_function;
+///
+///     template<class R, class... Args, std::size_t N, std::size_t Align>
+///     class inplace_function<R(Args...), N, Align>
+///     {
+///         inplace_function() noexcept;
+///
+///         template<class F>
+///         inplace_function(F f);
+///
+///         void reset() noexcept;
+///
+///         explicit operator bool() const noexcept;
+///
+///         R operator()(Args... xs) const;
+///     };
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable) with `Args...`, and the result
+///   convertible to `R`, unless `R` is void
+/// * CopyConstructible
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int main() {
+///         boost::hof::inplace_function<int(int)> f = boost::hof::_ + 1;
+///         assert(f(1) == 2);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [function_ref](function_ref)
+///
+
+#include <boost/hof/detail/erased_call.hpp>
+#include <cstddef>
+#include <functional>
+#include <new>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class R, class... Args>
+struct inplace_vtable
+{
+    R (*invoke)(const void*, Args&&...);
+    void (*copy)(void*, const void*);
+    void (*move)(void*, void*);
+    void (*destroy)(void*);
+};
+
+template<class F, class R, class... Args>
+struct inplace_vtable_for
+{
+    static R invoke(const void* p, Args&&... xs)
+    {
+        return erased_invoke<R>::call(*static_cast<const F*>(p), BOOST_HOF_FORWARD(Args)(xs)...);
+    }
+
+    static void copy(void* dst, const void* src)
+    {
+        new (dst) F(*static_cast<const F*>(src));
+    }
+
+    static void move(void* dst, void* src)
+    {
+        new (dst) F(static_cast<F&&>(*static_cast<F*>(src)));
+        static_cast<F*>(src)->~F();
+    }
+
+    static void destroy(void* p)
+    {
+        static_cast<F*>(p)->~F();
+    }
+
+    static const inplace_vtable<R, Args...> value;
+};
+
+template<class F, class R, class... Args>
+const inplace_vtable<R, Args...> inplace_vtable_for<F, R, Args...>::value = {
+    &inplace_vtable_for::invoke,
+    &inplace_vtable_for::copy,
+    &inplace_vtable_for::move,
+    &inplace_vtable_for::destroy
+};
+
+}
+
+template<class Sig, std::size_t N=4*sizeof(void*), std::size_t Align=alignof(std::max_align_t)>
+class inplace_function;
+
+template<class R, class... Args, std::size_t N, std::size_t Align>
+class inplace_function<R(Args...), N, Align>
+{
+    typedef detail::inplace_vtable<R, Args...> vtable_type;
+
+    typename std::aligned_storage<N, Align>::type buffer;
+    const vtable_type* vtable;
+public:
+    inplace_function() noexcept : vtable(nullptr)
+    {}
+
+    template<class F, class T=typename std::decay<F>::type, typename std::enable_if<(
+        !std::is_same<T, inplace_function>::value &&
+        detail::is_erased_callable<const T&, R(Args...)>::value
+    ), int>::type = 0>
+    inplace_function(F&& f)
+    : vtable(&detail::inplace_vtable_for<T, R, Args...>::value)
+    {
+        static_assert(sizeof(T) <= N, "Function object is too large for inplace_function");
+        static_assert(Align % alignof(T) == 0, "Function object is over-aligned for inplace_function");
+        new (&buffer) T(BOOST_HOF_FORWARD(F)(f));
+    }
+
+    inplace_function(const inplace_function& rhs) : vtable(rhs.vtable)
+    {
+        if (vtable) vtable->copy(&buffer, &rhs.buffer);
+    }
+
+    // The moved from function is left empty
+    inplace_function(inplace_function&& rhs) noexcept : vtable(rhs.vtable)
+    {
+        if (vtable) vtable->move(&buffer, &rhs.buffer);
+        rhs.vtable = nullptr;
+    }
+
+    inplace_function& operator=(const inplace_function& rhs)
+    {
+        if (this != &rhs)
+        {
+            inplace_function tmp(rhs);
+            *this = static_cast<inplace_function&&>(tmp);
+        }
+        return *this;
+    }
+
+    inplace_function& operator=(inplace_function&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            this->reset();
+            if (rhs.vtable) rhs.vtable->move(&buffer, &rhs.buffer);
+            vtable = rhs.vtable;
+            rhs.vtable = nullptr;
+        }
+        return *this;
+    }
+
+    ~inplace_function()
+    {
+        this->reset();
+    }
+
+    void reset() noexcept
+    {
+        if (vtable) vtable->destroy(&buffer);
+        vtable = nullptr;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return vtable != nullptr;
+    }
+
+    BOOST_HOF_INLINE R operator()(Args... xs) const
+    {
+        if (!vtable) throw std::bad_function_call();
+        return vtable->invoke(&buffer, BOOST_HOF_FORWARD(Args)(xs)...);
+    }
+};
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,139 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    is_associative.hpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_IS_ASSOCIATIVE_HPP
+#define BOOST_HOF_GUARD_IS_ASSOCIATIVE_HPP
+
+/// is_associative
+/// ==============
+/// 
+/// This is a trait that marks the binary functions that give the same result
+/// for any grouping of their arguments, when the arguments are integers, so
+/// `f(f(x, y), z) == f(x, f(y, z))`. When the function is associative,
+/// [`fold`](fold) reduces unsigned integers of the same type in a balanced
+/// tree, like [`tree_fold`](tree_fold), instead of a left fold.
+/// 
+/// It can't be deduced, so it is false unless it is specialized for the
+/// function. It is true for the addition, multiplication and bitwise
+/// operators of the [placeholders](placeholders), such as `_ + _`, and for
+/// `std::plus`, `std::multiplies`, `std::bit_and`, `std::bit_or` and
+/// `std::bit_xor`. The minimum and the maximum of integers are also
+/// associative, and [`pack_min`](minmax) and [`pack_max`](minmax) already
+/// reduce their arguments in a balanced tree.
+/// 
+/// Specializing the trait promises that the associativity is exact for the
+/// integers the function is folded with, so every grouping gives the same
+/// value and none of them overflows when the left fold doesn't. This holds
+/// for the wrapping arithmetic of unsigned integers, but not for a signed
+/// sum or product, which can overflow in one grouping and not in another. So
+/// signed integers are only reduced in a tree by the bitwise operators,
+/// which can't overflow, and by the other functions they are folded from
+/// the left.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class F>
+///     struct is_associative;
+/// 
+/// Example
+/// -------
+/// 
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+/// 
+///     struct gcd
+///     {
+///         constexpr unsigned operator()(unsigned x, unsigned y) const
+///         {
+///             return y == 0 ? x : gcd()(y, x % y);
+///         }
+///     };
+/// 
+///     namespace boost { namespace hof {
+///     template<>
+///     struct is_associative<gcd>
+///     : std::true_type
+///     {};
+///     }}
+/// 
+///     int main() {
+///         static_assert(boost::hof::is_associative<std::plus<int>>::value, "Failed");
+///         assert(boost::hof::fold(gcd())(12u, 18u, 30u, 42u) == 6u);
+///     }
+/// 
+/// References
+/// ----------
+/// 
+/// * [is_commutative](is_commutative)
+/// * [fold](fold)
+/// 
+
+#include <functional>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+template<class F>
+struct is_associative
+: std::false_type
+{};
+
+template<class T>
+struct is_associative<std::plus<T>>
+: std::true_type
+{};
+
+template<class T>
+struct is_associative<std::multiplies<T>>
+: std::true_type
+{};
+
+template<class T>
+struct is_associative<std::bit_and<T>>
+: std::true_type
+{};
+
+template<class T>
+struct is_associative<std::bit_or<T>>
+: std::true_type
+{};
+
+template<class T>
+struct is_associative<std::bit_xor<T>>
+: std::true_type
+{};
+
+namespace detail {
+
+// Marks the associative functions that can't overflow, such as the bitwise
+// operators, so a fold can also regroup them for signed integers
+template<class F>
+struct is_overflow_free
+: std::false_type
+{};
+
+template<class T>
+struct is_overflow_free<std::bit_and<T>>
+: std::true_type
+{};
+
+template<class T>
+struct is_overflow_free<std::bit_or<T>>
+: std::true_type
+{};
+
+template<class T>
+struct is_overflow_free<std::bit_xor<T>>
+: std::true_type
+{};
+
+}
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,110 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    is_commutative.hpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_IS_COMMUTATIVE_HPP
+#define BOOST_HOF_GUARD_IS_COMMUTATIVE_HPP
+
+/// is_commutative
+/// ==============
+/// 
+/// This is a trait that marks the binary functions that give the same result
+/// when their arguments are swapped, when the arguments are integers, so
+/// `f(x, y) == f(y, x)`. When the function is also
+/// [associative](is_associative), the arguments can be reduced in any order,
+/// so [`reverse_fold`](reverse_fold) reduces unsigned integers of the same
+/// type in a balanced tree, like [`tree_fold`](tree_fold), instead of a
+/// right fold. As for `is_associative`, signed integers are only reduced
+/// in a tree by the bitwise operators, since a signed sum can overflow in
+/// one order and not in another.
+/// 
+/// It can't be deduced, so it is false unless it is specialized for the
+/// function. It is true for the same functions as `is_associative`, which
+/// are the addition, multiplication and bitwise operators of the
+/// [placeholders](placeholders), such as `_ + _`, `std::plus`,
+/// `std::multiplies`, `std::bit_and`, `std::bit_or` and `std::bit_xor`.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class F>
+///     struct is_commutative;
+/// 
+/// Example
+/// -------
+/// 
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+/// 
+///     struct gcd
+///     {
+///         constexpr unsigned operator()(unsigned x, unsigned y) const
+///         {
+///             return y == 0 ? x : gcd()(y, x % y);
+///         }
+///     };
+/// 
+///     namespace boost { namespace hof {
+///     template<>
+///     struct is_associative<gcd>
+///     : std::true_type
+///     {};
+///     template<>
+///     struct is_commutative<gcd>
+///     : std::true_type
+///     {};
+///     }}
+/// 
+///     int main() {
+///         static_assert(boost::hof::is_commutative<std::plus<int>>::value, "Failed");
+///         assert(boost::hof::reverse_fold(gcd())(12u, 18u, 30u, 42u) == 6u);
+///     }
+/// 
+/// References
+/// ----------
+/// 
+/// * [is_associative](is_associative)
+/// * [reverse_fold](reverse_fold)
+/// 
+
+#include <functional>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+template<class F>
+struct is_commutative
+: std::false_type
+{};
+
+template<class T>
+struct is_commutative<std::plus<T>>
+: std::true_type
+{};
+
+template<class T>
+struct is_commutative<std::multiplies<T>>
+: std::true_type
+{};
+
+template<class T>
+struct is_commutative<std::bit_and<T>>
+: std::true_type
+{};
+
+template<class T>
+struct is_commutative<std::bit_or<T>>
+: std::true_type
+{};
+
+template<class T>
+struct is_commutative<std::bit_xor<T>>
+: std::true_type
+{};
+
+}} // namespace boost::hof
+
+#endif
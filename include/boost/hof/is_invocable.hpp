@@ -53,10 +53,40 @@
 
 namespace boost { namespace hof {
 
+#if BOOST_HOF_HAS_MANUAL_DEDUCTION || BOOST_HOF_NO_EXPRESSION_SFINAE
 template<class F, class... Ts>
 struct is_invocable 
 : detail::can_be_called<detail::apply_f, F, Ts...>
 {};
+#else
+// Only member pointers need apply. Any other function is called by apply as
+// an lvalue, so it is checked directly, with the same key as the other
+// checks of that function.
+template<class F, class... Ts>
+struct is_invocable 
+: detail::can_be_called<F&, Ts...>
+{};
+
+#define BOOST_HOF_IS_INVOCABLE_MEMBER_POINTER(cv, ref) \
+template<class T, class C, class... Ts> \
+struct is_invocable<T C::* cv ref, Ts...> \
+: detail::can_be_called<detail::apply_f, T C::* cv ref, Ts...> \
+{};
+
+BOOST_HOF_IS_INVOCABLE_MEMBER_POINTER(,)
+BOOST_HOF_IS_INVOCABLE_MEMBER_POINTER(,&)
+BOOST_HOF_IS_INVOCABLE_MEMBER_POINTER(,&&)
+BOOST_HOF_IS_INVOCABLE_MEMBER_POINTER(const,)
+BOOST_HOF_IS_INVOCABLE_MEMBER_POINTER(const,&)
+BOOST_HOF_IS_INVOCABLE_MEMBER_POINTER(const,&&)
+BOOST_HOF_IS_INVOCABLE_MEMBER_POINTER(volatile,)
+BOOST_HOF_IS_INVOCABLE_MEMBER_POINTER(volatile,&)
+BOOST_HOF_IS_INVOCABLE_MEMBER_POINTER(volatile,&&)
+BOOST_HOF_IS_INVOCABLE_MEMBER_POINTER(const volatile,)
+BOOST_HOF_IS_INVOCABLE_MEMBER_POINTER(const volatile,&)
+BOOST_HOF_IS_INVOCABLE_MEMBER_POINTER(const volatile,&&)
+#undef BOOST_HOF_IS_INVOCABLE_MEMBER_POINTER
+#endif
 
 template<class F, class... Ts, class... Us>
 struct is_invocable<F(Ts...), Us...>
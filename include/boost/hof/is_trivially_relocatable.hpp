@@ -0,0 +1,62 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    is_trivially_relocatable.hpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_IS_TRIVIALLY_RELOCATABLE_HPP
+#define BOOST_HOF_GUARD_IS_TRIVIALLY_RELOCATABLE_HPP
+
+/// is_trivially_relocatable
+/// ========================
+/// 
+/// This is a trait that can be used to detect whether an object of the type
+/// can be moved to new storage by copying its bytes, without calling its
+/// constructors or destructor. The adaptors keep this property of the
+/// functions they store, so an adaptor of trivially copyable functions is
+/// trivially copyable, and can be copied with `memcpy`.
+/// 
+/// When the compiler provides a builtin for trivial relocation, it is used.
+/// Otherwise, a type is trivially relocatable when it is trivially copyable.
+/// The trait can be specialized to mark a type as trivially relocatable, but
+/// this is not deduced for the adaptors that store it.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class T>
+///     struct is_trivially_relocatable;
+/// 
+/// Example
+/// -------
+/// 
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+/// 
+///     struct sum
+///     {
+///         int operator()(int x, int y) const
+///         {
+///             return x + y;
+///         }
+///     };
+/// 
+///     int main() {
+///         auto f = boost::hof::partial(sum())(1);
+///         static_assert(boost::hof::is_trivially_relocatable<decltype(f)>::value, "Failed");
+///     }
+/// 
+
+#include <boost/hof/detail/intrinsics.hpp>
+
+namespace boost { namespace hof {
+
+template<class T>
+struct is_trivially_relocatable
+: std::integral_constant<bool, BOOST_HOF_IS_TRIVIALLY_RELOCATABLE(T)>
+{};
+
+}} // namespace boost::hof
+
+#endif
@@ -44,7 +44,7 @@ namespace detail {
 struct unpack_impl_f
 {
     template<class F, class Sequence>
-    constexpr auto operator()(F&& f, Sequence&& s) const BOOST_HOF_RETURNS
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(F&& f, Sequence&& s) const BOOST_HOF_RETURNS
     (
         boost::hof::unpack_sequence<typename std::remove_cv<typename std::remove_reference<Sequence>::type>::type>::
                 apply(BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(Sequence)(s))
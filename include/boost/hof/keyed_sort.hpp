@@ -0,0 +1,195 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    keyed_sort.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FUNCTION_KEYED_SORT_H
+#define BOOST_HOF_GUARD_FUNCTION_KEYED_SORT_H
+
+/// keyed_sort
+/// ==========
+///
+/// Description
+/// -----------
+///
+/// The `keyed_sort` function adaptor returns a function that sorts a range
+/// by a key, like sorting it with `proj(key, compare)`, except the key of
+/// each element is computed once, instead of each time the element is
+/// compared. The keys are stored in a buffer of their own, next to each
+/// other, and the positions of the elements are sorted by comparing the
+/// keys, so the comparisons don't touch the elements. Then the elements are
+/// moved to their sorted positions, each one moved once, except one element
+/// for each cycle of the permutation that is moved twice.
+///
+/// This is the decorate-sort-undecorate transform, which is faster than
+/// sorting with `proj` when the key is expensive to compute, or when the
+/// elements are large, compared to the keys.
+///
+/// Like `std::sort`, the sort isn't stable.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Projection, class Compare>
+///     keyed_sort_adaptor<Projection, Compare> keyed_sort(Projection p, Compare c);
+///
+///     template<class Projection, class Compare>
+///     template<class Iterator>
+///     void keyed_sort_adaptor<Projection, Compare>::operator()(Iterator first, Iterator last) const;
+///
+///     template<class Projection, class Compare>
+///     template<class Range>
+///     void keyed_sort_adaptor<Projection, Compare>::operator()(Range&& r) const;
+///
+/// Semantics
+/// ---------
+///
+///     keyed_sort(p, c)(first, last);
+///     // sorts the range the same as
+///     std::sort(first, last, proj(p, c));
+///
+/// Requirements
+/// ------------
+///
+/// Projection must be:
+///
+/// * [UnaryInvocable](UnaryInvocable)
+/// * MoveConstructible
+///
+/// Compare must be:
+///
+/// * [BinaryInvocable](BinaryInvocable), that is a strict weak ordering of
+///   the keys
+/// * MoveConstructible
+///
+/// Iterator must be:
+///
+/// * RandomAccessIterator, whose element is MoveConstructible and
+///   MoveAssignable
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <functional>
+///     #include <string>
+///     #include <vector>
+///
+///     struct length
+///     {
+///         std::size_t operator()(const std::string& s) const
+///         {
+///             return s.size();
+///         }
+///     };
+///
+///     int main() {
+///         std::vector<std::string> v = { "ccc", "a", "bb" };
+///         boost::hof::keyed_sort(length(), std::less<std::size_t>())(v);
+///         assert(v[0] == "a" && v[1] == "bb" && v[2] == "ccc");
+///     }
+///
+/// References
+/// ----------
+///
+/// * [proj](proj)
+/// * [Projections](Projections)
+///
+
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+// Moves each element to its sorted position by following the cycles of the
+// permutation, where `order[i]` is the position of the element that belongs
+// at `i`
+template<class Iterator>
+void keyed_sort_permute(Iterator first, std::vector<std::size_t>& order)
+{
+    typedef typename std::iterator_traits<Iterator>::value_type value_type;
+    for (std::size_t i = 0; i < order.size(); i++)
+    {
+        if (order[i] == i) continue;
+        value_type x = std::move(first[i]);
+        std::size_t j = i;
+        while (order[j] != i)
+        {
+            std::size_t k = order[j];
+            first[j] = std::move(first[k]);
+            order[j] = j;
+            j = k;
+        }
+        first[j] = std::move(x);
+        order[j] = j;
+    }
+}
+
+}
+
+template<class Projection, class Compare>
+struct keyed_sort_adaptor : detail::compressed_pair<detail::callable_base<Projection>, detail::callable_base<Compare>>
+{
+    typedef detail::compressed_pair<detail::callable_base<Projection>, detail::callable_base<Compare>> base;
+
+    template<class... Ts>
+    constexpr const detail::callable_base<Compare>& base_function(Ts&&... xs) const noexcept
+    {
+        return this->second(xs...);
+    }
+
+    template<class... Ts>
+    constexpr const detail::callable_base<Projection>& base_projection(Ts&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(keyed_sort_adaptor, base)
+
+    template<class Iterator, class Key=typename std::decay<decltype(
+        std::declval<const detail::callable_base<Projection>&>()(*std::declval<Iterator>())
+    )>::type>
+    void operator()(Iterator first, Iterator last) const
+    {
+        const auto& p = this->base_projection(first);
+        const auto& c = this->base_function(first);
+        std::size_t n = static_cast<std::size_t>(last - first);
+        std::vector<Key> keys;
+        keys.reserve(n);
+        for (Iterator it = first; it != last; ++it) keys.push_back(p(*it));
+        std::vector<std::size_t> order(n);
+        for (std::size_t i = 0; i < n; i++) order[i] = i;
+        std::sort(order.begin(), order.end(), [&](std::size_t x, std::size_t y)
+        {
+            return c(static_cast<const Key&>(keys[x]), static_cast<const Key&>(keys[y]));
+        });
+        detail::keyed_sort_permute(first, order);
+    }
+
+    template<class Range, class Iterator=decltype(std::begin(std::declval<Range&>())),
+        class=decltype(std::declval<const keyed_sort_adaptor&>()(std::declval<Iterator>(), std::declval<Iterator>()))>
+    void operator()(Range&& r) const
+    {
+        (*this)(std::begin(r), std::end(r));
+    }
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(keyed_sort, detail::make<keyed_sort_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
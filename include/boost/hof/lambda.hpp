@@ -44,11 +44,16 @@
 /// This helps prevent possible ODR-violations.
 ///
 /// By default, all functions defined with `BOOST_HOF_STATIC_LAMBDA_FUNCTION` use
-/// the `boost::hof::reveal` adaptor to improve error messages.
+/// the `boost::hof::reveal` adaptor to improve error messages. This can be
+/// disabled by defining `BOOST_HOF_REVEAL_STATIC_FUNCTIONS` to 0.
 /// 
 /// Note: due to compiler limitations, a global function declared with
 /// `BOOST_HOF_STATIC_LAMBDA_FUNCTION` is not guaranteed to have a unique 
 /// address across translation units when compiled with pre-C++17 MSVC.
+///
+/// When `BOOST_HOF_HAS_INLINE_LAMBDAS` is enabled, which is the default for
+/// C++17 on gcc and clang, this is the same as `BOOST_HOF_STATIC_FUNCTION`,
+/// so the lambda is called directly instead of through a wrapper.
 /// 
 /// Example
 /// -------
@@ -67,8 +72,11 @@
 
 #include <boost/hof/config.hpp>
 
-// TODO: Move this to a detail header
-#if !BOOST_HOF_HAS_CONSTEXPR_LAMBDA || !BOOST_HOF_HAS_INLINE_LAMBDAS
+// With constexpr lambdas that have external linkage, the lambdas are used
+// directly, so none of the wrappers are needed
+#if BOOST_HOF_HAS_CONSTEXPR_LAMBDA && BOOST_HOF_HAS_INLINE_LAMBDAS
+#include <boost/hof/function.hpp>
+#else
 
 #include <type_traits>
 #include <utility>
@@ -104,7 +112,7 @@ struct static_function_wrapper
     {};
 
     template<class... Ts>
-    const F& base_function(Ts&&...) const
+    BOOST_HOF_INLINE const F& base_function(Ts&&...) const noexcept
     {
         return reinterpret_cast<const F&>(*this);
     }
@@ -112,7 +120,7 @@ struct static_function_wrapper
     BOOST_HOF_RETURNS_CLASS(static_function_wrapper);
 
     template<class... Ts>
-    BOOST_HOF_SFINAE_RESULT(const F&, id_<Ts>...) 
+    BOOST_HOF_INLINE BOOST_HOF_SFINAE_RESULT(const F&, id_<Ts>...) 
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         BOOST_HOF_RETURNS_REINTERPRET_CAST(const F&)(*BOOST_HOF_CONST_THIS)(BOOST_HOF_FORWARD(Ts)(xs)...)
@@ -205,20 +213,20 @@ struct reveal_static_lambda_function_wrapper_factor
     {}
 #if BOOST_HOF_REWRITE_STATIC_LAMBDA
     template<class F>
-    constexpr reveal_adaptor<typename rewrite_lambda<F>::type> 
+    constexpr typename reveal_static<typename rewrite_lambda<F>::type>::type
     operator=(const F&) const
     {
-        return reveal_adaptor<typename rewrite_lambda<F>::type>();
+        return typename reveal_static<typename rewrite_lambda<F>::type>::type();
     }
 #elif BOOST_HOF_HAS_CONST_FOLD
     template<class F>
-    constexpr const reveal_adaptor<F>& operator=(const F&) const
+    constexpr const typename reveal_static<F>::type& operator=(const F&) const
     {
-        return reinterpret_cast<const reveal_adaptor<F>&>(static_const_var<T>());
+        return reinterpret_cast<const typename reveal_static<F>::type&>(static_const_var<T>());
     }
 #else
     template<class F>
-    constexpr reveal_adaptor<static_function_wrapper<F>> operator=(const F&) const
+    constexpr typename reveal_static<static_function_wrapper<F>>::type operator=(const F&) const
     {
         return {};
     }
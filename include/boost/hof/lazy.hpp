@@ -74,18 +74,22 @@
 #include <boost/hof/detail/compressed_pair.hpp>
 #include <boost/hof/pack.hpp>
 #include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/holder.hpp>
 #include <boost/hof/detail/static_const_var.hpp>
 #include <functional>
 #include <type_traits>
 
 namespace boost { namespace hof {
 
+template<class F>
+struct protect_adaptor;
+
 namespace detail {
 
 struct placeholder_transformer
 {
     template<class T, typename std::enable_if<(std::is_placeholder<T>::value > 0), int>::type = 0>
-    constexpr detail::make_args_f<std::size_t, std::is_placeholder<T>::value> operator()(const T&) const noexcept
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr detail::make_args_f<std::size_t, std::is_placeholder<T>::value> operator()(const T&) const noexcept
     {
         return {};
     }
@@ -94,7 +98,7 @@ struct placeholder_transformer
 struct bind_transformer
 {
     template<class T, typename std::enable_if<std::is_bind_expression<T>::value, int>::type = 0>
-    constexpr const T& operator()(const T& x) const noexcept
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr const T& operator()(const T& x) const noexcept
     {
         return x;
     }
@@ -103,48 +107,185 @@ struct bind_transformer
 struct ref_transformer
 {
     template<class T>
-    constexpr auto operator()(std::reference_wrapper<T> x) const 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(std::reference_wrapper<T> x) const 
     BOOST_HOF_SFINAE_RETURNS(boost::hof::always_ref(x.get()));
 };
 
 struct id_transformer
 {
     template<class T>
-    constexpr auto operator()(T&& x) const 
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(T&& x) const 
     BOOST_HOF_SFINAE_RETURNS(always_detail::always_base<T>(BOOST_HOF_FORWARD(T)(x)));
 };
 
 BOOST_HOF_DECLARE_STATIC_VAR(pick_transformer, first_of_adaptor<placeholder_transformer, bind_transformer, ref_transformer, id_transformer>);
 
+template<class F, class Pack>
+struct lazy_invoker;
+
+template<class T>
+struct is_lazy_invoker
+: std::false_type
+{};
+
+template<class F, class Pack>
+struct is_lazy_invoker<lazy_invoker<F, Pack>>
+: std::true_type
+{};
+
+template<class T>
+struct is_reference_wrapper
+: std::false_type
+{};
+
+template<class T>
+struct is_reference_wrapper<std::reference_wrapper<T>>
+: std::true_type
+{};
+
+// The kind of each argument is selected from its type, in the same order as
+// the transformers in pick_transformer, so the arguments don't go through
+// overload resolution when the expression is called.
+template<class T>
+struct lazy_kind
+: std::integral_constant<int, 
+    (std::is_placeholder<T>::value > 0) ? 0 :
+    is_lazy_invoker<T>::value ? 1 :
+    std::is_bind_expression<T>::value ? 2 :
+    is_reference_wrapper<T>::value ? 3 :
+    4
+>
+{};
+
+// A protected function is passed as it is, so the other kinds aren't
+// checked for it
+template<class F>
+struct lazy_kind<protect_adaptor<F>>
+: std::integral_constant<int, 4>
+{};
+
+template<int Kind>
+struct lazy_eval;
+
+template<>
+struct lazy_eval<0>
+{
+    template<class T, class Pack>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE static constexpr auto call(const T&, const Pack& p) BOOST_HOF_RETURNS
+    (
+        p(detail::make_args_f<std::size_t, std::is_placeholder<T>::value>())
+    );
+};
+
+template<>
+struct lazy_eval<2>
+{
+    template<class T, class Pack>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE static constexpr auto call(const T& x, const Pack& p) BOOST_HOF_RETURNS
+    (
+        p(x)
+    );
+};
+
+template<>
+struct lazy_eval<3>
+{
+    template<class T, class Pack>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE static constexpr T& call(std::reference_wrapper<T> x, const Pack&) noexcept
+    {
+        return x.get();
+    }
+};
+
+template<>
+struct lazy_eval<4>
+{
+    template<class T, class Pack>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE static constexpr T&& call(T&& x, const Pack&) noexcept
+    {
+        return BOOST_HOF_FORWARD(T)(x);
+    }
+};
+
 template<class T, class Pack>
-constexpr auto lazy_transform(T&& x, const Pack& p) BOOST_HOF_RETURNS
+BOOST_HOF_HOST_DEVICE constexpr auto lazy_transform(T&& x, const Pack& p) BOOST_HOF_RETURNS
 (
-    p(boost::hof::detail::pick_transformer(BOOST_HOF_FORWARD(T)(x)))
+    boost::hof::detail::lazy_eval<lazy_kind<typename std::decay<T>::type>::value>::call(BOOST_HOF_FORWARD(T)(x), p)
 );
 
+// A function with a `lazy_deferred_tag` is passed each argument as a nullary
+// function that evaluates it, so the function decides which arguments are
+// evaluated, such as for the short-circuiting operators.
+template<class F, class=void>
+struct is_lazy_deferred
+: std::false_type
+{};
+
+template<class F>
+struct is_lazy_deferred<F, typename holder<typename F::lazy_deferred_tag>::type>
+: std::true_type
+{};
+
+template<class T, class Pack>
+struct lazy_deferred_arg
+{
+    T&& x;
+    const Pack& p;
+
+    BOOST_HOF_HOST_DEVICE constexpr lazy_deferred_arg(T&& xp, const Pack& pp) noexcept
+    : x(static_cast<T&&>(xp)), p(pp)
+    {}
+
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()() const BOOST_HOF_RETURNS
+    (
+        boost::hof::detail::lazy_transform(static_cast<T&&>(x), p)
+    );
+};
+
 template<class F, class Pack>
 struct lazy_unpack
 {
     const F& f;
     const Pack& p;
 
-    constexpr lazy_unpack(const F& fp, const Pack& pp) noexcept
+    BOOST_HOF_HOST_DEVICE constexpr lazy_unpack(const F& fp, const Pack& pp) noexcept
     : f(fp), p(pp)
     {}
 
-    template<class... Ts>
-    constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    // This is not forced to be inlined, since gcc gives a false -Warray-bounds
+    // warning when a member function pointer is called on a bound value
+    template<class... Ts, class G=F, typename std::enable_if<!is_lazy_deferred<G>::value, int>::type = 0>
+    BOOST_HOF_HOST_DEVICE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
     (
         f(lazy_transform(BOOST_HOF_FORWARD(Ts)(xs), p)...)
     );
+
+    template<class... Ts, class G=F, typename std::enable_if<is_lazy_deferred<G>::value, int>::type = 0>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        f(lazy_deferred_arg<Ts, Pack>(BOOST_HOF_FORWARD(Ts)(xs), p)...)
+    );
 };
 
 template<class F, class Pack>
-constexpr lazy_unpack<F, Pack> make_lazy_unpack(const F& f, const Pack& p) noexcept
+BOOST_HOF_HOST_DEVICE constexpr lazy_unpack<F, Pack> make_lazy_unpack(const F& f, const Pack& p) noexcept
 {
     return lazy_unpack<F, Pack>(f, p);
 }
 
+// A nested lazy expression is evaluated with the arguments of the outermost
+// call, instead of forwarding them again through its own call operator. So
+// the whole expression tree shares one pack of the arguments.
+template<>
+struct lazy_eval<1>
+{
+    template<class T, class Pack>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE static constexpr auto call(const T& x, const Pack& p) BOOST_HOF_RETURNS
+    (
+        x.get_pack()(boost::hof::detail::make_lazy_unpack(x.base_function(), p))
+    );
+};
+
 template<class F, class Pack>
 struct lazy_invoker 
 : detail::compressed_pair<F, Pack>
@@ -160,28 +301,28 @@ struct lazy_invoker
     template<class X, class Y, 
         BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(base_type, X&&, Y&&)
     >
-    constexpr lazy_invoker(X&& x, Y&& y) 
+    BOOST_HOF_HOST_DEVICE constexpr lazy_invoker(X&& x, Y&& y) 
     BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(base_type, X&&, Y&&)
     : base_type(BOOST_HOF_FORWARD(X)(x), BOOST_HOF_FORWARD(Y)(y))
     {}
 #endif
 
     template<class... Ts>
-    constexpr const F& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr const F& base_function(Ts&&... xs) const noexcept
     {
         return this->first(xs...);
     }
 
     template<class... Ts>
-    constexpr const Pack& get_pack(Ts&&... xs) const noexcept
+    BOOST_HOF_HOST_DEVICE constexpr const Pack& get_pack(Ts&&... xs) const noexcept
     {
         return this->second(xs...);
     }
 
     BOOST_HOF_RETURNS_CLASS(lazy_invoker);
 
-    template<class... Ts>
-    constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(lazy, Ts...)>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
     (
         BOOST_HOF_MANGLE_CAST(const Pack&)(BOOST_HOF_CONST_THIS->get_pack(xs...))(
             boost::hof::detail::make_lazy_unpack(
@@ -193,7 +334,7 @@ struct lazy_invoker
 };
 
 template<class F, class Pack>
-constexpr lazy_invoker<F, Pack> make_lazy_invoker(F f, Pack pack)
+BOOST_HOF_HOST_DEVICE constexpr lazy_invoker<F, Pack> make_lazy_invoker(F f, Pack pack)
 BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(lazy_invoker<F, Pack>, F&&, Pack&&)
 {
     return lazy_invoker<F, Pack>(static_cast<F&&>(f), static_cast<Pack&&>(pack));
@@ -205,22 +346,22 @@ struct lazy_nullary_invoker : F
     BOOST_HOF_INHERIT_CONSTRUCTOR(lazy_nullary_invoker, F);
 
     template<class... Ts>
-    constexpr const F& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr const F& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     BOOST_HOF_RETURNS_CLASS(lazy_nullary_invoker);
 
-    template<class... Ts>
-    constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(lazy, Ts...)>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
     (
         BOOST_HOF_MANGLE_CAST(const F&)(BOOST_HOF_CONST_THIS->base_function(xs...))()
     );
 };
 
 template<class F>
-constexpr lazy_nullary_invoker<F> make_lazy_nullary_invoker(F f)
+BOOST_HOF_HOST_DEVICE constexpr lazy_nullary_invoker<F> make_lazy_nullary_invoker(F f)
 BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(lazy_nullary_invoker<F>, F&&)
 {
     return lazy_nullary_invoker<F>(static_cast<F&&>(f));
@@ -234,15 +375,15 @@ struct lazy_adaptor : detail::callable_base<F>
     BOOST_HOF_INHERIT_CONSTRUCTOR(lazy_adaptor, detail::callable_base<F>);
 
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     BOOST_HOF_RETURNS_CLASS(lazy_adaptor);
 
     template<class T, class... Ts>
-    constexpr auto operator()(T x, Ts... xs) const BOOST_HOF_RETURNS
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(T x, Ts... xs) const BOOST_HOF_RETURNS
     (
         boost::hof::detail::make_lazy_invoker(BOOST_HOF_RETURNS_C_CAST(detail::callable_base<F>&&)(BOOST_HOF_CONST_THIS->base_function(x, xs...)), 
             boost::hof::pack_basic(BOOST_HOF_RETURNS_STATIC_CAST(T&&)(x), BOOST_HOF_RETURNS_STATIC_CAST(Ts&&)(xs)...))
@@ -250,7 +391,7 @@ struct lazy_adaptor : detail::callable_base<F>
 
     // Workaround for gcc 4.7
     template<class Unused=int>
-    constexpr detail::lazy_nullary_invoker<F> operator()() const
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr detail::lazy_nullary_invoker<F> operator()() const
     BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(
         boost::hof::detail::make_lazy_nullary_invoker(BOOST_HOF_RETURNS_C_CAST(detail::callable_base<F>&&)(
             BOOST_HOF_CONST_THIS->base_function(BOOST_HOF_RETURNS_CONSTRUCT(Unused)())
@@ -280,6 +421,8 @@ struct lazy_adaptor : detail::callable_base<F>
     
 };
 
+BOOST_HOF_DETAIL_COMPILE_MARKER(lazy, lazy_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(lazy, detail::make<lazy_adaptor>);
 
 }} // namespace boost::hof
@@ -0,0 +1,161 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    lazy_eager.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FUNCTION_LAZY_EAGER_H
+#define BOOST_HOF_GUARD_FUNCTION_LAZY_EAGER_H
+
+/// lazy_eager
+/// ==========
+///
+/// Description
+/// -----------
+///
+/// The `lazy_eager` function adaptor is like [`lazy`](lazy), except a bound
+/// `lazy` expression that doesn't depend on any placeholders is evaluated once,
+/// when the call wrapper is created, instead of on every call. The result is
+/// stored in the call wrapper in place of the expression. This is checked at
+/// compile time, so the other arguments are bound the same as `lazy`.
+///
+/// Only the expressions bound directly to `lazy_eager` are evaluated early;
+/// an expression that depends on a placeholder is kept as it is, including the
+/// expressions nested inside it. A `std::bind` expression is always kept, since
+/// its placeholders can't be inspected.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F>
+///     constexpr lazy_eager_adaptor<F> lazy_eager(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(lazy_eager(f)(xs...)(ys...) == lazy(f)(xs...)(ys...));
+///     assert(lazy_eager(f)(lazy(g)(xs...), _1)(y) == lazy(f)(g(xs...), _1)(y));
+///
+/// Where `xs...` doesn't have any placeholders.
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <string>
+///     using namespace boost::hof;
+///
+///     struct lookup_threshold
+///     {
+///         int operator()(const std::string&) const
+///         {
+///             return 5;
+///         }
+///     };
+///
+///     int main() {
+///         auto above = lazy_eager(_1 < _2)(lazy(lookup_threshold())(std::string("threshold")), _1);
+///         assert(above(6));
+///         assert(!above(4));
+///     }
+///
+
+#include <boost/hof/lazy.hpp>
+#include <boost/hof/detail/and.hpp>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+// Whether an expression needs the arguments of the call to be evaluated
+template<class T>
+struct lazy_depends
+: std::integral_constant<bool,
+    (std::is_placeholder<T>::value > 0) ||
+    (std::is_bind_expression<T>::value && !is_lazy_invoker<T>::value)
+>
+{};
+
+template<class F>
+struct lazy_depends<lazy_nullary_invoker<F>>
+: std::false_type
+{};
+
+template<class F, class Seq, class... Ts>
+struct lazy_depends<lazy_invoker<F, pack_base<Seq, Ts...>>>
+: std::integral_constant<bool, !BOOST_HOF_AND_UNPACK((!lazy_depends<typename std::decay<Ts>::type>::value))>
+{};
+
+template<class T>
+struct lazy_is_hoisted
+: std::integral_constant<bool,
+    std::is_bind_expression<T>::value && !lazy_depends<T>::value
+>
+{};
+
+template<class T, typename std::enable_if<lazy_is_hoisted<typename std::decay<T>::type>::value, int>::type = 0>
+constexpr auto lazy_hoist(T&& x) BOOST_HOF_RETURNS
+(
+    BOOST_HOF_FORWARD(T)(x)()
+);
+
+template<class T, typename std::enable_if<!lazy_is_hoisted<typename std::decay<T>::type>::value, int>::type = 0>
+constexpr T&& lazy_hoist(T&& x) noexcept
+{
+    return BOOST_HOF_FORWARD(T)(x);
+}
+
+}
+
+template<class F>
+struct lazy_eager_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(lazy_eager_adaptor, detail::callable_base<F>);
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    BOOST_HOF_RETURNS_CLASS(lazy_eager_adaptor);
+
+    template<class T, class... Ts>
+    BOOST_HOF_INLINE constexpr auto operator()(T x, Ts... xs) const BOOST_HOF_RETURNS
+    (
+        boost::hof::detail::make_lazy_invoker(BOOST_HOF_RETURNS_C_CAST(detail::callable_base<F>&&)(BOOST_HOF_CONST_THIS->base_function(x, xs...)),
+            boost::hof::pack_basic(
+                boost::hof::detail::lazy_hoist(BOOST_HOF_RETURNS_STATIC_CAST(T&&)(x)),
+                boost::hof::detail::lazy_hoist(BOOST_HOF_RETURNS_STATIC_CAST(Ts&&)(xs))...
+            ))
+    );
+
+    template<class Unused=int>
+    BOOST_HOF_INLINE constexpr detail::lazy_nullary_invoker<F> operator()() const
+    BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(
+        boost::hof::detail::make_lazy_nullary_invoker(BOOST_HOF_RETURNS_C_CAST(detail::callable_base<F>&&)(
+            BOOST_HOF_CONST_THIS->base_function(BOOST_HOF_RETURNS_CONSTRUCT(Unused)())
+        ))
+    )
+    {
+        return boost::hof::detail::make_lazy_nullary_invoker((detail::callable_base<F>&&)(
+            this->base_function(Unused())
+        ));
+    }
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(lazy_eager, detail::make<lazy_eager_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
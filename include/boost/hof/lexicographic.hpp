@@ -0,0 +1,295 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    lexicographic.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_LEXICOGRAPHIC_H
+#define BOOST_HOF_GUARD_LEXICOGRAPHIC_H
+
+/// lexicographic
+/// =============
+///
+/// Description
+/// -----------
+///
+/// The `lexicographic` function adaptor takes a comparator for each field,
+/// and returns a comparator of two sequences that compares them field by
+/// field. The sequences can be anything that can be [unpacked](unpack),
+/// such as a `std::tuple`, a [`pack`](pack) or an aggregate in C++17, and
+/// must have a field for each comparator. The first field where one is less
+/// than the other decides the result, and the fields after it aren't
+/// compared. When no comparators are given, every field is compared with
+/// `<`.
+///
+/// When no comparators are given and the fields are all unsigned integers
+/// that fit in 64 bits together, or 128 bits when the compiler has
+/// `__int128`, the fields of each sequence are shifted into a single wide
+/// integer, so the sequences are compared with one compare and no branch.
+///
+/// The comparator is a strict weak ordering when the comparators are, so it
+/// can be used with `std::sort` or as the comparator of a `std::map`.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Compares>
+///     constexpr lexicographic_adaptor<Compares...> lexicographic(Compares... cmps);
+///
+/// Semantics
+/// ---------
+///
+///     assert(lexicographic(cmps...)(a, b) ==
+///         (cmp0(a0, b0) || (!cmp0(b0, a0) && lexicographic(cmps1...)(a1..., b1...))));
+///
+/// Requirements
+/// ------------
+///
+/// Compares must be:
+///
+/// * [ConstInvocable](ConstInvocable) with two fields
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <algorithm>
+///     #include <cassert>
+///     #include <functional>
+///     #include <string>
+///     #include <tuple>
+///     #include <vector>
+///
+///     int main() {
+///         typedef std::tuple<int, std::string> row;
+///         std::vector<row> v = { row(2, "a"), row(1, "b"), row(2, "c") };
+///         std::sort(v.begin(), v.end(), boost::hof::lexicographic(std::greater<int>(), std::less<std::string>()));
+///         assert(v[0] == row(2, "a"));
+///         assert(v[1] == row(2, "c"));
+///         assert(v[2] == row(1, "b"));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [unpack](unpack)
+/// * [proj](proj)
+///
+
+#include <boost/hof/arg.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/returns.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/detail/type_at.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class... Ts>
+struct lex_fields
+{
+    static constexpr std::size_t size = sizeof...(Ts);
+};
+
+struct lex_fields_f
+{
+    template<class... Ts>
+    constexpr lex_fields<typename std::decay<Ts>::type...> operator()(Ts&&...) const noexcept
+    {
+        return {};
+    }
+};
+
+template<class Sequence>
+struct lex_fields_of
+{
+    typedef decltype(boost::hof::unpack(lex_fields_f())(std::declval<const Sequence&>())) type;
+};
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 lex_wide;
+#else
+typedef std::uint64_t lex_wide;
+#endif
+
+template<class... Ts>
+struct lex_bits;
+
+template<>
+struct lex_bits<>
+: std::integral_constant<std::size_t, 0>
+{};
+
+template<class T, class... Ts>
+struct lex_bits<T, Ts...>
+: std::integral_constant<std::size_t, std::numeric_limits<T>::digits + lex_bits<Ts...>::value>
+{};
+
+template<class... Ts>
+struct lex_all_unsigned;
+
+template<>
+struct lex_all_unsigned<>
+: std::true_type
+{};
+
+template<class T, class... Ts>
+struct lex_all_unsigned<T, Ts...>
+: std::integral_constant<bool, std::is_integral<T>::value && std::is_unsigned<T>::value && lex_all_unsigned<Ts...>::value>
+{};
+
+// The integer that holds all the fields, or void when they aren't unsigned
+// integers that fit in one
+template<class Fields, class=void>
+struct lex_key_type
+{
+    typedef void type;
+};
+
+template<class T, class... Ts>
+struct lex_key_type<lex_fields<T, Ts...>, typename std::enable_if<
+    lex_all_unsigned<T, Ts...>::value &&
+    (lex_bits<T, Ts...>::value <= std::numeric_limits<lex_wide>::digits)
+>::type>
+{
+    typedef typename std::conditional<(lex_bits<T, Ts...>::value <= 64), std::uint64_t, lex_wide>::type type;
+};
+
+// Shifts the fields into the key, so the first field is the most significant
+template<class Key>
+struct lex_key_f
+{
+    template<class T>
+    constexpr Key operator()(T x) const noexcept
+    {
+        return Key(x);
+    }
+
+    template<class T, class U, class... Ts>
+    constexpr Key operator()(T x, U y, Ts... xs) const noexcept
+    {
+        return (*this)(Key((Key(x) << std::numeric_limits<U>::digits) | Key(y)), xs...);
+    }
+};
+
+struct lex_less_f
+{
+    template<class T, class U>
+    constexpr auto operator()(const T& x, const U& y) const BOOST_HOF_RETURNS
+    (x < y);
+};
+
+template<std::size_t I, class Sequence>
+constexpr auto lex_field(const Sequence& s) BOOST_HOF_RETURNS
+(
+    boost::hof::unpack(make_args_f<std::size_t, I+1>())(s)
+);
+
+template<std::size_t I, std::size_t N>
+struct lex_step
+{
+    template<class Compare, class Sequence1, class Sequence2>
+    static constexpr bool less(const Compare& c, const Sequence1& a, const Sequence2& b)
+    {
+        return c.template cmp<I>()(lex_field<I>(a), lex_field<I>(b)) ||
+            (!c.template cmp<I>()(lex_field<I>(b), lex_field<I>(a)) && lex_step<I+1, N>::less(c, a, b));
+    }
+};
+
+template<std::size_t N>
+struct lex_step<N, N>
+{
+    template<class Compare, class Sequence1, class Sequence2>
+    static constexpr bool less(const Compare&, const Sequence1&, const Sequence2&) noexcept
+    {
+        return false;
+    }
+};
+
+template<class S, class... Cs>
+struct lexicographic_adaptor_base;
+
+template<std::size_t... Ns, class... Cs>
+struct lexicographic_adaptor_base<seq<Ns...>, Cs...>
+: pack_base<seq<Ns...>, callable_base<Cs>...>
+{
+    typedef pack_base<seq<Ns...>, callable_base<Cs>...> base_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(lexicographic_adaptor_base, base_type)
+
+    template<std::size_t I>
+    constexpr const callable_base<typename type_at<I, Cs...>::type>& cmp() const noexcept
+    {
+        return boost::hof::alias_value<pack_tag<seq<I>, callable_base<Cs>...>, callable_base<typename type_at<I, Cs...>::type>>(*this);
+    }
+
+    template<class Sequence1, class Sequence2, class=typename std::enable_if<
+        lex_fields_of<Sequence1>::type::size == sizeof...(Cs) &&
+        lex_fields_of<Sequence2>::type::size == sizeof...(Cs)
+    >::type>
+    constexpr bool operator()(const Sequence1& a, const Sequence2& b) const
+    {
+        return lex_step<0, sizeof...(Cs)>::less(*this, a, b);
+    }
+};
+
+template<>
+struct lexicographic_adaptor_base<seq<>>
+{
+    template<std::size_t I>
+    constexpr lex_less_f cmp() const noexcept
+    {
+        return {};
+    }
+
+    template<class Sequence1, class Sequence2>
+    constexpr bool less(const Sequence1& a, const Sequence2& b, std::true_type) const
+    {
+        typedef typename lex_key_type<typename lex_fields_of<Sequence1>::type>::type key;
+        return boost::hof::unpack(lex_key_f<key>())(a) < boost::hof::unpack(lex_key_f<key>())(b);
+    }
+
+    template<class Sequence1, class Sequence2>
+    constexpr bool less(const Sequence1& a, const Sequence2& b, std::false_type) const
+    {
+        return lex_step<0, lex_fields_of<Sequence1>::type::size>::less(*this, a, b);
+    }
+
+    template<class Sequence1, class Sequence2,
+        class Fields=typename lex_fields_of<Sequence1>::type,
+        class=typename std::enable_if<Fields::size == lex_fields_of<Sequence2>::type::size>::type>
+    constexpr bool operator()(const Sequence1& a, const Sequence2& b) const
+    {
+        return this->less(a, b, std::integral_constant<bool,
+            std::is_same<Fields, typename lex_fields_of<Sequence2>::type>::value &&
+            !std::is_void<typename lex_key_type<Fields>::type>::value
+        >());
+    }
+};
+
+}
+
+template<class... Cs>
+struct lexicographic_adaptor
+: detail::lexicographic_adaptor_base<typename detail::gens<sizeof...(Cs)>::type, Cs...>
+{
+    typedef detail::lexicographic_adaptor_base<typename detail::gens<sizeof...(Cs)>::type, Cs...> base_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(lexicographic_adaptor, base_type)
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(lexicographic, detail::make<lexicographic_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
@@ -29,6 +29,22 @@
 /// lambda. Instead, `BOOST_HOF_LIFT_CLASS` can be used. In C++17, there is no such
 /// limitation.
 /// 
+/// With C++20 concepts, the call operators are constrained with a
+/// `requires` clause and deduce the result with `decltype(auto)`, so the
+/// call expression is not part of the signature that is deduced for each
+/// call. They are also always inlined in the builds that enable
+/// `BOOST_HOF_INLINE`, so no extra call frame is left in a debug build with
+/// `BOOST_HOF_DEBUG_PERF`.
+/// 
+/// In C++17, a function that isn't overloaded can also be lifted without a
+/// macro with `lift<&fn>`. For a function pointer, the call operator takes
+/// the parameters of the function, so there is no deduction at all, and it
+/// calls the function directly. For a member pointer, such as
+/// `lift<&row::id>`, an object of the class is accessed with the member
+/// pointer directly, without the overloads of [`apply`](apply), and the
+/// member pointer is a constant, so the function object is empty. Any other
+/// constant is called with `apply`.
+/// 
 /// Synopsis
 /// --------
 /// 
@@ -38,6 +54,10 @@
 ///     // Declare a class named `name` that will forward to the function
 ///     #define BOOST_HOF_LIFT_CLASS(name, ...)
 /// 
+///     // Wrap the constant in a function object
+///     template<auto F>
+///     constexpr lift_function<F> lift = {};
+/// 
 /// Example
 /// -------
 /// 
@@ -54,11 +74,26 @@
 ///         assert(max_f()(3, 4) == std::max(3, 4));
 ///     }
 /// 
+/// In C++17:
+/// 
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+/// 
+///     int twice(int x) { return 2 * x; }
+/// 
+///     int main() {
+///         auto f = boost::hof::compose(boost::hof::lift<&twice>, boost::hof::lift<&twice>);
+///         assert(f(3) == 12);
+///     }
+/// 
 
 #include <boost/hof/detail/delegate.hpp>
 #include <boost/hof/returns.hpp>
 #include <boost/hof/lambda.hpp>
 #include <boost/hof/detail/forward.hpp>
+#if BOOST_HOF_HAS_AUTO_TEMPLATE_PARAMETER
+#include <boost/hof/apply.hpp>
+#endif
 
 namespace boost { namespace hof { namespace detail {
 
@@ -68,7 +103,7 @@ struct lift_noexcept : F
     BOOST_HOF_INHERIT_CONSTRUCTOR(lift_noexcept, F);
 
     template<class... Ts>
-    constexpr auto operator()(Ts&&... xs) const
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const
     noexcept(decltype(std::declval<NoExcept>()(BOOST_HOF_FORWARD(Ts)(xs)...)){})
     -> decltype(std::declval<F>()(BOOST_HOF_FORWARD(Ts)(xs)...))
     { return F(*this)(BOOST_HOF_FORWARD(Ts)(xs)...);}
@@ -82,12 +117,95 @@ constexpr lift_noexcept<F, NoExcept> make_lift_noexcept(F f, NoExcept)
 
 }
 
+#if BOOST_HOF_HAS_AUTO_TEMPLATE_PARAMETER
+template<auto F, class FunctionType=decltype(F)>
+struct lift_function
+{
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const
+    BOOST_HOF_RETURNS(boost::hof::apply(F, BOOST_HOF_FORWARD(Ts)(xs)...));
+};
+
+namespace detail {
+
+template<class C, class... Ts>
+struct lift_member_direct
+: std::false_type
+{};
+
+template<class C, class T, class... Ts>
+struct lift_member_direct<C, T, Ts...>
+: std::is_base_of<C, typename std::decay<T>::type>
+{};
+
+// An object of the class is accessed directly with the member pointer,
+// and the pointers and reference wrappers are called with apply
+template<auto F, class C, bool IsFunction>
+struct lift_member
+{
+    template<class T, class=typename std::enable_if<(lift_member_direct<C, T>::value)>::type>
+    BOOST_HOF_INLINE constexpr auto operator()(T&& x) const
+    BOOST_HOF_RETURNS(BOOST_HOF_FORWARD(T)(x).*F);
+
+    template<class T, class=typename std::enable_if<(!lift_member_direct<C, T>::value)>::type>
+    BOOST_HOF_INLINE constexpr auto operator()(T&& x) const
+    BOOST_HOF_RETURNS(boost::hof::apply(F, BOOST_HOF_FORWARD(T)(x)));
+};
+
+template<auto F, class C>
+struct lift_member<F, C, true>
+{
+    template<class T, class... Ts, class=typename std::enable_if<(lift_member_direct<C, T>::value)>::type>
+    BOOST_HOF_INLINE constexpr auto operator()(T&& x, Ts&&... xs) const
+    BOOST_HOF_RETURNS((BOOST_HOF_FORWARD(T)(x).*F)(BOOST_HOF_FORWARD(Ts)(xs)...));
+
+    template<class T, class... Ts, class=typename std::enable_if<(!lift_member_direct<C, T>::value)>::type>
+    BOOST_HOF_INLINE constexpr auto operator()(T&& x, Ts&&... xs) const
+    BOOST_HOF_RETURNS(boost::hof::apply(F, BOOST_HOF_FORWARD(T)(x), BOOST_HOF_FORWARD(Ts)(xs)...));
+};
+
+}
+
+template<auto F, class R, class C>
+struct lift_function<F, R C::*>
+: detail::lift_member<F, C, std::is_function<R>::value>
+{};
+
+template<auto F, class R, class... Args>
+struct lift_function<F, R(*)(Args...)>
+{
+    BOOST_HOF_INLINE constexpr R operator()(Args... xs) const
+    {
+        return F(static_cast<Args&&>(xs)...);
+    }
+};
+
+#if defined(__cpp_noexcept_function_type)
+template<auto F, class R, class... Args>
+struct lift_function<F, R(*)(Args...) noexcept>
+{
+    BOOST_HOF_INLINE constexpr R operator()(Args... xs) const noexcept
+    {
+        return F(static_cast<Args&&>(xs)...);
+    }
+};
+#endif
+
+template<auto F>
+BOOST_HOF_STATIC_CONSTEXPR lift_function<F> lift = {};
+#endif
+
 }} // namespace boost::hof
 
 #define BOOST_HOF_LIFT_IS_NOEXCEPT(...) std::integral_constant<bool, noexcept(decltype(__VA_ARGS__)(__VA_ARGS__))>{}
 
 #if defined (_MSC_VER)
 #define BOOST_HOF_LIFT(...) (BOOST_HOF_STATIC_LAMBDA { BOOST_HOF_LIFT_CLASS(fit_local_lift_t, __VA_ARGS__); return fit_local_lift_t(); }())
+#elif BOOST_HOF_HAS_CONCEPTS
+#define BOOST_HOF_LIFT(...) (BOOST_HOF_STATIC_LAMBDA(auto&&... xs) \
+    noexcept(noexcept((__VA_ARGS__)(BOOST_HOF_FORWARD(decltype(xs))(xs)...))) BOOST_HOF_INLINE -> decltype(auto) \
+    requires requires { (__VA_ARGS__)(BOOST_HOF_FORWARD(decltype(xs))(xs)...); } \
+    { return (__VA_ARGS__)(BOOST_HOF_FORWARD(decltype(xs))(xs)...); })
 #elif defined (__clang__)
 #define BOOST_HOF_LIFT(...) (boost::hof::detail::make_lift_noexcept( \
     BOOST_HOF_STATIC_LAMBDA(auto&&... xs) \
@@ -99,12 +217,24 @@ constexpr lift_noexcept<F, NoExcept> make_lift_noexcept(F f, NoExcept)
 #define BOOST_HOF_LIFT(...) (BOOST_HOF_STATIC_LAMBDA(auto&&... xs) BOOST_HOF_RETURNS((__VA_ARGS__)(BOOST_HOF_FORWARD(decltype(xs))(xs)...)))
 #endif
 
+#if BOOST_HOF_HAS_CONCEPTS
 #define BOOST_HOF_LIFT_CLASS(name, ...) \
 struct name \
 { \
     template<class... Ts> \
-    constexpr auto operator()(Ts&&... xs) const \
+    BOOST_HOF_INLINE constexpr decltype(auto) operator()(Ts&&... xs) const \
+    noexcept(noexcept((__VA_ARGS__)(BOOST_HOF_FORWARD(Ts)(xs)...))) \
+    requires requires { (__VA_ARGS__)(BOOST_HOF_FORWARD(Ts)(xs)...); } \
+    { return (__VA_ARGS__)(BOOST_HOF_FORWARD(Ts)(xs)...); } \
+}
+#else
+#define BOOST_HOF_LIFT_CLASS(name, ...) \
+struct name \
+{ \
+    template<class... Ts> \
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const \
     BOOST_HOF_RETURNS((__VA_ARGS__)(BOOST_HOF_FORWARD(Ts)(xs)...)) \
 }
+#endif
 
 #endif
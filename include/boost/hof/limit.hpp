@@ -89,15 +89,15 @@ struct limit_adaptor : detail::callable_base<F>
     BOOST_HOF_INHERIT_CONSTRUCTOR(limit_adaptor, detail::callable_base<F>)
 
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     BOOST_HOF_RETURNS_CLASS(limit_adaptor);
 
     template<class... Ts, class=typename std::enable_if<(sizeof...(Ts) <= N)>::type>
-    constexpr BOOST_HOF_SFINAE_RESULT(const detail::callable_base<F>&, id_<Ts>...) 
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(const detail::callable_base<F>&, id_<Ts>...) 
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         (BOOST_HOF_MANGLE_CAST(const detail::callable_base<F>&)(BOOST_HOF_CONST_THIS->base_function(xs...)))
@@ -112,7 +112,8 @@ struct make_limit_f
     constexpr make_limit_f()
     {}
     template<class F>
-    constexpr limit_adaptor<N, F> operator()(F f) const
+    BOOST_HOF_INLINE constexpr limit_adaptor<N, F> operator()(F f) const
+    BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(limit_adaptor<N, F>, F&&)
     {
         return limit_adaptor<N, F>(static_cast<F&&>(f));
     }
@@ -121,7 +122,7 @@ struct make_limit_f
 struct limit_f
 {
     template<class IntegralConstant, std::size_t N=IntegralConstant::type::value>
-    constexpr make_limit_f<N> operator()(IntegralConstant) const
+    BOOST_HOF_INLINE constexpr make_limit_f<N> operator()(IntegralConstant) const
     {
         return {};
     }
@@ -131,6 +132,7 @@ struct limit_f
 
 template<std::size_t N, class F>
 constexpr detail::limit_adaptor<N, F> limit_c(F f)
+BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(detail::limit_adaptor<N, F>, F&&)
 {
     return detail::limit_adaptor<N, F>(static_cast<F&&>(f));
 }
@@ -0,0 +1,150 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    make_table.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_MAKE_TABLE_H
+#define BOOST_HOF_GUARD_MAKE_TABLE_H
+
+/// make_table
+/// ==========
+///
+/// Description
+/// -----------
+///
+/// The `make_table` function evaluates the function for every index from 0
+/// to `N`, each passed as a `std::integral_constant`, and returns the results
+/// in a `std::array`. When the function can be evaluated in a `constexpr`
+/// context, the table is built at compile time, so it can replace the tables
+/// that are written out by hand, such as for a CRC or the bit count of a
+/// byte.
+///
+/// The `tabulated` function adaptor builds the table when it is constructed,
+/// and then calling it with an integer less than `N` loads the result from
+/// the table instead of calling the function. The function is called for any
+/// other integer, including negative ones. When the adaptor is declared
+/// `constexpr`, the table is initialized at compile time, and there is no
+/// initialization at runtime.
+///
+/// The type of the elements is the decayed result of calling the function
+/// with `std::integral_constant<std::size_t, 0>`, and the results for the
+/// other indices are converted to it.
+///
+/// Synopsis
+/// --------
+///
+///     template<std::size_t N, class F>
+///     constexpr std::array<R, N> make_table(const F& f);
+///
+///     template<std::size_t N, class F>
+///     constexpr tabulated_adaptor<N, F> tabulated(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(make_table<N>(f)[I] == f(std::integral_constant<std::size_t, I>()));
+///     assert(tabulated<N>(f)(i) == f(i));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct popcount
+///     {
+///         constexpr int operator()(unsigned x) const
+///         {
+///             return x == 0 ? 0 : int(x & 1) + (*this)(x >> 1);
+///         }
+///     };
+///
+///     int main() {
+///         constexpr auto table = boost::hof::make_table<256>(popcount());
+///         static_assert(table[255] == 8, "");
+///         constexpr auto count = boost::hof::tabulated<256>(popcount());
+///         assert(count(7) == 3);
+///         assert(count(1024) == 1);
+///     }
+///
+
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <boost/hof/always.hpp>
+#include <array>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class F>
+struct table_element
+: std::decay<decltype(std::declval<const F&>()(std::integral_constant<std::size_t, 0>()))>
+{};
+
+template<class R, class F, std::size_t... Ns>
+constexpr std::array<R, sizeof...(Ns)> make_table_seq(const F& f, seq<Ns...>)
+{
+    return {{static_cast<R>(f(std::integral_constant<std::size_t, Ns>()))...}};
+}
+
+template<std::size_t N, class F>
+struct tabulated_adaptor : detail::callable_base<F>
+{
+    typedef detail::callable_base<F> base;
+    typedef typename table_element<base>::type element_type;
+    std::array<element_type, N> table;
+
+    template<class X, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(base, X&&)>
+    constexpr tabulated_adaptor(X&& x)
+    : base(BOOST_HOF_FORWARD(X)(x)), table(make_table_seq<element_type>(static_cast<const base&>(*this), typename gens<N>::type()))
+    {}
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const base& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    // Negative integers are converted to values greater than any index, so
+    // they are passed to the function
+    template<class T, typename std::enable_if<(std::is_integral<T>::value), int>::type = 0>
+    BOOST_HOF_INLINE constexpr element_type operator()(T i) const
+    {
+        return static_cast<unsigned long long>(i) < N ?
+            this->table[static_cast<std::size_t>(i)] :
+            static_cast<element_type>(this->base_function(i)(i));
+    }
+};
+
+}
+
+template<std::size_t N, class F>
+constexpr std::array<typename detail::table_element<F>::type, N> make_table(const F& f)
+{
+    return detail::make_table_seq<typename detail::table_element<F>::type>(f, typename detail::gens<N>::type());
+}
+
+template<std::size_t N, class F>
+constexpr detail::tabulated_adaptor<N, F> tabulated(F f)
+{
+    return detail::tabulated_adaptor<N, F>(static_cast<F&&>(f));
+}
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,129 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    map.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_MAP_H
+#define BOOST_HOF_GUARD_MAP_H
+
+/// map
+/// ===
+///
+/// Description
+/// -----------
+///
+/// The `map` function returns a lazy view of a range, where each element is
+/// the result of calling the function on the element of the range. Nothing
+/// is evaluated until the view is consumed, for example by
+/// [`fold_into`](fold_into), and then the function is called once for each
+/// element, in the same loop as the other stages of the pipeline, so no
+/// intermediate container is created.
+///
+/// The function is [pipable](pipable), so the range can be piped into it.
+/// An lvalue range is referred to by the view, and an rvalue range is moved
+/// into it.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Range, class F>
+///     constexpr auto map(Range&& r, F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(fold_into(map(r, f), g, init) == std::accumulate(r.begin(), r.end(), init, [](auto s, auto x) { return g(s, f(x)); }));
+///
+/// Requirements
+/// ------------
+///
+/// Range must be:
+///
+/// * A range that can be iterated with a range-based `for` loop, or another view
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <vector>
+///
+///     int main() {
+///         std::vector<int> v = { 1, 2, 3 };
+///         int r = v | boost::hof::map(boost::hof::_ * 2) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0);
+///         assert(r == 12);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [filter](filter)
+/// * [fold_into](fold_into)
+/// * [pipable](pipable)
+///
+
+#include <boost/hof/pipable.hpp>
+#include <boost/hof/detail/range_view.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class F, class Sink>
+struct map_sink
+{
+    const F& f;
+    Sink& sink;
+
+    template<class X>
+    BOOST_HOF_INLINE void operator()(X&& x) const
+    {
+        sink(f(BOOST_HOF_FORWARD(X)(x)));
+    }
+};
+
+template<class View, class F>
+struct map_view : range_view_base
+{
+    View view;
+    F f;
+
+    template<class V, class G>
+    constexpr map_view(V&& v, G&& g)
+    : view(BOOST_HOF_FORWARD(V)(v)), f(BOOST_HOF_FORWARD(G)(g))
+    {}
+
+    template<class Sink>
+    BOOST_HOF_INLINE void for_each(Sink&& sink) const
+    {
+        view.for_each(map_sink<F, typename std::remove_reference<Sink>::type>{f, sink});
+    }
+};
+
+struct map_f
+{
+    template<class Range, class F>
+    constexpr map_view<typename range_view_of<Range>::type, F> operator()(Range&& r, F f) const
+    {
+        return map_view<typename range_view_of<Range>::type, F>(
+            detail::as_range_view(BOOST_HOF_FORWARD(Range)(r)), static_cast<F&&>(f)
+        );
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(map, pipable_adaptor<detail::map_f>);
+
+}} // namespace boost::hof
+
+#endif
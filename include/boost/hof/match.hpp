@@ -97,6 +97,7 @@ struct match_adaptor<F, Fs...> : detail::callable_base<F>, match_adaptor<Fs...>
 
     template<class X, class... Xs, BOOST_HOF_ENABLE_IF_CONVERTIBLE(X, detail::callable_base<F>), BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(base, Xs...)>
     constexpr match_adaptor(X&& f1, Xs&& ... fs) 
+    BOOST_HOF_NOEXCEPT(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(detail::callable_base<F>, X&&) && BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(base, Xs&&...))
     : detail::callable_base<F>(BOOST_HOF_FORWARD(X)(f1)), base(BOOST_HOF_FORWARD(Xs)(fs)...)
     {}
 
@@ -114,6 +115,8 @@ struct match_adaptor<F> : detail::callable_base<F>
     BOOST_HOF_INHERIT_CONSTRUCTOR(match_adaptor, detail::callable_base<F>);
 };
 
+BOOST_HOF_DETAIL_COMPILE_MARKER(match, match_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(match, detail::make<match_adaptor>);
 
 }} // namespace boost::hof
@@ -0,0 +1,509 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    match_value.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_MATCH_VALUE_H
+#define BOOST_HOF_GUARD_MATCH_VALUE_H
+
+/// match_value
+/// ===========
+///
+/// Description
+/// -----------
+///
+/// The `match_value` function adaptor calls the first case whose pattern is
+/// true for the arguments, like a `switch` on a value. A case is made with
+/// `case_(ps...)(f)`, where the patterns `ps` are predicates that must all
+/// be true, usually built from [placeholders](placeholders), and a function
+/// that isn't a case matches every value, so it can be the default. When no case matches,
+/// `std::out_of_range` is thrown.
+///
+/// The patterns that compare the first argument, `_1`, with an integral
+/// constant, such as `_1 == 3`, or `_1 >= 10` and `_1 < 20`, are recognized
+/// from their types at compile time, and each of them is a range of values.
+/// When the adaptor is constructed, the ranges are split into a sorted table
+/// of disjoint ranges, each of which refers to the first case that contains
+/// it, so when the first argument is an integer, the case is found with a
+/// binary search of the table, like the decision tree of a `switch`, instead
+/// of checking the patterns one after the other. The other patterns are
+/// still checked in order, but only the ones that come before the case that
+/// was found, so the first case that matches is always the one that is
+/// called.
+///
+/// The table is also skipped for a value whose comparison with a constant
+/// would convert a negative value to an unsigned type, so the result is
+/// always the same as checking each pattern.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Ps>
+///     constexpr auto case_(Ps... ps);
+///
+///     template<class... Fs>
+///     match_value_adaptor<Fs...> match_value(Fs... fs);
+///
+/// Semantics
+/// ---------
+///
+///     assert(match_value(case_(p)(f), g)(x, xs...) == (p(x, xs...) ? f(x, xs...) : g(x, xs...)));
+///     assert(case_(p, ps...)(f) == case_(p && case_(ps...))(f));
+///
+/// Requirements
+/// ------------
+///
+/// Ps must be:
+///
+/// * [ConstInvocable](ConstInvocable) returning a value that converts to `bool`
+/// * MoveConstructible
+///
+/// Fs must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <string>
+///     using namespace boost::hof;
+///
+///     struct name
+///     {
+///         std::string s;
+///         std::string operator()(int) const
+///         {
+///             return s;
+///         }
+///     };
+///
+///     int main() {
+///         auto f = match_value(
+///             case_(_1 == 3)(name{"three"}),
+///             case_(_1 > 10, _1 < 20)(name{"teen"}),
+///             name{"other"}
+///         );
+///         assert(f(3) == "three");
+///         assert(f(15) == "teen");
+///         assert(f(20) == "other");
+///     }
+///
+/// References
+/// ----------
+///
+/// * [match](match)
+/// * [first_of](first_of)
+/// * [placeholders](placeholders)
+///
+
+#include <boost/hof/adaptive_first_of.hpp>
+#include <boost/hof/dispatch_index.hpp>
+#include <boost/hof/lazy.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <boost/hof/detail/and.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/holder.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/detail/type_at.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+// The patterns of a case that must all be true
+template<class P, class Q>
+struct match_both
+: compressed_pair<callable_base<P>, callable_base<Q>>
+{
+    typedef compressed_pair<callable_base<P>, callable_base<Q>> base_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(match_both, base_type)
+
+    template<class... Ts>
+    constexpr bool operator()(Ts&&... xs) const
+    {
+        return bool(this->first(xs...)(xs...)) && bool(this->second(xs...)(xs...));
+    }
+};
+
+template<class P>
+struct case_f
+{
+    P p;
+
+    template<class F>
+    constexpr probe_adaptor<P, F> operator()(F f) const
+    {
+        return probe_adaptor<P, F>(p, static_cast<F&&>(f));
+    }
+};
+
+template<class P>
+constexpr P match_all(P p)
+{
+    return p;
+}
+
+template<class P, class Q, class... Ps>
+constexpr auto match_all(P p, Q q, Ps... ps)
+-> match_both<P, decltype(detail::match_all(static_cast<Q&&>(q), static_cast<Ps&&>(ps)...))>
+{
+    return match_both<P, decltype(detail::match_all(static_cast<Q&&>(q), static_cast<Ps&&>(ps)...))>(
+        static_cast<P&&>(p), detail::match_all(static_cast<Q&&>(q), static_cast<Ps&&>(ps)...)
+    );
+}
+
+// A closed range of values, where a range that can't be kept in the table
+// isn't exact. The types of the constants are kept to check the comparisons.
+template<class... Ts>
+struct match_range
+{
+    std::intmax_t lo;
+    std::intmax_t hi;
+    bool exact;
+};
+
+enum match_kind
+{
+    match_equal,
+    match_less,
+    match_less_equal,
+    match_greater,
+    match_greater_equal
+};
+
+template<class Op>
+struct match_op;
+
+template<> struct match_op<operators::equal> : std::integral_constant<int, match_equal> {};
+template<> struct match_op<operators::less_than> : std::integral_constant<int, match_less> {};
+template<> struct match_op<operators::less_than_equal> : std::integral_constant<int, match_less_equal> {};
+template<> struct match_op<operators::greater_than> : std::integral_constant<int, match_greater> {};
+template<> struct match_op<operators::greater_than_equal> : std::integral_constant<int, match_greater_equal> {};
+
+// The kind of the comparison when the constant is on the left
+constexpr int match_flip(int kind)
+{
+    return kind == match_less ? match_greater :
+        kind == match_less_equal ? match_greater_equal :
+        kind == match_greater ? match_less :
+        kind == match_greater_equal ? match_less_equal : kind;
+}
+
+template<class T>
+match_range<T> match_make_range(int kind, const T& c)
+{
+    typedef std::numeric_limits<std::intmax_t> limits;
+    match_range<T> r = { 1, 0, true };
+    if (c < T(0) || static_cast<std::uintmax_t>(c) <= static_cast<std::uintmax_t>(limits::max()))
+    {
+        std::intmax_t x = static_cast<std::intmax_t>(c);
+        switch (kind)
+        {
+        case match_equal: r.lo = x; r.hi = x; break;
+        case match_less: if (x != limits::min()) { r.lo = limits::min(); r.hi = x - 1; } break;
+        case match_less_equal: r.lo = limits::min(); r.hi = x; break;
+        case match_greater: if (x != limits::max()) { r.lo = x + 1; r.hi = limits::max(); } break;
+        default: r.lo = x; r.hi = limits::max(); break;
+        }
+    }
+    else r.exact = false;
+    return r;
+}
+
+template<int Kind>
+struct match_compare_visitor
+{
+    template<class T, class=typename std::enable_if<std::is_integral<T>::value>::type>
+    match_range<T> operator()(simple_placeholder<1>, const T& c) const
+    {
+        return detail::match_make_range(Kind, c);
+    }
+
+    template<class T, class=typename std::enable_if<std::is_integral<T>::value>::type>
+    match_range<T> operator()(const T& c, simple_placeholder<1>) const
+    {
+        return detail::match_make_range(match_flip(Kind), c);
+    }
+};
+
+template<class... Ts, class... Us>
+match_range<Ts..., Us...> match_intersect(const match_range<Ts...>& x, const match_range<Us...>& y)
+{
+    match_range<Ts..., Us...> r = { x.lo > y.lo ? x.lo : y.lo, x.hi < y.hi ? x.hi : y.hi, x.exact && y.exact };
+    return r;
+}
+
+template<class Op, class Pack, int Kind=match_op<Op>::value>
+auto match_range_of(const lazy_invoker<Op, Pack>& p)
+-> decltype(p.get_pack()(match_compare_visitor<Kind>()))
+{
+    return p.get_pack()(match_compare_visitor<Kind>());
+}
+
+template<class P, class Q>
+auto match_range_of(const match_both<P, Q>& p)
+-> decltype(detail::match_intersect(match_range_of(p.first()), match_range_of(p.second())))
+{
+    return detail::match_intersect(match_range_of(p.first()), match_range_of(p.second()));
+}
+
+template<class T, class U>
+struct match_exact_compare
+: std::integral_constant<bool,
+    std::is_signed<decltype(std::declval<T>() + std::declval<U>())>::value ||
+    (std::is_unsigned<T>::value && std::is_unsigned<U>::value)
+>
+{};
+
+// The range of a case, when its pattern is recognized
+template<class F, class=void>
+struct match_case
+{
+    static const bool ranged = false;
+
+    template<class T>
+    struct exact
+    : std::true_type
+    {};
+
+    static match_range<> range(const F&)
+    {
+        match_range<> r = { 1, 0, false };
+        return r;
+    }
+};
+
+template<class R>
+struct match_range_exact;
+
+template<class... Ts>
+struct match_range_exact<match_range<Ts...>>
+{
+    template<class T>
+    struct apply
+    : std::integral_constant<bool, BOOST_HOF_AND_UNPACK((match_exact_compare<T, Ts>::value))>
+    {};
+};
+
+template<class P, class F>
+struct match_case<probe_adaptor<P, F>, typename holder<
+    decltype(match_range_of(std::declval<const callable_base<P>&>()))
+>::type>
+{
+    typedef decltype(match_range_of(std::declval<const callable_base<P>&>())) range_type;
+    static const bool ranged = true;
+
+    template<class T>
+    struct exact
+    : match_range_exact<range_type>::template apply<T>
+    {};
+
+    static range_type range(const probe_adaptor<P, F>& c)
+    {
+        return match_range_of(c.first());
+    }
+};
+
+template<class S, class... Fs>
+struct match_value_adaptor_base;
+
+template<std::size_t... Ns, class... Fs>
+struct match_value_adaptor_base<seq<Ns...>, Fs...>
+: pack_base<seq<Ns...>, callable_base<Fs>...>
+{
+    typedef pack_base<seq<Ns...>, callable_base<Fs>...> base_type;
+    static const std::size_t cases = sizeof...(Fs);
+    // Each range adds at most two bounds to the table
+    static const std::size_t table_size = 2 * sizeof...(Fs) + 1;
+
+    std::array<std::intmax_t, table_size> starts;
+    std::array<std::size_t, table_size> owners;
+    std::size_t table_count;
+    // The cases that are checked one after the other
+    std::array<std::size_t, sizeof...(Fs)> others;
+    std::size_t other_count;
+
+    match_value_adaptor_base(Fs... fs)
+    : base_type(static_cast<Fs&&>(fs)...), starts(), owners(), table_count(0), others(), other_count(0)
+    {
+        this->build();
+    }
+
+    template<std::size_t I, class... Ts>
+    constexpr const callable_base<typename type_at<I, Fs...>::type>& get(Ts&&... xs) const noexcept
+    {
+        return boost::hof::alias_value<pack_tag<seq<I>, callable_base<Fs>...>, callable_base<typename type_at<I, Fs...>::type>>(*this, xs...);
+    }
+
+    template<std::size_t I>
+    void add_case(std::intmax_t* lo, std::intmax_t* hi, bool* ranged)
+    {
+        typedef typename type_at<I, Fs...>::type case_type;
+        auto r = match_case<case_type>::range(this->template get<I>());
+        ranged[I] = match_case<case_type>::ranged && r.exact;
+        lo[I] = r.lo;
+        hi[I] = r.hi;
+        if (!ranged[I]) others[other_count++] = I;
+    }
+
+    void add_start(std::intmax_t x)
+    {
+        std::size_t i = 0;
+        while (i < table_count && starts[i] < x) i++;
+        if (i < table_count && starts[i] == x) return;
+        for (std::size_t j = table_count; j > i; j--) starts[j] = starts[j - 1];
+        starts[i] = x;
+        table_count++;
+    }
+
+    void build()
+    {
+        std::intmax_t lo[sizeof...(Fs)];
+        std::intmax_t hi[sizeof...(Fs)];
+        bool ranged[sizeof...(Fs)];
+        (void)std::initializer_list<int>{(this->template add_case<Ns>(lo, hi, ranged), 0)...};
+        this->add_start(std::numeric_limits<std::intmax_t>::min());
+        for (std::size_t i = 0; i < cases; i++)
+        {
+            if (!ranged[i] || lo[i] > hi[i]) continue;
+            this->add_start(lo[i]);
+            if (hi[i] != std::numeric_limits<std::intmax_t>::max()) this->add_start(hi[i] + 1);
+        }
+        // Each range of the table refers to the first case that contains it
+        for (std::size_t j = 0; j < table_count; j++)
+        {
+            owners[j] = cases;
+            for (std::size_t i = 0; i < cases && owners[j] == cases; i++)
+            {
+                if (ranged[i] && lo[i] <= starts[j] && starts[j] <= hi[i]) owners[j] = i;
+            }
+        }
+    }
+
+    std::size_t owner(std::intmax_t x) const noexcept
+    {
+        std::size_t first = 0;
+        std::size_t count = table_count;
+        while (count > 0)
+        {
+            std::size_t step = count / 2;
+            if (starts[first + step] <= x)
+            {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else count = step;
+        }
+        return owners[first - 1];
+    }
+
+    template<std::size_t I, class... Ts>
+    static bool test(const match_value_adaptor_base& self, Ts&... xs)
+    {
+        return detail::adaptive_probe_test(self.template get<I>(xs...), xs...);
+    }
+
+    template<std::size_t I, class R, class... Ts>
+    static R call(const match_value_adaptor_base& self, Ts&&... xs)
+    {
+        return self.template get<I>(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+
+    template<class T>
+    struct use_table
+    : std::integral_constant<bool, std::is_integral<T>::value &&
+        BOOST_HOF_AND_UNPACK((match_case<Fs>::template exact<T>::value))
+    >
+    {};
+
+    template<class T>
+    static bool key(const T& x, std::intmax_t& k, std::true_type) noexcept
+    {
+        if (x > T(0) && static_cast<std::uintmax_t>(x) > static_cast<std::uintmax_t>(std::numeric_limits<std::intmax_t>::max())) return false;
+        k = static_cast<std::intmax_t>(x);
+        return true;
+    }
+
+    template<class T>
+    static bool key(const T&, std::intmax_t&, std::false_type) noexcept
+    {
+        return false;
+    }
+
+    template<class T, class... Ts>
+    std::size_t find(T& x, Ts&... xs) const
+    {
+        typedef bool (*test_type)(const match_value_adaptor_base&, T&, Ts&...);
+        static constexpr test_type tests[] = { &match_value_adaptor_base::template test<Ns, T, Ts...>... };
+        std::intmax_t k = 0;
+        if (match_value_adaptor_base::key(x, k, use_table<typename std::decay<T>::type>()))
+        {
+            std::size_t o = this->owner(k);
+            for (std::size_t j = 0; j < other_count && others[j] < o; j++)
+            {
+                if (tests[others[j]](*this, x, xs...)) return others[j];
+            }
+            return o;
+        }
+        for (std::size_t i = 0; i < cases; i++)
+        {
+            if (tests[i](*this, x, xs...)) return i;
+        }
+        return cases;
+    }
+
+    template<class T, class... Ts, class R=typename dispatch_index_result<
+        decltype(std::declval<const callable_base<Fs>&>()(std::declval<T>(), std::declval<Ts>()...))...
+    >::type>
+    R operator()(T&& x, Ts&&... xs) const
+    {
+        typedef R (*call_type)(const match_value_adaptor_base&, T&&, Ts&&...);
+        static constexpr call_type entries[] = { &match_value_adaptor_base::template call<Ns, R, T, Ts...>... };
+        std::size_t i = this->find(x, xs...);
+        if (i == cases) throw std::out_of_range("No case matches the value");
+        return entries[i](*this, BOOST_HOF_FORWARD(T)(x), BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+}
+
+template<class P, class... Ps>
+constexpr auto case_(P p, Ps... ps)
+-> detail::case_f<decltype(detail::match_all(static_cast<P&&>(p), static_cast<Ps&&>(ps)...))>
+{
+    return detail::case_f<decltype(detail::match_all(static_cast<P&&>(p), static_cast<Ps&&>(ps)...))>{
+        detail::match_all(static_cast<P&&>(p), static_cast<Ps&&>(ps)...)
+    };
+}
+
+template<class... Fs>
+struct match_value_adaptor
+: detail::match_value_adaptor_base<typename detail::gens<sizeof...(Fs)>::type, Fs...>
+{
+    typedef detail::match_value_adaptor_base<typename detail::gens<sizeof...(Fs)>::type, Fs...> base_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(match_value_adaptor, base_type)
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(match_value, detail::make<match_value_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
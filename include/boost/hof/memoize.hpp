@@ -0,0 +1,530 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    memoize.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_MEMOIZE_H
+#define BOOST_HOF_GUARD_MEMOIZE_H
+
+/// memoize
+/// =======
+///
+/// Description
+/// -----------
+///
+/// The `memoize` function adaptor caches the results of the function. The
+/// decayed arguments are used as the key of the cache, so calling the
+/// function again with equal arguments returns the cached result instead of
+/// calling the function. The result is always returned by value.
+///
+/// The cache itself is provided by a storage policy, which defaults to
+/// `memoize_unordered_map`. The library also provides
+/// `memoize_direct_mapped<N>`, which is a fixed-size cache where each key can
+/// only be stored in one slot, and `memoize_lru`, which evicts the least
+/// recently used entry once it reaches its capacity. These are not safe to
+/// call concurrently.
+///
+/// For functions that are called from several threads, `memoize_sharded<N>`
+/// splits the cache into `N` shards, each with its own lock, so lookups of
+/// keys in different shards do not contend. It counts the hits and misses of
+/// each shard, which are shared by the copies of the storage object, so they
+/// can be read with `hits(i)` and `misses(i)` from the storage that was
+/// passed to `memoize`.
+///
+/// A separate cache is used for each set of argument types that the function
+/// is called with. Copies of the adaptor share the same cache.
+///
+/// When the function is a [`fix`](fix) adaptor, the function is passed the
+/// memoized function as the first parameter, so the recursive calls use the
+/// cache as well. The return type of the function must not depend on the
+/// type of that first parameter, so it needs to be stated explicitly or given
+/// with [`result`](result).
+///
+/// Synopsis
+/// --------
+///
+///     template<class F, class Storage>
+///     memoize_adaptor<F, Storage> memoize(F f, Storage s);
+///
+///     template<class F>
+///     memoize_adaptor<F> memoize(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(memoize(f)(xs...) == f(xs...));
+///     assert(memoize(fix(f))(xs...) == f(memoize(fix(f)), xs...));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// The decayed arguments must be:
+///
+/// * CopyConstructible
+/// * EqualityComparable
+/// * Hashable with `std::hash`
+///
+/// Storage must be:
+///
+/// * CopyConstructible
+/// * Provide a `cache<Key, Value>` class template that is constructible from
+///   `const Storage&`, and has the member functions `const Value* find(const
+///   Key&)`, which returns a null pointer when the key is not cached, and `void
+///   insert(Key, Value)`.
+/// * Declare a `memoize_concurrent_tag` type, if the cache can be used
+///   concurrently.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct fib_f
+///     {
+///         template<class Self>
+///         long long operator()(Self self, int n) const
+///         {
+///             return n < 2 ? n : self(n - 1) + self(n - 2);
+///         }
+///     };
+///     int main() {
+///         auto fib = boost::hof::memoize(boost::hof::fix(fib_f()));
+///         assert(fib(80) == 23416728348467685);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [Memoization](https://en.wikipedia.org/wiki/Memoization)
+/// * [fix](fix)
+///
+
+#include <boost/hof/always.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/chunked_slots.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/holder.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/sharded_counter.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/fix.hpp>
+#include <boost/hof/indirect.hpp>
+#include <boost/hof/reveal.hpp>
+#include <boost/hof/unpack.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace boost { namespace hof { namespace detail {
+
+struct memoize_hash_f
+{
+    template<class... Ts>
+    BOOST_HOF_INLINE std::size_t operator()(const Ts&... xs) const
+    {
+        std::size_t seed = 0;
+        (void)std::initializer_list<int>{(
+            seed ^= std::hash<Ts>()(xs) + 0x9e3779b9 + (seed << 6) + (seed >> 2), 0
+        )...};
+        return seed;
+    }
+};
+
+template<class Key>
+struct memoize_key_hash
+{
+    BOOST_HOF_INLINE std::size_t operator()(const Key& key) const
+    {
+        return boost::hof::unpack(memoize_hash_f())(key);
+    }
+};
+
+template<class... Ts>
+struct memoize_key
+{
+    typedef std::tuple<typename std::decay<Ts>::type...> type;
+};
+
+struct memoize_cache_base
+{
+    virtual ~memoize_cache_base()
+    {}
+};
+
+template<class Cache>
+struct memoize_cache_holder : memoize_cache_base
+{
+    Cache cache;
+
+    template<class Storage>
+    memoize_cache_holder(const Storage& s) : cache(s)
+    {}
+};
+
+inline std::size_t memoize_next_id() noexcept
+{
+    static std::atomic<std::size_t> id(0);
+    return id++;
+}
+
+// Every key and value combination gets an unique index into the caches of
+// the state, so finding the cache doesn't require a lookup.
+template<class Key, class Value>
+struct memoize_id
+{
+    static std::size_t get() noexcept
+    {
+        static const std::size_t id = memoize_next_id();
+        return id;
+    }
+};
+
+template<class Storage, class=void>
+struct memoize_state
+{
+    Storage storage;
+    std::vector<std::unique_ptr<memoize_cache_base>> caches;
+
+    memoize_state(Storage s) : storage(std::move(s))
+    {}
+
+    template<class Key, class Value>
+    typename Storage::template cache<Key, Value>& get()
+    {
+        typedef memoize_cache_holder<typename Storage::template cache<Key, Value>> holder_type;
+        std::size_t id = memoize_id<Key, Value>::get();
+        if (id >= caches.size()) caches.resize(id + 1);
+        if (!caches[id]) caches[id].reset(new holder_type(storage));
+        return static_cast<holder_type&>(*caches[id]).cache;
+    }
+};
+
+// The state for storage that can be used concurrently. The caches are found
+// without locking, and the lock is only taken to create a missing cache.
+template<class Storage>
+struct memoize_state<Storage, typename holder<typename Storage::memoize_concurrent_tag>::type>
+{
+    Storage storage;
+    chunked_slots<memoize_cache_base> caches;
+
+    memoize_state(Storage s) : storage(std::move(s))
+    {}
+
+    memoize_state(const memoize_state&)=delete;
+    memoize_state& operator=(const memoize_state&)=delete;
+
+    template<class Key, class Value>
+    typename Storage::template cache<Key, Value>& get()
+    {
+        typedef memoize_cache_holder<typename Storage::template cache<Key, Value>> holder_type;
+        memoize_cache_base& c = caches.get(memoize_id<Key, Value>::get(), [this]() -> memoize_cache_base* { return new holder_type(storage); });
+        return static_cast<holder_type&>(c).cache;
+    }
+};
+
+template<class Key, class Value, class Storage, class F, class... Ts>
+Value memoize_call(memoize_state<Storage>& state, const F& f, Ts&&... xs)
+{
+    auto& cache = state.template get<Key, Value>();
+    Key key{xs...};
+    if (const Value* p = cache.find(key)) return *p;
+    Value v = f(BOOST_HOF_FORWARD(Ts)(xs)...);
+    cache.insert(std::move(key), v);
+    return v;
+}
+
+template<class Value, class F, class Self>
+struct memoize_fix_invoke
+{
+    const F& f;
+    const Self& self;
+
+    template<class... Ts>
+    BOOST_HOF_INLINE Value operator()(Ts&&... xs) const
+    {
+        return f(self, BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+template<class F, class Storage>
+struct memoize_base : F
+{
+    std::shared_ptr<memoize_state<Storage>> state;
+
+    template<class X, class S=Storage, class=typename std::enable_if<
+        !BOOST_HOF_IS_BASE_OF(memoize_base, typename std::decay<X>::type) &&
+        BOOST_HOF_IS_CONSTRUCTIBLE(F, X&&) &&
+        BOOST_HOF_IS_CONSTRUCTIBLE(Storage, S&&)
+    >::type>
+    memoize_base(X&& x, S&& s=Storage())
+    : F(BOOST_HOF_FORWARD(X)(x)), state(std::make_shared<memoize_state<Storage>>(Storage(BOOST_HOF_FORWARD(S)(s))))
+    {}
+
+    template<bool B=true, class=typename std::enable_if<B && is_default_constructible<F, Storage>::value>::type>
+    memoize_base() : F(), state(std::make_shared<memoize_state<Storage>>(Storage()))
+    {}
+};
+
+}
+
+struct memoize_unordered_map
+{
+    template<class Key, class Value>
+    struct cache
+    {
+        std::unordered_map<Key, Value, detail::memoize_key_hash<Key>> map;
+
+        explicit cache(const memoize_unordered_map&)
+        {}
+
+        const Value* find(const Key& key) const
+        {
+            auto it = map.find(key);
+            return it == map.end() ? nullptr : &it->second;
+        }
+
+        void insert(Key key, Value v)
+        {
+            map.emplace(std::move(key), std::move(v));
+        }
+    };
+};
+
+template<std::size_t N>
+struct memoize_direct_mapped
+{
+    static_assert(N > 0, "Direct-mapped cache must have at least one slot");
+
+    template<class Key, class Value>
+    struct cache
+    {
+        std::array<std::unique_ptr<std::pair<Key, Value>>, N> slots;
+
+        explicit cache(const memoize_direct_mapped&)
+        {}
+
+        std::unique_ptr<std::pair<Key, Value>>& slot(const Key& key)
+        {
+            return slots[detail::memoize_key_hash<Key>()(key) % N];
+        }
+
+        const Value* find(const Key& key)
+        {
+            auto& s = this->slot(key);
+            return s && s->first == key ? &s->second : nullptr;
+        }
+
+        void insert(Key key, Value v)
+        {
+            auto& s = this->slot(key);
+            s.reset(new std::pair<Key, Value>(std::move(key), std::move(v)));
+        }
+    };
+};
+
+struct memoize_lru
+{
+    std::size_t capacity;
+
+    constexpr explicit memoize_lru(std::size_t n) noexcept : capacity(n)
+    {}
+
+    template<class Key, class Value>
+    struct cache
+    {
+        typedef std::list<std::pair<Key, Value>> list_type;
+        // The most recently used entry is kept at the front
+        list_type entries;
+        std::unordered_map<Key, typename list_type::iterator, detail::memoize_key_hash<Key>> index;
+        std::size_t capacity;
+
+        explicit cache(const memoize_lru& s) : capacity(s.capacity)
+        {}
+
+        const Value* find(const Key& key)
+        {
+            auto it = index.find(key);
+            if (it == index.end()) return nullptr;
+            entries.splice(entries.begin(), entries, it->second);
+            return &it->second->second;
+        }
+
+        void insert(Key key, Value v)
+        {
+            if (capacity == 0) return;
+            auto it = index.find(key);
+            if (it != index.end())
+            {
+                it->second->second = std::move(v);
+                entries.splice(entries.begin(), entries, it->second);
+                return;
+            }
+            if (entries.size() == capacity)
+            {
+                index.erase(entries.back().first);
+                entries.pop_back();
+            }
+            entries.emplace_front(std::move(key), std::move(v));
+            index.emplace(entries.front().first, entries.begin());
+        }
+    };
+};
+
+template<std::size_t N=16>
+struct memoize_sharded
+{
+    static_assert(N > 0, "Sharded cache must have at least one shard");
+
+    typedef memoize_sharded memoize_concurrent_tag;
+
+    // The hits and the misses of each shard of the cache, which are counted
+    // by the shard of the counter of each thread
+    typedef detail::sharded_counter<2 * N> counter_type;
+
+    std::shared_ptr<counter_type> counters;
+
+    memoize_sharded() : counters(std::make_shared<counter_type>())
+    {}
+
+    static constexpr std::size_t shards() noexcept
+    {
+        return N;
+    }
+
+    std::size_t hits(std::size_t i) const noexcept
+    {
+        return std::size_t(counters->load(2 * i));
+    }
+
+    std::size_t misses(std::size_t i) const noexcept
+    {
+        return std::size_t(counters->load(2 * i + 1));
+    }
+
+    template<class Key, class Value>
+    struct cache
+    {
+        struct shard
+        {
+            std::mutex m;
+            std::unordered_map<Key, Value, detail::memoize_key_hash<Key>> map;
+        };
+        std::array<shard, N> shards;
+        std::shared_ptr<counter_type> counters;
+
+        explicit cache(const memoize_sharded& s) : counters(s.counters)
+        {}
+
+        static std::size_t shard_index(const Key& key)
+        {
+            std::size_t h = detail::memoize_key_hash<Key>()(key);
+            return (h ^ (h >> 16)) % N;
+        }
+
+        // Entries are never erased, so the value can still be read after the
+        // lock is released
+        const Value* find(const Key& key)
+        {
+            std::size_t i = shard_index(key);
+            std::lock_guard<std::mutex> lock(shards[i].m);
+            auto it = shards[i].map.find(key);
+            if (it == shards[i].map.end())
+            {
+                counters->add(2 * i + 1);
+                return nullptr;
+            }
+            counters->add(2 * i);
+            return &it->second;
+        }
+
+        void insert(Key key, Value v)
+        {
+            std::size_t i = shard_index(key);
+            std::lock_guard<std::mutex> lock(shards[i].m);
+            shards[i].map.emplace(std::move(key), std::move(v));
+        }
+    };
+};
+
+template<class F, class Storage=memoize_unordered_map>
+struct memoize_adaptor : detail::memoize_base<detail::callable_base<F>, Storage>
+{
+    typedef detail::memoize_base<detail::callable_base<F>, Storage> base;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(memoize_adaptor, base);
+
+    template<class... Ts>
+    BOOST_HOF_INLINE const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    struct failure
+    : failure_for<detail::callable_base<F>>
+    {};
+
+    template<class... Ts, class Value=typename std::decay<
+        decltype(std::declval<const detail::callable_base<F>&>()(std::declval<Ts>()...))
+    >::type>
+    BOOST_HOF_INLINE Value operator()(Ts&&... xs) const
+    {
+        return detail::memoize_call<typename detail::memoize_key<Ts...>::type, Value>(
+            *this->state,
+            this->base_function(xs...),
+            BOOST_HOF_FORWARD(Ts)(xs)...
+        );
+    }
+};
+
+template<class F, int Depth, class Storage>
+struct memoize_adaptor<fix_adaptor<F, Depth>, Storage>
+: detail::memoize_base<fix_adaptor<F, Depth>, Storage>
+{
+    typedef detail::memoize_base<fix_adaptor<F, Depth>, Storage> base;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(memoize_adaptor, base);
+
+    typedef indirect_adaptor<const memoize_adaptor*> self_type;
+
+    template<class... Ts>
+    BOOST_HOF_INLINE const F& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class... Ts, class Value=typename std::decay<
+        typename detail::fix_result<F>::template apply<self_type, Ts...>::type
+    >::type>
+    BOOST_HOF_INLINE Value operator()(Ts&&... xs) const
+    {
+        self_type self(this);
+        return detail::memoize_call<typename detail::memoize_key<Ts...>::type, Value>(
+            *this->state,
+            detail::memoize_fix_invoke<Value, F, self_type>{this->base_function(xs...), self},
+            BOOST_HOF_FORWARD(Ts)(xs)...
+        );
+    }
+};
+
+BOOST_HOF_DETAIL_COMPILE_MARKER(memoize, memoize_adaptor)
+
+BOOST_HOF_DECLARE_STATIC_VAR(memoize, detail::make<memoize_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,194 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    minmax.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_MINMAX_H
+#define BOOST_HOF_GUARD_MINMAX_H
+
+/// minmax
+/// ======
+///
+/// Description
+/// -----------
+///
+/// The `pack_max` and `pack_min` functions return the largest and the
+/// smallest of their arguments, which are compared with `<`. When several
+/// arguments are the largest or the smallest, the first of them is returned,
+/// like with `std::max` and `std::min`. The `minmax` function returns a
+/// `std::pair` of both, and the `clamp` function returns the value limited
+/// to the range, like `std::clamp`.
+///
+/// The arguments are reduced as a balanced tree with
+/// [`tree_fold`](tree_fold), instead of one at a time, so the compares of
+/// each level don't depend on each other. Each compare selects the value
+/// with a conditional expression, so for arithmetic types the compiler can
+/// use a conditional move or a min and max instruction instead of a branch.
+///
+/// When every argument is an lvalue of the same type, a reference to it is
+/// returned, so an argument can be assigned through the result. Otherwise,
+/// the result is a value of the common type of the arguments.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Ts>
+///     constexpr auto pack_max(Ts&&... xs);
+///
+///     template<class... Ts>
+///     constexpr auto pack_min(Ts&&... xs);
+///
+///     template<class... Ts>
+///     constexpr auto minmax(Ts&&... xs);
+///
+///     template<class T, class Low, class High>
+///     constexpr auto clamp(T&& x, Low&& low, High&& high);
+///
+/// Semantics
+/// ---------
+///
+///     assert(pack_max(x, xs...) == tree_fold([](auto x, auto y) { return (x < y) ? y : x; })(x, xs...));
+///     assert(pack_min(x, xs...) == tree_fold([](auto x, auto y) { return (y < x) ? y : x; })(x, xs...));
+///     assert(minmax(xs...) == std::make_pair(pack_min(xs...), pack_max(xs...)));
+///     assert(clamp(x, low, high) == ((x < low) ? low : (high < x) ? high : x));
+///
+/// Requirements
+/// ------------
+///
+/// The arguments must have a common type, and be ordered by `<`.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int main() {
+///         assert(boost::hof::pack_max(3, 1, 4, 1, 5) == 5);
+///         assert(boost::hof::pack_min(3, 1, 4, 1, 5) == 1);
+///         assert(boost::hof::minmax(3, 1, 4).second == 4);
+///         assert(boost::hof::clamp(7, 0, 5) == 5);
+///         int a = 1, b = 2;
+///         boost::hof::pack_max(a, b) = 0;
+///         assert(b == 0);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [tree_fold](tree_fold)
+///
+
+#include <boost/hof/tree_fold.hpp>
+#include <boost/hof/returns.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/holder.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class... Ts>
+struct minmax_same_lvalue
+: std::false_type
+{};
+
+template<class T>
+struct minmax_same_lvalue<T>
+: std::is_lvalue_reference<T>
+{};
+
+template<class T, class U, class... Ts>
+struct minmax_same_lvalue<T, U, Ts...>
+: std::integral_constant<bool, std::is_same<T, U>::value && minmax_same_lvalue<U, Ts...>::value>
+{};
+
+// A reference when every argument is an lvalue of the same type, or else
+// the common type
+template<class Enable, class... Ts>
+struct minmax_result_impl
+{};
+
+template<class T, class... Ts>
+struct minmax_result_impl<typename std::enable_if<minmax_same_lvalue<T, Ts...>::value>::type, T, Ts...>
+{
+    typedef T type;
+};
+
+template<class... Ts>
+struct minmax_result_impl<typename std::enable_if<!minmax_same_lvalue<Ts...>::value &&
+    std::is_void<typename holder<typename std::common_type<Ts...>::type>::type>::value
+>::type, Ts...>
+{
+    typedef typename std::common_type<Ts...>::type type;
+};
+
+template<class... Ts>
+struct minmax_result
+: minmax_result_impl<void, Ts...>
+{};
+
+struct max_select
+{
+    template<class T, class U>
+    constexpr auto operator()(T&& x, U&& y) const BOOST_HOF_RETURNS
+    ((x < y) ? BOOST_HOF_FORWARD(U)(y) : BOOST_HOF_FORWARD(T)(x));
+};
+
+struct min_select
+{
+    template<class T, class U>
+    constexpr auto operator()(T&& x, U&& y) const BOOST_HOF_RETURNS
+    ((y < x) ? BOOST_HOF_FORWARD(U)(y) : BOOST_HOF_FORWARD(T)(x));
+};
+
+template<class Select>
+struct minmax_reduce
+{
+    template<class... Ts, class R=typename minmax_result<Ts...>::type,
+        class=decltype(tree_fold_adaptor<Select>()(std::declval<Ts>()...))>
+    constexpr R operator()(Ts&&... xs) const
+    {
+        return tree_fold_adaptor<Select>()(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+struct minmax_f
+{
+    // The arguments are passed as lvalues to both, so an rvalue isn't moved
+    // from before the other one reads it
+    template<class... Ts, class R=typename minmax_result<Ts...>::type,
+        class=decltype(minmax_reduce<max_select>()(std::declval<Ts&>()...))>
+    constexpr std::pair<R, R> operator()(Ts&&... xs) const
+    {
+        return std::pair<R, R>(minmax_reduce<min_select>()(xs...), minmax_reduce<max_select>()(xs...));
+    }
+};
+
+struct clamp_f
+{
+    template<class T, class Low, class High, class R=typename minmax_result<T, Low, High>::type,
+        class=decltype(std::declval<T&>() < std::declval<Low&>()),
+        class=decltype(std::declval<High&>() < std::declval<T&>())>
+    constexpr R operator()(T&& x, Low&& low, High&& high) const
+    {
+        return (x < low) ? static_cast<R>(BOOST_HOF_FORWARD(Low)(low)) :
+            (high < x) ? static_cast<R>(BOOST_HOF_FORWARD(High)(high)) : static_cast<R>(BOOST_HOF_FORWARD(T)(x));
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(pack_max, detail::minmax_reduce<detail::max_select>);
+BOOST_HOF_DECLARE_STATIC_VAR(pack_min, detail::minmax_reduce<detail::min_select>);
+BOOST_HOF_DECLARE_STATIC_VAR(minmax, detail::minmax_f);
+BOOST_HOF_DECLARE_STATIC_VAR(clamp, detail::clamp_f);
+
+}} // namespace boost::hof
+
+#endif
@@ -55,11 +55,13 @@ struct mutable_adaptor
 
     BOOST_HOF_RETURNS_CLASS(mutable_adaptor);
 
-    template<class... Ts>
-    BOOST_HOF_SFINAE_RESULT(F, id_<Ts>...) 
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(mutable_, Ts...)>
+    BOOST_HOF_INLINE BOOST_HOF_SFINAE_RESULT(F, id_<Ts>...) 
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS(BOOST_HOF_CONST_THIS->f(BOOST_HOF_FORWARD(Ts)(xs)...));
 };
 
+BOOST_HOF_DETAIL_COMPILE_MARKER(mutable_, mutable_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(mutable_, detail::make<mutable_adaptor>);
 
 }} // namespace boost::hof
@@ -0,0 +1,353 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    numa_executor.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_NUMA_EXECUTOR_H
+#define BOOST_HOF_GUARD_NUMA_EXECUTOR_H
+
+/// numa_executor
+/// =============
+///
+/// Description
+/// -----------
+///
+/// The `numa_executor` is an [executor](executor) that runs the tasks on a
+/// [`work_stealing_pool`](work_stealing_executor) for each NUMA node, where
+/// the workers of a node are pinned to the CPUs of the node. The parallel
+/// adaptors, such as [`parallel_fold`](parallel_fold), give each node a
+/// contiguous block of the tasks with `submit_on`, so the state of a task
+/// stays on its node, and the tasks only steal from the workers of their own
+/// node.
+///
+/// The `numa_topology` is the CPUs of each node, which is read from
+/// `/sys/devices/system/node` on Linux. Otherwise, or when it can't be read,
+/// it is a single node. A topology can also be given, such as to test a
+/// program that is split by node on a machine with a single node, in which
+/// case the workers are usually not pinned. The memory isn't moved, so the
+/// data used by a node should be first written by the same block of tasks,
+/// so the pages are allocated on that node.
+///
+/// A task that is submitted without a node goes to the nodes in turn. Like
+/// with the `work_stealing_executor`, a thread that waits for a handle runs
+/// the tasks of the pool of the node in the meantime, which can be the task
+/// of the handle. The `this_node` function returns the node of the calling
+/// worker, or `nodes()` when it isn't called by a worker of the executor.
+///
+/// Synopsis
+/// --------
+///
+///     class numa_topology
+///     {
+///         numa_topology();
+///         explicit numa_topology(std::vector<std::vector<unsigned>> cpus);
+///         std::size_t nodes() const noexcept;
+///         const std::vector<unsigned>& cpus(std::size_t node) const;
+///         static const numa_topology& system();
+///     };
+///
+///     class numa_pool
+///     {
+///         explicit numa_pool(const numa_topology& t=numa_topology::system(), bool pin=true);
+///         std::size_t nodes() const noexcept;
+///         work_stealing_pool& node(std::size_t i) noexcept;
+///         numa_executor executor() noexcept;
+///         static numa_pool& shared();
+///     };
+///
+///     struct numa_executor
+///     {
+///         numa_executor();
+///         explicit numa_executor(numa_pool& pool);
+///         std::size_t nodes() const noexcept;
+///         std::size_t this_node() const noexcept;
+///         template<class F>
+///         handle submit(F f) const;
+///         template<class F>
+///         handle submit_on(std::size_t node, F f) const;
+///         template<class F>
+///         void execute(F f) const;
+///         template<class F>
+///         void execute_on(std::size_t node, F f) const;
+///     };
+///
+/// Requirements
+/// ------------
+///
+/// The functions that are submitted must be MoveConstructible, and the
+/// functions that are passed to `execute` must not throw.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <vector>
+///
+///     int main() {
+///         boost::hof::numa_pool pool(boost::hof::numa_topology({ { 0 }, { 0 } }), false);
+///         auto e = pool.executor();
+///         assert(e.nodes() == 2);
+///         assert(e.submit_on(1, []{ return 1; }).get() == 1);
+///         std::vector<long> v(10000, 1);
+///         long sum = boost::hof::parallel_fold(boost::hof::_ + boost::hof::_, 0L)(v, e, 1000);
+///         assert(sum == 10000);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [executor](executor)
+/// * [work_stealing_executor](work_stealing_executor)
+/// * [parallel_fold](parallel_fold)
+///
+
+#include <boost/hof/executor.hpp>
+#include <boost/hof/work_stealing_executor.hpp>
+#include <atomic>
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+// The CPUs of a list such as "0-3,8-11", as written by the kernel
+inline std::vector<unsigned> numa_parse_list(const std::string& s)
+{
+    std::vector<unsigned> r;
+    std::size_t i = 0;
+    while (i < s.size())
+    {
+        if (s[i] < '0' || s[i] > '9')
+        {
+            i++;
+            continue;
+        }
+        std::size_t next = 0;
+        unsigned first = unsigned(std::stoul(s.substr(i), &next));
+        i += next;
+        unsigned last = first;
+        if (i < s.size() && s[i] == '-')
+        {
+            i++;
+            last = unsigned(std::stoul(s.substr(i), &next));
+            i += next;
+        }
+        for (unsigned c = first; c <= last; c++) r.push_back(c);
+    }
+    return r;
+}
+
+inline std::vector<std::vector<unsigned>> numa_read_nodes()
+{
+    std::vector<std::vector<unsigned>> r;
+#if defined(__linux__)
+    std::string online;
+    std::ifstream in("/sys/devices/system/node/online");
+    if (std::getline(in, online))
+    {
+        for (unsigned node : detail::numa_parse_list(online))
+        {
+            std::string list;
+            std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+            if (!std::getline(cpulist, list)) continue;
+            std::vector<unsigned> cpus = detail::numa_parse_list(list);
+            if (!cpus.empty()) r.push_back(std::move(cpus));
+        }
+    }
+#endif
+    return r;
+}
+
+// Pins the calling thread to the CPUs, and returns false when it can't be
+// pinned, in which case the thread keeps running where it is
+inline bool numa_pin(const std::vector<unsigned>& cpus) noexcept
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (unsigned c : cpus)
+    {
+        if (c < CPU_SETSIZE) CPU_SET(c, &set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
+
+}
+
+class numa_topology
+{
+    std::vector<std::vector<unsigned>> node_cpus;
+public:
+    numa_topology() : node_cpus(detail::numa_read_nodes())
+    {
+        if (node_cpus.empty()) node_cpus.emplace_back();
+    }
+
+    explicit numa_topology(std::vector<std::vector<unsigned>> cpus) : node_cpus(std::move(cpus))
+    {
+        if (node_cpus.empty()) node_cpus.emplace_back();
+    }
+
+    std::size_t nodes() const noexcept
+    {
+        return node_cpus.size();
+    }
+
+    // The CPUs of the node, which is empty when they aren't known
+    const std::vector<unsigned>& cpus(std::size_t node) const
+    {
+        return node_cpus[node];
+    }
+
+    static const numa_topology& system()
+    {
+        static const numa_topology t;
+        return t;
+    }
+};
+
+struct numa_executor;
+
+class numa_pool
+{
+    struct node_start
+    {
+        numa_pool* pool;
+        std::size_t node;
+        std::vector<unsigned> cpus;
+        bool pin;
+
+        void operator()(std::size_t) const
+        {
+            if (pin && !cpus.empty()) detail::numa_pin(cpus);
+            numa_pool::current() = std::make_pair(pool, node);
+        }
+    };
+
+    std::vector<std::unique_ptr<work_stealing_pool>> pools;
+    std::atomic<std::size_t> next;
+
+    static std::pair<const numa_pool*, std::size_t>& current() noexcept
+    {
+        static thread_local std::pair<const numa_pool*, std::size_t> c(nullptr, 0);
+        return c;
+    }
+public:
+    explicit numa_pool(const numa_topology& t=numa_topology::system(), bool pin=true)
+    {
+        next.store(0, std::memory_order_relaxed);
+        pools.reserve(t.nodes());
+        for (std::size_t i = 0; i < t.nodes(); i++)
+        {
+            std::size_t n = t.cpus(i).empty() ? std::thread::hardware_concurrency() / t.nodes() : t.cpus(i).size();
+            pools.emplace_back(new work_stealing_pool(n, node_start{this, i, t.cpus(i), pin}));
+        }
+    }
+
+    numa_pool(const numa_pool&)=delete;
+    numa_pool& operator=(const numa_pool&)=delete;
+
+    std::size_t nodes() const noexcept
+    {
+        return pools.size();
+    }
+
+    work_stealing_pool& node(std::size_t i) noexcept
+    {
+        return *pools[i];
+    }
+
+    // The node of the calling worker, or the number of nodes when it isn't
+    // a worker of this pool
+    std::size_t this_node() const noexcept
+    {
+        const std::pair<const numa_pool*, std::size_t>& c = current();
+        return c.first == this ? c.second : pools.size();
+    }
+
+    std::size_t next_node() noexcept
+    {
+        return next.fetch_add(1, std::memory_order_relaxed) % pools.size();
+    }
+
+    numa_executor executor() noexcept;
+
+    static numa_pool& shared()
+    {
+        static numa_pool pool;
+        return pool;
+    }
+};
+
+struct numa_executor
+{
+    numa_pool* pool;
+
+    numa_executor() : pool(&numa_pool::shared())
+    {}
+
+    explicit numa_executor(numa_pool& p) noexcept : pool(&p)
+    {}
+
+    std::size_t nodes() const noexcept
+    {
+        return pool->nodes();
+    }
+
+    std::size_t this_node() const noexcept
+    {
+        return pool->this_node();
+    }
+
+    template<class F>
+    auto submit_on(std::size_t node, F f) const
+    -> decltype(std::declval<const work_stealing_executor&>().submit(static_cast<F&&>(f)))
+    {
+        return pool->node(node).executor().submit(static_cast<F&&>(f));
+    }
+
+    template<class F>
+    auto submit(F f) const
+    -> decltype(std::declval<const work_stealing_executor&>().submit(static_cast<F&&>(f)))
+    {
+        return this->submit_on(pool->next_node(), static_cast<F&&>(f));
+    }
+
+    template<class F>
+    void execute_on(std::size_t node, F f) const
+    {
+        pool->node(node).executor().execute(static_cast<F&&>(f));
+    }
+
+    template<class F>
+    void execute(F f) const
+    {
+        this->execute_on(pool->next_node(), static_cast<F&&>(f));
+    }
+};
+
+inline numa_executor numa_pool::executor() noexcept
+{
+    return numa_executor(*this);
+}
+
+}} // namespace boost::hof
+
+#endif
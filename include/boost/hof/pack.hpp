@@ -17,7 +17,9 @@
 /// The `pack` function returns a higher order function object that takes a
 /// function that will be passed the initial elements. The function object is
 /// a sequence that can be unpacked with `unpack_adaptor` as well. Also,
-/// `pack_join` can be used to join multiple packs together.
+/// `pack_join` can be used to join multiple packs together. All of the packs
+/// are joined at once, so each element is copied or moved once into the
+/// joined pack, however many packs are joined.
 /// 
 /// Synopsis
 /// --------
@@ -34,9 +36,47 @@
 ///     template<class... Ts>
 ///     constexpr auto pack_basic(Ts&&... xs);
 /// 
+///     // Elements of the same type stored in an array
+///     template<class T, std::size_t N>
+///     using pack_array = unspecified;
+///
+///     // Decay everything and store the elements ordered by alignment
+///     template<class... Ts>
+///     constexpr auto pack_compact(Ts&&... xs);
+///
 ///     // Join multiple packs together
 ///     template<class... Ts>
 ///     constexpr auto pack_join(Ts&&... xs);
+///
+///     // Get a reference to one element
+///     template<std::size_t I, class Pack>
+///     constexpr auto pack_get(Pack&& p);
+/// 
+/// In C++14, when a pack is called as an rvalue, the elements it holds by
+/// value are passed to the function as rvalues, so they can be moved from
+/// instead of copied. References are passed the same way as for an lvalue
+/// pack.
+/// 
+/// When `pack` is passed two or more elements of the same type, that isn't
+/// empty, it returns a `pack_array<T, N>`, which stores the elements in an
+/// array instead of a base class for each element. It is called, unpacked
+/// and joined the same way as the other packs, and the array is available as
+/// its `elements` member. Joining packs also returns a `pack_array` when the
+/// joined elements are all of the same type.
+/// 
+/// The `pack_compact` function works like `pack`, except the elements are
+/// stored in order of decreasing alignment to reduce the padding between
+/// them, so `pack_compact(char, double, char, double)` takes as much space as
+/// `pack(double, double, char, char)`. The elements are still passed to the
+/// function in their original order.
+///
+/// The `pack_get` function returns a reference to the element at index `I`,
+/// which is an rvalue reference when the pack is an rvalue, except for the
+/// elements that are references. The element is reached directly, instead
+/// of passing every element to a function, so it doesn't depend on the
+/// size of the pack. Packs also specialize `std::tuple_size` and
+/// `std::tuple_element`, and have a `get` that is found by ADL, so they can
+/// be used with structured bindings in C++17.
 /// 
 /// Semantics
 /// ---------
@@ -45,6 +85,8 @@
 ///     assert(unpack(f)(pack(xs...)) == f(xs...));
 /// 
 ///     assert(pack_join(pack(xs...), pack(ys...)) == pack(xs..., ys...));
+///
+///     assert(pack_get<I>(pack(xs...)) == arg_c<I+1>(xs...));
 /// 
 /// 
 /// Example
@@ -76,13 +118,16 @@
 
 #include <boost/hof/detail/seq.hpp>
 #include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/type_at.hpp>
 #include <boost/hof/detail/remove_rvalue_reference.hpp>
 #include <boost/hof/detail/unwrap.hpp>
 #include <boost/hof/detail/static_const_var.hpp>
 #include <boost/hof/unpack_sequence.hpp>
 #include <boost/hof/returns.hpp>
 #include <boost/hof/alias.hpp>
+#include <boost/hof/arg.hpp>
 #include <boost/hof/decay.hpp>
+#include <utility>
 
 namespace boost { namespace hof { namespace detail {
 
@@ -90,6 +135,12 @@ template<class...>
 struct pack_tag
 {};
 
+template<class T, std::size_t>
+struct pack_repeat
+{
+    typedef T type;
+};
+
 template<class T, class Tag>
 struct pack_holder
 : detail::alias_empty<T, Tag>
@@ -118,7 +169,7 @@ struct is_copyable<T&&>
 template<class T, class Tag, class X, class... Ts, typename std::enable_if<
     is_copyable<T>::value && !std::is_lvalue_reference<T>::value
 , int>::type = 0>
-constexpr T pack_get(X&& x, Ts&&... xs) noexcept(BOOST_HOF_IS_NOTHROW_COPY_CONSTRUCTIBLE(T))
+BOOST_HOF_HOST_DEVICE constexpr T pack_get(X&& x, Ts&&... xs) noexcept(BOOST_HOF_IS_NOTHROW_COPY_CONSTRUCTIBLE(T))
 {
     return static_cast<T>(boost::hof::alias_value<Tag, T>(BOOST_HOF_FORWARD(X)(x), xs...));
 }
@@ -126,7 +177,7 @@ constexpr T pack_get(X&& x, Ts&&... xs) noexcept(BOOST_HOF_IS_NOTHROW_COPY_CONST
 template<class T, class Tag, class X, class... Ts, typename std::enable_if<
     std::is_lvalue_reference<T>::value
 , int>::type = 0>
-constexpr T pack_get(X&& x, Ts&&... xs) noexcept
+BOOST_HOF_HOST_DEVICE constexpr T pack_get(X&& x, Ts&&... xs) noexcept
 {
     return boost::hof::alias_value<Tag, T>(x, xs...);
 }
@@ -134,18 +185,47 @@ constexpr T pack_get(X&& x, Ts&&... xs) noexcept
 template<class T, class Tag, class X, class... Ts, typename std::enable_if<
     !is_copyable<T>::value
 , int>::type = 0>
-constexpr auto pack_get(X&& x, Ts&&... xs) BOOST_HOF_RETURNS
+BOOST_HOF_HOST_DEVICE constexpr auto pack_get(X&& x, Ts&&... xs) BOOST_HOF_RETURNS
 (
     boost::hof::alias_value<Tag, T>(BOOST_HOF_FORWARD(X)(x), xs...)
 );
 
-#if (defined(__GNUC__) && !defined (__clang__) && __GNUC__ == 4 && __GNUC_MINOR__ < 7) || defined(_MSC_VER)
+// Elements held by value are moved out of an rvalue pack, and references are
+// passed the same way as for an lvalue pack.
+template<class T, class Tag, class X, class... Ts, typename std::enable_if<
+    !std::is_reference<T>::value
+, int>::type = 0>
+BOOST_HOF_HOST_DEVICE constexpr auto pack_get_rvalue(X&& x, Ts&&... xs) BOOST_HOF_RETURNS
+(
+    boost::hof::alias_value<Tag, T>(BOOST_HOF_FORWARD(X)(x), xs...)
+);
+
+template<class T, class Tag, class X, class... Ts, typename std::enable_if<
+    std::is_reference<T>::value
+, int>::type = 0>
+BOOST_HOF_HOST_DEVICE constexpr auto pack_get_rvalue(X&& x, Ts&&... xs) BOOST_HOF_RETURNS
+(
+    boost::hof::detail::pack_get<T, Tag>(x, xs...)
+);
+
+// Constexpr member functions are implicitly const in C++11, so the rvalue
+// overloads are only provided with relaxed constexpr, otherwise calling a
+// temporary pack would no longer be a constant expression.
+#if !BOOST_HOF_NO_REF_QUALIFIERS && BOOST_HOF_HAS_RELAXED_CONSTEXPR
+#define BOOST_HOF_DETAIL_PACK_HAS_RVALUE_CALL 1
+#define BOOST_HOF_DETAIL_PACK_CONST_REF const&
+#else
+#define BOOST_HOF_DETAIL_PACK_HAS_RVALUE_CALL 0
+#define BOOST_HOF_DETAIL_PACK_CONST_REF const
+#endif
+
+#if BOOST_HOF_PACK_USE_HOLDER_BASE
 template<class... Ts>
-struct pack_holder_base
+struct BOOST_HOF_EMPTY_BASES pack_holder_base
 : Ts::type...
 {
     template<class... Xs, class=typename std::enable_if<(sizeof...(Xs) == sizeof...(Ts))>::type>
-    constexpr pack_holder_base(Xs&&... xs) 
+    BOOST_HOF_HOST_DEVICE constexpr pack_holder_base(Xs&&... xs) 
     BOOST_HOF_NOEXCEPT(BOOST_HOF_AND_UNPACK(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(typename Ts::type, Xs&&)))
     : Ts::type(BOOST_HOF_FORWARD(Xs)(xs))...
     {}
@@ -173,18 +253,18 @@ struct pack_holder_builder
 };
 
 template<std::size_t... Ns, class... Ts>
-struct pack_base<seq<Ns...>, Ts...>
+struct BOOST_HOF_EMPTY_BASES pack_base<seq<Ns...>, Ts...>
 : pack_holder_base<typename pack_holder_builder<Ts...>::template apply<Ts, Ns>...>
 {
     typedef pack_holder_base<typename pack_holder_builder<Ts...>::template apply<Ts, Ns>...> base;
     template<class X1, class X2, class... Xs>
-    constexpr pack_base(X1&& x1, X2&& x2, Xs&&... xs)
+    BOOST_HOF_HOST_DEVICE constexpr pack_base(X1&& x1, X2&& x2, Xs&&... xs)
     BOOST_HOF_NOEXCEPT(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(base, X1&&, X2&&, Xs&...))
     : base(BOOST_HOF_FORWARD(X1)(x1), BOOST_HOF_FORWARD(X2)(x2), BOOST_HOF_FORWARD(Xs)(xs)...)
     {}
 
     template<class X1, typename std::enable_if<(BOOST_HOF_IS_CONSTRUCTIBLE(base, X1)), int>::type = 0>
-    constexpr pack_base(X1&& x1)
+    BOOST_HOF_HOST_DEVICE constexpr pack_base(X1&& x1)
     BOOST_HOF_NOEXCEPT(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(base, X1&&))
     : base(BOOST_HOF_FORWARD(X1)(x1))
     {}
@@ -195,11 +275,19 @@ struct pack_base<seq<Ns...>, Ts...>
     BOOST_HOF_RETURNS_CLASS(pack_base);
   
     template<class F>
-    constexpr auto operator()(F&& f) const BOOST_HOF_RETURNS
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(F&& f) BOOST_HOF_DETAIL_PACK_CONST_REF BOOST_HOF_RETURNS
     (
         f(boost::hof::detail::pack_get<Ts, pack_tag<seq<Ns>, Ts...>>(*BOOST_HOF_CONST_THIS, f)...)
     );
 
+#if BOOST_HOF_DETAIL_PACK_HAS_RVALUE_CALL
+    template<class F>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(F&& f) && BOOST_HOF_RETURNS
+    (
+        f(boost::hof::detail::pack_get_rvalue<Ts, pack_tag<seq<Ns>, Ts...>>(BOOST_HOF_RETURNS_STATIC_CAST(pack_base&&)(*BOOST_HOF_THIS), f)...)
+    );
+#endif
+
     typedef std::integral_constant<std::size_t, sizeof...(Ts)> fit_function_param_limit;
 
     template<class F>
@@ -209,13 +297,13 @@ struct pack_base<seq<Ns...>, Ts...>
 };
 
 template<class T>
-struct pack_base<seq<0>, T>
+struct BOOST_HOF_EMPTY_BASES pack_base<seq<0>, T>
 : pack_holder_base<pack_holder<T, pack_tag<seq<0>, T>>>
 {
     typedef pack_holder_base<pack_holder<T, pack_tag<seq<0>, T>>> base;
 
     template<class X1, typename std::enable_if<(BOOST_HOF_IS_CONSTRUCTIBLE(base, X1)), int>::type = 0>
-    constexpr pack_base(X1&& x1) 
+    BOOST_HOF_HOST_DEVICE constexpr pack_base(X1&& x1) 
     BOOST_HOF_NOEXCEPT(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(base, X1&&))
     : base(BOOST_HOF_FORWARD(X1)(x1))
     {}
@@ -225,11 +313,19 @@ struct pack_base<seq<0>, T>
     BOOST_HOF_RETURNS_CLASS(pack_base);
   
     template<class F>
-    constexpr auto operator()(F&& f) const BOOST_HOF_RETURNS
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(F&& f) BOOST_HOF_DETAIL_PACK_CONST_REF BOOST_HOF_RETURNS
     (
         f(boost::hof::detail::pack_get<T, pack_tag<seq<0>, T>>(*BOOST_HOF_CONST_THIS, f))
     );
 
+#if BOOST_HOF_DETAIL_PACK_HAS_RVALUE_CALL
+    template<class F>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(F&& f) && BOOST_HOF_RETURNS
+    (
+        f(boost::hof::detail::pack_get_rvalue<T, pack_tag<seq<0>, T>>(BOOST_HOF_RETURNS_STATIC_CAST(pack_base&&)(*BOOST_HOF_THIS), f))
+    );
+#endif
+
     typedef std::integral_constant<std::size_t, 1> fit_function_param_limit;
 
     template<class F>
@@ -241,14 +337,14 @@ struct pack_base<seq<0>, T>
 #else
 
 template<std::size_t... Ns, class... Ts>
-struct pack_base<seq<Ns...>, Ts...>
+struct BOOST_HOF_EMPTY_BASES pack_base<seq<Ns...>, Ts...>
 : pack_holder<Ts, pack_tag<seq<Ns>, Ts...>>::type...
 {
     // BOOST_HOF_INHERIT_DEFAULT(pack_base, typename std::remove_cv<typename std::remove_reference<Ts>::type>::type...);
     BOOST_HOF_INHERIT_DEFAULT(pack_base, Ts...);
     
     template<class... Xs, BOOST_HOF_ENABLE_IF_CONVERTIBLE_UNPACK(Xs&&, typename pack_holder<Ts, pack_tag<seq<Ns>, Ts...>>::type)>
-    constexpr pack_base(Xs&&... xs) 
+    BOOST_HOF_HOST_DEVICE constexpr pack_base(Xs&&... xs) 
     BOOST_HOF_NOEXCEPT(BOOST_HOF_AND_UNPACK(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(typename pack_holder<Ts, pack_tag<seq<Ns>, Ts...>>::type, Xs&&)))
     : pack_holder<Ts, pack_tag<seq<Ns>, Ts...>>::type(BOOST_HOF_FORWARD(Xs)(xs))...
     {}
@@ -258,11 +354,19 @@ struct pack_base<seq<Ns...>, Ts...>
     BOOST_HOF_RETURNS_CLASS(pack_base);
   
     template<class F>
-    constexpr auto operator()(F&& f) const BOOST_HOF_RETURNS
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(F&& f) BOOST_HOF_DETAIL_PACK_CONST_REF BOOST_HOF_RETURNS
     (
         f(boost::hof::detail::pack_get<Ts, pack_tag<seq<Ns>, Ts...>>(*BOOST_HOF_CONST_THIS, f)...)
     );
 
+#if BOOST_HOF_DETAIL_PACK_HAS_RVALUE_CALL
+    template<class F>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(F&& f) && BOOST_HOF_RETURNS
+    (
+        f(boost::hof::detail::pack_get_rvalue<Ts, pack_tag<seq<Ns>, Ts...>>(BOOST_HOF_RETURNS_STATIC_CAST(pack_base&&)(*BOOST_HOF_THIS), f)...)
+    );
+#endif
+
     typedef std::integral_constant<std::size_t, sizeof...(Ts)> fit_function_param_limit;
 
     template<class F>
@@ -277,7 +381,7 @@ template<>
 struct pack_base<seq<> >
 {
     template<class F>
-    constexpr auto operator()(F&& f) const BOOST_HOF_RETURNS
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(F&& f) const BOOST_HOF_RETURNS
     (f());
 
     typedef std::integral_constant<std::size_t, 0> fit_function_param_limit;
@@ -290,47 +394,288 @@ struct pack_base<seq<> >
 
 #define BOOST_HOF_DETAIL_UNPACK_PACK_BASE(ref, move) \
 template<class F, std::size_t... Ns, class... Ts> \
-constexpr auto unpack_pack_base(F&& f, pack_base<seq<Ns...>, Ts...> ref x) \
+BOOST_HOF_HOST_DEVICE constexpr auto unpack_pack_base(F&& f, pack_base<seq<Ns...>, Ts...> ref x) \
 BOOST_HOF_RETURNS(f(boost::hof::alias_value<pack_tag<seq<Ns>, Ts...>, Ts>(move(x), f)...))
 BOOST_HOF_UNARY_PERFECT_FOREACH(BOOST_HOF_DETAIL_UNPACK_PACK_BASE)
 
-template<class P1, class P2>
-struct pack_join_base;
+template<class T, typename std::enable_if<(is_copyable<T>::value), int>::type = 0>
+BOOST_HOF_HOST_DEVICE constexpr T pack_array_get(const T& x) noexcept(BOOST_HOF_IS_NOTHROW_COPY_CONSTRUCTIBLE(T))
+{
+    return x;
+}
+
+template<class T, typename std::enable_if<(!is_copyable<T>::value), int>::type = 0>
+BOOST_HOF_HOST_DEVICE constexpr const T& pack_array_get(const T& x) noexcept
+{
+    return x;
+}
+
+// Elements of the same type are stored in an array, instead of a base class
+// for each element, and passed to the function the same way as `pack_base`
+template<class Seq, class T>
+struct pack_array_base;
+
+template<std::size_t... Ns, class T>
+struct pack_array_base<seq<Ns...>, T>
+{
+    T elements[sizeof...(Ns)];
+
+    template<bool FitPrivateEnableBool=true, typename std::enable_if<(
+        FitPrivateEnableBool && BOOST_HOF_IS_DEFAULT_CONSTRUCTIBLE(T)
+    ), int>::type = 0>
+    BOOST_HOF_HOST_DEVICE constexpr pack_array_base() noexcept(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(T)) : elements{}
+    {}
+
+    template<class... Xs, typename std::enable_if<(
+        sizeof...(Xs) == sizeof...(Ns) && BOOST_HOF_AND_UNPACK(BOOST_HOF_IS_CONVERTIBLE(Xs&&, T))
+    ), int>::type = 0>
+    BOOST_HOF_HOST_DEVICE constexpr pack_array_base(Xs&&... xs)
+    BOOST_HOF_NOEXCEPT(BOOST_HOF_AND_UNPACK(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(T, Xs&&)))
+    : elements{BOOST_HOF_FORWARD(Xs)(xs)...}
+    {}
+
+    BOOST_HOF_RETURNS_CLASS(pack_array_base);
+
+    template<class F>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(F&& f) BOOST_HOF_DETAIL_PACK_CONST_REF BOOST_HOF_RETURNS
+    (
+        f(boost::hof::detail::pack_array_get<T>(BOOST_HOF_CONST_THIS->elements[Ns])...)
+    );
+
+#if BOOST_HOF_DETAIL_PACK_HAS_RVALUE_CALL
+    template<class F>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(F&& f) && BOOST_HOF_RETURNS
+    (
+        f(BOOST_HOF_RETURNS_STATIC_CAST(T&&)(BOOST_HOF_THIS->elements[Ns])...)
+    );
+#endif
+
+    typedef std::integral_constant<std::size_t, sizeof...(Ns)> fit_function_param_limit;
+
+    template<class F>
+    struct apply
+    : F::template apply<typename pack_repeat<T, Ns>::type...>
+    {};
+};
 
-// TODO: Extend to join more than two packs at a time
-template<std::size_t... Ns1, class... Ts1, std::size_t... Ns2, class... Ts2>
-struct pack_join_base<pack_base<seq<Ns1...>, Ts1...>, pack_base<seq<Ns2...>, Ts2...>>
+#define BOOST_HOF_DETAIL_UNPACK_PACK_ARRAY_BASE(ref, move) \
+template<class F, std::size_t... Ns, class T> \
+BOOST_HOF_HOST_DEVICE constexpr auto unpack_pack_array_base(F&& f, pack_array_base<seq<Ns...>, T> ref x) \
+BOOST_HOF_RETURNS(f(move(x.elements[Ns])...))
+BOOST_HOF_UNARY_PERFECT_FOREACH(BOOST_HOF_DETAIL_UNPACK_PACK_ARRAY_BASE)
+
+// Packs are joined by their elements, so an array is joined as the
+// `pack_base` that holds the same elements
+template<class P>
+struct pack_join_view
+{
+    typedef P type;
+};
+
+template<std::size_t... Ns, class T>
+struct pack_join_view<pack_array_base<seq<Ns...>, T>>
+{
+    typedef pack_base<seq<Ns...>, typename pack_repeat<T, Ns>::type...> type;
+};
+
+// A single element is reached through its base, or its index in the array,
+// without the other elements being passed. These are also found by the
+// structured bindings of a pack.
+template<std::size_t I, std::size_t... Ns, class... Ts>
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto get(const pack_base<seq<Ns...>, Ts...>& p) BOOST_HOF_RETURNS
+(
+    boost::hof::alias_value<pack_tag<seq<I>, Ts...>, typename type_at<I, Ts...>::type>(p)
+);
+
+template<std::size_t I, std::size_t... Ns, class... Ts>
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto get(pack_base<seq<Ns...>, Ts...>& p) BOOST_HOF_RETURNS
+(
+    boost::hof::alias_value<pack_tag<seq<I>, Ts...>, typename type_at<I, Ts...>::type>(p)
+);
+
+template<std::size_t I, std::size_t... Ns, class... Ts>
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto get(pack_base<seq<Ns...>, Ts...>&& p) BOOST_HOF_RETURNS
+(
+    boost::hof::detail::pack_get_rvalue<typename type_at<I, Ts...>::type, pack_tag<seq<I>, Ts...>>(
+        BOOST_HOF_RETURNS_STATIC_CAST(pack_base<seq<Ns...>, Ts...>&&)(p)
+    )
+);
+
+template<std::size_t I, std::size_t... Ns, class T, class=typename std::enable_if<(I < sizeof...(Ns))>::type>
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr const T& get(const pack_array_base<seq<Ns...>, T>& p) noexcept
+{
+    return p.elements[I];
+}
+
+template<std::size_t I, std::size_t... Ns, class T, class=typename std::enable_if<(I < sizeof...(Ns))>::type>
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr T& get(pack_array_base<seq<Ns...>, T>& p) noexcept
+{
+    return p.elements[I];
+}
+
+template<std::size_t I, std::size_t... Ns, class T, class=typename std::enable_if<(I < sizeof...(Ns))>::type>
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr T&& get(pack_array_base<seq<Ns...>, T>&& p) noexcept
+{
+    return static_cast<T&&>(p.elements[I]);
+}
+
+// The references of a `pack_forward` are passed with the type they are
+// stored as, and the other elements as they are returned by `get`, so each
+// element is copied or moved once into the joined pack
+template<class T, class X, typename std::enable_if<(std::is_reference<T>::value), int>::type = 0>
+BOOST_HOF_HOST_DEVICE constexpr T pack_element_forward(X&& x) noexcept
+{
+    return static_cast<T>(x);
+}
+
+template<class T, class X, typename std::enable_if<(!std::is_reference<T>::value), int>::type = 0>
+BOOST_HOF_HOST_DEVICE constexpr X&& pack_element_forward(X&& x) noexcept
+{
+    return static_cast<X&&>(x);
+}
+
+template<std::size_t N, class T, class P>
+BOOST_HOF_HOST_DEVICE constexpr auto pack_join_get(P&& p) BOOST_HOF_RETURNS
+(
+    boost::hof::detail::pack_element_forward<T>(boost::hof::detail::get<N>(BOOST_HOF_FORWARD(P)(p)))
+);
+
+// Two or more elements of the same type, that isn't empty, are stored in an
+// array. Empty elements are still stored as bases, so they take no space.
+template<class... Ts>
+struct is_pack_homogeneous
+: std::false_type
+{};
+
+template<class T, class... Ts>
+struct is_pack_homogeneous<T, Ts...>
+: std::integral_constant<bool, (
+    sizeof...(Ts) > 0 && 
+    !std::is_reference<T>::value && 
+    !BOOST_HOF_IS_EMPTY(T) && 
+    BOOST_HOF_AND_UNPACK((std::is_same<T, Ts>::value))
+)>
+{};
+
+template<bool Homogeneous, class Seq, class... Ts>
+struct pack_storage_select
+{
+    typedef pack_base<Seq, Ts...> type;
+};
+
+template<class Seq, class T, class... Ts>
+struct pack_storage_select<true, Seq, T, Ts...>
 {
-    static constexpr long total_size = sizeof...(Ts1) + sizeof...(Ts2);
-    typedef pack_base<typename detail::gens<total_size>::type, Ts1..., Ts2...> result_type;
+    typedef pack_array_base<Seq, T> type;
+};
+
+template<class Seq, class... Ts>
+struct pack_storage
+: pack_storage_select<is_pack_homogeneous<Ts...>::value, Seq, Ts...>
+{};
+
+// The pack and the element of each element of the joined packs, which are
+// found at compile time from the sizes of the packs, so the joined pack is
+// constructed from all of the packs at once
+template<std::size_t... Sizes>
+struct pack_join_index
+{
+    static constexpr std::size_t sizes[sizeof...(Sizes)+1] = { Sizes..., 0 };
+
+    static constexpr std::size_t outer(std::size_t k, std::size_t j=0)
+    {
+        return k < sizes[j] ? j : outer(k - sizes[j], j+1);
+    }
+
+    static constexpr std::size_t inner(std::size_t k, std::size_t j=0)
+    {
+        return k < sizes[j] ? k : inner(k - sizes[j], j+1);
+    }
+};
+
+template<std::size_t... Sizes>
+constexpr std::size_t pack_join_index<Sizes...>::sizes[sizeof...(Sizes)+1];
+
+template<class View>
+struct pack_join_element;
+
+template<std::size_t... Ns, class... Ts>
+struct pack_join_element<pack_base<seq<Ns...>, Ts...>>
+{
+    static constexpr std::size_t size = sizeof...(Ts);
+
+    template<std::size_t I>
+    struct at
+    {
+        typedef typename type_at<I, Ts...>::type type;
+    };
+};
+
+template<std::size_t J, std::size_t I, class... Views>
+struct pack_join_at
+: pack_join_element<typename type_at<J, Views...>::type>::template at<I>
+{};
+
+template<class Seq, class... Views>
+struct pack_join_base;
 
-    template<class P1, class P2>
-    static constexpr result_type call(P1&& p1, P2&& p2)
+template<std::size_t... Ks, class... Views>
+struct pack_join_base<seq<Ks...>, Views...>
+{
+    typedef pack_join_index<pack_join_element<Views>::size...> index;
+    typedef typename pack_storage<seq<Ks...>, 
+        typename pack_join_at<index::outer(Ks), index::inner(Ks), Views...>::type...
+    >::type result_type;
+
+    // Joining a pack of elements that can't be copied is only possible when
+    // the pack is an rvalue, so the join is constrained on the construction
+    template<class... Ps, class=typename std::enable_if<BOOST_HOF_IS_CONSTRUCTIBLE(result_type, 
+        decltype(boost::hof::detail::pack_join_get<index::inner(Ks), 
+            typename pack_join_at<index::outer(Ks), index::inner(Ks), Views...>::type
+        >(std::declval<typename type_at<index::outer(Ks), Ps...>::type>()))...
+    )>::type>
+    BOOST_HOF_HOST_DEVICE static constexpr result_type call(Ps&&... ps)
     BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(
-        result_type(
-            boost::hof::detail::pack_get<Ts1, pack_tag<seq<Ns1>, Ts1...>>(BOOST_HOF_FORWARD(P1)(p1))..., 
-            boost::hof::detail::pack_get<Ts2, pack_tag<seq<Ns2>, Ts2...>>(BOOST_HOF_FORWARD(P2)(p2))...)
+        result_type(boost::hof::detail::pack_join_get<index::inner(Ks), 
+            typename pack_join_at<index::outer(Ks), index::inner(Ks), Views...>::type
+        >(boost::hof::detail::get_args<index::outer(Ks)+1>(BOOST_HOF_FORWARD(Ps)(ps)...))...)
     )
     {
-        return result_type(
-            boost::hof::detail::pack_get<Ts1, pack_tag<seq<Ns1>, Ts1...>>(BOOST_HOF_FORWARD(P1)(p1))..., 
-            boost::hof::detail::pack_get<Ts2, pack_tag<seq<Ns2>, Ts2...>>(BOOST_HOF_FORWARD(P2)(p2))...);
+        return result_type(boost::hof::detail::pack_join_get<index::inner(Ks), 
+            typename pack_join_at<index::outer(Ks), index::inner(Ks), Views...>::type
+        >(boost::hof::detail::get_args<index::outer(Ks)+1>(BOOST_HOF_FORWARD(Ps)(ps)...))...);
     }
 };
 
-template<class P1, class P2>
+template<class... Ps>
+struct pack_join_sum;
+
+template<>
+struct pack_join_sum<>
+: std::integral_constant<std::size_t, 0>
+{};
+
+template<class P, class... Ps>
+struct pack_join_sum<P, Ps...>
+: std::integral_constant<std::size_t, pack_join_element<P>::size + pack_join_sum<Ps...>::value>
+{};
+
+template<class... Views>
+struct pack_join_views
+: pack_join_base<typename gens<pack_join_sum<Views...>::value>::type, Views...>
+{};
+
+template<class... Ps>
 struct pack_join_result 
-: pack_join_base<
-    typename std::remove_cv<typename std::remove_reference<P1>::type>::type, 
-    typename std::remove_cv<typename std::remove_reference<P2>::type>::type
+: pack_join_views<
+    typename pack_join_view<typename std::remove_cv<typename std::remove_reference<Ps>::type>::type>::type...
 >
 {};
 
-
 struct pack_basic_f
 {
     template<class... Ts>
-    constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
     (
         pack_base<typename gens<sizeof...(Ts)>::type, typename remove_rvalue_reference<Ts>::type...>(BOOST_HOF_FORWARD(Ts)(xs)...)
     );
@@ -339,7 +684,7 @@ struct pack_basic_f
 struct pack_forward_f
 {
     template<class... Ts>
-    constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
     (
         pack_base<typename gens<sizeof...(Ts)>::type, Ts&&...>(BOOST_HOF_FORWARD(Ts)(xs)...)
     );
@@ -348,53 +693,139 @@ struct pack_forward_f
 struct pack_f
 {
     template<class... Ts>
-    constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
     (
-        pack_basic_f()(boost::hof::decay(BOOST_HOF_FORWARD(Ts)(xs))...)
+        typename pack_storage<typename gens<sizeof...(Ts)>::type, typename detail::decay_mf<Ts>::type...>::type(
+            boost::hof::decay(BOOST_HOF_FORWARD(Ts)(xs))...
+        )
     );
 };
 
-template<class P1, class P2>
-constexpr typename pack_join_result<P1, P2>::result_type make_pack_join_dual(P1&& p1, P2&& p2)
-BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(pack_join_result<P1, P2>::call(BOOST_HOF_FORWARD(P1)(p1), BOOST_HOF_FORWARD(P2)(p2)))
+template<class P1>
+BOOST_HOF_HOST_DEVICE constexpr P1 make_pack_join(P1&& p1) BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(P1, P1&&)
 {
-    return pack_join_result<P1, P2>::call(BOOST_HOF_FORWARD(P1)(p1), BOOST_HOF_FORWARD(P2)(p2));
+    return BOOST_HOF_FORWARD(P1)(p1);
 }
 
-// Manually compute join return type to make older gcc happy
-template<class... Ts>
-struct join_type;
+template<class P1, class P2, class... Ps, class=decltype(pack_join_result<P1, P2, Ps...>::call(std::declval<P1>(), std::declval<P2>(), std::declval<Ps>()...))>
+BOOST_HOF_HOST_DEVICE constexpr typename pack_join_result<P1, P2, Ps...>::result_type make_pack_join(P1&& p1, P2&& p2, Ps&&... ps)
+BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(pack_join_result<P1, P2, Ps...>::call(BOOST_HOF_FORWARD(P1)(p1), BOOST_HOF_FORWARD(P2)(p2), BOOST_HOF_FORWARD(Ps)(ps)...))
+{
+    return pack_join_result<P1, P2, Ps...>::call(BOOST_HOF_FORWARD(P1)(p1), BOOST_HOF_FORWARD(P2)(p2), BOOST_HOF_FORWARD(Ps)(ps)...);
+}
 
-template<class T>
-struct join_type<T>
+// Elements are ranked by decreasing alignment, and by their index when the
+// alignments are equal, so the order is stable.
+template<std::size_t... As>
+struct pack_alignments
 {
-    typedef T type;
+    static constexpr std::size_t values[sizeof...(As)] = { As... };
+
+    static constexpr std::size_t rank(std::size_t i, std::size_t j=0)
+    {
+        return j == sizeof...(As) ? 0 :
+            ((values[j] > values[i] || (values[j] == values[i] && j < i)) ? 1 : 0) + rank(i, j+1);
+    }
+
+    static constexpr std::size_t origin(std::size_t k, std::size_t i=0)
+    {
+        return rank(i) == k ? i : origin(k, i+1);
+    }
 };
 
-template<class T, class... Ts>
-struct join_type<T, Ts...>
+template<std::size_t... As>
+constexpr std::size_t pack_alignments<As...>::values[sizeof...(As)];
+
+// References are stored as pointers
+template<class T>
+struct pack_alignment
+: std::integral_constant<std::size_t, alignof(typename std::conditional<
+    std::is_reference<T>::value, typename std::remove_reference<T>::type*, T
+>::type)>
+{};
+
+template<std::size_t K, class P>
+struct pack_base_tag;
+
+template<std::size_t K, std::size_t... Ns, class... Ts>
+struct pack_base_tag<K, pack_base<seq<Ns...>, Ts...>>
 {
-    typedef typename pack_join_result<T, typename join_type<Ts...>::type>::result_type type;
+    typedef pack_tag<seq<K>, Ts...> type;
 };
 
-template<class P1>
-constexpr P1 make_pack_join(P1&& p1) BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(P1, P1&&)
+template<class Seq, class... Ts>
+struct pack_compact_base;
+
+template<std::size_t... Ns, class... Ts>
+struct pack_compact_base<seq<Ns...>, Ts...>
+: pack_base<seq<Ns...>, typename type_at<pack_alignments<pack_alignment<Ts>::value...>::origin(Ns), Ts...>::type...>
 {
-    return BOOST_HOF_FORWARD(P1)(p1);
-}
+    typedef pack_alignments<pack_alignment<Ts>::value...> alignments;
+    typedef pack_base<seq<Ns...>, typename type_at<alignments::origin(Ns), Ts...>::type...> base;
 
-template<class P1, class... Ps>
-constexpr typename join_type<P1, Ps...>::type make_pack_join(P1&& p1, Ps&&... ps)
-BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(make_pack_join_dual(BOOST_HOF_FORWARD(P1)(p1), make_pack_join(BOOST_HOF_FORWARD(Ps)(ps)...)))
+    BOOST_HOF_INHERIT_DEFAULT(pack_compact_base, base);
+
+    template<class... Xs, class=typename std::enable_if<(sizeof...(Xs) == sizeof...(Ts))>::type>
+    BOOST_HOF_HOST_DEVICE constexpr pack_compact_base(Xs&&... xs)
+    : base(boost::hof::detail::get_args<alignments::origin(Ns)+1>(BOOST_HOF_FORWARD(Xs)(xs)...)...)
+    {}
+
+    BOOST_HOF_RETURNS_CLASS(pack_compact_base);
+
+    template<class F>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(F&& f) BOOST_HOF_DETAIL_PACK_CONST_REF BOOST_HOF_RETURNS
+    (
+        f(boost::hof::detail::pack_get<Ts, typename pack_base_tag<alignments::rank(Ns), base>::type>(
+            static_cast<const base&>(*BOOST_HOF_CONST_THIS), f
+        )...)
+    );
+
+#if BOOST_HOF_DETAIL_PACK_HAS_RVALUE_CALL
+    template<class F>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(F&& f) && BOOST_HOF_RETURNS
+    (
+        f(boost::hof::detail::pack_get_rvalue<Ts, typename pack_base_tag<alignments::rank(Ns), base>::type>(
+            static_cast<base&&>(*BOOST_HOF_THIS), f
+        )...)
+    );
+#endif
+
+    typedef std::integral_constant<std::size_t, sizeof...(Ts)> fit_function_param_limit;
+
+    template<class F>
+    struct apply
+    : F::template apply<Ts...>
+    {};
+};
+
+template<>
+struct pack_compact_base<seq<> >
+: pack_base<seq<> >
+{};
+
+#define BOOST_HOF_DETAIL_UNPACK_PACK_COMPACT_BASE(ref, move) \
+template<class F, std::size_t... Ns, class... Ts> \
+BOOST_HOF_HOST_DEVICE constexpr auto unpack_pack_compact_base(F&& f, pack_compact_base<seq<Ns...>, Ts...> ref x) \
+BOOST_HOF_RETURNS(f(boost::hof::alias_value<typename pack_base_tag< \
+    pack_compact_base<seq<Ns...>, Ts...>::alignments::rank(Ns), \
+    typename pack_compact_base<seq<Ns...>, Ts...>::base \
+>::type, Ts>(move(x), f)...))
+BOOST_HOF_UNARY_PERFECT_FOREACH(BOOST_HOF_DETAIL_UNPACK_PACK_COMPACT_BASE)
+
+struct pack_compact_f
 {
-    return make_pack_join_dual(BOOST_HOF_FORWARD(P1)(p1), make_pack_join(BOOST_HOF_FORWARD(Ps)(ps)...));
-}
+    template<class... Ts>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        pack_compact_base<typename gens<sizeof...(Ts)>::type, typename detail::decay_mf<Ts>::type...>(BOOST_HOF_FORWARD(Ts)(xs)...)
+    );
+};
 
 struct pack_join_f
 {
 
     template<class... Ps>
-    constexpr auto operator()(Ps&&... ps) const BOOST_HOF_RETURNS
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(Ps&&... ps) const BOOST_HOF_RETURNS
     (
         make_pack_join(BOOST_HOF_FORWARD(Ps)(ps)...)
     );
@@ -402,22 +833,146 @@ struct pack_join_f
 
 }
 
+template<class T, std::size_t N>
+using pack_array = detail::pack_array_base<typename detail::gens<N>::type, T>;
+
 BOOST_HOF_DECLARE_STATIC_VAR(pack_basic, detail::pack_basic_f);
 BOOST_HOF_DECLARE_STATIC_VAR(pack_forward, detail::pack_forward_f);
 BOOST_HOF_DECLARE_STATIC_VAR(pack, detail::pack_f);
+BOOST_HOF_DECLARE_STATIC_VAR(pack_compact, detail::pack_compact_f);
 
 BOOST_HOF_DECLARE_STATIC_VAR(pack_join, detail::pack_join_f);
 
+namespace detail {
+
+// Calls the function with the arguments followed by the elements of a pack
+// of references. Calling a pack with it appends to the pack, without moving
+// its elements into a joined pack first.
+template<class F, class Ys>
+struct pack_append_invoke
+{
+    F&& f;
+    Ys&& ys;
+
+    BOOST_HOF_RETURNS_CLASS(pack_append_invoke);
+
+    template<class... Xs>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(Xs&&... xs) const BOOST_HOF_RETURNS
+    (
+        boost::hof::pack_join(
+            boost::hof::pack_forward(BOOST_HOF_FORWARD(Xs)(xs)...), 
+            BOOST_HOF_RETURNS_STATIC_CAST(Ys&&)(BOOST_HOF_CONST_THIS->ys)
+        )(BOOST_HOF_RETURNS_STATIC_CAST(F&&)(BOOST_HOF_CONST_THIS->f))
+    );
+};
+
+template<class F, class Ys>
+BOOST_HOF_HOST_DEVICE constexpr pack_append_invoke<F, Ys> make_pack_append_invoke(F&& f, Ys&& ys) noexcept
+{
+    return pack_append_invoke<F, Ys>{BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(Ys)(ys)};
+}
+
+template<std::size_t I, class P>
+struct pack_compact_tag;
+
+template<std::size_t I, std::size_t... Ns, class... Ts>
+struct pack_compact_tag<I, pack_compact_base<seq<Ns...>, Ts...>>
+: pack_base_tag<pack_compact_base<seq<Ns...>, Ts...>::alignments::rank(I), typename pack_compact_base<seq<Ns...>, Ts...>::base>
+{};
+
+template<std::size_t I, std::size_t... Ns, class... Ts>
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto get(const pack_compact_base<seq<Ns...>, Ts...>& p) BOOST_HOF_RETURNS
+(
+    boost::hof::alias_value<typename pack_compact_tag<I, pack_compact_base<seq<Ns...>, Ts...>>::type, typename type_at<I, Ts...>::type>(p)
+);
+
+template<std::size_t I, std::size_t... Ns, class... Ts>
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto get(pack_compact_base<seq<Ns...>, Ts...>& p) BOOST_HOF_RETURNS
+(
+    boost::hof::alias_value<typename pack_compact_tag<I, pack_compact_base<seq<Ns...>, Ts...>>::type, typename type_at<I, Ts...>::type>(p)
+);
+
+template<std::size_t I, std::size_t... Ns, class... Ts>
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto get(pack_compact_base<seq<Ns...>, Ts...>&& p) BOOST_HOF_RETURNS
+(
+    boost::hof::detail::pack_get_rvalue<typename type_at<I, Ts...>::type, typename pack_compact_tag<I, pack_compact_base<seq<Ns...>, Ts...>>::type>(
+        BOOST_HOF_RETURNS_STATIC_CAST(typename pack_compact_base<seq<Ns...>, Ts...>::base&&)(p)
+    )
+);
+
+}
+
+template<std::size_t I, class P>
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto pack_get(P&& p) BOOST_HOF_RETURNS
+(
+    boost::hof::detail::get<I>(BOOST_HOF_FORWARD(P)(p))
+);
+
 template<class T, class... Ts>
 struct unpack_sequence<detail::pack_base<T, Ts...>>
 {
     template<class F, class P>
-    constexpr static auto apply(F&& f, P&& p) BOOST_HOF_RETURNS
+    BOOST_HOF_HOST_DEVICE constexpr static auto apply(F&& f, P&& p) BOOST_HOF_RETURNS
     (
         boost::hof::detail::unpack_pack_base(BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(P)(p))
     );
 };
 
+template<class Seq, class T>
+struct unpack_sequence<detail::pack_array_base<Seq, T>>
+{
+    template<class F, class P>
+    BOOST_HOF_HOST_DEVICE constexpr static auto apply(F&& f, P&& p) BOOST_HOF_RETURNS
+    (
+        boost::hof::detail::unpack_pack_array_base(BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(P)(p))
+    );
+};
+
+template<class T, class... Ts>
+struct unpack_sequence<detail::pack_compact_base<T, Ts...>>
+{
+    template<class F, class P>
+    BOOST_HOF_HOST_DEVICE constexpr static auto apply(F&& f, P&& p) BOOST_HOF_RETURNS
+    (
+        boost::hof::detail::unpack_pack_compact_base(BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(P)(p))
+    );
+};
+
 }} // namespace boost::hof
 
+namespace std {
+
+template<std::size_t... Ns, class... Ts>
+struct tuple_size<boost::hof::detail::pack_base<boost::hof::detail::seq<Ns...>, Ts...>>
+: std::integral_constant<std::size_t, sizeof...(Ts)>
+{};
+
+template<std::size_t I, std::size_t... Ns, class... Ts>
+struct tuple_element<I, boost::hof::detail::pack_base<boost::hof::detail::seq<Ns...>, Ts...>>
+: boost::hof::detail::type_at<I, Ts...>
+{};
+
+template<std::size_t... Ns, class T>
+struct tuple_size<boost::hof::detail::pack_array_base<boost::hof::detail::seq<Ns...>, T>>
+: std::integral_constant<std::size_t, sizeof...(Ns)>
+{};
+
+template<std::size_t I, std::size_t... Ns, class T>
+struct tuple_element<I, boost::hof::detail::pack_array_base<boost::hof::detail::seq<Ns...>, T>>
+{
+    typedef T type;
+};
+
+template<std::size_t... Ns, class... Ts>
+struct tuple_size<boost::hof::detail::pack_compact_base<boost::hof::detail::seq<Ns...>, Ts...>>
+: std::integral_constant<std::size_t, sizeof...(Ts)>
+{};
+
+template<std::size_t I, std::size_t... Ns, class... Ts>
+struct tuple_element<I, boost::hof::detail::pack_compact_base<boost::hof::detail::seq<Ns...>, Ts...>>
+: boost::hof::detail::type_at<I, Ts...>
+{};
+
+} // namespace std
+
 #endif
@@ -0,0 +1,269 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    pack_algorithm.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_PACK_ALGORITHM_H
+#define BOOST_HOF_GUARD_PACK_ALGORITHM_H
+
+/// pack_algorithm
+/// ==============
+///
+/// Description
+/// -----------
+///
+/// These functions return a new [`pack`](pack) from the elements of a pack.
+/// The `pack_filter` function keeps the elements whose decayed type
+/// satisfies the predicate, `pack_take` keeps the first `N` elements, and
+/// `pack_drop` keeps the elements after the first `N`. The `pack_transform`
+/// function returns a pack of the results of calling the function with each
+/// element, which are decayed like with `pack`, and the function is called
+/// with the elements in order.
+///
+/// The indices of the elements that are kept are computed at compile time,
+/// and the result is constructed from them with [`pack_get`](pack) in one
+/// expansion, so no pack is unpacked or built in between. The elements keep
+/// the type they have in the pack, so the references of a `pack_forward`
+/// stay references, and the elements of an rvalue pack are moved. The
+/// result of `pack_compact` is also a `pack_compact`.
+///
+/// Synopsis
+/// --------
+///
+///     template<template<class> class Predicate, class Pack>
+///     constexpr auto pack_filter(Pack&& p);
+///
+///     template<std::size_t N, class Pack>
+///     constexpr auto pack_take(Pack&& p);
+///
+///     template<std::size_t N, class Pack>
+///     constexpr auto pack_drop(Pack&& p);
+///
+///     template<class Pack, class F>
+///     constexpr auto pack_transform(Pack&& p, F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(pack_take<N>(pack(xs..., ys...)) == pack(xs...));
+///     assert(pack_drop<N>(pack(xs..., ys...)) == pack(ys...));
+///     assert(pack_transform(pack(xs...), f) == pack(f(xs)...));
+///
+/// Where `sizeof...(xs)` is `N`.
+///
+/// Requirements
+/// ------------
+///
+/// Predicate must be:
+///
+/// * A class template with a static `value` that is convertible to bool
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <string>
+///     #include <type_traits>
+///
+///     struct sum
+///     {
+///         template<class... Ts>
+///         int operator()(Ts... xs) const
+///         {
+///             int r = 0;
+///             int expand[] = { 0, (r += xs, 0)... };
+///             (void)expand;
+///             return r;
+///         }
+///     };
+///
+///     int main() {
+///         auto p = boost::hof::pack(1, std::string("a"), 2, 3.5);
+///         assert(boost::hof::pack_filter<std::is_integral>(p)(sum()) == 3);
+///         assert(boost::hof::pack_get<0>(boost::hof::pack_drop<3>(p)) == 3.5);
+///         assert(boost::hof::pack_transform(boost::hof::pack_take<1>(p), [](int x) { return x * 2; })(sum()) == 2);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [pack](pack)
+/// * [unpack](unpack)
+///
+
+#include <boost/hof/pack.hpp>
+#include <boost/hof/returns.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <boost/hof/detail/type_at.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+// The positions of the elements that are kept, which are found at compile
+// time the same way as the ranks of `pack_alignments`
+template<bool... Bs>
+struct pack_selection
+{
+    static constexpr bool values[sizeof...(Bs)+1] = { Bs..., false };
+
+    static constexpr std::size_t count(std::size_t i=0)
+    {
+        return i == sizeof...(Bs) ? 0 : (values[i] ? 1 : 0) + count(i+1);
+    }
+
+    static constexpr std::size_t origin(std::size_t k, std::size_t i=0)
+    {
+        return (values[i] && k == 0) ? i : origin(values[i] ? k-1 : k, i+1);
+    }
+};
+
+template<bool... Bs>
+constexpr bool pack_selection<Bs...>::values[sizeof...(Bs)+1];
+
+template<class Selection, class Seq=typename gens<Selection::count()>::type>
+struct pack_selection_indices;
+
+template<class Selection, std::size_t... Ks>
+struct pack_selection_indices<Selection, seq<Ks...>>
+{
+    typedef seq<Selection::origin(Ks)...> type;
+};
+
+template<std::size_t N, class Seq>
+struct pack_offset_indices;
+
+template<std::size_t N, std::size_t... Ks>
+struct pack_offset_indices<N, seq<Ks...>>
+{
+    typedef seq<(Ks+N)...> type;
+};
+
+// The size of each kind of pack, the selection of the elements whose decayed
+// type satisfies the predicate, and the pack of the same kind that holds the
+// elements at the indices
+template<class P>
+struct pack_algorithm_traits;
+
+template<std::size_t... Ns, class... Ts>
+struct pack_algorithm_traits<pack_base<seq<Ns...>, Ts...>>
+{
+    static constexpr std::size_t size = sizeof...(Ts);
+
+    template<template<class> class Predicate>
+    struct filter
+    : pack_selection_indices<pack_selection<Predicate<typename std::decay<Ts>::type>::value...>>
+    {};
+
+    template<std::size_t... Is>
+    struct select
+    : pack_storage<typename gens<sizeof...(Is)>::type, typename type_at<Is, Ts...>::type...>
+    {};
+};
+
+template<std::size_t... Ns, class T>
+struct pack_algorithm_traits<pack_array_base<seq<Ns...>, T>>
+: pack_algorithm_traits<pack_base<seq<Ns...>, typename pack_repeat<T, Ns>::type...>>
+{};
+
+template<std::size_t... Ns, class... Ts>
+struct pack_algorithm_traits<pack_compact_base<seq<Ns...>, Ts...>>
+: pack_algorithm_traits<pack_base<seq<Ns...>, Ts...>>
+{
+    template<std::size_t... Is>
+    struct select
+    {
+        typedef pack_compact_base<typename gens<sizeof...(Is)>::type, typename type_at<Is, Ts...>::type...> type;
+    };
+};
+
+template<class P>
+struct pack_algorithm_of
+: pack_algorithm_traits<typename std::remove_cv<typename std::remove_reference<P>::type>::type>
+{};
+
+template<std::size_t I, class P>
+struct pack_element_of
+: std::tuple_element<I, typename std::remove_cv<typename std::remove_reference<P>::type>::type>
+{};
+
+template<std::size_t I, class P>
+BOOST_HOF_HOST_DEVICE constexpr auto pack_element(P&& p) BOOST_HOF_RETURNS
+(
+    boost::hof::detail::pack_element_forward<typename pack_element_of<I, P>::type>(
+        boost::hof::detail::get<I>(BOOST_HOF_FORWARD(P)(p))
+    )
+);
+
+template<std::size_t... Is, class P>
+BOOST_HOF_HOST_DEVICE constexpr typename pack_algorithm_of<P>::template select<Is...>::type
+pack_select(seq<Is...>, P&& p)
+{
+    return typename pack_algorithm_of<P>::template select<Is...>::type{
+        boost::hof::detail::pack_element<Is>(BOOST_HOF_FORWARD(P)(p))...
+    };
+}
+
+template<std::size_t... Ns, class P, class F>
+BOOST_HOF_HOST_DEVICE constexpr auto pack_transform_seq(seq<Ns...>, P&& p, F& f) BOOST_HOF_RETURNS
+(
+    typename pack_storage<seq<Ns...>, typename decay_mf<
+        decltype(f(boost::hof::detail::pack_element<Ns>(BOOST_HOF_FORWARD(P)(p))))
+    >::type...>::type{
+        f(boost::hof::detail::pack_element<Ns>(BOOST_HOF_FORWARD(P)(p)))...
+    }
+);
+
+}
+
+template<template<class> class Predicate, class P>
+BOOST_HOF_HOST_DEVICE constexpr auto pack_filter(P&& p) BOOST_HOF_RETURNS
+(
+    boost::hof::detail::pack_select(
+        typename detail::pack_algorithm_of<P>::template filter<Predicate>::type(), 
+        BOOST_HOF_FORWARD(P)(p)
+    )
+);
+
+template<std::size_t N, class P, typename std::enable_if<(
+    N <= detail::pack_algorithm_of<P>::size
+), int>::type = 0>
+BOOST_HOF_HOST_DEVICE constexpr auto pack_take(P&& p) BOOST_HOF_RETURNS
+(
+    boost::hof::detail::pack_select(typename detail::gens<N>::type(), BOOST_HOF_FORWARD(P)(p))
+);
+
+template<std::size_t N, class P, typename std::enable_if<(
+    N <= detail::pack_algorithm_of<P>::size
+), int>::type = 0>
+BOOST_HOF_HOST_DEVICE constexpr auto pack_drop(P&& p) BOOST_HOF_RETURNS
+(
+    boost::hof::detail::pack_select(
+        typename detail::pack_offset_indices<N, typename detail::gens<detail::pack_algorithm_of<P>::size - N>::type>::type(), 
+        BOOST_HOF_FORWARD(P)(p)
+    )
+);
+
+template<class P, class F>
+BOOST_HOF_HOST_DEVICE constexpr auto pack_transform(P&& p, F f) BOOST_HOF_RETURNS
+(
+    boost::hof::detail::pack_transform_seq(
+        typename detail::gens<detail::pack_algorithm_of<P>::size>::type(), 
+        BOOST_HOF_FORWARD(P)(p), 
+        f
+    )
+);
+
+}} // namespace boost::hof
+
+#endif
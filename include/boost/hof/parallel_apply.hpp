@@ -0,0 +1,177 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    parallel_apply.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_PARALLEL_APPLY_H
+#define BOOST_HOF_GUARD_PARALLEL_APPLY_H
+
+/// parallel_apply
+/// ==============
+///
+/// Description
+/// -----------
+///
+/// The `parallel_apply` function takes a sequence of nullary functions, such
+/// as a [`pack`](pack), and returns a function that calls each of them
+/// concurrently on an [executor](executor). The results are returned in a
+/// `pack` in the same order as the functions, once all of them have
+/// finished. The first function is called on the calling thread while the
+/// others are running.
+///
+/// The returned function takes the executor, or a
+/// [`parallel_policy`](executor) to also choose the threshold. By default,
+/// the `thread_executor` is used. When there are fewer functions than the
+/// threshold, the functions are called on the calling thread instead. The
+/// sequence is unpacked with [`unpack`](unpack), so any sequence that can be
+/// unpacked can be used.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Sequence>
+///     constexpr parallel_apply_adaptor<Sequence> parallel_apply(Sequence s);
+///
+/// Semantics
+/// ---------
+///
+///     assert(parallel_apply(pack(fs...))(e) == pack(fs()...));
+///
+/// Requirements
+/// ------------
+///
+/// Sequence must be:
+///
+/// * [Unpackable](Unpackable)
+/// * MoveConstructible
+///
+/// The elements must be nullary [ConstInvocable](ConstInvocable) function
+/// objects that don't return `void`, and must be safe to call concurrently.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <string>
+///     #include <tuple>
+///
+///     struct load_a
+///     {
+///         int operator()() const
+///         {
+///             return 1;
+///         }
+///     };
+///
+///     struct load_b
+///     {
+///         std::string operator()() const
+///         {
+///             return "b";
+///         }
+///     };
+///
+///     int main() {
+///         auto r = boost::hof::parallel_apply(boost::hof::pack(load_a(), load_b()))(boost::hof::thread_executor());
+///         auto t = boost::hof::unpack(boost::hof::construct<std::tuple>())(r);
+///         assert(std::get<0>(t) == 1);
+///         assert(std::get<1>(t) == "b");
+///     }
+///
+/// References
+/// ----------
+///
+/// * [pack](pack)
+/// * [parallel_combine](parallel_combine)
+/// * [executor](executor)
+///
+
+#include <boost/hof/executor.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/parallel_eval.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+struct parallel_apply_call
+{
+    template<class F>
+    BOOST_HOF_INLINE auto operator()(F&& f) const BOOST_HOF_RETURNS(f());
+};
+
+struct parallel_apply_result_f
+{
+    template<class... Fs>
+    auto operator()(Fs&&... fs) const -> decltype(boost::hof::pack(fs()...));
+};
+
+template<class R, class Executor, class G, class... Fs>
+R parallel_apply_eval(const parallel_policy<Executor>& p, const G& g, Fs&&... fs)
+{
+    return detail::parallel_eval<R>(p, pack_f(), detail::make_parallel_task(g, BOOST_HOF_FORWARD(Fs)(fs))...);
+}
+
+template<class Executor>
+struct parallel_apply_each
+{
+    const parallel_policy<Executor>& policy;
+
+    template<class... Fs, class R=decltype(boost::hof::pack(std::declval<Fs>()()...))>
+    R operator()(Fs&&... fs) const
+    {
+        return detail::parallel_apply_eval<R>(policy, parallel_apply_call(), BOOST_HOF_FORWARD(Fs)(fs)...);
+    }
+};
+
+}
+
+template<class Sequence>
+struct parallel_apply_adaptor
+{
+    Sequence sequence;
+
+    template<class X, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(Sequence, X&&)>
+    constexpr explicit parallel_apply_adaptor(X&& x)
+    : sequence(BOOST_HOF_FORWARD(X)(x))
+    {}
+
+    template<class Executor, class S=Sequence, class R=decltype(
+        boost::hof::unpack(detail::parallel_apply_result_f())(std::declval<const S&>())
+    )>
+    R operator()(const parallel_policy<Executor>& p) const
+    {
+        return boost::hof::unpack(detail::parallel_apply_each<Executor>{p})(sequence);
+    }
+
+    template<class Executor, class S=Sequence, class R=decltype(
+        boost::hof::unpack(detail::parallel_apply_result_f())(std::declval<const S&>())
+    )>
+    R operator()(const Executor& e) const
+    {
+        return (*this)(boost::hof::parallel_on(e));
+    }
+
+    template<class S=Sequence, class R=decltype(
+        boost::hof::unpack(detail::parallel_apply_result_f())(std::declval<const S&>())
+    )>
+    R operator()() const
+    {
+        return (*this)(parallel_policy<thread_executor>());
+    }
+};
+
+BOOST_HOF_DETAIL_COMPILE_MARKER(parallel_apply, parallel_apply_adaptor)
+
+BOOST_HOF_DECLARE_STATIC_VAR(parallel_apply, detail::make<parallel_apply_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
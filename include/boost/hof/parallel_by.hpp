@@ -0,0 +1,221 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    parallel_by.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_PARALLEL_BY_H
+#define BOOST_HOF_GUARD_PARALLEL_BY_H
+
+/// parallel_by
+/// ===========
+///
+/// Description
+/// -----------
+///
+/// The `parallel_by` function adaptor works like [`proj`](proj), except the
+/// projection is applied to each argument concurrently on an
+/// [executor](executor), and then the results are passed to the function
+/// once all of them have finished. The first projection is called on the
+/// calling thread while the others are running.
+///
+/// Also, if just a projection is given, then the projection will be called
+/// concurrently for each of its arguments.
+///
+/// A [`parallel_policy`](executor) can be passed as the first parameter to
+/// choose the executor and the threshold. By default, the `thread_executor`
+/// is used. When there are fewer arguments than the threshold, the
+/// projections are called on the calling thread instead.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Projection, class F>
+///     parallel_by_adaptor<thread_executor, Projection, F> parallel_by(Projection p, F f);
+///
+///     template<class Projection>
+///     parallel_by_adaptor<thread_executor, Projection> parallel_by(Projection p);
+///
+///     template<class Executor, class Projection, class F>
+///     parallel_by_adaptor<Executor, Projection, F> parallel_by(parallel_policy<Executor> e, Projection p, F f);
+///
+///     template<class Executor, class Projection>
+///     parallel_by_adaptor<Executor, Projection> parallel_by(parallel_policy<Executor> e, Projection p);
+///
+/// Semantics
+/// ---------
+///
+///     assert(parallel_by(p, f)(xs...) == f(p(xs)...));
+///     assert(parallel_by(p)(xs...) == p(xs)...);
+///
+/// Requirements
+/// ------------
+///
+/// Projection must be:
+///
+/// * [UnaryInvocable](UnaryInvocable)
+/// * MoveConstructible
+/// * Safe to call concurrently
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct square
+///     {
+///         int operator()(int x) const
+///         {
+///             return x * x;
+///         }
+///     };
+///
+///     int main() {
+///         auto f = boost::hof::parallel_by(square(), boost::hof::_ + boost::hof::_);
+///         assert(f(3, 4) == 25);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [proj](proj)
+/// * [executor](executor)
+///
+
+#include <boost/hof/always.hpp>
+#include <boost/hof/executor.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/holder.hpp>
+#include <boost/hof/detail/parallel_eval.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+
+namespace boost { namespace hof {
+
+template<class Executor, class Projection, class F=void>
+struct parallel_by_adaptor
+: detail::compressed_pair<detail::callable_base<Projection>, detail::callable_base<F>>
+{
+    typedef detail::compressed_pair<detail::callable_base<Projection>, detail::callable_base<F>> base;
+    parallel_policy<Executor> policy;
+
+    BOOST_HOF_INHERIT_DEFAULT(parallel_by_adaptor, base, Executor)
+
+    template<class P, class X,
+        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(base, P, X)>
+    constexpr parallel_by_adaptor(P&& p, X&& x)
+    : base(BOOST_HOF_FORWARD(P)(p), BOOST_HOF_FORWARD(X)(x)), policy()
+    {}
+
+    template<class P, class X,
+        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(base, P, X)>
+    constexpr parallel_by_adaptor(parallel_policy<Executor> e, P&& p, X&& x)
+    : base(BOOST_HOF_FORWARD(P)(p), BOOST_HOF_FORWARD(X)(x)), policy(e)
+    {}
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return this->second(xs...);
+    }
+
+    template<class... Ts>
+    constexpr const detail::callable_base<Projection>& base_projection(Ts&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    template<class... Ts, class R=decltype(
+        std::declval<const detail::callable_base<F>&>()(std::declval<const detail::callable_base<Projection>&>()(std::declval<Ts>())...)
+    )>
+    BOOST_HOF_INLINE R operator()(Ts&&... xs) const
+    {
+        return detail::parallel_eval<R>(
+            policy,
+            this->base_function(xs...),
+            detail::make_parallel_task(this->base_projection(xs...), BOOST_HOF_FORWARD(Ts)(xs))...
+        );
+    }
+};
+
+template<class Executor, class Projection>
+struct parallel_by_adaptor<Executor, Projection, void>
+: detail::callable_base<Projection>
+{
+    parallel_policy<Executor> policy;
+
+    BOOST_HOF_INHERIT_DEFAULT(parallel_by_adaptor, detail::callable_base<Projection>, Executor)
+
+    template<class P, BOOST_HOF_ENABLE_IF_CONVERTIBLE(P, detail::callable_base<Projection>)>
+    constexpr parallel_by_adaptor(P&& p)
+    : detail::callable_base<Projection>(BOOST_HOF_FORWARD(P)(p)), policy()
+    {}
+
+    template<class P, BOOST_HOF_ENABLE_IF_CONVERTIBLE(P, detail::callable_base<Projection>)>
+    constexpr parallel_by_adaptor(parallel_policy<Executor> e, P&& p)
+    : detail::callable_base<Projection>(BOOST_HOF_FORWARD(P)(p)), policy(e)
+    {}
+
+    template<class... Ts>
+    constexpr const detail::callable_base<Projection>& base_projection(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class... Ts, class=detail::holder<decltype(std::declval<const detail::callable_base<Projection>&>()(std::declval<Ts>()))...>>
+    BOOST_HOF_INLINE void operator()(Ts&&... xs) const
+    {
+        detail::parallel_eval_void(
+            policy,
+            detail::make_parallel_task(this->base_projection(xs...), BOOST_HOF_FORWARD(Ts)(xs))...
+        );
+    }
+};
+
+namespace detail {
+
+struct make_parallel_by
+{
+    constexpr make_parallel_by() noexcept
+    {}
+
+    template<class Projection>
+    BOOST_HOF_INLINE constexpr parallel_by_adaptor<thread_executor, Projection> operator()(Projection p) const
+    {
+        return parallel_by_adaptor<thread_executor, Projection>(static_cast<Projection&&>(p));
+    }
+
+    template<class Projection, class F>
+    BOOST_HOF_INLINE constexpr parallel_by_adaptor<thread_executor, Projection, F> operator()(Projection p, F f) const
+    {
+        return parallel_by_adaptor<thread_executor, Projection, F>(static_cast<Projection&&>(p), static_cast<F&&>(f));
+    }
+
+    template<class Executor, class Projection>
+    BOOST_HOF_INLINE constexpr parallel_by_adaptor<Executor, Projection> operator()(parallel_policy<Executor> e, Projection p) const
+    {
+        return parallel_by_adaptor<Executor, Projection>(e, static_cast<Projection&&>(p));
+    }
+
+    template<class Executor, class Projection, class F>
+    BOOST_HOF_INLINE constexpr parallel_by_adaptor<Executor, Projection, F> operator()(parallel_policy<Executor> e, Projection p, F f) const
+    {
+        return parallel_by_adaptor<Executor, Projection, F>(e, static_cast<Projection&&>(p), static_cast<F&&>(f));
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(parallel_by, detail::make_parallel_by);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,163 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    parallel_combine.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_PARALLEL_COMBINE_H
+#define BOOST_HOF_GUARD_PARALLEL_COMBINE_H
+
+/// parallel_combine
+/// ================
+///
+/// Description
+/// -----------
+///
+/// The `parallel_combine` function adaptor works like [`combine`](combine),
+/// except each function is called with its argument concurrently on an
+/// [executor](executor), and then the results are passed to the main
+/// function once all of them have finished. The first function is called on
+/// the calling thread while the others are running.
+///
+/// A [`parallel_policy`](executor) can be passed as the first parameter to
+/// choose the executor and the threshold. By default, the `thread_executor`
+/// is used. When there are fewer functions than the threshold, the functions
+/// are called on the calling thread instead.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F, class... Gs>
+///     parallel_combine_adaptor<thread_executor, F, Gs...> parallel_combine(F f, Gs... gs);
+///
+///     template<class Executor, class F, class... Gs>
+///     parallel_combine_adaptor<Executor, F, Gs...> parallel_combine(parallel_policy<Executor> p, F f, Gs... gs);
+///
+/// Semantics
+/// ---------
+///
+///     assert(parallel_combine(f, gs...)(xs...) == f(gs(xs)...));
+///
+/// Requirements
+/// ------------
+///
+/// F and Gs must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Gs must be safe to call concurrently.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct square
+///     {
+///         int operator()(int x) const
+///         {
+///             return x * x;
+///         }
+///     };
+///
+///     int main() {
+///         auto f = boost::hof::parallel_combine(boost::hof::_ + boost::hof::_, square(), square());
+///         assert(f(3, 4) == 25);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [combine](combine)
+/// * [executor](executor)
+///
+
+#include <boost/hof/combine.hpp>
+#include <boost/hof/executor.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/parallel_eval.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+
+namespace boost { namespace hof { namespace detail {
+
+template<class S, class Executor, class F, class... Gs>
+struct parallel_combine_adaptor_base;
+
+template<std::size_t... Ns, class Executor, class F, class... Gs>
+struct parallel_combine_adaptor_base<seq<Ns...>, Executor, F, Gs...>
+: combine_storage<seq<Ns...>, F, Gs...>
+{
+    typedef combine_storage<seq<Ns...>, F, Gs...> base_type;
+    parallel_policy<Executor> policy;
+
+    BOOST_HOF_INHERIT_DEFAULT(parallel_combine_adaptor_base, base_type, Executor)
+
+    template<class X, class... Xs,
+        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(base_type, X, Xs...)>
+    constexpr parallel_combine_adaptor_base(X&& x, Xs&&... xs)
+    : base_type(BOOST_HOF_FORWARD(X)(x), BOOST_HOF_FORWARD(Xs)(xs)...), policy()
+    {}
+
+    template<class X, class... Xs,
+        BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(base_type, X, Xs...)>
+    constexpr parallel_combine_adaptor_base(parallel_policy<Executor> p, X&& x, Xs&&... xs)
+    : base_type(BOOST_HOF_FORWARD(X)(x), BOOST_HOF_FORWARD(Xs)(xs)...), policy(p)
+    {}
+
+    template<class... Ts, class R=decltype(
+        std::declval<const F&>()(std::declval<const Gs&>()(std::declval<Ts>())...)
+    )>
+    BOOST_HOF_INLINE R operator()(Ts&&... xs) const
+    {
+        return detail::parallel_eval<R>(
+            policy,
+            this->base_function(xs...),
+            detail::make_parallel_task(
+                boost::hof::alias_value<pack_tag<seq<Ns+1>, F, Gs...>, Gs>(*this, xs),
+                BOOST_HOF_FORWARD(Ts)(xs)
+            )...
+        );
+    }
+};
+
+}
+
+template<class Executor, class F, class... Gs>
+struct parallel_combine_adaptor
+: detail::parallel_combine_adaptor_base<typename detail::gens<sizeof...(Gs)>::type, Executor, detail::callable_base<F>, detail::callable_base<Gs>...>
+{
+    typedef detail::parallel_combine_adaptor_base<typename detail::gens<sizeof...(Gs)>::type, Executor, detail::callable_base<F>, detail::callable_base<Gs>...> base_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(parallel_combine_adaptor, base_type)
+};
+
+namespace detail {
+
+struct make_parallel_combine
+{
+    constexpr make_parallel_combine() noexcept
+    {}
+
+    template<class F, class... Gs>
+    BOOST_HOF_INLINE constexpr parallel_combine_adaptor<thread_executor, F, Gs...> operator()(F f, Gs... gs) const
+    {
+        return parallel_combine_adaptor<thread_executor, F, Gs...>(static_cast<F&&>(f), static_cast<Gs&&>(gs)...);
+    }
+
+    template<class Executor, class F, class... Gs>
+    BOOST_HOF_INLINE constexpr parallel_combine_adaptor<Executor, F, Gs...> operator()(parallel_policy<Executor> p, F f, Gs... gs) const
+    {
+        return parallel_combine_adaptor<Executor, F, Gs...>(p, static_cast<F&&>(f), static_cast<Gs&&>(gs)...);
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(parallel_combine, detail::make_parallel_combine);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,301 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    parallel_fold.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_PARALLEL_FOLD_H
+#define BOOST_HOF_GUARD_PARALLEL_FOLD_H
+
+/// parallel_fold
+/// =============
+///
+/// Description
+/// -----------
+///
+/// The `parallel_fold` function adaptor folds the elements of a range with an
+/// associative binary function, like [`fold`](fold) does for its arguments,
+/// except the range is split into chunks that are folded concurrently on an
+/// [executor](executor). The first chunk is folded from the initial state on
+/// the calling thread, the other chunks are folded from their first element,
+/// and then the results of the chunks are combined with the same function,
+/// from left to right.
+///
+/// The chunks depend only on the size of the range and the grain size, which
+/// is the number of elements in each chunk, except the last one. So the
+/// elements are combined in the same order every time, even when the function
+/// is only associative up to rounding, such as adding floating point values.
+///
+/// The returned function takes the range, and the executor, or a
+/// [`parallel_policy`](executor) to also choose the threshold, which is the
+/// fewest number of chunks to run in parallel. By default, the
+/// `thread_executor` is used, and the grain size is 4096.
+///
+/// When a combine function is also given, the function only needs to take
+/// the state and an element, such as a reducer of [`mapping`](transducer)
+/// and [`filtering`](transducer), and the results of the chunks are combined
+/// with the combine function instead. Each chunk, except the first one, is
+/// then folded from a copy of the initial state, so the state must be the
+/// identity of the combine function, such as `0` for an addition.
+///
+/// When the executor has more than one node, such as the
+/// [`numa_executor`](numa_executor), the chunks are split into a contiguous
+/// block for each node, so the elements of a node are read by the workers of
+/// that node. The results are still combined in the same order.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F, class State>
+///     parallel_fold_adaptor<F, State> parallel_fold(F f, State s);
+///
+///     template<class F, class State, class Combine>
+///     parallel_fold_adaptor<F, State, Combine> parallel_fold(F f, State s, Combine c);
+///
+///     template<class F, class State, class Combine>
+///     template<class Range, class Executor>
+///     State parallel_fold_adaptor<F, State, Combine>::operator()(Range&& r, const Executor& e, std::size_t grain=4096) const;
+///
+/// Semantics
+/// ---------
+///
+///     assert(parallel_fold(f, s)(r) == fold(f, s)(r[0], r[1], ...));
+///
+/// When `f` is associative.
+///
+///     assert(parallel_fold(f, s, c)(r) == fold(f, s)(r[0], r[1], ...));
+///
+/// When `c` is associative, `s` is its identity, and
+/// `c(fold(f, a)(xs...), fold(f, s)(ys...)) == fold(f, a)(xs..., ys...)`.
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [BinaryInvocable](BinaryInvocable) with the state and an element, and
+///   with two states, that returns a value convertible to the state
+/// * MoveConstructible
+///
+/// State must be:
+///
+/// * CopyConstructible, and constructible from an element
+///
+/// Range must have random access iterators.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <vector>
+///
+///     int main() {
+///         std::vector<long> v(10000, 1);
+///         long sum = boost::hof::parallel_fold(boost::hof::_ + boost::hof::_, 0L)(v, boost::hof::thread_executor(), 1000);
+///         assert(sum == 10000);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [fold](fold)
+/// * [transducer](transducer)
+/// * [executor](executor)
+///
+
+#include <boost/hof/executor.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class State, class F, class Iterator>
+State parallel_fold_range(const F& f, State state, Iterator first, Iterator last)
+{
+    for (; first != last; ++first) state = f(std::move(state), *first);
+    return state;
+}
+
+template<class State, class F, class Iterator, bool FromState>
+struct parallel_fold_chunk
+{
+    const F* f;
+    const State* init;
+    Iterator first;
+    Iterator last;
+
+    State operator()() const
+    {
+        return detail::parallel_fold_range(*f, State(*first), std::next(first), last);
+    }
+};
+
+// With a combine function, each chunk is folded from a copy of the initial
+// state, which is the identity of the combine function
+template<class State, class F, class Iterator>
+struct parallel_fold_chunk<State, F, Iterator, true>
+{
+    const F* f;
+    const State* init;
+    Iterator first;
+    Iterator last;
+
+    State operator()() const
+    {
+        return detail::parallel_fold_range(*f, *init, first, last);
+    }
+};
+
+template<bool FromState, class State, class Executor, class F, class Combine, class Iterator>
+State parallel_fold_chunks(const Executor& e, const F& f, const Combine& combine, State state, const State* init, Iterator first, Iterator last, std::size_t grain)
+{
+    typedef parallel_fold_chunk<State, F, Iterator, FromState> chunk;
+    typedef decltype(detail::submit_on(e, 0, std::declval<chunk>())) handle;
+    std::size_t n = static_cast<std::size_t>(last - first);
+    std::size_t chunks = (n + grain - 1) / grain;
+    std::size_t nodes = detail::executor_nodes(e);
+    std::vector<handle> handles;
+    handles.reserve(chunks - 1);
+    for (std::size_t i = grain; i < n; i += grain)
+    {
+        Iterator it = first + i;
+        std::size_t node = detail::executor_node(i / grain, chunks, nodes);
+        handles.push_back(detail::submit_on(e, node, chunk{&f, init, it, n - i > grain ? it + grain : last}));
+    }
+    try
+    {
+        state = detail::parallel_fold_range(f, std::move(state), first, first + grain);
+        for (auto& h : handles) state = combine(std::move(state), h.get());
+    }
+    catch(...)
+    {
+        // The chunks refer to the range, so they are waited for before the
+        // exception leaves
+        for (auto& h : handles)
+        {
+            try { h.get(); } catch(...) {}
+        }
+        throw;
+    }
+    return state;
+}
+
+template<bool FromState, class State, class Executor, class F, class Combine, class Range>
+State parallel_fold_run(const parallel_policy<Executor>& p, const F& f, const Combine& combine, const State& state, Range&& r, std::size_t grain)
+{
+    auto first = std::begin(r);
+    auto last = std::end(r);
+    std::size_t n = static_cast<std::size_t>(last - first);
+    if (grain == 0) grain = 1;
+    if ((n + grain - 1) / grain < p.threshold || n <= grain)
+        return detail::parallel_fold_range(f, state, first, last);
+    return detail::parallel_fold_chunks<FromState>(p.executor, f, combine, state, &state, first, last, grain);
+}
+
+}
+
+template<class F, class State, class Combine=void>
+struct parallel_fold_adaptor
+: detail::compressed_pair<detail::compressed_pair<detail::callable_base<F>, detail::callable_base<Combine>>, State>
+{
+    typedef detail::compressed_pair<detail::callable_base<F>, detail::callable_base<Combine>> functions_type;
+    typedef detail::compressed_pair<functions_type, State> base_type;
+
+    template<class X, class S, class C>
+    constexpr parallel_fold_adaptor(X&& f, S&& s, C&& c)
+    : base_type(functions_type(BOOST_HOF_FORWARD(X)(f), BOOST_HOF_FORWARD(C)(c)), BOOST_HOF_FORWARD(S)(s))
+    {}
+
+    template<class... Ts>
+    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return this->first(xs...).first(xs...);
+    }
+
+    template<class... Ts>
+    constexpr const detail::callable_base<Combine>& base_combine(Ts&&... xs) const noexcept
+    {
+        return this->first(xs...).second(xs...);
+    }
+
+    template<class... Ts>
+    constexpr const State& get_state(Ts&&... xs) const noexcept
+    {
+        return this->second(xs...);
+    }
+
+    template<class Range, class Executor, class Iterator=decltype(std::begin(std::declval<Range&>()))>
+    State operator()(Range&& r, const parallel_policy<Executor>& p, std::size_t grain=4096) const
+    {
+        return detail::parallel_fold_run<true>(p, this->base_function(r), this->base_combine(r), this->get_state(r), r, grain);
+    }
+
+    template<class Range, class Executor, class Iterator=decltype(std::begin(std::declval<Range&>()))>
+    State operator()(Range&& r, const Executor& e, std::size_t grain=4096) const
+    {
+        return (*this)(r, boost::hof::parallel_on(e), grain);
+    }
+
+    template<class Range, class Iterator=decltype(std::begin(std::declval<Range&>()))>
+    State operator()(Range&& r) const
+    {
+        return (*this)(r, parallel_policy<thread_executor>());
+    }
+};
+
+template<class F, class State>
+struct parallel_fold_adaptor<F, State, void>
+: detail::compressed_pair<detail::callable_base<F>, State>
+{
+    typedef detail::compressed_pair<detail::callable_base<F>, State> base_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(parallel_fold_adaptor, base_type)
+
+    template<class... Ts>
+    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    template<class... Ts>
+    constexpr const State& get_state(Ts&&... xs) const noexcept
+    {
+        return this->second(xs...);
+    }
+
+    template<class Range, class Executor, class Iterator=decltype(std::begin(std::declval<Range&>()))>
+    State operator()(Range&& r, const parallel_policy<Executor>& p, std::size_t grain=4096) const
+    {
+        const auto& f = this->base_function(r);
+        return detail::parallel_fold_run<false>(p, f, f, this->get_state(r), r, grain);
+    }
+
+    template<class Range, class Executor, class Iterator=decltype(std::begin(std::declval<Range&>()))>
+    State operator()(Range&& r, const Executor& e, std::size_t grain=4096) const
+    {
+        return (*this)(r, boost::hof::parallel_on(e), grain);
+    }
+
+    template<class Range, class Iterator=decltype(std::begin(std::declval<Range&>()))>
+    State operator()(Range&& r) const
+    {
+        return (*this)(r, parallel_policy<thread_executor>());
+    }
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(parallel_fold, detail::make<parallel_fold_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
@@ -22,6 +22,14 @@
 /// when the function is aprtial application. `std::ref` can be used to
 /// capture references instead.
 /// 
+/// The arguments of each partial application are joined into one pack, so
+/// `partial(f)(x)(y)` is the same type as `partial(f)(x, y)`, and calling it
+/// unpacks the arguments once. Applying `partial` to a partial adaptor
+/// returns the adaptor, instead of wrapping it again.
+/// 
+/// Calling an rvalue partial adaptor moves the captured arguments, so it can
+/// hold move-only values, such as `std::unique_ptr`, and pass them by value.
+/// 
 /// Synopsis
 /// --------
 /// 
@@ -66,6 +74,7 @@
 /// 
 /// * [Partial application](https://en.wikipedia.org/wiki/Partial_application)
 /// * [Currying](https://en.wikipedia.org/wiki/Currying)
+/// * [partial_at](partial_at)
 /// 
 
 #include <boost/hof/first_of.hpp>
@@ -82,7 +91,38 @@ namespace boost { namespace hof {
 template<class F, class Pack=void >
 struct partial_adaptor;
 
-BOOST_HOF_DECLARE_STATIC_VAR(partial, detail::make<partial_adaptor>);
+BOOST_HOF_DETAIL_COMPILE_MARKER(partial, partial_adaptor)
+
+namespace detail {
+
+template<class... Fs>
+struct partial_result
+{
+    typedef BOOST_HOF_DETAIL_MAKE_RESULT(partial_adaptor, Fs...) type;
+};
+
+// A partial adaptor already collects the arguments into one pack, so it
+// isn't wrapped again
+template<class F, class Pack>
+struct partial_result<partial_adaptor<F, Pack>>
+{
+    typedef partial_adaptor<F, Pack> type;
+};
+
+struct make_partial
+{
+    constexpr make_partial() noexcept
+    {}
+    template<class... Fs, class Result=typename partial_result<Fs...>::type>
+    BOOST_HOF_INLINE constexpr Result operator()(Fs... fs) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(Result, Fs&&...)
+    {
+        return Result(static_cast<Fs&&>(fs)...);
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(partial, detail::make_partial);
 
 namespace detail {
 
@@ -90,7 +130,7 @@ template<class Derived, class F, class Pack>
 struct partial_adaptor_invoke
 {
     template<class... Ts>
-    constexpr const F& get_function(Ts&&...) const noexcept
+    BOOST_HOF_INLINE constexpr const F& get_function(Ts&&...) const noexcept
     {
         return static_cast<const F&>(static_cast<const Derived&>(*this));
     }
@@ -103,8 +143,8 @@ struct partial_adaptor_invoke
 
     BOOST_HOF_RETURNS_CLASS(partial_adaptor_invoke);
 
-    template<class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(partial, Ts...)>
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT
     (
         typename result_of<decltype(boost::hof::pack_join), 
             id_<const Pack&>, 
@@ -133,7 +173,7 @@ template<class Derived, class F, class Pack>
 struct partial_adaptor_join
 {
     template<class... Ts>
-    constexpr const F& get_function(Ts&&...) const noexcept
+    BOOST_HOF_INLINE constexpr const F& get_function(Ts&&...) const noexcept
     {
         return static_cast<const F&>(static_cast<const Derived&>(*this));
     }
@@ -148,8 +188,8 @@ struct partial_adaptor_join
 
     template<class... Ts, class=typename std::enable_if<
         ((sizeof...(Ts) + Pack::fit_function_param_limit::value) < function_param_limit<F>::value)
-    >::type>
-    constexpr auto operator()(Ts&&... xs) const 
+    >::type BOOST_HOF_DETAIL_CALL_MARKER(partial, Ts...)>
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const 
 #ifdef _MSC_VER
     // Workaround ICE on MSVC
     noexcept(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(F, F&&) && noexcept(boost::hof::pack_join(std::declval<const Pack&>(), boost::hof::pack(BOOST_HOF_FORWARD(Ts)(xs)...))))
@@ -172,7 +212,7 @@ struct partial_adaptor_pack
     {}
     
     template<class... Ts>
-    constexpr const F& get_function(Ts&&...) const noexcept
+    BOOST_HOF_INLINE constexpr const F& get_function(Ts&&...) const noexcept
     {
         return static_cast<const F&>(static_cast<const Derived&>(*this));
     }
@@ -181,8 +221,8 @@ struct partial_adaptor_pack
 
     template<class... Ts, class=typename std::enable_if<
         (sizeof...(Ts) < function_param_limit<F>::value)
-    >::type>
-    constexpr auto operator()(Ts&&... xs) const 
+    >::type BOOST_HOF_DETAIL_CALL_MARKER(partial, Ts...)>
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const 
 #ifdef _MSC_VER
     // Workaround ICE on MSVC
     noexcept(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(F, F&&) && noexcept(boost::hof::pack(BOOST_HOF_FORWARD(Ts)(xs)...)))
@@ -226,7 +266,7 @@ struct partial_adaptor : detail::partial_adaptor_base<F, Pack>::type, F, Pack
     typedef partial_adaptor fit_rewritable1_tag;
     
     template<class... Ts>
-    constexpr const F& base_function(Ts&&...) const noexcept
+    BOOST_HOF_INLINE constexpr const F& base_function(Ts&&...) const noexcept
     {
         return *this;
     }
@@ -245,6 +285,40 @@ struct partial_adaptor : detail::partial_adaptor_base<F, Pack>::type, F, Pack
     BOOST_HOF_NOEXCEPT(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(F, X&&) && BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(Pack, S&&))
     : F(BOOST_HOF_FORWARD(X)(x)), Pack(BOOST_HOF_FORWARD(S)(seq))
     {}
+
+#if BOOST_HOF_DETAIL_PACK_HAS_RVALUE_CALL
+    BOOST_HOF_RETURNS_CLASS(partial_adaptor);
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr auto consume(int, Ts&&... xs) && BOOST_HOF_RETURNS
+    (
+        BOOST_HOF_RETURNS_STATIC_CAST(Pack&&)(*BOOST_HOF_THIS)
+        (boost::hof::detail::make_pack_append_invoke(
+            BOOST_HOF_RETURNS_STATIC_CAST(F&&)(*BOOST_HOF_THIS), 
+            boost::hof::pack_forward(BOOST_HOF_FORWARD(Ts)(xs)...)
+        ))
+    );
+
+    template<class... Ts, class=typename std::enable_if<
+        ((sizeof...(Ts) + Pack::fit_function_param_limit::value) < function_param_limit<F>::value)
+    >::type>
+    BOOST_HOF_INLINE constexpr auto consume(long, Ts&&... xs) && BOOST_HOF_RETURNS
+    (
+        boost::hof::partial
+        (
+            BOOST_HOF_RETURNS_STATIC_CAST(F&&)(*BOOST_HOF_THIS), 
+            boost::hof::pack_join(BOOST_HOF_RETURNS_STATIC_CAST(Pack&&)(*BOOST_HOF_THIS), boost::hof::pack(BOOST_HOF_FORWARD(Ts)(xs)...))
+        )
+    );
+
+    // An rvalue moves the function and the arguments it holds, into the call
+    // or into the next partial application, so they don't have to be copyable
+    template<class... Ts, class=void>
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) && BOOST_HOF_RETURNS
+    (
+        BOOST_HOF_RETURNS_STATIC_CAST(partial_adaptor&&)(*BOOST_HOF_THIS).consume(0, BOOST_HOF_FORWARD(Ts)(xs)...)
+    );
+#endif
 };
 
 template<class F>
@@ -255,7 +329,7 @@ struct partial_adaptor<F, void> : detail::partial_adaptor_pack_base<partial_adap
     typedef partial_adaptor fit_rewritable1_tag;
     
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&...) const noexcept
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&...) const noexcept
     {
         return *this;
     }
@@ -0,0 +1,152 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    partial_at.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_PARTIAL_AT_H
+#define BOOST_HOF_GUARD_PARTIAL_AT_H
+
+/// partial_at
+/// ==========
+///
+/// Description
+/// -----------
+///
+/// The `partial_at` function adaptor binds values at the zero-based position
+/// `I` of the arguments, instead of at the front like [`partial`](partial).
+/// The first call binds the values, and calling the result passes the first
+/// `I` arguments, then the bound values, then the rest of the arguments. So
+/// `partial_at<1>(f)(y)(x, z)` calls `f(x, y, z)`, which is the same as
+/// `lazy(f)(_1, y, _2)`, except the arguments are forwarded in one expansion,
+/// without resolving placeholders.
+///
+/// The bound values are decayed and stored by value, and they are passed as
+/// const lvalues.
+///
+/// Synopsis
+/// --------
+///
+///     template<std::size_t I, class F>
+///     constexpr partial_at_adaptor<I, F> partial_at(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(partial_at<sizeof...(xs)>(f)(ys...)(xs..., zs...) == f(xs..., ys..., zs...));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int main() {
+///         auto f = [](int x, int y, int z) { return x*100 + y*10 + z; };
+///         assert(boost::hof::partial_at<1>(f)(2)(1, 3) == 123);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [partial](partial)
+/// * [lazy](lazy)
+///
+
+#include <boost/hof/arg.hpp>
+#include <boost/hof/always.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <boost/hof/detail/seq.hpp>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<std::size_t I, class F, class Pack, std::size_t N>
+struct partial_at_invoke : detail::compressed_pair<detail::callable_base<F>, Pack>
+{
+    typedef detail::compressed_pair<detail::callable_base<F>, Pack> base;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(partial_at_invoke, base)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const Pack& get_pack(Ts&&... xs) const noexcept
+    {
+        return this->second(xs...);
+    }
+
+    BOOST_HOF_RETURNS_CLASS(partial_at_invoke);
+
+    template<std::size_t... Hs, std::size_t... Bs, std::size_t... Ns, class... Ts>
+    BOOST_HOF_INLINE constexpr auto partial_at_call(seq<Hs...>, seq<Bs...>, seq<Ns...>, Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        (BOOST_HOF_MANGLE_CAST(const detail::callable_base<F>&)(BOOST_HOF_CONST_THIS->base_function(xs...)))
+        (
+            boost::hof::detail::get_args<Hs+1>(BOOST_HOF_FORWARD(Ts)(xs)...)...,
+            boost::hof::pack_get<Bs>(BOOST_HOF_CONST_THIS->get_pack(xs...))...,
+            boost::hof::detail::get_args<I+Ns+1>(BOOST_HOF_FORWARD(Ts)(xs)...)...
+        )
+    );
+
+    template<class... Ts, class=typename std::enable_if<(sizeof...(Ts) >= I)>::type>
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        BOOST_HOF_CONST_THIS->partial_at_call(
+            typename gens<I>::type(),
+            typename gens<N>::type(),
+            typename gens<sizeof...(Ts)-I>::type(),
+            BOOST_HOF_FORWARD(Ts)(xs)...
+        )
+    );
+};
+
+}
+
+template<std::size_t I, class F>
+struct partial_at_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(partial_at_adaptor, detail::callable_base<F>);
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr detail::partial_at_invoke<I, F, decltype(boost::hof::pack(std::declval<Ts>()...)), sizeof...(Ts)>
+    operator()(Ts&&... xs) const
+    {
+        return detail::partial_at_invoke<I, F, decltype(boost::hof::pack(std::declval<Ts>()...)), sizeof...(Ts)>(
+            this->base_function(xs...), boost::hof::pack(BOOST_HOF_FORWARD(Ts)(xs)...)
+        );
+    }
+};
+
+template<std::size_t I, class F>
+constexpr partial_at_adaptor<I, F> partial_at(F f)
+BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(partial_at_adaptor<I, F>, F&&)
+{
+    return partial_at_adaptor<I, F>(boost::hof::move(f));
+}
+
+}} // namespace boost::hof
+
+#endif
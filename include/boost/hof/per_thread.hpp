@@ -0,0 +1,192 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    per_thread.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FUNCTION_PER_THREAD_H
+#define BOOST_HOF_GUARD_FUNCTION_PER_THREAD_H
+
+/// per_thread
+/// ==========
+///
+/// Description
+/// -----------
+///
+/// The `per_thread` function adaptor gives each thread its own replica of a
+/// function object with a non-const call operator, such as one that holds
+/// counters or a scratch buffer. Unlike [`thread_local_`](thread_local), the
+/// replicas are kept by the adaptor, where they are indexed by a small id of the
+/// thread, so `for_each_replica` can visit all of them, such as to merge their
+/// statistics. Each replica is padded to its own cache line, so the threads
+/// don't contend on them.
+///
+/// A replica is copied from the function passed to `per_thread` on the first
+/// call of a thread. The id of a thread is reused by a thread that starts
+/// after it exits, which then continues with the same replica, so the
+/// statistics of exited threads are kept. Copies of the adaptor share the
+/// replicas.
+///
+/// The replicas are visited while the other threads can still call them, so
+/// `for_each_replica` should only read state that can be read concurrently,
+/// such as atomics, unless the threads are done.
+///
+/// The adaptor is default constructible when the function is, so it can be
+/// declared with [`BOOST_HOF_STATIC_FUNCTION_LAZY`](static_lazy).
+///
+/// Synopsis
+/// --------
+///
+///     template<class F>
+///     per_thread_adaptor<F> per_thread(F f);
+///
+///     template<class F>
+///     template<class G>
+///     void per_thread_adaptor<F>::for_each_replica(G g) const;
+///
+/// Semantics
+/// ---------
+///
+///     assert(per_thread(f)(xs...) == F(f)(xs...));
+///
+/// Where the replica of `f` is made by the first call in each thread.
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [MutableFunctionObject](MutableFunctionObject)
+/// * CopyConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <atomic>
+///     #include <cassert>
+///
+///     struct hit_counter
+///     {
+///         std::atomic<long> hits{0};
+///         hit_counter() = default;
+///         hit_counter(const hit_counter&) {}
+///         void operator()()
+///         {
+///             hits.store(hits.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+///         }
+///     };
+///
+///     BOOST_HOF_STATIC_FUNCTION_LAZY(record_hit, boost::hof::per_thread_adaptor<hit_counter>);
+///
+///     int main() {
+///         record_hit();
+///         record_hit();
+///         long total = 0;
+///         record_hit.base_function().for_each_replica([&](const hit_counter& c) { total += c.hits.load(); });
+///         assert(total == 2);
+///     }
+///
+
+#include <boost/hof/detail/chunked_slots.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/detail/thread_block.hpp>
+#include <atomic>
+#include <memory>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+struct per_thread_block
+{
+    std::atomic<bool> in_use;
+    per_thread_block* next;
+    std::size_t index;
+
+    static std::size_t next_index() noexcept
+    {
+        static std::atomic<std::size_t> i(0);
+        return i++;
+    }
+
+    per_thread_block() : in_use(true), next(nullptr), index(next_index())
+    {}
+};
+
+template<class F>
+struct per_thread_replica
+{
+    F f;
+    // The replicas are allocated separately, so the padding after each one
+    // keeps the next replica off its cache line
+    char padding[64];
+
+    per_thread_replica(const F& x) : f(x)
+    {}
+};
+
+// The replicas are found without locking, and the lock is only taken to
+// create a missing replica
+template<class F>
+struct per_thread_state
+{
+    F prototype;
+    chunked_slots<per_thread_replica<F>> replicas;
+
+    per_thread_state(F f) : prototype(std::move(f))
+    {}
+
+    per_thread_state(const per_thread_state&)=delete;
+    per_thread_state& operator=(const per_thread_state&)=delete;
+
+    F& get(std::size_t index)
+    {
+        return replicas.get(index, [this] { return new per_thread_replica<F>(prototype); }).f;
+    }
+
+    template<class G>
+    void for_each(G& g) const
+    {
+        replicas.for_each([&g](const per_thread_replica<F>& r) { g(static_cast<const F&>(r.f)); });
+    }
+};
+
+}
+
+template<class F>
+struct per_thread_adaptor
+{
+    std::shared_ptr<detail::per_thread_state<F>> state;
+
+    template<class... Ts, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(F, Ts&&...)>
+    per_thread_adaptor(Ts&&... xs) : state(std::make_shared<detail::per_thread_state<F>>(F(BOOST_HOF_FORWARD(Ts)(xs)...)))
+    {}
+
+    F& base_function() const
+    {
+        return state->get(detail::thread_block<detail::per_thread_block>::this_thread().index);
+    }
+
+    template<class G>
+    void for_each_replica(G g) const
+    {
+        state->for_each(g);
+    }
+
+    template<class... Ts, class R=decltype(std::declval<F&>()(std::declval<Ts>()...))>
+    R operator()(Ts&&... xs) const
+    {
+        return this->base_function()(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(per_thread, detail::make<per_thread_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,119 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    permute.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_PERMUTE_H
+#define BOOST_HOF_GUARD_PERMUTE_H
+
+/// permute
+/// =======
+///
+/// Description
+/// -----------
+///
+/// The `permute` function adaptor reorders the first arguments by the
+/// zero-based indices, and passes the rest of the arguments after them
+/// unchanged. It generalizes [`flip`](flip), which is `permute<1, 0>`, and
+/// [`rotate`](rotate) for a fixed number of arguments. The arguments are
+/// forwarded in the new order in one expansion, without collecting them in a
+/// pack first.
+///
+/// Synopsis
+/// --------
+///
+///     template<std::size_t... Is, class F>
+///     constexpr permute_adaptor<F, Is...> permute(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(permute<Is...>(f)(xs..., ys...) == f(arg_c<Is+1>(xs...)..., ys...));
+///
+/// Where `sizeof...(xs) == sizeof...(Is)`.
+///
+/// Requirements
+/// ------------
+///
+/// The indices `Is...` must be a permutation of `0` to `sizeof...(Is)-1`.
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int main() {
+///         auto f = [](int x, int y, int z) { return x*100 + y*10 + z; };
+///         assert(boost::hof::permute<2, 0, 1>(f)(1, 2, 3) == 312);
+///     }
+///
+
+#include <boost/hof/arg.hpp>
+#include <boost/hof/always.hpp>
+#include <boost/hof/detail/and.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/index_count.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <boost/hof/detail/seq.hpp>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<std::size_t... Is>
+struct is_permutation
+: std::integral_constant<bool, BOOST_HOF_AND_UNPACK(((Is < sizeof...(Is)) && index_count<Is, Is...>::value == 1))>
+{};
+
+}
+
+template<class F, std::size_t... Is>
+struct permute_adaptor : detail::callable_base<F>
+{
+    static_assert(detail::is_permutation<Is...>::value, "The indices must be a permutation of 0 to N-1");
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(permute_adaptor, detail::callable_base<F>);
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    BOOST_HOF_RETURNS_CLASS(permute_adaptor);
+
+    template<std::size_t... Ns, class... Ts>
+    BOOST_HOF_INLINE constexpr auto permute_call(detail::seq<Ns...>, Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        (BOOST_HOF_MANGLE_CAST(const detail::callable_base<F>&)(BOOST_HOF_CONST_THIS->base_function(xs...)))
+        (
+            boost::hof::detail::get_args<Is+1>(BOOST_HOF_FORWARD(Ts)(xs)...)...,
+            boost::hof::detail::get_args<sizeof...(Is)+Ns+1>(BOOST_HOF_FORWARD(Ts)(xs)...)...
+        )
+    );
+
+    template<class... Ts, class=typename std::enable_if<(sizeof...(Ts) >= sizeof...(Is))>::type>
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        BOOST_HOF_CONST_THIS->permute_call(typename detail::gens<sizeof...(Ts)-sizeof...(Is)>::type(), BOOST_HOF_FORWARD(Ts)(xs)...)
+    );
+};
+
+template<std::size_t... Is, class F>
+constexpr permute_adaptor<F, Is...> permute(F f)
+BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(permute_adaptor<F, Is...>, F&&)
+{
+    return permute_adaptor<F, Is...>(boost::hof::move(f));
+}
+
+}} // namespace boost::hof
+
+#endif
@@ -20,16 +20,45 @@
 /// nested function calls. Functions that are made pipable can still be called
 /// the traditional way without piping in the first parameter.
 /// 
+/// The closure returned by `pipable(f)(ys...)` refers to the function and to
+/// the arguments, so in a chain such as `x | f(a) | g(b)` nothing is copied
+/// or moved for each stage, and the arguments are forwarded straight into
+/// the call of the function. This means the closure must be piped in the
+/// same full expression it is built in, unless the function and the
+/// arguments outlive it. When `BOOST_HOF_PIPABLE_ALLOC_FREE` is defined to
+/// 1, it is checked at compile time that the closures only hold references.
+/// 
+/// The `pipable` adaptor tries to call the function directly first, and
+/// builds a closure when it can't be called, so every call checks whether
+/// the function can be called with the arguments. The `pipable_c` version
+/// takes the number of parameters of the function instead, so a call with
+/// `N` arguments calls the function, and a call with fewer arguments builds
+/// the closure, without checking the function for each call. This also sets
+/// the [`function_param_limit`](function_param_limit) to `N`.
+/// 
+/// The pipe operators are hidden friends of the adaptors and of the closures,
+/// so they are only found by argument dependent lookup when a pipable function
+/// is on the right, and they don't take part in the overload resolution of the
+/// pipes of other libraries. When the standard library provides
+/// `std::ranges::range_adaptor_closure`, which is detected by
+/// `BOOST_HOF_HAS_RANGE_ADAPTOR_CLOSURE`, the adaptors and the closures derive
+/// from it, so they can be composed with the views, such as in
+/// `v | std::views::take(2) | f(a)` or `std::views::take(2) | f(a)`.
+/// 
 /// Synopsis
 /// --------
 /// 
 ///     template<class F>
 ///     constexpr pipable_adaptor<F> pipable(F f);
 /// 
+///     template<std::size_t N, class F>
+///     constexpr pipable_c_adaptor<N, F> pipable_c(F f);
+/// 
 /// Semantics
 /// ---------
 /// 
 ///     assert(x | pipable(f)(ys...) == f(x, ys...));
+///     assert(x | pipable_c<sizeof...(ys)+1>(f)(ys...) == f(x, ys...));
 /// 
 /// Requirements
 /// ------------
@@ -58,6 +87,7 @@
 ///     int main() {
 ///         assert(3 == (1 | pipable(sum())(2)));
 ///         assert(3 == pipable(sum())(1, 2));
+///         assert(3 == (1 | pipable_c<2>(sum())(2)));
 ///     }
 /// 
 /// References
@@ -73,6 +103,11 @@
 #include <boost/hof/detail/make.hpp>
 #include <boost/hof/detail/static_const_var.hpp>
 #include <boost/hof/limit.hpp>
+#include <boost/hof/config.hpp>
+#include <type_traits>
+#if BOOST_HOF_HAS_RANGE_ADAPTOR_CLOSURE
+#include <ranges>
+#endif
 
 namespace boost { namespace hof { 
  
@@ -81,20 +116,39 @@ struct pipable_adaptor;
 
 namespace detail {
 
+// The closure refers to the function and the arguments instead of storing
+// them, so building it for each stage of a pipeline never copies or moves
+// anything. It can only be used in the same full expression, unless the
+// function and the arguments outlive it.
+// With the standard ranges, the closures also compose with the views, such
+// as `std::views::filter(p) | f(a)`
+#if BOOST_HOF_HAS_RANGE_ADAPTOR_CLOSURE
+template<class Derived>
+using pipe_range_closure = std::ranges::range_adaptor_closure<Derived>;
+#else
+template<class Derived>
+struct pipe_range_closure
+{};
+#endif
+
 template<class F, class Pack>
-struct pipe_closure : F, Pack
+struct pipe_closure : Pack, pipe_range_closure<pipe_closure<F, Pack>>
 {
-    
-    template<class X, class P>
-    constexpr pipe_closure(X&& fp, P&& packp) 
-    BOOST_HOF_NOEXCEPT(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(F, X&&) && BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(Pack, P&&))
-    : F(BOOST_HOF_FORWARD(X)(fp)), Pack(BOOST_HOF_FORWARD(P)(packp))
+#if BOOST_HOF_PIPABLE_ALLOC_FREE
+    static_assert(std::is_trivially_destructible<Pack>::value, "The pipe closure must only hold references");
+#endif
+    const F * f;
+
+    template<class P>
+    constexpr pipe_closure(const F& fp, P&& packp) 
+    BOOST_HOF_NOEXCEPT(BOOST_HOF_IS_NOTHROW_CONSTRUCTIBLE(Pack, P&&))
+    : Pack(BOOST_HOF_FORWARD(P)(packp)), f(&fp)
     {}
 
     template<class... Ts>
-    constexpr const F& base_function(Ts&&...) const noexcept
+    BOOST_HOF_INLINE constexpr const F& base_function(Ts&&...) const noexcept
     {
-        return *this;
+        return *f;
     }
 
     template<class... Ts>
@@ -117,23 +171,29 @@ struct pipe_closure : F, Pack
         BOOST_HOF_RETURNS_CLASS(invoke);
 
         template<class... Ts>
-        constexpr BOOST_HOF_SFINAE_RESULT(const F&, id_<A>, id_<Ts>...) 
+        BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(const F&, id_<A>, id_<Ts>...) 
         operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
-        (BOOST_HOF_RETURNS_STATIC_CAST(const F&)(*BOOST_HOF_CONST_THIS->self)(BOOST_HOF_FORWARD(A)(a), BOOST_HOF_FORWARD(Ts)(xs)...));
+        (BOOST_HOF_CONST_THIS->self->base_function(xs...)(BOOST_HOF_FORWARD(A)(a), BOOST_HOF_FORWARD(Ts)(xs)...));
     };
 
     BOOST_HOF_RETURNS_CLASS(pipe_closure);
 
     template<class A>
-    constexpr BOOST_HOF_SFINAE_RESULT(const Pack&, id_<invoke<A&&>>) 
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(const Pack&, id_<invoke<A&&>>) 
     operator()(A&& a) const BOOST_HOF_SFINAE_RETURNS
     (BOOST_HOF_MANGLE_CAST(const Pack&)(BOOST_HOF_CONST_THIS->get_pack(a))(invoke<A&&>(BOOST_HOF_FORWARD(A)(a), BOOST_HOF_CONST_THIS)));
+
+    // The operator is only found by argument dependent lookup, so it isn't
+    // considered for the other pipes
+    template<class A>
+    friend constexpr auto operator|(A&& a, const pipe_closure& p) BOOST_HOF_RETURNS
+    (p(BOOST_HOF_FORWARD(A)(a)));
 };
 
 template<class F, class Pack>
-constexpr auto make_pipe_closure(F f, Pack&& p) BOOST_HOF_RETURNS
+constexpr auto make_pipe_closure(const F& f, Pack&& p) BOOST_HOF_RETURNS
 (
-    pipe_closure<F, typename std::remove_reference<Pack>::type>(BOOST_HOF_RETURNS_STATIC_CAST(F&&)(f), BOOST_HOF_FORWARD(Pack)(p))
+    pipe_closure<F, typename std::remove_reference<Pack>::type>(f, BOOST_HOF_FORWARD(Pack)(p))
 );
 
 
@@ -141,7 +201,7 @@ template<class Derived, class F>
 struct pipe_pack
 {
     template<class... Ts>
-    constexpr const F& get_function(Ts&&...) const noexcept
+    BOOST_HOF_INLINE constexpr const F& get_function(Ts&&...) const noexcept
     {
         return static_cast<const F&>(static_cast<const Derived&>(*this));
     }
@@ -150,53 +210,104 @@ struct pipe_pack
 
     template<class... Ts, class=typename std::enable_if<
         (sizeof...(Ts) < function_param_limit<F>::value)
-    >::type>
-    constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
-    (make_pipe_closure(BOOST_HOF_RETURNS_C_CAST(F&&)(BOOST_HOF_CONST_THIS->get_function(xs...)), boost::hof::pack_forward(BOOST_HOF_FORWARD(Ts)(xs)...)));
+    >::type BOOST_HOF_DETAIL_CALL_MARKER(pipable, Ts...)>
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    (make_pipe_closure(BOOST_HOF_CONST_THIS->get_function(xs...), boost::hof::pack_forward(BOOST_HOF_FORWARD(Ts)(xs)...)));
 };
-    
-template<class A, class F, class Pack>
-constexpr auto operator|(A&& a, const pipe_closure<F, Pack>& p) BOOST_HOF_RETURNS
-(p(BOOST_HOF_FORWARD(A)(a)));
+
+template<class F>
+struct is_pipable
+: std::false_type
+{};
 
 }
 
 template<class F>
 struct pipable_adaptor 
-: detail::basic_first_of_adaptor<detail::callable_base<F>, detail::pipe_pack<pipable_adaptor<F>, detail::callable_base<F>> >
+: detail::basic_first_of_adaptor<detail::callable_base<F>, detail::pipe_pack<pipable_adaptor<F>, detail::callable_base<F>> >,
+  detail::pipe_range_closure<pipable_adaptor<F>>
 {
     typedef detail::basic_first_of_adaptor<detail::callable_base<F>, detail::pipe_pack<pipable_adaptor<F>, detail::callable_base<F>> > base;
     typedef pipable_adaptor fit_rewritable_tag;
 
     BOOST_HOF_INHERIT_CONSTRUCTOR(pipable_adaptor, base);
 
-    constexpr const detail::callable_base<F>& base_function() const noexcept
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function() const noexcept
     {
         return *this;
     }
+
+    template<class A>
+    friend constexpr auto operator|(A&& a, const pipable_adaptor& p) BOOST_HOF_RETURNS
+    (p(BOOST_HOF_FORWARD(A)(a)));
 };
 
-template<class A, class F>
-constexpr auto operator|(A&& a, const pipable_adaptor<F>& p) BOOST_HOF_RETURNS
-(p(BOOST_HOF_FORWARD(A)(a)));
+// The number of arguments chooses between calling the function and building
+// the closure, so the function is never checked for each call
+template<std::size_t N, class F>
+struct pipable_c_adaptor : detail::callable_base<F>, detail::pipe_range_closure<pipable_c_adaptor<N, F>>
+{
+    typedef std::integral_constant<std::size_t, N> fit_function_param_limit;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(pipable_c_adaptor, detail::callable_base<F>);
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&...) const noexcept
+    {
+        return *this;
+    }
+
+    BOOST_HOF_RETURNS_CLASS(pipable_c_adaptor);
+
+    template<class... Ts, typename std::enable_if<(sizeof...(Ts) == N), int>::type = 0 BOOST_HOF_DETAIL_CALL_MARKER(pipable, Ts...)>
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    (BOOST_HOF_MANGLE_CAST(const detail::callable_base<F>&)(BOOST_HOF_CONST_THIS->base_function(xs...))(BOOST_HOF_FORWARD(Ts)(xs)...));
+
+    template<class... Ts, typename std::enable_if<(sizeof...(Ts) < N), int>::type = 0 BOOST_HOF_DETAIL_CALL_MARKER(pipable, Ts...)>
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    (detail::make_pipe_closure(BOOST_HOF_CONST_THIS->base_function(xs...), boost::hof::pack_forward(BOOST_HOF_FORWARD(Ts)(xs)...)));
+
+    template<class A>
+    friend constexpr auto operator|(A&& a, const pipable_c_adaptor& p) BOOST_HOF_RETURNS
+    (p(BOOST_HOF_FORWARD(A)(a)));
+};
+
+template<std::size_t N, class F>
+constexpr pipable_c_adaptor<N, F> pipable_c(F f)
+BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(pipable_c_adaptor<N, F>, F&&)
+{
+    return pipable_c_adaptor<N, F>(static_cast<F&&>(f));
+}
+
+BOOST_HOF_DETAIL_COMPILE_MARKER(pipable, pipable_adaptor)
 
 BOOST_HOF_DECLARE_STATIC_VAR(pipable, detail::make<pipable_adaptor>);
 
 namespace detail {
 
+template<class F>
+struct is_pipable<pipable_adaptor<F>>
+: std::true_type
+{};
+
+template<std::size_t N, class F>
+struct is_pipable<pipable_c_adaptor<N, F>>
+: std::true_type
+{};
+
 template<class F>
 struct static_function_wrapper;
 
-// Operators for static_function_wrapper adaptor
-template<class A, class F>
+// The wrappers are declared in other headers, so their operators can't be
+// friends, and are instead only enabled when the wrapped function is
+// pipable, before the call is checked
+template<class A, class F, class=typename std::enable_if<is_pipable<F>::value>::type>
 auto operator|(A&& a, const boost::hof::detail::static_function_wrapper<F>& f) BOOST_HOF_RETURNS
 (f(BOOST_HOF_FORWARD(A)(a)));
 
 template<class F>
 struct static_default_function;
 
-// Operators for static_default_function adaptor
-template<class A, class F>
+template<class A, class F, class=typename std::enable_if<is_pipable<F>::value>::type>
 auto operator|(A&& a, const boost::hof::detail::static_default_function<F>& f) BOOST_HOF_RETURNS
 (f(BOOST_HOF_FORWARD(A)(a)));
 
@@ -205,8 +316,7 @@ auto operator|(A&& a, const boost::hof::detail::static_default_function<F>& f) B
 template<class F>
 struct static_;
 
-// Operators for static_ adaptor
-template<class A, class F>
+template<class A, class F, class=typename std::enable_if<detail::is_pipable<F>::value>::type>
 auto operator|(A&& a, static_<F> f) BOOST_HOF_RETURNS
 (f.base_function().base_function()(BOOST_HOF_FORWARD(A)(a)));
 
@@ -0,0 +1,456 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    pipeline.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_PIPELINE_H
+#define BOOST_HOF_GUARD_PIPELINE_H
+
+/// pipeline
+/// ========
+///
+/// Description
+/// -----------
+///
+/// The `pipeline` function adaptor applies the same stages as
+/// [`flow`](flow) to each element of a range, and writes the results to an
+/// output iterator, except each stage runs on its own thread, so the stages
+/// work on different elements at the same time. The last stage runs on the
+/// calling thread, which also writes to the output, and the other stages run
+/// on a [`thread_executor`](executor).
+///
+/// The stages are connected by bounded queues, with one thread that pushes
+/// and one that pops, so they don't need a lock. When a queue is full, the
+/// stage that pushes to it waits for the next stage to catch up, so a fast
+/// stage can't run too far ahead of a slow one. The stage that pops takes
+/// all the elements that are ready at once, and only publishes the free
+/// slots after the batch. The capacity of the queues is rounded up to a power
+/// of two, and is 256 by default.
+///
+/// The stages wait by yielding the thread, so there should be a core for
+/// each stage. If a stage throws, the other stages stop, and the first
+/// exception is rethrown once all the stages have finished. The stages are
+/// called concurrently, so they must be safe to call from another thread,
+/// and the elements of the range are read by the thread of the first stage.
+///
+/// A stop token can be passed after the output iterator, which is any type
+/// with a const `stop_requested()` member function, such as `std::stop_token`
+/// or a [`deadline_token`](retry). Each stage checks the token before it
+/// calls its function for an element, so once a stop is requested, or the
+/// deadline is reached, no stage starts on another element. The stages then
+/// stop, the elements left in the queues are destroyed without being
+/// processed, and the output iterator is returned after the results that
+/// were written, without throwing.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Fs>
+///     pipeline_adaptor<Fs...> pipeline(Fs... fs);
+///
+///     template<class... Fs>
+///     template<class Range, class OutputIterator>
+///     OutputIterator pipeline_adaptor<Fs...>::operator()(Range&& r, OutputIterator out, std::size_t capacity=256) const;
+///
+///     template<class... Fs>
+///     template<class Range, class OutputIterator, class StopToken>
+///     OutputIterator pipeline_adaptor<Fs...>::operator()(Range&& r, OutputIterator out, const StopToken& t, std::size_t capacity=256) const;
+///
+/// Semantics
+/// ---------
+///
+///     pipeline(fs...)(r, out);
+///     // writes the same as
+///     std::transform(std::begin(r), std::end(r), out, flow(fs...));
+///
+/// Requirements
+/// ------------
+///
+/// Fs must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// The results of the stages, except the last one, must be
+/// MoveConstructible.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <iterator>
+///     #include <vector>
+///
+///     int main() {
+///         std::vector<int> v = { 1, 2, 3 };
+///         std::vector<int> r;
+///         boost::hof::pipeline(boost::hof::_ + 1, boost::hof::_ * 2)(v, std::back_inserter(r));
+///         assert(r.size() == 3 && r[2] == 8);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [flow](flow)
+/// * [executor](executor)
+///
+
+#include <boost/hof/executor.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/detail/type_at.hpp>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class F, class In>
+struct pipeline_result
+: std::decay<decltype(std::declval<const F&>()(std::declval<In>()))>
+{};
+
+// A bounded queue with a single producer and a single consumer. Each side
+// keeps a copy of the other side's index, so it only loads the shared index
+// when the copy says the queue is full or empty.
+template<class T>
+class pipeline_queue
+{
+    typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+    std::unique_ptr<storage[]> slots;
+    std::size_t mask;
+    const std::atomic<bool>& cancelled;
+    // Written by the consumer
+    alignas(64) std::atomic<std::size_t> head;
+    // Written by the producer
+    alignas(64) std::atomic<std::size_t> tail;
+    std::atomic<bool> closed;
+    std::size_t cached_head;
+
+    static std::size_t round_capacity(std::size_t n) noexcept
+    {
+        std::size_t c = 1;
+        while (c < n) c <<= 1;
+        return c;
+    }
+
+    T* slot(std::size_t i) const noexcept
+    {
+        return reinterpret_cast<T*>(&slots[i & mask]);
+    }
+
+    struct pop_guard
+    {
+        T* p;
+        ~pop_guard()
+        {
+            p->~T();
+        }
+    };
+public:
+    pipeline_queue(std::size_t capacity, const std::atomic<bool>& c)
+    : slots(new storage[round_capacity(capacity)]), mask(round_capacity(capacity) - 1), cancelled(c), cached_head(0)
+    {
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        closed.store(false, std::memory_order_relaxed);
+    }
+
+    pipeline_queue(const pipeline_queue&)=delete;
+    pipeline_queue& operator=(const pipeline_queue&)=delete;
+
+    ~pipeline_queue()
+    {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        for (std::size_t h = head.load(std::memory_order_relaxed); h != t; ++h) slot(h)->~T();
+    }
+
+    // Returns false when the pipeline is cancelled while the queue is full
+    template<class X>
+    bool push(X&& x)
+    {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        while (t - cached_head > mask)
+        {
+            cached_head = head.load(std::memory_order_acquire);
+            if (t - cached_head <= mask) break;
+            if (cancelled.load(std::memory_order_relaxed)) return false;
+            std::this_thread::yield();
+        }
+        ::new(static_cast<void*>(slot(t))) T(BOOST_HOF_FORWARD(X)(x));
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    void close() noexcept
+    {
+        closed.store(true, std::memory_order_release);
+    }
+
+    // Passes each element to the sink until the queue is closed and empty,
+    // and returns false when the sink or the pipeline is cancelled
+    template<class Sink>
+    bool consume(Sink& sink)
+    {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            std::size_t t = tail.load(std::memory_order_acquire);
+            if (h == t)
+            {
+                if (closed.load(std::memory_order_acquire))
+                {
+                    if (tail.load(std::memory_order_acquire) == h) return true;
+                    continue;
+                }
+                if (cancelled.load(std::memory_order_relaxed)) return false;
+                std::this_thread::yield();
+                continue;
+            }
+            try
+            {
+                for (; h != t; ++h)
+                {
+                    pop_guard g{slot(h)};
+                    if (!sink(std::move(*g.p)))
+                    {
+                        head.store(h + 1, std::memory_order_release);
+                        return false;
+                    }
+                }
+            }
+            catch(...)
+            {
+                head.store(h + 1, std::memory_order_release);
+                throw;
+            }
+            head.store(h, std::memory_order_release);
+        }
+    }
+};
+
+template<class Range>
+struct pipeline_range_source
+{
+    Range* r;
+
+    template<class Sink>
+    bool operator()(Sink& sink) const
+    {
+        for (auto&& x : *r)
+        {
+            if (!sink(x)) return false;
+        }
+        return true;
+    }
+};
+
+template<class T>
+struct pipeline_queue_source
+{
+    pipeline_queue<T>* q;
+
+    template<class Sink>
+    bool operator()(Sink& sink) const
+    {
+        return q->consume(sink);
+    }
+};
+
+struct pipeline_never_stop
+{
+    constexpr bool stop_requested() const noexcept
+    {
+        return false;
+    }
+};
+
+// Checked by each stage before it calls its function, so when the token is
+// stopped, the other stages see the flag without checking the token again
+template<class StopToken>
+struct pipeline_stop
+{
+    const StopToken* token;
+    std::atomic<bool>* cancelled;
+
+    bool operator()() const
+    {
+        if (cancelled->load(std::memory_order_relaxed)) return true;
+        if (!token->stop_requested()) return false;
+        cancelled->store(true, std::memory_order_relaxed);
+        return true;
+    }
+};
+
+template<class F, class T, class Stop>
+struct pipeline_push_sink
+{
+    const F* f;
+    pipeline_queue<T>* q;
+    Stop stop;
+
+    template<class X>
+    bool operator()(X&& x) const
+    {
+        if (stop()) return false;
+        return q->push((*f)(BOOST_HOF_FORWARD(X)(x)));
+    }
+};
+
+template<class F, class Out, class Stop>
+struct pipeline_output_sink
+{
+    const F* f;
+    Out* out;
+    Stop stop;
+
+    template<class X>
+    bool operator()(X&& x) const
+    {
+        if (stop()) return false;
+        **out = (*f)(BOOST_HOF_FORWARD(X)(x));
+        ++*out;
+        return true;
+    }
+};
+
+template<class T>
+struct pipeline_close_guard
+{
+    pipeline_queue<T>* q;
+    ~pipeline_close_guard()
+    {
+        q->close();
+    }
+};
+
+template<class F, class T, class Source, class Stop>
+struct pipeline_worker
+{
+    const F* f;
+    pipeline_queue<T>* q;
+    Source source;
+    Stop stop;
+
+    void operator()() const
+    {
+        pipeline_close_guard<T> guard{q};
+        try
+        {
+            pipeline_push_sink<F, T, Stop> sink{f, q, stop};
+            source(sink);
+        }
+        catch(...)
+        {
+            stop.cancelled->store(true, std::memory_order_relaxed);
+            throw;
+        }
+    }
+};
+
+template<class S, class... Fs>
+struct pipeline_adaptor_base;
+
+template<std::size_t... Ns, class... Fs>
+struct pipeline_adaptor_base<seq<Ns...>, Fs...>
+: pack_base<seq<Ns...>, Fs...>
+{
+    typedef pack_base<seq<Ns...>, Fs...> base_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(pipeline_adaptor_base, base_type)
+
+    template<std::size_t I>
+    const typename type_at<I, Fs...>::type& stage() const noexcept
+    {
+        return boost::hof::alias_value<pack_tag<seq<I>, Fs...>, typename type_at<I, Fs...>::type>(*this);
+    }
+
+    template<std::size_t I>
+    struct is_last
+    : std::integral_constant<bool, (I + 1 == sizeof...(Fs))>
+    {};
+
+    // The last stage runs on the calling thread
+    template<std::size_t I, class In, class Source, class Out, class Stop>
+    Out run(std::true_type, const Source& source, Out out, std::size_t, Stop stop) const
+    {
+        pipeline_output_sink<typename type_at<I, Fs...>::type, Out, Stop> sink{&this->template stage<I>(), &out, stop};
+        source(sink);
+        return out;
+    }
+
+    template<std::size_t I, class In, class Source, class Out, class Stop>
+    Out run(std::false_type, const Source& source, Out out, std::size_t capacity, Stop stop) const
+    {
+        typedef typename type_at<I, Fs...>::type stage_type;
+        typedef typename pipeline_result<stage_type, In>::type result_type;
+        pipeline_queue<result_type> q(capacity, *stop.cancelled);
+        auto h = thread_executor().submit(pipeline_worker<stage_type, result_type, Source, Stop>{
+            &this->template stage<I>(), &q, source, stop
+        });
+        try
+        {
+            out = this->template run<I + 1, result_type&&>(is_last<I + 1>(), pipeline_queue_source<result_type>{&q}, out, capacity, stop);
+        }
+        catch(...)
+        {
+            // The stage refers to the queue, so it must finish first
+            stop.cancelled->store(true, std::memory_order_relaxed);
+            h.wait();
+            throw;
+        }
+        h.get();
+        return out;
+    }
+};
+
+}
+
+template<class... Fs>
+struct pipeline_adaptor
+: detail::pipeline_adaptor_base<typename detail::gens<sizeof...(Fs)>::type, detail::callable_base<Fs>...>
+{
+    static_assert(sizeof...(Fs) > 0, "The pipeline needs a stage");
+
+    typedef detail::pipeline_adaptor_base<typename detail::gens<sizeof...(Fs)>::type, detail::callable_base<Fs>...> base_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(pipeline_adaptor, base_type)
+
+    template<class Range, class Out, class StopToken, class Iterator=decltype(std::begin(std::declval<Range&>())),
+        class=decltype(std::declval<const StopToken&>().stop_requested())>
+    Out operator()(Range&& r, Out out, const StopToken& t, std::size_t capacity=256) const
+    {
+        typedef typename std::remove_reference<Range>::type range_type;
+        std::atomic<bool> cancelled(false);
+        return this->template run<0, decltype(*std::declval<Iterator>())>(
+            typename base_type::template is_last<0>(), detail::pipeline_range_source<range_type>{&r}, out, capacity,
+            detail::pipeline_stop<StopToken>{&t, &cancelled}
+        );
+    }
+
+    template<class Range, class Out, class Iterator=decltype(std::begin(std::declval<Range&>()))>
+    Out operator()(Range&& r, Out out, std::size_t capacity=256) const
+    {
+        return (*this)(BOOST_HOF_FORWARD(Range)(r), out, detail::pipeline_never_stop(), capacity);
+    }
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(pipeline, detail::make<pipeline_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
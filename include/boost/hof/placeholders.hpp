@@ -40,6 +40,18 @@
 /// * Assign operators: +=,-=,*=,/=,%=,>>=,<<=,&=,|=,^=
 /// * Unary operators: !,~,+,-,*,++,--
 /// 
+/// The `&&` and `||` operators short-circuit like the builtin operators, so
+/// the right side of `_1 && lazy(f)(_2)` is only evaluated when `_1` is true.
+/// 
+/// if_else
+/// -------
+/// 
+/// The `if_else` function creates a bind expression for the conditional
+/// operator. Only the selected side is evaluated, so when both sides are cheap
+/// it can be compiled to a conditional move instead of a branch.
+/// 
+///     assert(if_else(_1, _2, _3)(c, x, y) == (c ? x : y));
+/// 
 /// 
 /// Example
 /// -------
@@ -88,6 +100,8 @@
 #include <boost/hof/returns.hpp>
 #include <boost/hof/lazy.hpp>
 #include <boost/hof/protect.hpp>
+#include <boost/hof/is_associative.hpp>
+#include <boost/hof/is_commutative.hpp>
 
 #if defined(_MSC_VER) && _MSC_VER >= 1910
 #include <boost/hof/detail/pp.hpp>
@@ -164,7 +178,7 @@ namespace operators {
 struct call
 {
     template<class F, class... Ts>
-    constexpr auto operator()(F&& f, Ts&&... xs) const BOOST_HOF_RETURNS
+    BOOST_HOF_INLINE constexpr auto operator()(F&& f, Ts&&... xs) const BOOST_HOF_RETURNS
     (f(BOOST_HOF_FORWARD(Ts)(xs)...));
 };
 
@@ -176,7 +190,7 @@ struct call
 struct and_
 {
     template<class T, class U>
-    constexpr auto operator()(T&& x, U&& y) const 
+    BOOST_HOF_INLINE constexpr auto operator()(T&& x, U&& y) const 
     noexcept(noexcept(BOOST_HOF_FORWARD(T)(x) && BOOST_HOF_FORWARD(U)(y)))
     -> decltype(BOOST_HOF_FORWARD(T)(x) && BOOST_HOF_FORWARD(U)(y)) 
     { return BOOST_HOF_FORWARD(T)(x) & BOOST_HOF_FORWARD(U)(y); }
@@ -185,7 +199,7 @@ struct and_
 struct or_
 {
     template<class T, class U>
-    constexpr auto operator()(T&& x, U&& y) const 
+    BOOST_HOF_INLINE constexpr auto operator()(T&& x, U&& y) const 
     noexcept(noexcept(BOOST_HOF_FORWARD(T)(x) || BOOST_HOF_FORWARD(U)(y)))
     -> decltype(BOOST_HOF_FORWARD(T)(x) || BOOST_HOF_FORWARD(U)(y)) 
     { return BOOST_HOF_FORWARD(T)(x) | BOOST_HOF_FORWARD(U)(y); }
@@ -198,7 +212,7 @@ struct or_
         BOOST_HOF_USING(ex_failure, decltype(std::declval<T>() op std::declval<U>())); \
         struct failure : as_failure<ex_failure> {}; \
         template<class T, class U> \
-        constexpr auto operator()(T&& x, U&& y) const BOOST_HOF_RETURNS \
+        BOOST_HOF_INLINE constexpr auto operator()(T&& x, U&& y) const BOOST_HOF_RETURNS \
         (BOOST_HOF_FORWARD(T)(x) op BOOST_HOF_FORWARD(U)(y)); \
     };
 
@@ -212,7 +226,7 @@ struct or_
     struct name \
     { \
         template<class T, class U> \
-        constexpr auto operator()(T&& x, U&& y) const BOOST_HOF_RETURNS \
+        BOOST_HOF_INLINE constexpr auto operator()(T&& x, U&& y) const BOOST_HOF_RETURNS \
         (BOOST_HOF_FORWARD(T)(x) op BOOST_HOF_FORWARD(U)(y)); \
     };
 
@@ -221,11 +235,84 @@ struct or_
 BOOST_HOF_FOREACH_BINARY_OP(BOOST_HOF_BINARY_OP)
 BOOST_HOF_FOREACH_ASSIGN_OP(BOOST_HOF_BINARY_OP)
 
+}
+
+template<>
+struct is_associative<operators::add>
+: std::true_type
+{};
+
+template<>
+struct is_associative<operators::multiply>
+: std::true_type
+{};
+
+template<>
+struct is_associative<operators::bit_and>
+: std::true_type
+{};
+
+template<>
+struct is_associative<operators::bit_or>
+: std::true_type
+{};
+
+template<>
+struct is_associative<operators::xor_>
+: std::true_type
+{};
+
+namespace detail {
+
+template<>
+struct is_overflow_free<operators::bit_and>
+: std::true_type
+{};
+
+template<>
+struct is_overflow_free<operators::bit_or>
+: std::true_type
+{};
+
+template<>
+struct is_overflow_free<operators::xor_>
+: std::true_type
+{};
+
+}
+
+template<>
+struct is_commutative<operators::add>
+: std::true_type
+{};
+
+template<>
+struct is_commutative<operators::multiply>
+: std::true_type
+{};
+
+template<>
+struct is_commutative<operators::bit_and>
+: std::true_type
+{};
+
+template<>
+struct is_commutative<operators::bit_or>
+: std::true_type
+{};
+
+template<>
+struct is_commutative<operators::xor_>
+: std::true_type
+{};
+
+namespace operators {
+
 #define BOOST_HOF_UNARY_OP(op, name) \
     struct name \
     { \
         template<class T> \
-        constexpr auto operator()(T&& x) const BOOST_HOF_RETURNS \
+        BOOST_HOF_INLINE constexpr auto operator()(T&& x) const BOOST_HOF_RETURNS \
         (op(BOOST_HOF_FORWARD(T)(x))); \
     };
 
@@ -233,6 +320,72 @@ BOOST_HOF_FOREACH_ASSIGN_OP(BOOST_HOF_BINARY_OP)
 BOOST_HOF_FOREACH_UNARY_OP(BOOST_HOF_UNARY_OP)
 
 
+}
+
+namespace detail {
+
+// The operator used by the bind expression of a placeholder operator
+template<class Op>
+struct placeholder_op
+{
+    typedef Op type;
+};
+
+// MSVC 2017 ICEs on && and || in constexpr, so it keeps the bitwise fallback,
+// which evaluates both sides
+#if !(defined(_MSC_VER) && _MSC_VER >= 1910)
+struct lazy_and
+{
+    typedef lazy_and lazy_deferred_tag;
+
+    template<class T, class U>
+    BOOST_HOF_INLINE constexpr auto operator()(const T& x, const U& y) const BOOST_HOF_RETURNS
+    (x() && y());
+};
+
+struct lazy_or
+{
+    typedef lazy_or lazy_deferred_tag;
+
+    template<class T, class U>
+    BOOST_HOF_INLINE constexpr auto operator()(const T& x, const U& y) const BOOST_HOF_RETURNS
+    (x() || y());
+};
+
+template<>
+struct placeholder_op<operators::and_>
+{
+    typedef lazy_and type;
+};
+
+template<>
+struct placeholder_op<operators::or_>
+{
+    typedef lazy_or type;
+};
+#endif
+
+struct lazy_if_else
+{
+    typedef lazy_if_else lazy_deferred_tag;
+
+    // The result is returned by value, since the selected side can refer to a
+    // temporary of the call
+    template<class C, class T, class U,
+        class R=typename std::decay<decltype(std::declval<const C&>()() ? std::declval<const T&>()() : std::declval<const U&>()())>::type>
+    BOOST_HOF_INLINE constexpr auto operator()(const C& c, const T& x, const U& y) const BOOST_HOF_RETURNS
+    (R(c() ? x() : y()));
+};
+
+struct if_else_f
+{
+    template<class C, class T, class U>
+    BOOST_HOF_INLINE constexpr auto operator()(C&& c, T&& x, U&& y) const BOOST_HOF_RETURNS
+    (
+        boost::hof::lazy(lazy_if_else())(BOOST_HOF_FORWARD(C)(c), BOOST_HOF_FORWARD(T)(x), BOOST_HOF_FORWARD(U)(y))
+    );
+};
+
 }
 
 template<int N>
@@ -240,14 +393,14 @@ struct placeholder
 {
 #if BOOST_HOF_HAS_MANGLE_OVERLOAD
     template<class... Ts>
-    constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS 
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS 
     ( boost::hof::lazy(operators::call())(detail::simple_placeholder<N>(), BOOST_HOF_FORWARD(Ts)(xs)...) );
 #else
     template<class... Ts>
     struct result_call
     { typedef decltype(boost::hof::lazy(operators::call())(detail::simple_placeholder<N>(), std::declval<Ts>()...)) type; };
     template<class... Ts>
-    constexpr typename result_call<Ts...>::type operator()(Ts&&... xs) const 
+    BOOST_HOF_INLINE constexpr typename result_call<Ts...>::type operator()(Ts&&... xs) const 
     { return boost::hof::lazy(operators::call())(detail::simple_placeholder<N>(), BOOST_HOF_FORWARD(Ts)(xs)...); };
 
 #endif
@@ -272,29 +425,29 @@ BOOST_HOF_FOREACH_ASSIGN_OP(BOOST_HOF_PLACEHOLDER_ASSIGN_OP)
 #define BOOST_HOF_PLACEHOLDER_BINARY_OP(op, name) \
     template<class T, int N> \
     constexpr inline auto operator op (const placeholder<N>&, T&& x) BOOST_HOF_RETURNS \
-    ( boost::hof::lazy(operators::name())(detail::simple_placeholder<N>(), BOOST_HOF_FORWARD(T)(x)) ); \
+    ( boost::hof::lazy(detail::placeholder_op<operators::name>::type())(detail::simple_placeholder<N>(), BOOST_HOF_FORWARD(T)(x)) ); \
     template<class T, int N> \
     constexpr inline auto operator op (T&& x, const placeholder<N>&) BOOST_HOF_RETURNS \
-    ( boost::hof::lazy(operators::name())(BOOST_HOF_FORWARD(T)(x), detail::simple_placeholder<N>()) ); \
+    ( boost::hof::lazy(detail::placeholder_op<operators::name>::type())(BOOST_HOF_FORWARD(T)(x), detail::simple_placeholder<N>()) ); \
     template<int N, int M> \
     constexpr inline auto operator op (const placeholder<N>&, const placeholder<M>&) BOOST_HOF_RETURNS \
-    ( boost::hof::lazy(operators::name())(detail::simple_placeholder<N>(), detail::simple_placeholder<M>()) );
+    ( boost::hof::lazy(detail::placeholder_op<operators::name>::type())(detail::simple_placeholder<N>(), detail::simple_placeholder<M>()) );
 
 #else
 
 #define BOOST_HOF_PLACEHOLDER_BINARY_OP(op, name) \
     template<class T, class U> \
     struct result_ ## name \
-    { typedef decltype(boost::hof::lazy(operators::name())(std::declval<T>(), std::declval<U>())) type; }; \
+    { typedef decltype(boost::hof::lazy(detail::placeholder_op<operators::name>::type())(std::declval<T>(), std::declval<U>())) type; }; \
     template<class T, int N> \
     constexpr inline typename result_ ## name<detail::simple_placeholder<N>, T>::type operator op (const placeholder<N>&, T&& x) \
-    { return boost::hof::lazy(operators::name())(detail::simple_placeholder<N>(), BOOST_HOF_FORWARD(T)(x)); } \
+    { return boost::hof::lazy(detail::placeholder_op<operators::name>::type())(detail::simple_placeholder<N>(), BOOST_HOF_FORWARD(T)(x)); } \
     template<class T, int N> \
     constexpr inline typename result_ ## name<T, detail::simple_placeholder<N>>::type operator op (T&& x, const placeholder<N>&) \
-    { return boost::hof::lazy(operators::name())(BOOST_HOF_FORWARD(T)(x), detail::simple_placeholder<N>()); } \
+    { return boost::hof::lazy(detail::placeholder_op<operators::name>::type())(BOOST_HOF_FORWARD(T)(x), detail::simple_placeholder<N>()); } \
     template<int N, int M> \
     constexpr inline typename result_ ## name<detail::simple_placeholder<N>, detail::simple_placeholder<M>>::type operator op (const placeholder<N>&, const placeholder<M>&) \
-    { return boost::hof::lazy(operators::name())(detail::simple_placeholder<N>(), detail::simple_placeholder<M>()); }
+    { return boost::hof::lazy(detail::placeholder_op<operators::name>::type())(detail::simple_placeholder<N>(), detail::simple_placeholder<M>()); }
 
 #endif
 
@@ -310,6 +463,7 @@ BOOST_HOF_DECLARE_STATIC_VAR(_6, placeholder<6>);
 BOOST_HOF_DECLARE_STATIC_VAR(_7, placeholder<7>);
 BOOST_HOF_DECLARE_STATIC_VAR(_8, placeholder<8>);
 BOOST_HOF_DECLARE_STATIC_VAR(_9, placeholder<9>);
+BOOST_HOF_DECLARE_STATIC_VAR(if_else, detail::if_else_f);
 }
 
 using placeholders::_1;
@@ -321,6 +475,7 @@ using placeholders::_6;
 using placeholders::_7;
 using placeholders::_8;
 using placeholders::_9;
+using placeholders::if_else;
 
 namespace detail {
 
@@ -361,7 +516,7 @@ struct partial_ap
     {};
 
     template<class X>
-    constexpr BOOST_HOF_SFINAE_RESULT(const Invoker&, id_<T>, id_<X>) 
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(const Invoker&, id_<T>, id_<X>) 
     operator()(X&& x) const BOOST_HOF_SFINAE_RETURNS
     (
         Invoker()(BOOST_HOF_CONST_THIS->val, BOOST_HOF_FORWARD(X)(x))
@@ -381,7 +536,7 @@ struct left
     : failure_for<Op>
     {};
     template<class T, class X>
-    constexpr BOOST_HOF_SFINAE_RESULT(const Op&, id_<T>, id_<X>) 
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(const Op&, id_<T>, id_<X>) 
     operator()(T&& val, X&& x) const BOOST_HOF_SFINAE_RETURNS
     (Op()(BOOST_HOF_FORWARD(T)(val), BOOST_HOF_FORWARD(X)(x)));
 };
@@ -406,7 +561,7 @@ struct right
     {};
 
     template<class T, class X>
-    constexpr BOOST_HOF_SFINAE_RESULT(const Op&, id_<X>, id_<T>) 
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(const Op&, id_<X>, id_<T>) 
     operator()(T&& val, X&& x) const BOOST_HOF_SFINAE_RETURNS
     (Op()(BOOST_HOF_FORWARD(X)(x), BOOST_HOF_FORWARD(T)(val)));
 };
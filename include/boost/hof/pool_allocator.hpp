@@ -0,0 +1,224 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    pool_allocator.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_POOL_ALLOCATOR_H
+#define BOOST_HOF_GUARD_POOL_ALLOCATOR_H
+
+/// pool_allocator
+/// ==============
+///
+/// Description
+/// -----------
+///
+/// The `pool_allocator` is an allocator that recycles the memory it frees,
+/// for the state that an adaptor allocates for each call, such as the shared
+/// state and the continuations of [`async`](async). The sizes are rounded up
+/// to a size class, from 16 bytes up to 256 bytes, and each thread keeps a
+/// free list for each size class, so the memory freed by a thread is reused
+/// by the next allocation of the same size class on that thread, without
+/// taking a lock or an atomic operation. The free lists are only used from
+/// their own thread, so a block that is freed on another thread than the one
+/// that allocated it goes to the free list of the thread that frees it.
+///
+/// Each free list keeps at most 64 blocks, and the blocks after that, and
+/// the bigger sizes, are freed with `operator delete` instead. The types that
+/// are over-aligned are allocated with `std::allocator`. The free lists are
+/// freed when their thread exits.
+///
+/// The adaptors allocate their state with `BOOST_HOF_STATE_ALLOCATOR`, which
+/// is `boost::hof::pool_allocator` by default, so it can be defined to an
+/// allocator template, such as `std::allocator`, before including the
+/// library. The allocator must be default constructible and all of its
+/// instances must compare equal.
+///
+/// Synopsis
+/// --------
+///
+///     template<class T>
+///     struct pool_allocator;
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <memory>
+///
+///     int main() {
+///         boost::hof::pool_allocator<int> a;
+///         int* p = a.allocate(1);
+///         a.deallocate(p, 1);
+///         // The block is reused
+///         assert(a.allocate(1) == p);
+///         auto s = std::allocate_shared<int>(a, 3);
+///         assert(*s == 3);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [async](async)
+///
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+struct pool_block
+{
+    pool_block* next;
+};
+
+// The free lists of a thread
+struct pool_cache
+{
+    static constexpr std::size_t classes = 5;
+    static constexpr std::size_t max_blocks = 64;
+
+    pool_block* heads[classes];
+    std::size_t counts[classes];
+
+    pool_cache() noexcept
+    {
+        for (std::size_t i = 0; i < classes; i++)
+        {
+            heads[i] = nullptr;
+            counts[i] = 0;
+        }
+    }
+
+    pool_cache(const pool_cache&)=delete;
+    pool_cache& operator=(const pool_cache&)=delete;
+
+    ~pool_cache();
+
+    static constexpr std::size_t size_class(std::size_t n) noexcept
+    {
+        return n <= 16 ? 0 : n <= 32 ? 1 : n <= 64 ? 2 : n <= 128 ? 3 : n <= 256 ? 4 : classes;
+    }
+
+    static constexpr std::size_t class_size(std::size_t c) noexcept
+    {
+        return std::size_t(16) << c;
+    }
+};
+
+// The flag is trivially destructible, so it can still be read by the
+// destructors of the other thread locals after the cache is destroyed
+inline bool& pool_cache_destroyed() noexcept
+{
+    static thread_local bool destroyed = false;
+    return destroyed;
+}
+
+inline pool_cache::~pool_cache()
+{
+    pool_cache_destroyed() = true;
+    for (std::size_t i = 0; i < classes; i++)
+    {
+        while (pool_block* b = heads[i])
+        {
+            heads[i] = b->next;
+            ::operator delete(b);
+        }
+    }
+}
+
+inline pool_cache* this_thread_pool() noexcept
+{
+    if (pool_cache_destroyed()) return nullptr;
+    static thread_local pool_cache c;
+    return &c;
+}
+
+inline void* pool_allocate(std::size_t n)
+{
+    std::size_t c = pool_cache::size_class(n);
+    if (c == pool_cache::classes) return ::operator new(n);
+    pool_cache* p = detail::this_thread_pool();
+    if (p != nullptr && p->heads[c] != nullptr)
+    {
+        pool_block* b = p->heads[c];
+        p->heads[c] = b->next;
+        --p->counts[c];
+        return b;
+    }
+    return ::operator new(pool_cache::class_size(c));
+}
+
+inline void pool_deallocate(void* x, std::size_t n) noexcept
+{
+    std::size_t c = pool_cache::size_class(n);
+    pool_cache* p = c == pool_cache::classes ? nullptr : detail::this_thread_pool();
+    if (p == nullptr || p->counts[c] == pool_cache::max_blocks)
+    {
+        ::operator delete(x);
+        return;
+    }
+    pool_block* b = static_cast<pool_block*>(x);
+    b->next = p->heads[c];
+    p->heads[c] = b;
+    ++p->counts[c];
+}
+
+}
+
+template<class T>
+struct pool_allocator
+{
+    typedef T value_type;
+
+    template<class U>
+    struct rebind
+    {
+        typedef pool_allocator<U> other;
+    };
+
+    pool_allocator() noexcept
+    {}
+
+    template<class U>
+    pool_allocator(const pool_allocator<U>&) noexcept
+    {}
+
+    T* allocate(std::size_t n)
+    {
+        // The blocks of the pool are only aligned like a new expression
+        if (alignof(T) > alignof(std::max_align_t)) return std::allocator<T>().allocate(n);
+        return static_cast<T*>(detail::pool_allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        if (alignof(T) > alignof(std::max_align_t)) std::allocator<T>().deallocate(p, n);
+        else detail::pool_deallocate(p, n * sizeof(T));
+    }
+
+    template<class U>
+    bool operator==(const pool_allocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+    template<class U>
+    bool operator!=(const pool_allocator<U>&) const noexcept
+    {
+        return false;
+    }
+};
+
+}} // namespace boost::hof
+
+#ifndef BOOST_HOF_STATE_ALLOCATOR
+#define BOOST_HOF_STATE_ALLOCATOR boost::hof::pool_allocator
+#endif
+
+#endif
@@ -0,0 +1,168 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    power.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_POWER_H
+#define BOOST_HOF_GUARD_POWER_H
+
+/// power
+/// =====
+///
+/// Description
+/// -----------
+///
+/// The `power` function returns a function that applies `f` the given number
+/// of times, like [`repeat`](repeat). When `compose_rule` is specialized for
+/// the type of the function, such as a matrix, an affine map or a modular
+/// multiplication, the function is instead composed with itself by
+/// squaring, so `f` to the power of `n` is built with O(log n) compositions,
+/// and the result is a function of the same type that is applied once.
+/// Otherwise, it is the same as `repeat(n)(f)`.
+///
+/// To specialize `compose_rule`, one needs to provide a static `apply`
+/// function that returns the composition of two functions of the type, and
+/// a static `identity` function that returns the function that is applied
+/// zero times, which is passed the function so it can take its size. Since
+/// each function that is composed is a power of the same function, the
+/// order of the composition doesn't matter.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F, class=void>
+///     struct compose_rule;
+///
+///     template<class F, class Integral>
+///     constexpr auto power(F f, Integral n);
+///
+/// Semantics
+/// ---------
+///
+///     assert(power(f, n)(x) == repeat(n)(f)(x));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Integral must be:
+///
+/// * Integral
+///
+/// Or:
+///
+/// * IntegralConstant
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <cstdint>
+///
+///     // Computes a * x + c modulo 2^32
+///     struct lcg
+///     {
+///         std::uint32_t a;
+///         std::uint32_t c;
+///         std::uint32_t operator()(std::uint32_t x) const
+///         {
+///             return a * x + c;
+///         }
+///     };
+///
+///     namespace boost { namespace hof {
+///         template<>
+///         struct compose_rule<lcg>
+///         {
+///             static lcg apply(const lcg& f, const lcg& g)
+///             {
+///                 return lcg{f.a * g.a, f.a * g.c + f.c};
+///             }
+///
+///             static lcg identity(const lcg&)
+///             {
+///                 return lcg{1, 0};
+///             }
+///         };
+///     }} // namespace boost::hof
+///
+///     int main() {
+///         lcg next{1664525, 1013904223};
+///         auto skip = boost::hof::power(next, 1000000);
+///         assert(skip(7) == boost::hof::repeat(1000000)(next)(7));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [repeat](repeat)
+/// * [Exponentiation by squaring](https://en.wikipedia.org/wiki/Exponentiation_by_squaring)
+///
+
+#include <boost/hof/repeat.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/holder.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+template<class F, class=void>
+struct compose_rule
+{};
+
+namespace detail {
+
+template<class F, class=void>
+struct has_compose_rule
+: std::false_type
+{};
+
+template<class F>
+struct has_compose_rule<F, typename holder<
+    decltype(compose_rule<F>::apply(std::declval<const F&>(), std::declval<const F&>())),
+    decltype(compose_rule<F>::identity(std::declval<const F&>()))
+>::type>
+: std::true_type
+{};
+
+// Each level squares the function and halves the count, so the recursion
+// is only as deep as the number of bits of the count
+template<class F, class N>
+constexpr F power_square(const F& f, N n)
+{
+    return n <= 0 ? F(compose_rule<F>::identity(f)) :
+        n % 2 == 0 ? detail::power_square(F(compose_rule<F>::apply(f, f)), n / 2) :
+        F(compose_rule<F>::apply(f, detail::power_square(F(compose_rule<F>::apply(f, f)), n / 2)));
+}
+
+struct power_f
+{
+    template<class F, class Integral, typename std::enable_if<(has_compose_rule<F>::value), int>::type = 0>
+    constexpr F operator()(F f, Integral n) const
+    {
+        return detail::power_square(f, +n);
+    }
+
+    template<class F, class Integral, typename std::enable_if<(!has_compose_rule<F>::value), int>::type = 0>
+    constexpr auto operator()(F f, Integral n) const BOOST_HOF_RETURNS
+    (
+        boost::hof::repeat(n)(static_cast<F&&>(f))
+    );
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(power, detail::power_f);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,443 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    profiled.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_PROFILED_H
+#define BOOST_HOF_GUARD_PROFILED_H
+
+/// profiled
+/// ========
+///
+/// Description
+/// -----------
+///
+/// The `profiled` function decorator counts the calls of a function and
+/// records how long each call took in a latency histogram, under the given
+/// name. The statistics for a name are read with `profile_read`, which
+/// merges the histograms of all the threads that called the function.
+///
+/// Each thread records into its own histograms, so a call never waits on
+/// another thread, and never writes to memory shared with another thread.
+/// The histogram has 8 linear buckets for each power of two of nanoseconds,
+/// so a latency read from it is within 12.5% of the measured latency.
+///
+/// The name must be a string with static storage duration, such as a string
+/// literal, since it is used to find the histograms of the function. Names
+/// with the same contents are merged by `profile_read`. The name can also be
+/// given by a nullary function object that returns the string, which is
+/// needed to keep the name of a
+/// [`BOOST_HOF_STATIC_FUNCTION`](function) without inline variables, since
+/// the static function is then default constructed.
+///
+/// Every name that was recorded by any thread is enumerated with
+/// `profile_for_each`, which calls a function with each name, in order, and
+/// its merged statistics. The `profile_prometheus` function writes a
+/// snapshot of them in the Prometheus text format, as a histogram of the
+/// latencies in nanoseconds with a `function` label for each name. Only the
+/// buckets that counted a call are written. Both only read the histograms,
+/// so the only cost on the call path is still the update of the histogram
+/// of the thread.
+///
+/// When `BOOST_HOF_PROFILING` is 0, which is the default, the decorated
+/// function calls the function directly, `profile_read` always returns
+/// empty statistics, and there are no names to enumerate. Since the
+/// decorated function can be `constexpr`, it can be used to define a
+/// [`BOOST_HOF_STATIC_FUNCTION`](function), so a static function object can
+/// be instrumented without changing where it is called.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Name>
+///     constexpr auto profiled(Name name);
+///
+///     profile_stats profile_read(const char* name);
+///
+///     template<class F>
+///     void profile_for_each(F f);
+///
+///     std::string profile_prometheus(const std::string& metric="boost_hof_call_latency_nanoseconds");
+///
+///     struct profile_stats
+///     {
+///         std::uint64_t count;
+///         std::uint64_t total;
+///         std::uint64_t buckets[profile_stats::bucket_count];
+///
+///         double mean() const;
+///         std::uint64_t percentile(double p) const;
+///     };
+///
+/// Semantics
+/// ---------
+///
+///     assert(profiled(name)(f)(xs...) == f(xs...));
+///
+/// Requirements
+/// ------------
+///
+/// Name must be:
+///
+/// * `const char*`, or a nullary [ConstInvocable](ConstInvocable) function
+///   object that returns a `const char*`
+/// * DefaultConstructible, when used to define a static function without
+///   inline variables
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #define BOOST_HOF_PROFILING 1
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct sum_f
+///     {
+///         template<class T, class U>
+///         T operator()(T x, U y) const
+///         {
+///             return x+y;
+///         }
+///     };
+///
+///     struct sum_name
+///     {
+///         constexpr const char* operator()() const
+///         {
+///             return "sum";
+///         }
+///     };
+///
+///     BOOST_HOF_STATIC_FUNCTION(sum) = boost::hof::profiled(sum_name())(sum_f());
+///
+///     int main() {
+///         assert(3 == sum(1, 2));
+///         assert(boost::hof::profile_read("sum").count == 1);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [decorate](decorate)
+/// * [tap](tap)
+/// * [HdrHistogram](http://hdrhistogram.org/)
+///
+
+#include <boost/hof/decorate.hpp>
+#include <boost/hof/returns.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#if BOOST_HOF_PROFILING
+#include <boost/hof/detail/thread_block.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <vector>
+#endif
+
+namespace boost { namespace hof {
+
+struct profile_stats
+{
+    // 8 linear buckets for every power of two
+    static constexpr std::size_t sub_bucket_bits = 3;
+    static constexpr std::size_t sub_bucket_count = std::size_t(1) << sub_bucket_bits;
+    static constexpr std::size_t bucket_count = (64 - sub_bucket_bits + 1) * sub_bucket_count;
+
+    std::uint64_t count;
+    // The total latency in nanoseconds
+    std::uint64_t total;
+    std::uint64_t buckets[bucket_count];
+
+    static std::size_t bucket_index(std::uint64_t ns) noexcept
+    {
+        if (ns < sub_bucket_count) return std::size_t(ns);
+        std::size_t msb = 0;
+        while ((ns >> msb) > 1) msb++;
+        std::size_t sub = std::size_t(ns >> (msb - sub_bucket_bits)) & (sub_bucket_count - 1);
+        return (msb - sub_bucket_bits + 1) * sub_bucket_count + sub;
+    }
+
+    // The lowest latency that is counted in the bucket
+    static std::uint64_t bucket_value(std::size_t i) noexcept
+    {
+        if (i < sub_bucket_count) return i;
+        std::size_t msb = i / sub_bucket_count + sub_bucket_bits - 1;
+        return std::uint64_t(sub_bucket_count + i % sub_bucket_count) << (msb - sub_bucket_bits);
+    }
+
+    double mean() const noexcept
+    {
+        return count == 0 ? 0.0 : double(total) / double(count);
+    }
+
+    // The latency in nanoseconds that `p` percent of the calls were faster
+    // than, rounded down to the bucket
+    std::uint64_t percentile(double p) const noexcept
+    {
+        if (count == 0) return 0;
+        std::uint64_t n = std::uint64_t(p / 100.0 * double(count));
+        if (n >= count) n = count - 1;
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < bucket_count; i++)
+        {
+            seen += buckets[i];
+            if (seen > n) return bucket_value(i);
+        }
+        return bucket_value(bucket_count - 1);
+    }
+};
+
+namespace detail {
+
+constexpr const char* profile_name(const char* name) noexcept
+{
+    return name;
+}
+
+template<class Name>
+constexpr auto profile_name(const Name& name) BOOST_HOF_RETURNS
+(
+    static_cast<const char*>(name())
+);
+
+#if BOOST_HOF_PROFILING
+
+// The histogram is only written by the thread that owns it, so the counters
+// are updated with a relaxed load and store instead of a locked increment
+struct profile_histogram
+{
+    std::atomic<std::uint64_t> count;
+    std::atomic<std::uint64_t> total;
+    std::atomic<std::uint64_t> buckets[profile_stats::bucket_count];
+
+    profile_histogram()
+    {
+        count.store(0, std::memory_order_relaxed);
+        total.store(0, std::memory_order_relaxed);
+        for (auto& b : buckets) b.store(0, std::memory_order_relaxed);
+    }
+
+    static void bump(std::atomic<std::uint64_t>& x, std::uint64_t n) noexcept
+    {
+        x.store(x.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    void record(std::uint64_t ns) noexcept
+    {
+        bump(buckets[profile_stats::bucket_index(ns)], 1);
+        bump(total, ns);
+        bump(count, 1);
+    }
+
+    void merge_into(profile_stats& s) const noexcept
+    {
+        s.count += count.load(std::memory_order_relaxed);
+        s.total += total.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < profile_stats::bucket_count; i++)
+            s.buckets[i] += buckets[i].load(std::memory_order_relaxed);
+    }
+};
+
+// The histograms of one thread, found by hashing the address of the name
+struct profile_block
+{
+    std::atomic<const char*> names[BOOST_HOF_PROFILING_SITES];
+    std::atomic<profile_histogram*> histograms[BOOST_HOF_PROFILING_SITES];
+    std::atomic<bool> in_use;
+    profile_block * next;
+
+    profile_block() : next(nullptr)
+    {
+        in_use.store(true, std::memory_order_relaxed);
+        for (std::size_t i = 0; i < BOOST_HOF_PROFILING_SITES; i++)
+        {
+            names[i].store(nullptr, std::memory_order_relaxed);
+            histograms[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    profile_histogram* get(const char* name)
+    {
+        if (name == nullptr) return nullptr;
+        std::size_t h = std::size_t(reinterpret_cast<std::uintptr_t>(name) >> 3);
+        for (std::size_t k = 0; k < BOOST_HOF_PROFILING_SITES; k++)
+        {
+            std::size_t i = (h + k) % BOOST_HOF_PROFILING_SITES;
+            const char* n = names[i].load(std::memory_order_relaxed);
+            if (n == name) return histograms[i].load(std::memory_order_relaxed);
+            if (n == nullptr)
+            {
+                // The histogram is published before the name, so a reader
+                // that sees the name also sees the histogram
+                profile_histogram* p = new profile_histogram();
+                histograms[i].store(p, std::memory_order_release);
+                names[i].store(name, std::memory_order_release);
+                return p;
+            }
+        }
+        // There are more names than sites, so the call is not recorded
+        return nullptr;
+    }
+};
+
+struct profile_timer
+{
+    profile_histogram * histogram;
+    std::chrono::steady_clock::time_point start;
+
+    explicit profile_timer(const char* name)
+    : histogram(thread_block<profile_block>::this_thread().get(name)), start(std::chrono::steady_clock::now())
+    {}
+
+    // The latency is recorded when the call returns or throws
+    ~profile_timer()
+    {
+        auto d = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        if (histogram != nullptr) histogram->record(std::uint64_t(d.count()));
+    }
+};
+
+struct profiled_f
+{
+    template<class Name, class F, class... Ts>
+    auto operator()(const Name& name, const F& f, Ts&&... xs) const
+    -> decltype(f(BOOST_HOF_FORWARD(Ts)(xs)...))
+    {
+        profile_timer timer(detail::profile_name(name));
+        return f(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+#else
+
+struct profiled_f
+{
+    template<class Name, class F, class... Ts>
+    BOOST_HOF_INLINE constexpr auto operator()(const Name&, const F& f, Ts&&... xs) const
+    BOOST_HOF_RETURNS(f(BOOST_HOF_FORWARD(Ts)(xs)...));
+};
+
+#endif
+
+}
+
+inline profile_stats profile_read(const char* name)
+{
+    profile_stats s = {};
+#if BOOST_HOF_PROFILING
+    for (detail::profile_block* b = detail::thread_block<detail::profile_block>::head().load(std::memory_order_acquire); b != nullptr; b = b->next)
+    {
+        for (std::size_t i = 0; i < BOOST_HOF_PROFILING_SITES; i++)
+        {
+            const char* n = b->names[i].load(std::memory_order_acquire);
+            if (n == nullptr || std::strcmp(n, name) != 0) continue;
+            b->histograms[i].load(std::memory_order_acquire)->merge_into(s);
+        }
+    }
+#else
+    (void)name;
+#endif
+    return s;
+}
+
+namespace detail {
+
+inline void profile_append_label(std::string& out, const char* name)
+{
+    for (; *name != 0; name++)
+    {
+        if (*name == '\\' || *name == '"') out += '\\';
+        if (*name == '\n') out += "\\n";
+        else out += *name;
+    }
+}
+
+inline void profile_append_sample(std::string& out, const std::string& metric, const char* suffix, const char* name, const char* le, std::uint64_t value)
+{
+    out += metric;
+    out += suffix;
+    out += "{function=\"";
+    profile_append_label(out, name);
+    out += '"';
+    if (le != nullptr)
+    {
+        out += ",le=\"";
+        out += le;
+        out += '"';
+    }
+    out += "} ";
+    out += std::to_string(value);
+    out += '\n';
+}
+
+}
+
+// The names are found in the blocks of the threads, so enumerating them
+// costs nothing on the call path
+template<class F>
+void profile_for_each(F f)
+{
+#if BOOST_HOF_PROFILING
+    std::vector<const char*> names;
+    for (detail::profile_block* b = detail::thread_block<detail::profile_block>::head().load(std::memory_order_acquire); b != nullptr; b = b->next)
+    {
+        for (std::size_t i = 0; i < BOOST_HOF_PROFILING_SITES; i++)
+        {
+            const char* n = b->names[i].load(std::memory_order_acquire);
+            if (n != nullptr) names.push_back(n);
+        }
+    }
+    auto less = [](const char* x, const char* y) { return std::strcmp(x, y) < 0; };
+    auto equal = [](const char* x, const char* y) { return std::strcmp(x, y) == 0; };
+    std::sort(names.begin(), names.end(), less);
+    names.erase(std::unique(names.begin(), names.end(), equal), names.end());
+    for (const char* n : names) f(n, boost::hof::profile_read(n));
+#else
+    (void)f;
+#endif
+}
+
+inline std::string profile_prometheus(const std::string& metric="boost_hof_call_latency_nanoseconds")
+{
+    std::string out;
+    boost::hof::profile_for_each([&](const char* name, const profile_stats& s)
+    {
+        if (out.empty())
+        {
+            out += "# TYPE ";
+            out += metric;
+            out += " histogram\n";
+        }
+        // Only the buckets that counted a call are written, and each bucket
+        // counts the calls that took at most its upper bound
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i + 1 < profile_stats::bucket_count; i++)
+        {
+            if (s.buckets[i] == 0) continue;
+            seen += s.buckets[i];
+            detail::profile_append_sample(out, metric, "_bucket", name, std::to_string(profile_stats::bucket_value(i + 1) - 1).c_str(), seen);
+        }
+        detail::profile_append_sample(out, metric, "_bucket", name, "+Inf", s.count);
+        detail::profile_append_sample(out, metric, "_sum", name, nullptr, s.total);
+        detail::profile_append_sample(out, metric, "_count", name, nullptr, s.count);
+    });
+    return out;
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(profiled, decorate_adaptor<detail::profiled_f>);
+
+}} // namespace boost::hof
+
+#endif
@@ -101,15 +101,15 @@ struct project_eval
     const Projection& p;
 
     template<class X, class P>
-    constexpr project_eval(X&& xp, const P& pp) : x(BOOST_HOF_FORWARD(X)(xp)), p(pp)
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr project_eval(X&& xp, const P& pp) : x(BOOST_HOF_FORWARD(X)(xp)), p(pp)
     {}
 
-    constexpr auto operator()() const BOOST_HOF_RETURNS
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()() const BOOST_HOF_RETURNS
     (p(BOOST_HOF_FORWARD(T)(x)));
 };
 
 template<class T, class Projection>
-constexpr project_eval<T, Projection> make_project_eval(T&& x, const Projection& p)
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr project_eval<T, Projection> make_project_eval(T&& x, const Projection& p)
 {
     return project_eval<T, Projection>(BOOST_HOF_FORWARD(T)(x), p);
 }
@@ -121,19 +121,19 @@ struct project_void_eval
     const Projection& p;
 
     template<class X, class P>
-    constexpr project_void_eval(X&& xp, const P& pp) : x(BOOST_HOF_FORWARD(X)(xp)), p(pp)
+    BOOST_HOF_HOST_DEVICE constexpr project_void_eval(X&& xp, const P& pp) : x(BOOST_HOF_FORWARD(X)(xp)), p(pp)
     {}
 
     struct void_ {};
 
-    constexpr void_ operator()() const
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr void_ operator()() const
     {
         return p(BOOST_HOF_FORWARD(T)(x)), void_();
     }
 };
 
 template<class T, class Projection>
-constexpr project_void_eval<T, Projection> make_project_void_eval(T&& x, const Projection& p)
+BOOST_HOF_HOST_DEVICE constexpr project_void_eval<T, Projection> make_project_void_eval(T&& x, const Projection& p)
 {
     return project_void_eval<T, Projection>(BOOST_HOF_FORWARD(T)(x), p);
 }
@@ -142,7 +142,8 @@ template<class Projection, class F, class... Ts,
     class R=decltype(
         std::declval<const F&>()(std::declval<const Projection&>()(std::declval<Ts>())...)
     )>
-constexpr R by_eval(const Projection& p, const F& f, Ts&&... xs)
+BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr R by_eval(const Projection& p, const F& f, Ts&&... xs)
+BOOST_HOF_NOEXCEPT(noexcept(std::declval<const F&>()(std::declval<const Projection&>()(std::declval<Ts>())...)))
 {
     return boost::hof::apply_eval(f, make_project_eval(BOOST_HOF_FORWARD(Ts)(xs), p)...);
 }
@@ -158,7 +159,7 @@ constexpr R by_eval(const Projection& p, const F& f, Ts&&... xs)
 #endif
 
 template<class Projection, class... Ts>
-constexpr BOOST_HOF_ALWAYS_VOID_RETURN by_void_eval(const Projection& p, Ts&&... xs)
+BOOST_HOF_HOST_DEVICE constexpr BOOST_HOF_ALWAYS_VOID_RETURN by_void_eval(const Projection& p, Ts&&... xs)
 {
     return boost::hof::apply_eval(boost::hof::always(), boost::hof::detail::make_project_void_eval(BOOST_HOF_FORWARD(Ts)(xs), p)...);
 }
@@ -166,7 +167,7 @@ constexpr BOOST_HOF_ALWAYS_VOID_RETURN by_void_eval(const Projection& p, Ts&&...
 struct swallow
 {
     template<class... Ts>
-    constexpr swallow(Ts&&...)
+    BOOST_HOF_HOST_DEVICE constexpr swallow(Ts&&...)
     {}
 };
 
@@ -181,13 +182,13 @@ struct proj_adaptor : detail::compressed_pair<detail::callable_base<Projection>,
     typedef proj_adaptor fit_rewritable_tag;
     typedef detail::compressed_pair<detail::callable_base<Projection>, detail::callable_base<F>> base;
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
     {
         return this->second(xs...);;
     }
 
     template<class... Ts>
-    constexpr const detail::callable_base<Projection>& base_projection(Ts&&... xs) const
+    BOOST_HOF_HOST_DEVICE constexpr const detail::callable_base<Projection>& base_projection(Ts&&... xs) const noexcept
     {
         return this->first(xs...);
     }
@@ -212,8 +213,8 @@ struct proj_adaptor : detail::compressed_pair<detail::callable_base<Projection>,
 
     BOOST_HOF_RETURNS_CLASS(proj_adaptor);
 
-    template<class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(const detail::callable_base<F>&, result_of<const detail::callable_base<Projection>&, id_<Ts>>...) 
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(proj, Ts...)>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(const detail::callable_base<F>&, result_of<const detail::callable_base<Projection>&, id_<Ts>>...) 
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         boost::hof::detail::by_eval(
@@ -229,22 +230,22 @@ struct proj_adaptor<Projection, void> : detail::callable_base<Projection>
 {
     typedef proj_adaptor fit_rewritable1_tag;
     template<class... Ts>
-    constexpr const detail::callable_base<Projection>& base_projection(Ts&&... xs) const
+    BOOST_HOF_HOST_DEVICE constexpr const detail::callable_base<Projection>& base_projection(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     BOOST_HOF_INHERIT_DEFAULT(proj_adaptor, detail::callable_base<Projection>)
 
     template<class P, BOOST_HOF_ENABLE_IF_CONVERTIBLE(P, detail::callable_base<Projection>)>
-    constexpr proj_adaptor(P&& p) 
+    BOOST_HOF_HOST_DEVICE constexpr proj_adaptor(P&& p) 
     : detail::callable_base<Projection>(BOOST_HOF_FORWARD(P)(p))
     {}
 
     BOOST_HOF_RETURNS_CLASS(proj_adaptor);
 
-    template<class... Ts, class=detail::holder<decltype(std::declval<Projection>()(std::declval<Ts>()))...>>
-    constexpr BOOST_HOF_BY_VOID_RETURN operator()(Ts&&... xs) const 
+    template<class... Ts, class=detail::holder<decltype(std::declval<Projection>()(std::declval<Ts>()))...> BOOST_HOF_DETAIL_CALL_MARKER(proj, Ts...)>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr BOOST_HOF_BY_VOID_RETURN operator()(Ts&&... xs) const 
     {
 #if BOOST_HOF_NO_ORDERED_BRACE_INIT
         return boost::hof::detail::by_void_eval(this->base_projection(xs...), BOOST_HOF_FORWARD(Ts)(xs)...);
@@ -259,6 +260,8 @@ struct proj_adaptor<Projection, void> : detail::callable_base<Projection>
     }
 };
 
+BOOST_HOF_DETAIL_COMPILE_MARKER(proj, proj_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(proj, detail::make<proj_adaptor>);
 
 }} // namespace boost::hof
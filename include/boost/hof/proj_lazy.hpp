@@ -0,0 +1,263 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    proj_lazy.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FUNCTION_PROJ_LAZY_H
+#define BOOST_HOF_GUARD_FUNCTION_PROJ_LAZY_H
+
+/// proj_lazy
+/// =========
+///
+/// Description
+/// -----------
+///
+/// The `proj_lazy` function adaptor is like [`proj`](proj), except the
+/// projection is only applied to the arguments that the function uses.
+/// Instead of the projected values, the function is passed a
+/// `lazy_projection` for each argument, which applies the projection the
+/// first time it is called, or converted to the result of the projection,
+/// and keeps the result for the next times. So when the projection is
+/// expensive, such as decoding or hashing, a function that only inspects
+/// some of its arguments, such as a comparator that stops at the first key
+/// that differs, doesn't pay for the others.
+///
+/// The arguments are held by reference, so the function must not keep the
+/// `lazy_projection` after it returns.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Projection, class F>
+///     proj_lazy_adaptor<Projection, F> proj_lazy(Projection p, F f);
+///
+///     template<class T, class Projection>
+///     class lazy_projection
+///     {
+///         const R& operator()() const;
+///         operator const R&() const;
+///     };
+///
+/// Semantics
+/// ---------
+///
+///     assert(proj_lazy(p, f)(xs...) == f(lazy_projection(xs, p)...));
+///     assert(lazy_projection(x, p)() == p(x));
+///
+/// Requirements
+/// ------------
+///
+/// Projection must be:
+///
+/// * [UnaryInvocable](UnaryInvocable)
+/// * MoveConstructible
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int calls = 0;
+///
+///     struct expensive_key
+///     {
+///         int operator()(int x) const
+///         {
+///             calls++;
+///             return x / 10;
+///         }
+///     };
+///
+///     struct first_positive
+///     {
+///         template<class T, class U>
+///         int operator()(T x, U y) const
+///         {
+///             return x() > 0 ? x() : y();
+///         }
+///     };
+///
+///     int main() {
+///         assert(boost::hof::proj_lazy(expensive_key(), first_positive())(20, 30) == 2);
+///         assert(calls == 1);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [proj](proj)
+/// * [Projections](Projections)
+///
+
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class R>
+struct lazy_projection_cache
+{
+    union
+    {
+        R value;
+    };
+    bool has;
+
+    lazy_projection_cache() noexcept : has(false)
+    {}
+
+    lazy_projection_cache(const lazy_projection_cache& rhs) : has(false)
+    {
+        if (rhs.has) this->emplace(rhs.value);
+    }
+
+    lazy_projection_cache(lazy_projection_cache&& rhs) : has(false)
+    {
+        if (rhs.has) this->emplace(std::move(rhs.value));
+    }
+
+    lazy_projection_cache& operator=(const lazy_projection_cache&)=delete;
+
+    ~lazy_projection_cache()
+    {
+        if (has) value.~R();
+    }
+
+    template<class X>
+    const R& emplace(X&& x)
+    {
+        ::new(static_cast<void*>(std::addressof(value))) R(BOOST_HOF_FORWARD(X)(x));
+        has = true;
+        return value;
+    }
+
+    bool ready() const noexcept
+    {
+        return has;
+    }
+
+    const R& get() const noexcept
+    {
+        return value;
+    }
+};
+
+// A reference is kept by its address
+template<class R>
+struct lazy_projection_cache<R&>
+{
+    R* value;
+
+    lazy_projection_cache() noexcept : value(nullptr)
+    {}
+
+    R& emplace(R& x) noexcept
+    {
+        value = std::addressof(x);
+        return x;
+    }
+
+    bool ready() const noexcept
+    {
+        return value != nullptr;
+    }
+
+    R& get() const noexcept
+    {
+        return *value;
+    }
+};
+
+}
+
+template<class T, class Projection>
+class lazy_projection
+{
+    typedef decltype(std::declval<const Projection&>()(std::declval<T>())) result_type;
+    // An rvalue reference is moved into the cache, so it can be used again
+    typedef typename std::conditional<
+        std::is_lvalue_reference<result_type>::value,
+        result_type,
+        typename std::remove_cv<typename std::remove_reference<result_type>::type>::type
+    >::type cache_type;
+    typedef typename std::conditional<
+        std::is_lvalue_reference<result_type>::value,
+        result_type,
+        const cache_type&
+    >::type reference;
+
+    T&& x;
+    const Projection& p;
+    mutable detail::lazy_projection_cache<cache_type> cache;
+public:
+    template<class X>
+    lazy_projection(X&& xp, const Projection& pp) : x(BOOST_HOF_FORWARD(X)(xp)), p(pp)
+    {}
+
+    lazy_projection(const lazy_projection& rhs) : x(BOOST_HOF_FORWARD(T)(rhs.x)), p(rhs.p), cache(rhs.cache)
+    {}
+
+    reference operator()() const
+    {
+        if (cache.ready()) return cache.get();
+        return cache.emplace(p(BOOST_HOF_FORWARD(T)(x)));
+    }
+
+    operator reference() const
+    {
+        return (*this)();
+    }
+};
+
+template<class Projection, class F>
+struct proj_lazy_adaptor : detail::compressed_pair<detail::callable_base<Projection>, detail::callable_base<F>>
+{
+    typedef detail::compressed_pair<detail::callable_base<Projection>, detail::callable_base<F>> base;
+
+    template<class... Ts>
+    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return this->second(xs...);
+    }
+
+    template<class... Ts>
+    constexpr const detail::callable_base<Projection>& base_projection(Ts&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(proj_lazy_adaptor, base)
+
+    template<class... Ts, class R=decltype(std::declval<const detail::callable_base<F>&>()(
+        std::declval<lazy_projection<Ts&&, detail::callable_base<Projection>>>()...
+    ))>
+    R operator()(Ts&&... xs) const
+    {
+        return this->base_function(xs...)(
+            lazy_projection<Ts&&, detail::callable_base<Projection>>(BOOST_HOF_FORWARD(Ts)(xs), this->base_projection(xs...))...
+        );
+    }
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(proj_lazy, detail::make<proj_lazy_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
@@ -74,6 +74,8 @@ struct protect_adaptor : detail::callable_base<F>
     BOOST_HOF_INHERIT_CONSTRUCTOR(protect_adaptor, detail::callable_base<F>)
 };
 
+BOOST_HOF_DETAIL_COMPILE_MARKER(protect, protect_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(protect, detail::make<protect_adaptor>);
 
 }} // namespace boost::hof
@@ -0,0 +1,250 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    record_view.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_RECORD_VIEW_H
+#define BOOST_HOF_GUARD_RECORD_VIEW_H
+
+/// record_view
+/// ===========
+///
+/// Description
+/// -----------
+///
+/// The `record_view` class is a view of a record with a fixed layout, such as
+/// one in a memory-mapped file, where the fields of the `record_layout` are
+/// stored one after the other, without padding, each one with the width of
+/// its type. The view is [Unpackable](Unpackable): unpacking it passes a
+/// `record_field` for each field, which only points into the record, and the
+/// field is decoded when `decode_field` is called on it, or when it is
+/// converted to its type. So `unpack(proj(decode_field, f))(view)` decodes
+/// every field, and a function that takes the fields itself decodes only the
+/// ones it uses.
+///
+/// The offset of each field is computed at compile time. The fields are
+/// loaded with `std::memcpy`, or assembled from their bytes, so the record
+/// doesn't have to be aligned, and the compiler reduces the load to a single
+/// instruction where the target allows unaligned loads, with a byte swap when
+/// the order differs. The `Endian` policy is either `record_little_endian`,
+/// which is the encoding written by [`serialize_into`](serialize), or
+/// `record_big_endian`.
+///
+/// The size of a record is `record_view<Layout>::size`, and `next` returns a
+/// view of the record that follows it, so a stream of records can be read
+/// without copying them.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Ts>
+///     struct record_layout;
+///
+///     template<class Layout, class Endian=record_little_endian>
+///     class record_view
+///     {
+///         static constexpr std::size_t size;
+///
+///         explicit record_view(const void* data) noexcept;
+///
+///         const unsigned char* data() const noexcept;
+///
+///         record_view next() const noexcept;
+///
+///         template<std::size_t I>
+///         record_field<T, Endian> get() const noexcept;
+///
+///         // Calls the function with the fields
+///         template<class F>
+///         auto operator()(F f) const;
+///     };
+///
+///     template<class T, class Endian>
+///     T decode_field(record_field<T, Endian> x) noexcept;
+///
+/// Requirements
+/// ------------
+///
+/// The fields must be arithmetic types or enums, that are 1, 2, 4 or 8 bytes
+/// wide. A `bool` is decoded as true when its byte isn't 0.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <array>
+///     #include <cassert>
+///     #include <cstdint>
+///
+///     typedef boost::hof::record_view<boost::hof::record_layout<std::uint16_t, std::uint32_t>> header_view;
+///
+///     int main() {
+///         std::array<unsigned char, 12> buffer;
+///         boost::hof::serialize_into(buffer)(std::uint16_t(1), std::uint32_t(2), std::uint16_t(3), std::uint32_t(4));
+///         header_view first(buffer.data());
+///         auto sum = boost::hof::proj(boost::hof::decode_field, boost::hof::_1 + boost::hof::_2);
+///         assert(boost::hof::unpack(sum)(first) == 3);
+///         assert(boost::hof::unpack(sum)(first.next()) == 7);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [unpack](unpack)
+/// * [unpack_sequence](unpack_sequence)
+/// * [serialize_into](serialize)
+///
+
+#include <boost/hof/serialize.hpp>
+#include <boost/hof/unpack_sequence.hpp>
+#include <boost/hof/returns.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <boost/hof/detail/type_at.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+template<class... Ts>
+struct record_layout
+{};
+
+struct record_little_endian
+{
+    template<class T>
+    static T load(const unsigned char* p) noexcept
+    {
+        T x;
+        detail::serial_load(p, x);
+        return x;
+    }
+};
+
+struct record_big_endian
+{
+    template<class T>
+    static T load(const unsigned char* p) noexcept
+    {
+        typedef typename detail::serial_word<sizeof(T)>::type word;
+        word w = 0;
+        for (std::size_t i = 0; i < sizeof(T); i++) w = static_cast<word>(static_cast<word>(w << 8) | p[i]);
+        T x;
+        std::memcpy(&x, &w, sizeof(T));
+        return x;
+    }
+};
+
+template<class T, class Endian>
+struct record_field
+{
+    static_assert(detail::is_serializable<T>::value, "The field must be an arithmetic type or an enum, that is 1, 2, 4 or 8 bytes wide");
+
+    const unsigned char* data;
+
+    T get() const noexcept
+    {
+        return Endian::template load<T>(data);
+    }
+
+    operator T() const noexcept
+    {
+        return this->get();
+    }
+};
+
+template<class Endian>
+struct record_field<bool, Endian>
+{
+    const unsigned char* data;
+
+    bool get() const noexcept
+    {
+        return *data != 0;
+    }
+
+    operator bool() const noexcept
+    {
+        return this->get();
+    }
+};
+
+template<class Layout, class Endian=record_little_endian>
+class record_view;
+
+template<class... Ts, class Endian>
+class record_view<record_layout<Ts...>, Endian>
+{
+    const unsigned char* p;
+public:
+    static constexpr std::size_t size = detail::serial_offset(sizeof...(Ts), sizeof(Ts)...);
+
+    explicit record_view(const void* data) noexcept : p(static_cast<const unsigned char*>(data))
+    {}
+
+    const unsigned char* data() const noexcept
+    {
+        return p;
+    }
+
+    record_view next() const noexcept
+    {
+        return record_view(p + size);
+    }
+
+    template<std::size_t I>
+    record_field<typename detail::type_at<I, Ts...>::type, Endian> get() const noexcept
+    {
+        return record_field<typename detail::type_at<I, Ts...>::type, Endian>{p + std::integral_constant<std::size_t,
+            detail::serial_offset(I, sizeof(Ts)...)
+        >::value};
+    }
+
+private:
+    template<class F, std::size_t... Ns>
+    auto unpack_fields(detail::seq<Ns...>, F&& f) const BOOST_HOF_RETURNS
+    (
+        f(this->template get<Ns>()...)
+    );
+public:
+    template<class F>
+    auto operator()(F&& f) const BOOST_HOF_RETURNS
+    (
+        this->unpack_fields(typename detail::gens<sizeof...(Ts)>::type(), BOOST_HOF_FORWARD(F)(f))
+    );
+};
+
+template<class... Ts, class Endian>
+constexpr std::size_t record_view<record_layout<Ts...>, Endian>::size;
+
+template<class Layout, class Endian>
+struct unpack_sequence<record_view<Layout, Endian>>
+{
+    template<class F, class V>
+    constexpr static auto apply(F&& f, V&& v) BOOST_HOF_RETURNS
+    (
+        v(BOOST_HOF_FORWARD(F)(f))
+    );
+};
+
+namespace detail {
+
+struct decode_field_f
+{
+    template<class T, class Endian>
+    T operator()(record_field<T, Endian> x) const noexcept
+    {
+        return x.get();
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(decode_field, detail::decode_field_f);
+
+}} // namespace boost::hof
+
+#endif
@@ -17,6 +17,15 @@
 /// The `repeat` function decorator will repeatedly apply a function a given
 /// number of times.
 /// 
+/// If the function returns `void` when called with an lvalue of the state,
+/// then the function will instead be called repeatedly to update the state in
+/// place, and the final state is returned.
+/// 
+/// When the number of times is an `IntegralConstant`, the calls are fully
+/// unrolled at compile-time. The count is split in half at each step, so only
+/// a logarithmic number of templates is instantiated, which keeps large
+/// constant counts cheap to compile.
+/// 
 /// 
 /// Synopsis
 /// --------
@@ -75,14 +84,27 @@
 
 namespace boost { namespace hof { namespace detail {
 
+// The count is split in half on each level, so unrolling the function N
+// times only needs O(log N) instantiations.
 template<int N>
 struct repeater
 {
     template<class F, class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(repeater<N-1>, id_<const F&>, result_of<const F&, id_<Ts>...>) 
+    constexpr BOOST_HOF_SFINAE_RESULT(repeater<N - N/2>, id_<const F&>, result_of<repeater<N/2>, id_<const F&>, id_<Ts>...>) 
     operator()(const F& f, Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
-        repeater<N-1>()(f, f(BOOST_HOF_FORWARD(Ts)(xs)...))
+        repeater<N - N/2>()(f, repeater<N/2>()(f, BOOST_HOF_FORWARD(Ts)(xs)...))
+    );
+};
+
+template<>
+struct repeater<1>
+{
+    template<class F, class... Ts>
+    constexpr BOOST_HOF_SFINAE_RESULT(const F&, id_<Ts>...) 
+    operator()(const F& f, Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
+    (
+        f(BOOST_HOF_FORWARD(Ts)(xs)...)
     );
 };
 
@@ -140,7 +162,24 @@ struct repeat_integral_decorator<0>
         }
         return x;
     }
-    // TODO: Add overload for lvalue
+};
+
+// When the function returns void for an lvalue, the state is updated in place
+// instead of being moved through the function on each iteration.
+struct repeat_integral_inplace_decorator
+{
+    template<class Integral, class F, class T, typename std::enable_if<(
+        std::is_void<decltype(std::declval<const F&>()(std::declval<T&>()))>::value
+    ), int>::type = 0>
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    constexpr
+#endif
+    T operator()(Integral n, const F& f, T x) const 
+    BOOST_HOF_NOEXCEPT(noexcept(f(x)) && BOOST_HOF_IS_NOTHROW_MOVE_CONSTRUCTIBLE(T))
+    {
+        for(auto i = +n; i > 0; --i) f(x);
+        return x;
+    }
 };
 
 }
@@ -154,6 +193,12 @@ struct repeat_integral_decorator<0>
 BOOST_HOF_DECLARE_STATIC_VAR(repeat, decorate_adaptor<
     boost::hof::first_of_adaptor<
     detail::repeat_constant_decorator, 
+    detail::repeat_integral_inplace_decorator,
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    // A single state can go directly to the loop, since it can be evaluated
+    // at compile-time without recursion.
+    detail::repeat_integral_decorator<0>,
+#endif
     detail::repeat_integral_decorator<BOOST_HOF_REPEAT_CONSTEXPR_DEPTH>
 >>);
 
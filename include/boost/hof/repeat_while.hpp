@@ -18,6 +18,13 @@
 /// the predicate returns a boolean that is true. If the predicate returns an
 /// `IntergralConstant` then the predicate is only evaluated at compile-time.
 /// 
+/// Otherwise, for `constexpr` evaluation in C++11, the calls are unrolled
+/// recursively to a depth of `BOOST_HOF_RECURSIVE_CONSTEXPR_DEPTH`, after
+/// which a loop is used. With relaxed `constexpr` in C++14, the loop is used
+/// directly, since it can be evaluated at compile-time. The `repeat_while_depth`
+/// decorator sets the depth for one use instead. A depth of 0 uses the loop
+/// directly, which avoids instantiating the unrolled calls, but the loop is
+/// only `constexpr` with relaxed `constexpr`.
 /// 
 /// Synopsis
 /// --------
@@ -25,6 +32,9 @@
 ///     template<class Predicate>
 ///     constexpr auto repeat_while(Predicate predicate);
 /// 
+///     template<int Depth, class Predicate>
+///     constexpr auto repeat_while_depth(Predicate predicate);
+/// 
 /// Requirements
 /// ------------
 /// 
@@ -142,39 +152,61 @@ struct repeat_while_integral_decorator
     );
 };
 
+// The loop is used without any recursion when the function can be evaluated
+// at compile-time with relaxed constexpr. The first call is made with all the
+// arguments, and then the loop continues with the single state.
 template<>
 struct repeat_while_integral_decorator<0>
 {
-    template<class P, class F, class T, class Self=repeat_while_integral_decorator<0>>
+    template<class P, class F, class T, class... Ts, class Self=repeat_while_integral_decorator<0>>
 #if BOOST_HOF_HAS_RELAXED_CONSTEXPR
     constexpr
 #endif
-    auto operator()(const P& p, const F& f, T x) const 
-    BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT((p(x), f(x)))
-    -> decltype(f(x))
+    auto operator()(const P& p, const F& f, T x, Ts&&... xs) const 
+    BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT((p(x, xs...), f(x, BOOST_HOF_FORWARD(Ts)(xs)...)))
+    -> decltype(f(x, BOOST_HOF_FORWARD(Ts)(xs)...))
     {
-        while(p(x))
+        if (p(x, xs...))
         {
-            // TODO: Should move?
-            x = f(x);
+            x = f(x, BOOST_HOF_FORWARD(Ts)(xs)...);
+            while(p(x))
+            {
+                // TODO: Should move?
+                x = f(x);
+            }
         }
         return x;
     }
 };
+
+template<int Depth>
+using repeat_while_depth_f = decorate_adaptor<
+    boost::hof::first_of_adaptor<
+        detail::repeat_while_constant_decorator,
+        detail::repeat_while_integral_decorator<Depth>
+    >
+>;
+
 }
 
 #if BOOST_HOF_HAS_RELAXED_CONSTEXPR
-#define BOOST_HOF_REPEAT_WHILE_CONSTEXPR_DEPTH 1
+#define BOOST_HOF_REPEAT_WHILE_CONSTEXPR_DEPTH 0
 #else
 #define BOOST_HOF_REPEAT_WHILE_CONSTEXPR_DEPTH BOOST_HOF_RECURSIVE_CONSTEXPR_DEPTH
 #endif
 
-BOOST_HOF_DECLARE_STATIC_VAR(repeat_while, decorate_adaptor<
-    boost::hof::first_of_adaptor<
-        detail::repeat_while_constant_decorator,
-        detail::repeat_while_integral_decorator<BOOST_HOF_REPEAT_WHILE_CONSTEXPR_DEPTH>
-    >
->);
+BOOST_HOF_DECLARE_STATIC_VAR(repeat_while, detail::repeat_while_depth_f<BOOST_HOF_REPEAT_WHILE_CONSTEXPR_DEPTH>);
+
+#if BOOST_HOF_HAS_VARIABLE_TEMPLATES
+template<int Depth>
+static constexpr detail::repeat_while_depth_f<Depth> repeat_while_depth = {};
+#else
+template<int Depth, class P>
+constexpr auto repeat_while_depth(P p) BOOST_HOF_RETURNS
+(
+    detail::repeat_while_depth_f<Depth>()(boost::hof::move(p))
+);
+#endif
 
 }} // namespace boost::hof
 
@@ -0,0 +1,122 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    repeat_while_step.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_REPEAT_WHILE_STEP_H
+#define BOOST_HOF_GUARD_REPEAT_WHILE_STEP_H
+
+/// repeat_while_step
+/// =================
+///
+/// Description
+/// -----------
+///
+/// The `repeat_while_step` function adaptor is like
+/// [`repeat_while`](repeat_while), except the test and the update are done
+/// by the same function. The function returns an optional-like value, such
+/// as `std::optional`. When it has a value, the loop continues
+/// with that value as the new state, otherwise the loop stops and the
+/// current state is returned.
+///
+/// Since there is only one call for each iteration, the test and the update
+/// are fused, and the function can stop the loop as soon as it knows the
+/// answer, like a `break` in a search loop. The state is kept in a local
+/// variable that is updated in place, so a small state can stay in
+/// registers across the iterations.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F>
+///     constexpr repeat_while_step_adaptor<F> repeat_while_step(F f);
+///
+/// Semantics
+/// ---------
+///
+///     auto r = f(x);
+///     assert(repeat_while_step(f)(x) == (r ? repeat_while_step(f)(*r) : x));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// The result of `f(x)` must be contextually convertible to `bool`, and
+/// dereferencing it must give a value that can be assigned to the state.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <optional>
+///
+///     struct collatz
+///     {
+///         std::optional<int> operator()(int x) const
+///         {
+///             if (x == 1) return std::nullopt;
+///             return x % 2 == 0 ? x / 2 : 3 * x + 1;
+///         }
+///     };
+///
+///     int main() {
+///         assert(boost::hof::repeat_while_step(collatz())(27) == 1);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [repeat_while](repeat_while)
+/// * [fix_trampoline](fix_trampoline)
+///
+
+#include <boost/hof/always.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+template<class F>
+struct repeat_while_step_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(repeat_while_step_adaptor, detail::callable_base<F>)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class T, class=decltype(*std::declval<const detail::callable_base<F>&>()(std::declval<const T&>()))>
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    constexpr
+#endif
+    T operator()(T x) const
+    {
+        for(;;)
+        {
+            auto r = this->base_function(x)(static_cast<const T&>(x));
+            if (!r) return x;
+            x = std::move(*r);
+        }
+    }
+};
+
+BOOST_HOF_DETAIL_COMPILE_MARKER(repeat_while_step, repeat_while_step_adaptor)
+
+BOOST_HOF_DECLARE_STATIC_VAR(repeat_while_step, detail::make<repeat_while_step_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
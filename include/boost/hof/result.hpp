@@ -20,6 +20,11 @@
 /// `result_adaptor` provides a nested `result_type` that is the return type
 /// of the function.
 /// 
+/// In C++17, when the function returns a prvalue of the result type, the
+/// result is constructed directly in the return value of the adaptor, so it
+/// isn't moved, and the result type doesn't need to be movable. A `void`
+/// result discards the result of the function.
+/// 
 /// Synopsis
 /// --------
 /// 
@@ -56,12 +61,51 @@
 /// 
 
 #include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/holder.hpp>
 #include <boost/hof/is_invocable.hpp>
 #include <boost/hof/always.hpp>
 #include <boost/hof/reveal.hpp>
 
 namespace boost { namespace hof {
 
+namespace detail {
+
+template<class Result, class F, class Args, class=void>
+struct result_is_elided_impl
+: std::false_type
+{};
+
+#if BOOST_HOF_HAS_STD_17
+template<class Result, class F, class... Ts>
+struct result_is_elided_impl<Result, F, holder<Ts...>, typename std::enable_if<
+    std::is_same<Result, decltype(std::declval<const F&>()(std::declval<Ts>()...))>::value
+>::type>
+: std::true_type
+{};
+#endif
+
+template<class Result, class F, class... Ts>
+struct result_is_elided
+: result_is_elided_impl<Result, F, holder<Ts...>>
+{};
+
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+template<class... Ts>
+struct result_void
+{
+    typedef void type;
+};
+#else
+// A constexpr function can't return void in C++11, unless the return type
+// is dependent
+template<class... Ts>
+struct result_void
+: holder<Ts...>
+{};
+#endif
+
+}
+
 template<class Result, class F>
 struct result_adaptor : detail::callable_base<F>
 {
@@ -74,13 +118,28 @@ struct result_adaptor : detail::callable_base<F>
     {};
 
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
-    template<class... Ts, class=typename std::enable_if<(boost::hof::is_invocable<F, Ts...>::value)>::type>
-    constexpr result_type operator()(Ts&&... xs) const
+    template<class... Ts, class=typename std::enable_if<(
+        boost::hof::is_invocable<F, Ts...>::value &&
+        !detail::result_is_elided<Result, detail::callable_base<F>, Ts...>::value
+    )>::type>
+    BOOST_HOF_INLINE constexpr result_type operator()(Ts&&... xs) const
+    BOOST_HOF_NOEXCEPT(noexcept(result_type(std::declval<const detail::callable_base<F>&>()(std::declval<Ts>()...))))
+    {
+        return this->base_function(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...);
+    };
+
+    // The prvalue initializes the return value directly, so only the call
+    // can throw
+    template<class... Ts, class=typename std::enable_if<(
+        detail::result_is_elided<Result, detail::callable_base<F>, Ts...>::value
+    )>::type, class=void>
+    BOOST_HOF_INLINE constexpr result_type operator()(Ts&&... xs) const
+    BOOST_HOF_NOEXCEPT(noexcept(std::declval<const detail::callable_base<F>&>()(std::declval<Ts>()...)))
     {
         return this->base_function(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...);
     };
@@ -94,15 +153,16 @@ struct result_adaptor<void, F> : detail::callable_base<F>
     typedef void result_type;
 
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     template<class... Ts, class=typename std::enable_if<(boost::hof::is_invocable<F, Ts...>::value)>::type>
-    constexpr typename detail::holder<Ts...>::type operator()(Ts&&... xs) const
+    BOOST_HOF_INLINE constexpr typename detail::result_void<Ts...>::type operator()(Ts&&... xs) const
+    BOOST_HOF_NOEXCEPT(noexcept(std::declval<const detail::callable_base<F>&>()(std::declval<Ts>()...)))
     {
-        return (typename detail::holder<Ts...>::type)this->base_function(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...);
+        return static_cast<void>(this->base_function(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...));
     };
 };
 
@@ -112,7 +172,8 @@ template<class Result>
 struct result_f
 {
     template<class F>
-    constexpr result_adaptor<Result, F> operator()(F f) const
+    BOOST_HOF_INLINE constexpr result_adaptor<Result, F> operator()(F f) const
+    BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(result_adaptor<Result, F>, F&&)
     {
         return result_adaptor<Result, F>(boost::hof::move(f));
     }
@@ -125,6 +186,7 @@ static constexpr auto result = result_detail::result_f<Result>{};
 #else
 template<class Result, class F>
 constexpr result_adaptor<Result, F> result(F f)
+BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(result_adaptor<Result, F>, F&&)
 {
     return result_adaptor<Result, F>(boost::hof::move(f));
 }
@@ -0,0 +1,268 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    retry.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_RETRY_H
+#define BOOST_HOF_GUARD_RETRY_H
+
+/// retry
+/// =====
+///
+/// Description
+/// -----------
+///
+/// The `retry` function decorator calls the function again when it throws,
+/// waiting between the attempts for the time given by the policy. The
+/// policy decides how many times the function is called, and the delay
+/// before each retry. When the last attempt throws, its exception is
+/// rethrown. The arguments are passed as lvalues to each attempt, so they
+/// are not moved from by an attempt that fails.
+///
+/// The `exponential_backoff` policy doubles the delay after each retry,
+/// starting from the initial delay, and up to the maximum delay. The policy
+/// is stored in the decorated function, and the attempts are counted on the
+/// stack, so a call that succeeds doesn't allocate, and only pays for the
+/// `try` block.
+///
+/// The `with_deadline` function decorator throws `deadline_exceeded`
+/// instead of calling the function when the clock of the time point has
+/// reached it. The `retry` decorator never retries after a
+/// `deadline_exceeded`, so a function decorated with `with_deadline`, and
+/// then with `retry`, stops retrying when the deadline is reached.
+///
+/// The `with_stop_token` function decorator throws `operation_cancelled`
+/// instead of calling the function when a stop has been requested on the
+/// token, which is any type with a const `stop_requested()` member function,
+/// such as `std::stop_token`. The token is stored in the decorated function,
+/// so it should be a handle to the shared stop state. The `retry` decorator
+/// never retries after an `operation_cancelled` either. Decorating each
+/// stage of a [`flow`](flow) with the same token, or each stage of a flow of
+/// [`async`](async) functions, checks the token before each stage starts, so
+/// the stages that are left are skipped once the request is abandoned. The
+/// `deadline_token` is a token for a time point, whose stop is requested
+/// once the clock has reached it, so a deadline can be passed wherever a
+/// token is, such as to [`pipeline`](pipeline).
+///
+/// Synopsis
+/// --------
+///
+///     template<class Policy>
+///     constexpr auto retry(Policy p);
+///
+///     template<class Clock, class Duration>
+///     constexpr auto with_deadline(std::chrono::time_point<Clock, Duration> d);
+///
+///     template<class StopToken>
+///     constexpr auto with_stop_token(StopToken t);
+///
+///     template<class Clock, class Duration>
+///     struct deadline_token
+///     {
+///         constexpr deadline_token(std::chrono::time_point<Clock, Duration> d);
+///         bool stop_requested() const;
+///     };
+///
+///     template<class Clock, class Duration>
+///     constexpr deadline_token<Clock, Duration> make_deadline_token(std::chrono::time_point<Clock, Duration> d);
+///
+///     struct exponential_backoff
+///     {
+///         constexpr exponential_backoff(std::size_t attempts,
+///             std::chrono::nanoseconds initial=std::chrono::nanoseconds(0),
+///             std::chrono::nanoseconds maximum=std::chrono::seconds(1));
+///         std::size_t attempts() const;
+///         std::chrono::nanoseconds delay(std::size_t retry) const;
+///     };
+///
+///     struct deadline_exceeded : std::runtime_error;
+///
+///     struct operation_cancelled : std::runtime_error;
+///
+/// Semantics
+/// ---------
+///
+///     assert(retry(p)(f)(xs...) == f(xs...));
+///     assert(with_deadline(d)(f)(xs...) == f(xs...));
+///     assert(with_stop_token(t)(f)(xs...) == f(xs...));
+///
+/// Requirements
+/// ------------
+///
+/// Policy must have:
+///
+/// * A const member function `attempts()` that returns the number of times
+///   the function is called at most
+/// * A const member function `delay(i)` that returns a `std::chrono::duration`
+///   to wait before the retry `i`, which starts at 1
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <chrono>
+///     #include <stdexcept>
+///
+///     struct flaky
+///     {
+///         int* calls;
+///         int operator()(int x) const
+///         {
+///             if (++*calls < 3) throw std::runtime_error("try again");
+///             return x;
+///         }
+///     };
+///
+///     int main() {
+///         int calls = 0;
+///         auto f = boost::hof::retry(boost::hof::exponential_backoff(5, std::chrono::microseconds(10)))(flaky{&calls});
+///         assert(f(1) == 1);
+///         assert(calls == 3);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [decorate](decorate)
+/// * [hedged](hedged)
+///
+
+#include <boost/hof/decorate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+
+namespace boost { namespace hof {
+
+struct deadline_exceeded : std::runtime_error
+{
+    deadline_exceeded() : std::runtime_error("The deadline has been exceeded")
+    {}
+};
+
+struct operation_cancelled : std::runtime_error
+{
+    operation_cancelled() : std::runtime_error("The operation has been cancelled")
+    {}
+};
+
+template<class Clock, class Duration>
+struct deadline_token
+{
+    std::chrono::time_point<Clock, Duration> deadline;
+
+    constexpr deadline_token(std::chrono::time_point<Clock, Duration> d)
+    : deadline(d)
+    {}
+
+    bool stop_requested() const
+    {
+        return Clock::now() >= deadline;
+    }
+};
+
+template<class Clock, class Duration>
+constexpr deadline_token<Clock, Duration> make_deadline_token(std::chrono::time_point<Clock, Duration> d)
+{
+    return deadline_token<Clock, Duration>(d);
+}
+
+struct exponential_backoff
+{
+    std::size_t max_attempts;
+    std::chrono::nanoseconds initial;
+    std::chrono::nanoseconds maximum;
+
+    constexpr exponential_backoff(std::size_t n,
+        std::chrono::nanoseconds i=std::chrono::nanoseconds(0),
+        std::chrono::nanoseconds m=std::chrono::seconds(1))
+    : max_attempts(n), initial(i), maximum(m)
+    {}
+
+    std::size_t attempts() const noexcept
+    {
+        return max_attempts;
+    }
+
+    std::chrono::nanoseconds delay(std::size_t retry) const noexcept
+    {
+        std::chrono::nanoseconds d = initial;
+        for (std::size_t i = 1; i < retry && d < maximum; i++) d *= 2;
+        return d < maximum ? d : maximum;
+    }
+};
+
+namespace detail {
+
+struct retry_f
+{
+    template<class Policy, class F, class... Ts>
+    auto operator()(const Policy& p, const F& f, Ts&&... xs) const
+    -> decltype(f(xs...))
+    {
+        for (std::size_t i = 1;; i++)
+        {
+            try
+            {
+                return f(xs...);
+            }
+            catch(const deadline_exceeded&)
+            {
+                throw;
+            }
+            catch(const operation_cancelled&)
+            {
+                throw;
+            }
+            catch(...)
+            {
+                if (i >= p.attempts()) throw;
+            }
+            // Sleep outside of the handler, so the exception is released first
+            std::this_thread::sleep_for(p.delay(i));
+        }
+    }
+};
+
+struct with_deadline_f
+{
+    template<class Clock, class Duration, class F, class... Ts>
+    auto operator()(const std::chrono::time_point<Clock, Duration>& d, const F& f, Ts&&... xs) const
+    -> decltype(f(BOOST_HOF_FORWARD(Ts)(xs)...))
+    {
+        if (Clock::now() >= d) throw deadline_exceeded();
+        return f(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+struct with_stop_token_f
+{
+    template<class StopToken, class F, class... Ts>
+    auto operator()(const StopToken& t, const F& f, Ts&&... xs) const
+    -> decltype(f(BOOST_HOF_FORWARD(Ts)(xs)...))
+    {
+        if (t.stop_requested()) throw operation_cancelled();
+        return f(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(retry, decorate_adaptor<detail::retry_f>);
+BOOST_HOF_DECLARE_STATIC_VAR(with_deadline, decorate_adaptor<detail::with_deadline_f>);
+BOOST_HOF_DECLARE_STATIC_VAR(with_stop_token, decorate_adaptor<detail::with_stop_token_f>);
+
+}} // namespace boost::hof
+
+#endif
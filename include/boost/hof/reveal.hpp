@@ -21,6 +21,12 @@
 /// error inside the function. The `reveal` adaptor will expose these error
 /// messages while still keeping the function SFINAE-friendly.
 /// 
+/// The functions defined with [`BOOST_HOF_STATIC_FUNCTION`](function) and
+/// [`BOOST_HOF_STATIC_LAMBDA_FUNCTION`](lambda) are revealed by default.
+/// Defining `BOOST_HOF_REVEAL_STATIC_FUNCTIONS` to 0 leaves them
+/// unwrapped, which compiles faster, and then `reveal` can still be applied
+/// to the functions whose errors need to be shown.
+/// 
 /// Sample
 /// ------
 /// 
@@ -265,7 +271,7 @@ template<class F, class Failure>
 struct reveal_failure
 {
     // Add default constructor to make clang 3.4 happy
-    constexpr reveal_failure()
+    BOOST_HOF_HOST_DEVICE constexpr reveal_failure()
     {}
     // This is just a placeholder to produce a note in the compiler, it is
     // never called
@@ -273,7 +279,7 @@ struct reveal_failure
         class... Ts, 
         class=typename std::enable_if<(!is_invocable<F, Ts...>::value)>::type
     >
-    constexpr auto operator()(Ts&&... xs) const
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const
 #if BOOST_HOF_REVEAL_USE_TEMPLATE_ALIAS
         -> typename apply_failure<Failure, Ts...>::template apply<boost::hof::detail::identity_failure>;
 #else
@@ -285,7 +291,7 @@ template<class F, class Failure=get_failure<F>, class=void>
 struct traverse_failure 
 : reveal_failure<F, Failure>
 {
-    constexpr traverse_failure()
+    BOOST_HOF_HOST_DEVICE constexpr traverse_failure()
     {}
 };
 
@@ -295,7 +301,7 @@ struct traverse_failure<F, Failure, typename holder<
 >::type> 
 : Failure::children::template overloads<F>
 {
-    constexpr traverse_failure()
+    BOOST_HOF_HOST_DEVICE constexpr traverse_failure()
     {}
 };
 
@@ -332,7 +338,7 @@ struct failures
     struct overloads
     : detail::traverse_failure<F, Failure>, FailureBase::template overloads<F>
     {
-        constexpr overloads()
+        BOOST_HOF_HOST_DEVICE constexpr overloads()
         {}
         using detail::traverse_failure<F, Failure>::operator();
         using FailureBase::template overloads<F>::operator();
@@ -378,6 +384,24 @@ struct reveal_adaptor<reveal_adaptor<F>>
     BOOST_HOF_INHERIT_CONSTRUCTOR(reveal_adaptor, reveal_adaptor<F>);
 };
 
+namespace detail {
+
+// The static functions are revealed unless BOOST_HOF_REVEAL_STATIC_FUNCTIONS
+// is 0, since the failures of each function are instantiated with it
+template<class F>
+struct reveal_static
+{
+#if BOOST_HOF_REVEAL_STATIC_FUNCTIONS
+    typedef reveal_adaptor<F> type;
+#else
+    typedef F type;
+#endif
+};
+
+}
+
+BOOST_HOF_DETAIL_COMPILE_MARKER(reveal, reveal_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(reveal, detail::make<reveal_adaptor>);
 
 }} // namespace boost::hof
@@ -24,6 +24,15 @@
 /// The arguments to the binary function, take first the state and then the
 /// argument.
 /// 
+/// When all of the arguments and the state are unsigned integers of the
+/// same type, and the function is marked with both
+/// [`is_associative`](is_associative) and [`is_commutative`](is_commutative),
+/// such as `_ + _` or `std::plus<>`, the arguments are reduced in a balanced
+/// tree, like [`tree_fold`](tree_fold), since the result doesn't depend on
+/// the order. Signed integers are only reduced in a tree by the bitwise
+/// operators, such as `_ | _`, since a sum or a product can overflow in one
+/// order and not in another.
+/// 
 /// Synopsis
 /// --------
 /// 
@@ -77,6 +86,7 @@
 /// 
 /// * [Projections](Projections)
 /// * [Variadic print](<Variadic print>)
+/// * [is_commutative](is_commutative)
 /// 
 
 #include <boost/hof/detail/callable_base.hpp>
@@ -85,21 +95,43 @@
 #include <boost/hof/detail/move.hpp>
 #include <boost/hof/detail/make.hpp>
 #include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/fold.hpp>
+#include <boost/hof/is_commutative.hpp>
 
 namespace boost { namespace hof { namespace detail {
 
+// The arguments are only reduced in another order than from the right when
+// the function is also commutative
+template<class F, class T, class... Ts>
+struct reverse_fold_reassociates
+: std::integral_constant<bool, (
+    is_commutative<F>::value &&
+    fold_reassociates<F, T, Ts...>::value
+)>
+{};
+
 struct v_reverse_fold
 {
     BOOST_HOF_RETURNS_CLASS(v_reverse_fold);
-    template<class F, class State, class T, class... Ts>
-    constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(const F&, result_of<const v_reverse_fold&, id_<const F&>, id_<State>, id_<Ts>...>, id_<T>)
+    template<class F, class State, class T, class... Ts, typename std::enable_if<(
+        detail::reverse_fold_reassociates<F, State, T, Ts...>::value
+    ), int>::type = 0>
+    BOOST_HOF_INLINE constexpr auto operator()(const F& f, State&& state, T&& x, Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        detail::v_tree_fold()(f, BOOST_HOF_FORWARD(State)(state), BOOST_HOF_FORWARD(T)(x), BOOST_HOF_FORWARD(Ts)(xs)...)
+    );
+
+    template<class F, class State, class T, class... Ts, typename std::enable_if<(
+        !detail::reverse_fold_reassociates<F, State, T, Ts...>::value
+    ), int>::type = 0>
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_MANUAL_RESULT(const F&, result_of<const v_reverse_fold&, id_<const F&>, id_<State>, id_<Ts>...>, id_<T>)
     operator()(const F& f, State&& state, T&& x, Ts&&... xs) const BOOST_HOF_SFINAE_MANUAL_RETURNS
     (
         f((*BOOST_HOF_CONST_THIS)(f, BOOST_HOF_FORWARD(State)(state), BOOST_HOF_FORWARD(Ts)(xs)...), BOOST_HOF_FORWARD(T)(x))
     );
 
     template<class F, class State>
-    constexpr State operator()(const F&, State&& state) const noexcept
+    BOOST_HOF_INLINE constexpr State operator()(const F&, State&& state) const noexcept
     {
         return BOOST_HOF_FORWARD(State)(state);
     }
@@ -115,7 +147,7 @@ struct reverse_fold_adaptor
     BOOST_HOF_INHERIT_CONSTRUCTOR(reverse_fold_adaptor, base_type)
 
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
     {
         return this->first(xs...);
     }
@@ -128,8 +160,8 @@ struct reverse_fold_adaptor
 
     BOOST_HOF_RETURNS_CLASS(reverse_fold_adaptor);
 
-    template<class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(detail::v_reverse_fold, id_<const detail::callable_base<F>&>, id_<State>, id_<Ts>...)
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(reverse_fold, Ts...)>
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(detail::v_reverse_fold, id_<const detail::callable_base<F>&>, id_<State>, id_<Ts>...)
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         detail::v_reverse_fold()(
@@ -148,15 +180,15 @@ struct reverse_fold_adaptor<F, void>
     BOOST_HOF_INHERIT_CONSTRUCTOR(reverse_fold_adaptor, detail::callable_base<F>)
 
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     BOOST_HOF_RETURNS_CLASS(reverse_fold_adaptor);
 
-    template<class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(detail::v_reverse_fold, id_<const detail::callable_base<F>&>, id_<Ts>...)
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(reverse_fold, Ts...)>
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(detail::v_reverse_fold, id_<const detail::callable_base<F>&>, id_<Ts>...)
     operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         detail::v_reverse_fold()(
@@ -166,6 +198,8 @@ struct reverse_fold_adaptor<F, void>
     )
 };
 
+BOOST_HOF_DETAIL_COMPILE_MARKER(reverse_fold, reverse_fold_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(reverse_fold, detail::make<reverse_fold_adaptor>);
 
 }} // namespace boost::hof
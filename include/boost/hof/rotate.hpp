@@ -62,9 +62,9 @@ struct rotate_adaptor : detail::callable_base<F>
     BOOST_HOF_INHERIT_CONSTRUCTOR(rotate_adaptor, detail::callable_base<F>);
 
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     struct rotate_failure
@@ -85,8 +85,8 @@ struct rotate_adaptor : detail::callable_base<F>
 
     BOOST_HOF_RETURNS_CLASS(rotate_adaptor);
 
-    template<class T, class... Ts>
-    constexpr BOOST_HOF_SFINAE_RESULT(const detail::callable_base<F>&, id_<Ts>..., id_<T>) 
+    template<class T, class... Ts BOOST_HOF_DETAIL_CALL_MARKER(rotate, T, Ts...)>
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(const detail::callable_base<F>&, id_<Ts>..., id_<T>) 
     operator()(T&& x, Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
     (
         (BOOST_HOF_MANGLE_CAST(const detail::callable_base<F>&)(BOOST_HOF_CONST_THIS->base_function(xs...)))
@@ -94,6 +94,8 @@ struct rotate_adaptor : detail::callable_base<F>
     );
 };
 
+BOOST_HOF_DETAIL_COMPILE_MARKER(rotate, rotate_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(rotate, detail::make<rotate_adaptor>);
 
 }} // namespace boost::hof
@@ -0,0 +1,127 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    select.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_SELECT_H
+#define BOOST_HOF_GUARD_SELECT_H
+
+/// select
+/// ======
+///
+/// Description
+/// -----------
+///
+/// The `select` function adaptor calls the function with only the arguments
+/// at the zero-based indices, in the order of the indices. An index can
+/// appear more than once, or not at all, so the arguments can be duplicated
+/// or dropped. The arguments are selected in one expansion, so
+/// `select<2, 0, 1>(f)` is like `lazy(f)(_3, _1, _2)` without evaluating a
+/// placeholder for each argument.
+///
+/// An argument that is selected once is forwarded, while an argument that is
+/// selected more than once is passed as an lvalue, so it is not moved from
+/// twice.
+///
+/// Synopsis
+/// --------
+///
+///     template<std::size_t... Is, class F>
+///     constexpr select_adaptor<F, Is...> select(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(select<Is...>(f)(xs...) == f(arg_c<Is+1>(xs...)...));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int main() {
+///         auto f = [](int x, int y, int z) { return x*100 + y*10 + z; };
+///         assert(boost::hof::select<2, 2, 0>(f)(1, 2, 3) == 331);
+///     }
+///
+
+#include <boost/hof/arg.hpp>
+#include <boost/hof/always.hpp>
+#include <boost/hof/detail/and.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/index_count.hpp>
+#include <boost/hof/detail/move.hpp>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<std::size_t I, bool Forward>
+struct select_arg
+{
+    template<class... Ts>
+    static constexpr auto get(Ts&&... xs) BOOST_HOF_RETURNS
+    (
+        boost::hof::detail::get_args<I+1>(BOOST_HOF_FORWARD(Ts)(xs)...)
+    );
+};
+
+// The argument is used more than once, so it is passed as an lvalue
+template<std::size_t I>
+struct select_arg<I, false>
+{
+    template<class... Ts>
+    static constexpr auto get(Ts&&... xs) BOOST_HOF_RETURNS
+    (
+        boost::hof::detail::get_args<I+1>(xs...)
+    );
+};
+
+}
+
+template<class F, std::size_t... Is>
+struct select_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(select_adaptor, detail::callable_base<F>);
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    BOOST_HOF_RETURNS_CLASS(select_adaptor);
+
+    template<class... Ts, class=typename std::enable_if<
+        BOOST_HOF_AND_UNPACK((Is < sizeof...(Ts)))
+    >::type>
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        (BOOST_HOF_MANGLE_CAST(const detail::callable_base<F>&)(BOOST_HOF_CONST_THIS->base_function(xs...)))
+        (
+            boost::hof::detail::select_arg<Is, (boost::hof::detail::index_count<Is, Is...>::value == 1)>::get(BOOST_HOF_FORWARD(Ts)(xs)...)...
+        )
+    );
+};
+
+template<std::size_t... Is, class F>
+constexpr select_adaptor<F, Is...> select(F f)
+BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(select_adaptor<F, Is...>, F&&)
+{
+    return select_adaptor<F, Is...>(boost::hof::move(f));
+}
+
+}} // namespace boost::hof
+
+#endif
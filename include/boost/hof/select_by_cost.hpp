@@ -0,0 +1,203 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    select_by_cost.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_SELECT_BY_COST_H
+#define BOOST_HOF_GUARD_SELECT_BY_COST_H
+
+/// select_by_cost
+/// ==============
+///
+/// Description
+/// -----------
+///
+/// The `select_by_cost` function adaptor combines several functions, like
+/// [`first_of`](first_of), except it calls the function with the lowest
+/// cost among the functions that can be called with the arguments, instead
+/// of the first one. When several functions have the lowest cost, the first
+/// of them is called.
+///
+/// The cost of a function is given by the `function_cost` trait, which is
+/// the `cost` static member of the function object, such as
+/// `static constexpr int cost = 2;`, or 0 when it has none. A function
+/// adapted by [`if_`](if) keeps the cost of the function. The trait is also
+/// given the types of the arguments, so it can be specialized for a cost that
+/// depends on the arguments.
+///
+/// The function is chosen at compile time, so the call has no branch. The
+/// functions can be constrained on the arguments, such as on the size of an
+/// array, so that a cheaper algorithm is only called where it applies.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Fs>
+///     constexpr select_by_cost_adaptor<Fs...> select_by_cost(Fs... fs);
+///
+///     template<class F, class... Ts>
+///     struct function_cost;
+///
+/// Semantics
+/// ---------
+///
+///     assert(select_by_cost(fs...)(xs...) == f(xs...));
+///     // where f is the first of the invocable fs with the lowest function_cost
+///
+/// Requirements
+/// ------------
+///
+/// Fs must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <array>
+///     #include <cassert>
+///     #include <type_traits>
+///
+///     struct insertion_sort
+///     {
+///         static constexpr int cost = 1;
+///         template<class T, std::size_t N, class=typename std::enable_if<(N <= 16)>::type>
+///         int operator()(const std::array<T, N>&) const
+///         {
+///             return 1;
+///         }
+///     };
+///
+///     struct radix_sort
+///     {
+///         static constexpr int cost = 4;
+///         template<class T, std::size_t N>
+///         int operator()(const std::array<T, N>&) const
+///         {
+///             return 2;
+///         }
+///     };
+///
+///     int main() {
+///         auto sort = boost::hof::select_by_cost(radix_sort(), insertion_sort());
+///         assert(sort(std::array<int, 4>()) == 1);
+///         assert(sort(std::array<int, 64>()) == 2);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [first_of](first_of)
+/// * [if_](if)
+///
+
+#include <boost/hof/is_invocable.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/holder.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/detail/type_at.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class F, class=void>
+struct function_cost_member
+: std::integral_constant<long long, 0>
+{};
+
+template<class F>
+struct function_cost_member<F, typename holder<decltype(F::cost)>::type>
+: std::integral_constant<long long, F::cost>
+{};
+
+}
+
+template<class F, class... Ts>
+struct function_cost
+: detail::function_cost_member<F>
+{};
+
+namespace detail {
+
+template<bool Invocable, long long Cost>
+struct select_by_cost_candidate
+{
+    static constexpr bool invocable = Invocable;
+    static constexpr long long cost = Cost;
+};
+
+// The index of the first candidate with the lowest cost, or the number of
+// candidates when none can be called
+template<std::size_t I, std::size_t Best, long long BestCost, class... Cs>
+struct select_by_cost_min
+: std::integral_constant<std::size_t, Best>
+{};
+
+template<std::size_t I, std::size_t Best, long long BestCost, class C, class... Cs>
+struct select_by_cost_min<I, Best, BestCost, C, Cs...>
+: std::conditional<(C::invocable && (Best == I + 1 + sizeof...(Cs) || C::cost < BestCost)),
+    select_by_cost_min<I + 1, I, C::cost, Cs...>,
+    select_by_cost_min<I + 1, Best, BestCost, Cs...>
+>::type
+{};
+
+template<class S, class... Fs>
+struct select_by_cost_adaptor_base;
+
+template<std::size_t... Ns, class... Fs>
+struct select_by_cost_adaptor_base<seq<Ns...>, Fs...>
+: pack_base<seq<Ns...>, callable_base<Fs>...>
+{
+    typedef pack_base<seq<Ns...>, callable_base<Fs>...> base_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(select_by_cost_adaptor_base, base_type)
+
+    template<class... Ts>
+    struct select
+    : select_by_cost_min<0, sizeof...(Fs), 0, select_by_cost_candidate<
+        is_invocable<const callable_base<Fs>&, Ts...>::value,
+        function_cost<Fs, Ts...>::value
+    >...>
+    {};
+
+    template<std::size_t I, class... Ts>
+    constexpr const callable_base<typename type_at<I, Fs...>::type>& get(Ts&&... xs) const noexcept
+    {
+        return boost::hof::alias_value<pack_tag<seq<I>, callable_base<Fs>...>, callable_base<typename type_at<I, Fs...>::type>>(*this, xs...);
+    }
+
+    template<class... Ts, std::size_t I=select<Ts...>::value,
+        class=typename std::enable_if<(I < sizeof...(Fs))>::type>
+    constexpr auto operator()(Ts&&... xs) const
+    -> decltype(std::declval<const callable_base<typename type_at<I, Fs...>::type>&>()(BOOST_HOF_FORWARD(Ts)(xs)...))
+    {
+        return this->template get<I>(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+}
+
+template<class... Fs>
+struct select_by_cost_adaptor
+: detail::select_by_cost_adaptor_base<typename detail::gens<sizeof...(Fs)>::type, Fs...>
+{
+    typedef detail::select_by_cost_adaptor_base<typename detail::gens<sizeof...(Fs)>::type, Fs...> base_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(select_by_cost_adaptor, base_type)
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(select_by_cost, detail::make<select_by_cost_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,274 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    serialize.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_SERIALIZE_H
+#define BOOST_HOF_GUARD_SERIALIZE_H
+
+/// serialize_into
+/// ==============
+///
+/// Description
+/// -----------
+///
+/// The `serialize_into` function returns a function that writes its
+/// arguments to the front of a buffer, one after the other, each one
+/// encoded as little endian with the width of its type. The `deserialize_from`
+/// function returns a function that reads the arguments back, in the same
+/// order, by assigning to them. Both functions return the number of bytes
+/// that were written or read.
+///
+/// The offset of each argument is computed at compile time, and the size of
+/// the buffer is checked once for all of them, so `std::out_of_range` is
+/// thrown before anything is written or read if the buffer is too small.
+/// On little endian targets the encoding is the object representation, so
+/// each argument is copied with `std::memcpy`, which the compiler can merge
+/// for the consecutive arguments.
+///
+/// These are used with [`unpack`](unpack) to serialize the fields of a
+/// message, such as an aggregate, which is unpacked by its fields in C++17.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Buffer>
+///     serializer<Buffer> serialize_into(Buffer&& b);
+///
+///     template<class Buffer>
+///     deserializer<Buffer> deserialize_from(Buffer&& b);
+///
+/// Requirements
+/// ------------
+///
+/// Buffer must have:
+///
+/// * A `data()` member function that returns a pointer to a byte type, such
+///   as `unsigned char` or `std::byte`
+/// * A `size()` member function that returns the number of bytes
+///
+/// The arguments must be arithmetic types or enums, that are 1, 2, 4 or 8
+/// bytes wide. A `bool` is encoded as one byte that is 0 or 1.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <array>
+///     #include <cassert>
+///     #include <cstdint>
+///
+///     struct header
+///     {
+///         std::uint16_t kind;
+///         std::uint32_t length;
+///     };
+///
+///     int main() {
+///         std::array<unsigned char, 6> buffer;
+///         header h = { 1, 2 };
+///         std::size_t n = boost::hof::unpack(boost::hof::serialize_into(buffer))(h);
+///         assert(n == 6);
+///         assert(buffer[0] == 1 && buffer[2] == 2);
+///         header r = {};
+///         boost::hof::unpack(boost::hof::deserialize_from(buffer))(r);
+///         assert(r.kind == 1 && r.length == 2);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [unpack](unpack)
+/// * [unpack_sequence](unpack_sequence)
+///
+
+#include <boost/hof/detail/and.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+#define BOOST_HOF_DETAIL_LITTLE_ENDIAN (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#elif defined(_MSC_VER)
+#define BOOST_HOF_DETAIL_LITTLE_ENDIAN 1
+#else
+#define BOOST_HOF_DETAIL_LITTLE_ENDIAN 0
+#endif
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<std::size_t N>
+struct serial_word;
+
+template<>
+struct serial_word<1>
+{ typedef std::uint8_t type; };
+
+template<>
+struct serial_word<2>
+{ typedef std::uint16_t type; };
+
+template<>
+struct serial_word<4>
+{ typedef std::uint32_t type; };
+
+template<>
+struct serial_word<8>
+{ typedef std::uint64_t type; };
+
+template<class T, class=void>
+struct is_serializable
+: std::false_type
+{};
+
+template<class T>
+struct is_serializable<T, typename std::enable_if<(
+    (std::is_arithmetic<T>::value || std::is_enum<T>::value) &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+)>::type>
+: std::true_type
+{};
+
+constexpr std::size_t serial_offset(std::size_t)
+{
+    return 0;
+}
+
+template<class... Ts>
+constexpr std::size_t serial_offset(std::size_t i, std::size_t n, Ts... ns)
+{
+    return i == 0 ? 0 : n + serial_offset(i - 1, ns...);
+}
+
+template<class T>
+void serial_store(unsigned char* p, const T& x) noexcept
+{
+#if BOOST_HOF_DETAIL_LITTLE_ENDIAN
+    std::memcpy(p, &x, sizeof(T));
+#else
+    typename serial_word<sizeof(T)>::type w;
+    std::memcpy(&w, &x, sizeof(T));
+    for (std::size_t i = 0; i < sizeof(T); i++) p[i] = static_cast<unsigned char>(w >> (8 * i));
+#endif
+}
+
+inline void serial_store(unsigned char* p, bool x) noexcept
+{
+    *p = x ? 1 : 0;
+}
+
+template<class T>
+void serial_load(const unsigned char* p, T& x) noexcept
+{
+#if BOOST_HOF_DETAIL_LITTLE_ENDIAN
+    std::memcpy(&x, p, sizeof(T));
+#else
+    typedef typename serial_word<sizeof(T)>::type word;
+    word w = 0;
+    for (std::size_t i = 0; i < sizeof(T); i++) w |= static_cast<word>(static_cast<word>(p[i]) << (8 * i));
+    std::memcpy(&x, &w, sizeof(T));
+#endif
+}
+
+inline void serial_load(const unsigned char* p, bool& x) noexcept
+{
+    x = *p != 0;
+}
+
+template<class Buffer>
+std::size_t serial_check(const Buffer& b, std::size_t n)
+{
+    if (static_cast<std::size_t>(b.size()) < n) throw std::out_of_range("serialize: the buffer is too small");
+    return n;
+}
+
+template<class... Ts, std::size_t... Ns>
+std::size_t serialize_fields(seq<Ns...>, unsigned char* p, const Ts&... xs) noexcept
+{
+    (void)std::initializer_list<int>{(detail::serial_store(p + std::integral_constant<std::size_t,
+        detail::serial_offset(Ns, sizeof(Ts)...)
+    >::value, xs), 0)...};
+    return detail::serial_offset(sizeof...(Ts), sizeof(Ts)...);
+}
+
+template<class... Ts, std::size_t... Ns>
+std::size_t deserialize_fields(seq<Ns...>, const unsigned char* p, Ts&... xs) noexcept
+{
+    (void)std::initializer_list<int>{(detail::serial_load(p + std::integral_constant<std::size_t,
+        detail::serial_offset(Ns, sizeof(Ts)...)
+    >::value, xs), 0)...};
+    return detail::serial_offset(sizeof...(Ts), sizeof(Ts)...);
+}
+
+}
+
+template<class Buffer>
+struct serializer
+{
+    Buffer buffer;
+
+    template<class... Ts, typename std::enable_if<(
+        BOOST_HOF_AND_UNPACK(detail::is_serializable<Ts>::value)
+    ), int>::type = 0>
+    std::size_t operator()(const Ts&... xs) const
+    {
+        detail::serial_check(buffer, detail::serial_offset(sizeof...(Ts), sizeof(Ts)...));
+        return detail::serialize_fields(typename detail::gens<sizeof...(Ts)>::type(),
+            static_cast<unsigned char*>(static_cast<void*>(buffer.data())), xs...);
+    }
+};
+
+template<class Buffer>
+struct deserializer
+{
+    Buffer buffer;
+
+    template<class... Ts, typename std::enable_if<(
+        BOOST_HOF_AND_UNPACK(detail::is_serializable<Ts>::value && !std::is_const<Ts>::value)
+    ), int>::type = 0>
+    std::size_t operator()(Ts&... xs) const
+    {
+        detail::serial_check(buffer, detail::serial_offset(sizeof...(Ts), sizeof(Ts)...));
+        return detail::deserialize_fields(typename detail::gens<sizeof...(Ts)>::type(),
+            static_cast<const unsigned char*>(static_cast<const void*>(buffer.data())), xs...);
+    }
+};
+
+namespace detail {
+
+struct serialize_into_f
+{
+    template<class Buffer>
+    serializer<Buffer> operator()(Buffer&& b) const
+    {
+        return serializer<Buffer>{BOOST_HOF_FORWARD(Buffer)(b)};
+    }
+};
+
+struct deserialize_from_f
+{
+    template<class Buffer>
+    deserializer<Buffer> operator()(Buffer&& b) const
+    {
+        return deserializer<Buffer>{BOOST_HOF_FORWARD(Buffer)(b)};
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(serialize_into, detail::serialize_into_f);
+BOOST_HOF_DECLARE_STATIC_VAR(deserialize_from, detail::deserialize_from_f);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,226 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    signal.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_SIGNAL_H
+#define BOOST_HOF_GUARD_SIGNAL_H
+
+/// signal
+/// ======
+///
+/// Description
+/// -----------
+///
+/// The `signal` class holds functions that are all called with the same
+/// arguments when the signal is called, like a list of `std::function`
+/// subscribers, and the results of the functions are discarded. The
+/// functions that are connected are stored by their type: each type gets a
+/// bucket, where the functions of that type are kept contiguously in a
+/// `std::vector`. So calling the signal makes one virtual call for each
+/// bucket, and the functions in a bucket are called in a loop that knows
+/// their type, instead of chasing a pointer and making an indirect call for
+/// each function.
+///
+/// The functions in a bucket are called in the order they are connected,
+/// and the buckets are called in the order their first function was
+/// connected, so functions of different types aren't called in the order
+/// they are connected. The arguments are passed to each function as
+/// lvalues, so they are never moved. A function must not be connected while
+/// the signal is being called.
+///
+/// Synopsis
+/// --------
+///
+///     template<class R, class... Ts>
+///     class signal<R(Ts...)>
+///     {
+///         template<class F>
+///         void connect(F f);
+///
+///         void operator()(Ts... xs) const;
+///
+///         std::size_t size() const;
+///
+///         bool empty() const;
+///
+///         void clear();
+///     };
+///
+/// Semantics
+/// ---------
+///
+///     s.connect(f);
+///     s.connect(g);
+///     s(xs...);
+///     // calls
+///     f(xs...);
+///     g(xs...);
+///
+/// Requirements
+/// ------------
+///
+/// The functions that are connected must be:
+///
+/// * [ConstInvocable](ConstInvocable) with lvalues of `Ts...`
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct add
+///     {
+///         int* total;
+///         void operator()(int x) const
+///         {
+///             *total += x;
+///         }
+///     };
+///
+///     int main() {
+///         int total = 0;
+///         boost::hof::signal<void(int)> s;
+///         s.connect(add{&total});
+///         s.connect(add{&total});
+///         s.connect([&](int x) { total += 10 * x; });
+///         s(2);
+///         assert(total == 24);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [function_ref](function_ref)
+/// * [inplace_function](inplace_function)
+///
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+inline std::size_t signal_next_id() noexcept
+{
+    static std::atomic<std::size_t> id(0);
+    return id++;
+}
+
+template<class F>
+struct signal_id
+{
+    static std::size_t get() noexcept
+    {
+        static const std::size_t id = signal_next_id();
+        return id;
+    }
+};
+
+template<class... Ts>
+struct signal_bucket_base
+{
+    std::size_t id;
+
+    signal_bucket_base(std::size_t i) : id(i)
+    {}
+
+    virtual void call(typename std::add_lvalue_reference<Ts>::type... xs) const=0;
+
+    virtual std::size_t size() const noexcept=0;
+
+    virtual ~signal_bucket_base()
+    {}
+};
+
+template<class F, class... Ts>
+struct signal_bucket : signal_bucket_base<Ts...>
+{
+    std::vector<F> slots;
+
+    signal_bucket() : signal_bucket_base<Ts...>(signal_id<F>::get())
+    {}
+
+    // The type of each function is known here, so each call can be inlined
+    virtual void call(typename std::add_lvalue_reference<Ts>::type... xs) const
+    {
+        for (const F& f : slots) f(xs...);
+    }
+
+    virtual std::size_t size() const noexcept
+    {
+        return slots.size();
+    }
+};
+
+}
+
+template<class Sig>
+class signal;
+
+template<class R, class... Ts>
+class signal<R(Ts...)>
+{
+    typedef detail::signal_bucket_base<Ts...> bucket_base;
+    std::vector<std::unique_ptr<bucket_base>> buckets;
+
+    template<class F>
+    detail::signal_bucket<F, Ts...>& bucket()
+    {
+        std::size_t id = detail::signal_id<F>::get();
+        for (const auto& b : buckets)
+        {
+            if (b->id == id) return static_cast<detail::signal_bucket<F, Ts...>&>(*b);
+        }
+        buckets.emplace_back(new detail::signal_bucket<F, Ts...>());
+        return static_cast<detail::signal_bucket<F, Ts...>&>(*buckets.back());
+    }
+
+public:
+    signal()
+    {}
+
+    signal(signal&&)=default;
+    signal& operator=(signal&&)=default;
+
+    template<class F>
+    void connect(F f)
+    {
+        this->template bucket<F>().slots.push_back(std::move(f));
+    }
+
+    void operator()(Ts... xs) const
+    {
+        for (const auto& b : buckets) b->call(xs...);
+    }
+
+    std::size_t size() const noexcept
+    {
+        std::size_t n = 0;
+        for (const auto& b : buckets) n += b->size();
+        return n;
+    }
+
+    bool empty() const noexcept
+    {
+        return this->size() == 0;
+    }
+
+    void clear() noexcept
+    {
+        buckets.clear();
+    }
+};
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,248 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    state_machine.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_STATE_MACHINE_H
+#define BOOST_HOF_GUARD_STATE_MACHINE_H
+
+/// state_machine
+/// =============
+///
+/// Description
+/// -----------
+///
+/// The `state_machine` function adaptor takes the transitions of a state
+/// machine, as overloads that take a state and an event and return the next
+/// state, and returns a function that takes a `std::variant` of the states
+/// and an event, and returns the next state as the same variant. The event
+/// can be a `std::variant` of the events, or a single event.
+///
+/// The transitions are overloaded with [`match`](match), and the overload
+/// for each pair of a state and an event is resolved at compile time into a
+/// two dimensional `constexpr` table of function pointers, with a row for
+/// each state and a column for each event. So a transition is one lookup of
+/// the table with the indices of the state and the event, instead of a
+/// visit of each variant. A pair that has no transition leaves the state as
+/// it is.
+///
+/// This is only available when `BOOST_HOF_HAS_STD_VARIANT` is enabled.
+///
+/// Synopsis
+/// --------
+///
+///     template<class... Fs>
+///     constexpr state_machine_adaptor<match_adaptor<Fs...>> state_machine(Fs... fs);
+///
+/// Semantics
+/// ---------
+///
+///     assert(state_machine(fs...)(state, event) == std::decay_t<decltype(state)>(match(fs...)(std::get<state.index()>(state), std::get<event.index()>(event))));
+///
+/// Requirements
+/// ------------
+///
+/// Fs must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// The state must be a `std::variant`, and the result of each transition
+/// must be convertible to it. If the state or the event is valueless by
+/// exception, then `std::bad_variant_access` is thrown.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <variant>
+///
+///     struct idle {};
+///     struct running {};
+///     struct start {};
+///     struct stop {};
+///
+///     int main() {
+///         auto door = boost::hof::state_machine(
+///             [](idle, start) { return running{}; },
+///             [](running, stop) { return idle{}; }
+///         );
+///         std::variant<idle, running> s = idle{};
+///         s = door(s, std::variant<start, stop>(start{}));
+///         assert(s.index() == 1);
+///         s = door(s, start{});
+///         assert(s.index() == 1);
+///         s = door(s, stop{});
+///         assert(s.index() == 0);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [match](match)
+/// * [visit](visit)
+/// * [dispatch_index](dispatch_index)
+///
+
+#include <boost/hof/config.hpp>
+
+#if BOOST_HOF_HAS_STD_VARIANT
+
+#include <boost/hof/always.hpp>
+#include <boost/hof/match.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <variant>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+// An event that isn't a variant is the only column of the table
+template<class E>
+struct state_machine_events
+{
+    static constexpr std::size_t size = 1;
+
+    template<std::size_t J, class T>
+    static constexpr T&& get(T&& e) noexcept
+    {
+        return BOOST_HOF_FORWARD(T)(e);
+    }
+
+    static constexpr std::size_t index(const E&) noexcept
+    {
+        return 0;
+    }
+
+    static constexpr bool valueless(const E&) noexcept
+    {
+        return false;
+    }
+};
+
+template<class... Es>
+struct state_machine_events<std::variant<Es...>>
+{
+    static constexpr std::size_t size = sizeof...(Es);
+
+    template<std::size_t J, class T>
+    static constexpr auto get(T&& e) BOOST_HOF_RETURNS
+    (
+        std::get<J>(BOOST_HOF_FORWARD(T)(e))
+    );
+
+    static constexpr std::size_t index(const std::variant<Es...>& e) noexcept
+    {
+        return e.index();
+    }
+
+    static constexpr bool valueless(const std::variant<Es...>& e) noexcept
+    {
+        return e.valueless_by_exception();
+    }
+};
+
+template<class F, class State, class Event, std::size_t I, std::size_t J,
+    class Events=state_machine_events<typename std::decay<Event>::type>,
+    bool Defined=std::is_invocable<const F&,
+        decltype(std::get<I>(std::declval<State>())),
+        decltype(Events::template get<J>(std::declval<Event>()))
+    >::value
+>
+struct state_machine_entry
+{
+    template<class V>
+    static V call(const F& f, State&& s, Event&& e)
+    {
+        return f(std::get<I>(BOOST_HOF_FORWARD(State)(s)), Events::template get<J>(BOOST_HOF_FORWARD(Event)(e)));
+    }
+};
+
+// There is no transition, so the state doesn't change
+template<class F, class State, class Event, std::size_t I, std::size_t J, class Events>
+struct state_machine_entry<F, State, Event, I, J, Events, false>
+{
+    template<class V>
+    static V call(const F&, State&& s, Event&&)
+    {
+        return BOOST_HOF_FORWARD(State)(s);
+    }
+};
+
+template<class F, class State, class Event>
+struct state_machine_table
+{
+    typedef typename std::decay<State>::type result_type;
+    typedef state_machine_events<typename std::decay<Event>::type> events_type;
+    typedef result_type (*entry_type)(const F&, State&&, Event&&);
+    static constexpr std::size_t states = std::variant_size<result_type>::value;
+    static constexpr std::size_t events = events_type::size;
+    typedef std::array<std::array<entry_type, events>, states> table_type;
+
+    template<std::size_t I, std::size_t... Js>
+    static constexpr std::array<entry_type, events> row(seq<Js...>) noexcept
+    {
+        return {{ &state_machine_entry<F, State, Event, I, Js>::template call<result_type>... }};
+    }
+
+    template<std::size_t... Is>
+    static constexpr table_type make(seq<Is...>) noexcept
+    {
+        return {{ state_machine_table::row<Is>(typename gens<events>::type())... }};
+    }
+
+    static constexpr table_type table = state_machine_table::make(typename gens<states>::type());
+};
+
+}
+
+template<class F>
+struct state_machine_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(state_machine_adaptor, detail::callable_base<F>)
+
+    template<class... Ts>
+    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class State, class Event, class Table=detail::state_machine_table<detail::callable_base<F>, State, Event>>
+    typename Table::result_type operator()(State&& s, Event&& e) const
+    {
+        typedef typename Table::events_type events_type;
+        if (s.valueless_by_exception() || events_type::valueless(e)) throw std::bad_variant_access();
+        return Table::table[s.index()][events_type::index(e)](this->base_function(s), BOOST_HOF_FORWARD(State)(s), BOOST_HOF_FORWARD(Event)(e));
+    }
+};
+
+namespace detail {
+
+struct state_machine_f
+{
+    template<class... Fs>
+    constexpr state_machine_adaptor<match_adaptor<Fs...>> operator()(Fs... fs) const
+    {
+        return state_machine_adaptor<match_adaptor<Fs...>>(match_adaptor<Fs...>(static_cast<Fs&&>(fs)...));
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(state_machine, detail::state_machine_f);
+
+}} // namespace boost::hof
+
+#endif
+
+#endif
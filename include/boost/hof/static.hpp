@@ -21,6 +21,11 @@
 /// context, then a `constexpr` constructor needs to be used rather than
 /// `static_`.
 /// 
+/// When the function can be default constructed at compile time, it is stored
+/// as a constant, so calling it needs no guard and no dynamic initializer.
+/// Otherwise, it is constructed on the first call. Setting
+/// `BOOST_HOF_REQUIRE_CONSTANT_INIT` to 1 makes that case an error.
+/// 
 /// Synopsis
 /// --------
 /// 
@@ -64,10 +69,36 @@
 /// 
 
 #include <boost/hof/detail/result_of.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
 #include <boost/hof/reveal.hpp>
 
 namespace boost { namespace hof { 
 
+namespace detail {
+
+template<class F, class=void>
+struct static_storage
+{
+    BOOST_HOF_INLINE static const F& get() BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(F)
+    {
+        static_assert(!BOOST_HOF_REQUIRE_CONSTANT_INIT || is_constant_default_constructible<F>::value, 
+            "The static function can't be default constructed at compile time, so it needs dynamic initialization");
+        static F f;
+        return f;
+    }
+};
+
+template<class F>
+struct static_storage<F, typename std::enable_if<is_constant_default_constructible<F>::value>::type>
+{
+    BOOST_HOF_INLINE static constexpr const F& get() noexcept
+    {
+        return static_const_storage<F>::value;
+    }
+};
+
+}
+
 template<class F>
 struct static_
 {
@@ -76,17 +107,16 @@ struct static_
     : failure_for<F>
     {};
 
-    const F& base_function() const
+    BOOST_HOF_INLINE const F& base_function() const
     BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(F)
     {
-        static F f;
-        return f;
+        return detail::static_storage<F>::get();
     }
 
     BOOST_HOF_RETURNS_CLASS(static_);
 
     template<class... Ts>
-    BOOST_HOF_SFINAE_RESULT(F, id_<Ts>...) 
+    BOOST_HOF_INLINE BOOST_HOF_SFINAE_RESULT(F, id_<Ts>...) 
     operator()(Ts && ... xs) const
     BOOST_HOF_SFINAE_RETURNS(BOOST_HOF_CONST_THIS->base_function()(BOOST_HOF_FORWARD(Ts)(xs)...));
 };
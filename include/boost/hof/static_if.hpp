@@ -0,0 +1,214 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    static_if.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_STATIC_IF_H
+#define BOOST_HOF_GUARD_STATIC_IF_H
+
+/// static_if
+/// =========
+///
+/// Description
+/// -----------
+///
+/// The `static_if` function decorator takes a condition, and then two
+/// functions, and returns a function that calls the first function when the
+/// condition is true, and the second function otherwise. Only the type of
+/// the chosen function is used to constrain the call, and only its call
+/// operator is instantiated, so the other function can be ill-formed for the
+/// arguments. On C++17, the branch is selected with `if constexpr`, otherwise
+/// it is selected by specialization, so neither way needs overload
+/// resolution between the two functions like [`if_`](if) and
+/// [`first_of`](first_of) do.
+///
+/// Since the functions are only called when the returned function is, a
+/// generic lambda that takes the [`identity`](identity) function can be
+/// passed to [`eval`](eval) to delay the lookup in its body, so that a
+/// branch that doesn't compile for the types is never instantiated.
+///
+/// Synopsis
+/// --------
+///
+///     template<class IntegralConstant>
+///     constexpr auto static_if(IntegralConstant);
+///
+///     // Returns a function like `g` that calls `f` when the condition is true
+///     template<class IntegralConstant, class F, class G>
+///     constexpr auto static_if(IntegralConstant)(F f)(G g);
+///
+/// Semantics
+/// ---------
+///
+///     assert(static_if(std::true_type())(f)(g)(xs...) == f(xs...));
+///     assert(static_if(std::false_type())(f)(g)(xs...) == g(xs...));
+///
+/// Requirements
+/// ------------
+///
+/// IntegralConstant must be:
+///
+/// * IntegralConstant
+///
+/// F and G must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <string>
+///
+///     template<class T>
+///     void decrement_kindof(T& value)
+///     {
+///         boost::hof::eval(boost::hof::static_if(std::is_same<std::string, T>())(
+///             [&](auto id) { id(value).pop_back(); }
+///         )(
+///             [&](auto id) { --id(value); }
+///         ));
+///     }
+///
+///     int main() {
+///         std::string s = "hello!";
+///         decrement_kindof(s);
+///         assert(s == "hello");
+///         int i = 4;
+///         decrement_kindof(i);
+///         assert(i == 3);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [if_](if)
+/// * [eval](eval)
+/// * [static_if](static_if) from the examples
+///
+
+#include <boost/hof/always.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+#if !BOOST_HOF_HAS_IF_CONSTEXPR
+template<bool Cond>
+struct static_if_select
+{
+    template<class Pair, class... Ts>
+    static constexpr const typename Pair::first_type& get(const Pair& p, Ts&&... xs) noexcept
+    {
+        return p.first(xs...);
+    }
+};
+
+template<>
+struct static_if_select<false>
+{
+    template<class Pair, class... Ts>
+    static constexpr const typename Pair::second_type& get(const Pair& p, Ts&&... xs) noexcept
+    {
+        return p.second(xs...);
+    }
+};
+#endif
+
+}
+
+template<bool Cond, class F, class G>
+struct static_if_adaptor
+: detail::compressed_pair<detail::callable_base<F>, detail::callable_base<G>>
+{
+    typedef detail::compressed_pair<detail::callable_base<F>, detail::callable_base<G>> base;
+    typedef detail::callable_base<F> first_type;
+    typedef detail::callable_base<G> second_type;
+    typedef typename std::conditional<Cond, first_type, second_type>::type branch_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(static_if_adaptor, base)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const branch_type& base_function(Ts&&... xs) const noexcept
+    {
+#if BOOST_HOF_HAS_IF_CONSTEXPR
+        if constexpr (Cond) return this->first(xs...);
+        else return this->second(xs...);
+#else
+        return detail::static_if_select<Cond>::get(*this, xs...);
+#endif
+    }
+
+    // Only the chosen function is checked, so the other one is never
+    // instantiated with the arguments
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr auto operator()(Ts&&... xs) const -> decltype(
+        std::declval<const branch_type&>()(std::declval<Ts>()...)
+    )
+    {
+        return this->base_function(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+namespace detail {
+
+template<bool Cond, class F>
+struct static_if_then : callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(static_if_then, callable_base<F>)
+
+    template<class... Ts>
+    constexpr const callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class G>
+    constexpr static_if_adaptor<Cond, F, G> operator()(G g) const
+    {
+        return static_if_adaptor<Cond, F, G>(this->base_function(g), static_cast<G&&>(g));
+    }
+};
+
+template<bool Cond>
+struct make_static_if_f
+{
+    constexpr make_static_if_f() noexcept
+    {}
+
+    template<class F>
+    constexpr static_if_then<Cond, F> operator()(F f) const BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(F, F&&)
+    {
+        return static_if_then<Cond, F>(static_cast<F&&>(f));
+    }
+};
+
+struct static_if_f
+{
+    constexpr static_if_f() noexcept
+    {}
+
+    template<class Cond, bool B=Cond::type::value>
+    constexpr make_static_if_f<B> operator()(Cond) const noexcept
+    {
+        return {};
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(static_if, detail::static_if_f);
+
+}} // namespace boost::hof
+
+#endif
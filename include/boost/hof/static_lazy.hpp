@@ -0,0 +1,174 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    static_lazy.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FUNCTION_STATIC_LAZY_H
+#define BOOST_HOF_GUARD_FUNCTION_STATIC_LAZY_H
+
+/// static_lazy
+/// ===========
+///
+/// Description
+/// -----------
+///
+/// The `static_lazy` adaptor is like [`static_`](static), except the function
+/// is constructed on its first use without a function-local static. Once it is
+/// constructed, a call only loads a pointer with acquire ordering. The first
+/// use can also happen ahead of time by calling `warm_up`, such as when a
+/// service starts, so the first call doesn't pay for the construction.
+///
+/// The construction is thread-safe. If it throws, the function is constructed
+/// again on the next use. The function is never destroyed, so it can still be
+/// called during static destruction. A function that can be default
+/// constructed at compile time is stored as a constant instead, and `warm_up`
+/// does nothing.
+///
+/// The `BOOST_HOF_STATIC_FUNCTION_LAZY` macro declares a `static_lazy`
+/// function at namespace scope, in the same way as
+/// [`BOOST_HOF_STATIC_FUNCTION`](function).
+///
+/// Synopsis
+/// --------
+///
+///     template<class F>
+///     class static_lazy;
+///
+///     #define BOOST_HOF_STATIC_FUNCTION_LAZY(name, F)
+///
+/// Semantics
+/// ---------
+///
+///     assert(static_lazy<F>()(xs...) == F()(xs...));
+///     assert(&static_lazy<F>().base_function() == &static_lazy<F>().base_function());
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstFunctionObject](ConstFunctionObject)
+/// * DefaultConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <vector>
+///     using namespace boost::hof;
+///
+///     struct squares_table
+///     {
+///         std::vector<int> table;
+///         squares_table()
+///         {
+///             for(int i=0;i<100;i++) table.push_back(i*i);
+///         }
+///         int operator()(int x) const
+///         {
+///             return table[x];
+///         }
+///     };
+///
+///     BOOST_HOF_STATIC_FUNCTION_LAZY(square, squares_table);
+///
+///     int main() {
+///         square.warm_up();
+///         assert(square(5) == 25);
+///     }
+///
+
+#include <boost/hof/detail/result_of.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/reveal.hpp>
+#include <atomic>
+#include <mutex>
+#include <new>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+// The members are static data members, which are constant-initialized, so
+// they don't need a guard like a function-local static
+template<class F, class=void>
+struct static_lazy_storage
+{
+    static std::atomic<const F*> ptr;
+    static std::mutex m;
+    static typename std::aligned_storage<sizeof(F), alignof(F)>::type buffer;
+
+    static const F& init()
+    {
+        std::lock_guard<std::mutex> lock(m);
+        const F* p = ptr.load(std::memory_order_relaxed);
+        if (p == nullptr)
+        {
+            p = ::new(static_cast<void*>(&buffer)) F();
+            ptr.store(p, std::memory_order_release);
+        }
+        return *p;
+    }
+
+    BOOST_HOF_INLINE static const F& get()
+    {
+        const F* p = ptr.load(std::memory_order_acquire);
+        if (p == nullptr) return init();
+        return *p;
+    }
+};
+
+template<class F, class X>
+std::atomic<const F*> static_lazy_storage<F, X>::ptr(nullptr);
+
+template<class F, class X>
+std::mutex static_lazy_storage<F, X>::m;
+
+template<class F, class X>
+typename std::aligned_storage<sizeof(F), alignof(F)>::type static_lazy_storage<F, X>::buffer;
+
+template<class F>
+struct static_lazy_storage<F, typename std::enable_if<is_constant_default_constructible<F>::value>::type>
+{
+    BOOST_HOF_INLINE static constexpr const F& get() noexcept
+    {
+        return static_const_storage<F>::value;
+    }
+};
+
+}
+
+template<class F>
+struct static_lazy
+{
+
+    struct failure
+    : failure_for<F>
+    {};
+
+    BOOST_HOF_INLINE const F& base_function() const
+    {
+        return detail::static_lazy_storage<F>::get();
+    }
+
+    void warm_up() const
+    {
+        detail::static_lazy_storage<F>::get();
+    }
+
+    BOOST_HOF_RETURNS_CLASS(static_lazy);
+
+    template<class... Ts>
+    BOOST_HOF_INLINE BOOST_HOF_SFINAE_RESULT(F, id_<Ts>...)
+    operator()(Ts && ... xs) const
+    BOOST_HOF_SFINAE_RETURNS(BOOST_HOF_CONST_THIS->base_function()(BOOST_HOF_FORWARD(Ts)(xs)...));
+};
+
+}} // namespace boost::hof
+
+#define BOOST_HOF_STATIC_FUNCTION_LAZY(name, ...) BOOST_HOF_DECLARE_STATIC_VAR(name, boost::hof::static_lazy<__VA_ARGS__>)
+
+#endif
@@ -0,0 +1,263 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    static_vector.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_STATIC_VECTOR_H
+#define BOOST_HOF_GUARD_STATIC_VECTOR_H
+
+/// static_vector
+/// =============
+///
+/// Description
+/// -----------
+///
+/// The `static_vector` class holds up to `N` elements in place, where the
+/// capacity `N` is known at compile-time and the size is only known at
+/// runtime. It can be built and read in a constant expression, so a table
+/// can be computed at compile time without a `std::tuple` of every element.
+/// The constructor takes the elements, so `static_vector<int, 4>(3)` holds
+/// one element.
+///
+/// It can be unpacked with [`unpack`](unpack), which calls the function with
+/// the elements, and since the number of arguments depends on the size, the
+/// function must be callable with 0 to `N` elements, like
+/// [`unpack_n`](unpack_n). The size is dispatched with a comparison for each
+/// size up to `N`, which can be evaluated at compile time, so `unpack_n`
+/// should be used instead at runtime when the capacity is large, since it
+/// dispatches with a table. If the calls return different types, the results
+/// are converted to their `std::common_type`. The elements of an rvalue
+/// vector are forwarded as rvalues. In C++11, where a constexpr member
+/// function can't modify the vector, only a const vector can be unpacked in
+/// a constant expression.
+///
+/// Synopsis
+/// --------
+///
+///     template<class T, std::size_t N>
+///     class static_vector;
+///
+/// Semantics
+/// ---------
+///
+///     assert(unpack(f)(static_vector<T, N>(xs...)) == f(xs...));
+///
+/// Requirements
+/// ------------
+///
+/// T must be:
+///
+/// * DefaultConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct count
+///     {
+///         template<class... Ts>
+///         constexpr int operator()(Ts...) const
+///         {
+///             return sizeof...(Ts);
+///         }
+///     };
+///
+///     int main() {
+///         constexpr boost::hof::static_vector<int, 4> v(1, 2, 3);
+///         static_assert(boost::hof::unpack(count())(v) == 3, "");
+///     }
+///
+/// References
+/// ----------
+///
+/// * [unpack](unpack)
+/// * [unpack_n](unpack_n)
+/// * [unpack_sequence](unpack_sequence)
+///
+
+#include <boost/hof/unpack_sequence.hpp>
+#include <boost/hof/dispatch_index.hpp>
+#include <boost/hof/detail/and.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <boost/hof/detail/unpack_tuple.hpp>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+template<class T, std::size_t N>
+class static_vector
+{
+    T elems[N == 0 ? 1 : N];
+    std::size_t n;
+public:
+    typedef T value_type;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+
+    constexpr static_vector() noexcept(std::is_nothrow_default_constructible<T>::value)
+    : elems(), n(0)
+    {}
+
+    template<class... Ts, typename std::enable_if<(
+        sizeof...(Ts) > 0 && sizeof...(Ts) <= N && BOOST_HOF_AND_UNPACK((std::is_convertible<Ts&&, T>::value))
+    ), int>::type = 0>
+    constexpr static_vector(Ts&&... xs)
+    : elems{T(BOOST_HOF_FORWARD(Ts)(xs))...}, n(sizeof...(Ts))
+    {}
+
+    constexpr std::size_t size() const noexcept
+    {
+        return n;
+    }
+
+    static constexpr std::size_t capacity() noexcept
+    {
+        return N;
+    }
+
+    constexpr bool empty() const noexcept
+    {
+        return n == 0;
+    }
+
+    constexpr const T& operator[](std::size_t i) const noexcept
+    {
+        return elems[i];
+    }
+
+    constexpr const T* data() const noexcept
+    {
+        return elems;
+    }
+
+    constexpr const T* begin() const noexcept
+    {
+        return elems;
+    }
+
+    constexpr const T* end() const noexcept
+    {
+        return elems + n;
+    }
+
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    constexpr
+#endif
+    T& operator[](std::size_t i) noexcept
+    {
+        return elems[i];
+    }
+
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    constexpr
+#endif
+    T* data() noexcept
+    {
+        return elems;
+    }
+
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    constexpr
+#endif
+    T* begin() noexcept
+    {
+        return elems;
+    }
+
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    constexpr
+#endif
+    T* end() noexcept
+    {
+        return elems + n;
+    }
+
+    // The vector is full when the size reaches the capacity, so an element
+    // can't be added after that
+    template<class U>
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    constexpr
+#endif
+    T& push_back(U&& x)
+    {
+        if (n == N) throw std::length_error("static_vector: the vector has no capacity left");
+        elems[n] = BOOST_HOF_FORWARD(U)(x);
+        return elems[n++];
+    }
+
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    constexpr
+#endif
+    void pop_back() noexcept
+    {
+        --n;
+    }
+
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    constexpr
+#endif
+    void clear() noexcept
+    {
+        n = 0;
+    }
+};
+
+namespace detail {
+
+template<class F, class V, class S>
+struct static_vector_result;
+
+template<class F, class V, std::size_t... Is>
+struct static_vector_result<F, V, seq<Is...>>
+: dispatch_index_result<
+    decltype(boost::hof::detail::unpack_array(std::declval<F>(), std::declval<V>(), typename gens<Is>::type()))...
+>
+{};
+
+// Each size up to the capacity is compared in turn, so the size can be
+// dispatched in a constant expression
+template<std::size_t I, std::size_t N>
+struct unpack_static_vector
+{
+    template<class R, class F, class V>
+    BOOST_HOF_HOST_DEVICE constexpr static R call(F&& f, V&& v)
+    {
+        return v.size() == I ?
+            R(boost::hof::detail::unpack_array(BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(V)(v), typename gens<I>::type())) :
+            unpack_static_vector<I+1, N>::template call<R>(BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(V)(v));
+    }
+};
+
+template<std::size_t N>
+struct unpack_static_vector<N, N>
+{
+    template<class R, class F, class V>
+    BOOST_HOF_HOST_DEVICE constexpr static R call(F&& f, V&& v)
+    {
+        return R(boost::hof::detail::unpack_array(BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(V)(v), typename gens<N>::type()));
+    }
+};
+
+}
+
+template<class T, std::size_t N>
+struct unpack_sequence<static_vector<T, N>>
+{
+    template<class F, class S, class R=typename detail::static_vector_result<F&&, S&&, typename detail::gens<N+1>::type>::type>
+    BOOST_HOF_HOST_DEVICE constexpr static R apply(F&& f, S&& v)
+    {
+        return detail::unpack_static_vector<0, N>::template call<R>(BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(S)(v));
+    }
+};
+
+}} // namespace boost::hof
+
+#endif
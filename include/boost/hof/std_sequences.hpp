@@ -0,0 +1,83 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    std_sequences.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_STD_SEQUENCES_H
+#define BOOST_HOF_GUARD_STD_SEQUENCES_H
+
+/// std_sequences
+/// =============
+/// 
+/// Description
+/// -----------
+/// 
+/// This header specializes [`unpack_sequence`](unpack_sequence) for
+/// `std::array`, and for a `std::span` with a fixed extent when
+/// `BOOST_HOF_HAS_STD_SPAN` is enabled, so they can be unpacked by
+/// [`unpack`](unpack) and the other adaptors that take a sequence. A
+/// `std::tuple` and a `std::pair` can always be unpacked, since they are
+/// declared by <utility>, and so can a C array.
+/// 
+/// This header is included by every header that can unpack a sequence,
+/// along with <tuple> and <array>, unless `BOOST_HOF_UNPACK_STD_SEQUENCES`
+/// is set to 0. Then the library doesn't include them, and this header only
+/// needs to be included where a `std::array` or a `std::span` is unpacked.
+/// 
+/// Example
+/// -------
+/// 
+///     #define BOOST_HOF_UNPACK_STD_SEQUENCES 0
+///     #include <boost/hof/unpack.hpp>
+///     #include <boost/hof/std_sequences.hpp>
+///     #include <cassert>
+/// 
+///     struct sum
+///     {
+///         template<class T, class U>
+///         T operator()(T x, U y) const
+///         {
+///             return x+y;
+///         }
+///     };
+/// 
+///     int main() {
+///         std::array<int, 2> a = {{1, 2}};
+///         assert(boost::hof::unpack(sum())(a) == 3);
+///     }
+/// 
+/// References
+/// ----------
+/// 
+/// * [unpack_sequence](unpack_sequence)
+/// * [unpack](unpack)
+/// 
+
+#include <boost/hof/detail/unpack_tuple.hpp>
+#include <tuple>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#if BOOST_HOF_HAS_STD_SPAN
+#include <span>
+#endif
+
+namespace boost { namespace hof {
+
+template<class T, std::size_t N>
+struct unpack_sequence<std::array<T, N>>
+: detail::unpack_tuple_apply
+{};
+
+#if BOOST_HOF_HAS_STD_SPAN
+template<class T, std::size_t N>
+struct unpack_sequence<std::span<T, N>, typename std::enable_if<(N != std::dynamic_extent)>::type>
+: detail::unpack_view_apply<N>
+{};
+#endif
+
+}} // namespace boost::hof
+
+#endif
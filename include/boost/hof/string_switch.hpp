@@ -0,0 +1,384 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    string_switch.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_STRING_SWITCH_H
+#define BOOST_HOF_GUARD_STRING_SWITCH_H
+
+/// string_switch
+/// =============
+///
+/// Description
+/// -----------
+///
+/// The `string_switch` function adaptor calls the case whose key is equal
+/// to the first argument, like a `switch` on a string. A case is made with
+/// `string_case(key)(f)`, where the key is a string literal, and a function
+/// that isn't a case matches every string, so it can be the default. The
+/// case is called with all of the arguments, and when no case matches,
+/// `std::out_of_range` is thrown. The first argument can be a `const char*`,
+/// or anything with `data()` and `size()`, such as `std::string`.
+///
+/// When the adaptor is constructed, a perfect hash of the keys is built: the
+/// keys are split into buckets by their hash, and each bucket gets a seed
+/// that sends its keys to slots of a table that no other key uses. So a
+/// string is found by hashing it once, reading the slot that its bucket's
+/// seed sends it to, and comparing it with the one key in that slot, instead
+/// of comparing it with each key. The case is then called through a table of
+/// function pointers, like [`dispatch_index`](dispatch_index).
+///
+/// As with [`match_value`](match_value), the first case that matches is
+/// always the one that is called, so a key that is repeated, or that comes
+/// after the default, is never used.
+///
+/// Synopsis
+/// --------
+///
+///     template<std::size_t N>
+///     constexpr auto string_case(const char (&key)[N]);
+///
+///     template<class... Fs>
+///     string_switch_adaptor<Fs...> string_switch(Fs... fs);
+///
+/// Semantics
+/// ---------
+///
+///     assert(string_switch(string_case(k)(f), g)(s, xs...) == (s == k ? f(s, xs...) : g(s, xs...)));
+///
+/// Requirements
+/// ------------
+///
+/// Fs must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <string>
+///     using namespace boost::hof;
+///
+///     struct reply
+///     {
+///         int code;
+///         int operator()(const std::string&) const
+///         {
+///             return code;
+///         }
+///     };
+///
+///     int main() {
+///         auto route = string_switch(
+///             string_case("get")(reply{200}),
+///             string_case("put")(reply{201}),
+///             reply{405}
+///         );
+///         assert(route(std::string("get")) == 200);
+///         assert(route(std::string("put")) == 201);
+///         assert(route(std::string("delete")) == 405);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [match_value](match_value)
+/// * [dispatch_index](dispatch_index)
+///
+
+#include <boost/hof/always.hpp>
+#include <boost/hof/dispatch_index.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/detail/type_at.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+struct string_switch_key
+{
+    const char* data;
+    std::size_t size;
+};
+
+inline bool string_switch_equal(const string_switch_key& x, const string_switch_key& y) noexcept
+{
+    return x.size == y.size && (x.size == 0 || std::memcmp(x.data, y.data, x.size) == 0);
+}
+
+inline string_switch_key string_switch_key_of(const char* s) noexcept
+{
+    return { s, std::strlen(s) };
+}
+
+template<class S>
+auto string_switch_key_of(const S& s) noexcept
+-> decltype(string_switch_key{ s.data(), static_cast<std::size_t>(s.size()) })
+{
+    return { s.data(), static_cast<std::size_t>(s.size()) };
+}
+
+// FNV-1a, which is the only pass over the string
+inline std::uint64_t string_switch_hash(const string_switch_key& k) noexcept
+{
+    std::uint64_t h = 14695981039346656037ull;
+    for (std::size_t i = 0; i < k.size; i++)
+    {
+        h ^= static_cast<unsigned char>(k.data[i]);
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+inline std::size_t string_switch_bucket(std::uint64_t h, std::size_t mask) noexcept
+{
+    return static_cast<std::size_t>(h ^ (h >> 32)) & mask;
+}
+
+// The finalizer of murmur3, so each seed sends the hash somewhere else
+inline std::size_t string_switch_slot(std::uint64_t h, std::size_t seed, std::size_t mask) noexcept
+{
+    h ^= (seed + 1) * 0x9e3779b97f4a7c15ull;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h) & mask;
+}
+
+constexpr std::size_t string_switch_capacity(std::size_t n, std::size_t c=1)
+{
+    return c >= n ? c : string_switch_capacity(n, 2 * c);
+}
+
+template<class F>
+struct string_case_adaptor : callable_base<F>
+{
+    string_switch_key key;
+
+    template<class G>
+    constexpr string_case_adaptor(string_switch_key k, G&& g)
+    : callable_base<F>(BOOST_HOF_FORWARD(G)(g)), key(k)
+    {}
+
+    template<class... Ts>
+    constexpr const callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class... Ts>
+    constexpr auto operator()(Ts&&... xs) const -> decltype(
+        std::declval<const callable_base<F>&>()(std::declval<Ts>()...)
+    )
+    {
+        return this->base_function(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+struct string_case_f
+{
+    string_switch_key key;
+
+    template<class F>
+    constexpr string_case_adaptor<F> operator()(F f) const
+    {
+        return string_case_adaptor<F>(key, static_cast<F&&>(f));
+    }
+};
+
+template<class F>
+struct string_switch_case
+{
+    static const bool is_case = false;
+
+    static string_switch_key key(const F&) noexcept
+    {
+        return { nullptr, 0 };
+    }
+};
+
+template<class F>
+struct string_switch_case<string_case_adaptor<F>>
+{
+    static const bool is_case = true;
+
+    static string_switch_key key(const string_case_adaptor<F>& c) noexcept
+    {
+        return c.key;
+    }
+};
+
+template<class S, class... Fs>
+struct string_switch_adaptor_base;
+
+template<std::size_t... Ns, class... Fs>
+struct string_switch_adaptor_base<seq<Ns...>, Fs...>
+: pack_base<seq<Ns...>, callable_base<Fs>...>
+{
+    typedef pack_base<seq<Ns...>, callable_base<Fs>...> base_type;
+    static const std::size_t cases = sizeof...(Fs);
+    static const std::size_t bucket_count = string_switch_capacity(sizeof...(Fs));
+    // Keeping the table at most half full makes finding the seeds quick
+    static const std::size_t slot_count = string_switch_capacity(2 * sizeof...(Fs));
+    static const std::size_t seed_limit = 1 << 16;
+
+    std::array<string_switch_key, sizeof...(Fs)> keys;
+    std::array<std::size_t, bucket_count> seeds;
+    std::array<std::size_t, slot_count> slots;
+    // The first case that isn't a string case, which ends the keys
+    std::size_t fallback;
+    // When the keys can't be hashed apart, they are compared one by one
+    bool linear;
+
+    string_switch_adaptor_base(Fs... fs)
+    : base_type(static_cast<Fs&&>(fs)...), keys(), seeds(), slots(), fallback(cases), linear(false)
+    {
+        this->build();
+    }
+
+    template<std::size_t I, class... Ts>
+    constexpr const callable_base<typename type_at<I, Fs...>::type>& get(Ts&&... xs) const noexcept
+    {
+        return boost::hof::alias_value<pack_tag<seq<I>, callable_base<Fs>...>, callable_base<typename type_at<I, Fs...>::type>>(*this, xs...);
+    }
+
+    template<std::size_t I>
+    void add_case()
+    {
+        typedef string_switch_case<typename type_at<I, Fs...>::type> case_type;
+        keys[I] = case_type::key(this->template get<I>());
+        if (!case_type::is_case && I < fallback) fallback = I;
+    }
+
+    bool place(std::size_t b, const std::uint64_t* hashes, const std::size_t* buckets)
+    {
+        std::size_t used[sizeof...(Fs) + 1];
+        for (std::size_t seed = 0; seed < seed_limit; seed++)
+        {
+            std::size_t count = 0;
+            bool ok = true;
+            for (std::size_t i = 0; i < fallback && ok; i++)
+            {
+                if (buckets[i] != b) continue;
+                std::size_t s = string_switch_slot(hashes[i], seed, slot_count - 1);
+                ok = slots[s] == cases;
+                for (std::size_t j = 0; j < count && ok; j++) ok = used[j] != s;
+                used[count++] = s;
+            }
+            if (!ok) continue;
+            seeds[b] = seed;
+            for (std::size_t i = 0; i < fallback; i++)
+            {
+                if (buckets[i] == b) slots[string_switch_slot(hashes[i], seed, slot_count - 1)] = i;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void build()
+    {
+        (void)std::initializer_list<int>{(this->template add_case<Ns>(), 0)...};
+        slots.fill(sizeof...(Fs));
+        std::uint64_t hashes[sizeof...(Fs) + 1];
+        std::size_t buckets[sizeof...(Fs) + 1];
+        std::size_t sizes[bucket_count] = {};
+        std::size_t largest = 0;
+        for (std::size_t i = 0; i < fallback; i++)
+        {
+            buckets[i] = bucket_count;
+            bool repeated = false;
+            for (std::size_t j = 0; j < i && !repeated; j++) repeated = string_switch_equal(keys[i], keys[j]);
+            if (repeated) continue;
+            hashes[i] = string_switch_hash(keys[i]);
+            buckets[i] = string_switch_bucket(hashes[i], bucket_count - 1);
+            if (++sizes[buckets[i]] > largest) largest = sizes[buckets[i]];
+        }
+        // The largest buckets are placed first, while most of the slots are free
+        for (std::size_t n = largest; n > 0; n--)
+        {
+            for (std::size_t b = 0; b < bucket_count; b++)
+            {
+                if (sizes[b] == n && !this->place(b, hashes, buckets))
+                {
+                    linear = true;
+                    return;
+                }
+            }
+        }
+    }
+
+    std::size_t find(const string_switch_key& k) const noexcept
+    {
+        if (linear)
+        {
+            for (std::size_t i = 0; i < fallback; i++)
+            {
+                if (string_switch_equal(keys[i], k)) return i;
+            }
+            return fallback;
+        }
+        std::uint64_t h = string_switch_hash(k);
+        std::size_t i = slots[string_switch_slot(h, seeds[string_switch_bucket(h, bucket_count - 1)], slot_count - 1)];
+        if (i != cases && string_switch_equal(keys[i], k)) return i;
+        return fallback;
+    }
+
+    template<std::size_t I, class R, class... Ts>
+    static R call(const string_switch_adaptor_base& self, Ts&&... xs)
+    {
+        return self.template get<I>(xs...)(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+
+    template<class T, class... Ts, class R=typename dispatch_index_result<
+        decltype(std::declval<const callable_base<Fs>&>()(std::declval<T>(), std::declval<Ts>()...))...
+    >::type, class=decltype(detail::string_switch_key_of(std::declval<const T&>()))>
+    R operator()(T&& x, Ts&&... xs) const
+    {
+        typedef R (*call_type)(const string_switch_adaptor_base&, T&&, Ts&&...);
+        static constexpr call_type entries[] = { &string_switch_adaptor_base::template call<Ns, R, T, Ts...>... };
+        std::size_t i = this->find(detail::string_switch_key_of(x));
+        if (i == cases) throw std::out_of_range("No case matches the string");
+        return entries[i](*this, BOOST_HOF_FORWARD(T)(x), BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+}
+
+template<std::size_t N>
+constexpr detail::string_case_f string_case(const char (&key)[N]) noexcept
+{
+    return detail::string_case_f{ { key, N - 1 } };
+}
+
+template<class... Fs>
+struct string_switch_adaptor
+: detail::string_switch_adaptor_base<typename detail::gens<sizeof...(Fs)>::type, Fs...>
+{
+    typedef detail::string_switch_adaptor_base<typename detail::gens<sizeof...(Fs)>::type, Fs...> base_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(string_switch_adaptor, base_type)
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(string_switch, detail::make<string_switch_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,251 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    swappable.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_SWAPPABLE_H
+#define BOOST_HOF_GUARD_SWAPPABLE_H
+
+/// swappable
+/// =========
+///
+/// Description
+/// -----------
+///
+/// The `swappable` class is a slot that holds a function object that can be
+/// called with the signature `Sig`, which can be replaced with `store` while
+/// other threads are calling it. Like RCU, calling the slot doesn't take a
+/// lock: a call only counts itself as a reader while it loads and calls the
+/// current function. Storing a new function waits until the calls that could
+/// still be using the old function have returned, and then destroys the old
+/// function. The calls that start after the new function is stored aren't
+/// waited for, so `store` completes while the slot is being called
+/// continuously.
+///
+/// Since `store` waits for the calls in progress, it must not be called from
+/// inside a call to the same slot. The stored functions are called as const
+/// lvalues, and they are type erased in the same way as
+/// [`inplace_function`](inplace_function), except each one is allocated
+/// separately. Calling an empty slot throws `std::bad_function_call`.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Sig>
+///     class swappable;
+///
+///     template<class R, class... Args>
+///     class swappable<R(Args...)>
+///     {
+///         swappable() noexcept;
+///
+///         template<class F>
+///         swappable(F&& f);
+///
+///         template<class F>
+///         void store(F&& f);
+///
+///         void reset();
+///
+///         explicit operator bool() const noexcept;
+///
+///         R operator()(Args... xs) const;
+///     };
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * Callable as a const lvalue with `Args...`, and the result convertible
+///   to `R`, unless `R` is void
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int main() {
+///         boost::hof::swappable<int(int)> strategy(boost::hof::_1 + 1);
+///         assert(strategy(1) == 2);
+///         strategy.store(boost::hof::_1 * 10);
+///         assert(strategy(1) == 10);
+///     }
+///
+
+#include <boost/hof/detail/erased_call.hpp>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class R, class... Args>
+struct swappable_node
+{
+    R (*invoke)(const swappable_node*, Args&&...);
+    void (*destroy)(swappable_node*);
+};
+
+template<class F, class R, class... Args>
+struct swappable_node_for : swappable_node<R, Args...>
+{
+    F f;
+
+    template<class X>
+    swappable_node_for(X&& x) : f(BOOST_HOF_FORWARD(X)(x))
+    {
+        this->invoke = &swappable_node_for::invoke_node;
+        this->destroy = &swappable_node_for::destroy_node;
+    }
+
+    static R invoke_node(const swappable_node<R, Args...>* p, Args&&... xs)
+    {
+        return erased_invoke<R>::call(static_cast<const swappable_node_for*>(p)->f, BOOST_HOF_FORWARD(Args)(xs)...);
+    }
+
+    static void destroy_node(swappable_node<R, Args...>* p)
+    {
+        delete static_cast<swappable_node_for*>(p);
+    }
+};
+
+// Readers increment the counter of the current phase before they load the
+// function. Flipping the phase twice, and each time waiting for the previous
+// phase to drain, waits for every reader that started before the flips,
+// while the new readers count themselves in the other phase.
+struct swappable_readers
+{
+    struct counter
+    {
+        std::atomic<std::size_t> n;
+        // Keep the counters of the phases on separate cache lines
+        char padding[64 - sizeof(std::atomic<std::size_t>)];
+    };
+    counter counters[2];
+    std::atomic<std::size_t> phase;
+
+    swappable_readers() noexcept : phase(0)
+    {
+        counters[0].n.store(0, std::memory_order_relaxed);
+        counters[1].n.store(0, std::memory_order_relaxed);
+    }
+
+    std::atomic<std::size_t>& enter() noexcept
+    {
+        std::atomic<std::size_t>& c = counters[phase.load() & 1].n;
+        c.fetch_add(1);
+        return c;
+    }
+
+    void synchronize() noexcept
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            std::size_t p = phase.fetch_add(1);
+            while (counters[p & 1].n.load() != 0) std::this_thread::yield();
+        }
+    }
+};
+
+struct swappable_read_guard
+{
+    std::atomic<std::size_t>& c;
+
+    swappable_read_guard(swappable_readers& r) noexcept : c(r.enter())
+    {}
+
+    swappable_read_guard(const swappable_read_guard&)=delete;
+    swappable_read_guard& operator=(const swappable_read_guard&)=delete;
+
+    ~swappable_read_guard()
+    {
+        c.fetch_sub(1, std::memory_order_release);
+    }
+};
+
+}
+
+template<class Sig>
+class swappable;
+
+template<class R, class... Args>
+class swappable<R(Args...)>
+{
+    typedef detail::swappable_node<R, Args...> node_type;
+
+    std::atomic<node_type*> current;
+    mutable detail::swappable_readers readers;
+    std::mutex writer;
+
+    template<class F>
+    static node_type* make_node(F&& f)
+    {
+        return new detail::swappable_node_for<typename std::decay<F>::type, R, Args...>(BOOST_HOF_FORWARD(F)(f));
+    }
+
+    void exchange(node_type* p)
+    {
+        std::lock_guard<std::mutex> lock(writer);
+        node_type* old = current.exchange(p);
+        if (old == nullptr) return;
+        readers.synchronize();
+        old->destroy(old);
+    }
+public:
+    swappable() noexcept : current(nullptr)
+    {}
+
+    template<class F, class T=typename std::decay<F>::type, typename std::enable_if<(
+        !std::is_same<T, swappable>::value &&
+        detail::is_erased_callable<const T&, R(Args...)>::value
+    ), int>::type = 0>
+    swappable(F&& f) : current(make_node(BOOST_HOF_FORWARD(F)(f)))
+    {}
+
+    swappable(const swappable&)=delete;
+    swappable& operator=(const swappable&)=delete;
+
+    ~swappable()
+    {
+        node_type* p = current.load(std::memory_order_relaxed);
+        if (p != nullptr) p->destroy(p);
+    }
+
+    template<class F, class T=typename std::decay<F>::type, typename std::enable_if<(
+        detail::is_erased_callable<const T&, R(Args...)>::value
+    ), int>::type = 0>
+    void store(F&& f)
+    {
+        this->exchange(make_node(BOOST_HOF_FORWARD(F)(f)));
+    }
+
+    void reset()
+    {
+        this->exchange(nullptr);
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return current.load(std::memory_order_acquire) != nullptr;
+    }
+
+    R operator()(Args... xs) const
+    {
+        detail::swappable_read_guard guard(readers);
+        const node_type* p = current.load();
+        if (p == nullptr) throw std::bad_function_call();
+        return p->invoke(p, BOOST_HOF_FORWARD(Args)(xs)...);
+    }
+};
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,180 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    synchronized.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FUNCTION_SYNCHRONIZED_H
+#define BOOST_HOF_GUARD_FUNCTION_SYNCHRONIZED_H
+
+/// synchronized
+/// ============
+///
+/// Description
+/// -----------
+///
+/// The `synchronized` function adaptor is like [`mutable_`](mutable), except
+/// each call holds a lock, so the function object can be called from several
+/// threads at once. The lock is provided by a policy, which defaults to
+/// `synchronized_mutex`, which uses a `std::mutex`. The library also provides
+/// `synchronized_spinlock`, which spins on an atomic flag, and is better when
+/// the calls are short.
+///
+/// Copying the adaptor copies the function object while holding the lock of
+/// the original, and the copy has its own lock, so the copies don't share
+/// state. The lock is released once the call returns, so the function
+/// shouldn't return a reference to its state.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F, class Policy>
+///     synchronized_adaptor<F, Policy> synchronized(F f, Policy p);
+///
+///     template<class F>
+///     synchronized_adaptor<F> synchronized(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(synchronized(f)(xs...) == f(xs...));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [MutableFunctionObject](MutableFunctionObject)
+/// * MoveConstructible
+///
+/// Policy must:
+///
+/// * Declare a `lock_type` that is DefaultConstructible and BasicLockable
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct counter
+///     {
+///         int n = 0;
+///         int operator()()
+///         {
+///             return ++n;
+///         }
+///     };
+///
+///     int main() {
+///         auto next = boost::hof::synchronized(counter(), boost::hof::synchronized_spinlock());
+///         next();
+///         assert(next() == 2);
+///     }
+///
+
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+struct spinlock
+{
+    std::atomic_flag flag;
+
+    spinlock() noexcept
+    {
+        flag.clear();
+    }
+
+    void lock() noexcept
+    {
+        while (flag.test_and_set(std::memory_order_acquire)) std::this_thread::yield();
+    }
+
+    void unlock() noexcept
+    {
+        flag.clear(std::memory_order_release);
+    }
+};
+
+}
+
+struct synchronized_mutex
+{
+    typedef std::mutex lock_type;
+};
+
+struct synchronized_spinlock
+{
+    typedef detail::spinlock lock_type;
+};
+
+template<class F, class Policy=synchronized_mutex>
+struct synchronized_adaptor
+{
+    typedef typename Policy::lock_type lock_type;
+
+    mutable F f;
+    mutable lock_type m;
+
+    BOOST_HOF_DELGATE_PRIMITIVE_CONSTRUCTOR(, synchronized_adaptor, F, f);
+
+    synchronized_adaptor(const synchronized_adaptor& rhs) : f(rhs.locked_copy())
+    {}
+
+    synchronized_adaptor(synchronized_adaptor&& rhs) : f(rhs.locked_move())
+    {}
+
+    F locked_copy() const
+    {
+        std::lock_guard<lock_type> lock(m);
+        return f;
+    }
+
+    F locked_move()
+    {
+        std::lock_guard<lock_type> lock(m);
+        return boost::hof::move(f);
+    }
+
+    template<class... Ts, class R=decltype(std::declval<F&>()(std::declval<Ts>()...))>
+    R operator()(Ts&&... xs) const
+    {
+        std::lock_guard<lock_type> lock(m);
+        return f(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+namespace detail {
+
+struct synchronized_f
+{
+    template<class F, class Policy>
+    synchronized_adaptor<F, Policy> operator()(F f, Policy) const
+    {
+        return synchronized_adaptor<F, Policy>(boost::hof::move(f));
+    }
+
+    template<class F>
+    synchronized_adaptor<F> operator()(F f) const
+    {
+        return synchronized_adaptor<F>(boost::hof::move(f));
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(synchronized, detail::synchronized_f);
+
+}} // namespace boost::hof
+
+#endif
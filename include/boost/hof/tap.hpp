@@ -66,7 +66,7 @@ namespace boost { namespace hof { namespace detail {
 struct tap_f
 {
     template<class T, class F>
-    constexpr T operator()(T&& x, const F& f) const
+    BOOST_HOF_INLINE constexpr T operator()(T&& x, const F& f) const
     BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT((boost::hof::apply(f, x), BOOST_HOF_FORWARD(T)(x)))
     {
         return boost::hof::apply(f, x), BOOST_HOF_FORWARD(T)(x);
@@ -0,0 +1,344 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tap_async.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_TAP_ASYNC_H
+#define BOOST_HOF_GUARD_TAP_ASYNC_H
+
+/// tap_async
+/// =========
+///
+/// Description
+/// -----------
+///
+/// The `tap_async` function returns a unary function that passes its
+/// argument through, like [`tap`](tap), except the sink is called on a copy
+/// of the argument on a background thread, so the caller only pays for
+/// copying the value into a queue. It is meant for logging the intermediate
+/// values of a [`flow`](flow) pipeline without adding the latency of the I/O
+/// to each stage.
+///
+/// The queue is a bounded lock-free queue, where any number of threads can
+/// push, and the background thread pops. Its capacity is rounded up to a
+/// power of two, and is 1024 by default. When the queue is full, the value
+/// is dropped instead of waiting for the background thread, and the number
+/// of dropped values can be read with `dropped`. A copy of the value that
+/// fits in 64 bytes is stored in the queue itself, and a larger one is
+/// allocated.
+///
+/// Copies of the function share the same queue and background thread. Once
+/// the last copy is destroyed, the background thread calls the sink on the
+/// values that are left, and then it is joined. The `flush` member function
+/// waits until the sink has been called on every value that was pushed.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Sink>
+///     tap_async_adaptor<Sink> tap_async(Sink sink, std::size_t capacity=1024);
+///
+/// Semantics
+/// ---------
+///
+///     assert(tap_async(sink)(x) == x);
+///     // and later, on the background thread
+///     sink(std::move(copy_of_x));
+///
+/// Requirements
+/// ------------
+///
+/// Sink must be:
+///
+/// * [UnaryInvocable](UnaryInvocable) with an rvalue of each decayed argument
+/// * MoveConstructible
+/// * Not throwing, since it is called on a thread that can't report it
+///
+/// The decayed arguments must be:
+///
+/// * CopyConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <atomic>
+///     #include <cassert>
+///
+///     int main() {
+///         std::atomic<int> logged(0);
+///         auto log = boost::hof::tap_async([&](int x) { logged += x; });
+///         auto f = boost::hof::flow(boost::hof::_ + 1, log, boost::hof::_ * 2);
+///         assert(f(1) == 4);
+///         log.flush();
+///         assert(logged == 2);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [tap](tap)
+/// * [flow](flow)
+///
+
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+static constexpr std::size_t tap_async_value_size = 64;
+
+template<class Sink>
+struct tap_async_slot
+{
+    std::atomic<std::size_t> sequence;
+    void (*consume)(const Sink&, void*);
+    typename std::aligned_storage<tap_async_value_size, alignof(std::max_align_t)>::type buffer;
+};
+
+template<class T>
+struct tap_async_is_inline
+: std::integral_constant<bool, (
+    sizeof(T) <= tap_async_value_size &&
+    alignof(T) <= alignof(std::max_align_t)
+)>
+{};
+
+template<class Sink, class T, bool Inline=tap_async_is_inline<T>::value>
+struct tap_async_value
+{
+    static void construct(void* p, const T& x)
+    {
+        ::new(p) T(x);
+    }
+
+    static void consume(const Sink& sink, void* p) noexcept
+    {
+        T& x = *static_cast<T*>(p);
+        sink(boost::hof::move(x));
+        x.~T();
+    }
+};
+
+template<class Sink, class T>
+struct tap_async_value<Sink, T, false>
+{
+    static void construct(void* p, const T& x)
+    {
+        ::new(p) T*(new T(x));
+    }
+
+    static void consume(const Sink& sink, void* p) noexcept
+    {
+        std::unique_ptr<T> x(*static_cast<T**>(p));
+        sink(boost::hof::move(*x));
+    }
+};
+
+inline std::size_t tap_async_capacity(std::size_t n) noexcept
+{
+    std::size_t c = 2;
+    while (c < n) c *= 2;
+    return c;
+}
+
+// A bounded queue of Vyukov, where each slot has a sequence number that
+// tells whether it is ready to be pushed to, or popped from, so a push only
+// needs to claim a position, and there is only one thread that pops
+template<class Sink>
+struct tap_async_state
+{
+    typedef tap_async_slot<Sink> slot_type;
+
+    Sink sink;
+    std::size_t mask;
+    std::unique_ptr<slot_type[]> slots;
+    std::atomic<std::size_t> tail;
+    std::size_t head;
+    std::atomic<std::size_t> pushed;
+    std::atomic<std::size_t> consumed;
+    std::atomic<std::size_t> dropped;
+    std::atomic<bool> stop;
+    std::atomic<bool> sleeping;
+    std::mutex m;
+    std::condition_variable cv;
+    std::thread consumer;
+
+    template<class S>
+    tap_async_state(S&& s, std::size_t capacity)
+    : sink(BOOST_HOF_FORWARD(S)(s)),
+      mask(tap_async_capacity(capacity) - 1),
+      slots(new slot_type[mask + 1]),
+      tail(0), head(0), pushed(0), consumed(0), dropped(0), stop(false), sleeping(false)
+    {
+        for(std::size_t i = 0; i <= mask; i++) slots[i].sequence.store(i, std::memory_order_relaxed);
+        consumer = std::thread([this] { this->run(); });
+    }
+
+    tap_async_state(const tap_async_state&)=delete;
+    tap_async_state& operator=(const tap_async_state&)=delete;
+
+    ~tap_async_state()
+    {
+        stop.store(true, std::memory_order_seq_cst);
+        {
+            std::lock_guard<std::mutex> lock(m);
+            cv.notify_one();
+        }
+        consumer.join();
+    }
+
+    template<class T>
+    void push(const T& x)
+    {
+        std::size_t pos = tail.load(std::memory_order_relaxed);
+        slot_type* s;
+        for(;;)
+        {
+            s = &slots[pos & mask];
+            std::size_t seq = s->sequence.load(std::memory_order_acquire);
+            if (seq == pos)
+            {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            }
+            // The slot still holds the value from the previous lap
+            else if (seq < pos)
+            {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            else pos = tail.load(std::memory_order_relaxed);
+        }
+        try
+        {
+            tap_async_value<Sink, T>::construct(&s->buffer, x);
+        }
+        catch(...)
+        {
+            // The position is already claimed, so the slot is skipped
+            s->consume = nullptr;
+            s->sequence.store(pos + 1, std::memory_order_release);
+            throw;
+        }
+        s->consume = &tap_async_value<Sink, T>::consume;
+        pushed.fetch_add(1, std::memory_order_relaxed);
+        s->sequence.store(pos + 1, std::memory_order_seq_cst);
+        if (sleeping.load(std::memory_order_seq_cst))
+        {
+            std::lock_guard<std::mutex> lock(m);
+            cv.notify_one();
+        }
+    }
+
+    bool ready() const noexcept
+    {
+        return slots[head & mask].sequence.load(std::memory_order_acquire) == head + 1;
+    }
+
+    bool pop() noexcept
+    {
+        if (!this->ready()) return false;
+        slot_type& s = slots[head & mask];
+        if (s.consume != nullptr)
+        {
+            s.consume(sink, &s.buffer);
+            consumed.fetch_add(1, std::memory_order_release);
+        }
+        s.sequence.store(head + mask + 1, std::memory_order_release);
+        head++;
+        return true;
+    }
+
+    void run() noexcept
+    {
+        for(;;)
+        {
+            if (this->pop()) continue;
+            if (stop.load(std::memory_order_seq_cst))
+            {
+                while (this->pop()) {}
+                return;
+            }
+            std::unique_lock<std::mutex> lock(m);
+            sleeping.store(true, std::memory_order_seq_cst);
+            // The wait times out in case a push was missed between checking
+            // the queue and waiting
+            cv.wait_for(lock, std::chrono::milliseconds(10), [this] {
+                return this->ready() || stop.load(std::memory_order_seq_cst);
+            });
+            sleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    void flush() const noexcept
+    {
+        while (consumed.load(std::memory_order_acquire) != pushed.load(std::memory_order_relaxed))
+            std::this_thread::yield();
+    }
+};
+
+}
+
+template<class Sink>
+struct tap_async_adaptor
+{
+    std::shared_ptr<detail::tap_async_state<Sink>> state;
+
+    template<class S>
+    tap_async_adaptor(S&& s, std::size_t capacity)
+    : state(std::make_shared<detail::tap_async_state<Sink>>(BOOST_HOF_FORWARD(S)(s), capacity))
+    {}
+
+    std::size_t dropped() const noexcept
+    {
+        return state->dropped.load(std::memory_order_relaxed);
+    }
+
+    void flush() const noexcept
+    {
+        state->flush();
+    }
+
+    template<class T, class=decltype(
+        std::declval<const Sink&>()(std::declval<typename std::decay<T>::type>())
+    )>
+    T operator()(T&& x) const
+    {
+        state->push(static_cast<const typename std::decay<T>::type&>(x));
+        return BOOST_HOF_FORWARD(T)(x);
+    }
+};
+
+namespace detail {
+
+struct make_tap_async
+{
+    template<class Sink>
+    tap_async_adaptor<Sink> operator()(Sink sink, std::size_t capacity=1024) const
+    {
+        return tap_async_adaptor<Sink>(static_cast<Sink&&>(sink), capacity);
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(tap_async, detail::make_tap_async);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,145 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    thread_local.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_FUNCTION_THREAD_LOCAL_H
+#define BOOST_HOF_GUARD_FUNCTION_THREAD_LOCAL_H
+
+/// thread_local_
+/// =============
+///
+/// Description
+/// -----------
+///
+/// The `thread_local_` function adaptor gives each thread its own copy of a
+/// function object with a non-const call operator, so it can be called from
+/// several threads without a lock. The copy of a thread is made from the
+/// function that was passed to `thread_local_` the first time the thread
+/// calls it, and it is used by the later calls in that thread.
+///
+/// Copies of the adaptor share the copies of the threads. The copies of a
+/// thread are destroyed when the thread exits, even if the adaptor is
+/// destroyed before then.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F>
+///     thread_local_adaptor<F> thread_local_(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(thread_local_(f)(xs...) == F(f)(xs...));
+///
+/// Where the copy of `f` is made by the first call in each thread.
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [MutableFunctionObject](MutableFunctionObject)
+/// * CopyConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct counter
+///     {
+///         int n = 0;
+///         int operator()()
+///         {
+///             return ++n;
+///         }
+///     };
+///
+///     int main() {
+///         auto next = boost::hof::thread_local_(counter());
+///         next();
+///         assert(next() == 2);
+///     }
+///
+
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <atomic>
+#include <unordered_map>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+inline std::size_t thread_local_next_id() noexcept
+{
+    static std::atomic<std::size_t> id(0);
+    return id++;
+}
+
+// The copies of each thread are found by the id of the adaptor. The map
+// holds nodes, so the last copy that was used is kept as a pointer, which
+// skips the lookup when a thread keeps calling the same adaptor.
+template<class F>
+struct thread_local_replicas
+{
+    std::unordered_map<std::size_t, F> replicas;
+    std::size_t last_id;
+    F* last;
+
+    thread_local_replicas() : last_id(0), last(nullptr)
+    {}
+
+    static thread_local_replicas& this_thread()
+    {
+        static thread_local thread_local_replicas r;
+        return r;
+    }
+
+    F& get(std::size_t id, const F& prototype)
+    {
+        if (last != nullptr && last_id == id) return *last;
+        auto it = replicas.find(id);
+        if (it == replicas.end()) it = replicas.emplace(id, prototype).first;
+        last_id = id;
+        last = &it->second;
+        return *last;
+    }
+};
+
+}
+
+template<class F>
+struct thread_local_adaptor
+{
+    F prototype;
+    std::size_t id;
+
+    template<class... Ts, BOOST_HOF_ENABLE_IF_CONSTRUCTIBLE(F, Ts&&...)>
+    thread_local_adaptor(Ts&&... xs) : prototype(BOOST_HOF_FORWARD(Ts)(xs)...), id(detail::thread_local_next_id())
+    {}
+
+    F& base_function() const
+    {
+        return detail::thread_local_replicas<F>::this_thread().get(id, prototype);
+    }
+
+    template<class... Ts, class R=decltype(std::declval<F&>()(std::declval<Ts>()...))>
+    R operator()(Ts&&... xs) const
+    {
+        return this->base_function()(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(thread_local_, detail::make<thread_local_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,271 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    throttle.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_THROTTLE_H
+#define BOOST_HOF_GUARD_THROTTLE_H
+
+/// throttle
+/// ========
+///
+/// Description
+/// -----------
+///
+/// The `throttle` function decorator limits how often a function is called,
+/// such as a callback of a noisy event source, or a log call. The rate is a
+/// token bucket, that allows `count` calls every `per`, and up to `burst`
+/// calls at once. The calls that are over the rate are dropped, and the
+/// decorated function returns whether the function was called, so the result
+/// of the function is discarded.
+///
+/// The bucket is kept as the time when it is full again, in a single atomic,
+/// so a call that is allowed only reads the clock and updates the atomic
+/// with a compare and swap, and a call that is dropped only reads the
+/// atomic. The decorated function can be called from several threads. Each
+/// copy of the decorated function starts with the bucket it was copied from.
+///
+/// The `coalesce` function adaptor keeps only the arguments of the last
+/// call, as a [`pack`](pack), and calls the function with them at most once
+/// per window. The first call after the window has passed calls the function
+/// at once, and the calls in the window replace the pack, which is passed by
+/// the first call after the window, or by `flush`, or when the adaptor is
+/// destroyed. The types of the arguments are given with the window, like
+/// with [`batched`](batched), and like `batched`, a copy starts empty, and
+/// it is not safe to call it from several threads at the same time.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Rate>
+///     auto throttle(Rate r);
+///
+///     struct throttle_rate
+///     {
+///         throttle_rate(std::size_t count, std::chrono::nanoseconds per, std::size_t burst=1);
+///         bool try_acquire() const;
+///         bool try_acquire(std::chrono::steady_clock::time_point now) const;
+///     };
+///
+///     template<class... Ts>
+///     constexpr coalesce_window<Ts...> coalesce(std::chrono::nanoseconds window);
+///
+///     template<class F, class... Ts>
+///     struct coalesce_adaptor
+///     {
+///         void operator()(Ts... xs) const;
+///         void flush() const;
+///         bool pending() const noexcept;
+///     };
+///
+/// Semantics
+/// ---------
+///
+///     assert(throttle(r)(f)(xs...) == (r.try_acquire() && (f(xs...), true)));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Ts must be:
+///
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <chrono>
+///
+///     int logged = 0;
+///     int last = 0;
+///
+///     struct log_f
+///     {
+///         void operator()(int x) const
+///         {
+///             logged++;
+///             last = x;
+///         }
+///     };
+///
+///     int main() {
+///         auto log = boost::hof::throttle(boost::hof::throttle_rate(1, std::chrono::hours(1)))(log_f());
+///         assert(log(1));
+///         assert(!log(2));
+///         assert(logged == 1);
+///
+///         auto update = boost::hof::coalesce<int>(std::chrono::hours(1))(log_f());
+///         update(3);
+///         update(4);
+///         update(5);
+///         assert(logged == 2 && last == 3);
+///         update.flush();
+///         assert(logged == 3 && last == 5);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [decorate](decorate)
+/// * [batched](batched)
+///
+
+#include <boost/hof/always.hpp>
+#include <boost/hof/batched.hpp>
+#include <boost/hof/decorate.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+struct throttle_rate
+{
+    typedef std::chrono::steady_clock clock;
+
+    std::int64_t interval;
+    std::int64_t tolerance;
+    // The time when the bucket is full again, in nanoseconds of the clock
+    mutable std::atomic<std::int64_t> full;
+
+    throttle_rate(std::size_t count, std::chrono::nanoseconds per, std::size_t burst=1)
+    : interval(per.count() / std::int64_t(count > 0 ? count : 1)), tolerance(0), full(0)
+    {
+        tolerance = interval * std::int64_t(burst > 0 ? burst - 1 : 0);
+    }
+
+    throttle_rate(const throttle_rate& rhs)
+    : interval(rhs.interval), tolerance(rhs.tolerance), full(rhs.full.load(std::memory_order_relaxed))
+    {}
+
+    bool try_acquire(clock::time_point now) const noexcept
+    {
+        std::int64_t t = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+        std::int64_t f = full.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            std::int64_t start = f > t ? f : t;
+            if (start - t > tolerance) return false;
+            if (full.compare_exchange_weak(f, start + interval, std::memory_order_relaxed)) return true;
+        }
+    }
+
+    bool try_acquire() const noexcept
+    {
+        return this->try_acquire(clock::now());
+    }
+};
+
+namespace detail {
+
+struct throttle_f
+{
+    template<class Rate, class F, class... Ts, class=decltype(std::declval<const F&>()(std::declval<Ts>()...))>
+    bool operator()(const Rate& r, const F& f, Ts&&... xs) const
+    {
+        if (!r.try_acquire()) return false;
+        f(BOOST_HOF_FORWARD(Ts)(xs)...);
+        return true;
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(throttle, decorate_adaptor<detail::throttle_f>);
+
+template<class F, class... Ts>
+struct coalesce_adaptor : detail::callable_base<F>
+{
+    typedef std::chrono::steady_clock clock;
+    typedef decltype(boost::hof::pack(std::declval<Ts>()...)) value_type;
+
+    std::chrono::nanoseconds window;
+    mutable detail::batched_buffer<value_type, 1> slot;
+    mutable clock::time_point next;
+
+    template<class X, class=typename std::enable_if<std::is_constructible<F, X&&>::value>::type>
+    coalesce_adaptor(X&& x, std::chrono::nanoseconds w)
+    : detail::callable_base<F>(BOOST_HOF_FORWARD(X)(x)), window(w), next()
+    {}
+
+    // The pack is only passed by the original, so a copy starts empty
+    coalesce_adaptor(const coalesce_adaptor& rhs)
+    : detail::callable_base<F>(rhs.base_function()), window(rhs.window), next(rhs.next)
+    {}
+
+    coalesce_adaptor(coalesce_adaptor&& rhs)
+    : detail::callable_base<F>(static_cast<detail::callable_base<F>&&>(rhs)), window(rhs.window), slot(std::move(rhs.slot)), next(rhs.next)
+    {}
+
+    ~coalesce_adaptor()
+    {
+        this->flush();
+    }
+
+    template<class... Us>
+    constexpr const detail::callable_base<F>& base_function(Us&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    bool pending() const noexcept
+    {
+        return slot.n != 0;
+    }
+
+    void flush() const
+    {
+        if (slot.n == 0) return;
+        boost::hof::unpack(this->base_function())(std::move(slot.data()[0]));
+        slot.clear();
+    }
+
+    template<class... Us, class=decltype(boost::hof::pack(static_cast<Ts>(std::declval<Us>())...))>
+    void operator()(Us&&... xs) const
+    {
+        slot.clear();
+        slot.emplace(boost::hof::pack(static_cast<Ts>(BOOST_HOF_FORWARD(Us)(xs))...));
+        clock::time_point now = clock::now();
+        if (now < next) return;
+        next = now + window;
+        this->flush();
+    }
+};
+
+template<class... Ts>
+struct coalesce_window
+{
+    std::chrono::nanoseconds window;
+
+    template<class F>
+    coalesce_adaptor<F, Ts...> operator()(F f) const
+    {
+        return coalesce_adaptor<F, Ts...>(static_cast<F&&>(f), window);
+    }
+};
+
+template<class... Ts>
+constexpr coalesce_window<Ts...> coalesce(std::chrono::nanoseconds window)
+{
+    return coalesce_window<Ts...>{window};
+}
+
+}} // namespace boost::hof
+
+#endif
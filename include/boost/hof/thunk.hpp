@@ -0,0 +1,284 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    thunk.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_THUNK_H
+#define BOOST_HOF_GUARD_THUNK_H
+
+/// thunk
+/// =====
+///
+/// Description
+/// -----------
+///
+/// The `thunk` function adaptor calls a nullary function at most once, and
+/// then returns a reference to its cached result. The result is stored
+/// inside the adaptor rather than on the heap, so it can be used for a
+/// default that is expensive to compute and might not be needed. Since it is
+/// a nullary function, it can be passed to [`eval`](eval) and
+/// [`apply_eval`](apply_eval) like any other thunk.
+///
+/// The `synchronized_thunk` function adaptor is the same, except it can be
+/// called from several threads. Once the result is computed, a call only
+/// loads a flag with acquire ordering. The `thunk` adaptor is not safe to
+/// call concurrently.
+///
+/// If the function throws, nothing is cached, and the function is called
+/// again on the next call. The `evaluated` member function returns whether
+/// the result is cached. A copy of the adaptor copies the cached result, if
+/// there is one, and caches its results separately afterwards, so consumers
+/// that should share the result need to share the same adaptor, such as
+/// with `std::ref`.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F>
+///     constexpr thunk_adaptor<F> thunk(F f);
+///
+///     template<class F>
+///     constexpr synchronized_thunk_adaptor<F> synchronized_thunk(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(thunk(f)() == f());
+///     assert(&t() == &t());
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable) with no parameters
+/// * MoveConstructible
+///
+/// The decayed result of F must be:
+///
+/// * CopyConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <functional>
+///
+///     int main() {
+///         int calls = 0;
+///         auto t = boost::hof::thunk([&]{ calls++; return 42; });
+///         assert(boost::hof::eval(std::ref(t)) == 42);
+///         assert(boost::hof::eval(std::ref(t)) == 42);
+///         assert(calls == 1);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [eval](eval)
+/// * [apply_eval](apply_eval)
+/// * [static_lazy](static_lazy)
+///
+
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class F>
+struct thunk_result
+: std::decay<decltype(std::declval<const F&>()())>
+{};
+
+template<class T>
+struct thunk_storage
+{
+    mutable typename std::aligned_storage<sizeof(T), alignof(T)>::type buffer;
+    mutable bool ready;
+
+    constexpr thunk_storage() noexcept
+    : buffer(), ready(false)
+    {}
+
+    thunk_storage(const thunk_storage& rhs)
+    : buffer(), ready(false)
+    {
+        if (rhs.ready)
+        {
+            ::new(static_cast<void*>(&buffer)) T(rhs.value());
+            ready = true;
+        }
+    }
+
+    thunk_storage& operator=(const thunk_storage&)=delete;
+
+    ~thunk_storage()
+    {
+        if (ready) value().~T();
+    }
+
+    const T& value() const noexcept
+    {
+        return *static_cast<const T*>(static_cast<const void*>(&buffer));
+    }
+
+    bool evaluated() const noexcept
+    {
+        return ready;
+    }
+
+    template<class F>
+    BOOST_HOF_INLINE const T& get(const F& f) const
+    {
+        if (!ready)
+        {
+            ::new(static_cast<void*>(&buffer)) T(f());
+            ready = true;
+        }
+        return value();
+    }
+};
+
+template<class T>
+struct synchronized_thunk_storage
+{
+    mutable typename std::aligned_storage<sizeof(T), alignof(T)>::type buffer;
+    mutable std::atomic<bool> ready;
+    mutable std::mutex m;
+
+    synchronized_thunk_storage() noexcept
+    : buffer(), ready(false)
+    {}
+
+    synchronized_thunk_storage(const synchronized_thunk_storage& rhs)
+    : buffer(), ready(false)
+    {
+        if (rhs.evaluated())
+        {
+            ::new(static_cast<void*>(&buffer)) T(rhs.value());
+            ready.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    synchronized_thunk_storage& operator=(const synchronized_thunk_storage&)=delete;
+
+    ~synchronized_thunk_storage()
+    {
+        if (ready.load(std::memory_order_relaxed)) value().~T();
+    }
+
+    const T& value() const noexcept
+    {
+        return *static_cast<const T*>(static_cast<const void*>(&buffer));
+    }
+
+    bool evaluated() const noexcept
+    {
+        return ready.load(std::memory_order_acquire);
+    }
+
+    template<class F>
+    const T& init(const F& f) const
+    {
+        std::lock_guard<std::mutex> lock(m);
+        if (!ready.load(std::memory_order_relaxed))
+        {
+            ::new(static_cast<void*>(&buffer)) T(f());
+            ready.store(true, std::memory_order_release);
+        }
+        return value();
+    }
+
+    template<class F>
+    BOOST_HOF_INLINE const T& get(const F& f) const
+    {
+        if (!ready.load(std::memory_order_acquire)) return this->init(f);
+        return value();
+    }
+};
+
+template<class F, template<class> class Storage>
+struct basic_thunk_adaptor : callable_base<F>
+{
+    typedef typename thunk_result<callable_base<F>>::type result_type;
+    Storage<result_type> storage;
+
+    BOOST_HOF_INHERIT_DEFAULT(basic_thunk_adaptor, callable_base<F>)
+
+    // A copy of the adaptor must not be sliced to the function, or the
+    // cached result would be lost
+    template<class X, typename std::enable_if<(
+        BOOST_HOF_IS_CONSTRUCTIBLE(callable_base<F>, X) &&
+        !std::is_base_of<basic_thunk_adaptor, typename std::decay<X>::type>::value
+    ), int>::type = 0>
+    constexpr basic_thunk_adaptor(X&& x)
+    : callable_base<F>(BOOST_HOF_FORWARD(X)(x)), storage()
+    {}
+
+    BOOST_HOF_INLINE constexpr const callable_base<F>& base_function() const noexcept
+    {
+        return *this;
+    }
+
+    bool evaluated() const noexcept
+    {
+        return storage.evaluated();
+    }
+
+    BOOST_HOF_INLINE const result_type& operator()() const
+    {
+        return storage.get(this->base_function());
+    }
+};
+
+}
+
+template<class F>
+struct thunk_adaptor : detail::basic_thunk_adaptor<F, detail::thunk_storage>
+{
+    typedef detail::basic_thunk_adaptor<F, detail::thunk_storage> base;
+    BOOST_HOF_INHERIT_DEFAULT(thunk_adaptor, base)
+
+    template<class X, typename std::enable_if<(
+        BOOST_HOF_IS_CONSTRUCTIBLE(base, X) &&
+        !std::is_base_of<base, typename std::decay<X>::type>::value
+    ), int>::type = 0>
+    constexpr thunk_adaptor(X&& x)
+    : base(BOOST_HOF_FORWARD(X)(x))
+    {}
+};
+
+template<class F>
+struct synchronized_thunk_adaptor : detail::basic_thunk_adaptor<F, detail::synchronized_thunk_storage>
+{
+    typedef detail::basic_thunk_adaptor<F, detail::synchronized_thunk_storage> base;
+    BOOST_HOF_INHERIT_DEFAULT(synchronized_thunk_adaptor, base)
+
+    template<class X, typename std::enable_if<(
+        BOOST_HOF_IS_CONSTRUCTIBLE(base, X) &&
+        !std::is_base_of<base, typename std::decay<X>::type>::value
+    ), int>::type = 0>
+    constexpr synchronized_thunk_adaptor(X&& x)
+    : base(BOOST_HOF_FORWARD(X)(x))
+    {}
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(thunk, detail::make<thunk_adaptor>);
+BOOST_HOF_DECLARE_STATIC_VAR(synchronized_thunk, detail::make<synchronized_thunk_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
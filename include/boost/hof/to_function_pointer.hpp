@@ -0,0 +1,148 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    to_function_pointer.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_TO_FUNCTION_POINTER_H
+#define BOOST_HOF_GUARD_TO_FUNCTION_POINTER_H
+
+/// to_function_pointer
+/// ===================
+///
+/// Description
+/// -----------
+///
+/// The `to_function_pointer` function returns a pointer to a function with
+/// the signature `Sig`, which calls a default constructed copy of the
+/// function object. Since the function object must be empty, every copy
+/// behaves the same, so the pointer can be passed to a C interface that
+/// takes a callback without a context pointer, such as `qsort`. The
+/// adaptors are empty when all of the functions they are given are empty,
+/// so a composition of stateless functions can be passed this way without
+/// allocating or holding any state.
+///
+/// When the signature returns void, the result of the function is
+/// discarded. When `Sig` is `noexcept`, the function pointer is `noexcept`
+/// too, and the function object must not throw.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Sig, class F>
+///     constexpr Sig* to_function_pointer(const F& f) noexcept;
+///
+/// Semantics
+/// ---------
+///
+///     assert(to_function_pointer<R(Args...)>(f)(xs...) == F()(xs...));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * Empty
+/// * DefaultConstructible
+/// * [ConstCallable](ConstCallable) with `Args...`, and the result
+///   convertible to `R`, unless `R` is void
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct increment
+///     {
+///         int operator()(int x) const
+///         {
+///             return x + 1;
+///         }
+///     };
+///
+///     int call_c_api(int (*callback)(int), int x)
+///     {
+///         return callback(x);
+///     }
+///
+///     int main() {
+///         auto f = boost::hof::compose(increment(), increment());
+///         assert(call_c_api(boost::hof::to_function_pointer<int(int)>(f), 1) == 3);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [function_ref](function_ref)
+/// * [lift](lift)
+///
+
+#include <boost/hof/detail/erased_call.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/intrinsics.hpp>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class F, class Sig>
+struct function_pointer_trampoline;
+
+template<class F, class R, class... Args>
+struct function_pointer_trampoline<F, R(Args...)>
+{
+    typedef R signature(Args...);
+
+    static R call(Args... xs)
+    {
+        const F f = F();
+        return erased_invoke<R>::call(f, BOOST_HOF_FORWARD(Args)(xs)...);
+    }
+};
+
+#if defined(__cpp_noexcept_function_type)
+template<class F, class R, class... Args>
+struct function_pointer_trampoline<F, R(Args...) noexcept>
+{
+    typedef R signature(Args...);
+
+    static R call(Args... xs) noexcept
+    {
+        const F f = F();
+        return erased_invoke<R>::call(f, BOOST_HOF_FORWARD(Args)(xs)...);
+    }
+};
+#endif
+
+template<class F, class Sig, class=void>
+struct is_function_pointer_convertible
+: std::false_type
+{};
+
+template<class F, class Sig>
+struct is_function_pointer_convertible<F, Sig, typename holder<
+    typename function_pointer_trampoline<F, Sig>::signature
+>::type>
+: std::integral_constant<bool, (
+    BOOST_HOF_IS_EMPTY(F) &&
+    BOOST_HOF_IS_DEFAULT_CONSTRUCTIBLE(F) &&
+    is_erased_callable<const F&, typename function_pointer_trampoline<F, Sig>::signature>::value
+)>
+{};
+
+}
+
+template<class Sig, class F, class=typename std::enable_if<
+    detail::is_function_pointer_convertible<F, Sig>::value
+>::type>
+constexpr Sig* to_function_pointer(const F&) noexcept
+{
+    return &detail::function_pointer_trampoline<F, Sig>::call;
+}
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,300 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    traced.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_TRACED_H
+#define BOOST_HOF_GUARD_TRACED_H
+
+/// traced
+/// ======
+///
+/// Description
+/// -----------
+///
+/// The `traced` function decorator samples one in every `Rate` calls of a
+/// function. For each sampled call, it writes a `trace_event` with the time
+/// the call started, how long it took, and the id of the function into a
+/// ring buffer owned by the calling thread. The calls that aren't sampled
+/// only increment a counter of the thread.
+///
+/// The events are read with `trace_drain`, which calls a function with each
+/// event that was written since the last time the buffers were drained. A
+/// thread never waits for `trace_drain`. When the buffer of a thread is
+/// full, the events are dropped until it is drained, and they are counted
+/// by `trace_dropped`.
+///
+/// The id of a function is given by `trace_id`, and the functions of the
+/// same type have the same id. Since the decorated function is only
+/// callable when the function is, each overload of a
+/// [`first_of`](first_of) or [`match`](match) can be traced on its own, so
+/// the id of an event shows which overload was selected. A traced function
+/// takes any arguments its function takes, so with `match` the overloads
+/// should not be callable with the same arguments, otherwise the call is
+/// ambiguous.
+///
+/// Synopsis
+/// --------
+///
+///     template<std::size_t Rate, class F>
+///     constexpr auto traced(F f);
+///
+///     template<class F>
+///     std::size_t trace_id(const F& f);
+///
+///     template<class F>
+///     std::size_t trace_drain(F f);
+///
+///     std::uint64_t trace_dropped();
+///
+///     struct trace_event
+///     {
+///         std::uint64_t timestamp;
+///         std::uint64_t duration;
+///         std::size_t id;
+///     };
+///
+/// Semantics
+/// ---------
+///
+///     assert(traced<Rate>(f)(xs...) == f(xs...));
+///
+/// Requirements
+/// ------------
+///
+/// Rate must be greater than 0.
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct int_f
+///     {
+///         int operator()(int) const
+///         {
+///             return 1;
+///         }
+///     };
+///
+///     struct pointer_f
+///     {
+///         int operator()(int*) const
+///         {
+///             return 2;
+///         }
+///     };
+///
+///     int main() {
+///         auto f = boost::hof::first_of(boost::hof::traced<1>(int_f()), boost::hof::traced<1>(pointer_f()));
+///         assert(f(nullptr) == 2);
+///         std::size_t id = 0;
+///         boost::hof::trace_drain([&](const boost::hof::trace_event& e) { id = e.id; });
+///         assert(id == boost::hof::trace_id(pointer_f()));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [decorate](decorate)
+/// * [profiled](profiled)
+///
+
+#include <boost/hof/decorate.hpp>
+#include <boost/hof/returns.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <boost/hof/detail/thread_block.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+struct trace_event
+{
+    // The time the call started and how long it took, in nanoseconds
+    std::uint64_t timestamp;
+    std::uint64_t duration;
+    std::size_t id;
+};
+
+namespace detail {
+
+inline std::size_t trace_next_id() noexcept
+{
+    static std::atomic<std::size_t> id(0);
+    return ++id;
+}
+
+template<class F>
+struct trace_function_id
+{
+    static std::size_t get() noexcept
+    {
+        static const std::size_t id = trace_next_id();
+        return id;
+    }
+};
+
+// The ring buffer has a single producer, which is the thread that owns it,
+// and the consumer is the thread draining it under the drain lock. The
+// producer only writes to an event once the consumer has moved past it.
+struct trace_block
+{
+    trace_event events[BOOST_HOF_TRACE_BUFFER_SIZE];
+    std::atomic<std::uint64_t> head;
+    std::atomic<std::uint64_t> tail;
+    std::atomic<std::uint64_t> dropped;
+    std::atomic<bool> in_use;
+    trace_block * next;
+
+    trace_block() : next(nullptr)
+    {
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        dropped.store(0, std::memory_order_relaxed);
+        in_use.store(true, std::memory_order_relaxed);
+    }
+
+    void push(const trace_event& e) noexcept
+    {
+        std::uint64_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == BOOST_HOF_TRACE_BUFFER_SIZE)
+        {
+            dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+        events[h % BOOST_HOF_TRACE_BUFFER_SIZE] = e;
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    template<class F>
+    std::size_t drain(F& f)
+    {
+        std::uint64_t t = tail.load(std::memory_order_relaxed);
+        std::uint64_t h = head.load(std::memory_order_acquire);
+        for (std::uint64_t i = t; i != h; i++) f(static_cast<const trace_event&>(events[i % BOOST_HOF_TRACE_BUFFER_SIZE]));
+        tail.store(h, std::memory_order_release);
+        return std::size_t(h - t);
+    }
+};
+
+inline std::mutex& trace_drain_mutex()
+{
+    static std::mutex m;
+    return m;
+}
+
+inline std::uint64_t trace_now() noexcept
+{
+    return std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count());
+}
+
+// The calls are counted for each function type, by each thread
+template<std::size_t Rate, class F>
+struct trace_sampler
+{
+    static bool sample() noexcept
+    {
+        static thread_local std::size_t n = 0;
+        if (++n < Rate) return false;
+        n = 0;
+        return true;
+    }
+};
+
+struct trace_timer
+{
+    std::size_t id;
+    std::uint64_t start;
+
+    trace_timer(bool sampled, std::size_t idp) noexcept
+    : id(sampled ? idp : 0), start(sampled ? trace_now() : 0)
+    {}
+
+    // The event is written when the call returns or throws
+    ~trace_timer()
+    {
+        if (id == 0) return;
+        trace_event e = { start, trace_now() - start, id };
+        thread_block<trace_block>::this_thread().push(e);
+    }
+};
+
+struct traced_f
+{
+    template<std::size_t Rate, class F, class... Ts>
+    auto operator()(std::integral_constant<std::size_t, Rate>, const F& f, Ts&&... xs) const
+    -> decltype(f(BOOST_HOF_FORWARD(Ts)(xs)...))
+    {
+        static_assert(Rate > 0, "The sampling rate must be greater than 0");
+        trace_timer timer(trace_sampler<Rate, F>::sample(), trace_function_id<F>::get());
+        return f(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+template<std::size_t Rate>
+struct traced_decoration
+: decoration<callable_base<traced_f>, std::integral_constant<std::size_t, Rate>>
+{
+    typedef decoration<callable_base<traced_f>, std::integral_constant<std::size_t, Rate>> base;
+
+    constexpr traced_decoration()
+    : base(traced_f(), std::integral_constant<std::size_t, Rate>())
+    {}
+};
+
+}
+
+template<class F>
+std::size_t trace_id(const F&) noexcept
+{
+    return detail::trace_function_id<detail::callable_base<F>>::get();
+}
+
+template<class F>
+std::size_t trace_drain(F f)
+{
+    std::lock_guard<std::mutex> lock(detail::trace_drain_mutex());
+    std::size_t n = 0;
+    for (detail::trace_block* b = detail::thread_block<detail::trace_block>::head().load(std::memory_order_acquire); b != nullptr; b = b->next)
+        n += b->drain(f);
+    return n;
+}
+
+inline std::uint64_t trace_dropped() noexcept
+{
+    std::uint64_t n = 0;
+    for (detail::trace_block* b = detail::thread_block<detail::trace_block>::head().load(std::memory_order_acquire); b != nullptr; b = b->next)
+        n += b->dropped.load(std::memory_order_relaxed);
+    return n;
+}
+
+#if BOOST_HOF_HAS_VARIABLE_TEMPLATES
+template<std::size_t Rate>
+static constexpr detail::traced_decoration<Rate> traced = {};
+#else
+template<std::size_t Rate, class F>
+constexpr auto traced(F f) BOOST_HOF_RETURNS
+(
+    detail::traced_decoration<Rate>()(boost::hof::move(f))
+);
+#endif
+
+}} // namespace boost::hof
+
+#endif
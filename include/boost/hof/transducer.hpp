@@ -0,0 +1,274 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    transducer.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_TRANSDUCER_H
+#define BOOST_HOF_GUARD_TRANSDUCER_H
+
+/// transducer
+/// ==========
+///
+/// Description
+/// -----------
+///
+/// The `mapping`, `filtering` and `taking` functions return transducers,
+/// which take a reducer, that is a binary function called with the state and
+/// an element like the function of [`fold`](fold), and return a new reducer.
+/// The reducer of `mapping(f)` passes `f(x)` instead of the element, the
+/// reducer of `filtering(p)` only passes the elements for which `p(x)` is
+/// true, and returns the state unchanged for the others, and the reducer of
+/// `taking(n)` only passes the first `n` elements.
+///
+/// Transducers are composed with [`compose`](compose), and the elements go
+/// through them from left to right, so the composition is one reducer that
+/// does all of the steps for each element, without any intermediate range.
+/// The same reducer can then be used by [`fold`](fold), by
+/// [`parallel_fold`](parallel_fold) with a combine function, or by
+/// `std::accumulate`.
+///
+/// Since `taking` has to count the elements, the state of its reducer is a
+/// `std::pair` of the state and the number of elements that were passed,
+/// which starts from zero. The elements after the first `n` are still
+/// visited, but they are ignored. The count depends on the order of the
+/// elements, so a reducer of `taking` can't be used by `parallel_fold`.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F>
+///     constexpr mapping_adaptor<F> mapping(F f);
+///
+///     template<class Predicate>
+///     constexpr filtering_adaptor<Predicate> filtering(Predicate p);
+///
+///     constexpr taking_adaptor taking(std::size_t n);
+///
+/// Semantics
+/// ---------
+///
+///     assert(mapping(f)(r)(s, x) == r(s, f(x)));
+///     assert(filtering(p)(r)(s, x) == (p(x) ? r(s, x) : s));
+///     assert(taking(n)(r)(std::make_pair(s, i), x) == (i < n ? std::make_pair(r(s, x), i + 1) : std::make_pair(s, i)));
+///
+/// Requirements
+/// ------------
+///
+/// F and Predicate must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// The reducer must be:
+///
+/// * [BinaryInvocable](BinaryInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int main() {
+///         using namespace boost::hof;
+///         auto xf = compose(filtering(_ % 2 == 0), mapping(_ * _));
+///         // Sums the squares of the even numbers
+///         assert(fold(xf(_ + _), 0)(1, 2, 3, 4) == 20);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [fold](fold)
+/// * [parallel_fold](parallel_fold)
+/// * [Transducers](https://clojure.org/reference/transducers)
+///
+
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class F, class Reducer>
+struct mapping_reducer
+: detail::compressed_pair<detail::callable_base<F>, detail::callable_base<Reducer>>
+{
+    typedef detail::compressed_pair<detail::callable_base<F>, detail::callable_base<Reducer>> base;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(mapping_reducer, base)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<Reducer>& base_reducer(Ts&&... xs) const noexcept
+    {
+        return this->second(xs...);
+    }
+
+    BOOST_HOF_RETURNS_CLASS(mapping_reducer);
+
+    template<class State, class T>
+    BOOST_HOF_INLINE constexpr auto operator()(State&& s, T&& x) const BOOST_HOF_RETURNS
+    (
+        (BOOST_HOF_MANGLE_CAST(const detail::callable_base<Reducer>&)(BOOST_HOF_CONST_THIS->base_reducer(s)))(
+            BOOST_HOF_FORWARD(State)(s),
+            (BOOST_HOF_MANGLE_CAST(const detail::callable_base<F>&)(BOOST_HOF_CONST_THIS->base_function(s)))(BOOST_HOF_FORWARD(T)(x))
+        )
+    );
+};
+
+template<class Predicate, class Reducer>
+struct filtering_reducer
+: detail::compressed_pair<detail::callable_base<Predicate>, detail::callable_base<Reducer>>
+{
+    typedef detail::compressed_pair<detail::callable_base<Predicate>, detail::callable_base<Reducer>> base;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(filtering_reducer, base)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<Predicate>& base_predicate(Ts&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<Reducer>& base_reducer(Ts&&... xs) const noexcept
+    {
+        return this->second(xs...);
+    }
+
+    BOOST_HOF_RETURNS_CLASS(filtering_reducer);
+
+    // Only one of the branches moves the state
+    template<class State, class T>
+    BOOST_HOF_INLINE constexpr auto operator()(State&& s, T&& x) const BOOST_HOF_RETURNS
+    (
+        (BOOST_HOF_MANGLE_CAST(const detail::callable_base<Predicate>&)(BOOST_HOF_CONST_THIS->base_predicate(s)))(x) ?
+        (BOOST_HOF_MANGLE_CAST(const detail::callable_base<Reducer>&)(BOOST_HOF_CONST_THIS->base_reducer(s)))(
+            BOOST_HOF_FORWARD(State)(s), BOOST_HOF_FORWARD(T)(x)
+        ) :
+        BOOST_HOF_FORWARD(State)(s)
+    );
+};
+
+template<class Reducer>
+struct taking_reducer
+: detail::compressed_pair<detail::callable_base<Reducer>, std::size_t>
+{
+    typedef detail::compressed_pair<detail::callable_base<Reducer>, std::size_t> base;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(taking_reducer, base)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<Reducer>& base_reducer(Ts&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr std::size_t get_count(Ts&&... xs) const noexcept
+    {
+        return this->second(xs...);
+    }
+
+    BOOST_HOF_RETURNS_CLASS(taking_reducer);
+
+    template<class State, class T, class Pair=typename std::decay<State>::type>
+    BOOST_HOF_INLINE constexpr auto operator()(State&& s, T&& x) const BOOST_HOF_RETURNS
+    (
+        s.second < BOOST_HOF_CONST_THIS->get_count(s) ?
+        Pair(
+            (BOOST_HOF_MANGLE_CAST(const detail::callable_base<Reducer>&)(BOOST_HOF_CONST_THIS->base_reducer(s)))(
+                BOOST_HOF_FORWARD(State)(s).first, BOOST_HOF_FORWARD(T)(x)
+            ),
+            s.second + 1
+        ) :
+        Pair(BOOST_HOF_FORWARD(State)(s))
+    );
+};
+
+}
+
+template<class F>
+struct mapping_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(mapping_adaptor, detail::callable_base<F>)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class Reducer>
+    constexpr detail::mapping_reducer<F, Reducer> operator()(Reducer r) const
+    BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(detail::mapping_reducer<F, Reducer>, const detail::callable_base<F>&, Reducer&&)
+    {
+        return detail::mapping_reducer<F, Reducer>(this->base_function(r), boost::hof::move(r));
+    }
+};
+
+template<class Predicate>
+struct filtering_adaptor : detail::callable_base<Predicate>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(filtering_adaptor, detail::callable_base<Predicate>)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<Predicate>& base_predicate(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class Reducer>
+    constexpr detail::filtering_reducer<Predicate, Reducer> operator()(Reducer r) const
+    BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(detail::filtering_reducer<Predicate, Reducer>, const detail::callable_base<Predicate>&, Reducer&&)
+    {
+        return detail::filtering_reducer<Predicate, Reducer>(this->base_predicate(r), boost::hof::move(r));
+    }
+};
+
+struct taking_adaptor
+{
+    std::size_t n;
+
+    template<class Reducer>
+    constexpr detail::taking_reducer<Reducer> operator()(Reducer r) const
+    BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(detail::taking_reducer<Reducer>, Reducer&&, const std::size_t&)
+    {
+        return detail::taking_reducer<Reducer>(boost::hof::move(r), n);
+    }
+};
+
+namespace detail {
+
+struct taking_f
+{
+    constexpr taking_adaptor operator()(std::size_t n) const noexcept
+    {
+        return taking_adaptor{n};
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(mapping, detail::make<mapping_adaptor>);
+BOOST_HOF_DECLARE_STATIC_VAR(filtering, detail::make<filtering_adaptor>);
+BOOST_HOF_DECLARE_STATIC_VAR(taking, detail::taking_f);
+
+}} // namespace boost::hof
+
+#endif
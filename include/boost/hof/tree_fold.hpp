@@ -0,0 +1,213 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tree_fold.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_TREE_FOLD_H
+#define BOOST_HOF_GUARD_TREE_FOLD_H
+
+/// tree_fold
+/// =========
+///
+/// Description
+/// -----------
+///
+/// The `tree_fold` function adaptor uses a binary function to apply a
+/// [fold](https://en.wikipedia.org/wiki/Fold_%28higher-order_function%29)
+/// operation to the arguments passed to the function, like [`fold`](fold),
+/// except the arguments are reduced pairwise in a balanced tree instead of
+/// one at a time. Additionally, an optional initial state can be provided,
+/// which is used as the first argument.
+///
+/// The binary function is always called with the left part of the arguments
+/// first and the right part second, so for any associative function the
+/// result is the same as `fold`. Since the tree only has a logarithmic depth,
+/// this reduces the template instantiation depth, and the independent partial
+/// results can be computed in parallel by the processor.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F, class State>
+///     constexpr tree_fold_adaptor<F, State> tree_fold(F f, State s);
+///
+///     template<class F>
+///     constexpr tree_fold_adaptor<F> tree_fold(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(tree_fold(f, z)(xs...) == tree_fold(f)(z, xs...));
+///     assert(tree_fold(f)(x) == x);
+///     assert(tree_fold(f)(x, y) == f(x, y));
+///     assert(tree_fold(f)(xs..., ys...) == f(tree_fold(f)(xs...), tree_fold(f)(ys...)));
+///
+/// Where `sizeof...(xs)` is half of the number of arguments, rounded down.
+///
+/// Requirements
+/// ------------
+///
+/// State must be:
+///
+/// * CopyConstructible
+///
+/// F must be:
+///
+/// * [BinaryInvocable](BinaryInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct sum_f
+///     {
+///         template<class T, class U>
+///         constexpr T operator()(T x, U y) const
+///         {
+///             return x + y;
+///         }
+///     };
+///     int main() {
+///         assert(boost::hof::tree_fold(sum_f())(1, 2, 3, 4, 5) == 15);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [Fold](https://en.wikipedia.org/wiki/Fold_(higher-order_function))
+/// * [fold](fold)
+///
+
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/detail/type_at.hpp>
+#include <boost/hof/pack.hpp>
+
+namespace boost { namespace hof { namespace detail {
+
+template<std::size_t I, std::size_t... Ns, class... Ts>
+constexpr typename type_at<I, Ts...>::type tree_fold_get(const pack_base<seq<Ns...>, Ts...>& p) noexcept
+{
+    return boost::hof::detail::pack_get<typename type_at<I, Ts...>::type, pack_tag<seq<I>, Ts...>>(p);
+}
+
+// Reduces the arguments in the range [First, Last) of the pack
+template<std::size_t First, std::size_t Last, class=void>
+struct tree_fold_range
+{};
+
+template<std::size_t First, std::size_t Last>
+struct tree_fold_range<First, Last, typename std::enable_if<(Last - First == 1)>::type>
+{
+    template<class F, class P>
+    static constexpr auto call(const F&, const P& p) BOOST_HOF_RETURNS
+    (
+        boost::hof::detail::tree_fold_get<First>(p)
+    );
+};
+
+template<std::size_t First, std::size_t Last>
+struct tree_fold_range<First, Last, typename std::enable_if<(Last - First > 1)>::type>
+{
+    template<class F, class P>
+    static constexpr auto call(const F& f, const P& p) BOOST_HOF_RETURNS
+    (
+        f(
+            tree_fold_range<First, First + (Last - First)/2>::call(f, p),
+            tree_fold_range<First + (Last - First)/2, Last>::call(f, p)
+        )
+    );
+};
+
+struct v_tree_fold
+{
+    template<class F, class T, class... Ts>
+    BOOST_HOF_INLINE constexpr auto operator()(const F& f, T&& x, Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        detail::tree_fold_range<0, sizeof...(Ts)+1>::call(f, detail::pack_forward_f()(BOOST_HOF_FORWARD(T)(x), BOOST_HOF_FORWARD(Ts)(xs)...))
+    );
+
+    template<class F, class State>
+    BOOST_HOF_INLINE constexpr State operator()(const F&, State&& state) const noexcept
+    {
+        return BOOST_HOF_FORWARD(State)(state);
+    }
+};
+
+}
+
+template<class F, class State=void>
+struct tree_fold_adaptor
+: detail::compressed_pair<detail::callable_base<F>, State>
+{
+    typedef detail::compressed_pair<detail::callable_base<F>, State> base_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(tree_fold_adaptor, base_type)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    template<class... Ts>
+    constexpr State get_state(Ts&&... xs) const noexcept
+    {
+        return this->second(xs...);
+    }
+
+    BOOST_HOF_RETURNS_CLASS(tree_fold_adaptor);
+
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(tree_fold, Ts...)>
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(detail::v_tree_fold, id_<const detail::callable_base<F>&>, id_<State>, id_<Ts>...)
+    operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
+    (
+        detail::v_tree_fold()(
+            BOOST_HOF_MANGLE_CAST(const detail::callable_base<F>&)(BOOST_HOF_CONST_THIS->base_function(xs...)),
+            BOOST_HOF_MANGLE_CAST(State)(BOOST_HOF_CONST_THIS->get_state(xs...)),
+            BOOST_HOF_FORWARD(Ts)(xs)...
+        )
+    )
+};
+
+
+template<class F>
+struct tree_fold_adaptor<F, void>
+: detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(tree_fold_adaptor, detail::callable_base<F>)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    BOOST_HOF_RETURNS_CLASS(tree_fold_adaptor);
+
+    template<class... Ts BOOST_HOF_DETAIL_CALL_MARKER(tree_fold, Ts...)>
+    BOOST_HOF_INLINE constexpr BOOST_HOF_SFINAE_RESULT(detail::v_tree_fold, id_<const detail::callable_base<F>&>, id_<Ts>...)
+    operator()(Ts&&... xs) const BOOST_HOF_SFINAE_RETURNS
+    (
+        detail::v_tree_fold()(
+            BOOST_HOF_MANGLE_CAST(const detail::callable_base<F>&)(BOOST_HOF_CONST_THIS->base_function(xs...)),
+            BOOST_HOF_FORWARD(Ts)(xs)...
+        )
+    )
+};
+
+BOOST_HOF_DETAIL_COMPILE_MARKER(tree_fold, tree_fold_adaptor)
+
+BOOST_HOF_DECLARE_STATIC_VAR(tree_fold, detail::make<tree_fold_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
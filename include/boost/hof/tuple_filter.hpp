@@ -0,0 +1,180 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tuple_filter.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_TUPLE_FILTER_H
+#define BOOST_HOF_GUARD_TUPLE_FILTER_H
+
+/// tuple_filter
+/// ============
+///
+/// Description
+/// -----------
+///
+/// The `tuple_filter` function returns a `std::tuple` of the decayed
+/// elements of a sequence for which the predicate is true. The predicate is
+/// only used for the type that it returns for each element, which must be
+/// an integral constant, so it is never called. The sequence can be anything
+/// that can be unpacked with [`unpack`](unpack).
+///
+/// The positions of the elements that are kept are computed from a
+/// `constexpr` array of the results of the predicate, so the number of
+/// templates that are instantiated doesn't grow with each element that is
+/// dropped, as it does when each element is turned into a sequence of zero
+/// or one elements that are then joined together. Each element that is kept
+/// is forwarded once, so the elements of an rvalue sequence are moved.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Sequence, class Predicate>
+///     constexpr auto tuple_filter(Sequence&& s, Predicate p);
+///
+/// Semantics
+/// ---------
+///
+///     assert(tuple_filter(make_tuple(xs...), p) == tuple_cat(conditional_t<decltype(p(xs))::value, tuple<decltype(xs)>, tuple<>>(xs)...));
+///
+/// Requirements
+/// ------------
+///
+/// Sequence must be:
+///
+/// * [Unpackable](Unpackable)
+///
+/// Predicate must be:
+///
+/// * A function object that returns an IntegralConstant for each element
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <tuple>
+///     #include <type_traits>
+///
+///     struct is_integer
+///     {
+///         template<class T>
+///         std::is_integral<T> operator()(T) const;
+///     };
+///
+///     int main() {
+///         auto t = boost::hof::tuple_filter(std::make_tuple(1, 2.0, 'x', 3L), is_integer());
+///         assert(t == std::make_tuple(1, 'x', 3L));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [unpack](unpack)
+/// * [tuple_join](tuple_join)
+/// * [tuple_transform](tuple_transform)
+///
+
+#include <boost/hof/construct.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<bool... Bs>
+struct tuple_filter_index
+{
+    static constexpr bool keep[sizeof...(Bs)+1] = { Bs..., false };
+
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    static constexpr std::size_t size()
+    {
+        std::size_t n = 0;
+        for(std::size_t i = 0; i < sizeof...(Bs); i++) if (keep[i]) n++;
+        return n;
+    }
+
+    // The index of the Kth element that is kept
+    static constexpr std::size_t at(std::size_t k)
+    {
+        std::size_t i = 0;
+        for(;; i++)
+        {
+            if (!keep[i]) continue;
+            if (k == 0) break;
+            k--;
+        }
+        return i;
+    }
+#else
+    static constexpr std::size_t size(std::size_t i=0)
+    {
+        return i == sizeof...(Bs) ? 0 : (keep[i] ? 1 : 0) + size(i+1);
+    }
+
+    // The index of the Kth element that is kept, starting from I
+    static constexpr std::size_t at(std::size_t k, std::size_t i=0)
+    {
+        return keep[i] ? (k == 0 ? i : at(k-1, i+1)) : at(k, i+1);
+    }
+#endif
+};
+
+template<bool... Bs>
+constexpr bool tuple_filter_index<Bs...>::keep[sizeof...(Bs)+1];
+
+template<class P, class T>
+struct tuple_filter_keep
+: std::decay<decltype(std::declval<const P&>()(std::declval<T>()))>::type
+{};
+
+// The elements are taken from a tuple of references with std::get, which
+// doesn't instantiate anything that grows with the number of elements
+template<class Index, std::size_t... Ns, class Refs>
+constexpr auto tuple_filter_select(seq<Ns...>, Refs&& refs) BOOST_HOF_RETURNS
+(
+    boost::hof::construct<std::tuple>()(std::get<Index::at(Ns)>(BOOST_HOF_FORWARD(Refs)(refs))...)
+);
+
+template<class Index, class Refs>
+constexpr std::tuple<> tuple_filter_select(seq<>, Refs&&) noexcept
+{
+    return {};
+}
+
+template<class P>
+struct tuple_filter_invoke
+{
+    template<class... Ts, class Index=tuple_filter_index<tuple_filter_keep<P, Ts>::value...>>
+    constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        boost::hof::detail::tuple_filter_select<Index>(typename gens<Index::size()>::type(), 
+            std::tuple<Ts&&...>(BOOST_HOF_FORWARD(Ts)(xs)...)
+        )
+    );
+};
+
+struct tuple_filter_f
+{
+    template<class Sequence, class P>
+    BOOST_HOF_INLINE constexpr auto operator()(Sequence&& s, P) const BOOST_HOF_RETURNS
+    (
+        boost::hof::unpack(tuple_filter_invoke<P>())(BOOST_HOF_FORWARD(Sequence)(s))
+    );
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(tuple_filter, detail::tuple_filter_f);
+
+}} // namespace boost::hof
+
+#endif
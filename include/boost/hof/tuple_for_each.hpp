@@ -0,0 +1,96 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tuple_for_each.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_TUPLE_FOR_EACH_H
+#define BOOST_HOF_GUARD_TUPLE_FOR_EACH_H
+
+/// tuple_for_each
+/// ==============
+///
+/// Description
+/// -----------
+///
+/// The `tuple_for_each` function calls a function on each element of a
+/// sequence, in order, and then returns the function. The sequence can be
+/// anything that can be unpacked with [`unpack`](unpack), and the elements
+/// are forwarded to the function, so it can modify the elements of an lvalue
+/// sequence, or move from the elements of an rvalue sequence.
+///
+/// Since the function is called for its side effects on the elements, the
+/// elements are never copied into an array like
+/// [`tuple_transform`](tuple_transform) does.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Sequence, class F>
+///     constexpr F tuple_for_each(Sequence&& s, F&& f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(tuple_for_each(make_tuple(xs...), f) == (f(xs), ..., f));
+///
+/// Requirements
+/// ------------
+///
+/// Sequence must be:
+///
+/// * [Unpackable](Unpackable)
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <tuple>
+///
+///     int main() {
+///         int s = 0;
+///         boost::hof::tuple_for_each(std::make_tuple(1, 2, 3), [&](int x) { s = s * 10 + x; });
+///         assert(s == 123);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [unpack](unpack)
+/// * [proj](proj)
+/// * [tuple_transform](tuple_transform)
+///
+
+#include <boost/hof/proj.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+struct tuple_for_each_f
+{
+    template<class Sequence, class F>
+    constexpr auto operator()(Sequence&& s, F&& f) const BOOST_HOF_RETURNS
+    (
+        boost::hof::unpack(boost::hof::proj(f))(BOOST_HOF_FORWARD(Sequence)(s)), typename std::decay<F>::type(BOOST_HOF_FORWARD(F)(f))
+    );
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(tuple_for_each, detail::tuple_for_each_f);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,191 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tuple_for_each_fused.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_TUPLE_FOR_EACH_FUSED_H
+#define BOOST_HOF_GUARD_TUPLE_FOR_EACH_FUSED_H
+
+/// tuple_for_each_fused
+/// ====================
+///
+/// Description
+/// -----------
+///
+/// The `tuple_for_each_fused` function is like
+/// [`tuple_for_each`](tuple_for_each), except the elements that are
+/// trivially copyable are passed to a second function as bytes, with a
+/// pointer to the first byte and the number of bytes. Consecutive elements
+/// that are laid out next to each other, without padding between them, are
+/// passed together in one call, so a visitor that writes each element to a
+/// buffer can copy the run of elements as one block. The other elements,
+/// and elements that are empty, are passed to the first function, in order.
+///
+/// Whether the elements are next to each other is checked from their
+/// addresses, and the checks are folded away by the optimizer when the
+/// layout is known, such as the fields of an aggregate or the elements of an
+/// array. The elements of a `std::tuple` are often stored in reverse order,
+/// so they are passed separately.
+///
+/// The pointer is to `unsigned char`, unless one of the elements is const,
+/// then it is to `const unsigned char`.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Sequence, class F, class G>
+///     void tuple_for_each_fused(Sequence&& s, F&& f, G&& g);
+///
+/// Requirements
+/// ------------
+///
+/// Sequence must be:
+///
+/// * [Unpackable](Unpackable)
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable) with each element that isn't passed as
+///   bytes
+///
+/// G must be:
+///
+/// * [ConstInvocable](ConstInvocable) with a byte pointer and a `std::size_t`
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <array>
+///     #include <cassert>
+///     #include <cstddef>
+///
+///     int main() {
+///         std::array<int, 3> a = {{ 1, 2, 3 }};
+///         int calls = 0;
+///         std::size_t bytes = 0;
+///         boost::hof::tuple_for_each_fused(a, [](int) {}, [&](const unsigned char*, std::size_t n) {
+///             calls++;
+///             bytes += n;
+///         });
+///         assert(calls == 1);
+///         assert(bytes == sizeof(a));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [tuple_for_each](tuple_for_each)
+/// * [serialize_into](serialize)
+///
+
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/detail/and.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/intrinsics.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class T, class U=typename std::remove_cv<typename std::remove_reference<T>::type>::type>
+struct is_fusable
+: std::integral_constant<bool, (
+    std::is_trivially_copyable<U>::value && !BOOST_HOF_IS_EMPTY(U)
+)>
+{};
+
+// Keeps the run of bytes that is pending, which is extended while the next
+// element starts where the run ends
+template<class Byte, class F, class G>
+struct fused_visitor
+{
+    const F& f;
+    const G& g;
+    Byte* data;
+    std::size_t size;
+
+    fused_visitor(const F& fp, const G& gp) : f(fp), g(gp), data(nullptr), size(0)
+    {}
+
+    void flush() const
+    {
+        if (size != 0) g(data, size);
+    }
+
+    template<class T>
+    void visit(T&& x, std::true_type)
+    {
+        typedef typename std::conditional<std::is_const<Byte>::value, const void*, void*>::type pointer;
+        Byte* p = static_cast<Byte*>(static_cast<pointer>(std::addressof(x)));
+        if (size != 0 && data + size == p)
+        {
+            size += sizeof(x);
+        }
+        else
+        {
+            this->flush();
+            data = p;
+            size = sizeof(x);
+        }
+    }
+
+    template<class T>
+    void visit(T&& x, std::false_type)
+    {
+        this->flush();
+        size = 0;
+        f(BOOST_HOF_FORWARD(T)(x));
+    }
+
+    template<class... Ts>
+    void operator()(Ts&&... xs)
+    {
+        (void)std::initializer_list<int>{(this->visit(BOOST_HOF_FORWARD(Ts)(xs), is_fusable<Ts>()), 0)...};
+        this->flush();
+    }
+};
+
+template<class F, class G>
+struct fused_apply
+{
+    const F& f;
+    const G& g;
+
+    template<class... Ts>
+    void operator()(Ts&&... xs) const
+    {
+        typedef typename std::conditional<
+            BOOST_HOF_AND_UNPACK(!std::is_const<typename std::remove_reference<Ts>::type>::value),
+            unsigned char,
+            const unsigned char
+        >::type byte;
+        fused_visitor<byte, F, G>(f, g)(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+struct tuple_for_each_fused_f
+{
+    template<class Sequence, class F, class G>
+    void operator()(Sequence&& s, F&& f, G&& g) const
+    {
+        typedef typename std::decay<F>::type function_type;
+        typedef typename std::decay<G>::type block_function_type;
+        boost::hof::unpack(fused_apply<function_type, block_function_type>{f, g})(BOOST_HOF_FORWARD(Sequence)(s));
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(tuple_for_each_fused, detail::tuple_for_each_fused_f);
+
+}} // namespace boost::hof
+
+#endif
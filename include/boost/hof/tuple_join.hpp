@@ -0,0 +1,181 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tuple_join.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_TUPLE_JOIN_H
+#define BOOST_HOF_GUARD_TUPLE_JOIN_H
+
+/// tuple_join
+/// ==========
+///
+/// Description
+/// -----------
+///
+/// The `tuple_join` function takes a sequence of sequences, and returns a
+/// `std::tuple` of the decayed elements of each sequence in order. The
+/// sequences can be anything that can be unpacked with [`unpack`](unpack).
+///
+/// For each element of the result, the sequence it comes from and its
+/// position in that sequence are computed from a `constexpr` array of the
+/// sizes of the sequences, so the result is built in one step instead of
+/// concatenating the sequences one at a time. Each sequence is unpacked only
+/// once, and each element is forwarded once, so the elements of rvalue
+/// sequences are moved.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Sequence>
+///     constexpr auto tuple_join(Sequence&& s);
+///
+/// Semantics
+/// ---------
+///
+///     assert(tuple_join(make_tuple(make_tuple(xs...), make_tuple(ys...))) == make_tuple(xs..., ys...));
+///
+/// Requirements
+/// ------------
+///
+/// Sequence must be:
+///
+/// * [Unpackable](Unpackable) with elements that are [Unpackable](Unpackable)
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <tuple>
+///
+///     int main() {
+///         auto t = boost::hof::tuple_join(std::make_tuple(std::make_tuple(1, 2), std::make_tuple(), std::make_tuple('x')));
+///         assert(t == std::make_tuple(1, 2, 'x'));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [unpack](unpack)
+/// * [tuple_filter](tuple_filter)
+/// * [tuple_transform](tuple_transform)
+///
+
+#include <boost/hof/arg.hpp>
+#include <boost/hof/construct.hpp>
+#include <boost/hof/tuple_zip_with.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <cstddef>
+#include <tuple>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<std::size_t... Ns>
+struct tuple_join_index
+{
+    static constexpr std::size_t sizes[sizeof...(Ns)+1] = { Ns..., 0 };
+
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    static constexpr std::size_t size()
+    {
+        std::size_t n = 0;
+        for(std::size_t i = 0; i < sizeof...(Ns); i++) n += sizes[i];
+        return n;
+    }
+
+    // The sequence that the Kth element comes from
+    static constexpr std::size_t outer(std::size_t k)
+    {
+        std::size_t i = 0;
+        for(; k >= sizes[i]; i++) k -= sizes[i];
+        return i;
+    }
+
+    // The position of the Kth element in its sequence
+    static constexpr std::size_t inner(std::size_t k)
+    {
+        for(std::size_t i = 0; k >= sizes[i]; i++) k -= sizes[i];
+        return k;
+    }
+#else
+    static constexpr std::size_t size(std::size_t i=0)
+    {
+        return i == sizeof...(Ns) ? 0 : sizes[i] + size(i+1);
+    }
+
+    // The sequence that the Kth element comes from, starting from I
+    static constexpr std::size_t outer(std::size_t k, std::size_t i=0)
+    {
+        return k < sizes[i] ? i : outer(k - sizes[i], i+1);
+    }
+
+    // The position of the Kth element in its sequence, starting from I
+    static constexpr std::size_t inner(std::size_t k, std::size_t i=0)
+    {
+        return k < sizes[i] ? k : inner(k - sizes[i], i+1);
+    }
+#endif
+};
+
+template<std::size_t... Ns>
+constexpr std::size_t tuple_join_index<Ns...>::sizes[sizeof...(Ns)+1];
+
+struct tuple_join_refs
+{
+    template<class... Ts>
+    constexpr std::tuple<Ts&&...> operator()(Ts&&... xs) const noexcept
+    {
+        return std::tuple<Ts&&...>(BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+// Each sequence is unpacked once into a tuple of references, so taking an
+// element only needs std::get on one of the tuples
+template<class Index, std::size_t... Ks, class... Rs>
+constexpr auto tuple_join_select(seq<Ks...>, Rs&&... rs) BOOST_HOF_RETURNS
+(
+    boost::hof::construct<std::tuple>()(
+        std::get<Index::inner(Ks)>(boost::hof::detail::get_args<Index::outer(Ks)+1>(BOOST_HOF_FORWARD(Rs)(rs)...))...
+    )
+);
+
+template<class Index, class... Rs>
+constexpr std::tuple<> tuple_join_select(seq<>, Rs&&...) noexcept
+{
+    return {};
+}
+
+struct tuple_join_invoke
+{
+    template<class... Ts, class Index=tuple_join_index<tuple_zip_with_size<Ts>::value...>>
+    constexpr auto operator()(Ts&&... xs) const BOOST_HOF_RETURNS
+    (
+        boost::hof::detail::tuple_join_select<Index>(typename gens<Index::size()>::type(), 
+            boost::hof::unpack(tuple_join_refs())(BOOST_HOF_FORWARD(Ts)(xs))...
+        )
+    );
+};
+
+struct tuple_join_f
+{
+    template<class Sequence>
+    BOOST_HOF_INLINE constexpr auto operator()(Sequence&& s) const BOOST_HOF_RETURNS
+    (
+        boost::hof::unpack(tuple_join_invoke())(BOOST_HOF_FORWARD(Sequence)(s))
+    );
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(tuple_join, detail::tuple_join_f);
+
+}} // namespace boost::hof
+
+#endif
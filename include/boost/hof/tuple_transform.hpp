@@ -0,0 +1,96 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tuple_transform.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_TUPLE_TRANSFORM_H
+#define BOOST_HOF_GUARD_TUPLE_TRANSFORM_H
+
+/// tuple_transform
+/// ===============
+///
+/// Description
+/// -----------
+///
+/// The `tuple_transform` function calls a function on each element of a
+/// sequence, and returns a `std::tuple` of the decayed results. The sequence
+/// can be anything that can be unpacked with [`unpack`](unpack).
+///
+/// The function is called on each element directly, without going through a
+/// loop or an intermediate array, so when the elements are all of the same
+/// arithmetic type the calls can be vectorized by the optimizer like any
+/// other straight-line code.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Sequence, class F>
+///     constexpr auto tuple_transform(Sequence&& s, F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(tuple_transform(make_tuple(xs...), f) == make_tuple(f(xs)...));
+///
+/// Requirements
+/// ------------
+///
+/// Sequence must be:
+///
+/// * [Unpackable](Unpackable)
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <tuple>
+///
+///     int main() {
+///         auto t = boost::hof::tuple_transform(std::make_tuple(1, 2, 3), boost::hof::_ * 2);
+///         assert(t == std::make_tuple(2, 4, 6));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [unpack](unpack)
+/// * [proj](proj)
+/// * [tuple_for_each](tuple_for_each)
+/// * [tuple_zip_with](tuple_zip_with)
+///
+
+#include <boost/hof/construct.hpp>
+#include <boost/hof/proj.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <tuple>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+struct tuple_transform_f
+{
+    template<class Sequence, class F>
+    BOOST_HOF_INLINE constexpr auto operator()(Sequence&& s, F f) const BOOST_HOF_RETURNS
+    (
+        boost::hof::unpack(boost::hof::proj(f, boost::hof::construct<std::tuple>()))(BOOST_HOF_FORWARD(Sequence)(s))
+    );
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(tuple_transform, detail::tuple_transform_f);
+
+}} // namespace boost::hof
+
+#endif
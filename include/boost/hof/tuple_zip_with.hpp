@@ -0,0 +1,132 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tuple_zip_with.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_TUPLE_ZIP_WITH_H
+#define BOOST_HOF_GUARD_TUPLE_ZIP_WITH_H
+
+/// tuple_zip_with
+/// ==============
+///
+/// Description
+/// -----------
+///
+/// The `tuple_zip_with` function calls a binary function on the elements at
+/// the same position of two sequences, and returns a `std::tuple` of the
+/// decayed results. The sequences can be anything that can be unpacked with
+/// [`unpack`](unpack), and must have the same number of elements.
+///
+/// Like [`tuple_transform`](tuple_transform), the function is called on
+/// each pair of elements directly, so the calls can be vectorized by the
+/// optimizer when the elements are of the same arithmetic type.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Sequence1, class Sequence2, class F>
+///     constexpr auto tuple_zip_with(Sequence1&& s1, Sequence2&& s2, F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(tuple_zip_with(make_tuple(xs...), make_tuple(ys...), f) == make_tuple(f(xs, ys)...));
+///
+/// Requirements
+/// ------------
+///
+/// Sequence1 and Sequence2 must be:
+///
+/// * [Unpackable](Unpackable)
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <tuple>
+///
+///     int main() {
+///         auto t = boost::hof::tuple_zip_with(std::make_tuple(1, 2, 3), std::make_tuple(4, 5, 6), boost::hof::_ + boost::hof::_);
+///         assert(t == std::make_tuple(5, 7, 9));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [unpack](unpack)
+/// * [tuple_transform](tuple_transform)
+///
+
+#include <boost/hof/arg.hpp>
+#include <boost/hof/construct.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <boost/hof/detail/holder.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+struct tuple_zip_with_size_f
+{
+    template<class... Ts>
+    constexpr std::integral_constant<std::size_t, sizeof...(Ts)> operator()(Ts&&...) const noexcept
+    {
+        return {};
+    }
+};
+
+template<class Sequence, class=void>
+struct tuple_zip_with_size
+{};
+
+template<class Sequence>
+struct tuple_zip_with_size<Sequence, typename holder<
+    decltype(boost::hof::unpack(tuple_zip_with_size_f())(std::declval<Sequence>()))
+>::type>
+: decltype(boost::hof::unpack(tuple_zip_with_size_f())(std::declval<Sequence>()))
+{};
+
+// Each sequence is unpacked once for every position, and only the element
+// at that position is forwarded, so an rvalue sequence gives up each of its
+// elements only once
+template<class F, class Sequence1, class Sequence2, std::size_t... Ns>
+constexpr auto tuple_zip_with_each(seq<Ns...>, Sequence1&& s1, Sequence2&& s2, const F& f) BOOST_HOF_RETURNS
+(
+    boost::hof::construct<std::tuple>()(f(
+        boost::hof::unpack(make_args_f<std::size_t, Ns+1>())(BOOST_HOF_FORWARD(Sequence1)(s1)),
+        boost::hof::unpack(make_args_f<std::size_t, Ns+1>())(BOOST_HOF_FORWARD(Sequence2)(s2))
+    )...)
+);
+
+struct tuple_zip_with_f
+{
+    template<class Sequence1, class Sequence2, class F,
+        class Size=tuple_zip_with_size<Sequence1>,
+        class=typename std::enable_if<(Size::value == tuple_zip_with_size<Sequence2>::value)>::type>
+    BOOST_HOF_INLINE constexpr auto operator()(Sequence1&& s1, Sequence2&& s2, F f) const BOOST_HOF_RETURNS
+    (
+        boost::hof::detail::tuple_zip_with_each(typename gens<Size::value>::type(), BOOST_HOF_FORWARD(Sequence1)(s1), BOOST_HOF_FORWARD(Sequence2)(s2), f)
+    );
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(tuple_zip_with, detail::tuple_zip_with_f);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,288 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    type_switch.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_TYPE_SWITCH_H
+#define BOOST_HOF_GUARD_TYPE_SWITCH_H
+
+/// type_switch
+/// ===========
+///
+/// Description
+/// -----------
+///
+/// The `type_switch` function adaptor calls the first function whose first
+/// parameter is a reference to a class that the dynamic type of the
+/// argument derives from, like a chain of `dynamic_cast`s to each of those
+/// classes would. The classes are taken from the parameters of the
+/// functions, so each function must have a single call operator that isn't
+/// a template, such as a lambda that isn't generic, or be a function
+/// pointer. A function that takes a reference to `Base` matches every
+/// argument, so it can be the default, otherwise `std::bad_cast` is thrown
+/// when no function matches.
+///
+/// The casts only run the first time an argument of a dynamic type is seen,
+/// and the function that matched, along with the offset of its class in the
+/// object, is kept in a table for the type. Each thread also keeps the last
+/// type that it looked up, so when the same type is passed again, the call
+/// only compares the type, and then calls the function through a table of
+/// function pointers, like [`dispatch_index`](dispatch_index).
+///
+/// The classes of the functions must appear only once in the objects that
+/// are passed. The arguments after the first one are passed to the function
+/// that matched as they are.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Base, class... Fs>
+///     constexpr type_switch_adaptor<Base, Fs...> type_switch(Fs... fs);
+///
+/// Semantics
+/// ---------
+///
+///     assert(type_switch<Base>(fs...)(x, xs...) == first_of(fs...)(dynamic cast of x to the first class that matches, xs...));
+///
+/// Requirements
+/// ------------
+///
+/// Base must be a polymorphic class.
+///
+/// Fs must be:
+///
+/// * [ConstInvocable](ConstInvocable), with a single call operator whose
+///   first parameter is a reference to a class that is derived from `Base`
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct shape
+///     {
+///         virtual ~shape() {}
+///     };
+///
+///     struct circle : shape
+///     {
+///         int r = 1;
+///     };
+///
+///     struct square : shape
+///     {
+///         int side = 2;
+///     };
+///
+///     int main() {
+///         auto size = boost::hof::type_switch<shape>(
+///             [](const circle& c) { return c.r; },
+///             [](const square& s) { return s.side; },
+///             [](const shape&) { return 0; }
+///         );
+///         circle c;
+///         square s;
+///         shape x;
+///         assert(size(static_cast<const shape&>(c)) == 1);
+///         assert(size(static_cast<const shape&>(s)) == 2);
+///         assert(size(x) == 0);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [first_of](first_of)
+/// * [dispatch_index](dispatch_index)
+///
+
+#include <boost/hof/dispatch_index.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/type_at.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class Sig>
+struct type_switch_signature;
+
+template<class R, class C, class A, class... As>
+struct type_switch_signature<R (C::*)(A, As...) const>
+{
+    typedef A type;
+};
+
+template<class R, class A, class... As>
+struct type_switch_signature<R (*)(A, As...)>
+{
+    typedef A type;
+};
+
+#if defined(__cpp_noexcept_function_type)
+template<class R, class C, class A, class... As>
+struct type_switch_signature<R (C::*)(A, As...) const noexcept>
+{
+    typedef A type;
+};
+
+template<class R, class A, class... As>
+struct type_switch_signature<R (*)(A, As...) noexcept>
+{
+    typedef A type;
+};
+#endif
+
+template<class F, class=void>
+struct type_switch_parameter
+: type_switch_signature<decltype(&F::operator())>
+{};
+
+template<class F>
+struct type_switch_parameter<F, typename std::enable_if<std::is_pointer<F>::value>::type>
+: type_switch_signature<F>
+{};
+
+template<class F, class Base>
+struct type_switch_case
+{
+    typedef typename type_switch_parameter<F>::type parameter;
+    static_assert(std::is_lvalue_reference<parameter>::value, "The first parameter of the function must be an lvalue reference");
+    typedef typename std::remove_cv<typename std::remove_reference<parameter>::type>::type type;
+    static_assert(std::is_base_of<Base, type>::value, "The first parameter of the function must be derived from the base class");
+};
+
+template<class T, class U>
+struct type_switch_copy_const
+: std::conditional<std::is_const<T>::value, const U, U>
+{};
+
+struct type_switch_entry
+{
+    const std::type_info* type;
+    std::size_t index;
+    // The offset of the class of the function from the start of the object
+    std::ptrdiff_t offset;
+};
+
+template<class Base, class... Cases>
+struct type_switch_table
+{
+    template<class Case>
+    static void try_case(Base* p, std::size_t i, type_switch_entry& e)
+    {
+        if (e.index != sizeof...(Cases)) return;
+        Case* q = dynamic_cast<Case*>(p);
+        if (q == nullptr) return;
+        e.index = i;
+        e.offset = reinterpret_cast<char*>(q) - static_cast<char*>(dynamic_cast<void*>(p));
+    }
+
+    template<std::size_t... Ns>
+    static type_switch_entry compute(seq<Ns...>, Base* p)
+    {
+        type_switch_entry e = { &typeid(*p), sizeof...(Cases), 0 };
+        (void)std::initializer_list<int>{(type_switch_table::template try_case<Cases>(p, Ns, e), 0)...};
+        return e;
+    }
+
+    // The casts run once for each dynamic type
+    static type_switch_entry find(Base* p)
+    {
+        static std::mutex m;
+        static std::vector<type_switch_entry> entries;
+        const std::type_info& t = typeid(*p);
+        std::lock_guard<std::mutex> lock(m);
+        for (const auto& e : entries)
+        {
+            if (*e.type == t) return e;
+        }
+        entries.push_back(type_switch_table::compute(typename gens<sizeof...(Cases)>::type(), p));
+        return entries.back();
+    }
+
+    static const type_switch_entry& lookup(Base* p)
+    {
+        static thread_local type_switch_entry last = { nullptr, 0, 0 };
+        if (last.type == nullptr || *last.type != typeid(*p)) last = type_switch_table::find(p);
+        return last;
+    }
+};
+
+template<class S, class Base, class... Fs>
+struct type_switch_adaptor_base;
+
+template<std::size_t... Ns, class Base, class... Fs>
+struct type_switch_adaptor_base<seq<Ns...>, Base, Fs...>
+: pack_base<seq<Ns...>, callable_base<Fs>...>
+{
+    static_assert(std::is_polymorphic<Base>::value, "The base class must be polymorphic");
+
+    typedef pack_base<seq<Ns...>, callable_base<Fs>...> base_type;
+    typedef type_switch_table<Base, typename type_switch_case<Fs, Base>::type...> table_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(type_switch_adaptor_base, base_type)
+
+    template<std::size_t I, class Q>
+    struct case_of
+    : type_switch_copy_const<Q, typename type_switch_case<typename type_at<I, Fs...>::type, Base>::type>
+    {};
+
+    template<std::size_t I, class R, class Q, class... Ts>
+    static R call(const type_switch_adaptor_base& self, char* p, Ts&&... xs)
+    {
+        typedef typename case_of<I, Q>::type case_type;
+        return boost::hof::alias_value<pack_tag<seq<I>, callable_base<Fs>...>, callable_base<typename type_at<I, Fs...>::type>>(self, xs...)(
+            *reinterpret_cast<case_type*>(p), BOOST_HOF_FORWARD(Ts)(xs)...
+        );
+    }
+
+    template<class T, class... Ts,
+        class Q=typename std::remove_reference<T>::type,
+        class=typename std::enable_if<std::is_base_of<Base, typename std::remove_cv<Q>::type>::value>::type,
+        class R=typename dispatch_index_result<
+            decltype(std::declval<const callable_base<Fs>&>()(std::declval<typename case_of<Ns, Q>::type&>(), std::declval<Ts>()...))...
+        >::type>
+    R operator()(T&& x, Ts&&... xs) const
+    {
+        typedef R (*entry_type)(const type_switch_adaptor_base&, char*, Ts&&...);
+        static constexpr entry_type table[] = { &type_switch_adaptor_base::template call<Ns, R, Q, Ts...>... };
+        Base* p = const_cast<Base*>(static_cast<const Base*>(std::addressof(x)));
+        const type_switch_entry& e = table_type::lookup(p);
+        if (e.index == sizeof...(Fs)) throw std::bad_cast();
+        return table[e.index](*this, static_cast<char*>(dynamic_cast<void*>(p)) + e.offset, BOOST_HOF_FORWARD(Ts)(xs)...);
+    }
+};
+
+}
+
+template<class Base, class... Fs>
+struct type_switch_adaptor
+: detail::type_switch_adaptor_base<typename detail::gens<sizeof...(Fs)>::type, Base, Fs...>
+{
+    typedef detail::type_switch_adaptor_base<typename detail::gens<sizeof...(Fs)>::type, Base, Fs...> base_type;
+    BOOST_HOF_INHERIT_CONSTRUCTOR(type_switch_adaptor, base_type)
+};
+
+template<class Base, class... Fs>
+constexpr type_switch_adaptor<Base, Fs...> type_switch(Fs... fs)
+{
+    return type_switch_adaptor<Base, Fs...>(static_cast<Fs&&>(fs)...);
+}
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,136 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    typed.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_TYPED_H
+#define BOOST_HOF_GUARD_TYPED_H
+
+/// typed
+/// =====
+///
+/// Description
+/// -----------
+///
+/// The `typed` function adaptor gives a function a fixed signature. The
+/// adaptor has a call operator that is not a template, which takes the
+/// parameters of the signature and returns its return type, so a call never
+/// needs to deduce the return type of the function. The arguments are
+/// converted to the parameter types, like any other non-template function.
+///
+/// The adaptor provides a nested `result_type`, which is used by
+/// [`compose`](compose) and [`flow`](flow) to declare their own return type
+/// without calling the functions in an unevaluated context. So a deep
+/// composition of typed functions only checks that the innermost function
+/// can be called with the arguments, instead of nesting the deduced return
+/// type of every function, which can exceed the template depth of the
+/// compiler.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Signature, class F>
+///     constexpr typed_adaptor<Signature, F> typed(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(typed<R(Args...)>(f)(xs...) == static_cast<R>(f(static_cast<Args>(xs)...)));
+///
+/// Requirements
+/// ------------
+///
+/// Signature must be a function type `R(Args...)`.
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     struct increment
+///     {
+///         template<class T>
+///         T operator()(T x) const
+///         {
+///             return x + 1;
+///         }
+///     };
+///
+///     int main() {
+///         auto f = boost::hof::typed<int(int)>(increment());
+///         static_assert(std::is_same<decltype(f)::result_type, int>::value, "Not the same type");
+///         assert(f(1.5) == 2);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [result](result)
+/// * [compose](compose)
+///
+
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/move.hpp>
+
+namespace boost { namespace hof {
+
+template<class Signature, class F>
+struct typed_adaptor;
+
+template<class R, class... Args, class F>
+struct typed_adaptor<R(Args...), F> : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(typed_adaptor, detail::callable_base<F>)
+
+    typedef R result_type;
+
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function() const noexcept
+    {
+        return *this;
+    }
+
+    // A void result is not constexpr without relaxed constexpr, in which
+    // case the call operator of the specialization is not constexpr
+    BOOST_HOF_INLINE constexpr result_type operator()(Args... xs) const
+    {
+        return this->base_function()(static_cast<Args&&>(xs)...);
+    }
+};
+
+#if BOOST_HOF_HAS_VARIABLE_TEMPLATES
+namespace typed_detail {
+template<class Signature>
+struct typed_f
+{
+    template<class F>
+    BOOST_HOF_INLINE constexpr typed_adaptor<Signature, F> operator()(F f) const
+    {
+        return typed_adaptor<Signature, F>(boost::hof::move(f));
+    }
+};
+
+}
+
+template<class Signature>
+static constexpr auto typed = typed_detail::typed_f<Signature>{};
+#else
+template<class Signature, class F>
+constexpr typed_adaptor<Signature, F> typed(F f)
+BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(typed_adaptor<Signature, F>, F&&)
+{
+    return typed_adaptor<Signature, F>(boost::hof::move(f));
+}
+#endif
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,268 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    unfold.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_UNFOLD_H
+#define BOOST_HOF_GUARD_UNFOLD_H
+
+/// unfold
+/// ======
+///
+/// Description
+/// -----------
+///
+/// The `unfold` function adaptor returns a function that produces a lazy
+/// range of the states of a loop, like [`repeat_while`](repeat_while), except
+/// each state is visited instead of only the final one. Starting with the
+/// value it is called with, the range has each state for which the predicate
+/// is true, and the function is called on a state to get the next one. So the
+/// range ends before the state that `repeat_while` would return.
+///
+/// Nothing is computed until the range is iterated, and nothing is buffered.
+/// The iterator stores the current state inside of it, so the range is an
+/// input range that can be used with a range-based `for` loop. The range is
+/// also a view that can be passed to [`map`](map), [`filter`](filter) and
+/// [`fold_into`](fold_into), in which case the states are visited with a
+/// plain loop, which is inlined with the other stages of the pipeline.
+///
+/// Synopsis
+/// --------
+///
+///     template<class Predicate, class F>
+///     constexpr unfold_adaptor<Predicate, F> unfold(Predicate p, F f);
+///
+/// Semantics
+/// ---------
+///
+///     for(auto&& x:unfold(p, f)(x0)) g(x);
+///     // calls g the same as
+///     for(auto x = x0; p(x); x = f(x)) g(x);
+///
+/// Requirements
+/// ------------
+///
+/// Predicate must be:
+///
+/// * [UnaryInvocable](UnaryInvocable)
+/// * MoveConstructible
+///
+/// F must be:
+///
+/// * [UnaryInvocable](UnaryInvocable)
+/// * MoveConstructible
+///
+/// The decayed state must be:
+///
+/// * CopyConstructible
+/// * MoveAssignable from the result of F
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <vector>
+///
+///     int main() {
+///         std::vector<int> v;
+///         for(int x:boost::hof::unfold(boost::hof::_ < 20, boost::hof::_ * 2)(1)) v.push_back(x);
+///         assert((v == std::vector<int>{ 1, 2, 4, 8, 16 }));
+///         int sum = boost::hof::unfold(boost::hof::_ < 20, boost::hof::_ * 2)(1) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0);
+///         assert(sum == 31);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [repeat_while](repeat_while)
+/// * [map](map)
+/// * [fold_into](fold_into)
+///
+
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/compressed_pair.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <boost/hof/detail/range_view.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+template<class P, class F, class T>
+struct unfold_range : detail::range_view_base
+{
+    P p;
+    F f;
+    T init;
+
+    template<class Q, class G, class X>
+    constexpr unfold_range(Q&& q, G&& g, X&& x)
+    : p(BOOST_HOF_FORWARD(Q)(q)), f(BOOST_HOF_FORWARD(G)(g)), init(BOOST_HOF_FORWARD(X)(x))
+    {}
+
+    // The state is only constructed while the iterator isn't at the end, so
+    // the end iterator doesn't need a state
+    class iterator
+    {
+        const unfold_range* r;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type buffer;
+        bool done;
+
+        T& state() noexcept
+        {
+            return *static_cast<T*>(static_cast<void*>(&buffer));
+        }
+
+        void construct(const T& x)
+        {
+            ::new(static_cast<void*>(&buffer)) T(x);
+            if (!r->p(state())) this->reset();
+        }
+
+        void reset() noexcept
+        {
+            state().~T();
+            done = true;
+        }
+
+        friend struct unfold_range;
+
+        explicit iterator(const unfold_range* rp)
+        : r(rp), buffer(), done(false)
+        {
+            this->construct(rp->init);
+        }
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        iterator() noexcept
+        : r(nullptr), buffer(), done(true)
+        {}
+
+        iterator(const iterator& rhs)
+        : r(rhs.r), buffer(), done(rhs.done)
+        {
+            if (!done) ::new(static_cast<void*>(&buffer)) T(*rhs);
+        }
+
+        iterator& operator=(const iterator& rhs)
+        {
+            if (this != &rhs)
+            {
+                if (!done) this->reset();
+                r = rhs.r;
+                if (!rhs.done)
+                {
+                    ::new(static_cast<void*>(&buffer)) T(*rhs);
+                    done = false;
+                }
+            }
+            return *this;
+        }
+
+        ~iterator()
+        {
+            if (!done) state().~T();
+        }
+
+        const T& operator*() const noexcept
+        {
+            return *static_cast<const T*>(static_cast<const void*>(&buffer));
+        }
+
+        const T* operator->() const noexcept
+        {
+            return &**this;
+        }
+
+        BOOST_HOF_INLINE iterator& operator++()
+        {
+            state() = r->f(static_cast<const T&>(state()));
+            if (!r->p(static_cast<const T&>(state()))) this->reset();
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator result = *this;
+            ++*this;
+            return result;
+        }
+
+        // Only the end is compared in a loop over an input range
+        friend bool operator==(const iterator& x, const iterator& y) noexcept
+        {
+            return x.done == y.done;
+        }
+
+        friend bool operator!=(const iterator& x, const iterator& y) noexcept
+        {
+            return x.done != y.done;
+        }
+    };
+
+    iterator begin() const
+    {
+        return iterator(this);
+    }
+
+    iterator end() const noexcept
+    {
+        return iterator();
+    }
+
+    template<class Sink>
+    BOOST_HOF_INLINE void for_each(Sink&& sink) const
+    {
+        for(T x = init; p(static_cast<const T&>(x)); x = f(static_cast<const T&>(x))) sink(static_cast<const T&>(x));
+    }
+};
+
+template<class P, class F>
+struct unfold_adaptor
+: detail::compressed_pair<detail::callable_base<P>, detail::callable_base<F>>
+{
+    typedef detail::compressed_pair<detail::callable_base<P>, detail::callable_base<F>> base_type;
+
+    BOOST_HOF_INHERIT_CONSTRUCTOR(unfold_adaptor, base_type)
+
+    template<class... Ts>
+    constexpr const detail::callable_base<P>& base_predicate(Ts&&... xs) const noexcept
+    {
+        return this->first(xs...);
+    }
+
+    template<class... Ts>
+    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return this->second(xs...);
+    }
+
+    template<class T>
+    constexpr unfold_range<detail::callable_base<P>, detail::callable_base<F>, typename std::decay<T>::type>
+    operator()(T&& x) const
+    {
+        return unfold_range<detail::callable_base<P>, detail::callable_base<F>, typename std::decay<T>::type>(
+            this->base_predicate(x), this->base_function(x), BOOST_HOF_FORWARD(T)(x)
+        );
+    }
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(unfold, detail::make<unfold_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
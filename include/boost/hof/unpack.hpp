@@ -64,13 +64,15 @@
 
 #include <boost/hof/unpack_sequence.hpp>
 #include <boost/hof/is_unpackable.hpp>
+#include <boost/hof/detail/unpack_tuple.hpp>
 #include <boost/hof/detail/seq.hpp>
-#include <boost/hof/capture.hpp>
+#include <boost/hof/pack.hpp>
 #include <boost/hof/always.hpp>
 #include <boost/hof/reveal.hpp>
 #include <boost/hof/detail/and.hpp>
 #include <boost/hof/detail/delegate.hpp>
 #include <boost/hof/detail/holder.hpp>
+#include <boost/hof/detail/index_count.hpp>
 #include <boost/hof/detail/move.hpp>
 #include <boost/hof/detail/make.hpp>
 #include <boost/hof/detail/static_const_var.hpp>
@@ -80,17 +82,38 @@ namespace boost { namespace hof {
 namespace detail {
 
 template<class F, class Sequence>
-constexpr auto unpack_simple(F&& f, Sequence&& s) BOOST_HOF_RETURNS
+BOOST_HOF_HOST_DEVICE constexpr auto unpack_simple(F&& f, Sequence&& s) BOOST_HOF_RETURNS
 (
     detail::unpack_impl(BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(Sequence)(s))
 )
 
-template<class F, class... Sequences>
-constexpr auto unpack_join(F&& f, Sequences&&... s) BOOST_HOF_RETURNS
+// Sequences that are unpacked with `get` are concatenated directly,
+// without joining the packs of each one
+template<class T>
+struct is_tuple_unpackable
+: std::is_base_of<unpack_tuple_apply, unpack_sequence<typename std::remove_cv<typename std::remove_reference<T>::type>::type>>
+{};
+
+template<class F, class... Sequences, typename std::enable_if<(
+    !BOOST_HOF_AND_UNPACK(is_tuple_unpackable<Sequences>::value)
+), int>::type = 0>
+BOOST_HOF_HOST_DEVICE constexpr auto unpack_join(F&& f, Sequences&&... s) BOOST_HOF_RETURNS
 (
     boost::hof::pack_join(unpack_simple(boost::hof::pack_forward, BOOST_HOF_FORWARD(Sequences)(s))...)(BOOST_HOF_FORWARD(F)(f))
 );
 
+template<class F, class... Sequences, typename std::enable_if<(
+    BOOST_HOF_AND_UNPACK(is_tuple_unpackable<Sequences>::value)
+), int>::type = 0>
+BOOST_HOF_HOST_DEVICE constexpr auto unpack_join(F&& f, Sequences&&... s) BOOST_HOF_RETURNS
+(
+    boost::hof::detail::unpack_get::unpack_tuple_concat<std::tuple_size<typename std::remove_cv<typename std::remove_reference<Sequences>::type>::type>::value...>(
+        BOOST_HOF_FORWARD(F)(f),
+        boost::hof::detail::concat_refs<typename gens<sizeof...(Sequences)>::type, Sequences&&...>(BOOST_HOF_FORWARD(Sequences)(s)...),
+        typename gens<boost::hof::detail::index_sum(std::tuple_size<typename std::remove_cv<typename std::remove_reference<Sequences>::type>::type>::value...)>::type()
+    )
+);
+
 }
 
 template<class F>
@@ -100,9 +123,9 @@ struct unpack_adaptor : detail::callable_base<F>
     BOOST_HOF_INHERIT_CONSTRUCTOR(unpack_adaptor, detail::callable_base<F>);
 
     template<class... Ts>
-    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
     {
-        return boost::hof::always_ref(*this)(xs...);
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
     }
 
     struct unpack_failure
@@ -158,8 +181,8 @@ struct unpack_adaptor : detail::callable_base<F>
     BOOST_HOF_RETURNS_CLASS(unpack_adaptor);
     template<class T, class=typename std::enable_if<(
         is_unpackable<T>::value
-    )>::type>
-    constexpr auto operator()(T&& x) const
+    )>::type BOOST_HOF_DETAIL_CALL_MARKER(unpack, T)>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(T&& x) const
     BOOST_HOF_RETURNS
     (
         boost::hof::detail::unpack_simple(BOOST_HOF_MANGLE_CAST(const detail::callable_base<F>&)(BOOST_HOF_CONST_THIS->base_function(x)), BOOST_HOF_FORWARD(T)(x))
@@ -167,13 +190,15 @@ struct unpack_adaptor : detail::callable_base<F>
 
     template<class T, class... Ts, class=typename std::enable_if<(
         is_unpackable<T>::value && BOOST_HOF_AND_UNPACK(is_unpackable<Ts>::value)
-    )>::type>
-    constexpr auto operator()(T&& x, Ts&&... xs) const BOOST_HOF_RETURNS
+    )>::type BOOST_HOF_DETAIL_CALL_MARKER(unpack, T, Ts...)>
+    BOOST_HOF_HOST_DEVICE BOOST_HOF_INLINE constexpr auto operator()(T&& x, Ts&&... xs) const BOOST_HOF_RETURNS
     (
         boost::hof::detail::unpack_join(BOOST_HOF_MANGLE_CAST(const detail::callable_base<F>&)(BOOST_HOF_CONST_THIS->base_function(x)), BOOST_HOF_FORWARD(T)(x), BOOST_HOF_FORWARD(Ts)(xs)...)
     );
 };
 
+BOOST_HOF_DETAIL_COMPILE_MARKER(unpack, unpack_adaptor)
+
 BOOST_HOF_DECLARE_STATIC_VAR(unpack, detail::make<unpack_adaptor>);
 
 }} // namespace boost::hof
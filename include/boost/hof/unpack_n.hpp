@@ -0,0 +1,179 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    unpack_n.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_UNPACK_N_H
+#define BOOST_HOF_GUARD_UNPACK_N_H
+
+/// unpack_n
+/// ========
+///
+/// Description
+/// -----------
+///
+/// The `unpack_n` function adaptor calls a function with the elements of a
+/// range whose size is only known at runtime, but is at most `MaxN`. The call
+/// for each size is looked up in a table of function pointers that is built
+/// at compile time, like [`dispatch_index`](dispatch_index), so the size is
+/// dispatched in constant time instead of a chain of comparisons. The
+/// function can be an overload set, such as [`first_of`](first_of) or
+/// [`match`](match), with an overload for each number of arguments.
+///
+/// If all the calls return the same type, then that is the result type.
+/// Otherwise, the results are converted to their `std::common_type`. If the
+/// size of the range is greater than `MaxN`, then `std::out_of_range` is
+/// thrown.
+///
+/// Synopsis
+/// --------
+///
+///     template<std::size_t MaxN, class F>
+///     constexpr unpack_n_adaptor<MaxN, F> unpack_n(F f);
+///
+/// Semantics
+/// ---------
+///
+///     assert(unpack_n<MaxN>(f)(r) == f(r[0], ..., r[r.size()-1]));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable) with 0 to `MaxN` elements of the range
+/// * MoveConstructible
+///
+/// The range must have a `size()` member function and an `operator[]` to
+/// access its elements, such as `std::vector` or `std::span`.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <vector>
+///
+///     struct count
+///     {
+///         template<class... Ts>
+///         int operator()(Ts&&...) const
+///         {
+///             return sizeof...(Ts);
+///         }
+///     };
+///
+///     int main() {
+///         std::vector<int> v = { 1, 2, 3 };
+///         assert(boost::hof::unpack_n<8>(count())(v) == 3);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [unpack](unpack)
+/// * [dispatch_index](dispatch_index)
+///
+
+#include <boost/hof/always.hpp>
+#include <boost/hof/dispatch_index.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/move.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+template<class S, class F, class Range>
+struct unpack_n_entry;
+
+template<std::size_t... Ns, class F, class Range>
+struct unpack_n_entry<seq<Ns...>, F, Range>
+{
+    typedef decltype(std::declval<const F&>()(std::declval<Range&>()[Ns]...)) type;
+
+    template<class R>
+    static R call(const F& f, Range& r)
+    {
+        return f(r[Ns]...);
+    }
+};
+
+template<class S, class F, class Range>
+struct unpack_n_table;
+
+template<std::size_t... Ns, class F, class Range>
+struct unpack_n_table<seq<Ns...>, F, Range>
+{
+    typedef typename dispatch_index_result<
+        typename unpack_n_entry<typename gens<Ns>::type, F, Range>::type...
+    >::type result_type;
+
+    static result_type call(const F& f, Range& r)
+    {
+        typedef result_type (*entry_type)(const F&, Range&);
+        static constexpr entry_type table[] = {
+            &unpack_n_entry<typename gens<Ns>::type, F, Range>::template call<result_type>...
+        };
+        if (r.size() >= sizeof...(Ns)) throw std::out_of_range("unpack_n: the range has more elements than MaxN");
+        return table[r.size()](f, r);
+    }
+};
+
+}
+
+template<std::size_t MaxN, class F>
+struct unpack_n_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(unpack_n_adaptor, detail::callable_base<F>)
+
+    template<class... Ts>
+    BOOST_HOF_INLINE constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class Range, class Table=detail::unpack_n_table<
+        typename detail::gens<MaxN+1>::type, detail::callable_base<F>, typename std::remove_reference<Range>::type
+    >>
+    BOOST_HOF_INLINE typename Table::result_type operator()(Range&& r) const
+    {
+        return Table::call(this->base_function(r), r);
+    }
+};
+
+#if BOOST_HOF_HAS_VARIABLE_TEMPLATES
+namespace unpack_n_detail {
+template<std::size_t MaxN>
+struct unpack_n_f
+{
+    template<class F>
+    BOOST_HOF_INLINE constexpr unpack_n_adaptor<MaxN, F> operator()(F f) const
+    {
+        return unpack_n_adaptor<MaxN, F>(boost::hof::move(f));
+    }
+};
+
+}
+
+template<std::size_t MaxN>
+static constexpr auto unpack_n = unpack_n_detail::unpack_n_f<MaxN>{};
+#else
+template<std::size_t MaxN, class F>
+constexpr unpack_n_adaptor<MaxN, F> unpack_n(F f)
+BOOST_HOF_NOEXCEPT_CONSTRUCTIBLE(unpack_n_adaptor<MaxN, F>, F&&)
+{
+    return unpack_n_adaptor<MaxN, F>(boost::hof::move(f));
+}
+#endif
+
+}} // namespace boost::hof
+
+#endif
@@ -12,10 +12,23 @@
 /// ===============
 /// 
 /// How to unpack a sequence can be defined by specializing `unpack_sequence`.
-/// By default, `std::tuple` is already specialized. To implement this, one
+/// By default, `std::tuple`, `std::pair` and `std::array` are already
+/// specialized, though `std::array` needs [std_sequences](std_sequences)
+/// when `BOOST_HOF_UNPACK_STD_SEQUENCES` is set to 0. To implement this, one
 /// needs to provide a static `apply` function which will unpack the sequence
 /// to the parameters of the function.
 /// 
+/// In C++17, aggregates that aren't specialized are unpacked by their fields
+/// with structured bindings, so a plain struct can be unpacked without
+/// specializing `unpack_sequence`. The fields of an rvalue aggregate are
+/// forwarded as rvalues. The number of fields is detected by how many
+/// initializers the aggregate accepts, so it can have at most 32 fields,
+/// unless structured binding packs are available. Empty aggregates, unions,
+/// and aggregates with base classes or fields that are non-const references
+/// aren't unpackable. Unless structured binding packs are available,
+/// aggregates with fields that are arrays aren't unpackable either. This can
+/// be disabled by setting `BOOST_HOF_UNPACK_AGGREGATES` to 0.
+/// 
 /// Synopsis
 /// --------
 /// 
@@ -57,14 +70,14 @@
 /// 
 
 #include <boost/hof/config.hpp>
+#include <boost/hof/detail/unpack_aggregate.hpp>
 
 namespace boost { namespace hof {
 
 template<class Sequence, class=void>
 struct unpack_sequence
-{
-    typedef void not_unpackable;
-};
+: detail::unpack_aggregate<Sequence>
+{};
 
 }} // namespace boost::hof
 
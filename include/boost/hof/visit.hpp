@@ -0,0 +1,198 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    visit.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_VISIT_H
+#define BOOST_HOF_GUARD_VISIT_H
+
+/// visit
+/// =====
+///
+/// Description
+/// -----------
+///
+/// The `visit` function calls a function with the active alternatives of
+/// each `std::variant`, like `std::visit`. The function is selected from a
+/// single flat table with an entry for every combination of alternatives,
+/// which is built at compile time. So the overload for each combination is
+/// resolved once when the table is built, such as when the function is a
+/// [`match`](match) or [`first_of`](first_of), and the call is one table
+/// lookup regardless of the number of variants.
+///
+/// If all the combinations return the same type, then that is the result
+/// type. Otherwise, the results are converted to their `std::common_type`.
+///
+/// This is only available when `BOOST_HOF_HAS_STD_VARIANT` is enabled.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F, class... Variants>
+///     auto visit(F&& f, Variants&&... vs);
+///
+/// Semantics
+/// ---------
+///
+///     assert(visit(f, vs...) == f(std::get<vs.index()>(vs)...));
+///
+/// Requirements
+/// ------------
+///
+/// F must be:
+///
+/// * [Invocable](Invocable) with every combination of alternatives
+///
+/// Variants must be:
+///
+/// * `std::variant`
+///
+/// If any variant is valueless by exception, then `std::bad_variant_access`
+/// is thrown.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <string>
+///     #include <variant>
+///
+///     struct is_int
+///     {
+///         bool operator()(int) const
+///         {
+///             return true;
+///         }
+///
+///         bool operator()(const std::string&) const
+///         {
+///             return false;
+///         }
+///     };
+///
+///     int main() {
+///         std::variant<int, std::string> v = 1;
+///         assert(boost::hof::visit(is_int(), v));
+///     }
+///
+/// References
+/// ----------
+///
+/// * [match](match)
+/// * [dispatch_index](dispatch_index)
+///
+
+#include <boost/hof/config.hpp>
+
+#if BOOST_HOF_HAS_STD_VARIANT
+
+#include <boost/hof/dispatch_index.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/seq.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <variant>
+
+namespace boost { namespace hof { namespace detail {
+
+template<class V>
+struct visit_size
+: std::variant_size<typename std::remove_cv<typename std::remove_reference<V>::type>::type>
+{};
+
+// The flat index is in mixed radix with the first variant as the most
+// significant digit.
+template<class... Vs>
+struct visit_radix
+{
+    static constexpr std::size_t total = (std::size_t(1) * ... * visit_size<Vs>::value);
+
+    static constexpr std::size_t stride(std::size_t j)
+    {
+        constexpr std::size_t sizes[] = { visit_size<Vs>::value... };
+        std::size_t r = 1;
+        for(std::size_t k = j+1; k < sizeof...(Vs); k++) r *= sizes[k];
+        return r;
+    }
+
+    static constexpr std::size_t digit(std::size_t i, std::size_t j)
+    {
+        constexpr std::size_t sizes[] = { visit_size<Vs>::value... };
+        return (i / stride(j)) % sizes[j];
+    }
+
+    template<class... Ts>
+    static std::size_t index(const Ts&... vs)
+    {
+        std::size_t i = 0;
+        ((i = i * visit_size<Ts>::value + vs.index()), ...);
+        return i;
+    }
+};
+
+template<std::size_t I, class S, class F, class... Vs>
+struct visit_entry;
+
+template<std::size_t I, std::size_t... Js, class F, class... Vs>
+struct visit_entry<I, seq<Js...>, F, Vs...>
+{
+    typedef decltype(std::declval<F>()(
+        std::get<visit_radix<Vs...>::digit(I, Js)>(std::declval<Vs>())...
+    )) type;
+
+    template<class R>
+    static R call(F&& f, Vs&&... vs)
+    {
+        return BOOST_HOF_FORWARD(F)(f)(std::get<visit_radix<Vs...>::digit(I, Js)>(BOOST_HOF_FORWARD(Vs)(vs))...);
+    }
+};
+
+template<class S, class F, class... Vs>
+struct visit_table;
+
+template<std::size_t... Is, class F, class... Vs>
+struct visit_table<seq<Is...>, F, Vs...>
+{
+    typedef typename gens<sizeof...(Vs)>::type digits;
+    typedef typename dispatch_index_result<
+        typename visit_entry<Is, digits, F, Vs...>::type...
+    >::type result_type;
+
+    static result_type call(F&& f, Vs&&... vs)
+    {
+        typedef result_type (*entry_type)(F&&, Vs&&...);
+        static constexpr entry_type table[] = {
+            &visit_entry<Is, digits, F, Vs...>::template call<result_type>...
+        };
+        if ((vs.valueless_by_exception() || ...)) throw std::bad_variant_access();
+        return table[visit_radix<Vs...>::index(vs...)](BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(Vs)(vs)...);
+    }
+};
+
+template<class F, class... Vs>
+struct visit_table_for
+: visit_table<typename gens<visit_radix<Vs...>::total>::type, F, Vs...>
+{};
+
+struct visit_f
+{
+    template<class F, class... Vs>
+    BOOST_HOF_INLINE typename visit_table_for<F, Vs...>::result_type operator()(F&& f, Vs&&... vs) const
+    {
+        return visit_table_for<F, Vs...>::call(BOOST_HOF_FORWARD(F)(f), BOOST_HOF_FORWARD(Vs)(vs)...);
+    }
+};
+
+}
+
+BOOST_HOF_DECLARE_STATIC_VAR(visit, detail::visit_f);
+
+}} // namespace boost::hof
+
+#endif
+
+#endif
@@ -0,0 +1,562 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    work_stealing_executor.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_WORK_STEALING_EXECUTOR_H
+#define BOOST_HOF_GUARD_WORK_STEALING_EXECUTOR_H
+
+/// work_stealing_executor
+/// ======================
+///
+/// Description
+/// -----------
+///
+/// The `work_stealing_executor` is an [executor](executor) that runs the
+/// tasks on a `work_stealing_pool`, which has a fixed number of worker
+/// threads, one for each core by default. It is meant for the small tasks
+/// that the parallel adaptors submit, such as
+/// [`parallel_combine`](parallel_combine) or
+/// [`parallel_fold`](parallel_fold), where starting a thread for each task,
+/// like the `thread_executor` does, costs more than the task.
+///
+/// Each worker has its own deque of tasks. A task that is submitted by a
+/// worker is pushed to the bottom of its deque, and the worker pops its own
+/// tasks from the bottom, so the latest task runs first, while it is still
+/// in the cache. A worker that runs out of tasks steals from the top of the
+/// deque of another worker, which is the oldest task, and so usually the
+/// largest part of the work that is left. The deques are the lock-free deques
+/// of Chase and Lev, with a fixed capacity: when a deque is full, the task
+/// runs immediately on the worker instead. A task that is submitted by a
+/// thread that isn't a worker goes to a queue that is shared by the workers.
+///
+/// Waiting for a handle doesn't block the thread: it runs the other tasks of
+/// the pool until the task of the handle has finished. So a task can submit
+/// tasks and wait for them, as in a recursive fork and join, without running
+/// out of workers. The `fork_join` function calls the first function on the
+/// calling thread, and the others on the executor, and waits for all of
+/// them.
+///
+/// The default constructed executor uses a pool that is shared by the whole
+/// program, and is created on its first use. A pool can be given a function
+/// that each worker calls with its index when it starts, such as to pin the
+/// thread to a CPU. The tasks must finish before their pool is destroyed.
+///
+/// Synopsis
+/// --------
+///
+///     class work_stealing_pool
+///     {
+///         explicit work_stealing_pool(std::size_t threads=std::thread::hardware_concurrency());
+///         template<class Start>
+///         work_stealing_pool(std::size_t threads, Start start);
+///         std::size_t size() const noexcept;
+///         work_stealing_executor executor() noexcept;
+///         static work_stealing_pool& shared();
+///     };
+///
+///     struct work_stealing_executor
+///     {
+///         work_stealing_executor();
+///         explicit work_stealing_executor(work_stealing_pool& pool);
+///         template<class F>
+///         handle submit(F f) const;
+///         template<class F>
+///         void execute(F f) const;
+///     };
+///
+///     template<class Executor, class... Fs>
+///     void fork_join(const Executor& e, Fs... fs);
+///
+/// Requirements
+/// ------------
+///
+/// The functions that are submitted must be MoveConstructible, and the
+/// functions that are passed to `execute` must not throw.
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///
+///     int fib(const boost::hof::work_stealing_executor& e, int n)
+///     {
+///         if (n < 10) return n < 2 ? n : fib(e, n - 1) + fib(e, n - 2);
+///         int x = 0;
+///         int y = 0;
+///         boost::hof::fork_join(e, [&]{ x = fib(e, n - 1); }, [&]{ y = fib(e, n - 2); });
+///         return x + y;
+///     }
+///
+///     int main() {
+///         boost::hof::work_stealing_pool pool(4);
+///         assert(fib(pool.executor(), 20) == 6765);
+///         auto h = boost::hof::work_stealing_executor().submit([]{ return 3; });
+///         assert(h.get() == 3);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [executor](executor)
+/// * [parallel_combine](parallel_combine)
+///
+
+#include <boost/hof/executor.hpp>
+#include <boost/hof/detail/parallel_eval.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+struct work_stealing_task
+{
+    // Runs the task, and then the task must not be used anymore, since it
+    // may be destroyed
+    virtual void run() noexcept = 0;
+protected:
+    ~work_stealing_task()
+    {}
+};
+
+// The deque of Chase and Lev, where the owner pushes and pops at the
+// bottom, and the thieves steal from the top
+class work_stealing_deque
+{
+    static constexpr std::ptrdiff_t capacity = 1024;
+
+    std::atomic<std::ptrdiff_t> top;
+    std::atomic<std::ptrdiff_t> bottom;
+    std::atomic<work_stealing_task*> tasks[capacity];
+public:
+    work_stealing_deque() noexcept
+    {
+        top.store(0, std::memory_order_relaxed);
+        bottom.store(0, std::memory_order_relaxed);
+        for (auto& t : tasks) t.store(nullptr, std::memory_order_relaxed);
+    }
+
+    // Returns false when the deque is full
+    bool push(work_stealing_task* x) noexcept
+    {
+        std::ptrdiff_t b = bottom.load(std::memory_order_relaxed);
+        std::ptrdiff_t t = top.load(std::memory_order_acquire);
+        if (b - t >= capacity) return false;
+        tasks[b % capacity].store(x, std::memory_order_relaxed);
+        bottom.store(b + 1, std::memory_order_release);
+        return true;
+    }
+
+    work_stealing_task* pop() noexcept
+    {
+        std::ptrdiff_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_seq_cst);
+        std::ptrdiff_t t = top.load(std::memory_order_seq_cst);
+        if (t > b)
+        {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        work_stealing_task* x = tasks[b % capacity].load(std::memory_order_relaxed);
+        // The last task can be stolen at the same time
+        if (t == b)
+        {
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) x = nullptr;
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return x;
+    }
+
+    work_stealing_task* steal() noexcept
+    {
+        std::ptrdiff_t t = top.load(std::memory_order_seq_cst);
+        std::ptrdiff_t b = bottom.load(std::memory_order_seq_cst);
+        if (t >= b) return nullptr;
+        work_stealing_task* x = tasks[t % capacity].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return nullptr;
+        return x;
+    }
+};
+
+template<class F>
+struct work_stealing_detached final : work_stealing_task
+{
+    F f;
+
+    explicit work_stealing_detached(F&& x) : f(static_cast<F&&>(x))
+    {}
+
+    void run() noexcept override
+    {
+        f();
+        delete this;
+    }
+};
+
+template<class R>
+struct work_stealing_result
+{
+    typename std::aligned_storage<sizeof(R), alignof(R)>::type storage;
+    bool has = false;
+
+    ~work_stealing_result()
+    {
+        if (has) reinterpret_cast<R*>(&storage)->~R();
+    }
+
+    template<class F>
+    void set(F& f)
+    {
+        ::new(static_cast<void*>(&storage)) R(f());
+        has = true;
+    }
+
+    R get()
+    {
+        return static_cast<R&&>(*reinterpret_cast<R*>(&storage));
+    }
+};
+
+template<class R>
+struct work_stealing_result<R&>
+{
+    R* p = nullptr;
+
+    template<class F>
+    void set(F& f)
+    {
+        p = &f();
+    }
+
+    R& get()
+    {
+        return *p;
+    }
+};
+
+template<>
+struct work_stealing_result<void>
+{
+    template<class F>
+    void set(F& f)
+    {
+        f();
+    }
+
+    void get()
+    {}
+};
+
+// The handle owns the state, so the worker doesn't touch the state after
+// it is marked as done
+template<class F, class R>
+struct work_stealing_state final : work_stealing_task
+{
+    F f;
+    work_stealing_result<R> result;
+    std::exception_ptr error;
+    std::atomic<bool> done;
+
+    explicit work_stealing_state(F&& x) : f(static_cast<F&&>(x))
+    {
+        done.store(false, std::memory_order_relaxed);
+    }
+
+    void run() noexcept override
+    {
+        try
+        {
+            result.set(f);
+        }
+        catch(...)
+        {
+            error = std::current_exception();
+        }
+        done.store(true, std::memory_order_release);
+    }
+};
+
+}
+
+struct work_stealing_executor;
+
+class work_stealing_pool
+{
+    struct worker
+    {
+        detail::work_stealing_deque deque;
+        work_stealing_pool* pool;
+        std::size_t index;
+    };
+
+    std::unique_ptr<worker[]> workers;
+    std::size_t count;
+    std::vector<std::thread> threads;
+    std::mutex m;
+    std::condition_variable wake;
+    std::deque<detail::work_stealing_task*> injected;
+    std::atomic<std::size_t> injected_size;
+    std::atomic<std::size_t> sleeping;
+    bool stopping;
+
+    static worker*& current() noexcept
+    {
+        static thread_local worker* w = nullptr;
+        return w;
+    }
+
+    // The worker of this pool that is running on the calling thread
+    worker* this_worker() const noexcept
+    {
+        worker* w = current();
+        return w != nullptr && w->pool == this ? w : nullptr;
+    }
+
+    detail::work_stealing_task* take_injected()
+    {
+        if (injected_size.load(std::memory_order_acquire) == 0) return nullptr;
+        std::lock_guard<std::mutex> lock(m);
+        if (injected.empty()) return nullptr;
+        detail::work_stealing_task* t = injected.front();
+        injected.pop_front();
+        injected_size.store(injected.size(), std::memory_order_release);
+        return t;
+    }
+
+    detail::work_stealing_task* find_task(worker* self)
+    {
+        detail::work_stealing_task* t = nullptr;
+        std::size_t start = 0;
+        if (self != nullptr)
+        {
+            t = self->deque.pop();
+            if (t != nullptr) return t;
+            start = self->index + 1;
+        }
+        t = this->take_injected();
+        if (t != nullptr) return t;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            worker& w = workers[(start + i) % count];
+            if (&w == self) continue;
+            t = w.deque.steal();
+            if (t != nullptr) return t;
+        }
+        return nullptr;
+    }
+
+    void notify() noexcept
+    {
+        if (sleeping.load(std::memory_order_seq_cst) > 0) wake.notify_one();
+    }
+
+    void work(worker& w)
+    {
+        current() = &w;
+        for (;;)
+        {
+            detail::work_stealing_task* t = this->find_task(&w);
+            if (t != nullptr)
+            {
+                t->run();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(m);
+            if (!injected.empty()) continue;
+            if (stopping) break;
+            sleeping.fetch_add(1, std::memory_order_seq_cst);
+            // A task pushed to a deque doesn't take the lock, so the wait is
+            // bounded in case the notification is missed
+            wake.wait_for(lock, std::chrono::milliseconds(1));
+            sleeping.fetch_sub(1, std::memory_order_seq_cst);
+        }
+        current() = nullptr;
+    }
+public:
+    explicit work_stealing_pool(std::size_t n=std::thread::hardware_concurrency())
+    : work_stealing_pool(n, [](std::size_t) {})
+    {}
+
+    // Each worker calls start with its index on its own thread before it
+    // runs a task, such as to pin the thread to a CPU
+    template<class Start>
+    work_stealing_pool(std::size_t n, Start start)
+    : workers(new worker[n == 0 ? 1 : n]), count(n == 0 ? 1 : n), stopping(false)
+    {
+        injected_size.store(0, std::memory_order_relaxed);
+        sleeping.store(0, std::memory_order_relaxed);
+        threads.reserve(count);
+        try
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                workers[i].pool = this;
+                workers[i].index = i;
+                threads.emplace_back([this, i, start]
+                {
+                    start(i);
+                    this->work(workers[i]);
+                });
+            }
+        }
+        catch(...)
+        {
+            this->stop();
+            throw;
+        }
+    }
+
+    work_stealing_pool(const work_stealing_pool&)=delete;
+    work_stealing_pool& operator=(const work_stealing_pool&)=delete;
+
+    ~work_stealing_pool()
+    {
+        this->stop();
+    }
+
+    std::size_t size() const noexcept
+    {
+        return count;
+    }
+
+    work_stealing_executor executor() noexcept;
+
+    static work_stealing_pool& shared()
+    {
+        static work_stealing_pool pool;
+        return pool;
+    }
+
+    void push(detail::work_stealing_task* t)
+    {
+        worker* w = this->this_worker();
+        if (w != nullptr)
+        {
+            if (!w->deque.push(t)) t->run();
+            else this->notify();
+        }
+        else
+        {
+            {
+                std::lock_guard<std::mutex> lock(m);
+                injected.push_back(t);
+                injected_size.store(injected.size(), std::memory_order_release);
+            }
+            wake.notify_one();
+        }
+    }
+
+    // Runs one task that is waiting, and returns false if there was none
+    bool help()
+    {
+        detail::work_stealing_task* t = this->find_task(this->this_worker());
+        if (t == nullptr) return false;
+        t->run();
+        return true;
+    }
+private:
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& t : threads) t.join();
+        threads.clear();
+    }
+};
+
+template<class F, class R>
+class work_stealing_handle
+{
+    typedef detail::work_stealing_state<F, R> state_type;
+    work_stealing_pool* pool;
+    std::unique_ptr<state_type> state;
+
+    void wait()
+    {
+        while (!state->done.load(std::memory_order_acquire))
+        {
+            if (!pool->help()) std::this_thread::yield();
+        }
+    }
+public:
+    work_stealing_handle(work_stealing_pool* p, std::unique_ptr<state_type> s) noexcept
+    : pool(p), state(std::move(s))
+    {}
+
+    work_stealing_handle(work_stealing_handle&&)=default;
+
+    ~work_stealing_handle()
+    {
+        if (state) this->wait();
+    }
+
+    R get()
+    {
+        this->wait();
+        if (state->error) std::rethrow_exception(state->error);
+        return state->result.get();
+    }
+};
+
+struct work_stealing_executor
+{
+    work_stealing_pool* pool;
+
+    work_stealing_executor() : pool(&work_stealing_pool::shared())
+    {}
+
+    explicit work_stealing_executor(work_stealing_pool& p) noexcept : pool(&p)
+    {}
+
+    template<class F>
+    work_stealing_handle<F, decltype(std::declval<F&>()())> submit(F f) const
+    {
+        typedef decltype(std::declval<F&>()()) result_type;
+        std::unique_ptr<detail::work_stealing_state<F, result_type>> s(
+            new detail::work_stealing_state<F, result_type>(static_cast<F&&>(f))
+        );
+        pool->push(s.get());
+        return work_stealing_handle<F, result_type>(pool, std::move(s));
+    }
+
+    template<class F>
+    void execute(F f) const
+    {
+        pool->push(new detail::work_stealing_detached<F>(static_cast<F&&>(f)));
+    }
+};
+
+inline work_stealing_executor work_stealing_pool::executor() noexcept
+{
+    return work_stealing_executor(*this);
+}
+
+template<class Executor, class... Fs>
+void fork_join(const Executor& e, Fs... fs)
+{
+    detail::parallel_eval_void(std::integral_constant<bool, (sizeof...(Fs) > 1)>(), e, fs...);
+}
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,312 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    zip_with.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef BOOST_HOF_GUARD_ZIP_WITH_H
+#define BOOST_HOF_GUARD_ZIP_WITH_H
+
+/// zip_with
+/// ========
+///
+/// Description
+/// -----------
+///
+/// The `zip_with` function adaptor returns a function that takes several
+/// ranges, and returns a lazy view of the results of calling the function
+/// on the elements at the same position of each range. The view ends with
+/// the shortest range. Like [`map`](map), nothing is evaluated until the view
+/// is consumed, for example by [`fold_into`](fold_into), and then all the
+/// ranges are visited in one loop, in the same loop as the other stages of
+/// the pipeline.
+///
+/// The loop depends on what the ranges support:
+///
+/// * When all the ranges are contiguous, that is arrays or ranges with
+///   `data()` and `size()`, the length is computed with one `min` up front,
+///   and the elements are indexed from their pointers, so the loop can be
+///   vectorized.
+/// * When all the ranges have a `size()`, the length is computed up front,
+///   and only a count is checked on each iteration.
+/// * Otherwise, each iterator is compared with the end of its range on each
+///   iteration.
+///
+/// The elements are passed to the function as the arguments of one call, so
+/// the function can be any function object, such as [`proj`](proj) or a
+/// [`lazy`](lazy) expression. An lvalue range is referred to by the view,
+/// and an rvalue range is moved into it.
+///
+/// Synopsis
+/// --------
+///
+///     template<class F>
+///     constexpr zip_with_adaptor<F> zip_with(F f);
+///
+///     template<class F>
+///     template<class Range, class... Ranges>
+///     constexpr auto zip_with_adaptor<F>::operator()(Range&& r, Ranges&&... rs) const;
+///
+/// Semantics
+/// ---------
+///
+///     assert(fold_into(zip_with(f)(r1, r2), g, init) == std::inner_product(r1.begin(), r1.end(), r2.begin(), init, g, f));
+///
+/// Requirements
+/// ------------
+///
+/// Ranges must be:
+///
+/// * A range that can be iterated with `begin` and `end`
+///
+/// F must be:
+///
+/// * [ConstInvocable](ConstInvocable)
+/// * MoveConstructible
+///
+/// Example
+/// -------
+///
+///     #include <boost/hof.hpp>
+///     #include <cassert>
+///     #include <vector>
+///
+///     int main() {
+///         std::vector<int> x = { 1, 2, 3 };
+///         std::vector<int> y = { 4, 5, 6 };
+///         int dot = boost::hof::zip_with(boost::hof::_ * boost::hof::_)(x, y) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0);
+///         assert(dot == 32);
+///     }
+///
+/// References
+/// ----------
+///
+/// * [map](map)
+/// * [fold_into](fold_into)
+/// * [tuple_zip_with](tuple_zip_with)
+///
+
+#include <boost/hof/always.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/returns.hpp>
+#include <boost/hof/detail/and.hpp>
+#include <boost/hof/detail/callable_base.hpp>
+#include <boost/hof/detail/delegate.hpp>
+#include <boost/hof/detail/forward.hpp>
+#include <boost/hof/detail/make.hpp>
+#include <boost/hof/detail/range_view.hpp>
+#include <boost/hof/detail/static_const_var.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace hof {
+
+namespace detail {
+
+namespace zip_adl {
+
+using std::begin;
+using std::end;
+
+template<class R>
+auto adl_begin(const R& r) BOOST_HOF_RETURNS(begin(r));
+template<class R>
+auto adl_end(const R& r) BOOST_HOF_RETURNS(end(r));
+
+}
+
+template<class R, class=void>
+struct is_zip_sized
+: std::is_array<R>
+{};
+
+template<class R>
+struct is_zip_sized<R, typename std::enable_if<
+    std::is_convertible<decltype(std::declval<const R&>().size()), std::size_t>::value
+>::type>
+: std::true_type
+{};
+
+template<class R, class=void>
+struct is_zip_contiguous
+: std::is_array<R>
+{};
+
+template<class R>
+struct is_zip_contiguous<R, typename std::enable_if<(
+    is_zip_sized<R>::value &&
+    std::is_pointer<decltype(std::declval<const R&>().data())>::value
+)>::type>
+: std::true_type
+{};
+
+template<class T, std::size_t N>
+constexpr std::size_t zip_size(const T (&)[N]) noexcept
+{
+    return N;
+}
+
+template<class R>
+constexpr auto zip_size(const R& r) BOOST_HOF_RETURNS(static_cast<std::size_t>(r.size()));
+
+template<class T, std::size_t N>
+constexpr const T* zip_data(const T (&x)[N]) noexcept
+{
+    return x;
+}
+
+template<class R>
+constexpr auto zip_data(const R& r) BOOST_HOF_RETURNS(r.data());
+
+inline std::size_t zip_min(std::initializer_list<std::size_t> sizes) noexcept
+{
+    return std::min(sizes);
+}
+
+inline bool zip_any(std::initializer_list<bool> bs) noexcept
+{
+    for(bool b:bs) if (b) return true;
+    return false;
+}
+
+template<class I>
+struct zip_cursor
+{
+    I it;
+    I last;
+};
+
+template<class I>
+zip_cursor<I> make_zip_cursor(I first, I last)
+{
+    return zip_cursor<I>{first, last};
+}
+
+template<int N>
+struct zip_loop_kind
+: std::integral_constant<int, N>
+{};
+
+typedef zip_loop_kind<0> zip_contiguous_loop;
+typedef zip_loop_kind<1> zip_sized_loop;
+typedef zip_loop_kind<2> zip_unsized_loop;
+
+template<class... Rs>
+struct zip_loop_of
+: std::conditional<BOOST_HOF_AND_UNPACK(is_zip_contiguous<Rs>::value), zip_contiguous_loop,
+    typename std::conditional<BOOST_HOF_AND_UNPACK(is_zip_sized<Rs>::value), zip_sized_loop,
+        zip_unsized_loop
+    >::type
+>::type
+{};
+
+template<class F, class Sink>
+struct zip_with_loop
+{
+    const F& f;
+    Sink& sink;
+
+    template<class... Ps>
+    BOOST_HOF_INLINE void indexed(std::size_t n, Ps... ps) const
+    {
+        for(std::size_t i = 0; i < n; i++) sink(f(ps[i]...));
+    }
+
+    template<class... Is>
+    BOOST_HOF_INLINE void counted(std::size_t n, Is... its) const
+    {
+        for(; n > 0; n--)
+        {
+            sink(f(*its...));
+            (void)std::initializer_list<int>{(++its, 0)...};
+        }
+    }
+
+    template<class... Is>
+    BOOST_HOF_INLINE void compared(zip_cursor<Is>... cs) const
+    {
+        while (!detail::zip_any({(cs.it == cs.last)...}))
+        {
+            sink(f(*cs.it...));
+            (void)std::initializer_list<int>{(++cs.it, 0)...};
+        }
+    }
+
+    template<class... Rs>
+    BOOST_HOF_INLINE void run(zip_contiguous_loop, const Rs&... rs) const
+    {
+        this->indexed(detail::zip_min({detail::zip_size(rs)...}), detail::zip_data(rs)...);
+    }
+
+    template<class... Rs>
+    BOOST_HOF_INLINE void run(zip_sized_loop, const Rs&... rs) const
+    {
+        this->counted(detail::zip_min({detail::zip_size(rs)...}), zip_adl::adl_begin(rs)...);
+    }
+
+    template<class... Rs>
+    BOOST_HOF_INLINE void run(zip_unsized_loop, const Rs&... rs) const
+    {
+        this->compared(detail::make_zip_cursor(zip_adl::adl_begin(rs), zip_adl::adl_end(rs))...);
+    }
+
+    template<class... Rs>
+    BOOST_HOF_INLINE void operator()(const Rs&... rs) const
+    {
+        this->run(zip_loop_of<Rs...>(), rs...);
+    }
+};
+
+template<class F, class Pack>
+struct zip_with_view : range_view_base
+{
+    F f;
+    Pack ranges;
+
+    template<class G, class P>
+    constexpr zip_with_view(G&& g, P&& p)
+    : f(BOOST_HOF_FORWARD(G)(g)), ranges(BOOST_HOF_FORWARD(P)(p))
+    {}
+
+    template<class Sink>
+    BOOST_HOF_INLINE void for_each(Sink&& sink) const
+    {
+        ranges(zip_with_loop<F, typename std::remove_reference<Sink>::type>{f, sink});
+    }
+};
+
+}
+
+template<class F>
+struct zip_with_adaptor : detail::callable_base<F>
+{
+    BOOST_HOF_INHERIT_CONSTRUCTOR(zip_with_adaptor, detail::callable_base<F>)
+
+    template<class... Ts>
+    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const noexcept
+    {
+        return BOOST_HOF_DETAIL_THIS_REF(xs);
+    }
+
+    template<class Range, class... Ranges, class Pack=decltype(
+        boost::hof::pack_basic(std::declval<Range>(), std::declval<Ranges>()...)
+    )>
+    constexpr detail::zip_with_view<detail::callable_base<F>, Pack> operator()(Range&& r, Ranges&&... rs) const
+    {
+        return detail::zip_with_view<detail::callable_base<F>, Pack>(
+            this->base_function(r, rs...),
+            boost::hof::pack_basic(BOOST_HOF_FORWARD(Range)(r), BOOST_HOF_FORWARD(Ranges)(rs)...)
+        );
+    }
+};
+
+BOOST_HOF_DECLARE_STATIC_VAR(zip_with, detail::make<zip_with_adaptor>);
+
+}} // namespace boost::hof
+
+#endif
@@ -0,0 +1,193 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    adaptive_first_of.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/adaptive_first_of.hpp>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+namespace adaptive_first_of_test {
+
+struct packet
+{
+    int protocol;
+    int port;
+};
+
+template<int Protocol>
+struct is_protocol
+{
+    int* probes;
+
+    bool operator()(const packet& p) const
+    {
+        ++*probes;
+        return p.protocol == Protocol;
+    }
+};
+
+template<int Id>
+struct rule
+{
+    int operator()(const packet&) const
+    {
+        return Id;
+    }
+};
+
+template<int Id>
+struct int_rule
+{
+    int operator()(int) const
+    {
+        return Id;
+    }
+};
+
+struct is_even
+{
+    bool operator()(int x) const
+    {
+        return x % 2 == 0;
+    }
+};
+
+struct is_odd
+{
+    bool operator()(int x) const
+    {
+        return x % 2 != 0;
+    }
+};
+
+struct name
+{
+    std::string s;
+
+    std::string operator()(int) const
+    {
+        return s;
+    }
+};
+
+struct move_only
+{
+    int operator()(std::unique_ptr<int> p) const
+    {
+        return *p;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace adaptive_first_of_test;
+    int probes = 0;
+    auto f = boost::hof::adaptive_first_of(
+        boost::hof::probe(is_protocol<1>{&probes}, rule<1>()),
+        boost::hof::probe(is_protocol<6>{&probes}, rule<6>()),
+        boost::hof::probe(is_protocol<17>{&probes}, rule<17>()),
+        rule<0>()
+    );
+    f.set_period(0);
+    BOOST_HOF_TEST_CHECK(f(packet{1, 0}) == 1);
+    BOOST_HOF_TEST_CHECK(f(packet{6, 0}) == 6);
+    BOOST_HOF_TEST_CHECK(f(packet{17, 0}) == 17);
+    BOOST_HOF_TEST_CHECK(f(packet{2, 0}) == 0);
+    BOOST_HOF_TEST_CHECK((f.order() == std::array<std::size_t, 3>{{0, 1, 2}}));
+
+    for (int i = 0; i < 10; i++) f(packet{17, 0});
+    for (int i = 0; i < 5; i++) f(packet{6, 0});
+    BOOST_HOF_TEST_CHECK((f.hits() == std::array<std::size_t, 3>{{1, 6, 11}}));
+    // The order doesn't change until it is sorted
+    BOOST_HOF_TEST_CHECK((f.order() == std::array<std::size_t, 3>{{0, 1, 2}}));
+    f.reorder();
+    BOOST_HOF_TEST_CHECK((f.order() == std::array<std::size_t, 3>{{2, 1, 0}}));
+    BOOST_HOF_TEST_CHECK((f.hits() == std::array<std::size_t, 3>{{0, 3, 5}}));
+
+    probes = 0;
+    BOOST_HOF_TEST_CHECK(f(packet{17, 0}) == 17);
+    BOOST_HOF_TEST_CHECK(probes == 1);
+    BOOST_HOF_TEST_CHECK(f(packet{1, 0}) == 1);
+    BOOST_HOF_TEST_CHECK(probes == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace adaptive_first_of_test;
+    int probes = 0;
+    auto f = boost::hof::adaptive_first_of(
+        boost::hof::probe(is_protocol<1>{&probes}, rule<1>()),
+        boost::hof::probe(is_protocol<6>{&probes}, rule<6>()),
+        rule<0>()
+    );
+    f.set_period(4);
+    for (int i = 0; i < 4; i++) f(packet{6, 0});
+    BOOST_HOF_TEST_CHECK((f.order() == std::array<std::size_t, 2>{{1, 0}}));
+    // A copy keeps the order
+    auto g = f;
+    BOOST_HOF_TEST_CHECK((g.order() == std::array<std::size_t, 2>{{1, 0}}));
+    BOOST_HOF_TEST_CHECK(g(packet{1, 0}) == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace adaptive_first_of_test;
+    auto f = boost::hof::adaptive_first_of(
+        boost::hof::probe(is_even(), name{"even"}),
+        boost::hof::probe(is_odd(), name{"odd"}),
+        name{"none"}
+    );
+    BOOST_HOF_TEST_CHECK(f(2) == "even");
+    BOOST_HOF_TEST_CHECK(f(3) == "odd");
+    auto g = boost::hof::adaptive_first_of(move_only());
+    BOOST_HOF_TEST_CHECK(g(std::unique_ptr<int>(new int(3))) == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace adaptive_first_of_test;
+    auto f = boost::hof::adaptive_first_of(
+        boost::hof::probe(is_even(), int_rule<1>()),
+        boost::hof::probe(is_odd(), int_rule<2>()),
+        int_rule<0>()
+    );
+    f.set_period(16);
+    std::atomic<int> sum(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+        threads.emplace_back([&] { for (int i = 0; i < 1000; i++) sum += f((i % 10) == 0 ? 2 : 3); });
+    for (auto& t : threads) t.join();
+    BOOST_HOF_TEST_CHECK(sum == 4 * (100 * 1 + 900 * 2));
+    BOOST_HOF_TEST_CHECK(f.order()[0] == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace adaptive_first_of_test;
+    // The counts from all the threads are summed across the shards
+    auto f = boost::hof::adaptive_first_of(
+        boost::hof::probe(is_even(), int_rule<1>()),
+        boost::hof::probe(is_odd(), int_rule<2>()),
+        int_rule<0>()
+    );
+    f.set_period(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 2 * BOOST_HOF_COUNTER_SHARDS + 1; t++)
+        threads.emplace_back([&] { for (int i = 0; i < 100; i++) f(i); });
+    for (auto& t : threads) t.join();
+    auto hits = f.hits();
+    BOOST_HOF_TEST_CHECK(hits[0] == 50 * (2 * BOOST_HOF_COUNTER_SHARDS + 1));
+    BOOST_HOF_TEST_CHECK(hits[1] == 50 * (2 * BOOST_HOF_COUNTER_SHARDS + 1));
+    auto g = f;
+    BOOST_HOF_TEST_CHECK(g.hits() == hits);
+    f.reorder();
+    BOOST_HOF_TEST_CHECK(f.hits()[0] <= hits[0] / 2);
+}
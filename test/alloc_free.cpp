@@ -0,0 +1,150 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    alloc_free.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/batched.hpp>
+#include <boost/hof/capture.hpp>
+#include <boost/hof/compose.hpp>
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/fix.hpp>
+#include <boost/hof/flow.hpp>
+#include <boost/hof/lazy.hpp>
+#include <boost/hof/partial.hpp>
+#include <boost/hof/pipable.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <boost/hof/proj.hpp>
+#include <boost/hof/result.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/pack.hpp>
+#include <cstdlib>
+#include <new>
+#include "test.hpp"
+
+// Every allocation in this test goes through the replaced operator new, so
+// the adaptors are checked to never allocate when they are constructed,
+// copied or called
+static long alloc_free_count = 0;
+
+void* operator new(std::size_t n)
+{
+    ++alloc_free_count;
+    if (void* p = std::malloc(n == 0 ? 1 : n)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace alloc_free_test {
+
+template<class F>
+long allocations(F f)
+{
+    long before = alloc_free_count;
+    f();
+    return alloc_free_count - before;
+}
+
+struct sum_f
+{
+    template<class T, class U>
+    constexpr T operator()(T x, U y) const
+    {
+        return x + y;
+    }
+};
+
+struct increment
+{
+    template<class T>
+    constexpr T operator()(T x) const
+    {
+        return x + 1;
+    }
+};
+
+struct factorial_t
+{
+    template<class Self>
+    int operator()(Self self, int n) const
+    {
+        return n == 0 ? 1 : n * self(n - 1);
+    }
+};
+
+struct total_f
+{
+    long* total;
+    template<class View>
+    void operator()(View v) const
+    {
+        for (auto&& p : v) *total += boost::hof::unpack(sum_f())(p);
+    }
+};
+
+// Constructs, copies and calls the adaptor, and checks the result
+template<class Make, class Call>
+void check_alloc_free(Make make, Call call)
+{
+    int result = 0;
+    BOOST_HOF_TEST_CHECK(allocations([&]
+    {
+        auto f = make();
+        auto g = f;
+        result = call(f) + call(g);
+    }) == 0);
+    BOOST_HOF_TEST_CHECK(result != 0);
+}
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace alloc_free_test;
+    // Checks that the count works, with a pointer that escapes, since a new
+    // and delete pair can be removed by the optimizer
+    BOOST_HOF_TEST_CHECK(allocations([]
+    {
+        int* volatile p = new int(1);
+        delete p;
+    }) == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace alloc_free_test;
+    check_alloc_free([] { return boost::hof::capture(1)(sum_f()); }, [](const decltype(boost::hof::capture(1)(sum_f()))& f) { return f(2); });
+    check_alloc_free([] { return boost::hof::partial(sum_f())(1); }, [](const decltype(boost::hof::partial(sum_f())(1))& f) { return f(2); });
+    check_alloc_free([] { return boost::hof::pipable(sum_f()); }, [](const decltype(boost::hof::pipable(sum_f()))& f) { return 1 | f(2); });
+    check_alloc_free([] { return boost::hof::lazy(sum_f())(boost::hof::_1, 2); }, [](const decltype(boost::hof::lazy(sum_f())(boost::hof::_1, 2))& f) { return f(1); });
+    check_alloc_free([] { return boost::hof::fix(factorial_t()); }, [](const decltype(boost::hof::fix(factorial_t()))& f) { return f(5); });
+    check_alloc_free([] { return boost::hof::first_of(increment(), sum_f()); }, [](const decltype(boost::hof::first_of(increment(), sum_f()))& f) { return f(1) + f(1, 2); });
+    check_alloc_free([] { return boost::hof::flow(increment(), increment()); }, [](const decltype(boost::hof::flow(increment(), increment()))& f) { return f(1); });
+    check_alloc_free([] { return boost::hof::compose(increment(), increment()); }, [](const decltype(boost::hof::compose(increment(), increment()))& f) { return f(1); });
+    check_alloc_free([] { return boost::hof::proj(increment(), sum_f()); }, [](const decltype(boost::hof::proj(increment(), sum_f()))& f) { return f(1, 2); });
+    check_alloc_free([] { return boost::hof::result<int>(sum_f()); }, [](const decltype(boost::hof::result<int>(sum_f()))& f) { return f(1, 2); });
+    check_alloc_free([] { return boost::hof::pack(1, 2); }, [](const decltype(boost::hof::pack(1, 2))& p) { return p(sum_f()); });
+}
+
+// The buffer of batched is only allocated when it is constructed
+BOOST_HOF_TEST_CASE()
+{
+    using namespace alloc_free_test;
+    long total = 0;
+    auto f = boost::hof::batched<4, int, int>(total_f{&total});
+    BOOST_HOF_TEST_CHECK(allocations([&]
+    {
+        for (int i = 0; i < 10; i++) f(i, 1);
+        f.flush();
+    }) == 0);
+    BOOST_HOF_TEST_CHECK(total == 55);
+}
@@ -63,3 +63,65 @@ BOOST_HOF_TEST_CASE()
     auto ctf = boost::hof::always(copy_throws{});
     static_assert(!noexcept(ctf()), "noexcept always");
 }
+
+namespace always_test {
+
+struct settings
+{
+    int level;
+    int size;
+    constexpr settings(int l, int s) : level(l), size(s)
+    {}
+};
+
+static constexpr settings default_settings(2, 16);
+
+static int copies = 0;
+
+struct counted
+{
+    int value;
+    counted(int x) : value(x)
+    {}
+    counted(const counted& c) : value(c.value)
+    {
+        copies++;
+    }
+    counted(counted&& c) noexcept : value(c.value)
+    {}
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using always_test::counted;
+    auto f = boost::hof::always_shared(counted{3});
+    STATIC_ASSERT_SAME(decltype(f(1, 2)), const counted&);
+    static_assert(noexcept(f(1, 2)), "noexcept always_shared");
+    always_test::copies = 0;
+    BOOST_HOF_TEST_CHECK(f(1, 2).value == 3);
+    BOOST_HOF_TEST_CHECK(f().value == 3);
+    BOOST_HOF_TEST_CHECK(&f(1) == &f(2));
+    BOOST_HOF_TEST_CHECK(always_test::copies == 0);
+
+    auto g = boost::hof::always_shared(std::unique_ptr<int>(new int(4)));
+    BOOST_HOF_TEST_CHECK(*g(1) == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::always_shared(10)(1, 2) == 10);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::always_shared(always_test::settings(1, 8))().size == 8);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using always_test::settings;
+    using always_test::default_settings;
+    STATIC_ASSERT_SAME(decltype(boost::hof::always_static<settings, default_settings>(1, 2)), const settings&);
+    static_assert(noexcept(boost::hof::always_static<settings, default_settings>(1, 2)), "noexcept always_static");
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::always_static<settings, default_settings>(1, 2).level == 2);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::always_static<settings, default_settings>().size == 16);
+    BOOST_HOF_TEST_CHECK(&boost::hof::always_static<settings, default_settings>(1) == &default_settings);
+}
@@ -61,3 +61,33 @@ BOOST_HOF_TEST_CASE()
     BOOST_HOF_TEST_CHECK(*boost::hof::apply_eval(&moveable, boost::hof::always(1)) == 1);
     BOOST_HOF_TEST_CHECK(*boost::hof::apply_eval(&moveable, boost::hof::always(3)) == 3);
 }
+
+#if BOOST_HOF_HAS_STD_17 && !BOOST_HOF_NO_ORDERED_BRACE_INIT
+namespace apply_eval_test {
+
+struct pinned
+{
+    int value;
+    pinned(int x) : value(x)
+    {}
+    pinned(pinned&&) = delete;
+};
+
+struct make_pinned
+{
+    pinned operator()(int x, int y) const
+    {
+        return pinned(x*10 + y);
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The result is returned without being moved
+    int i = 0;
+    apply_eval_test::pinned p = boost::hof::apply_eval(apply_eval_test::make_pinned(), [&]{ return ++i; }, [&]{ return ++i; });
+    BOOST_HOF_TEST_CHECK(p.value == 12);
+}
+#endif
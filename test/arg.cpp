@@ -51,3 +51,31 @@ BOOST_HOF_TEST_CASE()
     static_assert(!noexcept(boost::hof::arg(std::integral_constant<int, 3>())(1,2,copy_throws{},4,5)), "noexcept arg");
 }
 #endif
+
+BOOST_HOF_TEST_CASE()
+{
+    int i = 1;
+    const int ci = 2;
+    auto at_2 = boost::hof::arg(std::integral_constant<int, 2>());
+    STATIC_ASSERT_SAME(decltype(at_2(0, i)), int&);
+    STATIC_ASSERT_SAME(decltype(at_2(0, ci)), const int&);
+    STATIC_ASSERT_SAME(decltype(at_2(0, 1)), int&&);
+    STATIC_ASSERT_SAME(decltype(at_2(0, std::move(i), 3)), int&&);
+    BOOST_HOF_TEST_CHECK(&at_2(0, i) == &i);
+
+    auto at_0 = boost::hof::arg(std::integral_constant<int, 0>());
+    static_assert(!boost::hof::is_invocable<decltype(at_0)>::value, "Not SFINAE-friendly");
+    static_assert(!boost::hof::is_invocable<decltype(at_0), int, int>::value, "Not SFINAE-friendly");
+}
+
+#define ARG_TEST_INTS16 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
+#define ARG_TEST_INTS64 ARG_TEST_INTS16, ARG_TEST_INTS16, ARG_TEST_INTS16, ARG_TEST_INTS16
+
+BOOST_HOF_TEST_CASE()
+{
+    auto at_64 = boost::hof::arg(std::integral_constant<int, 64>());
+    auto at_65 = boost::hof::arg(std::integral_constant<int, 65>());
+    BOOST_HOF_TEST_CHECK(at_64(ARG_TEST_INTS64, 64) == 15);
+    BOOST_HOF_TEST_CHECK(at_65(ARG_TEST_INTS64, 64) == 64);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::arg(std::integral_constant<int, 65>())(ARG_TEST_INTS64, 64) == 64);
+}
@@ -0,0 +1,210 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    async.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/async.hpp>
+#include <boost/hof/compose.hpp>
+#include <boost/hof/flow.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include "test.hpp"
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+
+struct increment
+{
+    int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+struct twice
+{
+    int operator()(int x) const
+    {
+        return x * 2;
+    }
+};
+
+struct sum_f
+{
+    template<class T, class U>
+    T operator()(T x, U y) const
+    {
+        return x + y;
+    }
+};
+
+struct thrower
+{
+    int operator()(int) const
+    {
+        throw std::runtime_error("error");
+    }
+};
+
+struct thread_of
+{
+    std::thread::id operator()() const
+    {
+        return std::this_thread::get_id();
+    }
+};
+
+struct deref
+{
+    int operator()(std::unique_ptr<int> p) const
+    {
+        return *p;
+    }
+};
+
+// Queues the tasks so the test controls when each stage runs
+struct queue_executor
+{
+    std::shared_ptr<std::deque<std::function<void()>>> tasks;
+
+    template<class F>
+    void execute(F f) const
+    {
+        auto p = std::make_shared<F>(std::move(f));
+        tasks->push_back([p] { (*p)(); });
+    }
+
+    bool run_one() const
+    {
+        if (tasks->empty()) return false;
+        auto t = tasks->front();
+        tasks->pop_front();
+        t();
+        return true;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::async(sum_f());
+    BOOST_HOF_TEST_CHECK(f(1, 2).get() == 3);
+    BOOST_HOF_TEST_CHECK(f(std::string("a"), "b").get() == "ab");
+    BOOST_HOF_TEST_CHECK(boost::hof::async(thread_of())().get() != std::this_thread::get_id());
+    BOOST_HOF_TEST_CHECK(boost::hof::async(deref())(std::unique_ptr<int>(new int(5))).get() == 5);
+    static_assert(boost::hof::is_invocable<decltype(f), int, int>::value, "Not invocable");
+    static_assert(!boost::hof::is_invocable<decltype(f), int>::value, "Invocable");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::async(thread_of(), boost::hof::inline_executor());
+    auto r = f();
+    BOOST_HOF_TEST_CHECK(r.ready());
+    BOOST_HOF_TEST_CHECK(r.get() == std::this_thread::get_id());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::flow(boost::hof::async(increment()), boost::hof::async(twice()), boost::hof::async(increment()));
+    BOOST_HOF_TEST_CHECK(f(1).get() == 5);
+    auto g = boost::hof::compose(boost::hof::async(increment()), boost::hof::async(twice()));
+    BOOST_HOF_TEST_CHECK(g(1).get() == 3);
+    auto h = boost::hof::flow(boost::hof::async(increment()), boost::hof::then(twice()));
+    BOOST_HOF_TEST_CHECK(h(1).get() == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    queue_executor e{std::make_shared<std::deque<std::function<void()>>>()};
+    auto f = boost::hof::flow(boost::hof::async(increment(), e), boost::hof::async(twice(), e));
+    auto r = f(1);
+    // The second stage is not scheduled until the first is done
+    BOOST_HOF_TEST_CHECK(e.tasks->size() == 1);
+    BOOST_HOF_TEST_CHECK(!r.ready());
+    BOOST_HOF_TEST_CHECK(e.run_one());
+    BOOST_HOF_TEST_CHECK(e.tasks->size() == 1);
+    BOOST_HOF_TEST_CHECK(!r.ready());
+    BOOST_HOF_TEST_CHECK(e.run_one());
+    BOOST_HOF_TEST_CHECK(r.ready());
+    BOOST_HOF_TEST_CHECK(r.get() == 4);
+    BOOST_HOF_TEST_CHECK(!e.run_one());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    queue_executor e{std::make_shared<std::deque<std::function<void()>>>()};
+    auto x = boost::hof::async(increment(), e)(1);
+    auto y = boost::hof::async(twice(), e)(5);
+    auto r = boost::hof::async(sum_f(), e)(x, y);
+    auto s = boost::hof::async(sum_f(), e)(x, 100);
+    while (e.run_one()) {}
+    BOOST_HOF_TEST_CHECK(r.get() == 12);
+    BOOST_HOF_TEST_CHECK(s.get() == 102);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::async(increment());
+    auto all = boost::hof::when_all(f(1), f(2), boost::hof::async(sum_f())(std::string("a"), "b"));
+    BOOST_HOF_TEST_CHECK(all.get() == std::make_tuple(2, 3, std::string("ab")));
+    BOOST_HOF_TEST_CHECK(boost::hof::when_all().get() == std::make_tuple());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::flow(boost::hof::async(thrower()), boost::hof::async(increment()));
+    auto r = f(1);
+    bool caught = false;
+    try
+    {
+        r.get();
+    }
+    catch(const std::runtime_error&)
+    {
+        caught = true;
+    }
+    BOOST_HOF_TEST_CHECK(caught);
+
+    auto all = boost::hof::when_all(boost::hof::async(increment())(1), boost::hof::async(thrower())(1));
+    caught = false;
+    try
+    {
+        all.get();
+    }
+    catch(const std::runtime_error&)
+    {
+        caught = true;
+    }
+    BOOST_HOF_TEST_CHECK(caught);
+}
+
+struct set_flag
+{
+    bool* flag;
+    void operator()() const
+    {
+        *flag = true;
+    }
+};
+
+struct return_one
+{
+    int operator()() const
+    {
+        return 1;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    bool flag = false;
+    auto r = boost::hof::async(set_flag{&flag})();
+    r.get();
+    BOOST_HOF_TEST_CHECK(flag);
+    BOOST_HOF_TEST_CHECK(r.then(return_one()).get() == 1);
+}
@@ -0,0 +1,89 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    async_allocator.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+namespace async_allocator_test {
+
+std::atomic<int> allocations(0);
+std::atomic<int> live(0);
+
+template<class T>
+struct counting_allocator
+{
+    typedef T value_type;
+
+    counting_allocator() noexcept
+    {}
+
+    template<class U>
+    counting_allocator(const counting_allocator<U>&) noexcept
+    {}
+
+    T* allocate(std::size_t n)
+    {
+        ++allocations;
+        ++live;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        --live;
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template<class U>
+    bool operator==(const counting_allocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+    template<class U>
+    bool operator!=(const counting_allocator<U>&) const noexcept
+    {
+        return false;
+    }
+};
+
+}
+
+#define BOOST_HOF_STATE_ALLOCATOR async_allocator_test::counting_allocator
+#include <boost/hof/async.hpp>
+#include <boost/hof/flow.hpp>
+#include "test.hpp"
+
+namespace async_allocator_test {
+
+struct increment
+{
+    int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace async_allocator_test;
+    {
+        auto f = boost::hof::flow(boost::hof::async(increment()), boost::hof::async(increment()));
+        BOOST_HOF_TEST_CHECK(f(1).get() == 3);
+        BOOST_HOF_TEST_CHECK(boost::hof::then(increment())(boost::hof::async(increment())(1)).get() == 3);
+    }
+    // The states, the values and the continuations use the allocator, and
+    // the executor releases the last of them after the results are ready
+    BOOST_HOF_TEST_CHECK(allocations.load() > 0);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (live.load() != 0 && std::chrono::steady_clock::now() < deadline) std::this_thread::yield();
+    BOOST_HOF_TEST_CHECK(live.load() == 0);
+}
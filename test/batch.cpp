@@ -0,0 +1,108 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    batch.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/batch.hpp>
+#include <boost/hof/fixed_view.hpp>
+#include <boost/hof/flow.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <boost/hof/proj.hpp>
+#include "test.hpp"
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+namespace batch_test {
+
+struct square
+{
+    float operator()(float x) const
+    {
+        return x * x;
+    }
+};
+
+struct sum
+{
+    float operator()(float x, float y) const
+    {
+        return x + y;
+    }
+};
+
+struct negate
+{
+    float operator()(float x) const
+    {
+        return -x;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // Not a multiple of BOOST_HOF_BATCH_WIDTH, to check the tail loop
+    std::vector<float> x, y;
+    for(int i = 0; i < 37; i++)
+    {
+        x.push_back(float(i));
+        y.push_back(float(2 * i));
+    }
+    std::vector<float> r(x.size());
+    boost::hof::batch(boost::hof::flow(boost::hof::proj(batch_test::square(), batch_test::sum()), batch_test::negate()))(r, x, y);
+    for(std::size_t i = 0; i < r.size(); i++)
+        BOOST_HOF_TEST_CHECK(r[i] == -(x[i] * x[i] + y[i] * y[i]));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::array<int, 4> x = {{ 1, 2, 3, 4 }};
+    int y[] = { 10, 20, 30, 40, 50 };
+    std::vector<long> r(4);
+    boost::hof::batch(boost::hof::_ + boost::hof::_)(r, x, boost::hof::make_fixed_view<4>(y + 1));
+    BOOST_HOF_TEST_CHECK(r == std::vector<long>({ 21, 32, 43, 54 }));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> x = { 1, 2, 3 };
+    std::array<int, 3> r = {{}};
+    boost::hof::batch(boost::hof::_ * 2)(r, x);
+    BOOST_HOF_TEST_CHECK(r[0] == 2);
+    BOOST_HOF_TEST_CHECK(r[1] == 4);
+    BOOST_HOF_TEST_CHECK(r[2] == 6);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<float> x, r;
+    boost::hof::batch(batch_test::square())(r, x);
+    BOOST_HOF_TEST_CHECK(r.empty());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<float> x = { 1, 2, 3 };
+    std::vector<float> y = { 1, 2 };
+    std::vector<float> r(3);
+    bool thrown = false;
+    try
+    {
+        boost::hof::batch(batch_test::sum())(r, x, y);
+    }
+    catch(const std::invalid_argument&)
+    {
+        thrown = true;
+    }
+    BOOST_HOF_TEST_CHECK(thrown);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(boost::hof::is_invocable<decltype(boost::hof::batch(batch_test::sum())), std::vector<float>&, std::vector<float>&, std::vector<float>&>::value, "Not invocable");
+    static_assert(!boost::hof::is_invocable<decltype(boost::hof::batch(batch_test::sum())), std::vector<float>&, std::vector<float>&>::value, "Invocable");
+}
@@ -0,0 +1,176 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    batched.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/batched.hpp>
+#include <boost/hof/flow.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "test.hpp"
+
+namespace batched_test {
+
+struct record_batches
+{
+    std::vector<std::vector<int>>* batches;
+
+    template<class View>
+    void operator()(View v) const
+    {
+        std::vector<int> batch;
+        for(auto&& p : v) batch.push_back(boost::hof::unpack(boost::hof::identity)(p));
+        batches->push_back(batch);
+    }
+};
+
+struct concat
+{
+    std::vector<std::string>* out;
+
+    template<class View>
+    void operator()(View v) const
+    {
+        for(std::size_t i = 0; i < v.size(); i++)
+            out->push_back(boost::hof::unpack([](std::string& s, int n) { return s + std::to_string(n); })(v[i]));
+    }
+};
+
+struct move_out
+{
+    std::vector<std::unique_ptr<int>>* out;
+
+    template<class View>
+    void operator()(View v) const
+    {
+        for(auto&& p : v) out->push_back(boost::hof::unpack([](std::unique_ptr<int>& x) { return std::move(x); })(p));
+    }
+};
+
+struct throws_once
+{
+    int* calls;
+    std::vector<int>* out;
+
+    template<class View>
+    void operator()(View v) const
+    {
+        if ((*calls)++ == 0) throw std::runtime_error("batched failed");
+        for(auto&& p : v) out->push_back(boost::hof::unpack(boost::hof::identity)(p));
+    }
+};
+
+struct twice
+{
+    int operator()(int x) const
+    {
+        return 2 * x;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace batched_test;
+    std::vector<std::vector<int>> batches;
+    {
+        auto f = boost::hof::batched<3, int>(record_batches{&batches});
+        for(int i = 0; i < 7; i++) f(i);
+        BOOST_HOF_TEST_CHECK(batches.size() == 2);
+        BOOST_HOF_TEST_CHECK(f.pending() == 1);
+        BOOST_HOF_TEST_CHECK((batches[0] == std::vector<int>{0, 1, 2}));
+        BOOST_HOF_TEST_CHECK((batches[1] == std::vector<int>{3, 4, 5}));
+        f.flush();
+        BOOST_HOF_TEST_CHECK(f.pending() == 0);
+        BOOST_HOF_TEST_CHECK((batches[2] == std::vector<int>{6}));
+        f.flush();
+        BOOST_HOF_TEST_CHECK(batches.size() == 3);
+        f(7);
+    }
+    // The destructor passes the calls that are left
+    BOOST_HOF_TEST_CHECK(batches.size() == 4);
+    BOOST_HOF_TEST_CHECK((batches[3] == std::vector<int>{7}));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace batched_test;
+    std::vector<std::string> out;
+    auto f = boost::hof::batched<2, std::string, int>(concat{&out});
+    f("a", 1);
+    f(std::string("b"), 2);
+    BOOST_HOF_TEST_CHECK((out == std::vector<std::string>{"a1", "b2"}));
+    STATIC_ASSERT_SAME(decltype(f)::value_type, decltype(boost::hof::pack(std::string(), 0)));
+    static_assert(!boost::hof::is_invocable<decltype(f), int, int>::value, "Not convertible");
+    static_assert(!boost::hof::is_invocable<decltype(f), std::string>::value, "Too few arguments");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace batched_test;
+    std::vector<std::unique_ptr<int>> out;
+    auto f = boost::hof::batched<4, std::unique_ptr<int>>(move_out{&out});
+    f(std::unique_ptr<int>(new int(1)));
+    f(std::unique_ptr<int>(new int(2)));
+    auto g = std::move(f);
+    BOOST_HOF_TEST_CHECK(f.pending() == 0);
+    BOOST_HOF_TEST_CHECK(g.pending() == 2);
+    g.flush();
+    BOOST_HOF_TEST_CHECK(out.size() == 2);
+    BOOST_HOF_TEST_CHECK(*out[1] == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace batched_test;
+    std::vector<std::vector<int>> batches;
+    auto f = boost::hof::batched<2, int>(record_batches{&batches});
+    f(1);
+    auto g = f;
+    BOOST_HOF_TEST_CHECK(g.pending() == 0);
+    f.flush();
+    g.flush();
+    BOOST_HOF_TEST_CHECK(batches.size() == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace batched_test;
+    int calls = 0;
+    std::vector<int> out;
+    auto f = boost::hof::batched<2, int>(throws_once{&calls, &out});
+    f(1);
+    bool threw = false;
+    try
+    {
+        f(2);
+    }
+    catch(const std::runtime_error&)
+    {
+        threw = true;
+    }
+    BOOST_HOF_TEST_CHECK(threw);
+    BOOST_HOF_TEST_CHECK(f.pending() == 2);
+    f(3);
+    BOOST_HOF_TEST_CHECK((out == std::vector<int>{1, 2}));
+    BOOST_HOF_TEST_CHECK(f.pending() == 1);
+    f.flush();
+    BOOST_HOF_TEST_CHECK((out == std::vector<int>{1, 2, 3}));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace batched_test;
+    std::vector<std::vector<int>> batches;
+    auto f = boost::hof::flow(twice(), boost::hof::batched<2, int>(record_batches{&batches}));
+    f(1);
+    f(2);
+    BOOST_HOF_TEST_CHECK(batches.size() == 1);
+    BOOST_HOF_TEST_CHECK((batches[0] == std::vector<int>{2, 4}));
+}
@@ -0,0 +1,100 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    borrow.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/borrow.hpp>
+#include <boost/hof/capture.hpp>
+#include <boost/hof/partial.hpp>
+#include <boost/hof/pack.hpp>
+#include <string>
+#include <vector>
+#include "test.hpp"
+
+namespace borrow_test {
+
+struct size_of
+{
+    template<class T>
+    std::size_t operator()(const T& x) const
+    {
+        return x.size();
+    }
+};
+
+struct concat
+{
+    template<class T, class U>
+    std::string operator()(const T& x, const U& y) const
+    {
+        return std::string(x.data(), x.size()) + std::string(y.data(), y.size());
+    }
+};
+
+// Not a contiguous container, so it is borrowed by reference
+struct counter
+{
+    int n;
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::string s(100, 'a');
+    typedef typename boost::hof::detail::decay_mf<decltype(boost::hof::borrow(s))>::type view;
+#if BOOST_HOF_HAS_STD_STRING_VIEW
+    static_assert(std::is_same<view, std::string_view>::value, "string view");
+#else
+    static_assert(std::is_same<view, const std::string&>::value, "string reference");
+#endif
+    view v = boost::hof::decay(boost::hof::borrow(s));
+    BOOST_HOF_TEST_CHECK(v.data() == s.data());
+    BOOST_HOF_TEST_CHECK(v.size() == 100);
+    BOOST_HOF_TEST_CHECK(&boost::hof::borrow(s).get() == &s);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> x = { 1, 2, 3 };
+    typedef typename boost::hof::detail::decay_mf<decltype(boost::hof::borrow(x))>::type view;
+#if BOOST_HOF_HAS_STD_SPAN
+    static_assert(std::is_same<view, std::span<const int>>::value, "span");
+#else
+    static_assert(std::is_same<view, const std::vector<int>&>::value, "vector reference");
+#endif
+    view v = boost::hof::decay(boost::hof::borrow(x));
+    BOOST_HOF_TEST_CHECK(v.data() == x.data());
+    BOOST_HOF_TEST_CHECK(v.size() == 3);
+
+    std::vector<bool> b(2);
+    static_assert(std::is_same<
+        typename boost::hof::detail::decay_mf<decltype(boost::hof::borrow(b))>::type,
+        const std::vector<bool>&
+    >::value, "vector<bool> reference");
+
+    const borrow_test::counter c = { 2 };
+    const borrow_test::counter& r = boost::hof::decay(boost::hof::borrow(c));
+    BOOST_HOF_TEST_CHECK(&r == &c);
+}
+
+// The closures hold a view of the borrowed value, which sees changes to it
+BOOST_HOF_TEST_CASE()
+{
+    std::string s = "abc";
+    auto f = boost::hof::partial(borrow_test::concat())(boost::hof::borrow(s));
+    auto g = boost::hof::capture(boost::hof::borrow(s), std::string("d"))(borrow_test::concat());
+    BOOST_HOF_TEST_CHECK(f(std::string("d")) == "abcd");
+    BOOST_HOF_TEST_CHECK(g() == "abcd");
+    s[0] = 'x';
+    BOOST_HOF_TEST_CHECK(f(std::string("d")) == "xbcd");
+    BOOST_HOF_TEST_CHECK(g() == "xbcd");
+
+    std::vector<int> x = { 1, 2, 3 };
+    auto p = boost::hof::pack(boost::hof::borrow(x));
+    BOOST_HOF_TEST_CHECK(p(borrow_test::size_of()) == 3);
+#if BOOST_HOF_HAS_STD_STRING_VIEW
+    static_assert(sizeof(f) <= sizeof(std::string_view) + sizeof(void*), "no copy of the string");
+#endif
+}
@@ -6,6 +6,12 @@
 ==============================================================================*/
 #include <boost/hof/capture.hpp>
 #include <boost/hof/identity.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
 #include "test.hpp"
 
 BOOST_HOF_TEST_CASE()
@@ -94,3 +100,310 @@ BOOST_HOF_TEST_CASE()
     static_assert(!boost::hof::is_invocable<decltype(f), int>::value, "Not sfinae friendly");
 }
 
+
+namespace capture_alloc_test {
+
+// A monotonic arena that only releases its memory when it is reset
+struct arena
+{
+    alignas(std::max_align_t) char buffer[1024];
+    std::size_t used;
+    int allocations;
+    int deallocations;
+
+    arena() : used(0), allocations(0), deallocations(0)
+    {}
+
+    void* allocate(std::size_t n, std::size_t align)
+    {
+        used = (used + align - 1) / align * align;
+        void* p = buffer + used;
+        used += n;
+        allocations++;
+        return p;
+    }
+
+    void reset()
+    {
+        used = 0;
+    }
+};
+
+template<class T>
+struct arena_allocator
+{
+    typedef T value_type;
+    arena* a;
+
+    arena_allocator(arena* x) : a(x)
+    {}
+
+    template<class U>
+    arena_allocator(const arena_allocator<U>& rhs) : a(rhs.a)
+    {}
+
+    T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(a->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t)
+    {
+        a->deallocations++;
+    }
+
+    template<class U>
+    bool operator==(const arena_allocator<U>& rhs) const
+    {
+        return a == rhs.a;
+    }
+
+    template<class U>
+    bool operator!=(const arena_allocator<U>& rhs) const
+    {
+        return a != rhs.a;
+    }
+};
+
+struct destroy_counter
+{
+    int* count;
+
+    destroy_counter(int* c) : count(c)
+    {}
+
+    destroy_counter(const destroy_counter& rhs) : count(rhs.count)
+    {}
+
+    ~destroy_counter()
+    {
+        ++*count;
+    }
+};
+
+struct sum_f
+{
+    template<class... Ts>
+    int operator()(Ts... xs) const
+    {
+        int r = 0;
+        (void)std::initializer_list<int>{(r += xs, 0)...};
+        return r;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    capture_alloc_test::arena a;
+    capture_alloc_test::arena_allocator<char> alloc(&a);
+    {
+        auto f = boost::hof::capture_alloc(alloc, 1, 2)(binary_class());
+        BOOST_HOF_TEST_CHECK(f() == 3);
+        BOOST_HOF_TEST_CHECK(a.allocations == 1);
+        BOOST_HOF_TEST_CHECK(a.used >= sizeof(int) * 2);
+
+        auto g = boost::hof::capture_alloc(alloc, 1)(binary_class());
+        BOOST_HOF_TEST_CHECK(g(2) == 3);
+        auto h = boost::hof::capture_alloc(alloc)(binary_class());
+        BOOST_HOF_TEST_CHECK(h(1, 2) == 3);
+
+        auto k = boost::hof::capture_alloc(alloc, 1, 2, 3)(capture_alloc_test::sum_f());
+        BOOST_HOF_TEST_CHECK(k(4) == 10);
+        auto copy = k;
+        BOOST_HOF_TEST_CHECK(copy(5) == 11);
+        auto moved = std::move(copy);
+        BOOST_HOF_TEST_CHECK(moved(6) == 12);
+        BOOST_HOF_TEST_CHECK(a.allocations == 5);
+    }
+    BOOST_HOF_TEST_CHECK(a.deallocations == 5);
+    a.reset();
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The closure only holds a pointer and the allocator
+    std::allocator<char> alloc;
+    auto f = boost::hof::capture_alloc(alloc, 1, 2, 3, 4, 5, 6, 7, 8)(capture_alloc_test::sum_f());
+    BOOST_HOF_TEST_CHECK(sizeof(f) == sizeof(void*));
+    BOOST_HOF_TEST_CHECK(f() == 36);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    capture_alloc_test::arena a;
+    capture_alloc_test::arena_allocator<char> alloc(&a);
+    int destroyed = 0;
+    {
+        auto f = boost::hof::capture_alloc(alloc, capture_alloc_test::destroy_counter(&destroyed))(boost::hof::identity);
+        destroyed = 0;
+        BOOST_HOF_TEST_CHECK(f().count == &destroyed);
+        destroyed = 0;
+    }
+    BOOST_HOF_TEST_CHECK(destroyed == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::allocator<char> alloc;
+    auto f = boost::hof::capture_alloc(alloc, std::unique_ptr<int>(new int(3)))([](const std::unique_ptr<int>& p, int x) { return *p + x; });
+    BOOST_HOF_TEST_CHECK(f(1) == 4);
+    auto g = std::move(f);
+    BOOST_HOF_TEST_CHECK(g(2) == 5);
+}
+
+#if BOOST_HOF_DETAIL_PACK_HAS_RVALUE_CALL
+namespace capture_move_test {
+
+struct take3
+{
+    int operator()(std::unique_ptr<int> x, std::unique_ptr<int> y, std::unique_ptr<int> z) const
+    {
+        return *x * 100 + *y * 10 + *z;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // Calling an rvalue capture moves the captured values into the function
+    auto f = boost::hof::capture(std::unique_ptr<int>(new int(4)), std::unique_ptr<int>(new int(5)))(capture_move_test::take3());
+    BOOST_HOF_TEST_CHECK(std::move(f)(std::unique_ptr<int>(new int(6))) == 456);
+}
+#endif
+
+namespace capture_shared_test {
+
+struct copy_counter
+{
+    int* copies;
+    int value;
+
+    copy_counter(int* c, int v)
+    : copies(c), value(v)
+    {}
+
+    copy_counter(const copy_counter& rhs)
+    : copies(rhs.copies), value(rhs.value)
+    {
+        ++*copies;
+    }
+};
+
+struct get_value
+{
+    int operator()(const copy_counter& x, int y) const
+    {
+        return x.value + y;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int copies = 0;
+    auto f = boost::hof::capture_shared(capture_shared_test::copy_counter(&copies, 1))(capture_shared_test::get_value());
+    copies = 0;
+    BOOST_HOF_TEST_CHECK(f(2) == 3);
+    BOOST_HOF_TEST_CHECK(sizeof(f) == sizeof(void*));
+    BOOST_HOF_TEST_CHECK(f.use_count() == 1);
+    {
+        auto g = f;
+        auto h = g;
+        BOOST_HOF_TEST_CHECK(g(3) == 4);
+        BOOST_HOF_TEST_CHECK(h(4) == 5);
+        BOOST_HOF_TEST_CHECK(f.use_count() == 3);
+        BOOST_HOF_TEST_CHECK(copies == 0);
+
+        // Only the updated copy sees the new value
+        g.update([](capture_shared_test::copy_counter& x) { x.value = 10; });
+        BOOST_HOF_TEST_CHECK(copies == 1);
+        BOOST_HOF_TEST_CHECK(g(1) == 11);
+        BOOST_HOF_TEST_CHECK(h(1) == 2);
+        BOOST_HOF_TEST_CHECK(f.use_count() == 2);
+        BOOST_HOF_TEST_CHECK(g.use_count() == 1);
+
+        // A unique block is modified in place
+        g.update([](capture_shared_test::copy_counter& x) { x.value = 20; });
+        BOOST_HOF_TEST_CHECK(copies == 1);
+        BOOST_HOF_TEST_CHECK(g(1) == 21);
+    }
+    BOOST_HOF_TEST_CHECK(f.use_count() == 1);
+    BOOST_HOF_TEST_CHECK(f(1) == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto values = boost::hof::capture_shared(boost::hof::single_thread, 1, 2);
+    auto f = values(binary_class());
+    auto g = values(capture_alloc_test::sum_f());
+    BOOST_HOF_TEST_CHECK(f() == 3);
+    BOOST_HOF_TEST_CHECK(g(3) == 6);
+    BOOST_HOF_TEST_CHECK(values.use_count() == 3);
+    BOOST_HOF_TEST_CHECK(f.update([](int& x, int&) { return x++; }) == 1);
+    BOOST_HOF_TEST_CHECK(f() == 4);
+    BOOST_HOF_TEST_CHECK(g() == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::capture_shared()(capture_alloc_test::sum_f())(1, 2) == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::capture_shared(std::unique_ptr<int>(new int(3)))([](const std::unique_ptr<int>& p, int x) { return *p + x; });
+    auto g = f;
+    BOOST_HOF_TEST_CHECK(f(1) == 4);
+    BOOST_HOF_TEST_CHECK(g(2) == 5);
+    auto h = std::move(g);
+    BOOST_HOF_TEST_CHECK(h(3) == 6);
+    BOOST_HOF_TEST_CHECK(f.use_count() == 2);
+}
+
+namespace cold_capture_test {
+
+struct check_limit
+{
+    int operator()(int limit, const std::string& message, int x, int y) const
+    {
+        return x + y <= limit ? x + y : int(message.size());
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::cold_capture(10, boost::hof::cold_value(std::string("over the limit")))(cold_capture_test::check_limit());
+    BOOST_HOF_TEST_CHECK(f(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(f(10, 2) == 14);
+    BOOST_HOF_TEST_CHECK(sizeof(f) == sizeof(std::pair<int, void*>));
+
+    // The cold values keep their place among the captured values
+    auto g = boost::hof::cold_capture(boost::hof::cold_value(1), 2, boost::hof::cold_value(3))(
+        [](int x, int y, int z, int w) { return x * 1000 + y * 100 + z * 10 + w; });
+    BOOST_HOF_TEST_CHECK(g(4) == 1234);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int copies = 0;
+    capture_shared_test::copy_counter c(&copies, 1);
+    auto f = boost::hof::cold_capture(boost::hof::cold_value(c))(capture_shared_test::get_value());
+    BOOST_HOF_TEST_CHECK(copies == 1);
+    auto g = f;
+    auto h = g;
+    BOOST_HOF_TEST_CHECK(f(2) == 3);
+    BOOST_HOF_TEST_CHECK(h(3) == 4);
+    BOOST_HOF_TEST_CHECK(copies == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto values = boost::hof::cold_capture(1, boost::hof::cold_value(std::unique_ptr<int>(new int(3))));
+    auto f = values([](int x, const std::unique_ptr<int>& p, int y) { return x + *p + y; });
+    auto g = f;
+    BOOST_HOF_TEST_CHECK(f(1) == 5);
+    BOOST_HOF_TEST_CHECK(g(2) == 6);
+    BOOST_HOF_TEST_CHECK(boost::hof::cold_capture()(binary_class())(1, 2) == 3);
+}
@@ -0,0 +1,71 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    co_compose.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/co_compose.hpp>
+#include "test.hpp"
+
+#if BOOST_HOF_HAS_COROUTINES
+
+namespace co_compose_test {
+
+struct increment
+{
+    int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+struct twice
+{
+    int operator()(int x) const
+    {
+        return x * 2;
+    }
+};
+
+struct co_twice
+{
+    boost::hof::co_task<int> operator()(int x) const
+    {
+        co_return x * 2;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::co_compose(co_compose_test::increment(), co_compose_test::twice());
+    STATIC_ASSERT_SAME(decltype(f(1)), int);
+    BOOST_HOF_TEST_CHECK(f(1) == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::co_compose(co_compose_test::increment(), co_compose_test::co_twice());
+    STATIC_ASSERT_SAME(decltype(f(1)), boost::hof::co_task<int>);
+    BOOST_HOF_TEST_CHECK(f(1).get() == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::co_compose(
+        co_compose_test::co_twice(),
+        co_compose_test::increment(),
+        co_compose_test::co_twice(),
+        co_compose_test::increment()
+    );
+    BOOST_HOF_TEST_CHECK(f(1).get() == 10);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::co_compose(co_compose_test::co_twice());
+    BOOST_HOF_TEST_CHECK(f(2).get() == 4);
+}
+
+#endif
@@ -0,0 +1,153 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    co_flow.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/co_flow.hpp>
+#include "test.hpp"
+
+#if BOOST_HOF_HAS_COROUTINES
+
+#include <memory>
+#include <stdexcept>
+
+namespace co_flow_test {
+
+struct increment
+{
+    int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+struct co_increment
+{
+    boost::hof::co_task<int> operator()(int x) const
+    {
+        co_return x + 1;
+    }
+};
+
+struct co_twice
+{
+    boost::hof::co_task<int> operator()(int x) const
+    {
+        co_return x * 2;
+    }
+};
+
+struct co_none
+{
+    boost::hof::co_task<void> operator()(int) const
+    {
+        co_return;
+    }
+};
+
+struct five
+{
+    int operator()() const
+    {
+        return 5;
+    }
+};
+
+struct co_fail
+{
+    boost::hof::co_task<int> operator()(int) const
+    {
+        throw std::runtime_error("error");
+        co_return 0;
+    }
+};
+
+struct offset
+{
+    std::shared_ptr<int> n;
+
+    int operator()(int x) const
+    {
+        return x + *n;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // Without awaitable stages, the functions are called directly
+    auto f = boost::hof::co_flow(co_flow_test::increment(), co_flow_test::increment());
+    STATIC_ASSERT_SAME(decltype(f(1)), int);
+    BOOST_HOF_TEST_CHECK(f(1) == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::co_flow(co_flow_test::co_increment(), co_flow_test::increment());
+    STATIC_ASSERT_SAME(decltype(f(1)), boost::hof::co_task<int>);
+    BOOST_HOF_TEST_CHECK(f(1).get() == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::co_flow(
+        co_flow_test::increment(),
+        co_flow_test::co_twice(),
+        co_flow_test::increment(),
+        co_flow_test::co_increment()
+    );
+    STATIC_ASSERT_SAME(decltype(f(1)), boost::hof::co_task<int>);
+    BOOST_HOF_TEST_CHECK(f(1).get() == 6);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::co_flow(co_flow_test::increment(), co_flow_test::co_increment());
+    BOOST_HOF_TEST_CHECK(f(1).get() == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::co_flow(co_flow_test::co_none(), co_flow_test::five());
+    BOOST_HOF_TEST_CHECK(f(1).get() == 5);
+    auto g = boost::hof::co_flow(co_flow_test::increment(), co_flow_test::co_none());
+    STATIC_ASSERT_SAME(decltype(g(1)), boost::hof::co_task<void>);
+    g(1).get();
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The task outlives the adaptor
+    boost::hof::co_task<int> t = boost::hof::co_flow(
+        co_flow_test::co_increment(),
+        co_flow_test::offset{std::make_shared<int>(10)}
+    )(1);
+    BOOST_HOF_TEST_CHECK(t.get() == 12);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::co_flow(co_flow_test::co_increment(), co_flow_test::co_fail(), co_flow_test::increment());
+    bool caught = false;
+    try
+    {
+        f(1).get();
+    }
+    catch(const std::runtime_error&)
+    {
+        caught = true;
+    }
+    BOOST_HOF_TEST_CHECK(caught);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::co_flow(co_flow_test::co_increment());
+    BOOST_HOF_TEST_CHECK(f(1).get() == 2);
+    boost::hof::co_flow_adaptor<co_flow_test::co_increment, co_flow_test::increment> g;
+    BOOST_HOF_TEST_CHECK(g(1).get() == 3);
+}
+
+#endif
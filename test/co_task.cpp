@@ -0,0 +1,139 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    co_task.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/co_task.hpp>
+#include "test.hpp"
+
+#if BOOST_HOF_HAS_COROUTINES
+
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace co_task_test {
+
+boost::hof::co_task<int> three()
+{
+    co_return 3;
+}
+
+boost::hof::co_task<int> add_one()
+{
+    co_return (co_await three()) + 1;
+}
+
+boost::hof::co_task<int> nested(int n)
+{
+    if (n == 0) co_return 0;
+    co_return (co_await nested(n - 1)) + 1;
+}
+
+boost::hof::co_task<void> set(int& x)
+{
+    x = 5;
+    co_return;
+}
+
+boost::hof::co_task<int> fail()
+{
+    throw std::runtime_error("error");
+    co_return 0;
+}
+
+boost::hof::co_task<std::unique_ptr<int>> make_ptr()
+{
+    co_return std::unique_ptr<int>(new int(2));
+}
+
+// Resumes the awaiting coroutine on another thread
+struct resume_on_thread
+{
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> h) const
+    {
+        std::thread([h] { h.resume(); }).detach();
+    }
+
+    int await_resume() const noexcept
+    {
+        return 7;
+    }
+};
+
+boost::hof::co_task<int> other_thread()
+{
+    co_return co_await resume_on_thread();
+}
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(co_task_test::three().get() == 3);
+    BOOST_HOF_TEST_CHECK(co_task_test::add_one().get() == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(co_task_test::nested(1000).get() == 1000);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int x = 0;
+    auto t = co_task_test::set(x);
+    BOOST_HOF_TEST_CHECK(t.valid());
+    BOOST_HOF_TEST_CHECK(x == 0);
+    t.get();
+    BOOST_HOF_TEST_CHECK(x == 5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    bool caught = false;
+    try
+    {
+        co_task_test::fail().get();
+    }
+    catch(const std::runtime_error&)
+    {
+        caught = true;
+    }
+    BOOST_HOF_TEST_CHECK(caught);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(*co_task_test::make_ptr().get() == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(co_task_test::other_thread().get() == 7);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto t = co_task_test::three();
+    auto u = std::move(t);
+    BOOST_HOF_TEST_CHECK(!t.valid());
+    BOOST_HOF_TEST_CHECK(u.valid());
+    BOOST_HOF_TEST_CHECK(u.get() == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    STATIC_ASSERT_SAME(decltype(co_task_test::three().get()), int);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::is_co_awaitable<boost::hof::co_task<int>>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::is_co_awaitable<co_task_test::resume_on_thread>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!boost::hof::is_co_awaitable<int>::value);
+}
+
+#endif
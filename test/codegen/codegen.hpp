@@ -0,0 +1,42 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    codegen.hpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#ifndef BOOST_HOF_GUARD_TEST_CODEGEN_HPP
+#define BOOST_HOF_GUARD_TEST_CODEGEN_HPP
+
+// Each `hof_<name>` function is compared with the `hand_<name>` function of
+// the same name. The hof version must not call any function from the
+// library, and must not be larger than the hand-written version by more than
+// the threshold.
+#define BOOST_HOF_CODEGEN(kind, name) extern "C" __attribute__((noinline)) int kind ## _ ## name
+
+namespace codegen_test {
+
+struct add
+{
+    int operator()(int x, int y) const
+    {
+        return x + y;
+    }
+};
+
+struct point
+{
+    int x;
+    int y;
+};
+
+struct get_x
+{
+    int operator()(const point& p) const
+    {
+        return p.x;
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,37 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    flow.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/flow.hpp>
+#include <boost/hof/lazy.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <boost/hof/proj.hpp>
+#include "codegen.hpp"
+
+namespace codegen_test {
+
+struct increment
+{
+    int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+}
+
+// A long chain of stages is still inlined completely
+BOOST_HOF_CODEGEN(hof, flow)(int x, int y)
+{
+    using namespace boost::hof;
+    codegen_test::increment i;
+    auto f = flow(proj(i, lazy(codegen_test::add())(_1, _2)), i, i, i, i, i, i, i, i, i, i, i);
+    return f(x, y);
+}
+
+BOOST_HOF_CODEGEN(hand, flow)(int x, int y)
+{
+    return x + y + 13;
+}
@@ -0,0 +1,18 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    infix.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/infix.hpp>
+#include "codegen.hpp"
+
+BOOST_HOF_CODEGEN(hof, infix)(int x, int y)
+{
+    return x <boost::hof::infix(codegen_test::add())> y;
+}
+
+BOOST_HOF_CODEGEN(hand, infix)(int x, int y)
+{
+    return codegen_test::add()(x, y);
+}
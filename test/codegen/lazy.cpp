@@ -0,0 +1,53 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    lazy.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/lazy.hpp>
+#include <boost/hof/placeholders.hpp>
+#include "codegen.hpp"
+
+BOOST_HOF_CODEGEN(hof, placeholders)(int x, int y)
+{
+    using namespace boost::hof;
+    return (_1 + _2)(x, y);
+}
+
+BOOST_HOF_CODEGEN(hand, placeholders)(int x, int y)
+{
+    return x + y;
+}
+
+BOOST_HOF_CODEGEN(hof, lazy)(int x, int y)
+{
+    using namespace boost::hof;
+    return lazy(codegen_test::add())(_2, _1)(x, y);
+}
+
+BOOST_HOF_CODEGEN(hand, lazy)(int x, int y)
+{
+    return codegen_test::add()(y, x);
+}
+
+BOOST_HOF_CODEGEN(hof, nested_placeholders)(int x, int y, int z)
+{
+    using namespace boost::hof;
+    return (_1 * _2 + _3)(x, y, z);
+}
+
+BOOST_HOF_CODEGEN(hand, nested_placeholders)(int x, int y, int z)
+{
+    return x * y + z;
+}
+
+BOOST_HOF_CODEGEN(hof, nested_lazy)(int x, int y, int z)
+{
+    using namespace boost::hof;
+    return lazy(codegen_test::add())(lazy(codegen_test::add())(_3, _1), lazy(codegen_test::add())(_2, 1))(x, y, z);
+}
+
+BOOST_HOF_CODEGEN(hand, nested_lazy)(int x, int y, int z)
+{
+    return codegen_test::add()(codegen_test::add()(z, x), codegen_test::add()(y, 1));
+}
@@ -0,0 +1,34 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    lift.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/lift.hpp>
+#include "codegen.hpp"
+
+namespace codegen_test {
+
+inline int twice(int x)
+{
+    return 2 * x;
+}
+
+}
+
+#if BOOST_HOF_HAS_AUTO_TEMPLATE_PARAMETER
+BOOST_HOF_CODEGEN(hof, lift)(int x)
+{
+    return boost::hof::lift<&codegen_test::twice>(x);
+}
+#else
+BOOST_HOF_CODEGEN(hof, lift)(int x)
+{
+    return BOOST_HOF_LIFT(codegen_test::twice)(x);
+}
+#endif
+
+BOOST_HOF_CODEGEN(hand, lift)(int x)
+{
+    return codegen_test::twice(x);
+}
@@ -0,0 +1,20 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    minmax.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/minmax.hpp>
+#include "codegen.hpp"
+
+BOOST_HOF_CODEGEN(hof, minmax)(int a, int b, int c, int d)
+{
+    return boost::hof::pack_max(a, b, c, d);
+}
+
+BOOST_HOF_CODEGEN(hand, minmax)(int a, int b, int c, int d)
+{
+    int x = (a < b) ? b : a;
+    int y = (c < d) ? d : c;
+    return (x < y) ? y : x;
+}
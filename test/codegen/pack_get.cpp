@@ -0,0 +1,29 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    pack_get.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/pack.hpp>
+#include "codegen.hpp"
+
+namespace codegen_pack_get_test {
+
+struct record
+{
+    int a;
+    char b;
+    long c;
+};
+
+}
+
+BOOST_HOF_CODEGEN(hof, pack_get)(const decltype(boost::hof::pack(1, 'a', 2L))& p)
+{
+    return boost::hof::pack_get<2>(p);
+}
+
+BOOST_HOF_CODEGEN(hand, pack_get)(const codegen_pack_get_test::record& r)
+{
+    return r.c;
+}
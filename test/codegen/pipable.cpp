@@ -0,0 +1,18 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    pipable.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/pipable.hpp>
+#include "codegen.hpp"
+
+BOOST_HOF_CODEGEN(hof, pipable)(int x, int y)
+{
+    return x | boost::hof::pipable(codegen_test::add())(y);
+}
+
+BOOST_HOF_CODEGEN(hand, pipable)(int x, int y)
+{
+    return codegen_test::add()(x, y);
+}
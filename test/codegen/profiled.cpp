@@ -0,0 +1,20 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    profiled.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+// The decorator must compile to nothing when the profiling is disabled
+#define BOOST_HOF_PROFILING 0
+#include <boost/hof/profiled.hpp>
+#include "codegen.hpp"
+
+BOOST_HOF_CODEGEN(hof, profiled)(int x, int y)
+{
+    return boost::hof::profiled("add")(codegen_test::add())(x, y);
+}
+
+BOOST_HOF_CODEGEN(hand, profiled)(int x, int y)
+{
+    return codegen_test::add()(x, y);
+}
@@ -0,0 +1,18 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    proj.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/proj.hpp>
+#include "codegen.hpp"
+
+BOOST_HOF_CODEGEN(hof, proj)(codegen_test::point a, codegen_test::point b)
+{
+    return boost::hof::proj(codegen_test::get_x(), codegen_test::add())(a, b);
+}
+
+BOOST_HOF_CODEGEN(hand, proj)(codegen_test::point a, codegen_test::point b)
+{
+    return codegen_test::add()(codegen_test::get_x()(a), codegen_test::get_x()(b));
+}
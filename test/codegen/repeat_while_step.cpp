@@ -0,0 +1,52 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    repeat_while_step.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/repeat_while_step.hpp>
+#include "codegen.hpp"
+
+namespace codegen_test {
+
+struct maybe_point
+{
+    bool engaged;
+    point value;
+
+    explicit operator bool() const
+    {
+        return engaged;
+    }
+
+    const point& operator*() const
+    {
+        return value;
+    }
+};
+
+struct walk
+{
+    maybe_point operator()(const point& p) const
+    {
+        maybe_point r = { p.x * p.y < 1000, { p.x + 1, p.y + 2 } };
+        return r;
+    }
+};
+
+}
+
+BOOST_HOF_CODEGEN(hof, repeat_while_step)(codegen_test::point p)
+{
+    return boost::hof::repeat_while_step(codegen_test::walk())(p).y;
+}
+
+BOOST_HOF_CODEGEN(hand, repeat_while_step)(codegen_test::point p)
+{
+    while(p.x * p.y < 1000)
+    {
+        p.x += 1;
+        p.y += 2;
+    }
+    return p.y;
+}
@@ -0,0 +1,63 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tuple.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/tuple_transform.hpp>
+#include <boost/hof/tuple_zip_with.hpp>
+#include <tuple>
+#include "codegen.hpp"
+
+namespace codegen_tuple_test {
+
+typedef std::tuple<float, float, float, float> float4;
+
+struct mul
+{
+    float operator()(float x, float y) const
+    {
+        return x * y;
+    }
+};
+
+struct scale
+{
+    float operator()(float x) const
+    {
+        return x * 2.0f;
+    }
+};
+
+}
+
+BOOST_HOF_CODEGEN(hof, tuple_transform)(const codegen_tuple_test::float4& x, codegen_tuple_test::float4& r)
+{
+    r = boost::hof::tuple_transform(x, codegen_tuple_test::scale());
+    return 0;
+}
+
+BOOST_HOF_CODEGEN(hand, tuple_transform)(const codegen_tuple_test::float4& x, codegen_tuple_test::float4& r)
+{
+    codegen_tuple_test::scale f;
+    r = codegen_tuple_test::float4(f(std::get<0>(x)), f(std::get<1>(x)), f(std::get<2>(x)), f(std::get<3>(x)));
+    return 0;
+}
+
+BOOST_HOF_CODEGEN(hof, tuple_zip_with)(const codegen_tuple_test::float4& x, const codegen_tuple_test::float4& y, codegen_tuple_test::float4& r)
+{
+    r = boost::hof::tuple_zip_with(x, y, codegen_tuple_test::mul());
+    return 0;
+}
+
+BOOST_HOF_CODEGEN(hand, tuple_zip_with)(const codegen_tuple_test::float4& x, const codegen_tuple_test::float4& y, codegen_tuple_test::float4& r)
+{
+    codegen_tuple_test::mul f;
+    r = codegen_tuple_test::float4(
+        f(std::get<0>(x), std::get<0>(y)),
+        f(std::get<1>(x), std::get<1>(y)),
+        f(std::get<2>(x), std::get<2>(y)),
+        f(std::get<3>(x), std::get<3>(y))
+    );
+    return 0;
+}
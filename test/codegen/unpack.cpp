@@ -0,0 +1,41 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    unpack.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/fixed_view.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/unpack.hpp>
+#include <tuple>
+#include "codegen.hpp"
+
+BOOST_HOF_CODEGEN(hof, unpack_tuple)(int x, int y)
+{
+    return boost::hof::unpack(codegen_test::add())(std::make_tuple(x, y));
+}
+
+BOOST_HOF_CODEGEN(hand, unpack_tuple)(int x, int y)
+{
+    return codegen_test::add()(x, y);
+}
+
+BOOST_HOF_CODEGEN(hof, unpack_pack)(int x, int y)
+{
+    return boost::hof::unpack(codegen_test::add())(boost::hof::pack(x, y));
+}
+
+BOOST_HOF_CODEGEN(hand, unpack_pack)(int x, int y)
+{
+    return codegen_test::add()(x, y);
+}
+
+BOOST_HOF_CODEGEN(hof, unpack_fixed_view)(const int* p)
+{
+    return boost::hof::unpack(codegen_test::add())(boost::hof::make_fixed_view<2>(p));
+}
+
+BOOST_HOF_CODEGEN(hand, unpack_fixed_view)(const int* p)
+{
+    return codegen_test::add()(p[0], p[1]);
+}
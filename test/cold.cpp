@@ -0,0 +1,65 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    cold.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/cold.hpp>
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include "test.hpp"
+
+namespace cold_test {
+
+struct fast_path
+{
+    constexpr int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+struct slow_fallback
+{
+    template<class T>
+    constexpr int operator()(T) const
+    {
+        return -1;
+    }
+};
+
+struct is_negative
+{
+    constexpr int operator()(int x) const
+    {
+        return x < 0 ? 3 : 0;
+    }
+};
+
+struct not_a_predicate
+{
+    void operator()(int) const
+    {}
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace cold_test;
+    auto f = boost::hof::first_of(fast_path(), boost::hof::cold(slow_fallback()));
+    BOOST_HOF_TEST_CHECK(f(1) == 2);
+    BOOST_HOF_TEST_CHECK(f("x") == -1);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::cold(fast_path())(1) == 2);
+    static_assert(!boost::hof::is_invocable<boost::hof::cold_adaptor<fast_path>, const char*>::value, "Not callable");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace cold_test;
+    STATIC_ASSERT_SAME(decltype(boost::hof::likely_(is_negative())(1)), bool);
+    BOOST_HOF_TEST_CHECK(boost::hof::likely_(is_negative())(-1));
+    BOOST_HOF_TEST_CHECK(!boost::hof::unlikely_(is_negative())(1));
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unlikely_(is_negative())(-1));
+    static_assert(!boost::hof::is_invocable<boost::hof::likely_adaptor<not_a_predicate>, int>::value, "Not a predicate");
+}
@@ -66,6 +66,25 @@ BOOST_HOF_TEST_CASE()
         == make_mini_pair(make_mini_pair(1, 2), make_mini_pair(2, 4)));
 }
 
+struct add_n
+{
+    int n;
+    constexpr int operator()(int x) const
+    {
+        return n + x;
+    }
 
+    constexpr int operator()(int x, int y) const
+    {
+        return n + x + y;
+    }
+};
 
-
+BOOST_HOF_TEST_CASE()
+{
+    // The main function can be the same type as one of the functions it is
+    // combined with, and each keeps its own state
+    BOOST_HOF_TEST_CHECK(boost::hof::combine(add_n{1}, add_n{10}, add_n{100})(2, 3) == 1 + 12 + 103);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::combine(add_n{1}, add_n{10}, add_n{100})(2, 3) == 1 + 12 + 103);
+    BOOST_HOF_STATIC_TEST_CHECK(sizeof(boost::hof::combine(add_n{1}, add_n{10}, add_n{100})) == 3 * sizeof(int));
+}
@@ -0,0 +1,24 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    compile_markers.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#define BOOST_HOF_COMPILE_MARKERS 1
+#include <boost/hof.hpp>
+#include "test.hpp"
+
+#include <type_traits>
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::compose(boost::hof::_1 + 1, binary_class());
+    STATIC_ASSERT_SAME(boost::hof::markers::compose<decltype(boost::hof::_1 + 1), binary_class>::type, decltype(f));
+    BOOST_HOF_TEST_CHECK(f(1, 2) == 4);
+
+    auto g = boost::hof::first_of(unary_class(), binary_class());
+    STATIC_ASSERT_SAME(boost::hof::markers::first_of<unary_class, binary_class>::type, decltype(g));
+    BOOST_HOF_TEST_CHECK(g(1, 2) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::flip(binary_class())(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::mutable_(binary_class())(1, 2) == 3);
+}
@@ -5,10 +5,12 @@
     file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 ==============================================================================*/
 #include <boost/hof/compose.hpp>
+#include <boost/hof/flow.hpp>
 #include <boost/hof/function.hpp>
 #include <boost/hof/lambda.hpp>
 #include <boost/hof/placeholders.hpp>
 #include <memory>
+#include <string>
 #include "test.hpp"
 
 namespace compose_test {
@@ -65,6 +67,30 @@ struct decrement_movable
     }
 };
 
+struct unassignable
+{
+    int value;
+    constexpr unassignable(int x) : value(x)
+    {}
+    unassignable(unassignable&&)=default;
+    unassignable& operator=(unassignable&&)=delete;
+};
+
+struct increment_unassignable
+{
+    constexpr unassignable operator()(unassignable x) const
+    {
+        return unassignable(x.value + 1);
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::compose(increment_unassignable(), increment_unassignable(), increment_unassignable());
+    BOOST_HOF_TEST_CHECK(f(unassignable(1)).value == 4);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::compose(increment_unassignable(), increment_unassignable(), increment_unassignable())(unassignable(1)).value == 4);
+}
+
 #if BOOST_HOF_HAS_NOEXCEPT_DEDUCTION
 BOOST_HOF_TEST_CASE()
 {
@@ -183,4 +209,77 @@ BOOST_HOF_TEST_CASE()
     BOOST_HOF_TEST_CHECK(boost::hof::compose(boost::hof::_1 * boost::hof::_1, boost::hof::_1 + boost::hof::_1)(3) == 36);
     BOOST_HOF_STATIC_TEST_CHECK(boost::hof::compose(boost::hof::_1 * boost::hof::_1, boost::hof::_1 + boost::hof::_1)(3) == 36);
 }
+#if BOOST_HOF_CALLABLE_BASE_USE_TEMPLATE_ALIAS
+BOOST_HOF_TEST_CASE()
+{
+    // An adaptor that is the last function is spliced into the result
+    typedef boost::hof::compose_adaptor<increment, negate, decrement> flat;
+    STATIC_ASSERT_SAME(decltype(boost::hof::compose(increment(), boost::hof::compose(negate(), decrement()))), flat);
+    STATIC_ASSERT_SAME(decltype(boost::hof::compose(increment(), negate(), boost::hof::compose(decrement()))), flat);
+    STATIC_ASSERT_SAME(decltype(boost::hof::compose(boost::hof::compose(increment(), negate(), decrement()))), flat);
+    // Anywhere else it is kept as one function
+    STATIC_ASSERT_SAME(decltype(boost::hof::compose(boost::hof::compose(increment(), negate()), decrement())),
+        boost::hof::compose_adaptor<boost::hof::compose_adaptor<increment, negate>, decrement>);
+    STATIC_ASSERT_SAME(decltype(boost::hof::compose(increment(), boost::hof::flow(negate(), decrement()))),
+        boost::hof::compose_adaptor<increment, boost::hof::flow_adaptor<negate, decrement>>);
+}
+#endif
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::compose(increment(), boost::hof::compose(negate(), decrement()))(3) == -1);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::compose(increment(), boost::hof::compose(negate(), decrement()))(3) == -1);
+    BOOST_HOF_TEST_CHECK(boost::hof::compose(boost::hof::compose(increment(), negate()), decrement())(3) == -1);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::compose(boost::hof::compose(increment(), negate()), decrement())(3) == -1);
+
+    auto f = boost::hof::compose(boost::hof::compose(increment_movable(), negate()), boost::hof::compose(decrement_movable(), increment()));
+    BOOST_HOF_TEST_CHECK(f(3) == boost::hof::compose(increment(), negate(), decrement(), increment())(3));
+    auto g = boost::hof::compose(boost::hof::compose(increment_movable(), negate()), increment());
+    auto h = boost::hof::compose(std::move(g), decrement_movable());
+    BOOST_HOF_TEST_CHECK(h(3) == boost::hof::compose(increment(), negate(), increment(), decrement())(3));
+}
+struct widen
+{
+    constexpr long operator()(int x) const noexcept
+    {
+        return x * 2L;
+    }
+};
+
+struct append
+{
+    std::string s;
+    std::string operator()(std::string x) const
+    {
+        return x + s;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::compose(increment(), increment(), increment(), increment(), increment(), increment(), increment(), increment());
+    BOOST_HOF_TEST_CHECK(f(1) == 9);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::compose(increment(), increment(), increment(), increment(), increment(), increment())(1) == 7);
+    STATIC_ASSERT_SAME(decltype(f(1)), int);
+    STATIC_ASSERT_SAME(decltype(f(1L)), long);
+
+    auto g = boost::hof::compose(append{"d"}, append{"c"}, append{"b"});
+    BOOST_HOF_TEST_CHECK(g(std::string("a")) == "abcd");
+    BOOST_HOF_TEST_CHECK(g("a") == "abcd");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::compose(increment(), widen(), increment())(3) == 9);
+    STATIC_ASSERT_SAME(decltype(boost::hof::compose(increment(), widen(), increment())(3)), long);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::compose(increment(), increment(), widen(), increment())(3) == 10);
+    BOOST_HOF_TEST_CHECK(boost::hof::compose(increment(), boost::hof::identity, increment())(3) == 5);
+}
+#if BOOST_HOF_HAS_NOEXCEPT_DEDUCTION
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(noexcept(boost::hof::compose(increment(), decrement(), increment(), negate())(3)), "noexcept compose");
+    static_assert(!noexcept(boost::hof::compose(append{"b"}, append{"c"}, append{"d"})(std::string())), "noexcept compose");
+}
+#endif
 }
@@ -0,0 +1,81 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    compose_optional.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/compose_optional.hpp>
+#include "test.hpp"
+
+namespace compose_optional_test {
+
+template<class T>
+struct maybe
+{
+    bool has;
+    T value;
+
+    constexpr maybe() : has(false), value()
+    {}
+
+    constexpr maybe(T x) : has(true), value(x)
+    {}
+
+    constexpr explicit operator bool() const
+    {
+        return has;
+    }
+
+    constexpr const T& operator*() const
+    {
+        return value;
+    }
+};
+
+struct half
+{
+    constexpr maybe<int> operator()(int x) const
+    {
+        return x % 2 == 0 ? maybe<int>(x / 2) : maybe<int>();
+    }
+};
+
+struct increment
+{
+    constexpr maybe<int> operator()(int x) const
+    {
+        return maybe<int>(x + 1);
+    }
+};
+
+struct positive
+{
+    constexpr maybe<int> operator()(int x) const
+    {
+        return x > 0 ? maybe<int>(x) : maybe<int>();
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace compose_optional_test;
+    auto f = boost::hof::compose_optional(half(), increment(), half());
+    BOOST_HOF_TEST_CHECK(*f(6) == 2);
+    BOOST_HOF_TEST_CHECK(!f(5));
+    BOOST_HOF_TEST_CHECK(!f(4));
+    BOOST_HOF_TEST_CHECK(*boost::hof::compose_optional(half())(8) == 4);
+
+    BOOST_HOF_STATIC_TEST_CHECK(*boost::hof::compose_optional(half(), increment(), half())(6) == 2);
+    BOOST_HOF_STATIC_TEST_CHECK(!boost::hof::compose_optional(half(), increment(), half())(4));
+}
+
+// The last function is called first
+BOOST_HOF_TEST_CASE()
+{
+    using namespace compose_optional_test;
+    BOOST_HOF_TEST_CHECK(*boost::hof::compose_optional(increment(), positive())(1) == 2);
+    BOOST_HOF_TEST_CHECK(!boost::hof::compose_optional(increment(), positive())(0));
+    BOOST_HOF_TEST_CHECK(*boost::hof::compose_optional(positive(), increment())(0) == 1);
+}
@@ -10,8 +10,11 @@
 #include <boost/hof/first_of.hpp>
 #include <boost/hof/proj.hpp>
 #include <boost/hof/placeholders.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/is_invocable.hpp>
 
 #include <tuple>
+#include <memory>
 #include <type_traits>
 #include <vector>
 
@@ -220,3 +223,134 @@ BOOST_HOF_TEST_CASE()
 #endif
 }
 
+
+namespace construct_test {
+
+struct pinned
+{
+    int x;
+    int y;
+    pinned(int a, int b) : x(a), y(b)
+    {}
+    pinned(const pinned&) = delete;
+    pinned& operator=(const pinned&) = delete;
+};
+
+template<class T>
+struct tagged_allocator
+{
+    typedef T value_type;
+    int tag;
+
+    tagged_allocator(int t) : tag(t)
+    {}
+
+    template<class U>
+    tagged_allocator(const tagged_allocator<U>& a) : tag(a.tag)
+    {}
+
+    T* allocate(std::size_t n)
+    {
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n)
+    {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template<class U>
+    bool operator==(const tagged_allocator<U>& a) const
+    {
+        return tag == a.tag;
+    }
+
+    template<class U>
+    bool operator!=(const tagged_allocator<U>& a) const
+    {
+        return tag != a.tag;
+    }
+};
+
+struct leading_alloc
+{
+    typedef tagged_allocator<int> allocator_type;
+    int value;
+    int tag;
+    leading_alloc(std::allocator_arg_t, const allocator_type& a, int x) : value(x), tag(a.tag)
+    {}
+};
+
+struct trailing_alloc
+{
+    typedef tagged_allocator<int> allocator_type;
+    int value;
+    int tag;
+    trailing_alloc(int x, const allocator_type& a) : value(x), tag(a.tag)
+    {}
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using construct_test::pinned;
+    typename std::aligned_storage<sizeof(pinned), alignof(pinned)>::type buffer;
+    pinned * p = boost::hof::construct_at<pinned>(&buffer)(1, 2);
+    BOOST_HOF_TEST_CHECK(static_cast<void*>(p) == static_cast<void*>(&buffer));
+    BOOST_HOF_TEST_CHECK(p->x == 1);
+    BOOST_HOF_TEST_CHECK(p->y == 2);
+    p->~pinned();
+
+    p = boost::hof::unpack(boost::hof::construct_at<pinned>(&buffer))(std::make_tuple(3, 4));
+    BOOST_HOF_TEST_CHECK(p->x == 3);
+    BOOST_HOF_TEST_CHECK(p->y == 4);
+    p->~pinned();
+
+    static_assert(!boost::hof::is_invocable<boost::hof::detail::construct_at_f<pinned>, int>::value, "Not sfinae friendly");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    typename std::aligned_storage<sizeof(std::vector<int>), alignof(std::vector<int>)>::type buffer;
+    std::vector<int> * v = boost::hof::construct_at<std::vector<int>>(&buffer)({1, 2, 3});
+    BOOST_HOF_TEST_CHECK(v->size() == 3);
+    BOOST_HOF_TEST_CHECK(v->back() == 3);
+    v->~vector();
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<std::pair<int, char>> v;
+    auto emplace = boost::hof::emplace_into(v);
+    emplace(1, 'a');
+    boost::hof::unpack(emplace)(std::make_tuple(2, 'b'));
+    BOOST_HOF_TEST_CHECK(v.size() == 2);
+    BOOST_HOF_TEST_CHECK(v[0] == std::make_pair(1, 'a'));
+    BOOST_HOF_TEST_CHECK(v[1] == std::make_pair(2, 'b'));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace construct_test;
+    tagged_allocator<int> a(7);
+
+    auto l = boost::hof::construct_alloc<leading_alloc>(a)(1);
+    BOOST_HOF_TEST_CHECK(l.value == 1);
+    BOOST_HOF_TEST_CHECK(l.tag == 7);
+
+    auto t = boost::hof::construct_alloc<trailing_alloc>(a)(2);
+    BOOST_HOF_TEST_CHECK(t.value == 2);
+    BOOST_HOF_TEST_CHECK(t.tag == 7);
+
+    auto v = boost::hof::construct_alloc<std::vector<int, tagged_allocator<int>>>(a)(3, 1);
+    BOOST_HOF_TEST_CHECK(v.size() == 3);
+    BOOST_HOF_TEST_CHECK(v.get_allocator().tag == 7);
+
+    // Without uses_allocator, the allocator isn't passed
+    auto i = boost::hof::construct_alloc<ac<int>>(a)(4);
+    BOOST_HOF_TEST_CHECK(i.value == 4);
+
+    static_assert(!boost::hof::is_invocable<decltype(boost::hof::construct_alloc<leading_alloc>(a))>::value, "Not sfinae friendly");
+    static_assert(!boost::hof::is_invocable<decltype(boost::hof::construct_alloc<ac<int>>(a)), int, int>::value, "Not sfinae friendly");
+}
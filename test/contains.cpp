@@ -0,0 +1,134 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    contains.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/contains.hpp>
+#include <boost/hof/flip.hpp>
+#include <boost/hof/infix.hpp>
+#include <array>
+#include <functional>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "test.hpp"
+
+namespace contains_test {
+
+// Counts which search is used
+struct tracked
+{
+    std::vector<int> values;
+    mutable int* finds;
+
+    std::vector<int>::const_iterator begin() const
+    {
+        return values.begin();
+    }
+
+    std::vector<int>::const_iterator end() const
+    {
+        return values.end();
+    }
+
+    std::vector<int>::const_iterator find(int x) const
+    {
+        ++*finds;
+        for(auto it = values.begin(); it != values.end(); ++it) if (*it == x) return it;
+        return values.end();
+    }
+};
+
+struct with_contains
+{
+    bool contains(int x) const
+    {
+        return x == 7;
+    }
+};
+
+struct descending
+{
+    bool operator()(int x, int y) const
+    {
+        return x > y;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> v = { 1, 2, 3, 4, 5 };
+    std::list<int> l = { 1, 2, 3 };
+    int array[] = { 4, 5, 6 };
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(v, 5));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(v, 8));
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(l, 2));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(l, 4));
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(array, 6));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(array, 1));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(std::vector<int>(), 1));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::map<int, std::string> m = { { 1, "1" }, { 4, "4" } };
+    std::set<std::string> s = { "a", "b" };
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(m, 4));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(m, 2));
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(s, "b"));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(s, "c"));
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(contains_test::with_contains(), 7));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(contains_test::with_contains(), 1));
+
+    int finds = 0;
+    contains_test::tracked t = { { 1, 2, 3 }, &finds };
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(t, 2));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(t, 4));
+    BOOST_HOF_TEST_CHECK(finds == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::string s = "hello world";
+    std::vector<char> chars = { 'a', '\0', 'b' };
+    std::array<char, 0> empty = {};
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(s, 'w'));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(s, 'z'));
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(s, "world"));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(s, "word"));
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(s, std::string("lo w")));
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(chars, 'b'));
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(chars, '\0'));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(chars, 'c'));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(empty, 'a'));
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(std::string("\xff"), '\xff'));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> v = { 1, 3, 5, 7, 9 };
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(boost::hof::sorted(v), 7));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(boost::hof::sorted(v), 4));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(boost::hof::sorted(std::vector<int>()), 4));
+    STATIC_ASSERT_SAME(decltype(boost::hof::sorted(v)), boost::hof::sorted_range<std::vector<int>&>);
+
+    std::vector<int> d = { 9, 5, 1 };
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(boost::hof::sorted(d, contains_test::descending()), 5));
+    BOOST_HOF_TEST_CHECK(!boost::hof::contains(boost::hof::sorted(d, contains_test::descending()), 3));
+    // The comparison is used even when the range has a find
+    std::set<int, std::greater<int>> s = { 3, 2, 1 };
+    BOOST_HOF_TEST_CHECK(boost::hof::contains(boost::hof::sorted(s, std::greater<int>()), 2));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto in = boost::hof::infix(boost::hof::flip(boost::hof::contains));
+    std::vector<int> v = { 1, 2, 3 };
+    BOOST_HOF_TEST_CHECK(2 <in> v);
+    BOOST_HOF_TEST_CHECK(!(4 <in> v));
+}
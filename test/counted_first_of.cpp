@@ -0,0 +1,111 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    counted_first_of.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/counted_first_of.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include "test.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace counted_first_of_test {
+
+struct int_f
+{
+    int operator()(int) const
+    {
+        return 1;
+    }
+};
+
+struct pointer_f
+{
+    int operator()(int*) const
+    {
+        return 2;
+    }
+};
+
+struct any_f
+{
+    template<class T>
+    int operator()(T) const
+    {
+        return 3;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::counted_first_of(counted_first_of_test::int_f(), counted_first_of_test::pointer_f(), counted_first_of_test::any_f());
+    BOOST_HOF_TEST_CHECK(f(1) == 1);
+    BOOST_HOF_TEST_CHECK(f(nullptr) == 2);
+    BOOST_HOF_TEST_CHECK(f(nullptr) == 2);
+    BOOST_HOF_TEST_CHECK(f("") == 3);
+    // The first invocable function is the one that is counted
+    BOOST_HOF_TEST_CHECK(f('a') == 1);
+    auto s = f.stats();
+    BOOST_HOF_TEST_CHECK(s.size() == 3);
+    BOOST_HOF_TEST_CHECK(s[0] == 2);
+    BOOST_HOF_TEST_CHECK(s[1] == 2);
+    BOOST_HOF_TEST_CHECK(s[2] == 1);
+
+    auto g = f;
+    BOOST_HOF_TEST_CHECK(g.stats() == s);
+    f.reset();
+    BOOST_HOF_TEST_CHECK(f.stats()[0] == 0);
+    BOOST_HOF_TEST_CHECK(g.stats()[0] == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::counted_first_of(counted_first_of_test::int_f(), counted_first_of_test::pointer_f());
+    static_assert(boost::hof::is_invocable<decltype(f), int>::value, "Not callable");
+    static_assert(!boost::hof::is_invocable<decltype(f), const char*>::value, "Callable");
+    BOOST_HOF_TEST_CHECK(f.stats()[0] == 0);
+    BOOST_HOF_TEST_CHECK(f.stats()[1] == 0);
+
+    auto single = boost::hof::counted_first_of(binary_class());
+    BOOST_HOF_TEST_CHECK(single(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(single.stats()[0] == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The counts from all the threads are kept
+    auto f = boost::hof::counted_first_of(counted_first_of_test::int_f(), counted_first_of_test::pointer_f());
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) threads.emplace_back([&] {
+        for (int j = 0; j < 1000; j++)
+        {
+            f(j);
+            f(nullptr);
+        }
+    });
+    for (auto& t : threads) t.join();
+    BOOST_HOF_TEST_CHECK(f.stats()[0] == 4000);
+    BOOST_HOF_TEST_CHECK(f.stats()[1] == 4000);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // More threads than shards, so some of them share a shard
+    auto f = boost::hof::counted_first_of(counted_first_of_test::int_f(), counted_first_of_test::pointer_f());
+    static_assert(alignof(decltype(f.counters)) >= 64, "The shards aren't on separate cache lines");
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < 2 * BOOST_HOF_COUNTER_SHARDS + 1; i++) threads.emplace_back([&] {
+        for (int j = 0; j < 100; j++) f(j);
+    });
+    for (auto& t : threads) t.join();
+    auto g = f;
+    BOOST_HOF_TEST_CHECK(f.stats()[0] == 100 * (2 * BOOST_HOF_COUNTER_SHARDS + 1));
+    BOOST_HOF_TEST_CHECK(g.stats() == f.stats());
+    f.reset();
+    BOOST_HOF_TEST_CHECK(f.stats()[0] == 0);
+    BOOST_HOF_TEST_CHECK(g.stats()[0] == 100 * (2 * BOOST_HOF_COUNTER_SHARDS + 1));
+}
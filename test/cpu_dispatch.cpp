@@ -0,0 +1,82 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    cpu_dispatch.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/cpu_dispatch.hpp>
+#include <boost/hof/function.hpp>
+#include "test.hpp"
+
+namespace cpu_dispatch_test {
+
+struct unsupported
+{
+    static bool supported() noexcept
+    {
+        return false;
+    }
+};
+
+int checks = 0;
+
+struct counted
+{
+    static bool supported() noexcept
+    {
+        checks++;
+        return true;
+    }
+};
+
+template<int N>
+struct kernel
+{
+    constexpr kernel()
+    {}
+
+    int operator()(int x) const
+    {
+        return x + N;
+    }
+};
+
+BOOST_HOF_STATIC_FUNCTION(counted_kernel) = boost::hof::cpu_dispatch(
+    boost::hof::cpu_target<unsupported>(kernel<1>()),
+    boost::hof::cpu_target<counted>(kernel<2>()),
+    kernel<3>()
+);
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace cpu_dispatch_test;
+    BOOST_HOF_TEST_CHECK(boost::hof::cpu_dispatch(kernel<1>())(1) == 2);
+    BOOST_HOF_TEST_CHECK(boost::hof::cpu_dispatch(kernel<1>(), kernel<2>())(1) == 2);
+    BOOST_HOF_TEST_CHECK(boost::hof::cpu_dispatch(boost::hof::cpu_target<unsupported>(kernel<1>()), kernel<2>())(1) == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace cpu_dispatch_test;
+    BOOST_HOF_TEST_CHECK(counted_kernel(1) == 3);
+    BOOST_HOF_TEST_CHECK(counted_kernel(2) == 4);
+    BOOST_HOF_TEST_CHECK(checks == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace cpu_dispatch_test;
+    auto f = boost::hof::cpu_dispatch(
+        boost::hof::cpu_target<boost::hof::cpu_avx512f>(kernel<1>()),
+        boost::hof::cpu_target<boost::hof::cpu_avx2>(kernel<1>()),
+        boost::hof::cpu_target<boost::hof::cpu_avx>(kernel<1>()),
+        boost::hof::cpu_target<boost::hof::cpu_sse4_2>(kernel<1>()),
+        boost::hof::cpu_target<boost::hof::cpu_sse2>(kernel<1>()),
+        boost::hof::cpu_target<boost::hof::cpu_neon>(kernel<1>()),
+        kernel<1>()
+    );
+    BOOST_HOF_TEST_CHECK(f(1) == 2);
+    BOOST_HOF_TEST_CHECK(boost::hof::cpu_target<boost::hof::cpu_avx2>(kernel<2>())(1) == 3);
+}
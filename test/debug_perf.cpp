@@ -0,0 +1,57 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    debug_perf.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#define BOOST_HOF_DEBUG_PERF 1
+#include <boost/hof.hpp>
+#include "test.hpp"
+
+namespace debug_perf_test {
+
+struct increment
+{
+    template<class T>
+    constexpr T operator()(T x) const noexcept
+    {
+        return x + 1;
+    }
+};
+
+struct decrement
+{
+    template<class T>
+    constexpr T operator()(T x) const noexcept
+    {
+        return x - 1;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::compose(debug_perf_test::increment(), debug_perf_test::decrement(), debug_perf_test::increment())(3) == 4);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::compose(debug_perf_test::increment(), debug_perf_test::decrement(), debug_perf_test::increment())(3) == 4);
+    BOOST_HOF_TEST_CHECK(boost::hof::flow(debug_perf_test::increment(), debug_perf_test::increment())(3) == 5);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::flow(debug_perf_test::increment(), debug_perf_test::increment())(3) == 5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK((1 | boost::hof::pipable(binary_class())(2)) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK((1 | boost::hof::pipable(binary_class())(2)) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::partial(binary_class())(1)(2) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::partial(binary_class())(1)(2) == 3);
+    BOOST_HOF_TEST_CHECK((1 <boost::hof::infix(binary_class())> 2) == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(binary_class())(boost::hof::pack(1, 2)) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(binary_class())(boost::hof::pack(1, 2)) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::fold(binary_class(), 0)(1, 2, 3) == 6);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::fold(binary_class(), 0)(1, 2, 3) == 6);
+    BOOST_HOF_TEST_CHECK(boost::hof::first_of(boost::hof::identity, binary_class())(1, 2) == 3);
+}
@@ -0,0 +1,75 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    describe.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/describe.hpp>
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/flow.hpp>
+#include <boost/hof/fold.hpp>
+#include <boost/hof/partial.hpp>
+#include <string>
+#include "test.hpp"
+
+namespace describe_test {
+
+struct increment
+{
+    int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+struct scale
+{
+    int n;
+    int operator()(int x) const
+    {
+        return x * n;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace describe_test;
+    typedef decltype(boost::hof::flow(increment(), scale{2})) f;
+    std::string s = boost::hof::describe<f>();
+    std::string expected = 
+        "flow_adaptor size=" + std::to_string(sizeof(f)) + "\n"
+        "  describe_test::increment size=1 empty\n"
+        "  describe_test::scale size=" + std::to_string(sizeof(scale)) + "\n";
+    BOOST_HOF_TEST_CHECK(s == expected);
+    BOOST_HOF_TEST_CHECK(boost::hof::describe<const f&>() == expected);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace describe_test;
+    typedef decltype(boost::hof::first_of(boost::hof::flow(increment(), increment()), boost::hof::fold(increment()))) f;
+    std::string s = boost::hof::describe<f>();
+    BOOST_HOF_TEST_CHECK(s.find("first_of_adaptor size=1 empty\n") == 0);
+    BOOST_HOF_TEST_CHECK(s.find("\n  flow_adaptor size=1 empty\n    describe_test::increment size=1 empty\n") != std::string::npos);
+    // The void state of the fold isn't described
+    BOOST_HOF_TEST_CHECK(s.find("\n  fold_adaptor size=1 empty\n    describe_test::increment size=1 empty\n") != std::string::npos);
+    BOOST_HOF_TEST_CHECK(s.find("void") == std::string::npos);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::describe<int>() == "int size=" + std::to_string(sizeof(int)) + "\n");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace describe_test;
+    auto f = boost::hof::flow(increment(), scale{2});
+    BOOST_HOF_ASSERT_CLOSURE_SIZE(f, sizeof(int));
+    BOOST_HOF_ASSERT_CLOSURE_SIZE((boost::hof::first_of(increment(), increment())), 1);
+    BOOST_HOF_ASSERT_TRIVIAL(f);
+    BOOST_HOF_ASSERT_TRIVIAL(boost::hof::first_of(increment(), scale{3}));
+    BOOST_HOF_TEST_CHECK(f(1) == 4);
+}
@@ -0,0 +1,88 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    device.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/compose.hpp>
+#include <boost/hof/lazy.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/proj.hpp>
+#include <boost/hof/unpack.hpp>
+
+#if defined(__HIPCC__)
+#include <hip/hip_runtime.h>
+#define DEVICE_TEST_API(name) hip ## name
+#else
+#include <cuda_runtime.h>
+#define DEVICE_TEST_API(name) cuda ## name
+#endif
+
+namespace device_test {
+
+struct increment
+{
+    BOOST_HOF_HOST_DEVICE int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+struct twice
+{
+    BOOST_HOF_HOST_DEVICE int operator()(int x) const
+    {
+        return x * 2;
+    }
+};
+
+struct sum
+{
+    BOOST_HOF_HOST_DEVICE int operator()(int x, int y) const
+    {
+        return x + y;
+    }
+};
+
+// The adaptors are built in the function, so it is the same pipeline on
+// each side
+struct pipeline
+{
+    BOOST_HOF_HOST_DEVICE int operator()(int x) const
+    {
+        auto f = boost::hof::compose(increment(), twice());
+        auto g = boost::hof::proj(twice(), sum());
+        auto h = boost::hof::lazy(sum())(x, 3);
+        return boost::hof::unpack(sum())(boost::hof::pack(f(x), g(x, 1))) + h();
+    }
+};
+
+template<class F>
+__global__ void run(F f, int* out, int n)
+{
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < n) out[i] = f(i);
+}
+
+// Runs the function on the device, and checks it with the host
+template<class F>
+bool check(F f)
+{
+    const int n = 64;
+    int* out = nullptr;
+    if (DEVICE_TEST_API(MallocManaged)(&out, n * sizeof(int)) != DEVICE_TEST_API(Success)) return false;
+    run<<<1, n>>>(f, out, n);
+    bool result = DEVICE_TEST_API(DeviceSynchronize)() == DEVICE_TEST_API(Success);
+    for (int i = 0; result && i < n; i++) result = out[i] == f(i);
+    DEVICE_TEST_API(Free)(out);
+    return result;
+}
+
+}
+
+int main()
+{
+    if (!device_test::check(device_test::pipeline())) return 1;
+    // An adaptor built on the host is passed to the kernel
+    if (!device_test::check(boost::hof::compose(device_test::increment(), device_test::twice()))) return 1;
+}
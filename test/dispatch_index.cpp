@@ -0,0 +1,188 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    dispatch_index.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/dispatch_index.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <memory>
+#include "test.hpp"
+
+namespace dispatch_index_test {
+
+template<int N>
+struct constant
+{
+    int operator()() const
+    {
+        return N;
+    }
+};
+
+struct add
+{
+    int operator()(int x, int y) const
+    {
+        return x + y;
+    }
+};
+
+struct subtract
+{
+    int operator()(int x, int y) const
+    {
+        return x - y;
+    }
+};
+
+struct to_long
+{
+    long operator()(int x, int y) const
+    {
+        return long(x) * y;
+    }
+};
+
+struct set_value
+{
+    void operator()(int& x, int y) const
+    {
+        x = y;
+    }
+};
+
+struct clear_value
+{
+    void operator()(int& x, int) const
+    {
+        x = 0;
+    }
+};
+
+struct first_ref
+{
+    int& operator()(int& x, int&) const
+    {
+        return x;
+    }
+};
+
+struct second_ref
+{
+    int& operator()(int&, int& y) const
+    {
+        return y;
+    }
+};
+
+struct take_ptr
+{
+    int operator()(std::unique_ptr<int> p) const
+    {
+        return *p;
+    }
+};
+
+struct negate_ptr
+{
+    int operator()(std::unique_ptr<int> p) const
+    {
+        return -*p;
+    }
+};
+
+struct offset
+{
+    int n;
+
+    int operator()(int x) const
+    {
+        return x + n;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::dispatch_index(dispatch_index_test::add(), dispatch_index_test::subtract());
+    BOOST_HOF_TEST_CHECK(f(0, 3, 2) == 5);
+    BOOST_HOF_TEST_CHECK(f(1, 3, 2) == 1);
+    STATIC_ASSERT_SAME(decltype(f(0, 3, 2)), int);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::dispatch_index(
+        dispatch_index_test::constant<0>(),
+        dispatch_index_test::constant<1>(),
+        dispatch_index_test::constant<2>(),
+        dispatch_index_test::constant<3>(),
+        dispatch_index_test::constant<4>(),
+        dispatch_index_test::constant<5>(),
+        dispatch_index_test::constant<6>(),
+        dispatch_index_test::constant<7>()
+    );
+    for(int i = 0; i < 8; i++) BOOST_HOF_TEST_CHECK(f(i) == i);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::dispatch_index(dispatch_index_test::add(), dispatch_index_test::to_long());
+    STATIC_ASSERT_SAME(decltype(f(0, 3, 2)), long);
+    BOOST_HOF_TEST_CHECK(f(0, 3, 2) == 5);
+    BOOST_HOF_TEST_CHECK(f(1, 3, 2) == 6);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::dispatch_index(dispatch_index_test::set_value(), dispatch_index_test::clear_value());
+    int x = 0;
+    f(0, x, 3);
+    BOOST_HOF_TEST_CHECK(x == 3);
+    f(1, x, 3);
+    BOOST_HOF_TEST_CHECK(x == 0);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::dispatch_index(dispatch_index_test::first_ref(), dispatch_index_test::second_ref());
+    int x = 1;
+    int y = 2;
+    STATIC_ASSERT_SAME(decltype(f(0, x, y)), int&);
+    BOOST_HOF_TEST_CHECK(&f(0, x, y) == &x);
+    BOOST_HOF_TEST_CHECK(&f(1, x, y) == &y);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::dispatch_index(dispatch_index_test::take_ptr(), dispatch_index_test::negate_ptr());
+    BOOST_HOF_TEST_CHECK(f(0, std::unique_ptr<int>(new int(3))) == 3);
+    BOOST_HOF_TEST_CHECK(f(1, std::unique_ptr<int>(new int(3))) == -3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // Functions of the same type are stored separately
+    auto f = boost::hof::dispatch_index(dispatch_index_test::offset{1}, dispatch_index_test::offset{2}, dispatch_index_test::offset{3});
+    BOOST_HOF_TEST_CHECK(f(0, 1) == 2);
+    BOOST_HOF_TEST_CHECK(f(1, 1) == 3);
+    BOOST_HOF_TEST_CHECK(f(2, 1) == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::dispatch_index(boost::hof::_ + boost::hof::_, boost::hof::_ * boost::hof::_);
+    BOOST_HOF_TEST_CHECK(f(0, 3, 4) == 7);
+    BOOST_HOF_TEST_CHECK(f(1, 3, 4) == 12);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::dispatch_index_adaptor<dispatch_index_test::add, dispatch_index_test::subtract> f;
+    BOOST_HOF_TEST_CHECK(f(1, 3, 2) == 1);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::is_invocable<decltype(f), std::size_t, int, int>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!boost::hof::is_invocable<decltype(f), std::size_t, int>::value);
+}
@@ -0,0 +1,61 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    drop.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/drop.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <memory>
+#include "test.hpp"
+
+namespace drop_test {
+
+struct digits
+{
+    template<class... Ts>
+    constexpr int operator()(Ts... xs) const
+    {
+        return fold(0, xs...);
+    }
+
+    static constexpr int fold(int x)
+    {
+        return x;
+    }
+
+    template<class... Ts>
+    static constexpr int fold(int x, int y, Ts... ys)
+    {
+        return fold(x*10 + y, ys...);
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(13 == boost::hof::drop<1>(drop_test::digits())(1, 2, 3));
+    BOOST_HOF_STATIC_TEST_CHECK(13 == boost::hof::drop<1>(drop_test::digits())(1, 2, 3));
+    BOOST_HOF_TEST_CHECK(24 == boost::hof::drop<2, 0>(drop_test::digits())(1, 2, 3, 4));
+    BOOST_HOF_STATIC_TEST_CHECK(24 == boost::hof::drop<2, 0>(drop_test::digits())(1, 2, 3, 4));
+    BOOST_HOF_TEST_CHECK(0 == boost::hof::drop<0, 1, 2>(drop_test::digits())(1, 2, 3));
+    BOOST_HOF_TEST_CHECK(123 == boost::hof::drop<>(drop_test::digits())(1, 2, 3));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int x = 1;
+    STATIC_ASSERT_SAME(decltype(boost::hof::drop<0>(boost::hof::arg(std::integral_constant<int, 1>()))(1, x)), int&);
+    STATIC_ASSERT_SAME(decltype(boost::hof::drop<0>(boost::hof::arg(std::integral_constant<int, 1>()))(x, 1)), int&&);
+
+    std::unique_ptr<int> p(new int(3));
+    auto f = boost::hof::drop<0>([](std::unique_ptr<int> q) { return *q; });
+    BOOST_HOF_TEST_CHECK(3 == f(1, std::move(p)));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(!boost::hof::is_invocable<decltype(boost::hof::drop<2>(drop_test::digits())), int, int>::value, "Index out of range");
+    static_assert(boost::hof::is_invocable<decltype(boost::hof::drop<2>(drop_test::digits())), int, int, int>::value, "Invocable");
+}
@@ -0,0 +1,151 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    empty_size.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof.hpp>
+#include "test.hpp"
+
+// The adaptors of empty functions should also be empty, whether the
+// functions are inherited or stored with no_unique_address
+
+namespace empty_size_test {
+
+struct unary_f
+{
+    template<class T>
+    constexpr int operator()(T) const
+    {
+        return 1;
+    }
+};
+
+struct binary_f
+{
+    template<class T>
+    constexpr int operator()(T, T) const
+    {
+        return 2;
+    }
+};
+
+struct final_f final
+{
+    template<class T>
+    constexpr int operator()(T*) const
+    {
+        return 3;
+    }
+};
+
+struct id_f
+{
+    template<class T>
+    constexpr T operator()(T x) const
+    {
+        return x;
+    }
+};
+
+// Neither of these can be stored statically
+struct explicit_f final
+{
+    constexpr explicit_f(int)
+    {}
+
+    template<class T>
+    constexpr int operator()(T) const
+    {
+        return 4;
+    }
+};
+
+struct non_literal_f
+{
+    non_literal_f(int)
+    {}
+
+    ~non_literal_f()
+    {}
+
+    template<class T>
+    int operator()(T) const
+    {
+        return 5;
+    }
+};
+
+}
+
+#define CHECK_EMPTY_SIZE(...) static_assert(sizeof(decltype(__VA_ARGS__)) == 1, "Not empty: " #__VA_ARGS__)
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace empty_size_test;
+    namespace hof = boost::hof;
+
+    CHECK_EMPTY_SIZE(hof::compose(unary_f(), id_f()));
+    CHECK_EMPTY_SIZE(hof::compose(unary_f(), id_f(), final_f()));
+    CHECK_EMPTY_SIZE(hof::compose(unary_f(), unary_f()));
+    CHECK_EMPTY_SIZE(hof::flow(id_f(), unary_f(), final_f()));
+    CHECK_EMPTY_SIZE(hof::first_of(final_f(), unary_f(), binary_f()));
+    CHECK_EMPTY_SIZE(hof::first_of(final_f(), final_f()));
+    CHECK_EMPTY_SIZE(hof::match(unary_f(), binary_f()));
+    CHECK_EMPTY_SIZE(hof::proj(id_f(), unary_f()));
+    CHECK_EMPTY_SIZE(hof::proj(id_f(), final_f()));
+    CHECK_EMPTY_SIZE(hof::combine(binary_f(), id_f(), id_f()));
+    CHECK_EMPTY_SIZE(hof::capture_basic()(unary_f()));
+    CHECK_EMPTY_SIZE(hof::pack(unary_f(), final_f()));
+    CHECK_EMPTY_SIZE(hof::pack(unary_f(), unary_f()));
+    CHECK_EMPTY_SIZE(hof::pack(non_literal_f(1), unary_f(), binary_f()));
+    CHECK_EMPTY_SIZE(hof::decorate(unary_f())(id_f()));
+    CHECK_EMPTY_SIZE(hof::tap(unary_f())(id_f()));
+    CHECK_EMPTY_SIZE(hof::repeat_while(id_f())(id_f()));
+    CHECK_EMPTY_SIZE(hof::repeat(std::integral_constant<int, 2>())(id_f()));
+    CHECK_EMPTY_SIZE(hof::if_(std::true_type())(unary_f()));
+    CHECK_EMPTY_SIZE(hof::lazy(unary_f())(hof::_1));
+
+    CHECK_EMPTY_SIZE(hof::partial(binary_f()));
+    CHECK_EMPTY_SIZE(hof::pipable(binary_f()));
+    CHECK_EMPTY_SIZE(hof::infix(binary_f()));
+    CHECK_EMPTY_SIZE(hof::fix(unary_f()));
+    CHECK_EMPTY_SIZE(hof::result<int>(unary_f()));
+    CHECK_EMPTY_SIZE(hof::typed<int(int)>(unary_f()));
+    CHECK_EMPTY_SIZE(hof::unpack(final_f()));
+    CHECK_EMPTY_SIZE(hof::flip(binary_f()));
+    CHECK_EMPTY_SIZE(hof::rotate(binary_f()));
+    CHECK_EMPTY_SIZE(hof::reveal(unary_f()));
+    CHECK_EMPTY_SIZE(hof::protect(unary_f()));
+    CHECK_EMPTY_SIZE(hof::fold(binary_f()));
+    CHECK_EMPTY_SIZE(hof::reverse_fold(binary_f()));
+    CHECK_EMPTY_SIZE(hof::limit_c<2>(binary_f()));
+
+    // The same function nested in several members must not be a base more
+    // than once
+    CHECK_EMPTY_SIZE(hof::flow(hof::first_of(id_f(), unary_f()), hof::proj(id_f())));
+    CHECK_EMPTY_SIZE(hof::compose(hof::proj(id_f()), hof::flow(id_f()), id_f()));
+    CHECK_EMPTY_SIZE(hof::first_of(hof::proj(unary_f()), hof::compose(unary_f(), id_f())));
+    CHECK_EMPTY_SIZE(hof::pack(hof::proj(id_f()), hof::compose(id_f(), id_f())));
+    CHECK_EMPTY_SIZE(hof::lazy(hof::proj(id_f()))(hof::lazy(id_f())(hof::_1)));
+    CHECK_EMPTY_SIZE(hof::pipable(hof::flow(hof::proj(id_f()), hof::compose(id_f(), unary_f()))));
+    CHECK_EMPTY_SIZE(hof::compose(hof::compose(hof::proj(id_f()), id_f()), hof::compose(hof::proj(id_f()), id_f())));
+
+    CHECK_EMPTY_SIZE(hof::compose(explicit_f(1), unary_f()));
+    CHECK_EMPTY_SIZE(hof::compose(non_literal_f(1), unary_f()));
+    CHECK_EMPTY_SIZE(hof::first_of(explicit_f(1), non_literal_f(1)));
+    CHECK_EMPTY_SIZE(hof::proj(explicit_f(1), non_literal_f(1)));
+    CHECK_EMPTY_SIZE(hof::capture(explicit_f(1))(non_literal_f(1)));
+}
+
+#if BOOST_HOF_HAS_NO_UNIQUE_ADDRESS
+BOOST_HOF_TEST_CASE()
+{
+    using namespace empty_size_test;
+    namespace hof = boost::hof;
+
+    // These are only empty when the functions are stored as members
+    CHECK_EMPTY_SIZE(hof::compose(final_f(), final_f()));
+    CHECK_EMPTY_SIZE(hof::pack(explicit_f(1), non_literal_f(1)));
+}
+#endif
@@ -0,0 +1,95 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    erase_at.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/erase_at.hpp>
+#include <boost/hof/flow.hpp>
+#include <boost/hof/function_ref.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <memory>
+#include <string>
+#include "test.hpp"
+
+namespace erase_at_test {
+
+// Fails to compile if it is instantiated with anything but long
+struct only_long
+{
+    template<class T>
+    T operator()(T x) const
+    {
+        static_assert(std::is_same<T, long>::value, "Instantiated with another type");
+        return x * 2;
+    }
+};
+
+struct length
+{
+    template<class T>
+    std::size_t operator()(const T& x) const
+    {
+        return x.size();
+    }
+};
+
+struct take_f
+{
+    int operator()(std::unique_ptr<int> p) const
+    {
+        return *p;
+    }
+};
+
+struct store_f
+{
+    int* out;
+    void operator()(int x) const
+    {
+        *out = x;
+    }
+};
+
+int apply(boost::hof::function_ref<long(long)> f, long x)
+{
+    return int(f(x));
+}
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace erase_at_test;
+    auto f = boost::hof::erase_at<long(long)>(only_long());
+    STATIC_ASSERT_SAME(decltype(f)::result_type, long);
+    STATIC_ASSERT_SAME(decltype(f(1)), long);
+    BOOST_HOF_TEST_CHECK(f(1) == 2);
+    BOOST_HOF_TEST_CHECK(f(short(2)) == 4);
+    BOOST_HOF_TEST_CHECK(f('\3') == 6);
+    BOOST_HOF_TEST_CHECK(apply(f, 5) == 10);
+
+    auto g = boost::hof::erase_at<long(long)>(boost::hof::flow(only_long(), only_long()));
+    BOOST_HOF_TEST_CHECK(g(3) == 12);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace erase_at_test;
+    auto f = boost::hof::erase_at<std::size_t(const std::string&)>(length());
+    BOOST_HOF_TEST_CHECK(f("abc") == 3);
+    BOOST_HOF_TEST_CHECK(f(std::string("ab")) == 2);
+    static_assert(!boost::hof::is_invocable<decltype(f), int>::value, "Invocable");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace erase_at_test;
+    BOOST_HOF_TEST_CHECK(boost::hof::erase_at<int(std::unique_ptr<int>)>(take_f())(std::unique_ptr<int>(new int(3))) == 3);
+
+    int x = 0;
+    auto store = boost::hof::erase_at<void(int)>(store_f{&x});
+    STATIC_ASSERT_SAME(decltype(store(1)), void);
+    store(2.0);
+    BOOST_HOF_TEST_CHECK(x == 2);
+}
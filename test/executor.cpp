@@ -0,0 +1,56 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    executor.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/executor.hpp>
+#include "test.hpp"
+
+#include <thread>
+
+struct thread_id_f
+{
+    std::thread::id operator()() const
+    {
+        return std::this_thread::get_id();
+    }
+};
+
+struct ref_f
+{
+    int* x;
+    int& operator()() const
+    {
+        return *x;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    auto h = boost::hof::thread_executor().submit(thread_id_f());
+    BOOST_HOF_TEST_CHECK(h.get() != std::this_thread::get_id());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto h = boost::hof::inline_executor().submit(thread_id_f());
+    BOOST_HOF_TEST_CHECK(h.get() == std::this_thread::get_id());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int i = 1;
+    auto h1 = boost::hof::thread_executor().submit(ref_f{&i});
+    BOOST_HOF_TEST_CHECK(&h1.get() == &i);
+    auto h2 = boost::hof::inline_executor().submit(ref_f{&i});
+    BOOST_HOF_TEST_CHECK(&h2.get() == &i);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto p = boost::hof::parallel_on(boost::hof::inline_executor(), 4);
+    BOOST_HOF_TEST_CHECK(p.threshold == 4);
+    auto d = boost::hof::parallel_on(boost::hof::thread_executor());
+    BOOST_HOF_TEST_CHECK(d.threshold == 2);
+}
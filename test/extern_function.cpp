@@ -0,0 +1,47 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    extern_function.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/extern_function.hpp>
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/flow.hpp>
+#include <memory>
+#include <string>
+#include "test.hpp"
+
+namespace extern_function_test {
+
+BOOST_HOF_DECLARE_EXTERN_FUNCTION(scale, long(long));
+BOOST_HOF_DECLARE_EXTERN_FUNCTION(describe, std::string(const std::string&, int));
+BOOST_HOF_DECLARE_EXTERN_FUNCTION(release, int(std::unique_ptr<int>));
+
+BOOST_HOF_DEFINE_EXTERN_FUNCTION(scale, boost::hof::flow(
+    [](long x) { return x * 2; },
+    [](long x) { return x + 1; }
+));
+
+BOOST_HOF_DEFINE_EXTERN_FUNCTION(describe, boost::hof::first_of(
+    [](const std::string& s, int n) { return s + std::string(std::size_t(n), '!'); }
+));
+
+BOOST_HOF_DEFINE_EXTERN_FUNCTION(release, [](std::unique_ptr<int> p) { return *p; });
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace extern_function_test;
+    BOOST_HOF_TEST_CHECK(scale(5L) == 11);
+    BOOST_HOF_TEST_CHECK(scale(5) == 11);
+    STATIC_ASSERT_SAME(decltype(scale(5L)), long);
+    BOOST_HOF_TEST_CHECK(describe("hi", 2) == "hi!!");
+}
+
+// The arguments are forwarded to the definition
+BOOST_HOF_TEST_CASE()
+{
+    using namespace extern_function_test;
+    BOOST_HOF_TEST_CHECK(release(std::unique_ptr<int>(new int(3))) == 3);
+}
@@ -0,0 +1,16 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    describe_size.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/describe.hpp>
+#include <boost/hof/capture.hpp>
+
+int main() {
+    long a = 1;
+    long b = 2;
+    auto f = boost::hof::capture(a, b)([](long x, long y) { return x + y; });
+    BOOST_HOF_ASSERT_CLOSURE_SIZE(f, sizeof(long));
+    (void)f;
+}
@@ -0,0 +1,15 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    describe_trivial.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/describe.hpp>
+#include <boost/hof/capture.hpp>
+#include <string>
+
+int main() {
+    auto f = boost::hof::capture(std::string("x"))([](const std::string& s) { return s.size(); });
+    BOOST_HOF_ASSERT_TRIVIAL(f);
+    (void)f;
+}
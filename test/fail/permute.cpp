@@ -0,0 +1,13 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    permute.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/permute.hpp>
+#include <boost/hof/placeholders.hpp>
+
+int main() {
+    auto f = boost::hof::permute<0, 0>(boost::hof::_ - boost::hof::_);
+    (void)f;
+}
@@ -0,0 +1,27 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    static_dynamic_init.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#define BOOST_HOF_REQUIRE_CONSTANT_INIT 1
+#include <boost/hof/static.hpp>
+
+struct times_function
+{
+    double factor;
+    times_function() : factor(2)
+    {}
+    template<class T>
+    T operator()(T x) const
+    {
+        return x*factor;
+    }
+};
+
+static constexpr boost::hof::static_<times_function> times2 = {};
+
+int main()
+{
+    times2(3);
+}
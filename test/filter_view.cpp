@@ -0,0 +1,39 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    filter_view.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/filter.hpp>
+#include <boost/hof/fold_into.hpp>
+#include <boost/hof/map.hpp>
+#include <boost/hof/placeholders.hpp>
+#include "test.hpp"
+
+#include <vector>
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> v = { 1, 2, 3, 4 };
+    BOOST_HOF_TEST_CHECK((v | boost::hof::filter(boost::hof::_ > 2) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0)) == 7);
+    BOOST_HOF_TEST_CHECK(boost::hof::fold_into(boost::hof::filter(v, boost::hof::_ > 2), boost::hof::_ + boost::hof::_, 0) == 7);
+    BOOST_HOF_TEST_CHECK((v | boost::hof::filter(boost::hof::_ > 5) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0)) == 0);
+    BOOST_HOF_TEST_CHECK((v | boost::hof::filter(boost::hof::_ > 1) | boost::hof::filter(boost::hof::_ < 4) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0)) == 5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> v = { 1, 2, 3, 4 };
+    BOOST_HOF_TEST_CHECK((v | boost::hof::map(boost::hof::_1 * boost::hof::_1) | boost::hof::filter(boost::hof::_ > 1) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0)) == 29);
+    BOOST_HOF_TEST_CHECK((v | boost::hof::filter(boost::hof::_ > 1) | boost::hof::map(boost::hof::_1 * boost::hof::_1) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0)) == 29);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The predicate is called once for each element
+    std::vector<int> v = { 1, 2, 3, 4 };
+    int calls = 0;
+    auto r = v | boost::hof::filter([&](int x) { calls++; return x % 2 == 0; }) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0);
+    BOOST_HOF_TEST_CHECK(r == 6);
+    BOOST_HOF_TEST_CHECK(calls == 4);
+}
@@ -214,3 +214,37 @@ BOOST_HOF_TEST_CASE()
 }
 #endif
 }
+
+namespace conditional_test {
+
+BOOST_HOF_TEST_CASE()
+{
+    typedef boost::hof::first_of_adaptor<ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, f1, f2, f3> fun;
+    STATIC_ASSERT_EMPTY(fun());
+    BOOST_HOF_TEST_CHECK(fun()(t1()) == 1);
+    BOOST_HOF_TEST_CHECK(fun()(t2()) == 500);
+    BOOST_HOF_TEST_CHECK(fun()(t3()) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(fun()(t1()) == 1);
+    BOOST_HOF_STATIC_TEST_CHECK(fun()(t2()) == 500);
+    BOOST_HOF_STATIC_TEST_CHECK(fun()(t3()) == 3);
+    static_assert(!boost::hof::is_invocable<fun, int>::value, "Invocable");
+}
+
+#if BOOST_HOF_HAS_STD_14
+struct deduced_fallback
+{
+    template<class T>
+    auto operator()(T x) const
+    {
+        return x.value();
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::first_of(f1{}, deduced_fallback{})(t1()) == 1);
+    BOOST_HOF_TEST_CHECK(boost::hof::first_of(f1{}, f2{}, deduced_fallback{}, f3{})(t2()) == 2);
+}
+#endif
+
+}
@@ -98,3 +98,22 @@ BOOST_HOF_TEST_CASE()
     BOOST_HOF_TEST_CHECK(r == 5*4*3*2*1);
     BOOST_HOF_TEST_CHECK(boost::hof::fix(factorial_move_t())(5) == 5*4*3*2*1);
 }
+
+#if !BOOST_HOF_NO_EXPRESSION_SFINAE
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::fix_depth<0>(boost::hof::result<int>(factorial_constexpr_t()))(5) == 5*4*3*2*1);
+    BOOST_HOF_TEST_CHECK(boost::hof::fix_depth<2>(boost::hof::result<int>(factorial_constexpr_t()))(5) == 5*4*3*2*1);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::fix_depth<0>(boost::hof::result<int>(factorial_constexpr_t()))(5) == 5*4*3*2*1);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::fix_depth<2>(boost::hof::result<int>(factorial_constexpr_t()))(5) == 5*4*3*2*1);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::result<int>(boost::hof::fix_depth<0>(factorial_constexpr_t()))(5) == 5*4*3*2*1);
+}
+#endif
+
+BOOST_HOF_TEST_CASE()
+{
+    static constexpr boost::hof::fix_adaptor<factorial_t, 0> factorial0 = {};
+    BOOST_HOF_TEST_CHECK(factorial0(5) == 5*4*3*2*1);
+    BOOST_HOF_TEST_CHECK(boost::hof::fix_depth<0>(factorial_move_t())(5) == 5*4*3*2*1);
+    BOOST_HOF_TEST_CHECK(boost::hof::fix_depth<1>(factorial_t())(5) == 5*4*3*2*1);
+}
@@ -0,0 +1,148 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    fix_trampoline.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/fix_trampoline.hpp>
+#include "test.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace fix_trampoline_test {
+
+struct factorial_t
+{
+    template<class Self>
+    boost::hof::trampoline<long long, int, long long> operator()(Self self, int x, long long acc) const
+    {
+        if (x == 0) return acc;
+        return self(x - 1, acc * x);
+    }
+};
+
+struct sum_t
+{
+    template<class Self>
+    auto operator()(Self self, long long n, long long acc) const -> decltype(self(n, acc))
+    {
+        return n == 0 ? acc : self(n - 1, acc + n);
+    }
+};
+
+struct count_t
+{
+    template<class Self>
+    auto operator()(Self self, std::unique_ptr<int> p, int n) const -> decltype(self(std::move(p), n))
+    {
+        if (n == 0) return *p;
+        ++*p;
+        return self(std::move(p), n - 1);
+    }
+};
+
+struct tree
+{
+    int value;
+    std::vector<tree> children;
+};
+
+// Walks the tree with a stack of the subtrees that are left to visit
+struct tree_sum_t
+{
+    template<class Self>
+    auto operator()(Self self, std::vector<const tree*> todo, int acc) const -> decltype(self(std::move(todo), acc))
+    {
+        if (todo.empty()) return acc;
+        const tree* t = todo.back();
+        todo.pop_back();
+        for(const tree& c:t->children) todo.push_back(&c);
+        return self(std::move(todo), acc + t->value);
+    }
+};
+
+struct to_string_t
+{
+    std::string prefix;
+    template<class Self>
+    auto operator()(Self self, int n, std::string s) const -> decltype(self(n, s))
+    {
+        return n == 0 ? prefix + s : self(n - 1, s + "x");
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto factorial = boost::hof::fix_trampoline<long long(int, long long)>(fix_trampoline_test::factorial_t());
+    BOOST_HOF_TEST_CHECK(factorial(5, 1) == 5*4*3*2*1);
+    BOOST_HOF_TEST_CHECK(factorial(0, 1) == 1);
+    BOOST_HOF_TEST_CHECK(factorial(20, 1) == 2432902008176640000LL);
+    static_assert(std::is_same<decltype(factorial(5, 1)), long long>::value, "Wrong result type");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto sum = boost::hof::fix_trampoline<long long(long long, long long)>(fix_trampoline_test::sum_t());
+    BOOST_HOF_TEST_CHECK(sum(10, 0) == 55);
+    // Deep enough to overflow the stack with native recursion
+    BOOST_HOF_TEST_CHECK(sum(10000000, 0) == 50000005000000LL);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto count = boost::hof::fix_trampoline<int(std::unique_ptr<int>, int)>(fix_trampoline_test::count_t());
+    BOOST_HOF_TEST_CHECK(count(std::unique_ptr<int>(new int(0)), 100000) == 100000);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    fix_trampoline_test::tree t{1, {}};
+    // A deep chain of subtrees
+    fix_trampoline_test::tree* last = &t;
+    for(int i = 0; i < 10000; i++)
+    {
+        last->children.push_back(fix_trampoline_test::tree{1, {}});
+        last->children.push_back(fix_trampoline_test::tree{2, {}});
+        last = &last->children.front();
+    }
+    auto tree_sum = boost::hof::fix_trampoline<int(std::vector<const fix_trampoline_test::tree*>, int)>(fix_trampoline_test::tree_sum_t());
+    std::vector<const fix_trampoline_test::tree*> todo{&t};
+    BOOST_HOF_TEST_CHECK(tree_sum(todo, 0) == 30001);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::fix_trampoline<std::string(int, const std::string&)>(fix_trampoline_test::to_string_t{"s:"});
+    BOOST_HOF_TEST_CHECK(f(3, std::string()) == "s:xxx");
+    const std::string empty;
+    BOOST_HOF_TEST_CHECK(f(0, empty) == "s:");
+}
+
+#if BOOST_HOF_HAS_GENERIC_LAMBDA
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::fix_trampoline<int(int, int)>([](auto self, int n, int steps) {
+        return n <= 1 ? steps : self(n % 2 == 0 ? n / 2 : 3 * n + 1, steps + 1);
+    });
+    BOOST_HOF_TEST_CHECK(f(27, 0) == 111);
+}
+#endif
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::trampoline<std::string, int> x = std::string("done");
+    BOOST_HOF_TEST_CHECK(x.is_done());
+    boost::hof::trampoline<std::string, int> y = x;
+    BOOST_HOF_TEST_CHECK(y.is_done());
+    BOOST_HOF_TEST_CHECK(y.get() == "done");
+    boost::hof::trampoline<std::string, int> z(boost::hof::detail::trampoline_call_tag(), 1);
+    BOOST_HOF_TEST_CHECK(!z.is_done());
+    BOOST_HOF_TEST_CHECK(std::get<0>(z.arguments()) == 1);
+    z = y;
+    BOOST_HOF_TEST_CHECK(z.is_done());
+    BOOST_HOF_TEST_CHECK(z.get() == "done");
+}
@@ -0,0 +1,78 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    fixed_string.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/fixed_string.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/is_unpackable.hpp>
+#include "test.hpp"
+
+#include <cstring>
+
+namespace fixed_string_test {
+
+struct hash
+{
+    constexpr unsigned operator()() const
+    {
+        return 0;
+    }
+
+    template<class... Ts>
+    constexpr unsigned operator()(char c, Ts... cs) const
+    {
+        return static_cast<unsigned char>(c) + 31u * hash()(cs...);
+    }
+};
+
+struct count_f
+{
+    template<class... Ts>
+    constexpr int operator()(Ts&&...) const
+    {
+        return sizeof...(Ts);
+    }
+};
+
+#if BOOST_HOF_HAS_STD_20
+template<boost::hof::fixed_string S>
+struct route
+{
+    static constexpr int value = boost::hof::unpack(count_f())(S);
+};
+#endif
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(boost::hof::is_unpackable<boost::hof::fixed_string<3>>::value, "Not unpackable");
+    STATIC_ASSERT_SAME(decltype(boost::hof::make_fixed_string("abc")), boost::hof::fixed_string<3>);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::make_fixed_string("abc").size() == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::make_fixed_string("abc")[1] == 'b');
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::make_fixed_string("abc").c_str()[3] == '\0');
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(fixed_string_test::count_f())(boost::hof::make_fixed_string("abc")) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(fixed_string_test::count_f())(boost::hof::make_fixed_string("")) == 0);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(fixed_string_test::hash())(boost::hof::make_fixed_string("ab")) == fixed_string_test::hash()('a', 'b'));
+    auto s = boost::hof::make_fixed_string("abc");
+    BOOST_HOF_TEST_CHECK(std::strcmp(s.c_str(), "abc") == 0);
+    BOOST_HOF_TEST_CHECK(s.end() - s.begin() == 3);
+}
+
+#if BOOST_HOF_HAS_STD_17
+BOOST_HOF_TEST_CASE()
+{
+    constexpr boost::hof::fixed_string s = "get";
+    STATIC_ASSERT_SAME(decltype(s), const boost::hof::fixed_string<3>);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(fixed_string_test::count_f())(s) == 3);
+}
+#endif
+
+#if BOOST_HOF_HAS_STD_20
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(fixed_string_test::route<"users">::value == 5, "Template parameter");
+}
+#endif
@@ -0,0 +1,72 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    fixed_view.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/fixed_view.hpp>
+#include <boost/hof/unpack.hpp>
+#include "test.hpp"
+
+#include <initializer_list>
+
+namespace fixed_view_test {
+
+struct frame_header
+{
+    int operator()(unsigned char tag, unsigned char hi, unsigned char lo) const
+    {
+        return tag * 0x10000 + hi * 0x100 + lo;
+    }
+};
+
+struct first_address_f
+{
+    template<class T, class... Ts>
+    constexpr T* operator()(T& x, Ts&...) const
+    {
+        return &x;
+    }
+};
+
+struct increment_all
+{
+    template<class... Ts>
+    void operator()(Ts&... xs) const
+    {
+        (void)std::initializer_list<int>{(++xs, 0)...};
+    }
+};
+
+static constexpr int constant_array[] = { 1, 2, 3, 4 };
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    unsigned char frame[] = { 0xff, 1, 2, 3, 0xff };
+    auto header = boost::hof::make_fixed_view<3>(frame + 1);
+    BOOST_HOF_TEST_CHECK(header.size() == 3);
+    BOOST_HOF_TEST_CHECK(header.data() == frame + 1);
+    BOOST_HOF_TEST_CHECK(header[2] == 3);
+    BOOST_HOF_TEST_CHECK(header.end() - header.begin() == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(fixed_view_test::frame_header())(header) == 0x10203);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(fixed_view_test::first_address_f())(header) == frame + 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int a[] = { 1, 2, 3 };
+    boost::hof::unpack(fixed_view_test::increment_all())(boost::hof::make_fixed_view<2>(a));
+    BOOST_HOF_TEST_CHECK(a[0] == 2);
+    BOOST_HOF_TEST_CHECK(a[1] == 3);
+    BOOST_HOF_TEST_CHECK(a[2] == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(binary_class())(boost::hof::make_fixed_view<1>(a), boost::hof::make_fixed_view<1>(a + 2)) == 5);
+    BOOST_HOF_TEST_CHECK(boost::hof::is_unpackable<boost::hof::fixed_view<int, 2>>::value);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(binary_class())(boost::hof::make_fixed_view<2>(fixed_view_test::constant_array + 1)) == 5);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::make_fixed_view<2>(fixed_view_test::constant_array)[1] == 2);
+}
@@ -5,10 +5,12 @@
     file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 ==============================================================================*/
 #include <boost/hof/flow.hpp>
+#include <boost/hof/compose.hpp>
 #include <boost/hof/function.hpp>
 #include <boost/hof/lambda.hpp>
 #include <boost/hof/placeholders.hpp>
 #include <memory>
+#include <string>
 #include "test.hpp"
 
 namespace flow_test {
@@ -166,4 +168,80 @@ BOOST_HOF_TEST_CASE()
     BOOST_HOF_TEST_CHECK(boost::hof::flow(boost::hof::_1 + boost::hof::_1, boost::hof::_1 * boost::hof::_1)(3) == 36);
     BOOST_HOF_STATIC_TEST_CHECK(boost::hof::flow(boost::hof::_1 + boost::hof::_1, boost::hof::_1 * boost::hof::_1)(3) == 36);
 }
+#if BOOST_HOF_CALLABLE_BASE_USE_TEMPLATE_ALIAS
+BOOST_HOF_TEST_CASE()
+{
+    // An adaptor that is the last function is spliced into the result
+    typedef boost::hof::flow_adaptor<increment, negate, decrement> flat;
+    STATIC_ASSERT_SAME(decltype(boost::hof::flow(increment(), boost::hof::flow(negate(), decrement()))), flat);
+    STATIC_ASSERT_SAME(decltype(boost::hof::flow(increment(), negate(), boost::hof::flow(decrement()))), flat);
+    STATIC_ASSERT_SAME(decltype(boost::hof::flow(boost::hof::flow(increment(), negate(), decrement()))), flat);
+    // Anywhere else it is kept as one function
+    STATIC_ASSERT_SAME(decltype(boost::hof::flow(boost::hof::flow(increment(), negate()), decrement())),
+        boost::hof::flow_adaptor<boost::hof::flow_adaptor<increment, negate>, decrement>);
+    STATIC_ASSERT_SAME(decltype(boost::hof::flow(increment(), boost::hof::compose(negate(), decrement()))),
+        boost::hof::flow_adaptor<increment, boost::hof::compose_adaptor<negate, decrement>>);
+}
+#endif
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::flow(increment(), boost::hof::flow(negate(), decrement()))(3) == -5);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::flow(increment(), boost::hof::flow(negate(), decrement()))(3) == -5);
+    BOOST_HOF_TEST_CHECK(boost::hof::flow(boost::hof::flow(increment(), negate()), decrement())(3) == -5);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::flow(boost::hof::flow(increment(), negate()), decrement())(3) == -5);
+
+    auto f = boost::hof::flow(boost::hof::flow(increment_movable(), negate()), boost::hof::flow(decrement_movable(), increment()));
+    BOOST_HOF_TEST_CHECK(f(3) == boost::hof::flow(increment(), negate(), decrement(), increment())(3));
+    auto g = boost::hof::flow(boost::hof::flow(increment_movable(), negate()), increment());
+    auto h = boost::hof::flow(std::move(g), decrement_movable());
+    BOOST_HOF_TEST_CHECK(h(3) == boost::hof::flow(increment(), negate(), increment(), decrement())(3));
+}
+struct widen
+{
+    constexpr long operator()(int x) const noexcept
+    {
+        return x * 2L;
+    }
+};
+
+struct append
+{
+    std::string s;
+    std::string operator()(std::string x) const
+    {
+        return x + s;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    // Each function returns the type it is passed, so the values are
+    // assigned in place
+    auto f = boost::hof::flow(increment(), increment(), increment(), increment(), increment(), increment(), increment(), increment());
+    BOOST_HOF_TEST_CHECK(f(1) == 9);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::flow(increment(), increment(), increment(), increment(), increment(), increment())(1) == 7);
+    STATIC_ASSERT_SAME(decltype(f(1)), int);
+    STATIC_ASSERT_SAME(decltype(f(1L)), long);
+
+    auto g = boost::hof::flow(append{"b"}, append{"c"}, append{"d"});
+    BOOST_HOF_TEST_CHECK(g(std::string("a")) == "abcd");
+    BOOST_HOF_TEST_CHECK(g("a") == "abcd");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The type changes after the first function, so the calls are nested
+    BOOST_HOF_TEST_CHECK(boost::hof::flow(increment(), widen(), increment())(3) == 9);
+    STATIC_ASSERT_SAME(decltype(boost::hof::flow(increment(), widen(), increment())(3)), long);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::flow(increment(), widen(), increment(), increment())(3) == 10);
+    BOOST_HOF_TEST_CHECK(boost::hof::flow(increment(), boost::hof::identity, increment())(3) == 5);
+}
+#if BOOST_HOF_HAS_NOEXCEPT_DEDUCTION
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(noexcept(boost::hof::flow(increment(), decrement(), increment(), negate())(3)), "noexcept flow");
+    static_assert(!noexcept(boost::hof::flow(append{"b"}, append{"c"}, append{"d"})(std::string())), "noexcept flow");
+}
+#endif
 }
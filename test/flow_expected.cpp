@@ -0,0 +1,213 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    flow_expected.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/flow_expected.hpp>
+#include <memory>
+#include <string>
+#include "test.hpp"
+#if BOOST_HOF_HAS_STD_17 && defined(__has_include)
+#if __has_include(<optional>)
+#include <optional>
+#define BOOST_HOF_TEST_STD_OPTIONAL 1
+#endif
+#endif
+#ifndef BOOST_HOF_TEST_STD_OPTIONAL
+#define BOOST_HOF_TEST_STD_OPTIONAL 0
+#endif
+
+namespace flow_expected_test {
+
+template<class T>
+struct maybe
+{
+    bool has;
+    T value;
+
+    constexpr maybe() : has(false), value()
+    {}
+
+    constexpr maybe(T x) : has(true), value(x)
+    {}
+
+    constexpr explicit operator bool() const
+    {
+        return has;
+    }
+
+    constexpr const T& operator*() const
+    {
+        return value;
+    }
+};
+
+template<class E>
+struct failure
+{
+    E e;
+    explicit failure(E x) : e(std::move(x))
+    {}
+};
+
+template<class T, class E>
+struct expected
+{
+    typedef failure<E> unexpected_type;
+    bool has;
+    T value;
+    E err;
+
+    expected(T x) : has(true), value(std::move(x)), err()
+    {}
+
+    expected(failure<E> f) : has(false), value(), err(std::move(f.e))
+    {}
+
+    explicit operator bool() const
+    {
+        return has;
+    }
+
+    T& operator*() &
+    {
+        return value;
+    }
+
+    T&& operator*() &&
+    {
+        return std::move(value);
+    }
+
+    const E& error() const
+    {
+        return err;
+    }
+};
+
+struct half
+{
+    constexpr maybe<int> operator()(int x) const
+    {
+        return x % 2 == 0 ? maybe<int>(x / 2) : maybe<int>();
+    }
+};
+
+struct increment
+{
+    constexpr maybe<int> operator()(int x) const
+    {
+        return maybe<int>(x + 1);
+    }
+};
+
+struct parse
+{
+    expected<int, std::string> operator()(const std::string& s) const
+    {
+        if (s.empty() || s[0] < '0' || s[0] > '9') return failure<std::string>("not a digit");
+        return s[0] - '0';
+    }
+};
+
+struct positive
+{
+    expected<int, std::string> operator()(int x) const
+    {
+        if (x == 0) return failure<std::string>("zero");
+        return x;
+    }
+};
+
+struct show
+{
+    expected<std::string, std::string> operator()(int x) const
+    {
+        return std::string(std::size_t(x), '*');
+    }
+};
+
+struct count_calls
+{
+    int* calls;
+    maybe<int> operator()(int x) const
+    {
+        ++*calls;
+        return maybe<int>(x);
+    }
+};
+
+struct take_ptr
+{
+    expected<int, std::string> operator()(std::unique_ptr<int> p) const
+    {
+        return *p;
+    }
+};
+
+struct make_ptr
+{
+    expected<std::unique_ptr<int>, std::string> operator()(int x) const
+    {
+        return std::unique_ptr<int>(new int(x));
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace flow_expected_test;
+    auto f = boost::hof::flow_expected(half(), increment(), half());
+    BOOST_HOF_TEST_CHECK(*f(6) == 2);
+    BOOST_HOF_TEST_CHECK(!f(5));
+    BOOST_HOF_TEST_CHECK(!f(4));
+    BOOST_HOF_TEST_CHECK(*boost::hof::flow_expected(half())(8) == 4);
+
+    BOOST_HOF_STATIC_TEST_CHECK(*boost::hof::flow_expected(half(), increment(), half())(6) == 2);
+    BOOST_HOF_STATIC_TEST_CHECK(!boost::hof::flow_expected(half(), increment(), half())(4));
+}
+
+// The rest of the stages are skipped after a failure
+BOOST_HOF_TEST_CASE()
+{
+    using namespace flow_expected_test;
+    int calls = 0;
+    auto f = boost::hof::flow_expected(half(), count_calls{&calls}, count_calls{&calls});
+    BOOST_HOF_TEST_CHECK(*f(2) == 1);
+    BOOST_HOF_TEST_CHECK(calls == 2);
+    BOOST_HOF_TEST_CHECK(!f(3));
+    BOOST_HOF_TEST_CHECK(calls == 2);
+}
+
+// The error is moved into the result of the last stage
+BOOST_HOF_TEST_CASE()
+{
+    using namespace flow_expected_test;
+    auto f = boost::hof::flow_expected(parse(), positive(), show());
+    BOOST_HOF_TEST_CHECK(*f("3") == "***");
+    BOOST_HOF_TEST_CHECK(!f("x"));
+    BOOST_HOF_TEST_CHECK(f("x").error() == "not a digit");
+    BOOST_HOF_TEST_CHECK(f("0").error() == "zero");
+}
+
+// The value is moved to the next stage
+BOOST_HOF_TEST_CASE()
+{
+    using namespace flow_expected_test;
+    auto f = boost::hof::flow_expected(make_ptr(), take_ptr());
+    BOOST_HOF_TEST_CHECK(*f(7) == 7);
+}
+
+#if BOOST_HOF_TEST_STD_OPTIONAL
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::flow_expected(
+        [](int x) -> std::optional<int> { if (x < 0) return std::nullopt; return x * 2; },
+        [](int x) -> std::optional<std::string> { return std::string(std::size_t(x), 'a'); }
+    );
+    BOOST_HOF_TEST_CHECK(*f(2) == "aaaa");
+    BOOST_HOF_TEST_CHECK(!f(-1));
+}
+#endif
@@ -5,6 +5,10 @@
     file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 ==============================================================================*/
 #include <boost/hof/fold.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <boost/hof/unpack.hpp>
+#include <array>
+#include <climits>
 #include "test.hpp"
 
 struct max_f
@@ -91,3 +95,34 @@ BOOST_HOF_TEST_CASE()
 {
     BOOST_HOF_TEST_CHECK(boost::hof::fold(sum_f(), std::string())("hello", "-", "world") == "hello-world");
 }
+
+BOOST_HOF_TEST_CASE()
+{
+    // Associative operators on unsigned integers are reduced in a tree
+    static_assert(boost::hof::detail::fold_reassociates<boost::hof::operators::add, unsigned, unsigned, unsigned, unsigned>::value, "Not reassociated");
+    static_assert(!boost::hof::detail::fold_reassociates<boost::hof::operators::add, unsigned, unsigned, unsigned>::value, "Reassociated");
+    // Signed integers only for the operators that can't overflow
+    static_assert(!boost::hof::detail::fold_reassociates<boost::hof::operators::add, int, int, int, int>::value, "Reassociated");
+    static_assert(!boost::hof::detail::fold_reassociates<boost::hof::operators::multiply, long, long, long, long>::value, "Reassociated");
+    static_assert(boost::hof::detail::fold_reassociates<boost::hof::operators::bit_or, int, int, int, int>::value, "Not reassociated");
+    static_assert(!boost::hof::detail::fold_reassociates<boost::hof::operators::add, double, double, double, double>::value, "Reassociated");
+    static_assert(!boost::hof::detail::fold_reassociates<boost::hof::operators::subtract, int, int, int, int>::value, "Reassociated");
+    static_assert(!boost::hof::detail::fold_reassociates<boost::hof::operators::add, char, char, char, char>::value, "Reassociated");
+    static_assert(!boost::hof::detail::fold_reassociates<sum_f, int, int, int, int>::value, "Reassociated");
+
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::fold(boost::hof::_ + boost::hof::_, 0)(1, 2, 3, 4, 5, 6, 7) == 28);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::fold(boost::hof::_ * boost::hof::_)(1, 2, 3, 4, 5) == 120);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::fold(boost::hof::_ - boost::hof::_)(10, 1, 2, 3, 4) == 0);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::fold(boost::hof::_ ^ boost::hof::_, 0u)(1u, 2u, 4u, 8u, 1u) == 14u);
+
+    std::array<long, 8> a = {{ 1, 2, 3, 4, 5, 6, 7, 8 }};
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(boost::hof::fold(boost::hof::_ + boost::hof::_, 0L))(a) == 36);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(boost::hof::fold(boost::hof::_ | boost::hof::_))(a) == 15);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The left fold doesn't overflow, but the tree would add INT_MAX + 1
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::fold(boost::hof::_ + boost::hof::_)(0, 0, -10, INT_MAX, 1) == INT_MAX - 9);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::fold(boost::hof::_ + boost::hof::_, 0)(0, -10, INT_MAX, 1, 0) == INT_MAX - 9);
+}
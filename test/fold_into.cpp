@@ -0,0 +1,31 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    fold_into.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/fold_into.hpp>
+#include <boost/hof/map.hpp>
+#include <boost/hof/placeholders.hpp>
+#include "test.hpp"
+
+#include <memory>
+#include <vector>
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> v = { 1, 2, 3, 4 };
+    BOOST_HOF_TEST_CHECK((v | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0)) == 10);
+    BOOST_HOF_TEST_CHECK(boost::hof::fold_into(v, boost::hof::_ - boost::hof::_, 0) == -10);
+    BOOST_HOF_TEST_CHECK((std::vector<int>() | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 5)) == 5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The elements are not copied
+    std::vector<std::unique_ptr<int>> v;
+    v.emplace_back(new int(1));
+    v.emplace_back(new int(2));
+    auto r = v | boost::hof::map([](const std::unique_ptr<int>& p) { return *p; }) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0);
+    BOOST_HOF_TEST_CHECK(r == 3);
+}
@@ -0,0 +1,156 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    format_to.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/format_to.hpp>
+#include <array>
+#include <climits>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "test.hpp"
+
+namespace format_to_test {
+
+enum class color { red = 3 };
+
+struct point
+{
+    int x;
+    int y;
+};
+
+struct not_formattable
+{};
+
+template<class... Ts>
+std::string format(const Ts&... xs)
+{
+    std::array<char, 256> buffer;
+    std::size_t n = boost::hof::format_to(buffer)(xs...);
+    return std::string(buffer.data(), n < buffer.size() ? n : buffer.size());
+}
+
+template<class T, class=void>
+struct can_format
+: std::false_type
+{};
+
+template<class T>
+struct can_format<T, typename boost::hof::detail::holder<
+    decltype(boost::hof::format_to(std::declval<std::array<char, 8>&>())(std::declval<const T&>()))
+>::type>
+: std::true_type
+{};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace format_to_test;
+    BOOST_HOF_TEST_CHECK(format(1) == "1");
+    BOOST_HOF_TEST_CHECK(format(-42) == "-42");
+    BOOST_HOF_TEST_CHECK(format(0u) == "0");
+    BOOST_HOF_TEST_CHECK(format(LLONG_MIN) == "-9223372036854775808");
+    BOOST_HOF_TEST_CHECK(format(ULLONG_MAX) == "18446744073709551615");
+    BOOST_HOF_TEST_CHECK(format(static_cast<short>(-7)) == "-7");
+    BOOST_HOF_TEST_CHECK(format(static_cast<unsigned char>(200)) == "200");
+    BOOST_HOF_TEST_CHECK(format(true, false) == "truefalse");
+    BOOST_HOF_TEST_CHECK(format('x') == "x");
+    BOOST_HOF_TEST_CHECK(format(color::red) == "3");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace format_to_test;
+    BOOST_HOF_TEST_CHECK(format(0.5) == "0.5");
+    BOOST_HOF_TEST_CHECK(format(-2.25f) == "-2.25");
+    BOOST_HOF_TEST_CHECK(format(100.0) == "100");
+    BOOST_HOF_TEST_CHECK(std::stod(format(0.1)) == 0.1);
+    BOOST_HOF_TEST_CHECK(std::stod(format(1.0/3.0)) == 1.0/3.0);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace format_to_test;
+    const char* s = "pointer";
+    const char* null = nullptr;
+    char array[8] = "arr";
+    BOOST_HOF_TEST_CHECK(format("literal") == "literal");
+    BOOST_HOF_TEST_CHECK(format(s) == "pointer");
+    BOOST_HOF_TEST_CHECK(format(null) == "");
+    BOOST_HOF_TEST_CHECK(format(array) == "arr");
+    BOOST_HOF_TEST_CHECK(format(std::string("string")) == "string");
+    BOOST_HOF_TEST_CHECK(format("x = ", 1, ", y = ", 2) == "x = 1, y = 2");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace format_to_test;
+    std::vector<int> v = { 1, 2, 3 };
+    std::vector<int> empty;
+    int array[] = { 4, 5 };
+    BOOST_HOF_TEST_CHECK(format(v) == "[1, 2, 3]");
+    BOOST_HOF_TEST_CHECK(format(empty) == "[]");
+    BOOST_HOF_TEST_CHECK(format(array) == "[4, 5]");
+    BOOST_HOF_TEST_CHECK(format(std::vector<std::string>{ "a", "b" }) == "[a, b]");
+    BOOST_HOF_TEST_CHECK(format(std::vector<std::vector<int>>{ { 1 }, { 2, 3 } }) == "[[1], [2, 3]]");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace format_to_test;
+    BOOST_HOF_TEST_CHECK(format(std::make_tuple(1, 'x', "s")) == "{1, x, s}");
+    BOOST_HOF_TEST_CHECK(format(std::make_tuple()) == "{}");
+    BOOST_HOF_TEST_CHECK(format(std::make_pair(1, std::vector<int>{ 2 })) == "{1, [2]}");
+    std::map<int, std::string> m = { { 1, "one" }, { 2, "two" } };
+    BOOST_HOF_TEST_CHECK(format(m) == "[{1, one}, {2, two}]");
+    BOOST_HOF_TEST_CHECK(format(std::make_tuple(std::make_tuple(1, 2), 3)) == "{{1, 2}, 3}");
+}
+
+#if BOOST_HOF_HAS_STD_17
+BOOST_HOF_TEST_CASE()
+{
+    using namespace format_to_test;
+    BOOST_HOF_TEST_CHECK(format(point{ 1, 2 }) == "{1, 2}");
+    BOOST_HOF_TEST_CHECK(format(std::vector<point>{ { 1, 2 }, { 3, 4 } }) == "[{1, 2}, {3, 4}]");
+}
+#endif
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace format_to_test;
+    std::array<char, 8> buffer;
+    buffer.fill('#');
+    std::vector<int> v = { 100, 200, 300 };
+    std::size_t n = boost::hof::format_to(buffer)(v);
+    BOOST_HOF_TEST_CHECK(n == 15);
+    BOOST_HOF_TEST_CHECK(std::string(buffer.data(), buffer.size()) == "[100, 20");
+
+    // A number that doesn't fit is still cut off at the end of the buffer
+    buffer.fill('#');
+    n = boost::hof::format_to(buffer)("abcde", 123456);
+    BOOST_HOF_TEST_CHECK(n == 11);
+    BOOST_HOF_TEST_CHECK(std::string(buffer.data(), buffer.size()) == "abcde123");
+
+    std::vector<char> v2(4, '#');
+    n = boost::hof::format_to(v2)(12);
+    BOOST_HOF_TEST_CHECK(n == 2);
+    BOOST_HOF_TEST_CHECK(std::string(v2.data(), v2.size()) == "12##");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace format_to_test;
+    BOOST_HOF_STATIC_TEST_CHECK(can_format<int>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(can_format<std::tuple<int, std::string>>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(can_format<std::vector<std::pair<int, double>>>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!can_format<int*>::value);
+#if !BOOST_HOF_HAS_STD_17
+    BOOST_HOF_STATIC_TEST_CHECK(!can_format<not_formattable>::value);
+#endif
+}
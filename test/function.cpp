@@ -22,6 +22,8 @@ struct sum_f
 };
 
 BOOST_HOF_STATIC_FUNCTION(sum_init) = sum_f();
+// The static functions are revealed by default
+STATIC_ASSERT_SAME(std::decay<decltype(sum_init)>::type, boost::hof::reveal_adaptor<sum_f>);
 
 BOOST_HOF_TEST_CASE()
 {
@@ -0,0 +1,125 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    function_ref.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/function_ref.hpp>
+#include <boost/hof/compose.hpp>
+#include <boost/hof/indirect.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <memory>
+#include <string>
+#include "test.hpp"
+
+namespace function_ref_test {
+
+int increment(int x)
+{
+    return x + 1;
+}
+
+int twice(int x)
+{
+    return x * 2;
+}
+
+struct counter
+{
+    int n;
+
+    int operator()(int x)
+    {
+        return n += x;
+    }
+};
+
+struct is_const_call
+{
+    bool operator()() const
+    {
+        return true;
+    }
+
+    bool operator()()
+    {
+        return false;
+    }
+};
+
+int apply(boost::hof::function_ref<int(int)> f, int x)
+{
+    return f(x);
+}
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(function_ref_test::apply(boost::hof::_ + 1, 1) == 2);
+    BOOST_HOF_TEST_CHECK(function_ref_test::apply(function_ref_test::increment, 1) == 2);
+    BOOST_HOF_TEST_CHECK(function_ref_test::apply(&function_ref_test::twice, 2) == 4);
+    auto f = boost::hof::compose(function_ref_test::increment, function_ref_test::twice);
+    BOOST_HOF_TEST_CHECK(function_ref_test::apply(f, 2) == 5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // Function pointers are stored by value
+    boost::hof::function_ref<int(int)> r = &function_ref_test::twice;
+    BOOST_HOF_TEST_CHECK(r(3) == 6);
+    r = &function_ref_test::increment;
+    BOOST_HOF_TEST_CHECK(r(3) == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    function_ref_test::counter c{0};
+    boost::hof::function_ref<int(int)> r = c;
+    r(2);
+    r(3);
+    BOOST_HOF_TEST_CHECK(c.n == 5);
+    auto copy = r;
+    copy(1);
+    BOOST_HOF_TEST_CHECK(c.n == 6);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    function_ref_test::is_const_call f;
+    const function_ref_test::is_const_call& cf = f;
+    BOOST_HOF_TEST_CHECK(!boost::hof::function_ref<bool()>(f)());
+    BOOST_HOF_TEST_CHECK(boost::hof::function_ref<bool()>(cf)());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::unique_ptr<function_ref_test::counter> p(new function_ref_test::counter{1});
+    auto f = boost::hof::indirect(std::move(p));
+    boost::hof::function_ref<long(int)> r = f;
+    BOOST_HOF_TEST_CHECK(r(1) == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int x = 0;
+    auto set = [&](int y) { x = y; return y; };
+    boost::hof::function_ref<void(int)> r = set;
+    r(3);
+    BOOST_HOF_TEST_CHECK(x == 3);
+
+    auto take = [](std::unique_ptr<int> q) { return *q; };
+    boost::hof::function_ref<int(std::unique_ptr<int>)> t = take;
+    BOOST_HOF_TEST_CHECK(t(std::unique_ptr<int>(new int(4))) == 4);
+
+    auto cat = [](const std::string& s) -> std::string { return s + s; };
+    BOOST_HOF_TEST_CHECK(boost::hof::function_ref<std::string(const std::string&)>(cat)("a") == "aa");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_STATIC_TEST_CHECK(sizeof(boost::hof::function_ref<int(int)>) == 2 * sizeof(void*));
+    BOOST_HOF_STATIC_TEST_CHECK(std::is_convertible<decltype(boost::hof::_ + 1), boost::hof::function_ref<int(int)>>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!std::is_convertible<function_ref_test::counter, boost::hof::function_ref<int(std::string)>>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!std::is_convertible<int, boost::hof::function_ref<int(int)>>::value);
+}
@@ -0,0 +1,182 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    fuse.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/fuse.hpp>
+#include <boost/hof/flow.hpp>
+#include <cctype>
+#include <string>
+#include <vector>
+#include "test.hpp"
+
+namespace fuse_test {
+
+// Counts the passes over the object
+struct counted
+{
+    std::vector<int> v;
+    int* passes;
+
+    typedef std::vector<int>::iterator iterator;
+
+    iterator begin()
+    {
+        ++*passes;
+        return v.begin();
+    }
+
+    iterator end()
+    {
+        return v.end();
+    }
+};
+
+struct add_one
+{
+    int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+struct times_two
+{
+    int operator()(int x) const
+    {
+        return x * 2;
+    }
+};
+
+struct sum
+{
+    int operator()(const counted& c) const
+    {
+        int r = 0;
+        for (int x : c.v) r += x;
+        return r;
+    }
+};
+
+struct reverse
+{
+    counted operator()(counted c) const
+    {
+        c.v.assign(c.v.rbegin(), c.v.rend());
+        return c;
+    }
+};
+
+struct first
+{
+    int operator()(const counted& c) const
+    {
+        return c.v.front();
+    }
+};
+
+struct upper
+{
+    char operator()(char c) const
+    {
+        return char(std::toupper(static_cast<unsigned char>(c)));
+    }
+};
+
+struct make_counted
+{
+    counted operator()(int n, int* passes) const
+    {
+        return counted{std::vector<int>(std::size_t(n), 1), passes};
+    }
+};
+
+// A stage that declares itself element-wise
+struct negate_all
+{
+    std::vector<int> operator()(std::vector<int> v) const
+    {
+        for (auto& x : v) x = -x;
+        return v;
+    }
+
+    negate_all element_function() const
+    {
+        return *this;
+    }
+
+    int operator()(int x) const
+    {
+        return -x;
+    }
+};
+
+}
+
+namespace boost { namespace hof {
+
+template<>
+struct is_elementwise<fuse_test::negate_all>
+: std::true_type
+{};
+
+}}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> v = { 1, 2, 3 };
+    auto r = boost::hof::elementwise(fuse_test::add_one())(v);
+    BOOST_HOF_TEST_CHECK(r == std::vector<int>({ 2, 3, 4 }));
+    BOOST_HOF_TEST_CHECK(v == std::vector<int>({ 1, 2, 3 }));
+    BOOST_HOF_TEST_CHECK(boost::hof::elementwise(fuse_test::upper())(std::string("abc")) == "ABC");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto stages = boost::hof::flow(
+        boost::hof::elementwise(fuse_test::add_one()),
+        boost::hof::elementwise(fuse_test::times_two()),
+        boost::hof::elementwise(fuse_test::add_one()),
+        fuse_test::sum()
+    );
+    int passes = 0;
+    BOOST_HOF_TEST_CHECK(stages(fuse_test::counted{{ 1, 2, 3 }, &passes}) == 21);
+    BOOST_HOF_TEST_CHECK(passes == 3);
+    passes = 0;
+    BOOST_HOF_TEST_CHECK(boost::hof::fuse(stages)(fuse_test::counted{{ 1, 2, 3 }, &passes}) == 21);
+    BOOST_HOF_TEST_CHECK(passes == 1);
+}
+
+// The runs are split by the stages that aren't element-wise
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::fuse(boost::hof::flow(
+        fuse_test::make_counted(),
+        boost::hof::elementwise(fuse_test::add_one()),
+        boost::hof::elementwise(fuse_test::times_two()),
+        fuse_test::reverse(),
+        boost::hof::elementwise(fuse_test::add_one()),
+        boost::hof::elementwise(fuse_test::add_one()),
+        fuse_test::first()
+    ));
+    int passes = 0;
+    BOOST_HOF_TEST_CHECK(f(3, &passes) == 6);
+    BOOST_HOF_TEST_CHECK(passes == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::fuse(boost::hof::flow(boost::hof::elementwise(fuse_test::upper())));
+    BOOST_HOF_TEST_CHECK(f(std::string("abc")) == "ABC");
+    auto g = boost::hof::fuse(boost::hof::flow(boost::hof::elementwise(fuse_test::add_one()), boost::hof::elementwise(fuse_test::add_one())));
+    BOOST_HOF_TEST_CHECK(g(std::vector<int>{ 1 }) == std::vector<int>({ 3 }));
+    auto h = boost::hof::fuse(boost::hof::flow(fuse_test::add_one(), fuse_test::times_two()));
+    BOOST_HOF_TEST_CHECK(h(1) == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::fuse(boost::hof::flow(fuse_test::negate_all(), boost::hof::elementwise(fuse_test::add_one())));
+    BOOST_HOF_TEST_CHECK(f(std::vector<int>{ 1, 2 }) == std::vector<int>({ 0, -1 }));
+}
@@ -0,0 +1,90 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    hash_of.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/hash_of.hpp>
+#include <boost/hof/pack.hpp>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include "test.hpp"
+
+namespace hash_of_test {
+
+struct point
+{
+    int x;
+    int y;
+};
+
+// Hashes everything to the same value, so only the mixing differs
+struct constant_hash
+{
+    template<class T>
+    std::size_t operator()(const T&) const
+    {
+        return 7;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::hash_of(1, 2) == boost::hof::hash_of(1, 2));
+    BOOST_HOF_TEST_CHECK(boost::hof::hash_of(1, 2) != boost::hof::hash_of(2, 1));
+    BOOST_HOF_TEST_CHECK(boost::hof::hash_of(1) != boost::hof::hash_of(1, 0));
+    BOOST_HOF_TEST_CHECK(boost::hof::hash_of() == boost::hof::hash_of());
+    BOOST_HOF_TEST_CHECK(boost::hof::hash_of(std::string("a"), 1) == boost::hof::hash_of(std::string("a"), 1));
+}
+
+// A sequence is hashed by its elements
+BOOST_HOF_TEST_CASE()
+{
+    std::size_t h = boost::hof::hash_of(1, std::string("a"));
+    BOOST_HOF_TEST_CHECK(boost::hof::hash_of(std::make_tuple(1, std::string("a"))) == boost::hof::hash_of(h));
+    BOOST_HOF_TEST_CHECK(boost::hof::hash_of(std::make_pair(1, std::string("a"))) == boost::hof::hash_of(h));
+    BOOST_HOF_TEST_CHECK(boost::hof::hash_of(boost::hof::pack(1, std::string("a"))) == boost::hof::hash_of(h));
+    auto nested = std::make_tuple(std::make_tuple(1, 2), 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::hash_of(nested) == boost::hof::hash_of(boost::hof::hash_of(boost::hof::hash_of(1, 2), 3)));
+#if BOOST_HOF_HAS_STD_17 && defined(__cpp_structured_bindings)
+    BOOST_HOF_TEST_CHECK(boost::hof::hash_of(hash_of_test::point{1, 2}) == boost::hof::hash_of(boost::hof::hash_of(1, 2)));
+#endif
+}
+
+// The lanes spread the values, including more than four of them
+BOOST_HOF_TEST_CASE()
+{
+    std::set<std::size_t> hashes;
+    for (int i = 0; i < 16; i++)
+    {
+        for (int j = 0; j < 16; j++)
+        {
+            hashes.insert(boost::hof::hash_of(i, j, 0, 0, 0, i + j));
+            hashes.insert(boost::hof::hash_of(i, j) & 0xFF00u);
+        }
+    }
+    // The low bits of std::hash<int> are the value, so the small keys
+    // only land in distinct buckets when the result is mixed
+    BOOST_HOF_TEST_CHECK(hashes.size() > 256 + 128);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto h = boost::hof::hash_with(hash_of_test::constant_hash());
+    BOOST_HOF_TEST_CHECK(h(1, 2) == h(std::string("a"), 3.0));
+    BOOST_HOF_TEST_CHECK(h(1, 2) != h(1, 2, 3));
+    BOOST_HOF_TEST_CHECK(h(1, 2) != boost::hof::hash_of(1, 2));
+
+    typedef std::tuple<int, std::string> key;
+    std::unordered_set<key, std::decay<decltype(boost::hof::hash_of)>::type> s;
+    s.insert(key(1, "a"));
+    s.insert(key(1, "a"));
+    s.insert(key(2, "a"));
+    BOOST_HOF_TEST_CHECK(s.size() == 2);
+    BOOST_HOF_TEST_CHECK(s.count(key(2, "a")) == 1);
+}
@@ -0,0 +1,111 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    hedged.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/hedged.hpp>
+#include <boost/hof/executor.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include "test.hpp"
+
+namespace hedged_test {
+
+struct failure : std::runtime_error
+{
+    failure() : std::runtime_error("failure")
+    {}
+};
+
+// The first attempt is slow, so the second one wins
+struct slow_first
+{
+    std::shared_ptr<std::atomic<int>> calls;
+    std::shared_ptr<std::atomic<int>> finished;
+
+    int operator()(int x) const
+    {
+        int i = (*calls)++;
+        if (i == 0) std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        (*finished)++;
+        return x + i;
+    }
+};
+
+struct always_fails
+{
+    std::shared_ptr<std::atomic<int>> calls;
+
+    int operator()() const
+    {
+        (*calls)++;
+        throw failure();
+    }
+};
+
+struct record
+{
+    std::shared_ptr<std::atomic<int>> calls;
+
+    void operator()(int x) const
+    {
+        *calls += x;
+    }
+};
+
+template<class T>
+void wait_for(const std::atomic<T>& x, T n)
+{
+    while (x.load() < n) std::this_thread::yield();
+}
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto calls = std::make_shared<std::atomic<int>>(0);
+    auto finished = std::make_shared<std::atomic<int>>(0);
+    auto f = boost::hof::hedged(2, std::chrono::milliseconds(1))(hedged_test::slow_first{calls, finished});
+    BOOST_HOF_TEST_CHECK(f(1) == 2);
+    // The attempt that lost still finishes
+    hedged_test::wait_for(*finished, 2);
+    BOOST_HOF_TEST_CHECK(calls->load() == 2);
+}
+
+// An attempt that finishes before the delay doesn't start another one
+BOOST_HOF_TEST_CASE()
+{
+    auto calls = std::make_shared<std::atomic<int>>(1);
+    auto finished = std::make_shared<std::atomic<int>>(0);
+    auto f = boost::hof::hedged(3, std::chrono::seconds(10))(hedged_test::slow_first{calls, finished});
+    BOOST_HOF_TEST_CHECK(f(1) == 2);
+    BOOST_HOF_TEST_CHECK(calls->load() == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto calls = std::make_shared<std::atomic<int>>(0);
+    auto f = boost::hof::hedged(3, std::chrono::microseconds(1))(hedged_test::always_fails{calls});
+    bool thrown = false;
+    try
+    {
+        f();
+    }
+    catch(const hedged_test::failure&)
+    {
+        thrown = true;
+    }
+    BOOST_HOF_TEST_CHECK(thrown);
+    BOOST_HOF_TEST_CHECK(calls->load() == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto calls = std::make_shared<std::atomic<int>>(0);
+    boost::hof::hedged(1, std::chrono::milliseconds(1), boost::hof::inline_executor())(hedged_test::record{calls})(3);
+    BOOST_HOF_TEST_CHECK(calls->load() == 3);
+}
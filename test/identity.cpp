@@ -6,6 +6,9 @@
 ==============================================================================*/
 #include <boost/hof/identity.hpp>
 #include <boost/hof/is_invocable.hpp>
+#include <boost/hof/compose.hpp>
+#include <boost/hof/flow.hpp>
+#include <boost/hof/placeholders.hpp>
 #include <boost/hof/detail/move.hpp>
 #include "test.hpp"
 
@@ -66,3 +69,71 @@ BOOST_HOF_TEST_CASE()
     static_assert(!noexcept(boost::hof::identity(copy_throws{})), "Noexcept identity");
 }
 
+
+namespace identity_test {
+
+// Counts the moves, so a stage that makes a new object is seen
+struct payload
+{
+    int* moves;
+    payload(int* m) : moves(m) {}
+    payload(const payload& p) : moves(p.moves) {}
+    payload(payload&& p) noexcept : moves(p.moves) { ++*moves; }
+};
+
+struct consume
+{
+    int operator()(payload&& p) const
+    {
+        return *p.moves;
+    }
+};
+
+struct make_payload
+{
+    int* moves;
+    payload operator()() const
+    {
+        return payload(moves);
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int i = 5;
+    static_assert(noexcept(boost::hof::identity_ref(i)), "Noexcept identity_ref");
+    copy_throws ct{};
+    static_assert(noexcept(boost::hof::identity_ref(boost::hof::move(ct))), "Noexcept identity_ref");
+    STATIC_ASSERT_SAME(decltype(boost::hof::identity_ref(i)), int&);
+    STATIC_ASSERT_SAME(decltype(boost::hof::identity_ref(boost::hof::move(i))), int&&);
+    BOOST_HOF_TEST_CHECK(&boost::hof::identity_ref(i) == &i);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::identity_ref(3) == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace identity_test;
+    int moves = 0;
+    BOOST_HOF_TEST_CHECK(boost::hof::flow(boost::hof::identity_ref, consume())(payload(&moves)) == 0);
+    BOOST_HOF_TEST_CHECK(boost::hof::compose(consume(), boost::hof::identity_ref)(payload(&moves)) == 0);
+    BOOST_HOF_TEST_CHECK(boost::hof::flow(boost::hof::identity, consume())(payload(&moves)) == 1);
+}
+
+// As the last function, the result of the previous function is returned
+// by value, instead of a reference to a temporary
+BOOST_HOF_TEST_CASE()
+{
+    using namespace identity_test;
+    int moves = 0;
+    STATIC_ASSERT_SAME(decltype(boost::hof::flow(make_payload{&moves}, boost::hof::identity_ref)()), payload);
+    STATIC_ASSERT_SAME(decltype(boost::hof::compose(boost::hof::identity_ref, make_payload{&moves})()), payload);
+    STATIC_ASSERT_SAME(decltype(boost::hof::flow(boost::hof::_ + 1, boost::hof::_ * 2, boost::hof::identity_ref)(1)), int);
+    BOOST_HOF_TEST_CHECK(boost::hof::flow(boost::hof::_ + 1, boost::hof::_ * 2, boost::hof::identity_ref)(1) == 4);
+    BOOST_HOF_TEST_CHECK(boost::hof::compose(boost::hof::identity_ref, boost::hof::_ * 2, boost::hof::_ + 1)(1) == 4);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::flow(boost::hof::_ + 1, boost::hof::identity_ref)(1) == 2);
+    // A reference that is returned by the previous function is kept
+    int i = 0;
+    STATIC_ASSERT_SAME(decltype(boost::hof::flow(boost::hof::identity_ref, boost::hof::identity_ref)(i)), int&);
+}
@@ -5,6 +5,7 @@
     file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 ==============================================================================*/
 #include <boost/hof/implicit.hpp>
+#include <string>
 #include "test.hpp"
 
 template<class T>
@@ -54,3 +55,51 @@ BOOST_HOF_TEST_CASE()
     static_assert(noexcept(int(lauto_cast(f))), "noexcept implicit");
 }
 #endif
+
+namespace implicit_test {
+
+int parses = 0;
+
+template<class T>
+struct counted_caster
+{
+    template<class U>
+    T operator()(U x) const
+    {
+        parses++;
+        return T(x);
+    }
+};
+
+static constexpr boost::hof::implicit_cached<counted_caster, int, std::string> cached_cast = {};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    implicit_test::parses = 0;
+    auto r = implicit_test::cached_cast(3);
+    int i = r;
+    int j = r;
+    long k = r;
+    long l = r;
+    BOOST_HOF_TEST_CHECK(i == 3 && j == 3);
+    BOOST_HOF_TEST_CHECK(k == 3 && l == 3);
+    // long isn't one of the cached types
+    BOOST_HOF_TEST_CHECK(implicit_test::parses == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    implicit_test::parses = 0;
+    auto r = implicit_test::cached_cast("abc");
+    std::string s = r;
+    std::string s2 = r;
+    BOOST_HOF_TEST_CHECK(s == "abc" && s2 == "abc");
+    auto moved = std::move(r);
+    std::string t = moved;
+    BOOST_HOF_TEST_CHECK(t == "abc");
+    BOOST_HOF_TEST_CHECK(implicit_test::parses == 1);
+    int i = implicit_test::cached_cast(2);
+    BOOST_HOF_TEST_CHECK(i == 2);
+}
@@ -50,3 +50,22 @@ BOOST_HOF_TEST_CASE()
 }
 
 
+BOOST_HOF_TEST_CASE()
+{
+    auto mf = std::make_shared<mutable_function>();
+    auto f = boost::hof::indirect_borrow(mf);
+    auto g = f;
+    STATIC_ASSERT_SAME(decltype(f), boost::hof::indirect_adaptor<mutable_function*>);
+    f(15);
+    g(2);
+    BOOST_HOF_TEST_CHECK(mf->value == 17);
+    // Copies of the borrowed adaptor don't share ownership
+    BOOST_HOF_TEST_CHECK(mf.use_count() == 1);
+    BOOST_HOF_TEST_CHECK(3 == boost::hof::indirect_borrow(std::unique_ptr<binary_class>(new binary_class()))(1, 2));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    static constexpr binary_class f = {};
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::indirect_borrow(&f)(1, 2) == 3);
+}
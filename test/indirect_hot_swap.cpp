@@ -0,0 +1,73 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    indirect_hot_swap.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/indirect_hot_swap.hpp>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+namespace indirect_hot_swap_test {
+
+struct scale
+{
+    int factor;
+    int* destroyed;
+    scale(int x, int* d=nullptr) : factor(x), destroyed(d)
+    {}
+    ~scale()
+    {
+        if (destroyed != nullptr) ++*destroyed;
+    }
+    int operator()(int x) const
+    {
+        return x*factor;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::indirect_hot_swap(std::make_shared<indirect_hot_swap_test::scale>(2));
+    BOOST_HOF_TEST_CHECK(f(3) == 6);
+    // Copies share the function
+    auto g = f;
+    f.store(std::make_shared<indirect_hot_swap_test::scale>(3));
+    BOOST_HOF_TEST_CHECK(f(3) == 9);
+    BOOST_HOF_TEST_CHECK(g(3) == 9);
+    BOOST_HOF_TEST_CHECK(g.load()->factor == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The replaced function is destroyed once it isn't used anymore
+    int destroyed = 0;
+    auto f = boost::hof::indirect_hot_swap(std::make_shared<indirect_hot_swap_test::scale>(2, &destroyed));
+    auto old = f.load();
+    f.store(std::make_shared<indirect_hot_swap_test::scale>(3));
+    BOOST_HOF_TEST_CHECK(destroyed == 0);
+    BOOST_HOF_TEST_CHECK((*old)(1) == 2);
+    old.reset();
+    BOOST_HOF_TEST_CHECK(destroyed == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    const auto f = boost::hof::indirect_hot_swap(std::make_shared<indirect_hot_swap_test::scale>(1));
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) threads.emplace_back([&f]
+    {
+        for (int j = 0; j < 1000; j++)
+        {
+            int r = f(1);
+            BOOST_HOF_TEST_CHECK(r >= 1 && r <= 3);
+        }
+    });
+    f.store(std::make_shared<indirect_hot_swap_test::scale>(2));
+    f.store(std::make_shared<indirect_hot_swap_test::scale>(3));
+    for (auto& t : threads) t.join();
+    BOOST_HOF_TEST_CHECK(f(1) == 3);
+}
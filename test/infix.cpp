@@ -113,3 +113,48 @@ BOOST_HOF_TEST_CASE()
     BOOST_HOF_TEST_CHECK((1 <f> 2 <g> foo{}) == "hello");
 
 }
+
+struct counted_vec
+{
+    int value;
+    int* copies;
+    counted_vec(int v, int* c) : value(v), copies(c)
+    {}
+    counted_vec(const counted_vec& rhs) : value(rhs.value), copies(rhs.copies)
+    {
+        ++*copies;
+    }
+    counted_vec(counted_vec&& rhs) : value(rhs.value), copies(rhs.copies)
+    {
+        ++*copies;
+    }
+};
+
+struct counted_add
+{
+    int* copies;
+    int bias;
+    counted_add(int* c, int b) : copies(c), bias(b)
+    {}
+    counted_add(const counted_add& rhs) : copies(rhs.copies), bias(rhs.bias)
+    {
+        ++*copies;
+    }
+    int operator()(const counted_vec& x, const counted_vec& y) const
+    {
+        return x.value + y.value + bias;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    int operand_copies = 0;
+    int function_copies = 0;
+    auto add = boost::hof::infix(counted_add(&function_copies, 1));
+    function_copies = 0;
+    counted_vec x(1, &operand_copies);
+    BOOST_HOF_TEST_CHECK((x <add> counted_vec(2, &operand_copies)) == 4);
+    BOOST_HOF_TEST_CHECK((counted_vec(3, &operand_copies) <add> x) == 5);
+    BOOST_HOF_TEST_CHECK(operand_copies == 0);
+    BOOST_HOF_TEST_CHECK(function_copies == 0);
+}
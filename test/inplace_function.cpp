@@ -0,0 +1,120 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    inplace_function.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/inplace_function.hpp>
+#include <boost/hof/partial.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <memory>
+#include <string>
+#include "test.hpp"
+
+namespace inplace_function_test {
+
+int increment(int x)
+{
+    return x + 1;
+}
+
+struct tracked
+{
+    std::shared_ptr<int> p;
+
+    int operator()(int x) const
+    {
+        return x + *p;
+    }
+};
+
+struct sum
+{
+    template<class T, class U>
+    T operator()(T x, U y) const
+    {
+        return x + y;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::inplace_function<int(int)> f = boost::hof::_ + 1;
+    BOOST_HOF_TEST_CHECK(f);
+    BOOST_HOF_TEST_CHECK(f(1) == 2);
+    f = &inplace_function_test::increment;
+    BOOST_HOF_TEST_CHECK(f(2) == 3);
+    f = boost::hof::partial(inplace_function_test::sum())(3);
+    BOOST_HOF_TEST_CHECK(f(2) == 5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto p = std::make_shared<int>(10);
+    {
+        boost::hof::inplace_function<int(int)> f = inplace_function_test::tracked{p};
+        BOOST_HOF_TEST_CHECK(p.use_count() == 2);
+        auto g = f;
+        BOOST_HOF_TEST_CHECK(p.use_count() == 3);
+        BOOST_HOF_TEST_CHECK(g(1) == 11);
+        auto h = std::move(g);
+        BOOST_HOF_TEST_CHECK(!g);
+        BOOST_HOF_TEST_CHECK(p.use_count() == 3);
+        BOOST_HOF_TEST_CHECK(h(2) == 12);
+        h = f;
+        BOOST_HOF_TEST_CHECK(p.use_count() == 3);
+        h.reset();
+        BOOST_HOF_TEST_CHECK(!h);
+        BOOST_HOF_TEST_CHECK(p.use_count() == 2);
+        f = std::move(f);
+        BOOST_HOF_TEST_CHECK(f(0) == 10);
+    }
+    BOOST_HOF_TEST_CHECK(p.use_count() == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::inplace_function<int(int)> f;
+    BOOST_HOF_TEST_CHECK(!f);
+    bool caught = false;
+    try
+    {
+        f(1);
+    }
+    catch(const std::bad_function_call&)
+    {
+        caught = true;
+    }
+    BOOST_HOF_TEST_CHECK(caught);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::string s;
+    boost::hof::inplace_function<void(const std::string&)> f = [&s](const std::string& x) { s += x; return s.size(); };
+    f("a");
+    f("b");
+    BOOST_HOF_TEST_CHECK(s == "ab");
+    boost::hof::inplace_function<int(std::unique_ptr<int>)> g = [](std::unique_ptr<int> p) { return *p; };
+    BOOST_HOF_TEST_CHECK(g(std::unique_ptr<int>(new int(3))) == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    struct big
+    {
+        char data[64];
+        int operator()() const
+        {
+            return data[0];
+        }
+    };
+    big b = {};
+    b.data[0] = 7;
+    boost::hof::inplace_function<int(), sizeof(big)> f = b;
+    BOOST_HOF_TEST_CHECK(f() == 7);
+    BOOST_HOF_STATIC_TEST_CHECK(sizeof(f) >= sizeof(big));
+    BOOST_HOF_STATIC_TEST_CHECK(!std::is_constructible<boost::hof::inplace_function<int(int)>, std::string>::value);
+}
@@ -0,0 +1,36 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    instantiation_stats.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#define BOOST_HOF_INSTANTIATION_STATS 1
+#include <boost/hof.hpp>
+#include "test.hpp"
+
+#include <type_traits>
+
+BOOST_HOF_TEST_CASE()
+{
+    STATIC_ASSERT_SAME(boost::hof::markers::calls::compose<int>::type, void);
+    auto f = boost::hof::compose(boost::hof::_1 + 1, binary_class());
+    STATIC_ASSERT_SAME(boost::hof::markers::compose<decltype(boost::hof::_1 + 1), binary_class>::type, decltype(f));
+    BOOST_HOF_TEST_CHECK(f(1, 2) == 4);
+    BOOST_HOF_TEST_CHECK(boost::hof::flow(binary_class(), unary_class())(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::first_of(unary_class(), binary_class())(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::combine(binary_class(), unary_class(), unary_class())(1, 2) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::flip(binary_class())(1, 2) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::rotate(binary_class())(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::mutable_(binary_class())(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::fold(binary_class())(1, 2, 3) == 6);
+    BOOST_HOF_TEST_CHECK(boost::hof::fold(binary_class(), 1)(2, 3) == 6);
+    BOOST_HOF_TEST_CHECK(boost::hof::reverse_fold(binary_class())(1, 2, 3) == 6);
+    BOOST_HOF_TEST_CHECK(boost::hof::tree_fold(binary_class())(1, 2, 3) == 6);
+    BOOST_HOF_TEST_CHECK((1 <boost::hof::infix(binary_class())> 2) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::proj(unary_class(), binary_class())(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::lazy(binary_class())(boost::hof::_1, 2)(1) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::partial(binary_class())(1)(2) == 3);
+    BOOST_HOF_TEST_CHECK((1 | boost::hof::pipable(binary_class())(2)) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(binary_class())(boost::hof::pack(1, 2)) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(binary_class())(boost::hof::pack(1), boost::hof::pack(2)) == 3);
+}
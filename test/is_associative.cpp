@@ -0,0 +1,119 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    is_associative.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/is_associative.hpp>
+#include <boost/hof/is_commutative.hpp>
+#include <boost/hof/fold.hpp>
+#include <boost/hof/reverse_fold.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <boost/hof/tree_fold.hpp>
+#include <climits>
+#include <functional>
+#include "test.hpp"
+
+namespace is_associative_test {
+
+// Not associative, so the grouping of the calls can be seen in the result
+struct digits_f
+{
+    constexpr unsigned operator()(unsigned x, unsigned y) const
+    {
+        return x * 10u - y;
+    }
+};
+
+struct associative_digits_f : digits_f
+{};
+
+struct commutative_digits_f : digits_f
+{};
+
+}
+
+namespace boost { namespace hof {
+
+template<>
+struct is_associative<is_associative_test::associative_digits_f>
+: std::true_type
+{};
+
+template<>
+struct is_associative<is_associative_test::commutative_digits_f>
+: std::true_type
+{};
+
+template<>
+struct is_commutative<is_associative_test::commutative_digits_f>
+: std::true_type
+{};
+
+}}
+
+static_assert(boost::hof::is_associative<std::plus<int>>::value, "Not associative");
+static_assert(boost::hof::is_associative<std::multiplies<unsigned>>::value, "Not associative");
+static_assert(boost::hof::is_associative<std::bit_xor<int>>::value, "Not associative");
+static_assert(boost::hof::is_associative<boost::hof::operators::bit_or>::value, "Not associative");
+static_assert(!boost::hof::is_associative<std::minus<int>>::value, "Associative");
+static_assert(!boost::hof::is_associative<boost::hof::operators::subtract>::value, "Associative");
+static_assert(!boost::hof::is_associative<is_associative_test::digits_f>::value, "Associative");
+
+static_assert(boost::hof::is_commutative<std::plus<int>>::value, "Not commutative");
+static_assert(boost::hof::is_commutative<std::bit_and<long>>::value, "Not commutative");
+static_assert(boost::hof::is_commutative<boost::hof::operators::multiply>::value, "Not commutative");
+static_assert(!boost::hof::is_commutative<std::divides<int>>::value, "Commutative");
+static_assert(!boost::hof::is_commutative<is_associative_test::associative_digits_f>::value, "Commutative");
+
+#if BOOST_HOF_HAS_STD_14
+static_assert(boost::hof::is_associative<std::plus<>>::value, "Not associative");
+static_assert(boost::hof::is_commutative<std::multiplies<>>::value, "Not commutative");
+#endif
+
+BOOST_HOF_TEST_CASE()
+{
+    // Unknown functions keep the strict left fold
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::fold(is_associative_test::digits_f())(1u, 2u, 3u, 4u) == ((1u * 10 - 2) * 10 - 3) * 10 - 4);
+    // A function marked as associative is reduced in a tree
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::fold(is_associative_test::associative_digits_f())(1u, 2u, 3u, 4u) ==
+        boost::hof::tree_fold(is_associative_test::digits_f())(1u, 2u, 3u, 4u));
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::fold(is_associative_test::associative_digits_f())(1u, 2u, 3u, 4u) == (1u * 10 - 2) * 10 - (3u * 10 - 4));
+    // Only with unsigned integers of the same type
+    BOOST_HOF_TEST_CHECK(boost::hof::fold(is_associative_test::associative_digits_f())(1u, 2u, 3ul, 4u) == ((1u * 10 - 2) * 10 - 3) * 10 - 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The reverse fold is only reduced in a tree when the function is also
+    // commutative
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::reverse_fold(is_associative_test::associative_digits_f())(1u, 2u, 3u, 4u) ==
+        boost::hof::reverse_fold(is_associative_test::digits_f())(1u, 2u, 3u, 4u));
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::reverse_fold(is_associative_test::commutative_digits_f())(1u, 2u, 3u, 4u) ==
+        boost::hof::tree_fold(is_associative_test::digits_f())(1u, 2u, 3u, 4u));
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::reverse_fold(is_associative_test::commutative_digits_f(), 0u)(1u, 2u, 3u, 4u) ==
+        boost::hof::tree_fold(is_associative_test::digits_f(), 0u)(1u, 2u, 3u, 4u));
+
+    BOOST_HOF_TEST_CHECK(boost::hof::fold(std::plus<int>(), 0)(1, 2, 3, 4, 5) == 15);
+    BOOST_HOF_TEST_CHECK(boost::hof::reverse_fold(std::multiplies<int>())(1, 2, 3, 4, 5) == 120);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::reverse_fold(boost::hof::_ + boost::hof::_, 0)(1, 2, 3, 4, 5) == 15);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::reverse_fold(boost::hof::_ - boost::hof::_, 0)(1, 2, 3, 4) == -10);
+}
+
+// Signed sums and products are folded in order, since a tree could overflow
+static_assert(!boost::hof::detail::fold_reassociates<std::plus<int>, int, int, int, int>::value, "Reassociated");
+static_assert(!boost::hof::detail::reverse_fold_reassociates<std::plus<int>, int, int, int, int>::value, "Reassociated");
+static_assert(!boost::hof::detail::reverse_fold_reassociates<std::multiplies<long>, long, long, long, long>::value, "Reassociated");
+static_assert(!boost::hof::detail::reverse_fold_reassociates<boost::hof::operators::add, int, int, int, int>::value, "Reassociated");
+static_assert(boost::hof::detail::reverse_fold_reassociates<std::plus<unsigned>, unsigned, unsigned, unsigned, unsigned>::value, "Not reassociated");
+static_assert(boost::hof::detail::reverse_fold_reassociates<std::bit_xor<int>, int, int, int, int>::value, "Not reassociated");
+static_assert(boost::hof::detail::reverse_fold_reassociates<boost::hof::operators::bit_and, int, int, int, int>::value, "Not reassociated");
+
+BOOST_HOF_TEST_CASE()
+{
+    // The right fold doesn't overflow, but the tree would add 1 + INT_MAX
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::reverse_fold(boost::hof::_ + boost::hof::_)(1, INT_MAX, -10, 0, 0) == INT_MAX - 9);
+    BOOST_HOF_TEST_CHECK(boost::hof::reverse_fold(std::plus<int>())(1, INT_MAX, -10, 0, 0) == INT_MAX - 9);
+    BOOST_HOF_TEST_CHECK(boost::hof::fold(std::plus<int>())(0, 0, -10, INT_MAX, 1) == INT_MAX - 9);
+    BOOST_HOF_TEST_CHECK(boost::hof::reverse_fold(std::bit_or<int>())(1, 2, 4, 8, -16) == -1);
+}
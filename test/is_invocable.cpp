@@ -190,3 +190,28 @@ BOOST_HOF_STATIC_TEST_CASE()
     static_assert(!boost::hof::is_invocable<fp>::value, "Failed");
     static_assert(!boost::hof::is_invocable<fp, callable_rank<0>&>::value, "Failed");
 };
+
+struct lvalue_only_class
+{
+    void operator()(int) &
+    {
+    }
+};
+
+struct rvalue_only_class
+{
+    void operator()(int) &&
+    {
+    }
+};
+
+BOOST_HOF_STATIC_TEST_CASE()
+{
+    // The function is called as an lvalue, whatever reference it is given as
+    static_assert(boost::hof::is_invocable<lvalue_only_class, int>::value, "Failed");
+    static_assert(boost::hof::is_invocable<lvalue_only_class&&, int&&>::value, "Failed");
+    static_assert(!boost::hof::is_invocable<rvalue_only_class, int>::value, "Failed");
+    static_assert(!boost::hof::is_invocable<const lvalue_only_class&, int>::value, "Failed");
+    // The checks that only differ by value and rvalue reference are shared
+    STATIC_ASSERT_SAME(boost::hof::detail::can_be_called<lvalue_only_class&, int>, boost::hof::detail::can_be_called<lvalue_only_class&, int&&>);
+};
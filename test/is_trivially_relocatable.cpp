@@ -0,0 +1,110 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    is_trivially_relocatable.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/is_trivially_relocatable.hpp>
+#include <boost/hof.hpp>
+#include "test.hpp"
+
+namespace trivially_relocatable_test {
+
+struct sum
+{
+    int i;
+    template<class... Ts>
+    constexpr int operator()(int x, Ts...) const
+    {
+        return x + i;
+    }
+};
+
+struct twice
+{
+    int i;
+    template<class... Ts>
+    constexpr int operator()(int x, int y, Ts...) const
+    {
+        return (x + y)*i;
+    }
+};
+
+struct counted
+{
+    int i;
+    counted(int x) : i(x)
+    {}
+    counted(const counted& rhs) : i(rhs.i)
+    {}
+    template<class... Ts>
+    int operator()(int x, Ts...) const
+    {
+        return x + i;
+    }
+};
+
+template<class T>
+struct trivial
+: std::integral_constant<bool, (
+    boost::hof::is_trivially_relocatable<T>::value && 
+    std::is_trivially_copyable<T>::value && 
+    std::is_trivially_destructible<T>::value
+)>
+{};
+
+#define CHECK_TRIVIAL(...) \
+    static_assert(trivial<typename std::decay<decltype(__VA_ARGS__)>::type>::value, "Not trivially relocatable"); \
+    static_assert(!boost::hof::is_trivially_relocatable<decltype(boost::hof::combine(counted(1), __VA_ARGS__))>::value, "Trivially relocatable")
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace trivially_relocatable_test;
+    typedef sum s;
+    int x = 0;
+    CHECK_TRIVIAL(boost::hof::always(1));
+    CHECK_TRIVIAL(boost::hof::always_ref(x));
+    CHECK_TRIVIAL(boost::hof::apply);
+    CHECK_TRIVIAL(boost::hof::capture(1, 2)(s{1}));
+    CHECK_TRIVIAL(boost::hof::compose(s{1}, s{2}));
+    CHECK_TRIVIAL(boost::hof::combine(s{1}, s{2}));
+    CHECK_TRIVIAL(boost::hof::decorate(s{1})(1)(s{2}));
+    CHECK_TRIVIAL(boost::hof::drop<0>(s{1}));
+    CHECK_TRIVIAL(boost::hof::first_of(s{1}, s{2}));
+    CHECK_TRIVIAL(boost::hof::fix(s{1}));
+    CHECK_TRIVIAL(boost::hof::flip(s{1}));
+    CHECK_TRIVIAL(boost::hof::flow(s{1}, s{2}));
+    CHECK_TRIVIAL(boost::hof::fold(s{1}));
+    CHECK_TRIVIAL(boost::hof::if_(std::true_type())(s{1}));
+    CHECK_TRIVIAL(boost::hof::indirect(&x));
+    CHECK_TRIVIAL(boost::hof::infix(s{1}));
+    CHECK_TRIVIAL(1 < boost::hof::infix(s{1}));
+    CHECK_TRIVIAL(boost::hof::lazy(s{1}));
+    CHECK_TRIVIAL(boost::hof::lazy(s{1})(1, boost::hof::_1));
+    CHECK_TRIVIAL(boost::hof::limit_c<2>(s{1}));
+    CHECK_TRIVIAL(boost::hof::match(s{1}, twice{2}));
+    CHECK_TRIVIAL(boost::hof::mutable_(s{1}));
+    CHECK_TRIVIAL(boost::hof::pack(1, s{1}));
+    CHECK_TRIVIAL(boost::hof::partial(s{1}));
+    CHECK_TRIVIAL(boost::hof::partial(s{1})(1));
+    CHECK_TRIVIAL(boost::hof::permute<1, 0>(s{1}));
+    CHECK_TRIVIAL(boost::hof::pipable(s{1}));
+    CHECK_TRIVIAL(boost::hof::pipable(s{1})(1));
+    CHECK_TRIVIAL(boost::hof::proj(s{1}, s{2}));
+    CHECK_TRIVIAL(boost::hof::protect(s{1}));
+    CHECK_TRIVIAL(boost::hof::repeat(2)(s{1}));
+    CHECK_TRIVIAL(boost::hof::result<int>(s{1}));
+    CHECK_TRIVIAL(boost::hof::reveal(s{1}));
+    CHECK_TRIVIAL(boost::hof::rotate(s{1}));
+    CHECK_TRIVIAL(boost::hof::select<1, 0>(s{1}));
+    CHECK_TRIVIAL(boost::hof::unpack(s{1}));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(boost::hof::is_trivially_relocatable<int>::value, "Not trivially relocatable");
+    static_assert(!boost::hof::is_trivially_relocatable<trivially_relocatable_test::counted>::value, "Trivially relocatable");
+    static_assert(!boost::hof::is_trivially_relocatable<decltype(boost::hof::pack(trivially_relocatable_test::counted(1)))>::value, "Trivially relocatable");
+}
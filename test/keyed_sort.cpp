@@ -0,0 +1,68 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    keyed_sort.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/keyed_sort.hpp>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "test.hpp"
+
+namespace keyed_sort_test {
+
+struct counted_length
+{
+    int* calls;
+
+    std::size_t operator()(const std::string& s) const
+    {
+        (*calls)++;
+        return s.size();
+    }
+};
+
+struct deref
+{
+    int operator()(const std::unique_ptr<int>& p) const
+    {
+        return *p;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace keyed_sort_test;
+    int calls = 0;
+    std::vector<std::string> v = { "dddd", "a", "ccc", "bb", "eeeee", "" };
+    boost::hof::keyed_sort(counted_length{&calls}, std::greater<std::size_t>())(v);
+    // Each key is computed once
+    BOOST_HOF_TEST_CHECK(calls == 6);
+    std::vector<std::string> expected = { "eeeee", "dddd", "ccc", "bb", "a", "" };
+    BOOST_HOF_TEST_CHECK(v == expected);
+
+    std::vector<std::string> empty;
+    boost::hof::keyed_sort(counted_length{&calls}, std::less<std::size_t>())(empty.begin(), empty.end());
+    BOOST_HOF_TEST_CHECK(calls == 6);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace keyed_sort_test;
+    std::vector<int> keys = { 5, 3, 9, 1, 7, 3, 0, 8, 2, 6 };
+    std::vector<std::unique_ptr<int>> v;
+    for (int k : keys) v.push_back(std::unique_ptr<int>(new int(k)));
+    std::unique_ptr<int> a[] = { std::unique_ptr<int>(new int(2)), std::unique_ptr<int>(new int(1)) };
+
+    boost::hof::keyed_sort(deref(), std::less<int>())(v);
+    std::sort(keys.begin(), keys.end());
+    for (std::size_t i = 0; i < v.size(); i++) BOOST_HOF_TEST_CHECK(*v[i] == keys[i]);
+
+    boost::hof::keyed_sort(deref(), std::less<int>())(a);
+    BOOST_HOF_TEST_CHECK(*a[0] == 1 && *a[1] == 2);
+}
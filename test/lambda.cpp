@@ -57,6 +57,10 @@ BOOST_HOF_STATIC_LAMBDA_FUNCTION(add_one) = [](int x)
 BOOST_HOF_TEST_CASE()
 {
     BOOST_HOF_TEST_CHECK(add_one(2) == 3);
+// Without the wrapper, the lambda is called directly
+#if BOOST_HOF_HAS_INLINE_LAMBDAS
+    BOOST_HOF_STATIC_TEST_CHECK(add_one(2) == 3);
+#endif
 }
 
 BOOST_HOF_STATIC_LAMBDA_FUNCTION(sum_partial) = boost::hof::partial([](int x, int y)
@@ -71,6 +75,9 @@ BOOST_HOF_TEST_CASE()
 #endif
     BOOST_HOF_TEST_CHECK(3 == sum_partial(1, 2));
     BOOST_HOF_TEST_CHECK(3 == sum_partial(1)(2));
+#if BOOST_HOF_HAS_INLINE_LAMBDAS
+    BOOST_HOF_STATIC_TEST_CHECK(3 == sum_partial(1)(2));
+#endif
 }
 
 BOOST_HOF_STATIC_LAMBDA_FUNCTION(add_one_pipable) = boost::hof::pipable([](int x)
@@ -711,3 +711,17 @@ BOOST_HOF_TEST_CASE()
     static_assert(noexcept(boost::hof::lazy(&member_obj::x)(std::placeholders::_1)(obj)), "noexcept lazy");
 }
 #endif
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace std::placeholders;
+    using boost::hof::lazy;
+    int i = 3;
+    auto f = lazy(binary_class())(lazy(binary_class())(_1, std::ref(i)), lazy(binary_class())(_2, 1));
+    BOOST_HOF_TEST_CHECK(f(1, 2) == 1 + 3 + 2 + 1);
+    i = 4;
+    BOOST_HOF_TEST_CHECK(f(1, 2) == 1 + 4 + 2 + 1);
+    BOOST_HOF_STATIC_TEST_CHECK(lazy(binary_class())(lazy(binary_class())(_1, 1), lazy(binary_class())(_2, _1))(1, 2) == 1 + 1 + 2 + 1);
+    static_assert(boost::hof::detail::lazy_kind<decltype(lazy(binary_class())(_1, 1))>::value == 1, "Nested lazy expressions are not flattened");
+    static_assert(boost::hof::detail::lazy_kind<decltype(std::bind(binary_class(), 1, 2))>::value == 2, "Bind expressions are not called");
+}
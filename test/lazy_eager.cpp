@@ -0,0 +1,72 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    lazy_eager.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/lazy_eager.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <functional>
+#include "test.hpp"
+
+namespace lazy_eager_test {
+
+struct counted
+{
+    int* count;
+    int operator()() const
+    {
+        ++*count;
+        return 5;
+    }
+};
+
+struct seven
+{
+    constexpr int operator()() const
+    {
+        return 7;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::lazy_eager(binary_class())(1, 2)() == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::lazy_eager(binary_class())(boost::hof::_1, 2)(1) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::lazy_eager(lazy_eager_test::seven())()() == 7);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::lazy_eager(binary_class())(
+        boost::hof::lazy(binary_class())(boost::hof::lazy(lazy_eager_test::seven())(), 1), boost::hof::_1)(2) == 10);
+    BOOST_HOF_TEST_CHECK(boost::hof::lazy_eager(binary_class())(boost::hof::lazy(binary_class())(boost::hof::_1, 1), 2)(1) == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The expression without placeholders is evaluated once
+    int count = 0;
+    auto f = boost::hof::lazy_eager(boost::hof::_1 < boost::hof::_2)(boost::hof::lazy(lazy_eager_test::counted{&count})(), boost::hof::_1);
+    BOOST_HOF_TEST_CHECK(count == 1);
+    BOOST_HOF_TEST_CHECK(f(6));
+    BOOST_HOF_TEST_CHECK(!f(4));
+    BOOST_HOF_TEST_CHECK(count == 1);
+    // The lazy adaptor evaluates it on every call
+    auto g = boost::hof::lazy(boost::hof::_1 < boost::hof::_2)(boost::hof::lazy(lazy_eager_test::counted{&count})(), boost::hof::_1);
+    BOOST_HOF_TEST_CHECK(g(6));
+    BOOST_HOF_TEST_CHECK(!g(4));
+    BOOST_HOF_TEST_CHECK(count == 3);
+    // A std::bind expression is kept
+    auto h = boost::hof::lazy_eager(binary_class())(std::bind(lazy_eager_test::counted{&count}), boost::hof::_1);
+    BOOST_HOF_TEST_CHECK(count == 3);
+    BOOST_HOF_TEST_CHECK(h(1) == 6);
+    BOOST_HOF_TEST_CHECK(count == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    typedef decltype(boost::hof::lazy(binary_class())(boost::hof::lazy(lazy_eager_test::seven())(), 1)) constant_expression;
+    typedef decltype(boost::hof::lazy(binary_class())(boost::hof::lazy(binary_class())(boost::hof::_1, 1), 1)) dependent_expression;
+    static_assert(boost::hof::detail::lazy_is_hoisted<constant_expression>::value, "Constant expression is not hoisted");
+    static_assert(!boost::hof::detail::lazy_is_hoisted<dependent_expression>::value, "Dependent expression is hoisted");
+    static_assert(!boost::hof::detail::lazy_is_hoisted<int>::value, "Value is hoisted");
+}
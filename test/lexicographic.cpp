@@ -0,0 +1,134 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    lexicographic.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/lexicographic.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <boost/hof/pack.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "test.hpp"
+
+namespace lexicographic_test {
+
+// Counts the calls, so the fields after the first that differs can be
+// checked to not be compared
+struct counted_less
+{
+    int* calls;
+
+    template<class T>
+    bool operator()(const T& x, const T& y) const
+    {
+        ++*calls;
+        return x < y;
+    }
+};
+
+struct point
+{
+    int x;
+    int y;
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    typedef std::tuple<int, std::string, double> row;
+    BOOST_HOF_TEST_CHECK(boost::hof::lexicographic()(row(1, "b", 0.0), row(2, "a", 0.0)));
+    BOOST_HOF_TEST_CHECK(boost::hof::lexicographic()(row(1, "a", 1.0), row(1, "b", 0.0)));
+    BOOST_HOF_TEST_CHECK(boost::hof::lexicographic()(row(1, "a", 0.0), row(1, "a", 1.0)));
+    BOOST_HOF_TEST_CHECK(!boost::hof::lexicographic()(row(1, "a", 1.0), row(1, "a", 1.0)));
+    BOOST_HOF_TEST_CHECK(!boost::hof::lexicographic()(row(2, "a", 0.0), row(1, "b", 1.0)));
+    BOOST_HOF_TEST_CHECK(!boost::hof::lexicographic()(std::make_tuple(), std::make_tuple()));
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::lexicographic()(std::make_tuple(1, 2), std::make_tuple(1, 3)));
+    BOOST_HOF_STATIC_TEST_CHECK(!boost::hof::lexicographic()(std::make_tuple(1, 3), std::make_tuple(1, 2)));
+}
+
+// A comparator for each field
+BOOST_HOF_TEST_CASE()
+{
+    auto cmp = boost::hof::lexicographic(std::greater<int>(), std::less<std::string>());
+    BOOST_HOF_TEST_CHECK(cmp(std::make_tuple(2, std::string("b")), std::make_tuple(1, std::string("a"))));
+    BOOST_HOF_TEST_CHECK(cmp(std::make_tuple(1, std::string("a")), std::make_tuple(1, std::string("b"))));
+    BOOST_HOF_TEST_CHECK(!cmp(std::make_tuple(1, std::string("a")), std::make_tuple(1, std::string("a"))));
+    BOOST_HOF_TEST_CHECK(cmp(boost::hof::pack(2, std::string("a")), boost::hof::pack(1, std::string("a"))));
+    BOOST_HOF_TEST_CHECK(boost::hof::lexicographic(std::less<int>(), std::greater<int>())(std::make_tuple(1, 2), std::make_tuple(1, 1)));
+    // The sequences need a field for each comparator
+    BOOST_HOF_STATIC_TEST_CHECK(!boost::hof::is_invocable<decltype(cmp), std::tuple<int>, std::tuple<int>>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!boost::hof::is_invocable<decltype(boost::hof::lexicographic()), std::tuple<int>, std::tuple<int, int>>::value);
+}
+
+// The fields after the first that differs aren't compared
+BOOST_HOF_TEST_CASE()
+{
+    int calls = 0;
+    lexicographic_test::counted_less c{&calls};
+    auto cmp = boost::hof::lexicographic(c, c, c);
+    BOOST_HOF_TEST_CHECK(cmp(std::make_tuple(1, 5, 5), std::make_tuple(2, 0, 0)));
+    BOOST_HOF_TEST_CHECK(calls == 1);
+    calls = 0;
+    BOOST_HOF_TEST_CHECK(!cmp(std::make_tuple(1, 2, 5), std::make_tuple(1, 1, 0)));
+    BOOST_HOF_TEST_CHECK(calls == 4);
+    calls = 0;
+    BOOST_HOF_TEST_CHECK(!cmp(std::make_tuple(1, 1, 1), std::make_tuple(1, 1, 1)));
+    BOOST_HOF_TEST_CHECK(calls == 6);
+}
+
+// The unsigned fields are compared as a single wide key
+BOOST_HOF_TEST_CASE()
+{
+    typedef boost::hof::detail::lex_fields<std::uint32_t, std::uint16_t, std::uint8_t, bool> small;
+    BOOST_HOF_STATIC_TEST_CHECK(std::is_same<boost::hof::detail::lex_key_type<small>::type, std::uint64_t>::value);
+    typedef boost::hof::detail::lex_fields<std::uint32_t, int> mixed;
+    BOOST_HOF_STATIC_TEST_CHECK(std::is_void<boost::hof::detail::lex_key_type<mixed>::type>::value);
+    typedef boost::hof::detail::lex_fields<std::uint64_t, std::uint64_t, std::uint8_t> wide;
+    BOOST_HOF_STATIC_TEST_CHECK(std::is_void<boost::hof::detail::lex_key_type<wide>::type>::value);
+
+    typedef std::tuple<std::uint32_t, std::uint16_t, std::uint8_t> key;
+    std::vector<key> v;
+    for (unsigned i = 0; i < 4; i++)
+        for (unsigned j = 0; j < 4; j++)
+            for (unsigned k = 0; k < 4; k++)
+                v.push_back(key(0xFFFFFFF0u + (i * 7 % 4), std::uint16_t(0xFFF0u + (j * 3 % 4)), std::uint8_t(0xF0u + k)));
+    std::vector<key> expected = v;
+    std::sort(expected.begin(), expected.end());
+    std::sort(v.begin(), v.end(), boost::hof::lexicographic());
+    BOOST_HOF_TEST_CHECK(v == expected);
+    for (std::size_t i = 0; i < v.size(); i++)
+    {
+        for (std::size_t j = 0; j < v.size(); j++)
+            BOOST_HOF_TEST_CHECK(boost::hof::lexicographic()(v[i], v[j]) == (v[i] < v[j]));
+    }
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::lexicographic()(std::make_tuple(1u, 2u), std::make_tuple(2u, 1u)));
+#ifdef __SIZEOF_INT128__
+    typedef std::tuple<std::uint64_t, std::uint64_t> pair_key;
+    BOOST_HOF_STATIC_TEST_CHECK(!std::is_same<boost::hof::detail::lex_key_type<boost::hof::detail::lex_fields<std::uint64_t, std::uint64_t>>::type, void>::value);
+    BOOST_HOF_TEST_CHECK(boost::hof::lexicographic()(pair_key(1, ~0ull), pair_key(2, 0)));
+    BOOST_HOF_TEST_CHECK(!boost::hof::lexicographic()(pair_key(2, 0), pair_key(1, ~0ull)));
+    BOOST_HOF_TEST_CHECK(boost::hof::lexicographic()(pair_key(~0ull, 1), pair_key(~0ull, 2)));
+#endif
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    typedef std::tuple<int, std::string> row;
+    std::vector<row> v = { row(2, "a"), row(1, "b"), row(2, "c"), row(1, "a") };
+    std::sort(v.begin(), v.end(), boost::hof::lexicographic(std::greater<int>(), std::less<std::string>()));
+    BOOST_HOF_TEST_CHECK((v == std::vector<row>{ row(2, "a"), row(2, "c"), row(1, "a"), row(1, "b") }));
+#if BOOST_HOF_HAS_STD_17 && defined(__cpp_structured_bindings)
+    std::vector<lexicographic_test::point> p = { {2, 1}, {1, 2}, {1, 1} };
+    std::sort(p.begin(), p.end(), boost::hof::lexicographic());
+    BOOST_HOF_TEST_CHECK(p[0].x == 1 && p[0].y == 1);
+    BOOST_HOF_TEST_CHECK(p[1].x == 1 && p[1].y == 2);
+    BOOST_HOF_TEST_CHECK(p[2].x == 2 && p[2].y == 1);
+#endif
+}
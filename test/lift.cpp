@@ -8,8 +8,10 @@
 #include <boost/hof/lift.hpp>
 #include <boost/hof/function.hpp>
 #include <boost/hof/detail/move.hpp>
+#include <string>
 #include <tuple>
 #include <algorithm>
+#include <functional>
 
 template<class T, class U>
 constexpr T sum(T x, U y) BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(x+y)
@@ -56,3 +58,57 @@ BOOST_HOF_TEST_CASE()
     BOOST_HOF_TEST_CHECK(psum(1, 2) == 3);
 }
 #endif
+
+#if BOOST_HOF_HAS_AUTO_TEMPLATE_PARAMETER
+namespace lift_test {
+
+constexpr int twice(int x)
+{
+    return 2 * x;
+}
+
+inline std::string append(std::string s, const std::string& t) noexcept
+{
+    return s + t;
+}
+
+struct point
+{
+    int x;
+    constexpr int get_x() const
+    {
+        return x;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::lift<&lift_test::twice>(3) == 6);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::lift<&lift_test::twice>(3) == 6);
+    BOOST_HOF_TEST_CHECK(boost::hof::lift<&lift_test::append>(std::string("a"), std::string("b")) == "ab");
+    static_assert(std::is_same<decltype(boost::hof::lift<&sum<int, int>>(1, 2)), int>::value, "lift result");
+    BOOST_HOF_TEST_CHECK(boost::hof::lift<&sum<int, int>>(1, 2) == 3);
+#if defined(__cpp_noexcept_function_type)
+    static_assert(noexcept(boost::hof::lift<&lift_test::append>(std::string(), std::string())), "noexcept lift");
+    static_assert(!noexcept(boost::hof::lift<&lift_test::twice>(1)), "noexcept lift");
+#endif
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    lift_test::point p{4};
+    BOOST_HOF_TEST_CHECK(boost::hof::lift<&lift_test::point::get_x>(p) == 4);
+    BOOST_HOF_TEST_CHECK(boost::hof::lift<&lift_test::point::x>(p) == 4);
+    BOOST_HOF_TEST_CHECK(boost::hof::lift<&lift_test::point::x>(&p) == 4);
+    BOOST_HOF_TEST_CHECK(boost::hof::lift<&lift_test::point::get_x>(&p) == 4);
+    BOOST_HOF_TEST_CHECK(boost::hof::lift<&lift_test::point::x>(std::ref(p)) == 4);
+    STATIC_ASSERT_SAME(decltype(boost::hof::lift<&lift_test::point::x>(p)), int&);
+    STATIC_ASSERT_SAME(decltype(boost::hof::lift<&lift_test::point::x>(lift_test::point{4})), int&&);
+    STATIC_ASSERT_SAME(decltype(boost::hof::lift<&lift_test::point::x>(static_cast<const lift_test::point&>(p))), const int&);
+    static_assert(std::is_empty<decltype(boost::hof::lift<&lift_test::point::x>)>::value, "Not empty");
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::lift<&lift_test::point::x>(lift_test::point{5}) == 5);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::lift<&lift_test::point::get_x>(lift_test::point{5}) == 5);
+}
+#endif
@@ -0,0 +1,134 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    make_table.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/make_table.hpp>
+#include <boost/hof/compose.hpp>
+#include <cstdint>
+#include "test.hpp"
+
+namespace make_table_test {
+
+struct popcount
+{
+    constexpr int operator()(unsigned x) const
+    {
+        return x == 0 ? 0 : int(x & 1) + (*this)(x >> 1);
+    }
+};
+
+struct square
+{
+    constexpr long operator()(long x) const
+    {
+        return x * x;
+    }
+};
+
+struct crc_step
+{
+    constexpr std::uint32_t operator()(std::uint32_t c) const
+    {
+        return (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+    }
+};
+
+struct crc_entry
+{
+    constexpr std::uint32_t step(std::uint32_t c, int n) const
+    {
+        return n == 0 ? c : step(crc_step()(c), n - 1);
+    }
+
+    constexpr std::uint32_t operator()(std::uint32_t i) const
+    {
+        return step(i, 8);
+    }
+};
+
+struct counted
+{
+    int* calls;
+    long operator()(long x) const
+    {
+        ++*calls;
+        return x + 1;
+    }
+};
+
+struct index_type
+{
+    template<class T>
+    constexpr int operator()(T) const
+    {
+        return std::is_integral<T>::value ? 0 : 1;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace make_table_test;
+    auto table = boost::hof::make_table<8>(popcount());
+    STATIC_ASSERT_SAME(decltype(table), std::array<int, 8>);
+    for(unsigned i = 0; i < 8; i++) BOOST_HOF_TEST_CHECK(table[i] == popcount()(i));
+    BOOST_HOF_TEST_CHECK(boost::hof::make_table<8>(index_type())[3] == 1);
+    BOOST_HOF_TEST_CHECK(boost::hof::make_table<0>(popcount()).empty());
+}
+
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+BOOST_HOF_TEST_CASE()
+{
+    using namespace make_table_test;
+    constexpr auto table = boost::hof::make_table<256>(popcount());
+    static_assert(table[0] == 0, "");
+    static_assert(table[7] == 3, "");
+    static_assert(table[255] == 8, "");
+
+    constexpr auto crc = boost::hof::make_table<256>(crc_entry());
+    static_assert(crc[1] == 0x77073096u, "");
+    static_assert(crc[255] == 0x2D02EF8Du, "");
+
+    constexpr auto count = boost::hof::tabulated<16>(popcount());
+    static_assert(count(15) == 4, "");
+    static_assert(count(1024) == 1, "");
+}
+#endif
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace make_table_test;
+    auto f = boost::hof::tabulated<16>(square());
+    BOOST_HOF_TEST_CHECK(f(0) == 0);
+    BOOST_HOF_TEST_CHECK(f(15) == 225);
+    BOOST_HOF_TEST_CHECK(f(16) == 256);
+    BOOST_HOF_TEST_CHECK(f(-3) == 9);
+    BOOST_HOF_TEST_CHECK(f(char(4)) == 16);
+    BOOST_HOF_TEST_CHECK(f(std::size_t(5)) == 25);
+    BOOST_HOF_TEST_CHECK(f(true) == 1);
+    STATIC_ASSERT_SAME(decltype(f(1)), long);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace make_table_test;
+    int calls = 0;
+    auto f = boost::hof::tabulated<4>(counted{&calls});
+    BOOST_HOF_TEST_CHECK(calls == 4);
+    BOOST_HOF_TEST_CHECK(f(2) == 3);
+    BOOST_HOF_TEST_CHECK(f(3) == 4);
+    BOOST_HOF_TEST_CHECK(calls == 4);
+    BOOST_HOF_TEST_CHECK(f(10) == 11);
+    BOOST_HOF_TEST_CHECK(calls == 5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace make_table_test;
+    auto f = boost::hof::tabulated<8>(boost::hof::compose(square(), square()));
+    BOOST_HOF_TEST_CHECK(f(3) == 81);
+    BOOST_HOF_TEST_CHECK(f(10) == 10000);
+}
@@ -0,0 +1,59 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    map.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/map.hpp>
+#include <boost/hof/fold_into.hpp>
+#include <boost/hof/placeholders.hpp>
+#include "test.hpp"
+
+#include <string>
+#include <vector>
+
+namespace map_test {
+
+struct append
+{
+    std::string operator()(std::string s, const std::string& x) const
+    {
+        return s + x;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> v = { 1, 2, 3 };
+    BOOST_HOF_TEST_CHECK((v | boost::hof::map(boost::hof::_ * 2) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0)) == 12);
+    BOOST_HOF_TEST_CHECK(boost::hof::fold_into(boost::hof::map(v, boost::hof::_ * 2), boost::hof::_ + boost::hof::_, 0) == 12);
+    BOOST_HOF_TEST_CHECK((v | boost::hof::map(boost::hof::_ + 1) | boost::hof::map(boost::hof::_ * 2) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0)) == 18);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // An rvalue range is moved into the view, so the view can be kept
+    auto view = std::vector<int>{ 1, 2, 3 } | boost::hof::map(boost::hof::_ + 1);
+    BOOST_HOF_TEST_CHECK((view | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0)) == 9);
+    BOOST_HOF_TEST_CHECK((view | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0)) == 9);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // An lvalue range is referred to by the view
+    std::vector<int> v = { 1, 2, 3 };
+    auto view = v | boost::hof::map(boost::hof::_ * 10);
+    v[0] = 4;
+    BOOST_HOF_TEST_CHECK((view | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0)) == 90);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> v = { 1, 2, 3 };
+    auto r = v | boost::hof::map([](int x) { return std::to_string(x); }) | boost::hof::fold_into(map_test::append(), std::string());
+    BOOST_HOF_TEST_CHECK(r == "123");
+    int a[] = { 1, 2, 3 };
+    BOOST_HOF_TEST_CHECK((a | boost::hof::map(boost::hof::_ * 2) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0)) == 12);
+}
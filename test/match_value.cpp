@@ -0,0 +1,172 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    match_value.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/match_value.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <climits>
+#include <stdexcept>
+#include <string>
+#include "test.hpp"
+
+namespace match_value_test {
+
+template<int Id>
+struct id
+{
+    template<class... Ts>
+    int operator()(Ts&&...) const
+    {
+        return Id;
+    }
+};
+
+struct counted_even
+{
+    int* probes;
+
+    template<class T>
+    bool operator()(T x) const
+    {
+        ++*probes;
+        return x % 2 == 0;
+    }
+};
+
+}
+
+using boost::hof::_1;
+using boost::hof::_2;
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::match_value(
+        boost::hof::case_(_1 == 3)(match_value_test::id<1>()),
+        boost::hof::case_(_1 > 10, _1 < 20)(match_value_test::id<2>()),
+        boost::hof::case_(_1 <= -5)(match_value_test::id<3>()),
+        match_value_test::id<0>()
+    );
+    BOOST_HOF_TEST_CHECK(f(3) == 1);
+    BOOST_HOF_TEST_CHECK(f(11) == 2);
+    BOOST_HOF_TEST_CHECK(f(19) == 2);
+    BOOST_HOF_TEST_CHECK(f(10) == 0);
+    BOOST_HOF_TEST_CHECK(f(20) == 0);
+    BOOST_HOF_TEST_CHECK(f(-5) == 3);
+    BOOST_HOF_TEST_CHECK(f(INT_MIN) == 3);
+    BOOST_HOF_TEST_CHECK(f(-4) == 0);
+    BOOST_HOF_TEST_CHECK(f(INT_MAX) == 0);
+    BOOST_HOF_TEST_CHECK(f(3L) == 1);
+    BOOST_HOF_TEST_CHECK(f('\3') == 1);
+}
+
+// The first case is called when the patterns overlap
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::match_value(
+        boost::hof::case_(_1 >= 0, _1 < 100)(match_value_test::id<1>()),
+        boost::hof::case_(_1 == 50)(match_value_test::id<2>()),
+        boost::hof::case_(100 <= _1)(match_value_test::id<3>()),
+        match_value_test::id<0>()
+    );
+    BOOST_HOF_TEST_CHECK(f(50) == 1);
+    BOOST_HOF_TEST_CHECK(f(0) == 1);
+    BOOST_HOF_TEST_CHECK(f(99) == 1);
+    BOOST_HOF_TEST_CHECK(f(100) == 3);
+    BOOST_HOF_TEST_CHECK(f(-1) == 0);
+}
+
+// Only the patterns that aren't in the table and come before the case are checked
+BOOST_HOF_TEST_CASE()
+{
+    int probes = 0;
+    auto f = boost::hof::match_value(
+        boost::hof::case_(_1 == 1)(match_value_test::id<1>()),
+        boost::hof::case_(match_value_test::counted_even{&probes})(match_value_test::id<2>()),
+        boost::hof::case_(_1 == 4)(match_value_test::id<3>()),
+        boost::hof::case_(_1 == 5)(match_value_test::id<4>()),
+        match_value_test::id<0>()
+    );
+    BOOST_HOF_TEST_CHECK(f(1) == 1);
+    BOOST_HOF_TEST_CHECK(probes == 0);
+    BOOST_HOF_TEST_CHECK(f(4) == 2);
+    BOOST_HOF_TEST_CHECK(probes == 1);
+    BOOST_HOF_TEST_CHECK(f(5) == 4);
+    BOOST_HOF_TEST_CHECK(probes == 2);
+    BOOST_HOF_TEST_CHECK(f(7) == 0);
+    BOOST_HOF_TEST_CHECK(probes == 3);
+}
+
+// A negative value isn't compared with an unsigned constant in the table
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::match_value(
+        boost::hof::case_(_1 > 5u)(match_value_test::id<1>()),
+        match_value_test::id<0>()
+    );
+    BOOST_HOF_TEST_CHECK(f(6u) == 1);
+    BOOST_HOF_TEST_CHECK(f(5u) == 0);
+    BOOST_HOF_TEST_CHECK(f(6LL) == 1);
+    BOOST_HOF_TEST_CHECK(f(-1LL) == 0);
+}
+
+// Values that don't fit in the table are checked in order
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::match_value(
+        boost::hof::case_(_1 == ULLONG_MAX)(match_value_test::id<1>()),
+        boost::hof::case_(_1 > 10ull)(match_value_test::id<2>()),
+        match_value_test::id<0>()
+    );
+    BOOST_HOF_TEST_CHECK(f(ULLONG_MAX) == 1);
+    BOOST_HOF_TEST_CHECK(f(ULLONG_MAX - 1) == 2);
+    BOOST_HOF_TEST_CHECK(f(11ull) == 2);
+    BOOST_HOF_TEST_CHECK(f(1ull) == 0);
+}
+
+// Patterns on other arguments, and arguments that aren't integers
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::match_value(
+        boost::hof::case_(_2 == 1)(match_value_test::id<1>()),
+        boost::hof::case_(_1 == 2)(match_value_test::id<2>()),
+        match_value_test::id<0>()
+    );
+    BOOST_HOF_TEST_CHECK(f(2, 1) == 1);
+    BOOST_HOF_TEST_CHECK(f(2, 0) == 2);
+    BOOST_HOF_TEST_CHECK(f(2.0, 0) == 2);
+    BOOST_HOF_TEST_CHECK(f(2.5, 0) == 0);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::match_value(
+        boost::hof::case_(_1 == 1)(match_value_test::id<1>()),
+        boost::hof::case_(_1 == 2)([](int x) { return x * 10; })
+    );
+    BOOST_HOF_TEST_CHECK(f(1) == 1);
+    BOOST_HOF_TEST_CHECK(f(2) == 20);
+    bool thrown = false;
+    try
+    {
+        f(3);
+    }
+    catch (const std::out_of_range&)
+    {
+        thrown = true;
+    }
+    BOOST_HOF_TEST_CHECK(thrown);
+    auto g = f;
+    BOOST_HOF_TEST_CHECK(g(2) == 20);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::match_value(
+        boost::hof::case_(_1 == 0)([](int) { return std::string("zero"); }),
+        [](int) { return std::string("other"); }
+    );
+    BOOST_HOF_TEST_CHECK(f(0) == "zero");
+    BOOST_HOF_TEST_CHECK(f(1) == "other");
+}
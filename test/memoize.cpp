@@ -0,0 +1,228 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    memoize.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/memoize.hpp>
+#include <boost/hof/fix.hpp>
+#include <boost/hof/result.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include "test.hpp"
+
+#include <boost/hof/static.hpp>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct counted_add
+{
+    std::shared_ptr<int> count;
+    counted_add() : count(std::make_shared<int>(0))
+    {}
+
+    template<class T, class U>
+    T operator()(T x, U y) const
+    {
+        ++*count;
+        return x + y;
+    }
+};
+
+struct counted_fib
+{
+    std::shared_ptr<int> count;
+    counted_fib() : count(std::make_shared<int>(0))
+    {}
+
+    template<class Self>
+    long long operator()(Self self, int n) const
+    {
+        ++*count;
+        return n < 2 ? n : self(n - 1) + self(n - 2);
+    }
+};
+
+struct fib_auto
+{
+    template<class Self>
+    long long operator()(Self self, int n) const
+    {
+        return n < 2 ? n : self(n - 1) + self(n - 2);
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    counted_add f;
+    auto m = boost::hof::memoize(f);
+    BOOST_HOF_TEST_CHECK(m(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(m(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(*f.count == 1);
+    BOOST_HOF_TEST_CHECK(m(2, 2) == 4);
+    BOOST_HOF_TEST_CHECK(*f.count == 2);
+    // Different argument types use a different cache
+    BOOST_HOF_TEST_CHECK(m(1.5, 2) == 3.5);
+    BOOST_HOF_TEST_CHECK(m(1.5, 2) == 3.5);
+    BOOST_HOF_TEST_CHECK(*f.count == 3);
+    // Copies share the cache
+    auto m2 = m;
+    BOOST_HOF_TEST_CHECK(m2(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(*f.count == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    counted_add f;
+    auto m = boost::hof::memoize(f);
+    std::string s = "hello";
+    BOOST_HOF_TEST_CHECK(m(s, std::string(" world")) == "hello world");
+    BOOST_HOF_TEST_CHECK(m(std::string("hello"), std::string(" world")) == "hello world");
+    BOOST_HOF_TEST_CHECK(*f.count == 1);
+    BOOST_HOF_TEST_CHECK(s == "hello");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    counted_fib f;
+    auto fib = boost::hof::memoize(boost::hof::fix(f));
+    BOOST_HOF_TEST_CHECK(fib(80) == 23416728348467685);
+    BOOST_HOF_TEST_CHECK(*f.count == 81);
+    BOOST_HOF_TEST_CHECK(fib(80) == 23416728348467685);
+    BOOST_HOF_TEST_CHECK(*f.count == 81);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto fib = boost::hof::memoize(boost::hof::fix(fib_auto()));
+    BOOST_HOF_TEST_CHECK(fib(50) == 12586269025);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    counted_fib f;
+    auto fib = boost::hof::memoize(boost::hof::fix(f), boost::hof::memoize_direct_mapped<128>());
+    BOOST_HOF_TEST_CHECK(fib(80) == 23416728348467685);
+    BOOST_HOF_TEST_CHECK(*f.count == 81);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    counted_add f;
+    auto m = boost::hof::memoize(f, boost::hof::memoize_direct_mapped<1>());
+    BOOST_HOF_TEST_CHECK(m(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(m(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(*f.count == 1);
+    BOOST_HOF_TEST_CHECK(m(2, 2) == 4);
+    BOOST_HOF_TEST_CHECK(m(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(*f.count == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    counted_add f;
+    auto m = boost::hof::memoize(f, boost::hof::memoize_lru(2));
+    BOOST_HOF_TEST_CHECK(m(1, 1) == 2);
+    BOOST_HOF_TEST_CHECK(m(2, 2) == 4);
+    BOOST_HOF_TEST_CHECK(*f.count == 2);
+    // Touch the first entry so the second one is evicted
+    BOOST_HOF_TEST_CHECK(m(1, 1) == 2);
+    BOOST_HOF_TEST_CHECK(m(3, 3) == 6);
+    BOOST_HOF_TEST_CHECK(*f.count == 3);
+    BOOST_HOF_TEST_CHECK(m(1, 1) == 2);
+    BOOST_HOF_TEST_CHECK(*f.count == 3);
+    BOOST_HOF_TEST_CHECK(m(2, 2) == 4);
+    BOOST_HOF_TEST_CHECK(*f.count == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    counted_fib f;
+    auto fib = boost::hof::memoize(boost::hof::fix(f), boost::hof::memoize_lru(0));
+    BOOST_HOF_TEST_CHECK(fib(10) == 55);
+    BOOST_HOF_TEST_CHECK(*f.count == 177);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto m = boost::hof::memoize(counted_add());
+    decltype(m) d;
+    BOOST_HOF_TEST_CHECK(d(1, 2) == 3);
+    static_assert(boost::hof::is_invocable<decltype(m), int, int>::value, "Not invocable");
+    static_assert(!boost::hof::is_invocable<decltype(m), int>::value, "Invocable");
+}
+
+struct zero_f
+{
+    int operator()() const
+    {
+        return 5;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    auto m = boost::hof::memoize(zero_f());
+    BOOST_HOF_TEST_CHECK(m() == 5);
+    BOOST_HOF_TEST_CHECK(m() == 5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    counted_fib f;
+    boost::hof::memoize_sharded<4> storage;
+    auto fib = boost::hof::memoize(boost::hof::fix(f), storage);
+    BOOST_HOF_TEST_CHECK(fib(80) == 23416728348467685);
+    BOOST_HOF_TEST_CHECK(*f.count == 81);
+    BOOST_HOF_TEST_CHECK(fib(80) == 23416728348467685);
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    for (std::size_t i = 0; i < storage.shards(); i++)
+    {
+        hits += storage.hits(i);
+        misses += storage.misses(i);
+    }
+    BOOST_HOF_TEST_CHECK(misses == 81);
+    BOOST_HOF_TEST_CHECK(hits == 79);
+}
+
+struct atomic_counted_square
+{
+    template<class T>
+    T operator()(T x) const
+    {
+        ++count();
+        return x * x;
+    }
+
+    static std::atomic<int>& count()
+    {
+        static std::atomic<int> n(0);
+        return n;
+    }
+};
+
+static boost::hof::static_<boost::hof::memoize_adaptor<atomic_counted_square, boost::hof::memoize_sharded<>>> square = {};
+
+BOOST_HOF_TEST_CASE()
+{
+    std::atomic<bool> ok(true);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 1000; i++)
+            {
+                if (square(i % 100) != (i % 100) * (i % 100)) ok = false;
+                if (square(long(i % 10)) != long((i % 10) * (i % 10))) ok = false;
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    BOOST_HOF_TEST_CHECK(ok);
+    // Each key is computed at least once, and at most once per thread
+    BOOST_HOF_TEST_CHECK(atomic_counted_square::count() >= 110);
+    BOOST_HOF_TEST_CHECK(atomic_counted_square::count() <= 4 * 110);
+}
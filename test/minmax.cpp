@@ -0,0 +1,100 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    minmax.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/minmax.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "test.hpp"
+
+namespace minmax_test {
+
+// Equal keys with an id, so the element that is returned for a tie can be
+// checked
+struct keyed
+{
+    int key;
+    int id;
+
+    constexpr bool operator<(const keyed& rhs) const
+    {
+        return key < rhs.key;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_max(3, 1, 4, 1, 5, 9, 2, 6) == 9);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_min(3, 1, 4, 1, 5, 9, 2, 6) == 1);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_max(7) == 7);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_min(2.5, 1, 3) == 1.0);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_max(3, 1, 4) == 4);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_min(3, 1, 4) == 1);
+    BOOST_HOF_STATIC_TEST_CHECK(std::is_same<decltype(boost::hof::pack_max(1, 2.0)), double>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!boost::hof::is_invocable<decltype(boost::hof::pack_max)>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!boost::hof::is_invocable<decltype(boost::hof::pack_max), int, std::string>::value);
+}
+
+// The first of the equal elements is returned, like std::max and std::min
+BOOST_HOF_TEST_CASE()
+{
+    typedef minmax_test::keyed k;
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_max(k{1, 0}, k{2, 1}, k{2, 2}, k{0, 3}, k{2, 4}).id == 1);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_min(k{1, 0}, k{0, 1}, k{2, 2}, k{0, 3}, k{0, 4}).id == 1);
+    BOOST_HOF_TEST_CHECK(boost::hof::minmax(k{1, 0}, k{1, 1}, k{1, 2}).first.id == 0);
+    BOOST_HOF_TEST_CHECK(boost::hof::minmax(k{1, 0}, k{1, 1}, k{1, 2}).second.id == 0);
+}
+
+// Lvalues of the same type are returned by reference
+BOOST_HOF_TEST_CASE()
+{
+    int a = 1, b = 3, c = 2;
+    BOOST_HOF_STATIC_TEST_CHECK(std::is_same<decltype(boost::hof::pack_max(a, b, c)), int&>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(std::is_same<decltype(boost::hof::pack_max(a, b, 2)), int>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(std::is_same<decltype(boost::hof::pack_max(a)), int&>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(std::is_same<decltype(boost::hof::pack_max(1)), int>::value);
+    const int d = 4;
+    BOOST_HOF_STATIC_TEST_CHECK(std::is_same<decltype(boost::hof::pack_min(d, d)), const int&>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(std::is_same<decltype(boost::hof::pack_min(a, d)), int>::value);
+    boost::hof::pack_max(a, b, c) = 0;
+    BOOST_HOF_TEST_CHECK(b == 0);
+    boost::hof::pack_min(a, b, c) = 5;
+    BOOST_HOF_TEST_CHECK(b == 5);
+    auto r = boost::hof::minmax(a, b, c);
+    BOOST_HOF_STATIC_TEST_CHECK(std::is_same<decltype(r), std::pair<int&, int&>>::value);
+    BOOST_HOF_TEST_CHECK(&r.first == &a);
+    BOOST_HOF_TEST_CHECK(&r.second == &b);
+}
+
+// An rvalue is moved into the result, and only read by minmax
+BOOST_HOF_TEST_CASE()
+{
+    std::string s = "b";
+    std::string m = boost::hof::pack_max(std::string("a"), std::move(s), std::string("ab"));
+    BOOST_HOF_TEST_CHECK(m == "b");
+    std::pair<std::string, std::string> r = boost::hof::minmax(std::string("b"), std::string("a"), std::string("c"));
+    BOOST_HOF_TEST_CHECK(r.first == "a");
+    BOOST_HOF_TEST_CHECK(r.second == "c");
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::minmax(3, 1, 4, 1, 5).first == 1);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::minmax(3, 1, 4, 1, 5).second == 5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::clamp(7, 0, 5) == 5);
+    BOOST_HOF_TEST_CHECK(boost::hof::clamp(-1, 0, 5) == 0);
+    BOOST_HOF_TEST_CHECK(boost::hof::clamp(3, 0, 5) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::clamp(0.5, 0, 1) == 0.5);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::clamp(7, 0, 5) == 5);
+    int x = 9, low = 0, high = 5;
+    BOOST_HOF_STATIC_TEST_CHECK(std::is_same<decltype(boost::hof::clamp(x, low, high)), int&>::value);
+    boost::hof::clamp(x, low, high) = 4;
+    BOOST_HOF_TEST_CHECK(high == 4);
+    BOOST_HOF_TEST_CHECK(x == 9);
+}
@@ -0,0 +1,48 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    module.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <tuple>
+import boost.hof;
+
+namespace module_test {
+
+struct sum_f
+{
+    template<class T, class U>
+    T operator()(T x, U y) const
+    {
+        return x+y;
+    }
+};
+
+struct int_f
+{
+    int operator()(int) const
+    {
+        return 1;
+    }
+};
+
+struct pointer_f
+{
+    int operator()(int*) const
+    {
+        return 2;
+    }
+};
+
+}
+
+int main()
+{
+    auto f = boost::hof::compose([](int x) { return x+1; }, [](int x) { return x*2; });
+    if (f(1) != 3) return 1;
+    if (boost::hof::unpack(module_test::sum_f())(std::make_tuple(1, 2)) != 3) return 1;
+    if ((1 | boost::hof::pipable(module_test::sum_f())(2)) != 3) return 1;
+    auto g = boost::hof::first_of(module_test::int_f(), module_test::pointer_f());
+    if (g(nullptr) != 2) return 1;
+    if (boost::hof::lazy(module_test::sum_f())(1, 2)() != 3) return 1;
+}
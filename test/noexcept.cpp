@@ -0,0 +1,143 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    noexcept.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof.hpp>
+#include <memory>
+#include <string>
+#include "test.hpp"
+
+#if BOOST_HOF_HAS_NOEXCEPT_DEDUCTION
+
+namespace noexcept_test {
+
+// Moving the string doesn't throw, but copying it can
+struct unary
+{
+    std::string s;
+    template<class... Ts>
+    int operator()(int x, Ts&&...) const noexcept
+    {
+        return x;
+    }
+};
+
+struct binary
+{
+    std::string s;
+    template<class... Ts>
+    int operator()(int x, int y, Ts&&...) const noexcept
+    {
+        return x + y;
+    }
+};
+
+struct recursive
+{
+    std::string s;
+    template<class Self>
+    int operator()(Self, int x) const noexcept
+    {
+        return x;
+    }
+};
+
+struct nullary
+{
+    template<class... Ts>
+    int operator()(Ts&&...) const noexcept
+    {
+        return 1;
+    }
+};
+
+struct throwing
+{
+    template<class... Ts>
+    int operator()(int x, Ts&&...) const
+    {
+        return x;
+    }
+};
+
+template<class T>
+struct nothrow_move
+: std::integral_constant<bool, (
+    std::is_nothrow_move_constructible<T>::value && 
+    !std::is_nothrow_copy_constructible<T>::value
+)>
+{};
+
+// The adaptor is constructed, moved and called without throwing, and calling
+// it with a function that can throw is not noexcept
+#define CHECK_NOEXCEPT(call, ...) \
+    static_assert(noexcept(__VA_ARGS__), "Construction can throw"); \
+    static_assert(nothrow_move<decltype(__VA_ARGS__)>::value, "Move can throw"); \
+    static_assert(noexcept(std::declval<const decltype(__VA_ARGS__)&>() call), "Call can throw")
+
+#define CHECK_THROWING(call, ...) \
+    static_assert(!noexcept(std::declval<const decltype(__VA_ARGS__)&>() call), "Call can't throw")
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace noexcept_test;
+    CHECK_NOEXCEPT((1), boost::hof::compose(unary(), unary()));
+    CHECK_NOEXCEPT((1, 2), boost::hof::combine(binary(), unary(), unary()));
+    CHECK_NOEXCEPT((1, 2), boost::hof::drop<0>(unary()));
+    CHECK_NOEXCEPT((1), boost::hof::first_of(unary(), binary()));
+    CHECK_NOEXCEPT((1), boost::hof::fix(recursive()));
+    CHECK_NOEXCEPT((1, 2), boost::hof::flip(unary()));
+    CHECK_NOEXCEPT((1), boost::hof::flow(unary(), unary()));
+    CHECK_NOEXCEPT((1, 2, 3), boost::hof::fold(unary()));
+    CHECK_NOEXCEPT((1), boost::hof::if_(std::true_type())(unary()));
+    CHECK_NOEXCEPT((1, 2), boost::hof::infix(binary()));
+    CHECK_NOEXCEPT((1), boost::hof::lazy(unary()));
+    CHECK_NOEXCEPT((), boost::hof::lazy(unary())(1, 2));
+    CHECK_NOEXCEPT((1), boost::hof::limit_c<2>(unary()));
+    CHECK_NOEXCEPT((1), boost::hof::match(unary(), binary()));
+    CHECK_NOEXCEPT((1), boost::hof::mutable_(unary()));
+    CHECK_NOEXCEPT((1), boost::hof::partial(binary()));
+    CHECK_NOEXCEPT((2), boost::hof::partial(binary())(1));
+    CHECK_NOEXCEPT((1, 2), boost::hof::permute<1, 0>(unary()));
+    CHECK_NOEXCEPT((1), boost::hof::pipable(unary()));
+    CHECK_NOEXCEPT((1), boost::hof::proj(unary(), unary()));
+    CHECK_NOEXCEPT((1), boost::hof::protect(unary()));
+    CHECK_NOEXCEPT((1), boost::hof::repeat(2)(unary()));
+    CHECK_NOEXCEPT((1), boost::hof::result<int>(unary()));
+    CHECK_NOEXCEPT((1), boost::hof::result<void>(unary()));
+    CHECK_NOEXCEPT((1), boost::hof::reveal(unary()));
+    CHECK_NOEXCEPT((1, 2), boost::hof::rotate(unary()));
+    CHECK_NOEXCEPT((1, 2), boost::hof::select<1, 0>(unary()));
+    CHECK_NOEXCEPT((boost::hof::pack(1)), boost::hof::unpack(unary()));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace noexcept_test;
+    CHECK_THROWING((1), boost::hof::compose(unary(), throwing()));
+    CHECK_THROWING((1, 2), boost::hof::combine(binary(), unary(), throwing()));
+    CHECK_THROWING((1, 2), boost::hof::flip(throwing()));
+    CHECK_THROWING((1), boost::hof::limit_c<2>(throwing()));
+    CHECK_THROWING((1), boost::hof::proj(throwing(), unary()));
+    CHECK_THROWING((1), boost::hof::proj(unary(), throwing()));
+    CHECK_THROWING((1), boost::hof::result<int>(throwing()));
+    CHECK_THROWING((1), boost::hof::result<void>(throwing()));
+    CHECK_THROWING((1, 2), boost::hof::select<1, 0>(throwing()));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace noexcept_test;
+    // Elements that can't be copied are passed by reference, so the call
+    // doesn't throw, but copyable elements are passed by value
+    static_assert(noexcept(boost::hof::pack(std::unique_ptr<int>())), "Construction can throw");
+    static_assert(noexcept(std::declval<const decltype(boost::hof::pack(std::unique_ptr<int>()))&>()(nullary())), "Call can throw");
+    static_assert(!noexcept(std::declval<const decltype(boost::hof::pack(std::string()))&>()(nullary())), "Call can't throw");
+    static_assert(std::is_nothrow_move_constructible<decltype(boost::hof::pack(std::unique_ptr<int>(), std::string()))>::value, "Move can throw");
+}
+
+#endif
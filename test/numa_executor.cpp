@@ -0,0 +1,149 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    numa_executor.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/numa_executor.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/parallel_apply.hpp>
+#include <boost/hof/parallel_fold.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+namespace numa_executor_test {
+
+// Runs the tasks inline, and records the node of each task
+struct recording_executor
+{
+    std::size_t node_count;
+    std::vector<std::size_t>* log;
+    std::mutex* m;
+
+    std::size_t nodes() const noexcept
+    {
+        return node_count;
+    }
+
+    template<class F>
+    boost::hof::detail::deferred_handle<F> submit_on(std::size_t node, F f) const
+    {
+        {
+            std::lock_guard<std::mutex> lock(*m);
+            log->push_back(node);
+        }
+        return boost::hof::inline_executor().submit(static_cast<F&&>(f));
+    }
+
+    template<class F>
+    boost::hof::detail::deferred_handle<F> submit(F f) const
+    {
+        return this->submit_on(node_count, static_cast<F&&>(f));
+    }
+
+    template<class F>
+    void execute(F f) const
+    {
+        f();
+    }
+};
+
+template<int N>
+struct constant
+{
+    int operator()() const
+    {
+        return N;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<unsigned> cpus = boost::hof::detail::numa_parse_list("0-3,8,10-11\n");
+    BOOST_HOF_TEST_CHECK((cpus == std::vector<unsigned>{ 0, 1, 2, 3, 8, 10, 11 }));
+    BOOST_HOF_TEST_CHECK(boost::hof::detail::numa_parse_list("").empty());
+    BOOST_HOF_TEST_CHECK(boost::hof::detail::numa_parse_list("5") == std::vector<unsigned>{ 5 });
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::numa_topology t(std::vector<std::vector<unsigned>>{ { 0, 1 }, { 2, 3 } });
+    BOOST_HOF_TEST_CHECK(t.nodes() == 2);
+    BOOST_HOF_TEST_CHECK(t.cpus(1)[0] == 2);
+    BOOST_HOF_TEST_CHECK(boost::hof::numa_topology(std::vector<std::vector<unsigned>>()).nodes() == 1);
+    BOOST_HOF_TEST_CHECK(boost::hof::numa_topology::system().nodes() >= 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::numa_pool pool(boost::hof::numa_topology({ { 0 }, { 0 }, { 0 } }), false);
+    auto e = pool.executor();
+    BOOST_HOF_TEST_CHECK(e.nodes() == 3);
+    BOOST_HOF_TEST_CHECK(e.this_node() == 3);
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        std::atomic<std::size_t> node(4);
+        e.execute_on(i, [&]{ node.store(e.this_node()); });
+        while (node.load() == 4) std::this_thread::yield();
+        BOOST_HOF_TEST_CHECK(node.load() == i);
+    }
+    // The thread that waits for the handle can run the task itself
+    std::size_t n = e.submit_on(1, [&]{ return e.this_node(); }).get();
+    BOOST_HOF_TEST_CHECK(n == 1 || n == 3);
+    BOOST_HOF_TEST_CHECK(e.submit([]{ return 2; }).get() == 2);
+}
+
+// The workers of the system topology are pinned to the CPUs of their node
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::numa_pool pool;
+    boost::hof::numa_executor e(pool);
+    std::vector<long> v(100000, 1);
+    long sum = boost::hof::parallel_fold(boost::hof::_ + boost::hof::_, 0L)(v, e, 1000);
+    BOOST_HOF_TEST_CHECK(sum == 100000);
+}
+
+// The chunks are split into a contiguous block for each node
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<std::size_t> log;
+    std::mutex m;
+    numa_executor_test::recording_executor e{3, &log, &m};
+    std::vector<int> v(12, 1);
+    int sum = boost::hof::parallel_fold(boost::hof::_ + boost::hof::_, 0)(v, e, 2);
+    BOOST_HOF_TEST_CHECK(sum == 12);
+    BOOST_HOF_TEST_CHECK((log == std::vector<std::size_t>{ 0, 1, 1, 2, 2 }));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<std::size_t> log;
+    std::mutex m;
+    numa_executor_test::recording_executor e{2, &log, &m};
+    auto r = boost::hof::parallel_apply(boost::hof::pack(
+        numa_executor_test::constant<1>(),
+        numa_executor_test::constant<2>(),
+        numa_executor_test::constant<3>(),
+        numa_executor_test::constant<4>()
+    ))(e);
+    BOOST_HOF_TEST_CHECK(r([](int a, int b, int c, int d) { return a + b + c + d; }) == 10);
+    // The tasks are submitted in an unspecified order
+    std::sort(log.begin(), log.end());
+    BOOST_HOF_TEST_CHECK((log == std::vector<std::size_t>{ 0, 1, 1 }));
+}
+
+// An executor without nodes is a single node
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::detail::executor_nodes(boost::hof::thread_executor()) == 1);
+    BOOST_HOF_TEST_CHECK(boost::hof::detail::submit_on(boost::hof::inline_executor(), 3, numa_executor_test::constant<2>()).get() == 2);
+    BOOST_HOF_TEST_CHECK(boost::hof::detail::executor_node(3, 4, 2) == 1);
+    BOOST_HOF_TEST_CHECK(boost::hof::detail::executor_node(1, 4, 2) == 0);
+}
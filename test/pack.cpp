@@ -7,7 +7,11 @@
 #include <boost/hof/pack.hpp>
 #include <boost/hof/always.hpp>
 #include <boost/hof/identity.hpp>
+#include <boost/hof/unpack.hpp>
+#include <functional>
+#include <initializer_list>
 #include <memory>
+#include <string>
 #include "test.hpp"
 
 BOOST_HOF_TEST_CASE()
@@ -393,3 +397,341 @@ BOOST_HOF_TEST_CASE()
 }
 
 
+
+struct pack_compact_check
+{
+    template<class A, class B, class C, class D>
+    bool operator()(A a, B b, C c, D d) const
+    {
+        return a == 'a' && b == 1.5 && c == 'c' && d == 2.5;
+    }
+};
+
+struct pack_compact_middle
+{
+    template<class A, class B, class C>
+    constexpr B operator()(A, B b, C) const
+    {
+        return b;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    auto p = boost::hof::pack_compact('a', 1.5, 'c', 2.5);
+    BOOST_HOF_STATIC_TEST_CHECK(sizeof(p) == sizeof(boost::hof::pack(1.5, 2.5, 'a', 'c')));
+    BOOST_HOF_STATIC_TEST_CHECK(sizeof(p) < sizeof(boost::hof::pack('a', 1.5, 'c', 2.5)));
+    BOOST_HOF_TEST_CHECK(p(pack_compact_check()));
+    auto q = p;
+    BOOST_HOF_TEST_CHECK(q(pack_compact_check()));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_compact(1, 2)(binary_class()) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_compact(1, 2)(binary_class()) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_compact(char(1), 2L, short(3))(pack_compact_middle()) == 2L);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_compact()(boost::hof::always(5)) == 5);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_compact(3)(boost::hof::identity) == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto p = boost::hof::pack_compact(char(1), 2.0, short(3), 4L, char(5), 6);
+    auto check = [](char a, double b, short c, long d, char e, int f)
+    {
+        return a == 1 && b == 2.0 && c == 3 && d == 4L && e == 5 && f == 6;
+    };
+    BOOST_HOF_TEST_CHECK(p(check));
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(check)(p));
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(check)(boost::hof::pack_compact(char(1), 2.0, short(3), 4L, char(5), 6)));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int x = 1;
+    char c = 2;
+    auto p = boost::hof::pack_compact(c, std::ref(x));
+    p([](char, int& r) { r = 3; });
+    BOOST_HOF_TEST_CHECK(x == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack([](char a, int& r) { return a + r; })(p) == 5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto p = boost::hof::pack_compact(char(1), std::unique_ptr<int>(new int(2)));
+    int r = boost::hof::unpack([](char a, std::unique_ptr<int> u) { return a + *u; })(std::move(p));
+    BOOST_HOF_TEST_CHECK(r == 3);
+}
+
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR && !BOOST_HOF_NO_REF_QUALIFIERS
+struct pack_copy_counter
+{
+    int* copies;
+
+    pack_copy_counter(int* c) : copies(c)
+    {}
+
+    pack_copy_counter(const pack_copy_counter& rhs) : copies(rhs.copies)
+    {
+        ++*copies;
+    }
+
+    pack_copy_counter(pack_copy_counter&& rhs) noexcept : copies(rhs.copies)
+    {}
+};
+
+struct pack_take_counters
+{
+    template<class... Ts>
+    int operator()(Ts&&...) const
+    {
+        return sizeof...(Ts);
+    }
+};
+
+struct pack_is_rvalue
+{
+    template<class T>
+    constexpr bool operator()(T&&) const
+    {
+        return !std::is_lvalue_reference<T>::value;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    int copies = 0;
+    auto p = boost::hof::pack(pack_copy_counter(&copies), pack_copy_counter(&copies));
+    p(pack_take_counters());
+    BOOST_HOF_TEST_CHECK(copies == 2);
+    std::move(p)(pack_take_counters());
+    BOOST_HOF_TEST_CHECK(copies == 2);
+    auto consume = [](pack_copy_counter, pack_copy_counter) {};
+    std::move(p)(consume);
+    BOOST_HOF_TEST_CHECK(copies == 2);
+
+    copies = 0;
+    auto q = boost::hof::pack_compact(pack_copy_counter(&copies), 'a');
+    std::move(q)(pack_take_counters());
+    BOOST_HOF_TEST_CHECK(copies == 0);
+    q(pack_take_counters());
+    BOOST_HOF_TEST_CHECK(copies == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto p = boost::hof::pack(std::string("hello"));
+    std::string s = std::move(p)([](std::string&& x) { return std::move(x); });
+    BOOST_HOF_TEST_CHECK(s == "hello");
+    BOOST_HOF_TEST_CHECK(boost::hof::pack(std::string("a"))(pack_is_rvalue()));
+    BOOST_HOF_TEST_CHECK(boost::hof::pack(1)(pack_is_rvalue()));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int x = 1;
+    auto p = boost::hof::pack_forward(x);
+    BOOST_HOF_TEST_CHECK(!std::move(p)(pack_is_rvalue()));
+    std::move(p)([](int& r) { r = 2; });
+    BOOST_HOF_TEST_CHECK(x == 2);
+    const auto c = boost::hof::pack(std::string("c"));
+    BOOST_HOF_TEST_CHECK(std::move(c)([](const std::string& y) { return y; }) == "c");
+}
+#endif
+
+struct pack_sum_ptrs
+{
+    template<class... Ts>
+    int operator()(const Ts&... xs) const
+    {
+        int r = 0;
+        (void)std::initializer_list<int>{(r += *xs, 0)...};
+        return r;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack(1, 2, 3)), boost::hof::pack_array<int, 3>);
+    BOOST_HOF_STATIC_TEST_CHECK(sizeof(boost::hof::pack_array<int, 3>) == sizeof(int[3]));
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack(1, 2, 3)(boost::hof::always(3)) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(binary_class())(boost::hof::pack(1, 2)) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(binary_class())(boost::hof::pack(1, 2)) == 3);
+
+    auto p = boost::hof::pack(1, 2);
+    BOOST_HOF_TEST_CHECK(p.elements[0] == 1 && p.elements[1] == 2);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_join(p, boost::hof::pack(3))(boost::hof::always(3)) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_join(boost::hof::pack(1), p)(boost::hof::always(3)) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_join(p, boost::hof::pack(3, 4))(boost::hof::arg(std::integral_constant<int, 4>())) == 4);
+
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_join(boost::hof::pack(1), boost::hof::pack(2))), boost::hof::pack_array<int, 2>);
+
+    // Different types, references and empty elements are stored as bases
+    static_assert(!std::is_same<decltype(boost::hof::pack(1, 2L)), boost::hof::pack_array<int, 2>>::value, "Types are the same");
+    static_assert(!std::is_same<decltype(boost::hof::pack(1)), boost::hof::pack_array<int, 1>>::value, "Types are the same");
+    static_assert(!std::is_same<decltype(boost::hof::pack_basic(1, 2)), boost::hof::pack_array<int, 2>>::value, "Types are the same");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto p = boost::hof::pack(std::unique_ptr<int>(new int(1)), std::unique_ptr<int>(new int(2)));
+    BOOST_HOF_TEST_CHECK(p(pack_sum_ptrs()) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(pack_sum_ptrs())(p) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_join(std::move(p), boost::hof::pack(std::unique_ptr<int>(new int(3))))(pack_sum_ptrs()) == 6);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_get<0>(boost::hof::pack(1, 'a', 2.5)) == 1);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_get<2>(boost::hof::pack(1, 'a', 2.5)) == 2.5);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_get<1>(boost::hof::pack(1, 2, 3)) == 2);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_get<1>(boost::hof::pack_compact('a', 2.5, 'b')) == 2.5);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_get<2>(boost::hof::pack_compact('a', 2.5, 'b')) == 'b');
+
+    auto p = boost::hof::pack(1, std::string("a"));
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_get<1>(p)), std::string&);
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_get<1>(static_cast<const decltype(p)&>(p))), const std::string&);
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_get<1>(std::move(p))), std::string&&);
+    boost::hof::pack_get<0>(p) = 2;
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<0>(p) == 2);
+    std::string s = boost::hof::pack_get<1>(std::move(p));
+    BOOST_HOF_TEST_CHECK(s == "a");
+
+    auto a = boost::hof::pack(1, 2, 3);
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_get<2>(a)), int&);
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_get<2>(std::move(a))), int&&);
+    boost::hof::pack_get<2>(a) = 4;
+    BOOST_HOF_TEST_CHECK(a.elements[2] == 4);
+
+    // References are returned as they are stored, even from an rvalue pack
+    int i = 1;
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_get<0>(boost::hof::pack_basic(i))), int&);
+    BOOST_HOF_TEST_CHECK(&boost::hof::pack_get<0>(boost::hof::pack_basic(i, 2)) == &i);
+    BOOST_HOF_TEST_CHECK(&boost::hof::pack_get<0>(boost::hof::pack_forward(i)) == &i);
+
+    auto c = boost::hof::pack_compact('a', std::string("b"), 'c');
+    boost::hof::pack_get<1>(c) += "d";
+    BOOST_HOF_TEST_CHECK(c([](char, const std::string& x, char) { return x; }) == "bd");
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<0>(c) == 'a');
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<2>(std::move(c)) == 'c');
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    typedef decltype(boost::hof::pack(1, 'a')) pair_pack;
+    BOOST_HOF_STATIC_TEST_CHECK(std::tuple_size<pair_pack>::value == 2);
+    BOOST_HOF_STATIC_TEST_CHECK(std::tuple_size<const pair_pack>::value == 2);
+    STATIC_ASSERT_SAME(std::tuple_element<1, pair_pack>::type, char);
+    BOOST_HOF_STATIC_TEST_CHECK(std::tuple_size<boost::hof::pack_array<int, 3>>::value == 3);
+    STATIC_ASSERT_SAME(std::tuple_element<2, boost::hof::pack_array<int, 3>>::type, int);
+    typedef decltype(boost::hof::pack_compact('a', 2.5)) compact_pack;
+    BOOST_HOF_STATIC_TEST_CHECK(std::tuple_size<compact_pack>::value == 2);
+    STATIC_ASSERT_SAME(std::tuple_element<0, compact_pack>::type, char);
+    BOOST_HOF_STATIC_TEST_CHECK(std::tuple_size<decltype(boost::hof::pack())>::value == 0);
+#if defined(__cpp_structured_bindings)
+    auto [x, y] = boost::hof::pack(1, std::string("a"));
+    BOOST_HOF_TEST_CHECK(x == 1);
+    BOOST_HOF_TEST_CHECK(y == "a");
+    auto p = boost::hof::pack(1, 2, 3);
+    auto& [a, b, c] = p;
+    b = 5;
+    BOOST_HOF_TEST_CHECK(a + c == 4);
+    BOOST_HOF_TEST_CHECK(p.elements[1] == 5);
+    int i = 0;
+    auto [r] = boost::hof::pack_basic(i);
+    r = 7;
+    BOOST_HOF_TEST_CHECK(i == 7);
+    auto [ch, d] = boost::hof::pack_compact('a', 2.5);
+    BOOST_HOF_TEST_CHECK(ch == 'a' && d == 2.5);
+#endif
+}
+
+struct pack_join_counter
+{
+    int* moves;
+    int* copies;
+
+    pack_join_counter(int* m, int* c) : moves(m), copies(c)
+    {}
+
+    pack_join_counter(const pack_join_counter& rhs) : moves(rhs.moves), copies(rhs.copies)
+    {
+        ++*copies;
+    }
+
+    pack_join_counter(pack_join_counter&& rhs) : moves(rhs.moves), copies(rhs.copies)
+    {
+        ++*moves;
+    }
+};
+
+struct pack_join_digits
+{
+    template<class... Ts>
+    constexpr int operator()(Ts... xs) const
+    {
+        return boost::hof::pack_basic(xs...)(pack_join_digits_f());
+    }
+
+    struct pack_join_digits_f
+    {
+        constexpr int operator()() const
+        {
+            return 0;
+        }
+
+        template<class T, class... Ts>
+        constexpr int operator()(T x, Ts... xs) const
+        {
+            return pack_join_digits_f()(xs...) + x * pow10(sizeof...(Ts));
+        }
+
+        static constexpr int pow10(std::size_t n)
+        {
+            return n == 0 ? 1 : 10 * pow10(n-1);
+        }
+    };
+};
+
+// Many packs are joined at once, so each element is moved or copied once
+BOOST_HOF_TEST_CASE()
+{
+    int moves = 0;
+    int copies = 0;
+    pack_join_counter c(&moves, &copies);
+    auto p1 = boost::hof::pack(c);
+    auto p2 = boost::hof::pack(c, 1);
+    auto p3 = boost::hof::pack(c);
+    moves = 0;
+    copies = 0;
+    auto r = boost::hof::pack_join(std::move(p1), std::move(p2), boost::hof::pack(), std::move(p3));
+    BOOST_HOF_TEST_CHECK(moves == 3);
+    BOOST_HOF_TEST_CHECK(copies == 0);
+    moves = 0;
+    auto q = boost::hof::pack_join(r, p2, r);
+    BOOST_HOF_TEST_CHECK(moves == 0);
+    BOOST_HOF_TEST_CHECK(copies == 7);
+    BOOST_HOF_STATIC_TEST_CHECK(std::tuple_size<decltype(q)>::value == 10);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_join(
+        boost::hof::pack(1, 2), boost::hof::pack(), boost::hof::pack(3), boost::hof::pack(4, 5, 6), boost::hof::pack(7)
+    )(pack_join_digits()) == 1234567);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_join(
+        boost::hof::pack_basic(1), boost::hof::pack(2, 3), boost::hof::pack(4), boost::hof::pack_forward(5)
+    )(pack_join_digits()) == 12345);
+    // Elements of the same type are still joined into an array
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_join(boost::hof::pack(1, 2), boost::hof::pack(3), boost::hof::pack(4, 5))), 
+        boost::hof::pack_array<int, 5>);
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_join(boost::hof::pack(1), boost::hof::pack('a'), boost::hof::pack(2))), 
+        decltype(boost::hof::pack(1, 'a', 2)));
+    int x = 1;
+    int y = 2;
+    auto r = boost::hof::pack_join(boost::hof::pack_forward(x), boost::hof::pack(3), boost::hof::pack_forward(y));
+    STATIC_ASSERT_SAME(decltype(r), decltype(boost::hof::pack_basic(x, 3, y)));
+    boost::hof::pack_get<2>(r) = 4;
+    BOOST_HOF_TEST_CHECK(y == 4);
+}
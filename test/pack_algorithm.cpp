@@ -0,0 +1,158 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    pack_algorithm.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/pack_algorithm.hpp>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "test.hpp"
+
+namespace pack_algorithm_test {
+
+struct add
+{
+    constexpr int operator()() const
+    {
+        return 0;
+    }
+
+    template<class T, class... Ts>
+    constexpr int operator()(T x, Ts... xs) const
+    {
+        return int(x) + (*this)(xs...);
+    }
+};
+
+struct twice
+{
+    template<class T>
+    constexpr T operator()(T x) const
+    {
+        return x + x;
+    }
+};
+
+struct is_size
+{
+    template<class... Ts>
+    constexpr std::size_t operator()(Ts&&...) const
+    {
+        return sizeof...(Ts);
+    }
+};
+
+template<class P>
+struct drop_invocable
+{
+    template<std::size_t N, class=decltype(boost::hof::pack_drop<N>(std::declval<P>()))>
+    static std::true_type check(std::integral_constant<std::size_t, N>);
+
+    template<std::size_t N>
+    static std::false_type check(...);
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto p = boost::hof::pack(1, std::string("a"), 2, 3.5, 'c');
+    auto ints = boost::hof::pack_filter<std::is_integral>(p);
+    STATIC_ASSERT_SAME(decltype(ints), decltype(boost::hof::pack(1, 2, 'c')));
+    BOOST_HOF_TEST_CHECK(ints(pack_algorithm_test::add()) == 1 + 2 + 'c');
+    auto strings = boost::hof::pack_filter<std::is_class>(p);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<0>(strings) == "a");
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_filter<std::is_pointer>(p)(pack_algorithm_test::is_size()) == 0);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_filter<std::is_integral>(boost::hof::pack(1, 2.0, 3))(pack_algorithm_test::add()) == 4);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_filter<std::is_integral>(boost::hof::pack())(pack_algorithm_test::is_size()) == 0);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto p = boost::hof::pack(1, std::string("a"), 2, 3.5);
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_take<2>(p)), decltype(boost::hof::pack(1, std::string("a"))));
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_drop<2>(p)), decltype(boost::hof::pack(2, 3.5)));
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<1>(boost::hof::pack_take<2>(p)) == "a");
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<1>(boost::hof::pack_drop<2>(p)) == 3.5);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_take<0>(p)(pack_algorithm_test::is_size()) == 0);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_drop<4>(p)(pack_algorithm_test::is_size()) == 0);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_take<4>(p)(pack_algorithm_test::is_size()) == 4);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_take<2>(boost::hof::pack(1, 2, 3))(pack_algorithm_test::add()) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_drop<1>(boost::hof::pack(1, 2, 3))(pack_algorithm_test::add()) == 5);
+    // The count can't be more than the size of the pack
+    BOOST_HOF_STATIC_TEST_CHECK(decltype(pack_algorithm_test::drop_invocable<decltype(p)>::check<4>(std::integral_constant<std::size_t, 4>()))::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!decltype(pack_algorithm_test::drop_invocable<decltype(p)>::check<5>(std::integral_constant<std::size_t, 5>()))::value);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto p = boost::hof::pack(1, 2.5, 'a');
+    auto r = boost::hof::pack_transform(p, pack_algorithm_test::twice());
+    STATIC_ASSERT_SAME(decltype(r), decltype(boost::hof::pack(1, 2.5, 'a')));
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<0>(r) == 2);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<1>(r) == 5.0);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<2>(r) == char('a' + 'a'));
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::pack_transform(boost::hof::pack(1, 2, 3), pack_algorithm_test::twice())(pack_algorithm_test::add()) == 12);
+    // The results are decayed
+    auto strings = boost::hof::pack_transform(boost::hof::pack(1, 2), [](int x) { return std::to_string(x); });
+    STATIC_ASSERT_SAME(decltype(strings), decltype(boost::hof::pack(std::string(), std::string())));
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<1>(strings) == "2");
+    std::string s = "x";
+    auto copies = boost::hof::pack_transform(boost::hof::pack(0), [&](int) -> std::string& { return s; });
+    STATIC_ASSERT_SAME(decltype(copies), decltype(boost::hof::pack(std::string())));
+}
+
+// The function is called with the elements in order
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> order;
+    boost::hof::pack_transform(boost::hof::pack(1, 2, 3, 4), [&](int x) { order.push_back(x); return x; });
+    BOOST_HOF_TEST_CHECK((order == std::vector<int>{ 1, 2, 3, 4 }));
+}
+
+// Packs of the same type stay arrays, and compact packs stay compact
+BOOST_HOF_TEST_CASE()
+{
+    auto a = boost::hof::pack(1, 2, 3, 4);
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_take<3>(a)), boost::hof::pack_array<int, 3>);
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_transform(a, pack_algorithm_test::twice())), boost::hof::pack_array<int, 4>);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_drop<1>(a)(pack_algorithm_test::add()) == 9);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_filter<std::is_integral>(a)(pack_algorithm_test::add()) == 10);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_filter<std::is_floating_point>(a)(pack_algorithm_test::is_size()) == 0);
+
+    auto c = boost::hof::pack_compact('a', 1.5, 2, 'b');
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_drop<1>(c)), decltype(boost::hof::pack_compact(1.5, 2, 'b')));
+    STATIC_ASSERT_SAME(decltype(boost::hof::pack_filter<std::is_integral>(c)), decltype(boost::hof::pack_compact('a', 2, 'b')));
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<0>(boost::hof::pack_drop<1>(c)) == 1.5);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<2>(boost::hof::pack_filter<std::is_integral>(c)) == 'b');
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_take<2>(c)(pack_algorithm_test::add()) == 'a' + 1);
+}
+
+// The references of a forwarded pack stay references
+BOOST_HOF_TEST_CASE()
+{
+    int x = 1;
+    std::string s = "a";
+    auto r = boost::hof::pack_filter<std::is_integral>(boost::hof::pack_forward(x, s, 2));
+    STATIC_ASSERT_SAME(decltype(r), decltype(boost::hof::pack_forward(x, 2)));
+    boost::hof::pack_get<0>(r) = 5;
+    BOOST_HOF_TEST_CHECK(x == 5);
+    boost::hof::pack_get<0>(boost::hof::pack_drop<1>(boost::hof::pack_forward(x, s))) += "b";
+    BOOST_HOF_TEST_CHECK(s == "ab");
+}
+
+// The elements of an rvalue pack are moved
+BOOST_HOF_TEST_CASE()
+{
+    auto p = boost::hof::pack(std::unique_ptr<int>(new int(1)), 2, std::unique_ptr<int>(new int(3)));
+    auto r = boost::hof::pack_drop<1>(std::move(p));
+    BOOST_HOF_TEST_CHECK(*boost::hof::pack_get<1>(r) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<2>(p) == nullptr);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<0>(p) != nullptr);
+    auto q = boost::hof::pack_filter<std::is_class>(std::move(p));
+    BOOST_HOF_TEST_CHECK(*boost::hof::pack_get<0>(q) == 1);
+    BOOST_HOF_TEST_CHECK(boost::hof::pack_get<0>(p) == nullptr);
+}
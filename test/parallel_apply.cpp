@@ -0,0 +1,125 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    parallel_apply.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/parallel_apply.hpp>
+#include <boost/hof/construct.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include "test.hpp"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+
+namespace parallel_apply_test {
+
+struct thread_of
+{
+    std::thread::id operator()() const
+    {
+        return std::this_thread::get_id();
+    }
+};
+
+struct load_int
+{
+    int operator()() const
+    {
+        return 3;
+    }
+};
+
+struct load_string
+{
+    std::string operator()() const
+    {
+        return "hello";
+    }
+};
+
+struct load_ptr
+{
+    std::unique_ptr<int> operator()() const
+    {
+        return std::unique_ptr<int>(new int(5));
+    }
+};
+
+struct load_void
+{
+    void operator()() const
+    {}
+};
+
+struct counting_executor
+{
+    std::shared_ptr<std::atomic<int>> count;
+
+    template<class F>
+    boost::hof::detail::deferred_handle<F> submit(F f) const
+    {
+        ++*count;
+        return boost::hof::inline_executor().submit(f);
+    }
+};
+
+template<class Pack>
+auto to_tuple(Pack&& p) -> decltype(boost::hof::unpack(boost::hof::construct<std::tuple>())(std::forward<Pack>(p)))
+{
+    return boost::hof::unpack(boost::hof::construct<std::tuple>())(std::forward<Pack>(p));
+}
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::parallel_apply(boost::hof::pack(parallel_apply_test::load_int(), parallel_apply_test::load_string()));
+    BOOST_HOF_TEST_CHECK(parallel_apply_test::to_tuple(f(boost::hof::thread_executor())) == std::make_tuple(3, std::string("hello")));
+    BOOST_HOF_TEST_CHECK(parallel_apply_test::to_tuple(f()) == std::make_tuple(3, std::string("hello")));
+    BOOST_HOF_TEST_CHECK(parallel_apply_test::to_tuple(f(boost::hof::inline_executor())) == std::make_tuple(3, std::string("hello")));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto ids = parallel_apply_test::to_tuple(boost::hof::parallel_apply(boost::hof::pack(
+        parallel_apply_test::thread_of(), parallel_apply_test::thread_of(), parallel_apply_test::thread_of()
+    ))(boost::hof::thread_executor()));
+    BOOST_HOF_TEST_CHECK(std::get<0>(ids) == std::this_thread::get_id());
+    BOOST_HOF_TEST_CHECK(std::get<1>(ids) != std::this_thread::get_id());
+    BOOST_HOF_TEST_CHECK(std::get<2>(ids) != std::this_thread::get_id());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto ids = parallel_apply_test::to_tuple(boost::hof::parallel_apply(boost::hof::pack(
+        parallel_apply_test::thread_of(), parallel_apply_test::thread_of(), parallel_apply_test::thread_of()
+    ))(boost::hof::parallel_on(boost::hof::thread_executor(), 4)));
+    BOOST_HOF_TEST_CHECK(std::get<0>(ids) == std::this_thread::get_id());
+    BOOST_HOF_TEST_CHECK(std::get<1>(ids) == std::this_thread::get_id());
+    BOOST_HOF_TEST_CHECK(std::get<2>(ids) == std::this_thread::get_id());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    parallel_apply_test::counting_executor e{std::make_shared<std::atomic<int>>(0)};
+    auto f = boost::hof::parallel_apply(std::make_tuple(
+        parallel_apply_test::load_int(), parallel_apply_test::load_ptr(), parallel_apply_test::load_int()
+    ));
+    auto r = parallel_apply_test::to_tuple(f(e));
+    BOOST_HOF_TEST_CHECK(std::get<0>(r) == 3);
+    BOOST_HOF_TEST_CHECK(*std::get<1>(r) == 5);
+    BOOST_HOF_TEST_CHECK(std::get<2>(r) == 3);
+    BOOST_HOF_TEST_CHECK(*e.count == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::parallel_apply(boost::hof::pack());
+    BOOST_HOF_TEST_CHECK(parallel_apply_test::to_tuple(f(boost::hof::thread_executor())) == std::make_tuple());
+    typedef decltype(boost::hof::parallel_apply(boost::hof::pack(parallel_apply_test::load_void()))) void_apply;
+    static_assert(!boost::hof::is_invocable<void_apply, boost::hof::thread_executor>::value, "Invocable");
+}
@@ -0,0 +1,119 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    parallel_by.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/parallel_by.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include "test.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <tuple>
+
+struct thread_of
+{
+    template<class T>
+    std::thread::id operator()(T) const
+    {
+        return std::this_thread::get_id();
+    }
+};
+
+struct mini_tuple
+{
+    template<class... Ts>
+    std::tuple<Ts...> operator()(Ts... xs) const
+    {
+        return std::tuple<Ts...>(xs...);
+    }
+};
+
+struct square
+{
+    int operator()(int x) const
+    {
+        return x * x;
+    }
+};
+
+struct sum_f
+{
+    template<class T, class U>
+    T operator()(T x, U y) const
+    {
+        return x + y;
+    }
+};
+
+struct foo
+{
+    foo(int x_) : x(x_)
+    {}
+    int x;
+};
+
+struct get_x
+{
+    int operator()(const foo& f) const
+    {
+        return f.x;
+    }
+};
+
+struct add_to
+{
+    std::atomic<int>* total;
+
+    void operator()(int x) const
+    {
+        *total += x;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::parallel_by(square(), sum_f());
+    BOOST_HOF_TEST_CHECK(f(3, 4) == 25);
+    BOOST_HOF_TEST_CHECK(boost::hof::parallel_by(get_x(), sum_f())(foo(1), foo(2)) == 3);
+    static_assert(boost::hof::is_invocable<decltype(f), int, int>::value, "Not invocable");
+    static_assert(!boost::hof::is_invocable<decltype(f), foo, int>::value, "Invocable");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::parallel_by(thread_of(), mini_tuple());
+    auto ids = f(1, 2, 3);
+    BOOST_HOF_TEST_CHECK(std::get<0>(ids) == std::this_thread::get_id());
+    BOOST_HOF_TEST_CHECK(std::get<1>(ids) != std::this_thread::get_id());
+    BOOST_HOF_TEST_CHECK(std::get<2>(ids) != std::this_thread::get_id());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::parallel_by(boost::hof::parallel_on(boost::hof::inline_executor()), thread_of(), mini_tuple());
+    auto ids = f(1, 2);
+    BOOST_HOF_TEST_CHECK(std::get<0>(ids) == std::this_thread::get_id());
+    BOOST_HOF_TEST_CHECK(std::get<1>(ids) == std::this_thread::get_id());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::parallel_by(boost::hof::parallel_on(boost::hof::thread_executor(), 3), thread_of(), mini_tuple());
+    auto ids = f(1, 2);
+    BOOST_HOF_TEST_CHECK(std::get<0>(ids) == std::this_thread::get_id());
+    BOOST_HOF_TEST_CHECK(std::get<1>(ids) == std::this_thread::get_id());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::atomic<int> total(0);
+    boost::hof::parallel_by(add_to{&total})(1, 2, 3, 4);
+    BOOST_HOF_TEST_CHECK(total == 10);
+    boost::hof::parallel_by(boost::hof::parallel_on(boost::hof::inline_executor()), add_to{&total})(5);
+    BOOST_HOF_TEST_CHECK(total == 15);
+    boost::hof::parallel_by(add_to{&total})();
+    BOOST_HOF_TEST_CHECK(total == 15);
+}
@@ -0,0 +1,150 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    parallel_combine.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/parallel_combine.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include "test.hpp"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+struct thread_of
+{
+    template<class T>
+    std::thread::id operator()(T) const
+    {
+        return std::this_thread::get_id();
+    }
+};
+
+struct mini_tuple
+{
+    template<class... Ts>
+    std::tuple<Ts...> operator()(Ts... xs) const
+    {
+        return std::tuple<Ts...>(xs...);
+    }
+};
+
+struct times2
+{
+    int operator()(int x) const
+    {
+        return x * 2;
+    }
+};
+
+struct length
+{
+    std::size_t operator()(const std::string& s) const
+    {
+        return s.size();
+    }
+};
+
+struct sum_f
+{
+    template<class T, class U>
+    auto operator()(T x, U y) const -> decltype(x + y)
+    {
+        return x + y;
+    }
+};
+
+struct counting_executor
+{
+    std::shared_ptr<std::atomic<int>> count;
+
+    template<class F>
+    boost::hof::detail::deferred_handle<F> submit(F f) const
+    {
+        ++*count;
+        return boost::hof::inline_executor().submit(f);
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::parallel_combine(sum_f(), times2(), length());
+    BOOST_HOF_TEST_CHECK(f(3, std::string("hello")) == 11);
+    static_assert(boost::hof::is_invocable<decltype(f), int, std::string>::value, "Not invocable");
+    static_assert(!boost::hof::is_invocable<decltype(f), int>::value, "Invocable");
+    static_assert(!boost::hof::is_invocable<decltype(f), int, std::string, int>::value, "Invocable");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::parallel_combine(mini_tuple(), thread_of(), thread_of(), thread_of());
+    auto ids = f(1, 2, 3);
+    BOOST_HOF_TEST_CHECK(std::get<0>(ids) == std::this_thread::get_id());
+    BOOST_HOF_TEST_CHECK(std::get<1>(ids) != std::this_thread::get_id());
+    BOOST_HOF_TEST_CHECK(std::get<2>(ids) != std::this_thread::get_id());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::parallel_combine(
+        boost::hof::parallel_on(boost::hof::thread_executor(), 4),
+        mini_tuple(), thread_of(), thread_of(), thread_of()
+    );
+    auto ids = f(1, 2, 3);
+    BOOST_HOF_TEST_CHECK(std::get<0>(ids) == std::this_thread::get_id());
+    BOOST_HOF_TEST_CHECK(std::get<1>(ids) == std::this_thread::get_id());
+    BOOST_HOF_TEST_CHECK(std::get<2>(ids) == std::this_thread::get_id());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    counting_executor e{std::make_shared<std::atomic<int>>(0)};
+    auto f = boost::hof::parallel_combine(boost::hof::parallel_on(e), mini_tuple(), times2(), times2(), times2());
+    BOOST_HOF_TEST_CHECK(f(1, 2, 3) == std::make_tuple(2, 4, 6));
+    BOOST_HOF_TEST_CHECK(*e.count == 2);
+    BOOST_HOF_TEST_CHECK(f(1, 2, 3) == std::make_tuple(2, 4, 6));
+    BOOST_HOF_TEST_CHECK(*e.count == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    counting_executor e{std::make_shared<std::atomic<int>>(0)};
+    auto f = boost::hof::parallel_combine(boost::hof::parallel_on(e), mini_tuple(), times2());
+    BOOST_HOF_TEST_CHECK(f(1) == std::make_tuple(2));
+    BOOST_HOF_TEST_CHECK(*e.count == 0);
+    auto g = boost::hof::parallel_combine(boost::hof::parallel_on(e, 0), mini_tuple());
+    BOOST_HOF_TEST_CHECK(g() == std::make_tuple());
+    BOOST_HOF_TEST_CHECK(*e.count == 0);
+}
+
+struct first_ref
+{
+    template<class T>
+    T& operator()(T& x) const
+    {
+        return x;
+    }
+};
+
+struct address_pair
+{
+    template<class T, class U>
+    std::pair<T*, U*> operator()(T& x, U& y) const
+    {
+        return std::pair<T*, U*>(&x, &y);
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    int i = 1;
+    std::string s = "x";
+    auto f = boost::hof::parallel_combine(address_pair(), first_ref(), first_ref());
+    auto p = f(i, s);
+    BOOST_HOF_TEST_CHECK(p.first == &i);
+    BOOST_HOF_TEST_CHECK(p.second == &s);
+}
@@ -0,0 +1,92 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    parallel_fold.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/parallel_fold.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "test.hpp"
+
+namespace parallel_fold_test {
+
+// Associative, but not commutative, so the order of the chunks is checked
+struct concat
+{
+    std::string operator()(std::string x, const std::string& y) const
+    {
+        return x + y;
+    }
+};
+
+struct throw_at
+{
+    int bad;
+
+    int operator()(int x, int y) const
+    {
+        if (y == bad) throw std::runtime_error("bad element");
+        return x + y;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> v;
+    for (int i = 1; i <= 1000; i++) v.push_back(i);
+    auto sum = boost::hof::parallel_fold(boost::hof::_ + boost::hof::_, 0);
+    BOOST_HOF_TEST_CHECK(sum(v) == 500500);
+    BOOST_HOF_TEST_CHECK(sum(v, boost::hof::thread_executor(), 7) == 500500);
+    BOOST_HOF_TEST_CHECK(sum(v, boost::hof::inline_executor(), 1) == 500500);
+    BOOST_HOF_TEST_CHECK(sum(v, boost::hof::parallel_on(boost::hof::thread_executor(), 100), 100) == 500500);
+    BOOST_HOF_TEST_CHECK(boost::hof::parallel_fold(boost::hof::_ + boost::hof::_, 5)(std::vector<int>()) == 5);
+
+    int a[] = { 1, 2, 3 };
+    BOOST_HOF_TEST_CHECK(boost::hof::parallel_fold(boost::hof::_ * boost::hof::_, 2)(a, boost::hof::thread_executor(), 1) == 12);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace parallel_fold_test;
+    std::string s = "abcdefghijklmnopqrstuvwxyz";
+    std::vector<std::string> letters;
+    for (char c : s) letters.push_back(std::string(1, c));
+    auto f = boost::hof::parallel_fold(concat(), std::string(">"));
+    for (std::size_t grain = 1; grain < 30; grain++)
+        BOOST_HOF_TEST_CHECK(f(letters, boost::hof::thread_executor(), grain) == ">" + s);
+}
+
+// The state isn't constructible from an element, so the chunks are folded
+// from the initial state and combined with concat
+BOOST_HOF_TEST_CASE()
+{
+    using namespace parallel_fold_test;
+    std::string s = "abcdefghijklmnopqrstuvwxyz";
+    std::vector<char> letters(s.begin(), s.end());
+    auto f = boost::hof::parallel_fold(boost::hof::_ + boost::hof::_, std::string(), concat());
+    for (std::size_t grain = 1; grain < 30; grain++)
+        BOOST_HOF_TEST_CHECK(f(letters, boost::hof::thread_executor(), grain) == s);
+    BOOST_HOF_TEST_CHECK(f(std::vector<char>()) == "");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace parallel_fold_test;
+    std::vector<int> v(100, 1);
+    v[85] = 2;
+    bool thrown = false;
+    try
+    {
+        boost::hof::parallel_fold(throw_at{2}, 0)(v, boost::hof::thread_executor(), 10);
+    }
+    catch(const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    BOOST_HOF_TEST_CHECK(thrown);
+}
@@ -6,6 +6,7 @@
 ==============================================================================*/
 #include <boost/hof/partial.hpp>
 #include <boost/hof/limit.hpp>
+#include <memory>
 #include "test.hpp"
 
 static constexpr boost::hof::static_<boost::hof::partial_adaptor<binary_class> > binary_partial = {};
@@ -106,3 +107,59 @@ BOOST_HOF_TEST_CASE()
     static_assert(boost::hof::is_invocable<decltype(g), int, int, int>::value, "Passing the limit is not callable");
     static_assert(boost::hof::is_invocable<decltype(g), int, int, int, int>::value, "Passing the limit is not callable");
 }
+
+namespace partial_test {
+
+struct sum3
+{
+    template<class T, class U, class V>
+    constexpr T operator()(T x, U y, V z) const
+    {
+        return x+y+z;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The arguments of stacked calls are collected into one pack
+    auto f = boost::hof::partial(boost::hof::limit_c<3>(partial_test::sum3()));
+    STATIC_ASSERT_SAME(decltype(f(1)(2)), decltype(f(1, 2)));
+    BOOST_HOF_TEST_CHECK(sizeof(f(1)(2)) == sizeof(f(1, 2)));
+    BOOST_HOF_TEST_CHECK(f(1)(2)(3) == 6);
+    // A partial adaptor isn't wrapped again
+    STATIC_ASSERT_SAME(decltype(boost::hof::partial(f)), decltype(f));
+    STATIC_ASSERT_SAME(decltype(boost::hof::partial(f(1))), decltype(f(1)));
+    BOOST_HOF_TEST_CHECK(boost::hof::partial(f)(1)(2)(3) == 6);
+    BOOST_HOF_TEST_CHECK(boost::hof::partial(f(1))(2)(3) == 6);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::partial(boost::hof::partial(binary_class()))(1)(2) == 3);
+}
+
+#if BOOST_HOF_DETAIL_PACK_HAS_RVALUE_CALL
+namespace partial_move_test {
+
+struct take3
+{
+    int operator()(std::unique_ptr<int> x, std::unique_ptr<int> y, std::unique_ptr<int> z) const
+    {
+        return *x * 100 + *y * 10 + *z;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // Move-only arguments are moved along a chain of rvalue calls
+    auto f = boost::hof::partial(partial_move_test::take3());
+    BOOST_HOF_TEST_CHECK(f(std::unique_ptr<int>(new int(1)))(std::unique_ptr<int>(new int(2)))(std::unique_ptr<int>(new int(3))) == 123);
+    auto g = f(std::unique_ptr<int>(new int(1)));
+    auto h = std::move(g)(std::unique_ptr<int>(new int(2)));
+    BOOST_HOF_TEST_CHECK(std::move(h)(std::unique_ptr<int>(new int(3))) == 123);
+    // A copyable partial can still be called as an lvalue and as an rvalue
+    auto s = boost::hof::partial(binary_class())(1);
+    BOOST_HOF_TEST_CHECK(s(2) == 3);
+    BOOST_HOF_TEST_CHECK(std::move(s)(3) == 4);
+}
+#endif
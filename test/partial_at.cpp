@@ -0,0 +1,72 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    partial_at.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/partial_at.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <memory>
+#include "test.hpp"
+
+namespace partial_at_test {
+
+struct digits
+{
+    template<class... Ts>
+    constexpr int operator()(Ts... xs) const
+    {
+        return digits::combine(0, xs...);
+    }
+
+    static constexpr int combine(int r)
+    {
+        return r;
+    }
+
+    template<class T, class... Ts>
+    static constexpr int combine(int r, T x, Ts... xs)
+    {
+        return digits::combine(r * 10 + x, xs...);
+    }
+};
+
+struct deref_add
+{
+    int operator()(int x, const std::unique_ptr<int>& p, int y) const
+    {
+        return x + *p + y;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using partial_at_test::digits;
+    BOOST_HOF_TEST_CHECK(boost::hof::partial_at<0>(digits())(1)(2, 3) == 123);
+    BOOST_HOF_TEST_CHECK(boost::hof::partial_at<1>(digits())(2)(1, 3) == 123);
+    BOOST_HOF_TEST_CHECK(boost::hof::partial_at<2>(digits())(3)(1, 2) == 123);
+    BOOST_HOF_TEST_CHECK(boost::hof::partial_at<1>(digits())(2, 3)(1, 4) == 1234);
+    BOOST_HOF_TEST_CHECK(boost::hof::partial_at<1>(digits())()(1, 2) == 12);
+
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::partial_at<1>(digits())(2)(1, 3) == 123);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::partial_at<2>(digits())(3, 4)(1, 2, 5) == 12345);
+}
+
+// There must be enough arguments to fill the position
+BOOST_HOF_TEST_CASE()
+{
+    using partial_at_test::digits;
+    auto f = boost::hof::partial_at<2>(digits())(3);
+    static_assert(!boost::hof::is_invocable<decltype(f), int>::value, "Invocable");
+    static_assert(boost::hof::is_invocable<decltype(f), int, int>::value, "Not invocable");
+}
+
+// The bound values are passed as const lvalues, so they can be move-only
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::partial_at<1>(partial_at_test::deref_add())(std::unique_ptr<int>(new int(2)));
+    BOOST_HOF_TEST_CHECK(f(1, 3) == 6);
+    BOOST_HOF_TEST_CHECK(f(1, 4) == 7);
+}
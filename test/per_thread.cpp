@@ -0,0 +1,71 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    per_thread.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/per_thread.hpp>
+#include <boost/hof/static_lazy.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+namespace per_thread_test {
+
+struct counter
+{
+    std::atomic<int> n;
+    counter(int x=0) : n(x)
+    {}
+    counter(const counter& rhs) : n(rhs.n.load())
+    {}
+    int operator()()
+    {
+        int x = n.load(std::memory_order_relaxed) + 1;
+        n.store(x, std::memory_order_relaxed);
+        return x;
+    }
+};
+
+int total(const boost::hof::per_thread_adaptor<counter>& f)
+{
+    int sum = 0;
+    f.for_each_replica([&sum](const counter& c) { sum += c.n.load(); });
+    return sum;
+}
+
+}
+
+BOOST_HOF_STATIC_FUNCTION_LAZY(per_thread_count, boost::hof::per_thread_adaptor<per_thread_test::counter>);
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::per_thread(per_thread_test::counter(10));
+    BOOST_HOF_TEST_CHECK(f() == 11);
+    BOOST_HOF_TEST_CHECK(f() == 12);
+    // Copies of the adaptor share the replicas
+    auto g = f;
+    BOOST_HOF_TEST_CHECK(g() == 13);
+    BOOST_HOF_TEST_CHECK(per_thread_test::total(f) == 13);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    const auto f = boost::hof::per_thread(per_thread_test::counter());
+    f();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) threads.emplace_back([&f]
+    {
+        for (int j = 0; j < 1000; j++) f();
+    });
+    for (auto& t : threads) t.join();
+    BOOST_HOF_TEST_CHECK(per_thread_test::total(f) == 4001);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    per_thread_count();
+    std::thread([] { per_thread_count(); }).join();
+    BOOST_HOF_TEST_CHECK(per_thread_test::total(per_thread_count.base_function()) == 2);
+}
@@ -0,0 +1,96 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    permute.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/permute.hpp>
+#include <boost/hof/flip.hpp>
+#include <boost/hof/rotate.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <memory>
+#include "test.hpp"
+
+namespace permute_test {
+
+struct digits
+{
+    template<class... Ts>
+    constexpr int operator()(Ts... xs) const
+    {
+        return fold(0, xs...);
+    }
+
+    static constexpr int fold(int x)
+    {
+        return x;
+    }
+
+    template<class... Ts>
+    static constexpr int fold(int x, int y, Ts... ys)
+    {
+        return fold(x*10 + y, ys...);
+    }
+};
+
+struct take_unique
+{
+    int operator()(int& x, std::unique_ptr<int> p) const
+    {
+        return x + *p;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(3 == boost::hof::permute<1, 0>(boost::hof::_ - boost::hof::_)(2, 5));
+    BOOST_HOF_STATIC_TEST_CHECK(3 == boost::hof::permute<1, 0>(boost::hof::_ - boost::hof::_)(2, 5));
+
+    BOOST_HOF_TEST_CHECK(312 == boost::hof::permute<2, 0, 1>(permute_test::digits())(1, 2, 3));
+    BOOST_HOF_STATIC_TEST_CHECK(312 == boost::hof::permute<2, 0, 1>(permute_test::digits())(1, 2, 3));
+    BOOST_HOF_TEST_CHECK(123 == boost::hof::permute<0, 1, 2>(permute_test::digits())(1, 2, 3));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The trailing arguments are passed unchanged
+    BOOST_HOF_TEST_CHECK(21345 == boost::hof::permute<1, 0>(permute_test::digits())(1, 2, 3, 4, 5));
+    BOOST_HOF_STATIC_TEST_CHECK(21345 == boost::hof::permute<1, 0>(permute_test::digits())(1, 2, 3, 4, 5));
+    BOOST_HOF_TEST_CHECK(123 == boost::hof::permute<>(permute_test::digits())(1, 2, 3));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(
+        boost::hof::flip(permute_test::digits())(1, 2, 3, 4) == 
+        boost::hof::permute<1, 0>(permute_test::digits())(1, 2, 3, 4)
+    );
+    BOOST_HOF_TEST_CHECK(
+        boost::hof::rotate(permute_test::digits())(1, 2, 3) == 
+        boost::hof::permute<1, 2, 0>(permute_test::digits())(1, 2, 3)
+    );
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(987654321 == boost::hof::permute<8, 7, 6, 5, 4, 3, 2, 1, 0>(permute_test::digits())(1, 2, 3, 4, 5, 6, 7, 8, 9));
+    BOOST_HOF_STATIC_TEST_CHECK(987654321 == boost::hof::permute<8, 7, 6, 5, 4, 3, 2, 1, 0>(permute_test::digits())(1, 2, 3, 4, 5, 6, 7, 8, 9));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // References and move-only arguments are forwarded without copies
+    int x = 1;
+    BOOST_HOF_TEST_CHECK(3 == boost::hof::permute<1, 0>(permute_test::take_unique())(std::unique_ptr<int>(new int(2)), x));
+    STATIC_ASSERT_SAME(decltype(boost::hof::permute<1, 0>(boost::hof::arg(std::integral_constant<int, 1>()))(x, 1)), int&&);
+    STATIC_ASSERT_SAME(decltype(boost::hof::permute<1, 0>(boost::hof::arg(std::integral_constant<int, 1>()))(1, x)), int&);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(!boost::hof::is_invocable<decltype(boost::hof::permute<1, 0>(permute_test::digits())), int>::value, "Not enough arguments");
+    static_assert(boost::hof::is_invocable<decltype(boost::hof::permute<1, 0>(permute_test::digits())), int, int>::value, "Invocable");
+}
@@ -8,6 +8,12 @@
 #include <boost/hof/static.hpp>
 #include <boost/hof/limit.hpp>
 #include "test.hpp"
+#include <type_traits>
+#if BOOST_HOF_HAS_RANGE_ADAPTOR_CLOSURE
+#include <algorithm>
+#include <ranges>
+#include <vector>
+#endif
 
 static constexpr boost::hof::static_<boost::hof::pipable_adaptor<binary_class> > binary_pipable = {};
 
@@ -88,3 +94,116 @@ BOOST_HOF_TEST_CASE()
     static_assert(!boost::hof::is_invocable<decltype(f), int, int, int>::value, "Passing the limit is not callable");
     static_assert(!boost::hof::is_invocable<decltype(f), int, int, int, int>::value, "Passing the limit is not callable");
 }
+
+namespace pipable_test {
+
+struct counted_sum
+{
+    int * copies;
+    counted_sum(int * c) : copies(c)
+    {}
+
+    counted_sum(const counted_sum& rhs) : copies(rhs.copies)
+    {
+        ++*copies;
+    }
+
+    counted_sum(counted_sum&& rhs) : copies(rhs.copies)
+    {
+        ++*copies;
+    }
+
+    int operator()(int x, int y) const
+    {
+        return x + y;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int copies = 0;
+    const auto f = boost::hof::pipable(pipable_test::counted_sum(&copies));
+    copies = 0;
+    BOOST_HOF_TEST_CHECK(10 == (1 | f(2) | f(3) | f(4)));
+    BOOST_HOF_TEST_CHECK(copies == 0);
+    static_assert(std::is_trivially_destructible<decltype(f(2))>::value, "The closure must only hold references");
+    static_assert(std::is_trivially_destructible<decltype(binary_pipable(2))>::value, "The closure must only hold references");
+}
+
+constexpr boost::hof::pipable_c_adaptor<2, binary_class> binary_pipable_c = {};
+
+constexpr boost::hof::pipable_c_adaptor<1, unary_class> unary_pipable_c = {};
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(3 == (1 | binary_pipable_c(2)));
+    BOOST_HOF_TEST_CHECK(3 == (binary_pipable_c(1, 2)));
+    BOOST_HOF_TEST_CHECK(3 == (3 | unary_pipable_c));
+    BOOST_HOF_TEST_CHECK(3 == (3 | unary_pipable_c()));
+    BOOST_HOF_TEST_CHECK(3 == (unary_pipable_c(3)));
+    BOOST_HOF_STATIC_TEST_CHECK(3 == (1 | binary_pipable_c(2)));
+    BOOST_HOF_STATIC_TEST_CHECK(3 == (binary_pipable_c(1, 2)));
+    BOOST_HOF_TEST_CHECK(10 == (1 | boost::hof::pipable_c<2>(binary_class())(2) | binary_pipable_c(3) | binary_pipable_c(4)));
+    static_assert(boost::hof::function_param_limit<decltype(binary_pipable_c)>::value == 2, "limit");
+    static_assert(!boost::hof::is_invocable<decltype(binary_pipable_c), int, int, int>::value, "too many arguments");
+#if BOOST_HOF_HAS_NOEXCEPT_DEDUCTION
+    static_assert(noexcept(1 | binary_pipable_c(2)), "noexcept pipable");
+    static_assert(noexcept(binary_pipable_c(1, 2)), "noexcept pipable");
+#endif
+}
+
+namespace pipable_test {
+
+template<class T, class F, class=void>
+struct can_pipe
+: std::false_type
+{};
+
+template<class T, class F>
+struct can_pipe<T, F, decltype(void(std::declval<T>() | std::declval<F>()))>
+: std::true_type
+{};
+
+struct range
+{
+    int n;
+};
+
+// A pipe of another library, which is found along with the hidden friends
+template<class F>
+constexpr int operator|(range r, F f)
+{
+    return f(r.n, 1);
+}
+
+}
+
+static constexpr boost::hof::static_<unary_class> unary_static = {};
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(pipable_test::can_pipe<int, decltype(binary_pipable_constexpr(2))>::value, "Not pipable");
+    static_assert(pipable_test::can_pipe<int, decltype(unary_pipable)>::value, "Not pipable");
+    static_assert(pipable_test::can_pipe<int, decltype(unary_pipable_c)>::value, "Not pipable");
+    static_assert(!pipable_test::can_pipe<int, decltype(unary_static)>::value, "Only pipable functions can be piped into");
+    static_assert(!pipable_test::can_pipe<int, binary_class>::value, "Only pipable functions can be piped into");
+    BOOST_HOF_TEST_CHECK(3 == (pipable_test::range{2} | binary_class()));
+    BOOST_HOF_STATIC_TEST_CHECK(3 == (pipable_test::range{2} | binary_class()));
+}
+
+#if BOOST_HOF_HAS_RANGE_ADAPTOR_CLOSURE
+BOOST_HOF_TEST_CASE()
+{
+    auto count = boost::hof::pipable([](auto&& r, int x)
+    {
+        return std::ranges::count(r, x);
+    });
+    std::vector<int> v = {1, 2, 3, 2};
+    BOOST_HOF_TEST_CHECK(2 == (v | count(2)));
+    BOOST_HOF_TEST_CHECK(1 == (v | std::views::take(2) | count(2)));
+    auto take_count = std::views::take(2) | count(2);
+    BOOST_HOF_TEST_CHECK(1 == (v | take_count));
+}
+#endif
@@ -0,0 +1,223 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    pipeline.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/pipeline.hpp>
+#include <boost/hof/flow.hpp>
+#include <boost/hof/retry.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#if BOOST_HOF_HAS_STD_20 && defined(__cpp_lib_jthread)
+#include <stop_token>
+#endif
+#include "test.hpp"
+
+namespace pipeline_test {
+
+struct add_one
+{
+    int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+struct twice
+{
+    long operator()(int x) const
+    {
+        return 2 * x;
+    }
+};
+
+struct to_string
+{
+    std::string operator()(long x) const
+    {
+        return std::to_string(x);
+    }
+};
+
+struct box
+{
+    std::unique_ptr<int> operator()(int x) const
+    {
+        return std::unique_ptr<int>(new int(x));
+    }
+};
+
+struct unbox
+{
+    int operator()(std::unique_ptr<int> p) const
+    {
+        return *p;
+    }
+};
+
+struct throws_at
+{
+    int n;
+    int operator()(int x) const
+    {
+        if (x == n) throw std::runtime_error("pipeline failed");
+        return x;
+    }
+};
+
+struct flag_token
+{
+    const std::atomic<bool>* flag;
+    bool stop_requested() const
+    {
+        return flag->load();
+    }
+};
+
+// Requests the stop when it reaches the element
+struct stop_at
+{
+    int n;
+    std::atomic<bool>* flag;
+    int operator()(int x) const
+    {
+        if (x == n) flag->store(true);
+        return x;
+    }
+};
+
+struct counted
+{
+    std::atomic<int>* calls;
+    int operator()(int x) const
+    {
+        ++*calls;
+        return x;
+    }
+};
+
+std::vector<int> iota(int n)
+{
+    std::vector<int> v(n);
+    for(int i = 0; i < n; i++) v[i] = i;
+    return v;
+}
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace pipeline_test;
+    std::vector<int> v = iota(10000);
+    std::vector<std::string> r;
+    std::vector<std::string> expected;
+    boost::hof::pipeline(add_one(), twice(), to_string())(v, std::back_inserter(r));
+    std::transform(v.begin(), v.end(), std::back_inserter(expected), boost::hof::flow(add_one(), twice(), to_string()));
+    BOOST_HOF_TEST_CHECK(r == expected);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace pipeline_test;
+    std::vector<int> v = iota(1000);
+    std::vector<long> r(v.size());
+    auto last = boost::hof::pipeline(add_one(), add_one(), twice())(v, r.begin(), 1);
+    BOOST_HOF_TEST_CHECK(last == r.end());
+    BOOST_HOF_TEST_CHECK(r[999] == 2002);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace pipeline_test;
+    std::vector<int> v = iota(100);
+    std::vector<long> r;
+    boost::hof::pipeline(twice())(v, std::back_inserter(r));
+    BOOST_HOF_TEST_CHECK(r.size() == 100);
+    BOOST_HOF_TEST_CHECK(r[50] == 100);
+    std::vector<int> empty;
+    boost::hof::pipeline(add_one(), twice())(empty, std::back_inserter(r));
+    BOOST_HOF_TEST_CHECK(r.size() == 100);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace pipeline_test;
+    std::vector<int> v = iota(500);
+    std::vector<int> r;
+    boost::hof::pipeline(box(), unbox())(v, std::back_inserter(r), 3);
+    BOOST_HOF_TEST_CHECK(r == v);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace pipeline_test;
+    std::vector<int> v = iota(5000);
+    for(int stage = 0; stage < 3; stage++)
+    {
+        std::vector<int> r;
+        bool threw = false;
+        try
+        {
+            boost::hof::pipeline(
+                throws_at{stage == 0 ? 1000 : -1},
+                throws_at{stage == 1 ? 2000 : -1},
+                throws_at{stage == 2 ? 3000 : -1}
+            )(v, std::back_inserter(r), 16);
+        }
+        catch(const std::runtime_error&)
+        {
+            threw = true;
+        }
+        BOOST_HOF_TEST_CHECK(threw);
+        BOOST_HOF_TEST_CHECK(r.size() < v.size());
+    }
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace pipeline_test;
+    std::vector<int> v = iota(100000);
+    std::vector<int> r;
+    std::atomic<bool> flag(false);
+    std::atomic<int> calls(0);
+    boost::hof::pipeline(stop_at{1000, &flag}, add_one(), counted{&calls})(v, std::back_inserter(r), flag_token{&flag}, 16);
+    BOOST_HOF_TEST_CHECK(r.size() <= 1001);
+    BOOST_HOF_TEST_CHECK(calls.load() == static_cast<int>(r.size()));
+    for(std::size_t i = 0; i < r.size(); i++) BOOST_HOF_TEST_CHECK(r[i] == static_cast<int>(i) + 1);
+}
+
+// No stage starts once the deadline has passed
+BOOST_HOF_TEST_CASE()
+{
+    using namespace pipeline_test;
+    std::vector<int> v = iota(1000);
+    std::vector<int> r;
+    std::atomic<int> calls(0);
+    auto t = boost::hof::make_deadline_token(std::chrono::steady_clock::now());
+    boost::hof::pipeline(counted{&calls}, counted{&calls})(v, std::back_inserter(r), t);
+    BOOST_HOF_TEST_CHECK(r.empty());
+    BOOST_HOF_TEST_CHECK(calls.load() == 0);
+    auto later = boost::hof::make_deadline_token(std::chrono::steady_clock::now() + std::chrono::hours(1));
+    boost::hof::pipeline(counted{&calls}, counted{&calls})(v, std::back_inserter(r), later);
+    BOOST_HOF_TEST_CHECK(r == v);
+}
+
+#if BOOST_HOF_HAS_STD_20 && defined(__cpp_lib_jthread)
+BOOST_HOF_TEST_CASE()
+{
+    using namespace pipeline_test;
+    std::vector<int> v = iota(1000);
+    std::vector<int> r;
+    std::stop_source source;
+    source.request_stop();
+    boost::hof::pipeline(add_one(), add_one())(v, std::back_inserter(r), source.get_token());
+    BOOST_HOF_TEST_CHECK(r.empty());
+}
+#endif
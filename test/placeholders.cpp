@@ -811,3 +811,44 @@ BOOST_HOF_TEST_CASE()
     // TODO: Test post increment and decrement
 }
 
+
+namespace placeholders_test {
+
+struct counted_positive
+{
+    int* count;
+    bool operator()(int x) const
+    {
+        ++*count;
+        return x > 0;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    PLACEHOLDER_CHECK(boost::hof::if_else(boost::hof::_1, boost::hof::_2, boost::hof::_3)(true, 1, 2) == 1);
+    PLACEHOLDER_CHECK(boost::hof::if_else(boost::hof::_1, boost::hof::_2, 3)(false, 1) == 3);
+    PLACEHOLDER_CHECK(boost::hof::if_else(boost::hof::_1 > 0, boost::hof::_1, -boost::hof::_1)(-2) == 2);
+
+    int count = 0;
+    placeholders_test::counted_positive positive = {&count};
+    auto f_and = boost::hof::_1 && boost::hof::lazy(positive)(boost::hof::_2);
+    BOOST_HOF_TEST_CHECK(!f_and(false, 1));
+    BOOST_HOF_TEST_CHECK(count == 0);
+    BOOST_HOF_TEST_CHECK(f_and(true, 1));
+    BOOST_HOF_TEST_CHECK(count == 1);
+
+    auto f_or = boost::hof::_1 || boost::hof::lazy(positive)(boost::hof::_2);
+    BOOST_HOF_TEST_CHECK(f_or(true, -1));
+    BOOST_HOF_TEST_CHECK(count == 1);
+    BOOST_HOF_TEST_CHECK(!f_or(false, -1));
+    BOOST_HOF_TEST_CHECK(count == 2);
+
+    auto f_if_else = boost::hof::if_else(boost::hof::_1, boost::hof::_2, boost::hof::lazy(positive)(boost::hof::_3));
+    BOOST_HOF_TEST_CHECK(!f_if_else(true, false, 1));
+    BOOST_HOF_TEST_CHECK(count == 2);
+    BOOST_HOF_TEST_CHECK(f_if_else(false, false, 1));
+    BOOST_HOF_TEST_CHECK(count == 3);
+}
@@ -0,0 +1,105 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    pool_allocator.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/pool_allocator.hpp>
+#include <boost/hof/config.hpp>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+namespace pool_allocator_test {
+
+struct alignas(64) aligned
+{
+    char x[64];
+};
+
+struct big
+{
+    char x[512];
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::pool_allocator<int> a;
+    int* p = a.allocate(1);
+    a.deallocate(p, 1);
+    BOOST_HOF_TEST_CHECK(a.allocate(1) == p);
+    // The sizes in the same class share the free list
+    boost::hof::pool_allocator<long long> b = a;
+    b.deallocate(reinterpret_cast<long long*>(p), 1);
+    BOOST_HOF_TEST_CHECK(reinterpret_cast<int*>(b.allocate(1)) == p);
+    BOOST_HOF_TEST_CHECK(a == b);
+    BOOST_HOF_TEST_CHECK(!(a != b));
+    a.deallocate(p, 1);
+}
+
+// The blocks of another size class are not reused
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::pool_allocator<char> a;
+    char* small = a.allocate(8);
+    char* medium = a.allocate(100);
+    a.deallocate(small, 8);
+    a.deallocate(medium, 100);
+    BOOST_HOF_TEST_CHECK(a.allocate(128) == medium);
+    BOOST_HOF_TEST_CHECK(a.allocate(16) == small);
+    a.deallocate(small, 16);
+    a.deallocate(medium, 128);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::pool_allocator<pool_allocator_test::aligned> a;
+    pool_allocator_test::aligned* p = a.allocate(1);
+#if BOOST_HOF_HAS_STD_17
+    BOOST_HOF_TEST_CHECK(reinterpret_cast<std::uintptr_t>(p) % 64 == 0);
+#endif
+    a.deallocate(p, 1);
+    boost::hof::pool_allocator<pool_allocator_test::big> b;
+    pool_allocator_test::big* q = b.allocate(2);
+    b.deallocate(q, 2);
+}
+
+// The free lists only keep some of the blocks
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::pool_allocator<int> a;
+    std::vector<int*> v;
+    for (int i = 0; i < 200; i++) v.push_back(a.allocate(1));
+    for (int* p : v) a.deallocate(p, 1);
+    for (int*& p : v) p = a.allocate(1);
+    for (int* p : v) a.deallocate(p, 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto s = std::allocate_shared<int>(boost::hof::pool_allocator<int>(), 3);
+    BOOST_HOF_TEST_CHECK(*s == 3);
+    std::vector<int, boost::hof::pool_allocator<int>> v;
+    for (int i = 0; i < 100; i++) v.push_back(i);
+    BOOST_HOF_TEST_CHECK(v[99] == 99);
+}
+
+// A block can be freed on another thread, which keeps it
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::pool_allocator<int> a;
+    int* p = a.allocate(1);
+    int* q = nullptr;
+    std::thread t([&]
+    {
+        a.deallocate(p, 1);
+        q = a.allocate(1);
+        a.deallocate(q, 1);
+    });
+    t.join();
+    BOOST_HOF_TEST_CHECK(q == p);
+}
@@ -0,0 +1,115 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    power.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/power.hpp>
+#include <boost/hof/repeat.hpp>
+#include <cstdint>
+#include "test.hpp"
+
+namespace power_test {
+
+struct lcg
+{
+    std::uint32_t a;
+    std::uint32_t c;
+    constexpr std::uint32_t operator()(std::uint32_t x) const
+    {
+        return a * x + c;
+    }
+};
+
+// Maps (f(n), f(n+1)) to (f(n+1), f(n) + f(n+1)) with the matrix [[0 1] [1 1]]
+struct fib_step
+{
+    unsigned long long m00, m01, m10, m11;
+
+    struct state
+    {
+        unsigned long long x, y;
+    };
+
+    constexpr state operator()(state s) const
+    {
+        return state{m00 * s.x + m01 * s.y, m10 * s.x + m11 * s.y};
+    }
+};
+
+struct increment
+{
+    constexpr int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+}
+
+namespace boost { namespace hof {
+
+template<>
+struct compose_rule<power_test::lcg>
+{
+    static constexpr power_test::lcg apply(const power_test::lcg& f, const power_test::lcg& g)
+    {
+        return power_test::lcg{f.a * g.a, f.a * g.c + f.c};
+    }
+
+    static constexpr power_test::lcg identity(const power_test::lcg&)
+    {
+        return power_test::lcg{1, 0};
+    }
+};
+
+template<>
+struct compose_rule<power_test::fib_step>
+{
+    typedef power_test::fib_step m;
+
+    static constexpr m apply(const m& f, const m& g)
+    {
+        return m{
+            f.m00 * g.m00 + f.m01 * g.m10, f.m00 * g.m01 + f.m01 * g.m11,
+            f.m10 * g.m00 + f.m11 * g.m10, f.m10 * g.m01 + f.m11 * g.m11
+        };
+    }
+
+    static constexpr m identity(const m&)
+    {
+        return m{1, 0, 0, 1};
+    }
+};
+
+}} // namespace boost::hof
+
+BOOST_HOF_TEST_CASE()
+{
+    power_test::lcg next{1664525, 1013904223};
+    for (int n = 0; n < 40; n++)
+    {
+        BOOST_HOF_TEST_CHECK(boost::hof::power(next, n)(7) == boost::hof::repeat(n)(next)(7));
+    }
+    BOOST_HOF_TEST_CHECK(boost::hof::power(next, 100000)(7) == boost::hof::repeat(100000)(next)(7));
+    BOOST_HOF_TEST_CHECK(boost::hof::power(next, -1)(7) == 7);
+    STATIC_ASSERT_SAME(decltype(boost::hof::power(next, 3)), power_test::lcg);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    power_test::fib_step step{0, 1, 1, 1};
+    BOOST_HOF_TEST_CHECK(boost::hof::power(step, 10)(power_test::fib_step::state{0, 1}).x == 55);
+    BOOST_HOF_TEST_CHECK(boost::hof::power(step, 90)(power_test::fib_step::state{0, 1}).x == 2880067194370816120ull);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::power(power_test::fib_step{0, 1, 1, 1}, 20)(power_test::fib_step::state{0, 1}).x == 6765);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::power(power_test::fib_step{0, 1, 1, 1}, std::integral_constant<int, 20>())(power_test::fib_step::state{0, 1}).x == 6765);
+}
+
+// Without a rule, the function is repeated
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::power(power_test::increment(), 5)(1) == 6);
+    BOOST_HOF_TEST_CHECK(boost::hof::power(power_test::increment(), 0)(1) == 1);
+    BOOST_HOF_TEST_CHECK(boost::hof::power(power_test::increment(), std::integral_constant<int, 3>())(1) == 4);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::power(power_test::increment(), std::integral_constant<int, 3>())(1) == 4);
+}
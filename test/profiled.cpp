@@ -0,0 +1,162 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    profiled.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#define BOOST_HOF_PROFILING 1
+#include <boost/hof/profiled.hpp>
+#include <boost/hof/function.hpp>
+#include "test.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace profiled_test {
+
+struct sum_name
+{
+    constexpr const char* operator()() const
+    {
+        return "profiled_sum";
+    }
+};
+
+struct void_name
+{
+    constexpr const char* operator()() const
+    {
+        return "profiled_void";
+    }
+};
+
+struct throws
+{
+    int operator()(int x) const
+    {
+        if (x < 0) throw std::runtime_error("negative");
+        return x;
+    }
+};
+
+}
+
+BOOST_HOF_STATIC_FUNCTION(profiled_sum) = boost::hof::profiled(profiled_test::sum_name())(binary_class());
+
+BOOST_HOF_STATIC_FUNCTION(profiled_void) = boost::hof::profiled(profiled_test::void_name())(void_class());
+
+#if BOOST_HOF_HAS_INLINE_VARIABLES
+BOOST_HOF_STATIC_FUNCTION(profiled_literal) = boost::hof::profiled("profiled_literal")(binary_class());
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(3 == profiled_literal(1, 2));
+    BOOST_HOF_TEST_CHECK(boost::hof::profile_read("profiled_literal").count == 1);
+}
+#endif
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::profile_read("profiled_sum").count == 0);
+    BOOST_HOF_TEST_CHECK(3 == profiled_sum(1, 2));
+    BOOST_HOF_TEST_CHECK(5 == profiled_sum(2, 3));
+    auto s = boost::hof::profile_read("profiled_sum");
+    BOOST_HOF_TEST_CHECK(s.count == 2);
+    std::uint64_t n = 0;
+    for (auto b : s.buckets) n += b;
+    BOOST_HOF_TEST_CHECK(n == 2);
+    BOOST_HOF_TEST_CHECK(s.percentile(50) <= s.percentile(100));
+    profiled_void(1);
+    BOOST_HOF_TEST_CHECK(boost::hof::profile_read("profiled_void").count == 1);
+    BOOST_HOF_TEST_CHECK(boost::hof::profile_read("profiled_unknown").count == 0);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // Names with the same contents are merged
+    std::string name = "profiled_sum";
+    auto before = boost::hof::profile_read("profiled_sum").count;
+    auto f = boost::hof::profiled("profiled_sum")(binary_class());
+    BOOST_HOF_TEST_CHECK(3 == f(1, 2));
+    BOOST_HOF_TEST_CHECK(boost::hof::profile_read(name.c_str()).count == before + 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // A call that throws is still recorded
+    auto f = boost::hof::profiled("profiled_throws")(profiled_test::throws());
+    BOOST_HOF_TEST_CHECK(f(1) == 1);
+    bool thrown = false;
+    try
+    {
+        f(-1);
+    }
+    catch(const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    BOOST_HOF_TEST_CHECK(thrown);
+    BOOST_HOF_TEST_CHECK(boost::hof::profile_read("profiled_throws").count == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The calls of every thread are merged, even after the threads exit
+    auto f = boost::hof::profiled("profiled_threads")(binary_class());
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) threads.emplace_back([&] {
+        for (int j = 0; j < 100; j++) f(i, j);
+    });
+    for (auto& t : threads) t.join();
+    BOOST_HOF_TEST_CHECK(boost::hof::profile_read("profiled_threads").count == 400);
+    std::thread([&] { f(1, 2); }).join();
+    BOOST_HOF_TEST_CHECK(boost::hof::profile_read("profiled_threads").count == 401);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    typedef boost::hof::profile_stats stats;
+    for (std::uint64_t ns : { 0, 1, 7, 8, 9, 15, 16, 100, 1000, 123456789 })
+    {
+        std::size_t i = stats::bucket_index(ns);
+        BOOST_HOF_TEST_CHECK(i < stats::bucket_count);
+        BOOST_HOF_TEST_CHECK(stats::bucket_value(i) <= ns);
+        BOOST_HOF_TEST_CHECK(ns - stats::bucket_value(i) <= ns / 8);
+    }
+    BOOST_HOF_TEST_CHECK(stats::bucket_index(std::uint64_t(-1)) == stats::bucket_count - 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::profiled("profiled_each_b")(binary_class());
+    auto g = boost::hof::profiled("profiled_each_a")(binary_class());
+    f(1, 2);
+    f(1, 2);
+    std::thread([&] { f(1, 2); g(1, 2); }).join();
+    std::vector<std::string> names;
+    std::uint64_t count_a = 0;
+    std::uint64_t count_b = 0;
+    boost::hof::profile_for_each([&](const char* name, const boost::hof::profile_stats& s)
+    {
+        names.push_back(name);
+        if (std::string(name) == "profiled_each_a") count_a = s.count;
+        if (std::string(name) == "profiled_each_b") count_b = s.count;
+    });
+    // Each name is enumerated once, in order, with the calls of every thread
+    for (std::size_t i = 1; i < names.size(); i++) BOOST_HOF_TEST_CHECK(names[i - 1] < names[i]);
+    BOOST_HOF_TEST_CHECK(count_a == 1);
+    BOOST_HOF_TEST_CHECK(count_b == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::profiled("profiled_\"export\"")(binary_class());
+    for (int i = 0; i < 5; i++) f(i, i);
+    std::string text = boost::hof::profile_prometheus("hof_latency");
+    BOOST_HOF_TEST_CHECK(text.find("# TYPE hof_latency histogram\n") == 0);
+    BOOST_HOF_TEST_CHECK(text.find("hof_latency_count{function=\"profiled_\\\"export\\\"\"} 5\n") != std::string::npos);
+    BOOST_HOF_TEST_CHECK(text.find("hof_latency_bucket{function=\"profiled_\\\"export\\\"\",le=\"+Inf\"} 5\n") != std::string::npos);
+    BOOST_HOF_TEST_CHECK(text.find("hof_latency_sum{function=\"profiled_\\\"export\\\"\"} ") != std::string::npos);
+}
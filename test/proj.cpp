@@ -9,6 +9,7 @@
 #include <boost/hof/mutable.hpp>
 #include "test.hpp"
 
+#include <functional>
 #include <memory>
 
 struct foo
@@ -45,6 +46,11 @@ BOOST_HOF_TEST_CASE()
     auto add = boost::hof::_ + boost::hof::_;
     BOOST_HOF_STATIC_TEST_CHECK(boost::hof::proj(select_x(), add)(foo(1), foo(2)) == 3);
     BOOST_HOF_TEST_CHECK(boost::hof::proj(&foo::x, add)(foo(1), foo(2)) == 3);
+    foo a(1), b(2);
+    BOOST_HOF_TEST_CHECK(boost::hof::proj(&foo::x, add)(&a, &b) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::proj(&foo::x, add)(std::ref(a), std::cref(b)) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::proj(&foo::x, [](int& x) { return x; })(a) == 1);
+    BOOST_HOF_TEST_CHECK(boost::hof::proj(&foo::x, [](int&& x) { return x; })(foo(2)) == 2);
     static_assert(boost::hof::detail::is_default_constructible<decltype(boost::hof::proj(select_x(), add))>::value, "Not default constructible");
 }
 
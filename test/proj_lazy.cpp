@@ -0,0 +1,92 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    proj_lazy.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/proj_lazy.hpp>
+#include <memory>
+#include <string>
+#include "test.hpp"
+
+namespace proj_lazy_test {
+
+struct counted_key
+{
+    int* calls;
+
+    int operator()(int x) const
+    {
+        (*calls)++;
+        return x * 2;
+    }
+};
+
+// Compares the keys in order, and stops at the first one that differs
+struct lexicographic_less
+{
+    template<class T, class U, class V, class W>
+    bool operator()(T a1, U a2, V b1, W b2) const
+    {
+        if (a1() != b1()) return a1() < b1();
+        return a2() < b2();
+    }
+};
+
+struct first_member
+{
+    const std::string& operator()(const std::pair<std::string, int>& p) const
+    {
+        return p.first;
+    }
+};
+
+struct take_ptr
+{
+    std::unique_ptr<int> operator()(std::unique_ptr<int>&& p) const
+    {
+        return std::move(p);
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace proj_lazy_test;
+    int calls = 0;
+    auto less = boost::hof::proj_lazy(counted_key{&calls}, lexicographic_less());
+    BOOST_HOF_TEST_CHECK(less(1, 5, 2, 0));
+    // The second keys aren't projected, and the first keys only once
+    BOOST_HOF_TEST_CHECK(calls == 2);
+
+    calls = 0;
+    BOOST_HOF_TEST_CHECK(!less(1, 5, 1, 4));
+    BOOST_HOF_TEST_CHECK(calls == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace proj_lazy_test;
+    int calls = 0;
+    // The projections convert to their results
+    BOOST_HOF_TEST_CHECK(boost::hof::proj_lazy(counted_key{&calls}, [](int x, int y) { return x + y; })(1, 2) == 6);
+    BOOST_HOF_TEST_CHECK(calls == 2);
+    BOOST_HOF_TEST_CHECK(boost::hof::proj_lazy(counted_key{&calls}, [](int) { return 0; })(1) == 0);
+    BOOST_HOF_TEST_CHECK(calls == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace proj_lazy_test;
+    std::pair<std::string, int> p("key", 1);
+    // References returned by the projection aren't copied
+    const std::string* r = boost::hof::proj_lazy(first_member(), [](const std::string& s) { return &s; })(p);
+    BOOST_HOF_TEST_CHECK(r == &p.first);
+
+    auto get = [](const std::unique_ptr<int>& x) { return *x; };
+    auto twice = [&](const std::unique_ptr<int>& x, const std::unique_ptr<int>& y) { return get(x) + get(y); };
+    std::unique_ptr<int> a(new int(1));
+    std::unique_ptr<int> b(new int(2));
+    BOOST_HOF_TEST_CHECK(boost::hof::proj_lazy(take_ptr(), twice)(std::move(a), std::move(b)) == 3);
+}
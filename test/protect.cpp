@@ -300,3 +300,18 @@ BOOST_HOF_TEST_CASE()
 }
 
 }
+
+// A protected expression is passed to the function without being checked
+// for the other kinds of arguments
+BOOST_HOF_TEST_CASE()
+{
+    auto lazy_id = boost::hof::lazy(f)(std::placeholders::_1);
+    typedef decltype(boost::hof::protect(lazy_id)) protected_type;
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::detail::lazy_kind<protected_type>::value == 4);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::detail::lazy_kind<decltype(lazy_id)>::value == 1);
+    auto apply = [](const protected_type& p, int x) { return p(x) + 1; };
+    auto nested = boost::hof::lazy(apply)(boost::hof::protect(lazy_id), std::placeholders::_1);
+    BOOST_HOF_TEST_CHECK(nested(3) == 4);
+    auto twice_nested = boost::hof::lazy(apply)(boost::hof::protect(lazy_id), boost::hof::lazy(apply)(boost::hof::protect(lazy_id), std::placeholders::_1));
+    BOOST_HOF_TEST_CHECK(twice_nested(3) == 5);
+}
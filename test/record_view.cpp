@@ -0,0 +1,76 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    record_view.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/record_view.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <boost/hof/proj.hpp>
+#include <boost/hof/unpack.hpp>
+#include <array>
+#include <cstdint>
+#include "test.hpp"
+
+namespace record_view_test {
+
+enum class kind : std::uint8_t
+{
+    none,
+    data
+};
+
+typedef boost::hof::record_layout<kind, std::uint16_t, std::int32_t, double, bool> message;
+
+struct first_two
+{
+    template<class K, class S, class... Ts>
+    std::uint16_t operator()(K k, S s, Ts...) const
+    {
+        return static_cast<kind>(k) == kind::data ? static_cast<std::uint16_t>(s) : 0;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace record_view_test;
+    typedef boost::hof::record_view<message> view;
+    BOOST_HOF_STATIC_TEST_CHECK(view::size == 16);
+
+    std::array<unsigned char, 2 * view::size + 1> buffer;
+    // Store the records unaligned
+    std::size_t n = boost::hof::serialize_into(buffer)(
+        std::uint8_t(0), kind::data, std::uint16_t(7), std::int32_t(-3), 1.5, true, 
+        kind::none, std::uint16_t(8), std::int32_t(4), 2.5, false
+    );
+    BOOST_HOF_TEST_CHECK(n == buffer.size());
+
+    view v(buffer.data() + 1);
+    BOOST_HOF_TEST_CHECK(v.get<1>() == 7);
+    BOOST_HOF_TEST_CHECK(v.get<2>() == -3);
+    BOOST_HOF_TEST_CHECK(v.get<3>() == 1.5);
+    BOOST_HOF_TEST_CHECK(v.get<4>());
+    BOOST_HOF_TEST_CHECK(boost::hof::decode_field(v.get<0>()) == kind::data);
+
+    auto sum = boost::hof::proj(boost::hof::decode_field, [](kind, std::uint16_t s, std::int32_t i, double d, bool b) {
+        return s + i + d + (b ? 1 : 0);
+    });
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(sum)(v) == 6.5);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(sum)(v.next()) == 14.5);
+    BOOST_HOF_TEST_CHECK(v.next().data() == buffer.data() + 1 + view::size);
+
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(first_two())(v) == 7);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(first_two())(v.next()) == 0);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    typedef boost::hof::record_view<boost::hof::record_layout<std::uint16_t, std::uint32_t>, boost::hof::record_big_endian> view;
+    const unsigned char buffer[] = { 0x01, 0x02, 0x01, 0x02, 0x03, 0x04 };
+    view v(buffer);
+    BOOST_HOF_TEST_CHECK(v.get<0>() == 0x0102);
+    BOOST_HOF_TEST_CHECK(v.get<1>() == 0x01020304);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(boost::hof::proj(boost::hof::decode_field, boost::hof::_1 + boost::hof::_2))(v) == 0x01020406);
+}
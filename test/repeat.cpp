@@ -64,3 +64,96 @@ BOOST_HOF_TEST_CASE()
     BOOST_HOF_STATIC_TEST_CHECK(boost::hof::repeat(BOOST_HOF_RECURSIVE_CONSTEXPR_DEPTH+4)(increment())(0) == BOOST_HOF_RECURSIVE_CONSTEXPR_DEPTH+4);
 #endif
 }
+
+struct increment_inplace
+{
+    template<class T>
+#if !BOOST_HOF_NO_CONSTEXPR_VOID
+    constexpr
+#endif
+    void operator()(T& x) const noexcept
+    {
+        x++;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat(5)(increment_inplace())(1) == 6);
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat(0)(increment_inplace())(1) == 1);
+    int i = 1;
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat(5)(increment_inplace())(i) == 6);
+    BOOST_HOF_TEST_CHECK(i == 1);
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::repeat(5)(increment_inplace())(1) == 6);
+#endif
+#if BOOST_HOF_HAS_NOEXCEPT_DEDUCTION
+    static_assert(noexcept(boost::hof::repeat(5)(increment_inplace())(1)), "noexcept repeat");
+#endif
+}
+
+struct move_counter
+{
+    int value;
+    int* moves;
+    move_counter(int v, int* m) : value(v), moves(m)
+    {}
+    move_counter(move_counter&& rhs) : value(rhs.value), moves(rhs.moves)
+    {
+        ++*moves;
+    }
+    move_counter& operator=(move_counter&& rhs)
+    {
+        value = rhs.value;
+        moves = rhs.moves;
+        ++*moves;
+        return *this;
+    }
+};
+
+struct increment_counter
+{
+    void operator()(move_counter& x) const
+    {
+        x.value++;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    int moves = 0;
+    move_counter x = boost::hof::repeat(1000)(increment_counter())(move_counter(1, &moves));
+    BOOST_HOF_TEST_CHECK(x.value == 1001);
+    BOOST_HOF_TEST_CHECK(moves < 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat(std::integral_constant<int, 1024>())(increment())(0) == 1024);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::repeat(std::integral_constant<int, 1024>())(increment())(0) == 1024);
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat(std::integral_constant<int, 0>())(increment())(0) == 0);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::repeat(std::integral_constant<int, 0>())(increment())(0) == 0);
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat(std::integral_constant<int, 5>())(increment_inplace())(1) == 6);
+}
+
+struct sum2
+{
+    template<class T>
+    constexpr T operator()(T x) const noexcept
+    {
+        return x + 1;
+    }
+
+    template<class T, class U>
+    constexpr T operator()(T x, U y) const noexcept
+    {
+        return x + y;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat(std::integral_constant<int, 7>())(sum2())(1, 2) == 9);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::repeat(std::integral_constant<int, 7>())(sum2())(1, 2) == 9);
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat(7)(sum2())(1, 2) == 9);
+}
@@ -93,3 +93,67 @@ BOOST_HOF_TEST_CASE()
     BOOST_HOF_STATIC_TEST_CHECK(boost::hof::repeat_while(not_limit())(increment())(1) == BOOST_HOF_RECURSIVE_CONSTEXPR_DEPTH+4);
 #endif
 }
+
+struct less_than
+{
+    template<class T, class U>
+    constexpr bool operator()(T x, U y) const
+    {
+        return x < y;
+    }
+
+    template<class T>
+    constexpr bool operator()(T x) const
+    {
+        return x < 10;
+    }
+};
+
+struct add
+{
+    template<class T, class U>
+    constexpr T operator()(T x, U y) const
+    {
+        return x + y;
+    }
+
+    template<class T>
+    constexpr T operator()(T x) const
+    {
+        return x + 1;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat_while_depth<0>(not_limit())(increment())(1) == BOOST_HOF_RECURSIVE_CONSTEXPR_DEPTH+4);
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat_while_depth<2>(not_limit())(increment())(1) == BOOST_HOF_RECURSIVE_CONSTEXPR_DEPTH+4);
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat_while_depth<0>(not_6())(increment())(6) == 6);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::repeat_while_depth<8>(not_6())(increment())(1) == 6);
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::repeat_while_depth<0>(not_limit())(increment())(1) == BOOST_HOF_RECURSIVE_CONSTEXPR_DEPTH+4);
+#endif
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat_while_depth<0>(less_than())(add())(1, 5) == 10);
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat_while_depth<0>(less_than())(add())(5, 1) == 5);
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat_while_depth<2>(less_than())(add())(1, 5) == 10);
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat_while(less_than())(add())(1, 5) == 10);
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::repeat_while(less_than())(add())(1, 5) == 10);
+#endif
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert
+    (
+        std::is_same<
+            std::integral_constant<int, 6>, 
+            decltype(boost::hof::repeat_while_depth<0>(not_6_constant())(increment_constant())(std::integral_constant<int, 1>()))
+        >::value,
+        "Error"
+    );
+}
@@ -0,0 +1,110 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    repeat_while_step.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/repeat_while_step.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include "test.hpp"
+
+#include <vector>
+
+namespace repeat_while_step_test {
+
+template<class T>
+struct maybe
+{
+    bool engaged;
+    T value;
+
+    constexpr maybe() : engaged(false), value()
+    {}
+
+    constexpr maybe(T x) : engaged(true), value(x)
+    {}
+
+    constexpr explicit operator bool() const
+    {
+        return engaged;
+    }
+
+    constexpr const T& operator*() const
+    {
+        return value;
+    }
+};
+
+struct increment_until_6
+{
+    constexpr maybe<int> operator()(int x) const
+    {
+        return x < 6 ? maybe<int>(x + 1) : maybe<int>();
+    }
+};
+
+struct point
+{
+    int x;
+    int y;
+};
+
+struct walk
+{
+    maybe<point> operator()(point p) const
+    {
+        if (p.x * p.y >= 100) return maybe<point>();
+        point r = { p.x + 1, p.y + 2 };
+        return r;
+    }
+};
+
+struct node
+{
+    int value;
+    const node * next;
+};
+
+// Stops at the first node with a negative value, or at the last node
+struct find_negative
+{
+    maybe<const node *> operator()(const node * n) const
+    {
+        if (n->value < 0 || n->next == nullptr) return maybe<const node *>();
+        return n->next;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat_while_step(repeat_while_step_test::increment_until_6())(1) == 6);
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat_while_step(repeat_while_step_test::increment_until_6())(6) == 6);
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat_while_step(repeat_while_step_test::increment_until_6())(8) == 8);
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::repeat_while_step(repeat_while_step_test::increment_until_6())(1) == 6);
+#endif
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    repeat_while_step_test::point p = { 0, 0 };
+    auto r = boost::hof::repeat_while_step(repeat_while_step_test::walk())(p);
+    BOOST_HOF_TEST_CHECK(r.x == 8);
+    BOOST_HOF_TEST_CHECK(r.y == 16);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    const repeat_while_step_test::node c = { 3, nullptr };
+    const repeat_while_step_test::node b = { -2, &c };
+    const repeat_while_step_test::node a = { 1, &b };
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat_while_step(repeat_while_step_test::find_negative())(&a) == &b);
+    BOOST_HOF_TEST_CHECK(boost::hof::repeat_while_step(repeat_while_step_test::find_negative())(&c) == &c);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(!boost::hof::is_invocable<decltype(boost::hof::repeat_while_step(repeat_while_step_test::increment_until_6())), std::vector<int>>::value, "Not callable");
+}
@@ -0,0 +1,67 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    requires_sfinae.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L && !defined(_MSC_VER)
+#define BOOST_HOF_HAS_REQUIRES_SFINAE 1
+#endif
+#include <boost/hof/flow.hpp>
+#include <boost/hof/compose.hpp>
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include "test.hpp"
+
+namespace requires_sfinae_test {
+
+struct increment
+{
+    template<class T>
+    constexpr T operator()(T x) const noexcept
+    {
+        return x + 1;
+    }
+};
+
+struct pointer_f
+{
+    int operator()(int*) const
+    {
+        return 2;
+    }
+};
+
+struct member
+{
+    int x;
+};
+
+struct get_member
+{
+    const int& operator()(const member& m) const
+    {
+        return m.x;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::flow(requires_sfinae_test::increment(), requires_sfinae_test::increment(), requires_sfinae_test::increment());
+    BOOST_HOF_TEST_CHECK(f(1) == 4);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::flow(requires_sfinae_test::increment(), requires_sfinae_test::increment())(1) == 3);
+    static_assert(noexcept(f(1)), "noexcept");
+    auto g = boost::hof::compose(requires_sfinae_test::pointer_f(), boost::hof::identity);
+    static_assert(boost::hof::is_invocable<decltype(g), int*>::value, "Not callable");
+    static_assert(!boost::hof::is_invocable<decltype(g), int>::value, "Callable");
+    auto h = boost::hof::first_of(requires_sfinae_test::pointer_f(), requires_sfinae_test::increment());
+    BOOST_HOF_TEST_CHECK(h(nullptr) == 2);
+    BOOST_HOF_TEST_CHECK(h(1) == 2);
+    // References are returned as they are
+    auto r = boost::hof::compose(requires_sfinae_test::get_member(), boost::hof::identity);
+    requires_sfinae_test::member m = { 1 };
+    STATIC_ASSERT_SAME(decltype(r(m)), const int&);
+    BOOST_HOF_TEST_CHECK(&r(m) == &m.x);
+}
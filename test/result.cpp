@@ -24,3 +24,87 @@ BOOST_HOF_TEST_CASE()
 {
     STATIC_ASSERT_SAME(decltype(unary_void(false)), void);
 }
+
+struct copy_counted
+{
+    int copies;
+    copy_counted() : copies(0)
+    {}
+    copy_counted(const copy_counted& x) : copies(x.copies + 1)
+    {}
+};
+
+struct make_copy_counted
+{
+    copy_counted operator()() const
+    {
+        return copy_counted();
+    }
+};
+
+struct throwing_move
+{
+    throwing_move()
+    {}
+    throwing_move(throwing_move&&) noexcept(false)
+    {}
+};
+
+struct make_throwing_move
+{
+    throwing_move operator()() const noexcept
+    {
+        return throwing_move();
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::result<copy_counted>(make_copy_counted())().copies == 0);
+#if BOOST_HOF_HAS_STD_17
+    BOOST_HOF_STATIC_TEST_CHECK(noexcept(boost::hof::result<throwing_move>(make_throwing_move())()));
+#endif
+}
+
+#if BOOST_HOF_HAS_STD_17
+struct pinned
+{
+    int value;
+    pinned(int x) : value(x)
+    {}
+    pinned(pinned&&)=delete;
+};
+
+struct make_pinned
+{
+    pinned operator()(int x) const
+    {
+        return pinned(x);
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    pinned p = boost::hof::result<pinned>(make_pinned())(3);
+    BOOST_HOF_TEST_CHECK(p.value == 3);
+}
+#endif
+
+struct void_count
+{
+    int* calls;
+    int operator()(int x) const
+    {
+        ++*calls;
+        return x;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    int calls = 0;
+    auto f = boost::hof::result<void>(void_count{&calls});
+    STATIC_ASSERT_SAME(decltype(f(1)), void);
+    f(1);
+    BOOST_HOF_TEST_CHECK(calls == 1);
+}
@@ -0,0 +1,194 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    retry.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/retry.hpp>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include "test.hpp"
+
+namespace retry_test {
+
+struct failure : std::runtime_error
+{
+    failure() : std::runtime_error("failure")
+    {}
+};
+
+struct flaky
+{
+    int* calls;
+    int failures;
+
+    int operator()(int x) const
+    {
+        if (++*calls <= failures) throw failure();
+        return x;
+    }
+};
+
+struct append
+{
+    int* calls;
+
+    std::string operator()(std::string& s) const
+    {
+        s += "x";
+        if (++*calls < 2) throw failure();
+        return s;
+    }
+};
+
+struct no_retry
+{
+    std::size_t attempts() const
+    {
+        return 1;
+    }
+
+    std::chrono::nanoseconds delay(std::size_t) const
+    {
+        return std::chrono::nanoseconds(0);
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int calls = 0;
+    auto f = boost::hof::retry(boost::hof::exponential_backoff(3))(retry_test::flaky{&calls, 2});
+    BOOST_HOF_TEST_CHECK(f(5) == 5);
+    BOOST_HOF_TEST_CHECK(calls == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int calls = 0;
+    auto f = boost::hof::retry(boost::hof::exponential_backoff(3, std::chrono::microseconds(1)))(retry_test::flaky{&calls, 3});
+    bool thrown = false;
+    try
+    {
+        f(5);
+    }
+    catch(const retry_test::failure&)
+    {
+        thrown = true;
+    }
+    BOOST_HOF_TEST_CHECK(thrown);
+    BOOST_HOF_TEST_CHECK(calls == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int calls = 0;
+    auto f = boost::hof::retry(retry_test::no_retry())(retry_test::flaky{&calls, 1});
+    bool thrown = false;
+    try
+    {
+        f(5);
+    }
+    catch(const retry_test::failure&)
+    {
+        thrown = true;
+    }
+    BOOST_HOF_TEST_CHECK(thrown);
+    BOOST_HOF_TEST_CHECK(calls == 1);
+}
+
+// The arguments are passed to each attempt as lvalues
+BOOST_HOF_TEST_CASE()
+{
+    int calls = 0;
+    std::string s;
+    BOOST_HOF_TEST_CHECK(boost::hof::retry(boost::hof::exponential_backoff(2))(retry_test::append{&calls})(s) == "xx");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    constexpr boost::hof::exponential_backoff p(8, std::chrono::nanoseconds(10), std::chrono::nanoseconds(50));
+    BOOST_HOF_TEST_CHECK(p.attempts() == 8);
+    BOOST_HOF_TEST_CHECK(p.delay(1) == std::chrono::nanoseconds(10));
+    BOOST_HOF_TEST_CHECK(p.delay(2) == std::chrono::nanoseconds(20));
+    BOOST_HOF_TEST_CHECK(p.delay(3) == std::chrono::nanoseconds(40));
+    BOOST_HOF_TEST_CHECK(p.delay(4) == std::chrono::nanoseconds(50));
+    BOOST_HOF_TEST_CHECK(p.delay(100) == std::chrono::nanoseconds(50));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int calls = 0;
+    auto d = std::chrono::steady_clock::now() + std::chrono::hours(1);
+    BOOST_HOF_TEST_CHECK(boost::hof::with_deadline(d)(retry_test::flaky{&calls, 0})(3) == 3);
+    BOOST_HOF_TEST_CHECK(calls == 1);
+}
+
+// A deadline that has passed stops the retries
+BOOST_HOF_TEST_CASE()
+{
+    int calls = 0;
+    auto d = std::chrono::steady_clock::now();
+    auto f = boost::hof::retry(boost::hof::exponential_backoff(5))(boost::hof::with_deadline(d)(retry_test::flaky{&calls, 0}));
+    bool thrown = false;
+    try
+    {
+        f(3);
+    }
+    catch(const boost::hof::deadline_exceeded&)
+    {
+        thrown = true;
+    }
+    BOOST_HOF_TEST_CHECK(thrown);
+    BOOST_HOF_TEST_CHECK(calls == 0);
+}
+
+namespace retry_test {
+
+struct flag_token
+{
+    const bool* flag;
+    bool stop_requested() const
+    {
+        return *flag;
+    }
+};
+
+}
+
+// A stop that has been requested stops the retries
+BOOST_HOF_TEST_CASE()
+{
+    int calls = 0;
+    bool stopped = false;
+    auto f = boost::hof::retry(boost::hof::exponential_backoff(5))(
+        boost::hof::with_stop_token(retry_test::flag_token{&stopped})(retry_test::flaky{&calls, 0})
+    );
+    BOOST_HOF_TEST_CHECK(f(3) == 3);
+    BOOST_HOF_TEST_CHECK(calls == 1);
+    stopped = true;
+    bool thrown = false;
+    try
+    {
+        f(3);
+    }
+    catch(const boost::hof::operation_cancelled&)
+    {
+        thrown = true;
+    }
+    BOOST_HOF_TEST_CHECK(thrown);
+    BOOST_HOF_TEST_CHECK(calls == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto passed = boost::hof::make_deadline_token(std::chrono::steady_clock::now());
+    auto later = boost::hof::make_deadline_token(std::chrono::steady_clock::now() + std::chrono::hours(1));
+    BOOST_HOF_TEST_CHECK(passed.stop_requested());
+    BOOST_HOF_TEST_CHECK(!later.stop_requested());
+    int calls = 0;
+    BOOST_HOF_TEST_CHECK(boost::hof::with_stop_token(later)(retry_test::flaky{&calls, 0})(3) == 3);
+    BOOST_HOF_TEST_CHECK(calls == 1);
+}
@@ -0,0 +1,86 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    select.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/select.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <boost/hof/lazy.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <memory>
+#include "test.hpp"
+
+namespace select_test {
+
+struct digits
+{
+    template<class... Ts>
+    constexpr int operator()(Ts... xs) const
+    {
+        return fold(0, xs...);
+    }
+
+    static constexpr int fold(int x)
+    {
+        return x;
+    }
+
+    template<class... Ts>
+    static constexpr int fold(int x, int y, Ts... ys)
+    {
+        return fold(x*10 + y, ys...);
+    }
+};
+
+struct categories
+{
+    template<class T, class U>
+    constexpr int operator()(T&&, U&&) const
+    {
+        return (std::is_lvalue_reference<T>::value ? 10 : 0) + (std::is_lvalue_reference<U>::value ? 1 : 0);
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(312 == boost::hof::select<2, 0, 1>(select_test::digits())(1, 2, 3));
+    BOOST_HOF_STATIC_TEST_CHECK(312 == boost::hof::select<2, 0, 1>(select_test::digits())(1, 2, 3));
+    BOOST_HOF_TEST_CHECK(331 == boost::hof::select<2, 2, 0>(select_test::digits())(1, 2, 3));
+    BOOST_HOF_STATIC_TEST_CHECK(331 == boost::hof::select<2, 2, 0>(select_test::digits())(1, 2, 3));
+    BOOST_HOF_TEST_CHECK(4 == boost::hof::select<3>(select_test::digits())(1, 2, 3, 4));
+    BOOST_HOF_TEST_CHECK(0 == boost::hof::select<>(select_test::digits())(1, 2, 3));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(
+        boost::hof::lazy(select_test::digits())(boost::hof::_3, boost::hof::_1, boost::hof::_2)(1, 2, 3) == 
+        boost::hof::select<2, 0, 1>(select_test::digits())(1, 2, 3)
+    );
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // A duplicated argument is passed as an lvalue
+    int x = 1;
+    BOOST_HOF_TEST_CHECK(0 == boost::hof::select<0, 1>(select_test::categories())(1, 2));
+    BOOST_HOF_TEST_CHECK(10 == boost::hof::select<1, 0>(select_test::categories())(1, x));
+    BOOST_HOF_TEST_CHECK(11 == boost::hof::select<0, 0>(select_test::categories())(1, 2));
+    BOOST_HOF_STATIC_TEST_CHECK(11 == boost::hof::select<0, 0>(select_test::categories())(1, 2));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::unique_ptr<int> p(new int(3));
+    auto f = boost::hof::select<1>([](std::unique_ptr<int> q) { return *q; });
+    BOOST_HOF_TEST_CHECK(3 == f(1, std::move(p)));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(!boost::hof::is_invocable<decltype(boost::hof::select<2>(select_test::digits())), int, int>::value, "Index out of range");
+    static_assert(boost::hof::is_invocable<decltype(boost::hof::select<2>(select_test::digits())), int, int, int>::value, "Invocable");
+}
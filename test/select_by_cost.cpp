@@ -0,0 +1,138 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    select_by_cost.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/select_by_cost.hpp>
+#include <boost/hof/if.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <array>
+#include <type_traits>
+#include "test.hpp"
+
+namespace select_by_cost_test {
+
+template<int Cost, int Id>
+struct alternative
+{
+    static constexpr int cost = Cost;
+
+    constexpr int operator()(int) const
+    {
+        return Id;
+    }
+};
+
+struct no_cost
+{
+    constexpr int operator()(int) const
+    {
+        return 0;
+    }
+};
+
+struct only_strings
+{
+    static constexpr int cost = -1;
+
+    int operator()(const char*) const
+    {
+        return 9;
+    }
+};
+
+struct small_sort
+{
+    static constexpr int cost = 1;
+
+    template<class T, std::size_t N, class=typename std::enable_if<(N <= 16)>::type>
+    constexpr int operator()(const std::array<T, N>&) const
+    {
+        return 1;
+    }
+};
+
+struct large_sort
+{
+    static constexpr int cost = 4;
+
+    template<class T, std::size_t N>
+    constexpr int operator()(const std::array<T, N>&) const
+    {
+        return 2;
+    }
+};
+
+// A cost that depends on the arguments
+struct sized
+{
+    template<class T>
+    constexpr int operator()(const T&) const
+    {
+        return 3;
+    }
+};
+
+}
+
+namespace boost { namespace hof {
+
+template<std::size_t N>
+struct function_cost<select_by_cost_test::sized, std::array<int, N>&>
+: std::integral_constant<long long, (N > 8 ? 10 : 0)>
+{};
+
+}}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace select_by_cost_test;
+    constexpr auto f = boost::hof::select_by_cost(alternative<3, 1>(), alternative<1, 2>(), alternative<2, 3>());
+    BOOST_HOF_TEST_CHECK(f(0) == 2);
+    BOOST_HOF_STATIC_TEST_CHECK(f(0) == 2);
+    // The first of the cheapest functions is called
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::select_by_cost(alternative<1, 1>(), alternative<1, 2>())(0) == 1);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::select_by_cost(alternative<1, 1>(), no_cost())(0) == 0);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::function_cost<no_cost>::value == 0);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::function_cost<alternative<5, 0>>::value == 5);
+}
+
+// Functions that can't be called are skipped
+BOOST_HOF_TEST_CASE()
+{
+    using namespace select_by_cost_test;
+    auto f = boost::hof::select_by_cost(only_strings(), alternative<2, 1>());
+    BOOST_HOF_TEST_CHECK(f(0) == 1);
+    BOOST_HOF_TEST_CHECK(f("") == 9);
+    BOOST_HOF_STATIC_TEST_CHECK(!boost::hof::is_invocable<decltype(f), std::array<int, 1>>::value);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace select_by_cost_test;
+    constexpr auto sort = boost::hof::select_by_cost(large_sort(), small_sort());
+    BOOST_HOF_STATIC_TEST_CHECK(sort(std::array<int, 4>{}) == 1);
+    BOOST_HOF_STATIC_TEST_CHECK(sort(std::array<int, 64>{}) == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace select_by_cost_test;
+    constexpr auto f = boost::hof::select_by_cost(
+        alternative<3, 1>(),
+        boost::hof::if_(std::false_type())(alternative<0, 2>()),
+        boost::hof::if_(std::true_type())(alternative<1, 3>())
+    );
+    BOOST_HOF_STATIC_TEST_CHECK(f(0) == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace select_by_cost_test;
+    auto f = boost::hof::select_by_cost(large_sort(), sized());
+    std::array<int, 4> small = {};
+    std::array<int, 64> large = {};
+    BOOST_HOF_TEST_CHECK(f(small) == 3);
+    BOOST_HOF_TEST_CHECK(f(large) == 2);
+}
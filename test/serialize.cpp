@@ -0,0 +1,101 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    serialize.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/serialize.hpp>
+#include <boost/hof/unpack.hpp>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "test.hpp"
+
+namespace serialize_test {
+
+enum class kind : std::uint8_t
+{
+    ping = 7,
+    pong
+};
+
+struct message
+{
+    kind k;
+    std::int16_t delta;
+    std::uint32_t length;
+    double weight;
+    bool last;
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::array<unsigned char, 8> buffer = {};
+    BOOST_HOF_TEST_CHECK(boost::hof::serialize_into(buffer)(std::uint16_t(0x0102), std::uint32_t(0x03040506)) == 6);
+    BOOST_HOF_TEST_CHECK(buffer[0] == 0x02);
+    BOOST_HOF_TEST_CHECK(buffer[1] == 0x01);
+    BOOST_HOF_TEST_CHECK(buffer[2] == 0x06);
+    BOOST_HOF_TEST_CHECK(buffer[5] == 0x03);
+    BOOST_HOF_TEST_CHECK(buffer[6] == 0);
+    std::uint16_t x = 0;
+    std::uint32_t y = 0;
+    BOOST_HOF_TEST_CHECK(boost::hof::deserialize_from(buffer)(x, y) == 6);
+    BOOST_HOF_TEST_CHECK(x == 0x0102);
+    BOOST_HOF_TEST_CHECK(y == 0x03040506);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<unsigned char> buffer(4, 0xff);
+    bool caught = false;
+    try
+    {
+        boost::hof::serialize_into(buffer)(std::uint32_t(1), std::uint8_t(2));
+    }
+    catch(const std::out_of_range&)
+    {
+        caught = true;
+    }
+    BOOST_HOF_TEST_CHECK(caught);
+    // Nothing is written when the buffer is too small
+    BOOST_HOF_TEST_CHECK(buffer[0] == 0xff);
+    BOOST_HOF_STATIC_TEST_CHECK(!boost::hof::is_invocable<decltype(boost::hof::serialize_into(buffer)), std::vector<int>>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!boost::hof::is_invocable<decltype(boost::hof::deserialize_from(buffer)), const int&>::value);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<unsigned char> buffer(16);
+    serialize_test::message m = { serialize_test::kind::pong, -3, 40, 0.5, true };
+    auto t = std::make_tuple(m.k, m.delta, m.length, m.weight, m.last);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(boost::hof::serialize_into(buffer))(t) == 16);
+    BOOST_HOF_TEST_CHECK(buffer[0] == 8);
+    BOOST_HOF_TEST_CHECK(buffer[15] == 1);
+    serialize_test::message r = {};
+    auto rt = std::tie(r.k, r.delta, r.length, r.weight, r.last);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(boost::hof::deserialize_from(buffer))(rt) == 16);
+    BOOST_HOF_TEST_CHECK(r.k == serialize_test::kind::pong);
+    BOOST_HOF_TEST_CHECK(r.delta == -3);
+    BOOST_HOF_TEST_CHECK(r.length == 40);
+    BOOST_HOF_TEST_CHECK(r.weight == 0.5);
+    BOOST_HOF_TEST_CHECK(r.last);
+}
+
+#if BOOST_HOF_UNPACK_AGGREGATES
+BOOST_HOF_TEST_CASE()
+{
+    std::array<unsigned char, 16> buffer = {};
+    serialize_test::message m = { serialize_test::kind::ping, 5, 6, 1.5, false };
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(boost::hof::serialize_into(buffer))(m) == 16);
+    serialize_test::message r = {};
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(boost::hof::deserialize_from(buffer))(r) == 16);
+    BOOST_HOF_TEST_CHECK(r.k == serialize_test::kind::ping);
+    BOOST_HOF_TEST_CHECK(r.delta == 5);
+    BOOST_HOF_TEST_CHECK(r.length == 6);
+    BOOST_HOF_TEST_CHECK(r.weight == 1.5);
+    BOOST_HOF_TEST_CHECK(!r.last);
+}
+#endif
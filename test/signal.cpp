@@ -0,0 +1,101 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    signal.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/signal.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include "test.hpp"
+
+namespace signal_test {
+
+struct add
+{
+    int* total;
+    void operator()(int x) const
+    {
+        *total += x;
+    }
+};
+
+struct record
+{
+    std::vector<int>* calls;
+    int id;
+    int operator()(int) const
+    {
+        calls->push_back(id);
+        return id;
+    }
+};
+
+struct move_only
+{
+    std::unique_ptr<int> p;
+    void operator()(std::string& s) const
+    {
+        s += std::to_string(*p);
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int total = 0;
+    boost::hof::signal<void(int)> s;
+    BOOST_HOF_TEST_CHECK(s.empty());
+    s(1);
+    s.connect(signal_test::add{&total});
+    s.connect(signal_test::add{&total});
+    s.connect([&](int x) { total += 10 * x; });
+    BOOST_HOF_TEST_CHECK(s.size() == 3);
+    s(2);
+    BOOST_HOF_TEST_CHECK(total == 24);
+    s.clear();
+    BOOST_HOF_TEST_CHECK(s.empty());
+    s(2);
+    BOOST_HOF_TEST_CHECK(total == 24);
+}
+
+// The functions of a type are called together, in the order they are connected
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> calls;
+    int total = 0;
+    boost::hof::signal<int(int)> s;
+    s.connect(signal_test::record{&calls, 1});
+    s.connect(signal_test::add{&total});
+    s.connect(signal_test::record{&calls, 2});
+    s.connect(signal_test::record{&calls, 3});
+    s(5);
+    BOOST_HOF_TEST_CHECK(calls == std::vector<int>({1, 2, 3}));
+    BOOST_HOF_TEST_CHECK(total == 5);
+}
+
+// The arguments are passed as lvalues, and the functions can be move only
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::signal<void(std::string&)> s;
+    s.connect(signal_test::move_only{std::unique_ptr<int>(new int(1))});
+    s.connect(signal_test::move_only{std::unique_ptr<int>(new int(2))});
+    std::string r;
+    s(r);
+    BOOST_HOF_TEST_CHECK(r == "12");
+    boost::hof::signal<void(std::string&)> t = std::move(s);
+    t(r);
+    BOOST_HOF_TEST_CHECK(r == "1212");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int total = 0;
+    boost::hof::signal<void(std::string)> s;
+    s.connect([&](const std::string& x) { total += int(x.size()); });
+    s.connect([&](std::string x) { total += int(x.size()); });
+    s(std::string("abc"));
+    BOOST_HOF_TEST_CHECK(total == 6);
+}
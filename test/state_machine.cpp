@@ -0,0 +1,139 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    state_machine.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/state_machine.hpp>
+#include "test.hpp"
+
+#if BOOST_HOF_HAS_STD_VARIANT
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <variant>
+
+namespace state_machine_test {
+
+struct idle {};
+struct running { int ticks; };
+struct stopped { std::string reason; };
+
+struct start {};
+struct tick {};
+struct halt { std::string reason; };
+
+typedef std::variant<idle, running, stopped> state;
+typedef std::variant<start, tick, halt> event;
+
+struct door
+{
+    running operator()(idle, start) const
+    {
+        return running{0};
+    }
+
+    running operator()(running r, tick) const
+    {
+        return running{r.ticks + 1};
+    }
+
+    template<class S>
+    stopped operator()(const S&, const halt& h) const
+    {
+        return stopped{h.reason};
+    }
+};
+
+struct throw_on_copy
+{
+    throw_on_copy()
+    {}
+
+    throw_on_copy(const throw_on_copy&)
+    {
+        throw std::runtime_error("copy");
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace state_machine_test;
+    auto m = boost::hof::state_machine(door());
+    state s = idle{};
+    s = m(s, event(tick{}));
+    BOOST_HOF_TEST_CHECK(s.index() == 0);
+    s = m(s, event(start{}));
+    BOOST_HOF_TEST_CHECK(std::get<running>(s).ticks == 0);
+    s = m(s, event(start{}));
+    BOOST_HOF_TEST_CHECK(std::get<running>(s).ticks == 0);
+    s = m(s, event(tick{}));
+    s = m(s, event(tick{}));
+    BOOST_HOF_TEST_CHECK(std::get<running>(s).ticks == 2);
+    s = m(s, event(halt{"done"}));
+    BOOST_HOF_TEST_CHECK(std::get<stopped>(s).reason == "done");
+    s = m(s, event(start{}));
+    BOOST_HOF_TEST_CHECK(std::get<stopped>(s).reason == "done");
+}
+
+// A single event, and transitions from lambdas
+BOOST_HOF_TEST_CASE()
+{
+    using namespace state_machine_test;
+    auto m = boost::hof::state_machine(
+        [](idle, start) { return running{10}; },
+        [](const running& r, tick) { return running{r.ticks * 2}; }
+    );
+    state s = idle{};
+    s = m(s, tick{});
+    BOOST_HOF_TEST_CHECK(s.index() == 0);
+    s = m(s, start{});
+    s = m(s, tick{});
+    BOOST_HOF_TEST_CHECK(std::get<running>(s).ticks == 20);
+    s = m(std::move(s), halt{"ignored"});
+    BOOST_HOF_TEST_CHECK(std::get<running>(s).ticks == 20);
+}
+
+// The state is moved when it is an rvalue
+BOOST_HOF_TEST_CASE()
+{
+    typedef std::variant<std::unique_ptr<int>, int> ptr_state;
+    auto m = boost::hof::state_machine(
+        [](std::unique_ptr<int>&& p, int) { return *p; }
+    );
+    ptr_state s = std::unique_ptr<int>(new int(3));
+    ptr_state r = m(std::move(s), 0);
+    BOOST_HOF_TEST_CHECK(std::get<int>(r) == 3);
+    r = m(std::move(r), 0);
+    BOOST_HOF_TEST_CHECK(std::get<int>(r) == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace state_machine_test;
+    typedef std::variant<int, throw_on_copy> throwing_state;
+    auto m = boost::hof::state_machine(door());
+    throwing_state s = 1;
+    try
+    {
+        s.emplace<1>(throw_on_copy(throw_on_copy()));
+    }
+    catch(const std::runtime_error&)
+    {}
+    BOOST_HOF_TEST_CHECK(s.valueless_by_exception());
+    bool thrown = false;
+    try
+    {
+        m(s, start{});
+    }
+    catch(const std::bad_variant_access&)
+    {
+        thrown = true;
+    }
+    BOOST_HOF_TEST_CHECK(thrown);
+}
+
+#endif
@@ -22,3 +22,48 @@ BOOST_HOF_TEST_CASE()
     BOOST_HOF_TEST_CHECK(3 == binary_static(1, 2));
     BOOST_HOF_TEST_CHECK(3 == mono_static(2));
 }
+
+namespace static_test {
+
+struct times_function
+{
+    double factor;
+    times_function() : factor(2)
+    {}
+    template<class T>
+    T operator()(T x) const
+    {
+        return x*factor;
+    }
+};
+
+struct plus_factor
+{
+    int factor = 3;
+    template<class T>
+    constexpr T operator()(T x) const
+    {
+        return x+factor;
+    }
+};
+
+}
+
+static constexpr boost::hof::static_<static_test::times_function> times2 = {};
+
+static constexpr boost::hof::static_<static_test::plus_factor> plus3 = {};
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(boost::hof::detail::is_constant_default_constructible<binary_class>::value, "Not constant");
+    static_assert(boost::hof::detail::is_constant_default_constructible<static_test::plus_factor>::value, "Not constant");
+    static_assert(!boost::hof::detail::is_constant_default_constructible<static_test::times_function>::value, "Constant");
+
+    // Stored as a constant
+    BOOST_HOF_TEST_CHECK(&plus3.base_function() == &boost::hof::detail::static_const_storage<static_test::plus_factor>::value);
+    BOOST_HOF_TEST_CHECK(4 == plus3(1));
+
+    // Constructed on the first call
+    BOOST_HOF_TEST_CHECK(&times2.base_function() == &times2.base_function());
+    BOOST_HOF_TEST_CHECK(6 == times2(3));
+}
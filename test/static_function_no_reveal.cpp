@@ -0,0 +1,48 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    static_function_no_reveal.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#define BOOST_HOF_REVEAL_STATIC_FUNCTIONS 0
+#include <boost/hof/function.hpp>
+#include <boost/hof/lambda.hpp>
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/identity.hpp>
+#include <boost/hof/reveal.hpp>
+#include "test.hpp"
+
+namespace static_function_no_reveal_test {
+
+struct sum_f
+{
+    template<class T, class U>
+    constexpr T operator()(T x, U y) const
+    {
+        return x+y;
+    }
+};
+
+// Without the wrapper, the type of the function is the type of the expression
+BOOST_HOF_STATIC_FUNCTION(sum) = sum_f();
+STATIC_ASSERT_SAME(std::decay<decltype(sum)>::type, sum_f);
+
+BOOST_HOF_STATIC_FUNCTION(sum_or_identity) = boost::hof::first_of(sum_f(), boost::hof::identity);
+
+BOOST_HOF_STATIC_LAMBDA_FUNCTION(twice) = [](int x)
+{
+    return 2 * x;
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(sum(1, 2) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(sum(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(sum_or_identity(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(sum_or_identity(4) == 4);
+    BOOST_HOF_TEST_CHECK(twice(3) == 6);
+    // The function can still be revealed explicitly
+    BOOST_HOF_TEST_CHECK(boost::hof::reveal(sum)(1, 2) == 3);
+}
+
+}
@@ -0,0 +1,119 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    static_if.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/static_if.hpp>
+#include <boost/hof/eval.hpp>
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/always.hpp>
+#include "test.hpp"
+
+namespace static_if_test {
+
+struct add_f
+{
+    template<class T>
+    constexpr T operator()(T x, T y) const
+    {
+        return x + y;
+    }
+};
+
+struct sub_f
+{
+    template<class T>
+    constexpr T operator()(T x, T y) const
+    {
+        return x - y;
+    }
+};
+
+// Fails to compile when its call operator is instantiated
+struct broken_f
+{
+    template<class T>
+    T operator()(T x) const
+    {
+        return x.not_a_member();
+    }
+};
+
+struct int_f
+{
+    constexpr int operator()(int x) const
+    {
+        return x;
+    }
+};
+
+template<class T>
+struct pick
+{
+    constexpr int operator()(T x) const
+    {
+        return boost::hof::static_if(std::is_integral<T>())(int_f())(broken_f())(x);
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace static_if_test;
+    BOOST_HOF_TEST_CHECK(boost::hof::static_if(std::true_type())(add_f())(sub_f())(3, 2) == 5);
+    BOOST_HOF_TEST_CHECK(boost::hof::static_if(std::false_type())(add_f())(sub_f())(3, 2) == 1);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::static_if(std::true_type())(add_f())(sub_f())(3, 2) == 5);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::static_if(std::false_type())(add_f())(sub_f())(3, 2) == 1);
+    BOOST_HOF_TEST_CHECK(pick<int>()(4) == 4);
+    BOOST_HOF_STATIC_TEST_CHECK(pick<int>()(4) == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace static_if_test;
+    // Only the chosen function constrains the call, so it can be used with
+    // first_of even when the other function doesn't accept the arguments
+    auto f = boost::hof::first_of(
+        boost::hof::static_if(std::true_type())(int_f())(broken_f()),
+        boost::hof::always(-1)
+    );
+    BOOST_HOF_TEST_CHECK(f(3) == 3);
+    BOOST_HOF_TEST_CHECK(f("") == -1);
+    auto g = boost::hof::static_if(std::false_type())(int_f())(add_f());
+    STATIC_ASSERT_SAME(decltype(g(1L, 2L)), long);
+    BOOST_HOF_TEST_CHECK(g(1, 2) == 3);
+}
+
+#if BOOST_HOF_HAS_GENERIC_LAMBDA
+namespace static_if_test {
+
+struct counter
+{
+    int n;
+    void increment() { n++; }
+};
+
+template<class T>
+void increment_kindof(T& x)
+{
+    boost::hof::eval(boost::hof::static_if(std::is_integral<T>())([&](auto id) {
+        ++id(x);
+    })([&](auto id) {
+        id(x).increment();
+    }));
+}
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int i = 1;
+    static_if_test::increment_kindof(i);
+    BOOST_HOF_TEST_CHECK(i == 2);
+    static_if_test::counter c = {1};
+    static_if_test::increment_kindof(c);
+    BOOST_HOF_TEST_CHECK(c.n == 2);
+}
+#endif
@@ -0,0 +1,143 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    static_lazy.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/static_lazy.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include "test.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace static_lazy_test {
+
+static std::atomic<int> table_count(0);
+
+struct squares_table
+{
+    std::vector<int> table;
+    squares_table()
+    {
+        table_count++;
+        for(int i=0;i<100;i++) table.push_back(i*i);
+    }
+    int operator()(int x) const
+    {
+        return table[x];
+    }
+};
+
+static std::atomic<int> shared_count(0);
+
+struct shared_table
+{
+    int factor;
+    shared_table() : factor(2)
+    {
+        shared_count++;
+        std::this_thread::yield();
+    }
+    int operator()(int x) const
+    {
+        return x*factor;
+    }
+};
+
+static int throw_count = 0;
+
+struct throws_once
+{
+    int value;
+    throws_once() : value(7)
+    {
+        if (throw_count++ == 0) throw std::runtime_error("Failed");
+    }
+    int operator()() const
+    {
+        return value;
+    }
+};
+
+struct warm_table
+{
+    int value;
+    warm_table() : value(3)
+    {
+        table_count++;
+    }
+    int operator()() const
+    {
+        return value;
+    }
+};
+
+}
+
+BOOST_HOF_STATIC_FUNCTION_LAZY(square, static_lazy_test::squares_table);
+BOOST_HOF_STATIC_FUNCTION_LAZY(lazy_binary, binary_class);
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(static_lazy_test::table_count == 0);
+    BOOST_HOF_TEST_CHECK(square(5) == 25);
+    BOOST_HOF_TEST_CHECK(square(9) == 81);
+    BOOST_HOF_TEST_CHECK(&square.base_function() == &square.base_function());
+    BOOST_HOF_TEST_CHECK(static_lazy_test::table_count == 1);
+    static_assert(!boost::hof::is_invocable<decltype(square), int*>::value, "Callable");
+    static_assert(!boost::hof::is_invocable<decltype(square)>::value, "Callable");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The warm up constructs it before the first call
+    boost::hof::static_lazy<static_lazy_test::warm_table> f;
+    int before = static_lazy_test::table_count;
+    f.warm_up();
+    BOOST_HOF_TEST_CHECK(static_lazy_test::table_count == before + 1);
+    f.warm_up();
+    BOOST_HOF_TEST_CHECK(f() == 3);
+    BOOST_HOF_TEST_CHECK(static_lazy_test::table_count == before + 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::static_lazy<static_lazy_test::shared_table> f;
+    std::vector<std::thread> threads;
+    std::atomic<int> sum(0);
+    for(int i=0;i<8;i++) threads.emplace_back([&f, &sum, i]
+    {
+        sum += f(i);
+    });
+    for(auto& t:threads) t.join();
+    BOOST_HOF_TEST_CHECK(sum == 2*(0+1+2+3+4+5+6+7));
+    BOOST_HOF_TEST_CHECK(static_lazy_test::shared_count == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::static_lazy<static_lazy_test::throws_once> f;
+    bool thrown = false;
+    try
+    {
+        f();
+    }
+    catch(const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    BOOST_HOF_TEST_CHECK(thrown);
+    BOOST_HOF_TEST_CHECK(f() == 7);
+    BOOST_HOF_TEST_CHECK(static_lazy_test::throw_count == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // A constant function is stored without the lazy initialization
+    BOOST_HOF_TEST_CHECK(lazy_binary(1, 2) == 3);
+    BOOST_HOF_TEST_CHECK(&lazy_binary.base_function() == &boost::hof::detail::static_const_storage<binary_class>::value);
+    lazy_binary.warm_up();
+}
@@ -0,0 +1,124 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    static_vector.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/static_vector.hpp>
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/unpack_n.hpp>
+#include <boost/hof/is_unpackable.hpp>
+#include "test.hpp"
+
+#include <memory>
+#include <stdexcept>
+
+namespace static_vector_test {
+
+struct sum
+{
+    constexpr int operator()() const
+    {
+        return 0;
+    }
+
+    template<class T, class... Ts>
+    constexpr int operator()(T x, Ts... xs) const
+    {
+        return x + sum()(xs...);
+    }
+};
+
+struct count_f
+{
+    template<class... Ts>
+    constexpr long operator()(Ts&&...) const
+    {
+        return sizeof...(Ts);
+    }
+};
+
+struct owner_count
+{
+    template<class... Ts>
+    int operator()(Ts&&... xs) const
+    {
+        int n = 0;
+        for (bool b : { std::is_rvalue_reference<Ts&&>::value..., true }) n += b;
+        (void)std::initializer_list<int>{((void)std::unique_ptr<int>(BOOST_HOF_FORWARD(Ts)(xs)), 0)...};
+        return n - 1;
+    }
+};
+
+static constexpr boost::hof::static_vector<int, 3> empty_vector = {};
+
+static constexpr boost::hof::static_vector<int, 3> two_vector(1, 2);
+
+static constexpr boost::hof::static_vector<int, 3> full_vector(1, 2, 3);
+
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+constexpr boost::hof::static_vector<int, 4> make_evens(int n)
+{
+    boost::hof::static_vector<int, 4> v;
+    for (int i = 0; i < n; i++) v.push_back(2 * i);
+    return v;
+}
+#endif
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(boost::hof::is_unpackable<boost::hof::static_vector<int, 3>>::value, "Not unpackable");
+    BOOST_HOF_STATIC_TEST_CHECK(static_vector_test::empty_vector.empty());
+    BOOST_HOF_STATIC_TEST_CHECK(static_vector_test::two_vector.size() == 2);
+    BOOST_HOF_STATIC_TEST_CHECK(static_vector_test::two_vector[1] == 2);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::static_vector<int, 3>::capacity() == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(static_vector_test::sum())(static_vector_test::empty_vector) == 0);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(static_vector_test::sum())(static_vector_test::two_vector) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(static_vector_test::sum())(static_vector_test::full_vector) == 6);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(static_vector_test::sum())(boost::hof::static_vector<int, 3>(1, 2)) == 3);
+    static_assert(!std::is_convertible<int*, boost::hof::static_vector<int, 3>>::value, "Elements must be convertible");
+    static_assert(!std::is_constructible<boost::hof::static_vector<int, 1>, int, int>::value, "Elements must fit in the capacity");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::static_vector<int, 3> v;
+    v.push_back(1);
+    v.push_back(2);
+    BOOST_HOF_TEST_CHECK(v.size() == 2);
+    BOOST_HOF_TEST_CHECK(v.end() - v.begin() == 2);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(static_vector_test::sum())(v) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack_n<3>(static_vector_test::sum())(v) == 3);
+    v.push_back(3);
+    bool full = false;
+    try { v.push_back(4); }
+    catch (const std::length_error&) { full = true; }
+    BOOST_HOF_TEST_CHECK(full);
+    v.pop_back();
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(static_vector_test::sum())(v) == 3);
+    v.clear();
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(static_vector_test::sum())(v) == 0);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The results are converted to the common type
+    STATIC_ASSERT_SAME(decltype(boost::hof::unpack(static_vector_test::count_f())(boost::hof::static_vector<int, 2>())), long);
+    boost::hof::static_vector<std::unique_ptr<int>, 2> v;
+    v.push_back(std::unique_ptr<int>(new int(1)));
+    v.push_back(std::unique_ptr<int>(new int(2)));
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(static_vector_test::owner_count())(std::move(v)) == 2);
+    BOOST_HOF_TEST_CHECK(!v[0] && !v[1]);
+}
+
+#if BOOST_HOF_HAS_RELAXED_CONSTEXPR
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(static_vector_test::sum())(boost::hof::static_vector<int, 3>(1, 2)) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(static_vector_test::make_evens(3).size() == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(static_vector_test::sum())(static_vector_test::make_evens(3)) == 6);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(static_vector_test::sum())(static_vector_test::make_evens(0)) == 0);
+}
+#endif
@@ -0,0 +1,42 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    std_sequences.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#define BOOST_HOF_UNPACK_STD_SEQUENCES 0
+#include <boost/hof/unpack.hpp>
+#include <boost/hof/is_unpackable.hpp>
+#include "test.hpp"
+
+namespace std_sequences_test {
+
+// The arrays can be unpacked without the std sequences
+constexpr int numbers[] = {1, 2};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::is_unpackable<decltype(std_sequences_test::numbers)>::value);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(binary_class())(std_sequences_test::numbers) == 3);
+}
+
+// The tuples can be unpacked without the std sequences as well
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::is_unpackable<std::pair<int, int>>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::is_unpackable<std::tuple<int, int>>::value);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(binary_class())(std::make_pair(1, 2)) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(binary_class())(std::make_tuple(1, 2)) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(binary_class())(std::forward_as_tuple(1, 2)) == 3);
+}
+
+#include <boost/hof/std_sequences.hpp>
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::is_unpackable<std::array<int, 2>>::value);
+    std::array<int, 2> a = {{1, 2}};
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(binary_class())(a) == 3);
+}
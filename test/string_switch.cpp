@@ -0,0 +1,136 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    string_switch.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/string_switch.hpp>
+#include <stdexcept>
+#include <string>
+#include "test.hpp"
+#if BOOST_HOF_HAS_STD_STRING_VIEW
+#include <string_view>
+#endif
+
+namespace string_switch_test {
+
+template<int Id>
+struct id
+{
+    template<class... Ts>
+    int operator()(Ts&&...) const
+    {
+        return Id;
+    }
+};
+
+struct second
+{
+    template<class S>
+    int operator()(const S&, int x) const
+    {
+        return x;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::string_switch(
+        boost::hof::string_case("get")(string_switch_test::id<1>()),
+        boost::hof::string_case("put")(string_switch_test::id<2>()),
+        boost::hof::string_case("post")(string_switch_test::id<3>()),
+        boost::hof::string_case("")(string_switch_test::id<4>()),
+        string_switch_test::id<0>()
+    );
+    BOOST_HOF_TEST_CHECK(f("get") == 1);
+    BOOST_HOF_TEST_CHECK(f("put") == 2);
+    BOOST_HOF_TEST_CHECK(f("post") == 3);
+    BOOST_HOF_TEST_CHECK(f("") == 4);
+    BOOST_HOF_TEST_CHECK(f("ge") == 0);
+    BOOST_HOF_TEST_CHECK(f("gets") == 0);
+    BOOST_HOF_TEST_CHECK(f("delete") == 0);
+    BOOST_HOF_TEST_CHECK(f(std::string("put")) == 2);
+    BOOST_HOF_TEST_CHECK(f(std::string("patch")) == 0);
+#if BOOST_HOF_HAS_STD_STRING_VIEW
+    BOOST_HOF_TEST_CHECK(f(std::string_view("posts", 4)) == 3);
+#endif
+}
+
+// The other arguments are passed to the case
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::string_switch(
+        boost::hof::string_case("second")(string_switch_test::second()),
+        string_switch_test::id<0>()
+    );
+    BOOST_HOF_TEST_CHECK(f("second", 5) == 5);
+    BOOST_HOF_TEST_CHECK(f("first", 5) == 0);
+}
+
+// The first case is called for a repeated key, and the cases after the default are never used
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::string_switch(
+        boost::hof::string_case("a")(string_switch_test::id<1>()),
+        boost::hof::string_case("a")(string_switch_test::id<2>()),
+        string_switch_test::id<0>(),
+        boost::hof::string_case("b")(string_switch_test::id<3>())
+    );
+    BOOST_HOF_TEST_CHECK(f("a") == 1);
+    BOOST_HOF_TEST_CHECK(f("b") == 0);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::string_switch(
+        boost::hof::string_case("one")(string_switch_test::id<1>())
+    );
+    BOOST_HOF_TEST_CHECK(f("one") == 1);
+    bool thrown = false;
+    try
+    {
+        f("two");
+    }
+    catch(const std::out_of_range&)
+    {
+        thrown = true;
+    }
+    BOOST_HOF_TEST_CHECK(thrown);
+}
+
+// Enough keys that some of them share a bucket
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::string_switch(
+        boost::hof::string_case("alpha")(string_switch_test::id<1>()),
+        boost::hof::string_case("beta")(string_switch_test::id<2>()),
+        boost::hof::string_case("gamma")(string_switch_test::id<3>()),
+        boost::hof::string_case("delta")(string_switch_test::id<4>()),
+        boost::hof::string_case("epsilon")(string_switch_test::id<5>()),
+        boost::hof::string_case("zeta")(string_switch_test::id<6>()),
+        boost::hof::string_case("eta")(string_switch_test::id<7>()),
+        boost::hof::string_case("theta")(string_switch_test::id<8>()),
+        boost::hof::string_case("iota")(string_switch_test::id<9>()),
+        boost::hof::string_case("kappa")(string_switch_test::id<10>()),
+        boost::hof::string_case("lambda")(string_switch_test::id<11>()),
+        boost::hof::string_case("mu")(string_switch_test::id<12>()),
+        boost::hof::string_case("nu")(string_switch_test::id<13>()),
+        boost::hof::string_case("xi")(string_switch_test::id<14>()),
+        boost::hof::string_case("omicron")(string_switch_test::id<15>()),
+        boost::hof::string_case("pi")(string_switch_test::id<16>()),
+        boost::hof::string_case("rho")(string_switch_test::id<17>()),
+        string_switch_test::id<0>()
+    );
+    const char* names[] = {
+        "alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta", "theta", "iota",
+        "kappa", "lambda", "mu", "nu", "xi", "omicron", "pi", "rho"
+    };
+    for (int i = 0; i < 17; i++)
+    {
+        BOOST_HOF_TEST_CHECK(f(names[i]) == i + 1);
+        BOOST_HOF_TEST_CHECK(f(std::string(names[i]) + "s") == 0);
+    }
+    BOOST_HOF_TEST_CHECK(f("sigma") == 0);
+}
@@ -0,0 +1,101 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    swappable.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/swappable.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+namespace swappable_test {
+
+struct scale
+{
+    int factor;
+    std::shared_ptr<int> destroyed;
+    scale(int x, std::shared_ptr<int> d=nullptr) : factor(x), destroyed(d)
+    {}
+    scale(scale&& rhs) : factor(rhs.factor), destroyed(std::move(rhs.destroyed))
+    {}
+    ~scale()
+    {
+        if (destroyed) ++*destroyed;
+    }
+    int operator()(int x) const
+    {
+        return x*factor;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::swappable<int(int)> f(boost::hof::_1 + 1);
+    BOOST_HOF_TEST_CHECK(f);
+    BOOST_HOF_TEST_CHECK(f(1) == 2);
+    f.store(swappable_test::scale(10));
+    BOOST_HOF_TEST_CHECK(f(1) == 10);
+    f.reset();
+    BOOST_HOF_TEST_CHECK(!f);
+    bool caught = false;
+    try
+    {
+        f(1);
+    }
+    catch(const std::bad_function_call&)
+    {
+        caught = true;
+    }
+    BOOST_HOF_TEST_CHECK(caught);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto destroyed = std::make_shared<int>(0);
+    {
+        boost::hof::swappable<int(int)> f(swappable_test::scale(2, destroyed));
+        BOOST_HOF_TEST_CHECK(*destroyed == 0);
+        f.store(swappable_test::scale(3, destroyed));
+        BOOST_HOF_TEST_CHECK(*destroyed == 1);
+        BOOST_HOF_TEST_CHECK(f(1) == 3);
+    }
+    BOOST_HOF_TEST_CHECK(*destroyed == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::string s;
+    boost::hof::swappable<void(const std::string&)> f([&s](const std::string& x) { s += x; return s.size(); });
+    f("a");
+    f("b");
+    BOOST_HOF_TEST_CHECK(s == "ab");
+    boost::hof::swappable<int(std::unique_ptr<int>)> g([](std::unique_ptr<int> p) { return *p; });
+    BOOST_HOF_TEST_CHECK(g(std::unique_ptr<int>(new int(3))) == 3);
+    BOOST_HOF_STATIC_TEST_CHECK(!std::is_constructible<boost::hof::swappable<int(int)>, std::string>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!std::is_copy_constructible<boost::hof::swappable<int(int)>>::value);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::swappable<int(int)> slot(swappable_test::scale(1));
+    const auto& f = slot;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) threads.emplace_back([&f]
+    {
+        for (int j = 0; j < 1000; j++)
+        {
+            int r = f(1);
+            BOOST_HOF_TEST_CHECK(r >= 1 && r <= 3);
+        }
+    });
+    slot.store(swappable_test::scale(2));
+    slot.store(swappable_test::scale(3));
+    for (auto& t : threads) t.join();
+    BOOST_HOF_TEST_CHECK(f(1) == 3);
+}
@@ -0,0 +1,67 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    synchronized.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/synchronized.hpp>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+namespace synchronized_test {
+
+struct counter
+{
+    int n;
+    counter() : n(0)
+    {}
+    int operator()()
+    {
+        return ++n;
+    }
+    int operator()(int x)
+    {
+        n += x;
+        return n;
+    }
+};
+
+template<class F>
+void check_threads(F& f)
+{
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) threads.emplace_back([&f] { for (int j = 0; j < 1000; j++) f(); });
+    for (auto& t : threads) t.join();
+}
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::synchronized(synchronized_test::counter());
+    BOOST_HOF_TEST_CHECK(f() == 1);
+    BOOST_HOF_TEST_CHECK(f(2) == 3);
+    synchronized_test::check_threads(f);
+    BOOST_HOF_TEST_CHECK(f(0) == 4003);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    const auto f = boost::hof::synchronized(synchronized_test::counter(), boost::hof::synchronized_spinlock());
+    BOOST_HOF_TEST_CHECK(f() == 1);
+    synchronized_test::check_threads(f);
+    BOOST_HOF_TEST_CHECK(f(0) == 4001);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // Copies don't share the state
+    auto f = boost::hof::synchronized(synchronized_test::counter());
+    f();
+    auto g = f;
+    BOOST_HOF_TEST_CHECK(g() == 2);
+    BOOST_HOF_TEST_CHECK(f(0) == 1);
+    auto h = std::move(g);
+    BOOST_HOF_TEST_CHECK(h(0) == 2);
+}
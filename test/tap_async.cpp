@@ -0,0 +1,125 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tap_async.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/tap_async.hpp>
+#include <boost/hof/flow.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+namespace tap_async_test {
+
+struct recorder
+{
+    std::shared_ptr<std::vector<std::string>> values;
+
+    void operator()(std::string s) const
+    {
+        values->push_back(std::move(s));
+    }
+
+    void operator()(int x) const
+    {
+        values->push_back(std::to_string(x));
+    }
+
+    void operator()(const std::array<int, 64>& a) const
+    {
+        values->push_back("array" + std::to_string(a[63]));
+    }
+};
+
+// Blocks the background thread until it is released
+struct gate
+{
+    std::shared_ptr<std::atomic<bool>> open;
+    std::shared_ptr<std::atomic<int>> count;
+
+    void operator()(int) const
+    {
+        while (!*open) std::this_thread::yield();
+        ++*count;
+    }
+};
+
+struct sum
+{
+    std::atomic<long>* total;
+    void operator()(int x) const
+    {
+        *total += x;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace tap_async_test;
+    auto values = std::make_shared<std::vector<std::string>>();
+    auto log = boost::hof::tap_async(recorder{values});
+    std::string s = "hello";
+    BOOST_HOF_TEST_CHECK(log(s) == "hello");
+    STATIC_ASSERT_SAME(decltype(log(s)), std::string&);
+    BOOST_HOF_TEST_CHECK(log(3) == 3);
+    STATIC_ASSERT_SAME(decltype(log(3)), int);
+    std::array<int, 64> a = {};
+    a[63] = 7;
+    BOOST_HOF_TEST_CHECK(log(a)[63] == 7);
+    log.flush();
+    BOOST_HOF_TEST_CHECK((*values == std::vector<std::string>{ "hello", "3", "array7" }));
+    BOOST_HOF_TEST_CHECK(log.dropped() == 0);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace tap_async_test;
+    auto values = std::make_shared<std::vector<std::string>>();
+    {
+        auto log = boost::hof::tap_async(recorder{values});
+        auto f = boost::hof::flow(boost::hof::_ + 1, log, boost::hof::_ * 2, log);
+        BOOST_HOF_TEST_CHECK(f(1) == 4);
+        BOOST_HOF_TEST_CHECK(f(2) == 6);
+    }
+    // Destroying the last copy calls the sink on what is left
+    BOOST_HOF_TEST_CHECK((*values == std::vector<std::string>{ "2", "4", "3", "6" }));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace tap_async_test;
+    auto open = std::make_shared<std::atomic<bool>>(false);
+    auto count = std::make_shared<std::atomic<int>>(0);
+    auto log = boost::hof::tap_async(gate{open, count}, 4);
+    for(int i = 0; i < 20; i++) BOOST_HOF_TEST_CHECK(log(i) == i);
+    // One value may already be taken by the background thread
+    BOOST_HOF_TEST_CHECK(log.dropped() >= 15);
+    BOOST_HOF_TEST_CHECK(log.dropped() <= 16);
+    *open = true;
+    log.flush();
+    BOOST_HOF_TEST_CHECK(*count + int(log.dropped()) == 20);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace tap_async_test;
+    std::atomic<long> total(0);
+    auto log = boost::hof::tap_async(sum{&total}, 1 << 16);
+    std::vector<std::thread> threads;
+    for(int t = 0; t < 4; t++) threads.emplace_back([&] {
+        for(int i = 1; i <= 1000; i++) log(i);
+    });
+    for(auto& th:threads) th.join();
+    log.flush();
+    BOOST_HOF_TEST_CHECK(log.dropped() == 0);
+    BOOST_HOF_TEST_CHECK(total == 4 * 500500);
+}
@@ -0,0 +1,57 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    thread_local.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/thread_local.hpp>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+namespace thread_local_test {
+
+struct counter
+{
+    int n;
+    counter(int x=0) : n(x)
+    {}
+    int operator()()
+    {
+        return ++n;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::thread_local_(thread_local_test::counter());
+    BOOST_HOF_TEST_CHECK(f() == 1);
+    BOOST_HOF_TEST_CHECK(f() == 2);
+    // Each adaptor has its own copy in a thread
+    auto g = boost::hof::thread_local_(thread_local_test::counter(10));
+    BOOST_HOF_TEST_CHECK(g() == 11);
+    BOOST_HOF_TEST_CHECK(f() == 3);
+    // Copies of the adaptor share the copy of the thread
+    auto h = f;
+    BOOST_HOF_TEST_CHECK(h() == 4);
+    BOOST_HOF_TEST_CHECK(f() == 5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    const auto f = boost::hof::thread_local_(thread_local_test::counter());
+    f();
+    // Each thread starts from a copy of the function passed to thread_local_
+    std::vector<int> results(4);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) threads.emplace_back([&f, &results, i]
+    {
+        for (int j = 0; j < 99; j++) f();
+        results[i] = f();
+    });
+    for (auto& t : threads) t.join();
+    for (int r : results) BOOST_HOF_TEST_CHECK(r == 100);
+    BOOST_HOF_TEST_CHECK(f() == 2);
+}
@@ -0,0 +1,133 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    throttle.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/throttle.hpp>
+#include <boost/hof/flow.hpp>
+#include <boost/hof/pipable.hpp>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+namespace throttle_test {
+
+struct count_f
+{
+    std::atomic<int>* calls;
+
+    void operator()(int x) const
+    {
+        *calls += x;
+    }
+};
+
+struct record_f
+{
+    std::vector<std::string>* out;
+
+    void operator()(const std::string& s, int x) const
+    {
+        out->push_back(s + std::to_string(x));
+    }
+};
+
+struct add_one
+{
+    int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    typedef std::chrono::steady_clock clock;
+    boost::hof::throttle_rate r(2, std::chrono::seconds(1), 2);
+    clock::time_point t = clock::now();
+    BOOST_HOF_TEST_CHECK(r.try_acquire(t));
+    BOOST_HOF_TEST_CHECK(r.try_acquire(t));
+    BOOST_HOF_TEST_CHECK(!r.try_acquire(t));
+    BOOST_HOF_TEST_CHECK(!r.try_acquire(t + std::chrono::milliseconds(100)));
+    // A token comes back every half second
+    BOOST_HOF_TEST_CHECK(r.try_acquire(t + std::chrono::milliseconds(500)));
+    BOOST_HOF_TEST_CHECK(!r.try_acquire(t + std::chrono::milliseconds(500)));
+    BOOST_HOF_TEST_CHECK(r.try_acquire(t + std::chrono::seconds(5)));
+    BOOST_HOF_TEST_CHECK(r.try_acquire(t + std::chrono::seconds(5)));
+    BOOST_HOF_TEST_CHECK(!r.try_acquire(t + std::chrono::seconds(5)));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::atomic<int> calls(0);
+    auto f = boost::hof::throttle(boost::hof::throttle_rate(1, std::chrono::hours(1), 3))(throttle_test::count_f{&calls});
+    BOOST_HOF_TEST_CHECK(f(1));
+    BOOST_HOF_TEST_CHECK(f(1));
+    BOOST_HOF_TEST_CHECK(f(1));
+    BOOST_HOF_TEST_CHECK(!f(1));
+    BOOST_HOF_TEST_CHECK(calls == 3);
+}
+
+// The bucket is shared by the threads
+BOOST_HOF_TEST_CASE()
+{
+    std::atomic<int> calls(0);
+    auto f = boost::hof::throttle(boost::hof::throttle_rate(1, std::chrono::hours(1), 100))(throttle_test::count_f{&calls});
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++)
+        threads.emplace_back([&] { for (int j = 0; j < 1000; j++) f(1); });
+    for (auto& t : threads) t.join();
+    BOOST_HOF_TEST_CHECK(calls == 100);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::atomic<int> calls(0);
+    auto f = boost::hof::flow(throttle_test::add_one(), boost::hof::throttle(boost::hof::throttle_rate(1, std::chrono::hours(1)))(throttle_test::count_f{&calls}));
+    BOOST_HOF_TEST_CHECK(f(1));
+    BOOST_HOF_TEST_CHECK(!f(1));
+    BOOST_HOF_TEST_CHECK(calls == 2);
+    auto g = boost::hof::pipable(boost::hof::throttle(boost::hof::throttle_rate(1, std::chrono::hours(1)))(throttle_test::count_f{&calls}));
+    BOOST_HOF_TEST_CHECK(3 | g());
+    BOOST_HOF_TEST_CHECK(calls == 5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<std::string> out;
+    {
+        auto f = boost::hof::coalesce<std::string, int>(std::chrono::hours(1))(throttle_test::record_f{&out});
+        BOOST_HOF_TEST_CHECK(!f.pending());
+        f("a", 1);
+        BOOST_HOF_TEST_CHECK(!f.pending());
+        f("b", 2);
+        f("c", 3);
+        BOOST_HOF_TEST_CHECK(f.pending());
+        BOOST_HOF_TEST_CHECK(out.size() == 1);
+        auto g = f;
+        BOOST_HOF_TEST_CHECK(!g.pending());
+        f.flush();
+        BOOST_HOF_TEST_CHECK(!f.pending());
+        BOOST_HOF_TEST_CHECK(out.size() == 2);
+        BOOST_HOF_TEST_CHECK(out[1] == "c3");
+        f("d", 4);
+    }
+    BOOST_HOF_TEST_CHECK(out.size() == 3);
+    BOOST_HOF_TEST_CHECK(out[2] == "d4");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::atomic<int> calls(0);
+    auto f = boost::hof::coalesce<int>(std::chrono::nanoseconds(0))(throttle_test::count_f{&calls});
+    f(1);
+    f(2);
+    BOOST_HOF_TEST_CHECK(calls == 3);
+    BOOST_HOF_TEST_CHECK(!f.pending());
+}
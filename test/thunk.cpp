@@ -0,0 +1,129 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    thunk.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/thunk.hpp>
+#include <boost/hof/apply_eval.hpp>
+#include <boost/hof/eval.hpp>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+namespace thunk_test {
+
+struct counted
+{
+    int* calls;
+    std::string operator()() const
+    {
+        ++*calls;
+        return "value";
+    }
+};
+
+struct throws_once
+{
+    int* calls;
+    int operator()() const
+    {
+        if (++*calls == 1) throw 1;
+        return 2;
+    }
+};
+
+struct slow_count
+{
+    std::atomic<int>* calls;
+    int operator()() const
+    {
+        ++*calls;
+        std::this_thread::yield();
+        return 5;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int calls = 0;
+    auto t = boost::hof::thunk(thunk_test::counted{&calls});
+    BOOST_HOF_TEST_CHECK(!t.evaluated());
+    BOOST_HOF_TEST_CHECK(calls == 0);
+    BOOST_HOF_TEST_CHECK(t() == "value");
+    BOOST_HOF_TEST_CHECK(t() == "value");
+    BOOST_HOF_TEST_CHECK(&t() == &t());
+    BOOST_HOF_TEST_CHECK(t.evaluated());
+    BOOST_HOF_TEST_CHECK(calls == 1);
+    STATIC_ASSERT_SAME(decltype(t()), const std::string&);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int calls = 0;
+    auto t = boost::hof::thunk(thunk_test::counted{&calls});
+    auto u = t;
+    BOOST_HOF_TEST_CHECK(!u.evaluated());
+    t();
+    auto v = t;
+    BOOST_HOF_TEST_CHECK(v.evaluated());
+    BOOST_HOF_TEST_CHECK(v() == "value");
+    BOOST_HOF_TEST_CHECK(&v() != &t());
+    BOOST_HOF_TEST_CHECK(calls == 1);
+    BOOST_HOF_TEST_CHECK(u() == "value");
+    BOOST_HOF_TEST_CHECK(calls == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int calls = 0;
+    auto t = boost::hof::thunk(thunk_test::counted{&calls});
+    BOOST_HOF_TEST_CHECK(boost::hof::eval(std::ref(t)) == "value");
+    BOOST_HOF_TEST_CHECK(boost::hof::eval(std::ref(t)) == "value");
+    BOOST_HOF_TEST_CHECK(boost::hof::apply_eval([](const std::string& x, const std::string& y) { return x + y; }, std::ref(t), std::ref(t)) == "valuevalue");
+    BOOST_HOF_TEST_CHECK(calls == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int calls = 0;
+    auto t = boost::hof::thunk(thunk_test::throws_once{&calls});
+    bool thrown = false;
+    try { t(); }
+    catch(int) { thrown = true; }
+    BOOST_HOF_TEST_CHECK(thrown);
+    BOOST_HOF_TEST_CHECK(!t.evaluated());
+    BOOST_HOF_TEST_CHECK(t() == 2);
+    BOOST_HOF_TEST_CHECK(t() == 2);
+    BOOST_HOF_TEST_CHECK(calls == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int calls = 0;
+    auto t = boost::hof::synchronized_thunk(thunk_test::counted{&calls});
+    BOOST_HOF_TEST_CHECK(!t.evaluated());
+    BOOST_HOF_TEST_CHECK(boost::hof::eval(std::ref(t)) == "value");
+    BOOST_HOF_TEST_CHECK(t.evaluated());
+    auto u = t;
+    BOOST_HOF_TEST_CHECK(u.evaluated());
+    BOOST_HOF_TEST_CHECK(u() == "value");
+    BOOST_HOF_TEST_CHECK(calls == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::atomic<int> calls(0);
+    auto t = boost::hof::synchronized_thunk(thunk_test::slow_count{&calls});
+    std::atomic<int> sum(0);
+    std::vector<std::thread> threads;
+    for(int i = 0; i < 8; i++) threads.emplace_back([&] { sum += t(); });
+    for(auto& th:threads) th.join();
+    BOOST_HOF_TEST_CHECK(calls == 1);
+    BOOST_HOF_TEST_CHECK(sum == 40);
+}
@@ -0,0 +1,141 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    to_function_pointer.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/to_function_pointer.hpp>
+#include <boost/hof/compose.hpp>
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/flip.hpp>
+#include <cstdlib>
+#include <memory>
+#include <type_traits>
+#include "test.hpp"
+
+namespace to_function_pointer_test {
+
+struct increment
+{
+    int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+struct twice
+{
+    int operator()(int x) const
+    {
+        return 2 * x;
+    }
+};
+
+struct set_to
+{
+    int operator()(int& x, int y) const
+    {
+        x = y;
+        return y;
+    }
+};
+
+struct less_int
+{
+    int operator()(const void* x, const void* y) const
+    {
+        return *static_cast<const int*>(x) - *static_cast<const int*>(y);
+    }
+};
+
+struct with_state
+{
+    int n;
+    int operator()(int x) const
+    {
+        return x + n;
+    }
+};
+
+template<class Sig, class F, class=void>
+struct can_convert
+: std::false_type
+{};
+
+template<class Sig, class F>
+struct can_convert<Sig, F, typename boost::hof::detail::holder<
+    decltype(boost::hof::to_function_pointer<Sig>(std::declval<F>()))
+>::type>
+: std::true_type
+{};
+
+int call_c_api(int (*callback)(int), int x)
+{
+    return callback(x);
+}
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::compose(to_function_pointer_test::increment(), to_function_pointer_test::twice());
+    int (*p)(int) = boost::hof::to_function_pointer<int(int)>(f);
+    BOOST_HOF_TEST_CHECK(p(3) == 7);
+    BOOST_HOF_TEST_CHECK(to_function_pointer_test::call_c_api(p, 1) == 3);
+    // Each function object type has its own trampoline
+    auto g = boost::hof::compose(to_function_pointer_test::twice(), to_function_pointer_test::increment());
+    BOOST_HOF_TEST_CHECK(boost::hof::to_function_pointer<int(int)>(g)(3) == 8);
+    BOOST_HOF_TEST_CHECK(boost::hof::to_function_pointer<int(int)>(f) == p);
+}
+
+// The arguments are forwarded as the signature declares them
+BOOST_HOF_TEST_CASE()
+{
+    int x = 0;
+    auto p = boost::hof::to_function_pointer<int(int&, int)>(to_function_pointer_test::set_to());
+    BOOST_HOF_TEST_CHECK(p(x, 5) == 5);
+    BOOST_HOF_TEST_CHECK(x == 5);
+    auto q = boost::hof::to_function_pointer<void(int&, int)>(boost::hof::flip(boost::hof::flip(to_function_pointer_test::set_to())));
+    q(x, 2);
+    BOOST_HOF_TEST_CHECK(x == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int v[] = { 3, 1, 2 };
+    std::qsort(v, 3, sizeof(int), boost::hof::to_function_pointer<int(const void*, const void*)>(to_function_pointer_test::less_int()));
+    BOOST_HOF_TEST_CHECK(v[0] == 1);
+    BOOST_HOF_TEST_CHECK(v[1] == 2);
+    BOOST_HOF_TEST_CHECK(v[2] == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using to_function_pointer_test::can_convert;
+    BOOST_HOF_STATIC_TEST_CHECK(can_convert<int(int), to_function_pointer_test::increment>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(can_convert<long(int), to_function_pointer_test::increment>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(can_convert<void(int), to_function_pointer_test::increment>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!can_convert<int(int), to_function_pointer_test::with_state>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!can_convert<int(int, int), to_function_pointer_test::increment>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!can_convert<int*(int), to_function_pointer_test::increment>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(!can_convert<int(int), decltype(boost::hof::compose(
+        to_function_pointer_test::increment(), to_function_pointer_test::with_state{1}))>::value);
+}
+
+#if defined(__cpp_noexcept_function_type)
+BOOST_HOF_TEST_CASE()
+{
+    auto p = boost::hof::to_function_pointer<int(int) noexcept>(to_function_pointer_test::increment());
+    BOOST_HOF_STATIC_TEST_CHECK(std::is_same<decltype(p), int(*)(int) noexcept>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(noexcept(p(1)));
+    BOOST_HOF_TEST_CHECK(p(1) == 2);
+}
+#endif
+
+#if BOOST_HOF_HAS_STD_20
+BOOST_HOF_TEST_CASE()
+{
+    auto p = boost::hof::to_function_pointer<int(int)>(boost::hof::first_of([](int x) { return x * 3; }));
+    BOOST_HOF_TEST_CHECK(p(2) == 6);
+}
+#endif
@@ -0,0 +1,157 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    traced.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/traced.hpp>
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/function.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <boost/hof/match.hpp>
+#include "test.hpp"
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace traced_test {
+
+struct int_f
+{
+    int operator()(int) const
+    {
+        return 1;
+    }
+};
+
+struct double_f
+{
+    int operator()(double) const
+    {
+        return 2;
+    }
+};
+
+struct pointer_f
+{
+    int operator()(int*) const
+    {
+        return 3;
+    }
+};
+
+struct throws
+{
+    int operator()(int) const
+    {
+        throw std::runtime_error("traced");
+    }
+};
+
+struct collect
+{
+    std::vector<boost::hof::trace_event> * events;
+    void operator()(const boost::hof::trace_event& e) const
+    {
+        events->push_back(e);
+    }
+};
+
+inline std::vector<boost::hof::trace_event> drain()
+{
+    std::vector<boost::hof::trace_event> events;
+    boost::hof::trace_drain(collect{&events});
+    return events;
+}
+
+}
+
+BOOST_HOF_STATIC_FUNCTION(traced_sum) = boost::hof::traced<1>(binary_class());
+
+BOOST_HOF_TEST_CASE()
+{
+    traced_test::drain();
+    BOOST_HOF_TEST_CHECK(3 == traced_sum(1, 2));
+    auto events = traced_test::drain();
+    BOOST_HOF_TEST_CHECK(events.size() == 1);
+    BOOST_HOF_TEST_CHECK(events[0].id == boost::hof::trace_id(binary_class()));
+    BOOST_HOF_TEST_CHECK(traced_test::drain().empty());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // One in every 4 calls is sampled
+    traced_test::drain();
+    auto f = boost::hof::traced<4>(traced_test::int_f());
+    for (int i = 0; i < 16; i++) f(i);
+    BOOST_HOF_TEST_CHECK(traced_test::drain().size() == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The id shows which overload was selected
+    traced_test::drain();
+    auto f = boost::hof::first_of(boost::hof::traced<1>(traced_test::int_f()), boost::hof::traced<1>(traced_test::pointer_f()));
+    BOOST_HOF_TEST_CHECK(f(1) == 1);
+    BOOST_HOF_TEST_CHECK(f(nullptr) == 3);
+    auto events = traced_test::drain();
+    BOOST_HOF_TEST_CHECK(events.size() == 2);
+    BOOST_HOF_TEST_CHECK(events[0].id == boost::hof::trace_id(traced_test::int_f()));
+    BOOST_HOF_TEST_CHECK(events[1].id == boost::hof::trace_id(traced_test::pointer_f()));
+    BOOST_HOF_TEST_CHECK(events[0].id != events[1].id);
+    BOOST_HOF_TEST_CHECK(events[0].timestamp <= events[1].timestamp);
+    auto g = boost::hof::match(boost::hof::traced<1>(traced_test::double_f()), boost::hof::traced<1>(traced_test::pointer_f()));
+    BOOST_HOF_TEST_CHECK(g(1.5) == 2);
+    BOOST_HOF_TEST_CHECK(g(nullptr) == 3);
+    events = traced_test::drain();
+    BOOST_HOF_TEST_CHECK(events.size() == 2);
+    BOOST_HOF_TEST_CHECK(events[0].id == boost::hof::trace_id(traced_test::double_f()));
+    static_assert(!boost::hof::is_invocable<decltype(boost::hof::traced<1>(traced_test::int_f())), int*>::value, "Not callable");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // A call that throws is still traced
+    traced_test::drain();
+    auto f = boost::hof::traced<1>(traced_test::throws());
+    bool thrown = false;
+    try
+    {
+        f(1);
+    }
+    catch(const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    BOOST_HOF_TEST_CHECK(thrown);
+    BOOST_HOF_TEST_CHECK(traced_test::drain().size() == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The events are dropped when the buffer is full
+    traced_test::drain();
+    auto dropped = boost::hof::trace_dropped();
+    auto f = boost::hof::traced<1>(traced_test::int_f());
+    for (int i = 0; i < BOOST_HOF_TRACE_BUFFER_SIZE + 10; i++) f(i);
+    BOOST_HOF_TEST_CHECK(traced_test::drain().size() == BOOST_HOF_TRACE_BUFFER_SIZE);
+    BOOST_HOF_TEST_CHECK(boost::hof::trace_dropped() == dropped + 10);
+    f(1);
+    BOOST_HOF_TEST_CHECK(traced_test::drain().size() == 1);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The buffers of every thread are drained
+    traced_test::drain();
+    auto f = boost::hof::traced<1>(traced_test::int_f());
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) threads.emplace_back([&] {
+        for (int j = 0; j < 100; j++) f(j);
+    });
+    std::size_t n = 0;
+    for (auto& t : threads) t.join();
+    n += traced_test::drain().size();
+    BOOST_HOF_TEST_CHECK(n == 400);
+}
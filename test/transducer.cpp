@@ -0,0 +1,111 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    transducer.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/transducer.hpp>
+#include <boost/hof/compose.hpp>
+#include <boost/hof/fold.hpp>
+#include <boost/hof/parallel_fold.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+#include "test.hpp"
+
+namespace transducer_test {
+
+struct is_even
+{
+    constexpr bool operator()(int x) const
+    {
+        return x % 2 == 0;
+    }
+};
+
+struct square
+{
+    constexpr int operator()(int x) const
+    {
+        return x * x;
+    }
+};
+
+struct add
+{
+    constexpr int operator()(int x, int y) const
+    {
+        return x + y;
+    }
+};
+
+struct append
+{
+    std::string operator()(std::string s, const std::string& x) const
+    {
+        return s + x;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace transducer_test;
+    BOOST_HOF_TEST_CHECK(boost::hof::fold(boost::hof::mapping(square())(add()), 0)(1, 2, 3) == 14);
+    BOOST_HOF_TEST_CHECK(boost::hof::fold(boost::hof::filtering(is_even())(add()), 0)(1, 2, 3, 4) == 6);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::fold(boost::hof::mapping(square())(add()), 0)(1, 2, 3) == 14);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::fold(boost::hof::filtering(is_even())(add()), 0)(1, 2, 3, 4) == 6);
+}
+
+// The elements go through the transducers from left to right
+BOOST_HOF_TEST_CASE()
+{
+    using namespace transducer_test;
+    auto filter_then_map = boost::hof::compose(boost::hof::filtering(is_even()), boost::hof::mapping(square()));
+    auto map_then_filter = boost::hof::compose(boost::hof::mapping(boost::hof::_ + 1), boost::hof::filtering(is_even()));
+    BOOST_HOF_TEST_CHECK(boost::hof::fold(filter_then_map(add()), 0)(1, 2, 3, 4) == 20);
+    BOOST_HOF_TEST_CHECK(boost::hof::fold(map_then_filter(add()), 0)(1, 2, 3, 4) == 6);
+
+    std::vector<int> v = { 1, 2, 3, 4 };
+    BOOST_HOF_TEST_CHECK(std::accumulate(v.begin(), v.end(), 0, filter_then_map(add())) == 20);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace transducer_test;
+    auto r = boost::hof::fold(boost::hof::taking(2)(add()), std::make_pair(0, std::size_t(0)))(5, 6, 7, 8);
+    BOOST_HOF_TEST_CHECK(r.first == 11);
+    BOOST_HOF_TEST_CHECK(r.second == 2);
+
+    auto xf = boost::hof::compose(boost::hof::filtering(is_even()), boost::hof::taking(2), boost::hof::mapping(square()));
+    auto s = boost::hof::fold(xf(add()), std::make_pair(0, std::size_t(0)))(1, 2, 3, 4, 5, 6);
+    BOOST_HOF_TEST_CHECK(s.first == 20);
+
+    auto t = boost::hof::fold(boost::hof::taking(5)(add()), std::make_pair(0, std::size_t(0)))(1, 2);
+    BOOST_HOF_TEST_CHECK(t.first == 3);
+    BOOST_HOF_TEST_CHECK(t.second == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace transducer_test;
+    std::vector<std::string> v = { "a", "b", "c" };
+    auto r = boost::hof::fold(boost::hof::mapping(boost::hof::_ + std::string("!"))(append()), std::string())(v[0], v[1], v[2]);
+    BOOST_HOF_TEST_CHECK(r == "a!b!c!");
+}
+
+// The same reducer is used in parallel with a combine function
+BOOST_HOF_TEST_CASE()
+{
+    using namespace transducer_test;
+    std::vector<int> v;
+    for (int i = 0; i < 10000; i++) v.push_back(i % 7);
+    auto xf = boost::hof::compose(boost::hof::filtering(is_even()), boost::hof::mapping(square()));
+    int expected = std::accumulate(v.begin(), v.end(), 0, xf(add()));
+    BOOST_HOF_TEST_CHECK(boost::hof::parallel_fold(xf(add()), 0, add())(v, boost::hof::thread_executor(), 1000) == expected);
+    BOOST_HOF_TEST_CHECK(boost::hof::parallel_fold(xf(add()), 0, add())(v, boost::hof::thread_executor(), 3) == expected);
+    BOOST_HOF_TEST_CHECK(boost::hof::parallel_fold(xf(add()), 0, add())(v) == expected);
+}
@@ -0,0 +1,104 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tree_fold.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/tree_fold.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <string>
+#include "test.hpp"
+
+struct max_f
+{
+    template<class T, class U>
+    constexpr T operator()(T x, U y) const noexcept
+    {
+        return x > y ? x : y;
+    }
+};
+
+struct sum_f
+{
+    template<class T, class U>
+    constexpr T operator()(T x, U y) const BOOST_HOF_RETURNS_DEDUCE_NOEXCEPT(x+y)
+    {
+        return x + y;
+    }
+};
+
+#if BOOST_HOF_HAS_NOEXCEPT_DEDUCTION
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(noexcept(boost::hof::tree_fold(max_f(), 0)(2, 3, 4, 5)), "noexcept tree_fold");
+    static_assert(noexcept(boost::hof::tree_fold(sum_f(), 0)(2, 3, 4, 5)), "noexcept tree_fold");
+    static_assert(!noexcept(boost::hof::tree_fold(sum_f())(std::string("hello"), std::string("-"), std::string("world"))), "noexcept tree_fold");
+}
+#endif
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::tree_fold(max_f(), 0)(2, 3, 4, 5) == 5);
+    BOOST_HOF_TEST_CHECK(boost::hof::tree_fold(max_f(), 0)(5, 4, 3, 2) == 5);
+    BOOST_HOF_TEST_CHECK(boost::hof::tree_fold(max_f(), 0)(2, 3, 5, 4) == 5);
+
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::tree_fold(max_f(), 0)(2, 3, 4, 5) == 5);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::tree_fold(max_f(), 0)(5, 4, 3, 2) == 5);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::tree_fold(max_f(), 0)(2, 3, 5, 4) == 5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::tree_fold(max_f(), 0)() == 0);
+    BOOST_HOF_TEST_CHECK(boost::hof::tree_fold(max_f(), 0)(5) == 5);
+
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::tree_fold(max_f(), 0)() == 0);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::tree_fold(max_f(), 0)(5) == 5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::tree_fold(max_f())(5) == 5);
+    BOOST_HOF_TEST_CHECK(boost::hof::tree_fold(max_f())(2, 3, 5, 4) == 5);
+    BOOST_HOF_TEST_CHECK(boost::hof::tree_fold(sum_f())(1, 2, 3, 4, 5, 6, 7) == 28);
+
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::tree_fold(max_f())(5) == 5);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::tree_fold(max_f())(2, 3, 5, 4) == 5);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::tree_fold(sum_f())(1, 2, 3, 4, 5, 6, 7) == 28);
+    static_assert(!boost::hof::is_invocable<boost::hof::tree_fold_adaptor<sum_f>>::value, "Empty tree_fold");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::tree_fold(sum_f())(std::string("a"), std::string("b"), std::string("c"), std::string("d"), std::string("e")) == "abcde");
+    BOOST_HOF_TEST_CHECK(boost::hof::tree_fold(sum_f(), std::string("a"))(std::string("b"), std::string("c")) == "abc");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::tree_fold(sum_f())(
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+    ) == 64);
+}
+
+struct move_only_sum
+{
+    template<class T>
+    std::unique_ptr<int> operator()(T&& x, std::unique_ptr<int> y) const
+    {
+        return std::unique_ptr<int>(new int(*x + *y));
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    auto r = boost::hof::tree_fold(move_only_sum())(
+        std::unique_ptr<int>(new int(1)), 
+        std::unique_ptr<int>(new int(2)), 
+        std::unique_ptr<int>(new int(3))
+    );
+    BOOST_HOF_TEST_CHECK(*r == 6);
+}
@@ -0,0 +1,74 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tuple_filter.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/tuple_filter.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <boost/hof/pack.hpp>
+#include "test.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+
+using boost::hof::tuple_filter;
+
+namespace tuple_filter_test {
+
+struct is_integer
+{
+    template<class T>
+    std::is_integral<typename std::decay<T>::type> operator()(T&&) const;
+};
+
+struct is_pointer
+{
+    template<class T>
+    std::is_pointer<typename std::decay<T>::type> operator()(T&&) const;
+};
+
+struct not_unique_ptr
+{
+    template<class T>
+    std::true_type operator()(const T&) const;
+
+    template<class T>
+    std::false_type operator()(const std::unique_ptr<T>&) const;
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto r = tuple_filter(std::make_tuple(1, 2.0, 'x', 3L, 4.0f), tuple_filter_test::is_integer());
+    STATIC_ASSERT_SAME(decltype(r), std::tuple<int, char, long>);
+    BOOST_HOF_TEST_CHECK(r == std::make_tuple(1, 'x', 3L));
+    BOOST_HOF_STATIC_TEST_CHECK(std::get<1>(tuple_filter(boost::hof::pack(1.0, 2, 3.0, 4), tuple_filter_test::is_integer())) == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto none = tuple_filter(std::make_tuple(1, 2), tuple_filter_test::is_pointer());
+    STATIC_ASSERT_SAME(decltype(none), std::tuple<>);
+    auto empty = tuple_filter(std::make_tuple(), tuple_filter_test::is_pointer());
+    STATIC_ASSERT_SAME(decltype(empty), std::tuple<>);
+    std::array<int, 3> a = {{ 1, 2, 3 }};
+    BOOST_HOF_TEST_CHECK(tuple_filter(a, tuple_filter_test::is_integer()) == std::make_tuple(1, 2, 3));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The elements of an rvalue sequence are moved
+    auto t = std::make_tuple(std::unique_ptr<int>(new int(1)), std::string("abc"), 2);
+    auto r = tuple_filter(std::move(t), tuple_filter_test::not_unique_ptr());
+    STATIC_ASSERT_SAME(decltype(r), std::tuple<std::string, int>);
+    BOOST_HOF_TEST_CHECK(std::get<0>(r) == "abc");
+    BOOST_HOF_TEST_CHECK(std::get<0>(t) != nullptr);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(!boost::hof::is_invocable<decltype(tuple_filter), int, tuple_filter_test::is_integer>::value, "Not a sequence");
+}
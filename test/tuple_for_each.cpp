@@ -4,22 +4,11 @@
     Distributed under the Boost Software License, Version 1.0. (See accompanying
     file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 ==============================================================================*/
-#include <boost/hof/unpack.hpp>
-#include <boost/hof/proj.hpp>
-#include <boost/hof/function.hpp>
-#include <boost/hof/reveal.hpp>
+#include <boost/hof/tuple_for_each.hpp>
+#include <boost/hof/pack.hpp>
 #include "test.hpp"
 
-struct tuple_for_each_f
-{
-    template<class Sequence, class F>
-    constexpr auto operator()(Sequence&& s, F && f) const BOOST_HOF_RETURNS
-    (
-        boost::hof::unpack(boost::hof::proj(boost::hof::forward<F>(f)))(boost::hof::forward<Sequence>(s)), boost::hof::forward<F>(f)
-    );
-};
-
-BOOST_HOF_STATIC_FUNCTION(tuple_for_each) = tuple_for_each_f{};
+using boost::hof::tuple_for_each;
 
 BOOST_HOF_TEST_CASE()
 {
@@ -245,3 +234,22 @@ BOOST_HOF_TEST_CASE()
 #endif
     (void)r;
 }
+
+struct tuple_for_each_double
+{
+    int n;
+    template<class T>
+    void operator()(T& x) const
+    {
+        x *= 2;
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    std::tuple<int, long, double> tp{ 1, 2, 3 };
+    auto f = tuple_for_each( tp, tuple_for_each_double{ 5 } );
+    BOOST_HOF_TEST_CHECK( tp == std::make_tuple(2, 4L, 6.0) );
+    BOOST_HOF_TEST_CHECK( f.n == 5 );
+    STATIC_ASSERT_SAME(decltype(f), tuple_for_each_double);
+}
@@ -0,0 +1,114 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tuple_for_each_fused.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/tuple_for_each_fused.hpp>
+#include <boost/hof/pack.hpp>
+#include <array>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "test.hpp"
+
+namespace tuple_for_each_fused_test {
+
+struct recorder
+{
+    std::vector<std::size_t>* blocks;
+    std::string* names;
+
+    void operator()(const unsigned char*, std::size_t n) const
+    {
+        blocks->push_back(n);
+    }
+
+    void operator()(unsigned char*, std::size_t n) const
+    {
+        blocks->push_back(n);
+    }
+
+    void operator()(const std::string& s) const
+    {
+        *names += s;
+    }
+};
+
+struct tag
+{};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<std::size_t> blocks;
+    std::string names;
+    tuple_for_each_fused_test::recorder r{&blocks, &names};
+    std::array<int, 4> a = {{ 1, 2, 3, 4 }};
+    boost::hof::tuple_for_each_fused(a, r, r);
+    BOOST_HOF_TEST_CHECK(blocks.size() == 1);
+    BOOST_HOF_TEST_CHECK(blocks[0] == sizeof(a));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<std::size_t> blocks;
+    std::string names;
+    tuple_for_each_fused_test::recorder r{&blocks, &names};
+    int a[] = { 1, 2 };
+    std::string s = "x";
+    // The runs are split by the elements that are passed to the first function
+    boost::hof::tuple_for_each_fused(boost::hof::pack_forward(a[0], a[1], s, std::string("y"), a[0]), r, r);
+    BOOST_HOF_TEST_CHECK(names == "xy");
+    BOOST_HOF_TEST_CHECK(blocks.size() == 2);
+    BOOST_HOF_TEST_CHECK(blocks[0] == 2 * sizeof(int));
+    BOOST_HOF_TEST_CHECK(blocks[1] == sizeof(int));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The bytes can be written through when the elements aren't const
+    std::array<int, 2> a = {{ 0, 0 }};
+    int calls = 0;
+    boost::hof::tuple_for_each_fused(a, [](int) {}, [&](unsigned char* p, std::size_t n)
+    {
+        calls++;
+        std::memset(p, 0, n);
+        p[0] = 1;
+    });
+    BOOST_HOF_TEST_CHECK(calls == 1);
+    BOOST_HOF_TEST_CHECK(a[0] != 0);
+    // Empty elements are passed to the first function
+    int tags = 0;
+    boost::hof::tuple_for_each_fused(std::make_tuple(tuple_for_each_fused_test::tag{}), [&](tuple_for_each_fused_test::tag) { tags++; }, [&](const unsigned char*, std::size_t) { calls++; });
+    BOOST_HOF_TEST_CHECK(tags == 1);
+    BOOST_HOF_TEST_CHECK(calls == 1);
+}
+
+#if BOOST_HOF_UNPACK_AGGREGATES
+namespace tuple_for_each_fused_test {
+
+struct message
+{
+    int id;
+    int length;
+    std::string name;
+    int checksum;
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<std::size_t> blocks;
+    std::string names;
+    tuple_for_each_fused_test::recorder r{&blocks, &names};
+    const tuple_for_each_fused_test::message m = { 1, 2, "n", 3 };
+    boost::hof::tuple_for_each_fused(m, r, r);
+    BOOST_HOF_TEST_CHECK(names == "n");
+    BOOST_HOF_TEST_CHECK(blocks.size() == 2);
+    BOOST_HOF_TEST_CHECK(blocks[0] == 2 * sizeof(int));
+    BOOST_HOF_TEST_CHECK(blocks[1] == sizeof(int));
+}
+#endif
@@ -0,0 +1,51 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tuple_join.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/tuple_join.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <boost/hof/pack.hpp>
+#include "test.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+
+using boost::hof::tuple_join;
+
+BOOST_HOF_TEST_CASE()
+{
+    auto r = tuple_join(std::make_tuple(std::make_tuple(1, 2), std::make_tuple(), std::make_tuple('x', 3.0)));
+    STATIC_ASSERT_SAME(decltype(r), std::tuple<int, int, char, double>);
+    BOOST_HOF_TEST_CHECK(r == std::make_tuple(1, 2, 'x', 3.0));
+    BOOST_HOF_STATIC_TEST_CHECK(std::get<2>(tuple_join(boost::hof::pack(boost::hof::pack(1), boost::hof::pack(2, 3)))) == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto empty = tuple_join(std::make_tuple());
+    STATIC_ASSERT_SAME(decltype(empty), std::tuple<>);
+    auto empties = tuple_join(std::make_tuple(std::make_tuple(), std::make_tuple()));
+    STATIC_ASSERT_SAME(decltype(empties), std::tuple<>);
+    std::array<int, 2> a = {{ 1, 2 }};
+    std::array<int, 1> b = {{ 3 }};
+    BOOST_HOF_TEST_CHECK(tuple_join(std::make_tuple(a, b, a)) == std::make_tuple(1, 2, 3, 1, 2));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // The elements of rvalue sequences are moved
+    auto t = std::make_tuple(std::make_tuple(std::unique_ptr<int>(new int(1)), std::string("abc")), std::make_tuple(std::unique_ptr<int>(new int(2))));
+    auto r = tuple_join(std::move(t));
+    STATIC_ASSERT_SAME(decltype(r), std::tuple<std::unique_ptr<int>, std::string, std::unique_ptr<int>>);
+    BOOST_HOF_TEST_CHECK(*std::get<0>(r) == 1);
+    BOOST_HOF_TEST_CHECK(std::get<1>(r) == "abc");
+    BOOST_HOF_TEST_CHECK(*std::get<2>(r) == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(!boost::hof::is_invocable<decltype(tuple_join), std::tuple<int>>::value, "Not a sequence of sequences");
+}
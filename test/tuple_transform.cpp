@@ -4,10 +4,10 @@
     Distributed under the Boost Software License, Version 1.0. (See accompanying
     file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 ==============================================================================*/
+#include <boost/hof/tuple_transform.hpp>
 #include <boost/hof/proj.hpp>
-#include <boost/hof/construct.hpp>
+#include <boost/hof/pack.hpp>
 #include <boost/hof/unpack.hpp>
-#include <boost/hof/function.hpp>
 #include <boost/hof/placeholders.hpp>
 #include <boost/hof/compose.hpp>
 // Disable static checks for gcc 4.7
@@ -18,14 +18,8 @@
 #endif
 #include "test.hpp"
 
-struct tuple_transform_f
-{
-    template<class Sequence, class F>
-    constexpr auto operator()(Sequence&& s, F f) const BOOST_HOF_RETURNS
-    (
-        boost::hof::unpack(boost::hof::proj(f, boost::hof::construct<std::tuple>()))(boost::hof::forward<Sequence>(s))
-    );
-};
+#include <array>
+#include <string>
 
 struct pack_transform_f
 {
@@ -36,7 +30,7 @@ struct pack_transform_f
     );
 };
 
-BOOST_HOF_STATIC_FUNCTION(tuple_transform) = tuple_transform_f{};
+using boost::hof::tuple_transform;
 // BOOST_HOF_STATIC_FUNCTION(pack_transform) = pack_transform_f{};
 
 #if !BOOST_HOF_HAS_CONSTEXPR_TUPLE
@@ -88,3 +82,51 @@ BOOST_HOF_TEST_CASE()
     TUPLE_TRANSFORM_CHECK_COMPOSE(std::make_tuple(1), boost::hof::_1 * boost::hof::_1, boost::hof::_1 + boost::hof::_1);
     TUPLE_TRANSFORM_CHECK_COMPOSE(std::make_tuple(), boost::hof::_1 * boost::hof::_1, boost::hof::_1 + boost::hof::_1);
 }
+
+struct tuple_transform_twice
+{
+    template<class T>
+    constexpr T operator()(T x) const
+    {
+        return x * 2;
+    }
+};
+
+struct tuple_transform_to_string
+{
+    std::string operator()(int x) const
+    {
+        return std::to_string(x);
+    }
+};
+
+BOOST_HOF_TEST_CASE()
+{
+    auto r = tuple_transform(std::array<float, 8>{{ 1, 2, 3, 4, 5, 6, 7, 8 }}, tuple_transform_twice());
+    STATIC_ASSERT_SAME(decltype(r), std::tuple<float, float, float, float, float, float, float, float>);
+    BOOST_HOF_TEST_CHECK(r == std::make_tuple(2.f, 4.f, 6.f, 8.f, 10.f, 12.f, 14.f, 16.f));
+    BOOST_HOF_STATIC_TEST_CHECK(std::get<3>(tuple_transform(boost::hof::pack(1, 2, 3, 4), tuple_transform_twice())) == 8);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto r = tuple_transform(std::make_tuple(1, 2L, 3.0), tuple_transform_twice());
+    STATIC_ASSERT_SAME(decltype(r), std::tuple<int, long, double>);
+    BOOST_HOF_TEST_CHECK(r == std::make_tuple(2, 4L, 6.0));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto r = tuple_transform(std::make_tuple(1, 2, 3), tuple_transform_to_string());
+    BOOST_HOF_TEST_CHECK(r == std::make_tuple(std::string("1"), std::string("2"), std::string("3")));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int a = 1;
+    int b = 2;
+    auto r = tuple_transform(std::tie(a, b), tuple_transform_twice());
+    STATIC_ASSERT_SAME(decltype(r), std::tuple<int, int>);
+    BOOST_HOF_TEST_CHECK(r == std::make_tuple(2, 4));
+    BOOST_HOF_TEST_CHECK(a == 1);
+}
@@ -0,0 +1,78 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    tuple_zip_with.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/tuple_zip_with.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <boost/hof/pack.hpp>
+#include <boost/hof/placeholders.hpp>
+#include "test.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+
+using boost::hof::tuple_zip_with;
+
+namespace tuple_zip_with_test {
+
+struct add
+{
+    template<class T, class U>
+    constexpr auto operator()(T x, U y) const -> decltype(x + y)
+    {
+        return x + y;
+    }
+};
+
+struct deref_add
+{
+    int operator()(std::unique_ptr<int> x, std::unique_ptr<int> y) const
+    {
+        return *x + *y;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto r = tuple_zip_with(std::make_tuple(1, 2, 3), std::make_tuple(4, 5, 6), tuple_zip_with_test::add());
+    STATIC_ASSERT_SAME(decltype(r), std::tuple<int, int, int>);
+    BOOST_HOF_TEST_CHECK(r == std::make_tuple(5, 7, 9));
+    BOOST_HOF_STATIC_TEST_CHECK(std::get<2>(tuple_zip_with(boost::hof::pack(1, 2, 3), boost::hof::pack(4, 5, 6), tuple_zip_with_test::add())) == 9);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::array<float, 4> x = {{ 1, 2, 3, 4 }};
+    std::array<double, 4> y = {{ 0.5, 0.5, 0.5, 0.5 }};
+    auto r = tuple_zip_with(x, y, tuple_zip_with_test::add());
+    STATIC_ASSERT_SAME(decltype(r), std::tuple<double, double, double, double>);
+    BOOST_HOF_TEST_CHECK(r == std::make_tuple(1.5, 2.5, 3.5, 4.5));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto r = tuple_zip_with(std::make_tuple(std::string("a"), 2L), std::make_tuple(std::string("b"), 3.0), boost::hof::_1 + boost::hof::_2);
+    STATIC_ASSERT_SAME(decltype(r), std::tuple<std::string, double>);
+    BOOST_HOF_TEST_CHECK(r == std::make_tuple(std::string("ab"), 5.0));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto r = tuple_zip_with(
+        std::make_tuple(std::unique_ptr<int>(new int(1)), std::unique_ptr<int>(new int(2))),
+        std::make_tuple(std::unique_ptr<int>(new int(3)), std::unique_ptr<int>(new int(4))),
+        tuple_zip_with_test::deref_add()
+    );
+    BOOST_HOF_TEST_CHECK(r == std::make_tuple(4, 6));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(tuple_zip_with(std::make_tuple(), boost::hof::pack(), tuple_zip_with_test::add()) == std::make_tuple());
+    static_assert(!boost::hof::is_invocable<decltype(tuple_zip_with), std::tuple<int, int>, std::tuple<int>, tuple_zip_with_test::add>::value, "Sizes must match");
+}
@@ -0,0 +1,146 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    type_switch.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/type_switch.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+#include "test.hpp"
+
+namespace type_switch_test {
+
+struct shape
+{
+    virtual ~shape() {}
+};
+
+struct circle : shape
+{
+    int r;
+    circle(int x=1) : r(x) {}
+};
+
+struct square : shape
+{
+    int side;
+    square(int x=2) : side(x) {}
+};
+
+struct big_circle : circle
+{
+    big_circle() : circle(10) {}
+};
+
+// The circle isn't at the start of the object
+struct mixin
+{
+    long m[3];
+    virtual ~mixin() {}
+};
+
+struct tagged_circle : mixin, circle
+{
+    tagged_circle() : circle(7) {}
+};
+
+struct virtual_shape : virtual shape
+{
+    int v = 5;
+};
+
+struct virtual_other : virtual shape
+{
+    long x[2];
+};
+
+// The virtual_shape isn't at the start of the object, and shape is a
+// virtual base
+struct virtual_both : virtual_other, virtual_shape
+{};
+
+struct unrelated : shape
+{};
+
+int circle_size(const circle& c)
+{
+    return c.r;
+}
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace type_switch_test;
+    auto size = boost::hof::type_switch<shape>(
+        &circle_size,
+        [](const square& s) { return s.side; },
+        [](const virtual_shape& s) { return s.v; }
+    );
+    circle c;
+    square s;
+    big_circle b;
+    tagged_circle t;
+    virtual_both vb;
+    std::vector<const shape*> shapes = { &c, &s, &b, &t, &c, &t, &b };
+    std::vector<int> sizes;
+    for(auto p : shapes) sizes.push_back(size(*p));
+    BOOST_HOF_TEST_CHECK((sizes == std::vector<int>{1, 2, 10, 7, 1, 7, 10}));
+    BOOST_HOF_TEST_CHECK(size(static_cast<const shape&>(vb)) == 5);
+    BOOST_HOF_TEST_CHECK(size(s) == 2);
+    unrelated u;
+    bool threw = false;
+    try
+    {
+        size(u);
+    }
+    catch(const std::bad_cast&)
+    {
+        threw = true;
+    }
+    BOOST_HOF_TEST_CHECK(threw);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace type_switch_test;
+    auto grow = boost::hof::type_switch<shape>(
+        [](circle& c, int n) { c.r += n; return std::string("circle"); },
+        [](shape&, int) { return std::string("shape"); }
+    );
+    tagged_circle t;
+    square s;
+    shape& x = t;
+    BOOST_HOF_TEST_CHECK(grow(x, 3) == "circle");
+    BOOST_HOF_TEST_CHECK(t.r == 10);
+    BOOST_HOF_TEST_CHECK(grow(s, 3) == "shape");
+    static_assert(!boost::hof::is_invocable<decltype(grow), const shape&, int>::value, "The functions need a mutable object");
+    static_assert(!boost::hof::is_invocable<decltype(grow), int, int>::value, "Not derived from the base");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace type_switch_test;
+    auto size = boost::hof::type_switch<shape>(
+        [](const circle& c) { return c.r; },
+        [](const shape&) { return 0; }
+    );
+    std::vector<std::thread> threads;
+    std::vector<int> totals(4);
+    for(int i = 0; i < 4; i++)
+    {
+        threads.emplace_back([&, i]
+        {
+            circle c;
+            tagged_circle t;
+            square s;
+            for(int j = 0; j < 1000; j++) totals[i] += size(c) + size(t) + size(s);
+        });
+    }
+    for(auto& t : threads) t.join();
+    for(int x : totals) BOOST_HOF_TEST_CHECK(x == 8000);
+}
@@ -0,0 +1,132 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    typed.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/typed.hpp>
+#include <boost/hof/compose.hpp>
+#include <boost/hof/flow.hpp>
+#include <boost/hof/is_invocable.hpp>
+#include "test.hpp"
+
+#include <memory>
+
+namespace typed_test {
+
+struct increment
+{
+    template<class T>
+    constexpr T operator()(T x) const
+    {
+        return x + 1;
+    }
+};
+
+struct deref
+{
+    template<class T>
+    constexpr T operator()(T* x) const
+    {
+        return *x;
+    }
+};
+
+struct reset_f
+{
+    void operator()(std::unique_ptr<int>& p) const
+    {
+        p.reset();
+    }
+};
+
+struct take_f
+{
+    int operator()(std::unique_ptr<int> p) const
+    {
+        return *p;
+    }
+};
+
+}
+
+static constexpr boost::hof::typed_adaptor<int(int), typed_test::increment> increment_int = {};
+
+BOOST_HOF_TEST_CASE()
+{
+    STATIC_ASSERT_SAME(decltype(increment_int)::result_type, int);
+    STATIC_ASSERT_SAME(decltype(increment_int(1)), int);
+    BOOST_HOF_TEST_CHECK(increment_int(1) == 2);
+    BOOST_HOF_STATIC_TEST_CHECK(increment_int(1) == 2);
+    // The arguments are converted to the parameters
+    BOOST_HOF_TEST_CHECK(increment_int(1.5) == 2);
+    BOOST_HOF_TEST_CHECK(increment_int('a') == 'b');
+    static_assert(!boost::hof::is_invocable<decltype(increment_int), int*>::value, "Callable");
+    static_assert(!boost::hof::is_invocable<decltype(increment_int)>::value, "Callable");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::typed<long(int*)>(typed_test::deref());
+    int i = 3;
+    STATIC_ASSERT_SAME(decltype(f(&i)), long);
+    BOOST_HOF_TEST_CHECK(f(&i) == 3);
+
+    auto r = boost::hof::typed<void(std::unique_ptr<int>&)>(typed_test::reset_f());
+    std::unique_ptr<int> p(new int(1));
+    STATIC_ASSERT_SAME(decltype(r(p)), void);
+    r(p);
+    BOOST_HOF_TEST_CHECK(p == nullptr);
+
+    auto t = boost::hof::typed<int(std::unique_ptr<int>)>(typed_test::take_f());
+    BOOST_HOF_TEST_CHECK(t(std::unique_ptr<int>(new int(4))) == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    constexpr auto inc = boost::hof::typed<int(int)>(typed_test::increment());
+    constexpr auto f = boost::hof::compose(inc, inc, inc, increment_int);
+    STATIC_ASSERT_SAME(decltype(f)::result_type, int);
+    STATIC_ASSERT_SAME(decltype(f(1)), int);
+    BOOST_HOF_TEST_CHECK(f(1) == 5);
+    BOOST_HOF_STATIC_TEST_CHECK(f(1) == 5);
+    static_assert(!boost::hof::is_invocable<decltype(f), int*>::value, "Callable");
+
+    constexpr auto g = boost::hof::flow(inc, inc, inc, increment_int);
+    STATIC_ASSERT_SAME(decltype(g)::result_type, int);
+    BOOST_HOF_TEST_CHECK(g(1) == 5);
+    BOOST_HOF_STATIC_TEST_CHECK(g(1) == 5);
+    static_assert(!boost::hof::is_invocable<decltype(g), int*>::value, "Callable");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    // Only the inner function is typed
+    auto inc = boost::hof::typed<int(int)>(typed_test::increment());
+    auto f = boost::hof::compose(typed_test::increment(), inc);
+    STATIC_ASSERT_SAME(decltype(f)::result_type, int);
+    BOOST_HOF_TEST_CHECK(f(1.5) == 3);
+    auto g = boost::hof::flow(inc, typed_test::increment());
+    STATIC_ASSERT_SAME(decltype(g)::result_type, int);
+    BOOST_HOF_TEST_CHECK(g(1.5) == 3);
+    // The function that is not typed is still deduced
+    auto h = boost::hof::compose(inc, typed_test::increment());
+    STATIC_ASSERT_SAME(decltype(h(1)), int);
+    BOOST_HOF_TEST_CHECK(h(1) == 3);
+    static_assert(!boost::hof::is_invocable<decltype(h), int*>::value, "Callable");
+}
+
+#define TYPED_TEST_INC8 inc, inc, inc, inc, inc, inc, inc, inc
+#define TYPED_TEST_INC64 TYPED_TEST_INC8, TYPED_TEST_INC8, TYPED_TEST_INC8, TYPED_TEST_INC8, \
+    TYPED_TEST_INC8, TYPED_TEST_INC8, TYPED_TEST_INC8, TYPED_TEST_INC8
+
+BOOST_HOF_TEST_CASE()
+{
+    // A deep composition of typed functions doesn't nest the deduction of
+    // the return types
+    auto inc = boost::hof::typed<int(int)>(typed_test::increment());
+    auto f = boost::hof::compose(TYPED_TEST_INC64, TYPED_TEST_INC64);
+    BOOST_HOF_TEST_CHECK(f(0) == 128);
+    auto g = boost::hof::flow(TYPED_TEST_INC64, TYPED_TEST_INC64);
+    BOOST_HOF_TEST_CHECK(g(0) == 128);
+}
@@ -0,0 +1,122 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    unfold.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/unfold.hpp>
+#include <boost/hof/filter.hpp>
+#include <boost/hof/fold_into.hpp>
+#include <boost/hof/map.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "test.hpp"
+
+namespace unfold_test {
+
+struct less_than_100
+{
+    bool operator()(int x) const
+    {
+        return x < 100;
+    }
+};
+
+struct times_3
+{
+    int operator()(int x) const
+    {
+        return x * 3;
+    }
+};
+
+struct shorter_than_5
+{
+    bool operator()(const std::string& s) const
+    {
+        return s.size() < 5;
+    }
+};
+
+struct append_x
+{
+    std::string operator()(const std::string& s) const
+    {
+        return s + "x";
+    }
+};
+
+// Not default constructible
+struct state
+{
+    int n;
+    explicit state(int x) : n(x)
+    {}
+};
+
+struct state_positive
+{
+    bool operator()(const state& s) const
+    {
+        return s.n > 0;
+    }
+};
+
+struct state_decrement
+{
+    state operator()(const state& s) const
+    {
+        return state(s.n - 1);
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> v;
+    for(int x:boost::hof::unfold(unfold_test::less_than_100(), unfold_test::times_3())(1)) v.push_back(x);
+    BOOST_HOF_TEST_CHECK((v == std::vector<int>{ 1, 3, 9, 27, 81 }));
+
+    std::vector<int> empty;
+    for(int x:boost::hof::unfold(unfold_test::less_than_100(), unfold_test::times_3())(100)) empty.push_back(x);
+    BOOST_HOF_TEST_CHECK(empty.empty());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto r = boost::hof::unfold(unfold_test::shorter_than_5(), unfold_test::append_x())(std::string("ab"));
+    std::vector<std::string> v(r.begin(), r.end());
+    BOOST_HOF_TEST_CHECK((v == std::vector<std::string>{ "ab", "abx", "abxx" }));
+    auto it = r.begin();
+    BOOST_HOF_TEST_CHECK(it->size() == 2);
+    auto copy = it++;
+    BOOST_HOF_TEST_CHECK(*copy == "ab");
+    BOOST_HOF_TEST_CHECK(*it == "abx");
+    copy = it;
+    BOOST_HOF_TEST_CHECK(*copy == "abx");
+    BOOST_HOF_TEST_CHECK(copy != r.end());
+    copy = r.end();
+    BOOST_HOF_TEST_CHECK(copy == r.end());
+    STATIC_ASSERT_SAME(std::iterator_traits<decltype(it)>::iterator_category, std::input_iterator_tag);
+    STATIC_ASSERT_SAME(decltype(*it), const std::string&);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int n = 0;
+    for(auto&& s:boost::hof::unfold(unfold_test::state_positive(), unfold_test::state_decrement())(unfold_test::state(4))) n += s.n;
+    BOOST_HOF_TEST_CHECK(n == 10);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto r = boost::hof::unfold(unfold_test::less_than_100(), unfold_test::times_3())(1);
+    int sum = boost::hof::fold_into(r, boost::hof::_ + boost::hof::_, 0);
+    BOOST_HOF_TEST_CHECK(sum == 121);
+    int piped = r | boost::hof::map(boost::hof::_ + 1) | boost::hof::filter(boost::hof::_ > 5) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0);
+    BOOST_HOF_TEST_CHECK(piped == 10 + 28 + 82);
+    BOOST_HOF_TEST_CHECK((boost::hof::unfold(unfold_test::less_than_100(), unfold_test::times_3())(1) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0)) == 121);
+}
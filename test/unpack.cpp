@@ -10,6 +10,7 @@
 #include "test.hpp"
 
 #include <memory>
+#include <string>
 
 static constexpr boost::hof::static_<boost::hof::unpack_adaptor<unary_class> > unary_unpack = {};
 static constexpr boost::hof::static_<boost::hof::unpack_adaptor<binary_class> > binary_unpack = {};
@@ -253,3 +254,154 @@ BOOST_HOF_TEST_CASE()
     BOOST_HOF_TEST_CHECK(boost::hof::unpack(boost::hof::identity)(simple_unpackable{}) == 1);
     BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(boost::hof::identity)(simple_unpackable{}) == 1);
 }
+
+namespace unpack_test {
+
+struct sum_f
+{
+    template<class... Ts>
+    constexpr int operator()(const Ts&... xs) const
+    {
+        return sum(xs...);
+    }
+
+    constexpr int sum() const
+    {
+        return 0;
+    }
+
+    template<class T, class... Ts>
+    constexpr int sum(const T& x, const Ts&... xs) const
+    {
+        return x + sum(xs...);
+    }
+};
+
+struct first_address_f
+{
+    template<class T, class... Ts>
+    constexpr const T* operator()(const T& x, const Ts&...) const
+    {
+        return &x;
+    }
+};
+
+struct take_unique_f
+{
+    int operator()(std::unique_ptr<int> x, std::unique_ptr<int> y) const
+    {
+        return *x + *y;
+    }
+};
+
+static constexpr int constant_array[] = { 1, 2, 3 };
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int a[] = { 1, 2, 3, 4 };
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(unpack_test::sum_f())(a) == 10);
+    const int ca[] = { 1, 2 };
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(binary_class())(ca) == 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(unpack_test::first_address_f())(a) == &a[0]);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(unpack_test::sum_f())(a, ca) == 13);
+    BOOST_HOF_TEST_CHECK(boost::hof::is_unpackable<int[4]>::value);
+    BOOST_HOF_TEST_CHECK(boost::hof::is_unpackable<const int(&)[4]>::value);
+    BOOST_HOF_STATIC_TEST_CHECK(boost::hof::unpack(unpack_test::sum_f())(unpack_test::constant_array) == 6);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::unique_ptr<int> a[] = { std::unique_ptr<int>(new int(1)), std::unique_ptr<int>(new int(2)) };
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(unpack_test::take_unique_f())(std::move(a)) == 3);
+    BOOST_HOF_TEST_CHECK(a[0] == nullptr);
+}
+
+#if BOOST_HOF_HAS_STD_SPAN
+BOOST_HOF_TEST_CASE()
+{
+    int a[] = { 1, 2, 3, 4 };
+    std::span<int, 3> s(a + 1, 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(unpack_test::sum_f())(s) == 9);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(unpack_test::first_address_f())(s) == &a[1]);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(unpack_test::sum_f())(std::span<const int, 2>(a, 2), s) == 12);
+    BOOST_HOF_TEST_CHECK(boost::hof::is_unpackable<std::span<int, 3>>::value);
+    BOOST_HOF_TEST_CHECK(!boost::hof::is_unpackable<std::span<int>>::value);
+}
+#endif
+
+BOOST_HOF_TEST_CASE()
+{
+    int x = 1;
+    auto t = std::make_tuple(2, 3);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(unpack_test::sum_f())(std::tuple<int&>(x), t, std::make_pair(4, 5), std::make_tuple(), std::make_tuple(6)) == 21);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(unpack_test::first_address_f())(std::tuple<int&>(x), t) == &x);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(unpack_test::sum_f())(std::make_tuple(1), boost::hof::pack(2, 3), std::make_tuple(4)) == 10);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(unpack_test::take_unique_f())(
+        std::make_tuple(std::unique_ptr<int>(new int(1))),
+        std::make_tuple(std::unique_ptr<int>(new int(2)))
+    ) == 3);
+}
+
+#if BOOST_HOF_UNPACK_AGGREGATES
+namespace unpack_test {
+
+struct message
+{
+    int id;
+    std::unique_ptr<int> payload;
+    double weight;
+};
+
+struct empty_message
+{};
+
+struct point
+{
+    int x;
+    int y;
+};
+
+struct array_message
+{
+    int ids[2];
+    int weight;
+};
+
+struct derived_message : empty_message
+{
+    int id;
+};
+
+struct nested_message
+{
+    point p;
+    std::string name;
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(boost::hof::is_unpackable<unpack_test::message>::value, "Not unpackable");
+    static_assert(boost::hof::is_unpackable<const unpack_test::message&>::value, "Not unpackable");
+    static_assert(!boost::hof::is_unpackable<unpack_test::empty_message>::value, "Unpackable");
+    unpack_test::message m{1, std::unique_ptr<int>(new int(2)), 3.0};
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(unpack_test::first_address_f())(m) == &m.id);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack([](int id, const std::unique_ptr<int>& p, double w) { return id + *p + int(w); })(m) == 6);
+    auto p = boost::hof::unpack([](int, std::unique_ptr<int> x, double) { return x; })(std::move(m));
+    BOOST_HOF_TEST_CHECK(*p == 2);
+    BOOST_HOF_TEST_CHECK(m.payload == nullptr);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack(unpack_test::sum_f())(unpack_test::point{1, 2}, std::make_tuple(3)) == 6);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    static_assert(!boost::hof::is_unpackable<unpack_test::array_message>::value, "Unpackable");
+    static_assert(!boost::hof::is_unpackable<unpack_test::derived_message>::value, "Unpackable");
+    static_assert(boost::hof::is_unpackable<unpack_test::nested_message>::value, "Not unpackable");
+    unpack_test::nested_message m{{1, 2}, "a"};
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack([](unpack_test::point p, const std::string& s) { return p.x + p.y + int(s.size()); })(m) == 4);
+}
+#endif
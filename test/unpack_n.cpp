@@ -0,0 +1,150 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    unpack_n.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/unpack_n.hpp>
+#include <boost/hof/first_of.hpp>
+#include <boost/hof/fixed_view.hpp>
+#include "test.hpp"
+
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace unpack_n_test {
+
+struct count
+{
+    template<class... Ts>
+    int operator()(Ts&&...) const
+    {
+        return sizeof...(Ts);
+    }
+};
+
+struct sum
+{
+    template<class... Ts>
+    int operator()(const Ts&... xs) const
+    {
+        int r = 0;
+        (void)std::initializer_list<int>{(r += xs, 0)...};
+        return r;
+    }
+};
+
+struct increment_all
+{
+    template<class... Ts>
+    void operator()(Ts&... xs) const
+    {
+        (void)std::initializer_list<int>{(++xs, 0)...};
+    }
+};
+
+struct none
+{
+    std::string operator()() const
+    {
+        return "none";
+    }
+};
+
+struct one
+{
+    template<class T>
+    std::string operator()(const T&) const
+    {
+        return "one";
+    }
+};
+
+struct many
+{
+    template<class... Ts>
+    std::string operator()(const Ts&...) const
+    {
+        return "many";
+    }
+};
+
+struct mixed
+{
+    int operator()() const
+    {
+        return 0;
+    }
+
+    template<class T, class... Ts>
+    long operator()(const T& x, const Ts&...) const
+    {
+        return x;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> v;
+    auto count = boost::hof::unpack_n<4>(unpack_n_test::count());
+    for(int i = 0; i <= 4; i++)
+    {
+        BOOST_HOF_TEST_CHECK(count(v) == i);
+        v.push_back(i);
+    }
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack_n<8>(unpack_n_test::sum())(v) == 0 + 1 + 2 + 3 + 4);
+    const std::vector<int> cv = { 1, 2, 3 };
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack_n<8>(unpack_n_test::sum())(cv) == 6);
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack_n<8>(unpack_n_test::sum())(std::vector<int>{ 4, 5 }) == 9);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> v = { 1, 2, 3 };
+    boost::hof::unpack_n<3>(unpack_n_test::increment_all())(v);
+    BOOST_HOF_TEST_CHECK(v == (std::vector<int>{ 2, 3, 4 }));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::unpack_n<4>(boost::hof::first_of(
+        unpack_n_test::none(), 
+        unpack_n_test::one(), 
+        unpack_n_test::many()
+    ));
+    BOOST_HOF_TEST_CHECK(f(std::vector<int>{}) == "none");
+    BOOST_HOF_TEST_CHECK(f(std::vector<int>{ 1 }) == "one");
+    BOOST_HOF_TEST_CHECK(f(std::vector<int>{ 1, 2, 3 }) == "many");
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::unpack_n<2>(unpack_n_test::mixed());
+    static_assert(std::is_same<decltype(f(std::vector<int>())), long>::value, "Results are not converted to the common type");
+    BOOST_HOF_TEST_CHECK(f(std::vector<int>{}) == 0);
+    BOOST_HOF_TEST_CHECK(f(std::vector<int>{ 7, 8 }) == 7);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    bool thrown = false;
+    try
+    {
+        boost::hof::unpack_n<2>(unpack_n_test::count())(std::vector<int>{ 1, 2, 3 });
+    }
+    catch(const std::out_of_range&)
+    {
+        thrown = true;
+    }
+    BOOST_HOF_TEST_CHECK(thrown);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    int a[] = { 1, 2, 3 };
+    BOOST_HOF_TEST_CHECK(boost::hof::unpack_n<3>(unpack_n_test::sum())(boost::hof::make_fixed_view<2>(a)) == 3);
+}
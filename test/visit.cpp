@@ -0,0 +1,211 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    visit.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/visit.hpp>
+#include <boost/hof/match.hpp>
+#include <boost/hof/first_of.hpp>
+#include "test.hpp"
+
+#if BOOST_HOF_HAS_STD_VARIANT
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace visit_test {
+
+struct int_class
+{
+    int operator()(int) const
+    {
+        return 1;
+    }
+};
+
+struct string_class
+{
+    int operator()(const std::string&) const
+    {
+        return 2;
+    }
+};
+
+struct double_class
+{
+    int operator()(double) const
+    {
+        return 3;
+    }
+};
+
+struct sum_f
+{
+    template<class T, class U>
+    double operator()(T x, U y) const
+    {
+        return x + y;
+    }
+};
+
+struct size_f
+{
+    template<class T>
+    std::size_t operator()(const T&) const
+    {
+        return sizeof(T);
+    }
+
+    long operator()(const std::string& s) const
+    {
+        return long(s.size());
+    }
+};
+
+struct take_f
+{
+    std::unique_ptr<int> operator()(std::unique_ptr<int>&& p) const
+    {
+        return std::move(p);
+    }
+
+    std::unique_ptr<int> operator()(int x) const
+    {
+        return std::unique_ptr<int>(new int(x));
+    }
+};
+
+struct ref_f
+{
+    template<class T>
+    void operator()(T& x) const
+    {
+        x = T();
+    }
+};
+
+struct throw_on_copy
+{
+    throw_on_copy()
+    {}
+
+    throw_on_copy(const throw_on_copy&)
+    {
+        throw std::runtime_error("copy");
+    }
+};
+
+template<class T>
+struct alternative
+{
+    int operator()(T) const
+    {
+        return int(T::value);
+    }
+};
+
+template<int N>
+struct tag : std::integral_constant<int, N>
+{};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::match(visit_test::int_class(), visit_test::string_class(), visit_test::double_class());
+    std::variant<int, std::string, double> v = 5;
+    BOOST_HOF_TEST_CHECK(boost::hof::visit(f, v) == 1);
+    v = std::string("hello");
+    BOOST_HOF_TEST_CHECK(boost::hof::visit(f, v) == 2);
+    v = 2.5;
+    BOOST_HOF_TEST_CHECK(boost::hof::visit(f, v) == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    auto f = boost::hof::first_of(visit_test::string_class(), visit_test::int_class());
+    const std::variant<int, std::string> v = std::string("hello");
+    BOOST_HOF_TEST_CHECK(boost::hof::visit(f, v) == 2);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::variant<int, double> x = 1;
+    std::variant<int, double, char> y = 2.5;
+    STATIC_ASSERT_SAME(decltype(boost::hof::visit(visit_test::sum_f(), x, y)), double);
+    BOOST_HOF_TEST_CHECK(boost::hof::visit(visit_test::sum_f(), x, y) == 3.5);
+    x = 0.5;
+    y = char(1);
+    BOOST_HOF_TEST_CHECK(boost::hof::visit(visit_test::sum_f(), x, y) == 1.5);
+    BOOST_HOF_TEST_CHECK(boost::hof::visit(visit_test::sum_f(), y, x) == 1.5);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::variant<int, std::string> v = std::string("abc");
+    STATIC_ASSERT_SAME(decltype(boost::hof::visit(visit_test::size_f(), v)), std::common_type<std::size_t, long>::type);
+    BOOST_HOF_TEST_CHECK(boost::hof::visit(visit_test::size_f(), v) == 3);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::variant<int, std::unique_ptr<int>> v = std::unique_ptr<int>(new int(3));
+    auto p = boost::hof::visit(visit_test::take_f(), std::move(v));
+    BOOST_HOF_TEST_CHECK(*p == 3);
+    v = 4;
+    BOOST_HOF_TEST_CHECK(*boost::hof::visit(visit_test::take_f(), std::move(v)) == 4);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::variant<int, std::string> v = std::string("abc");
+    boost::hof::visit(visit_test::ref_f(), v);
+    BOOST_HOF_TEST_CHECK(std::get<std::string>(v).empty());
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    BOOST_HOF_TEST_CHECK(boost::hof::visit([] { return 7; }) == 7);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::variant<int, visit_test::throw_on_copy> v = 1;
+    try
+    {
+        visit_test::throw_on_copy x;
+        v = x;
+    }
+    catch(const std::runtime_error&)
+    {}
+    bool caught = false;
+    try
+    {
+        boost::hof::visit(visit_test::size_f(), v);
+    }
+    catch(const std::bad_variant_access&)
+    {
+        caught = true;
+    }
+    BOOST_HOF_TEST_CHECK(caught);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace visit_test;
+    auto f = boost::hof::match(
+        alternative<tag<0>>(), alternative<tag<1>>(), alternative<tag<2>>(), alternative<tag<3>>(),
+        alternative<tag<4>>(), alternative<tag<5>>(), alternative<tag<6>>(), alternative<tag<7>>(),
+        alternative<tag<8>>(), alternative<tag<9>>(), alternative<tag<10>>(), alternative<tag<11>>()
+    );
+    std::variant<tag<0>, tag<1>, tag<2>, tag<3>, tag<4>, tag<5>, tag<6>, tag<7>, tag<8>, tag<9>, tag<10>, tag<11>> v;
+    BOOST_HOF_TEST_CHECK(boost::hof::visit(f, v) == 0);
+    v = tag<7>();
+    BOOST_HOF_TEST_CHECK(boost::hof::visit(f, v) == 7);
+    v = tag<11>();
+    BOOST_HOF_TEST_CHECK(boost::hof::visit(f, v) == 11);
+}
+
+#endif
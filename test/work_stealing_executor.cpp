@@ -0,0 +1,121 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    work_stealing_executor.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/work_stealing_executor.hpp>
+#include <boost/hof/parallel_combine.hpp>
+#include <boost/hof/parallel_fold.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include "test.hpp"
+
+namespace work_stealing_executor_test {
+
+long fib(const boost::hof::work_stealing_executor& e, int n)
+{
+    if (n < 12) return n < 2 ? n : fib(e, n - 1) + fib(e, n - 2);
+    long x = 0;
+    long y = 0;
+    boost::hof::fork_join(e, [&]{ x = fib(e, n - 1); }, [&]{ y = fib(e, n - 2); });
+    return x + y;
+}
+
+struct mini_tuple
+{
+    template<class... Ts>
+    std::tuple<Ts...> operator()(Ts... xs) const
+    {
+        return std::tuple<Ts...>(xs...);
+    }
+};
+
+struct times2
+{
+    int operator()(int x) const
+    {
+        return 2 * x;
+    }
+};
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace work_stealing_executor_test;
+    boost::hof::work_stealing_pool pool(4);
+    BOOST_HOF_TEST_CHECK(pool.size() == 4);
+    BOOST_HOF_TEST_CHECK(fib(pool.executor(), 25) == 75025);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace work_stealing_executor_test;
+    // Waiting runs the other tasks, so a single worker can't deadlock
+    boost::hof::work_stealing_pool pool(1);
+    BOOST_HOF_TEST_CHECK(fib(pool.executor(), 20) == 6765);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::work_stealing_pool pool(2);
+    auto e = pool.executor();
+    auto h1 = e.submit([]{ return std::string("abc"); });
+    auto h2 = e.submit([]{ return std::unique_ptr<int>(new int(2)); });
+    int x = 3;
+    auto h3 = e.submit([&]() -> int& { return x; });
+    auto h4 = e.submit([]{});
+    BOOST_HOF_TEST_CHECK(h1.get() == "abc");
+    BOOST_HOF_TEST_CHECK(*h2.get() == 2);
+    BOOST_HOF_TEST_CHECK(&h3.get() == &x);
+    h4.get();
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    boost::hof::work_stealing_pool pool(2);
+    auto h = pool.executor().submit([]() -> int { throw std::runtime_error("task failed"); });
+    bool threw = false;
+    try
+    {
+        h.get();
+    }
+    catch(const std::runtime_error&)
+    {
+        threw = true;
+    }
+    BOOST_HOF_TEST_CHECK(threw);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::atomic<int> n(0);
+    {
+        boost::hof::work_stealing_pool pool(3);
+        // More tasks than a deque holds
+        pool.executor().submit([&]
+        {
+            for(int i = 0; i < 5000; i++) pool.executor().execute([&]{ n++; });
+        }).get();
+        for(int i = 0; i < 1000; i++) pool.executor().execute([&]{ n++; });
+    }
+    BOOST_HOF_TEST_CHECK(n == 6000);
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace work_stealing_executor_test;
+    auto e = boost::hof::work_stealing_executor();
+    BOOST_HOF_TEST_CHECK(e.pool == &boost::hof::work_stealing_pool::shared());
+    auto f = boost::hof::parallel_combine(boost::hof::parallel_on(e), mini_tuple(), times2(), times2(), times2());
+    BOOST_HOF_TEST_CHECK(f(1, 2, 3) == std::make_tuple(2, 4, 6));
+    std::vector<long> v(100000, 1);
+    BOOST_HOF_TEST_CHECK(boost::hof::parallel_fold(boost::hof::_ + boost::hof::_, 0L)(v, e, 1000) == 100000);
+}
@@ -0,0 +1,96 @@
+/*=============================================================================
+    Copyright (c) 2017 Paul Fultz II
+    zip_with.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/hof/zip_with.hpp>
+#include <boost/hof/filter.hpp>
+#include <boost/hof/fold_into.hpp>
+#include <boost/hof/lazy.hpp>
+#include <boost/hof/map.hpp>
+#include <boost/hof/placeholders.hpp>
+#include <boost/hof/proj.hpp>
+#include <array>
+#include <forward_list>
+#include <list>
+#include <string>
+#include <vector>
+#include "test.hpp"
+
+namespace zip_with_test {
+
+struct sum3
+{
+    int operator()(int x, int y, int z) const
+    {
+        return x + y + z;
+    }
+};
+
+struct length
+{
+    int operator()(const std::string& s) const
+    {
+        return int(s.size());
+    }
+};
+
+template<class View>
+std::vector<int> to_vector(const View& v)
+{
+    std::vector<int> result;
+    v.for_each([&](int x) { result.push_back(x); });
+    return result;
+}
+
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace zip_with_test;
+    std::vector<int> x = { 1, 2, 3 };
+    std::vector<int> y = { 4, 5, 6 };
+    int z[] = { 10, 20, 30, 40 };
+    BOOST_HOF_TEST_CHECK((to_vector(boost::hof::zip_with(sum3())(x, y, z)) == std::vector<int>{ 15, 27, 39 }));
+    BOOST_HOF_TEST_CHECK((to_vector(boost::hof::zip_with(boost::hof::_ * boost::hof::_)(x, std::array<int, 2>{{ 2, 2 }})) == std::vector<int>{ 2, 4 }));
+    BOOST_HOF_TEST_CHECK(to_vector(boost::hof::zip_with(boost::hof::_ + boost::hof::_)(x, std::vector<int>())).empty());
+    BOOST_HOF_TEST_CHECK((to_vector(boost::hof::zip_with(boost::hof::_ + 1)(z)) == std::vector<int>{ 11, 21, 31, 41 }));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace zip_with_test;
+    std::list<int> l = { 1, 2, 3, 4 };
+    std::forward_list<int> f = { 10, 20, 30 };
+    std::vector<int> v = { 100, 200, 300, 400, 500 };
+    BOOST_HOF_TEST_CHECK((to_vector(boost::hof::zip_with(boost::hof::_ + boost::hof::_)(l, v)) == std::vector<int>{ 101, 202, 303, 404 }));
+    BOOST_HOF_TEST_CHECK((to_vector(boost::hof::zip_with(sum3())(l, f, v)) == std::vector<int>{ 111, 222, 333 }));
+    BOOST_HOF_TEST_CHECK((to_vector(boost::hof::zip_with(boost::hof::_ - boost::hof::_)(v, f)) == std::vector<int>{ 90, 180, 270 }));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    using namespace zip_with_test;
+    std::vector<std::string> a = { "a", "bb", "ccc" };
+    std::vector<std::string> b = { "dddd", "e", "ff" };
+    auto longest = boost::hof::zip_with(boost::hof::proj(length(), boost::hof::_ + boost::hof::_))(a, b);
+    BOOST_HOF_TEST_CHECK((to_vector(longest) == std::vector<int>{ 5, 3, 5 }));
+    std::vector<int> x = { 1, 2, 3 };
+    std::vector<int> y = { 4, 5, 6 };
+    auto lazy_sum = boost::hof::zip_with(boost::hof::lazy(sum3())(std::placeholders::_1, std::placeholders::_2, 100))(x, y);
+    BOOST_HOF_TEST_CHECK((to_vector(lazy_sum) == std::vector<int>{ 105, 107, 109 }));
+}
+
+BOOST_HOF_TEST_CASE()
+{
+    std::vector<int> x = { 1, 2, 3 };
+    std::vector<int> y = { 4, 5, 6 };
+    int dot = boost::hof::zip_with(boost::hof::_ * boost::hof::_)(x, y) | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0);
+    BOOST_HOF_TEST_CHECK(dot == 32);
+    int r = boost::hof::zip_with(boost::hof::_ + boost::hof::_)(x, std::vector<int>{ 1, 1, 1 })
+        | boost::hof::map(boost::hof::_ * 10)
+        | boost::hof::filter(boost::hof::_ > 20)
+        | boost::hof::fold_into(boost::hof::_ + boost::hof::_, 0);
+    BOOST_HOF_TEST_CHECK(r == 70);
+}